@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AK/Assertions.h>
+#include <AK/Badge.h>
 #include <AK/Error.h>
 #include <AK/Span.h>
 #include <AK/Types.h>
@@ -298,6 +299,17 @@ public:
     operator ReadonlyBytes() const { return bytes(); }
 
     ALWAYS_INLINE size_t capacity() const { return m_inline ? inline_capacity : m_outline_capacity; }
+    [[nodiscard]] bool is_inline() const { return m_inline; }
+
+    // Hands the outline buffer over to the caller, who becomes responsible for freeing it. This leaves the ByteBuffer empty.
+    [[nodiscard]] u8* leak_outline_buffer(Badge<StringBuilder>)
+    {
+        VERIFY(!m_inline);
+        auto* buffer = m_outline_buffer;
+        m_inline = true;
+        m_size = 0;
+        return buffer;
+    }
 
 private:
     void move_from(ByteBuffer&& other)
@@ -22,6 +22,7 @@ struct DeprecatedFlyStringImplTraits : public Traits<StringImpl const*> {
     }
 };
 
+// FIXME: Like the FlyString table, this is only safe to use from one thread, since StringImpl's reference count is not atomic.
 static Singleton<HashTable<StringImpl const*, DeprecatedFlyStringImplTraits>> s_table;
 
 static HashTable<StringImpl const*, DeprecatedFlyStringImplTraits>& fly_impls()
@@ -20,6 +20,10 @@ struct FlyStringTableHashTraits : public Traits<Detail::StringData const*> {
     static bool equals(Detail::StringData const* a, Detail::StringData const* b) { return *a == *b; }
 };
 
+// FIXME: This table is not safe to use from more than one thread. Sharding it and taking locks would not be enough on
+//        its own: StringData is reference counted non-atomically, and a lookup may hand out a new reference to an
+//        entry that another thread is in the middle of destroying (see did_destroy_fly_string_data()). Off-main-thread
+//        users need atomic reference counts for fly strings first, or a per-thread table whose entries never leave it.
 static auto& all_fly_strings()
 {
     static Singleton<HashTable<Detail::StringData const*, FlyStringTableHashTraits>> table;
@@ -565,10 +565,17 @@ private:
             return nullptr;
 
         hash %= m_capacity;
-        for (;;) {
+        for (size_t probe_length = 0;; ++probe_length) {
             auto* bucket = &m_buckets[hash];
             if (bucket->state == BucketState::Free)
                 return nullptr;
+
+            // OPTIMIZATION: Robin hood insertion keeps every run of buckets sorted by probe length, so once we reach a
+            //               bucket that is closer to its ideal index than we are to ours, the value cannot be further
+            //               along. This stops misses early instead of walking until the next free bucket.
+            if (used_bucket_probe_length(*bucket) < probe_length)
+                return nullptr;
+
             if (predicate(*bucket->slot()))
                 return bucket;
             if (++hash == m_capacity) [[unlikely]]
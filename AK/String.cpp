@@ -11,6 +11,7 @@
 #include <AK/MemMem.h>
 #include <AK/Stream.h>
 #include <AK/String.h>
+#include <AK/StringData.h>
 #include <AK/Vector.h>
 #include <stdlib.h>
 
@@ -26,6 +27,11 @@ String String::from_utf8_without_validation(ReadonlyBytes bytes)
     return result;
 }
 
+String String::from_string_builder_buffer(Badge<StringBuilder>, NonnullRefPtr<Detail::StringData const> data)
+{
+    return String { StringBase { move(data) } };
+}
+
 ErrorOr<String> String::from_utf8(StringView view)
 {
     if (!Utf8View { view }.validate())
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <AK/Badge.h>
 #include <AK/CharacterTypes.h>
 #include <AK/Concepts.h>
 #include <AK/Format.h>
@@ -190,6 +191,8 @@ public:
     requires(IsSame<RemoveCVReference<T>, StringView>)
     static ErrorOr<String> from_byte_string(T&&) = delete;
 
+    static String from_string_builder_buffer(Badge<StringBuilder>, NonnullRefPtr<Detail::StringData const>);
+
 private:
     friend class ::AK::FlyString;
 
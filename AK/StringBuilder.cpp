@@ -11,21 +11,23 @@
 #include <AK/FlyString.h>
 #include <AK/String.h>
 #include <AK/StringBuilder.h>
+#include <AK/StringData.h>
 #include <AK/StringView.h>
 #include <AK/UnicodeUtils.h>
 #include <AK/Utf16View.h>
 #include <AK/Utf32View.h>
+#include <AK/Utf8View.h>
 
 namespace AK {
 
 inline ErrorOr<void> StringBuilder::will_append(size_t size)
 {
     if (m_use_inline_capacity_only == UseInlineCapacityOnly::Yes) {
-        VERIFY(m_buffer.capacity() == StringBuilder::inline_capacity);
+        VERIFY(m_buffer.capacity() == string_data_header_size + StringBuilder::inline_capacity);
         Checked<size_t> current_pointer = m_buffer.size();
         current_pointer += size;
         VERIFY(!current_pointer.has_overflow());
-        if (current_pointer <= StringBuilder::inline_capacity) {
+        if (current_pointer <= string_data_header_size + StringBuilder::inline_capacity) {
             return {};
         }
         return Error::from_errno(ENOMEM);
@@ -47,33 +49,52 @@ inline ErrorOr<void> StringBuilder::will_append(size_t size)
 ErrorOr<StringBuilder> StringBuilder::create(size_t initial_capacity)
 {
     StringBuilder builder;
-    TRY(builder.m_buffer.try_ensure_capacity(initial_capacity));
+    TRY(builder.m_buffer.try_ensure_capacity(string_data_header_size + initial_capacity));
     return builder;
 }
 
 StringBuilder::StringBuilder(size_t initial_capacity)
 {
-    m_buffer.ensure_capacity(initial_capacity);
+    m_buffer.ensure_capacity(string_data_header_size + initial_capacity);
+    m_buffer.resize(string_data_header_size);
 }
 
 StringBuilder::StringBuilder(UseInlineCapacityOnly use_inline_capacity_only)
     : m_use_inline_capacity_only(use_inline_capacity_only)
 {
+    m_buffer.resize(string_data_header_size);
+}
+
+StringBuilder::StringBuilder(StringBuilder&& other)
+    : m_use_inline_capacity_only(other.m_use_inline_capacity_only)
+    , m_buffer(move(other.m_buffer))
+{
+    other.m_buffer.resize(string_data_header_size);
+}
+
+StringBuilder& StringBuilder::operator=(StringBuilder&& other)
+{
+    if (this != &other) {
+        m_use_inline_capacity_only = other.m_use_inline_capacity_only;
+        m_buffer = move(other.m_buffer);
+        other.m_buffer.resize(string_data_header_size);
+    }
+    return *this;
 }
 
 size_t StringBuilder::length() const
 {
-    return m_buffer.size();
+    return m_buffer.size() - string_data_header_size;
 }
 
 bool StringBuilder::is_empty() const
 {
-    return m_buffer.is_empty();
+    return length() == 0;
 }
 
 void StringBuilder::trim(size_t count)
 {
-    auto decrease_count = min(m_buffer.size(), count);
+    auto decrease_count = min(length(), count);
     m_buffer.resize(m_buffer.size() - decrease_count);
 }
 
@@ -138,16 +159,47 @@ ByteString StringBuilder::to_byte_string() const
     return ByteString((char const*)data(), length());
 }
 
-ErrorOr<String> StringBuilder::to_string() const
+ErrorOr<String> StringBuilder::to_string() const&
 {
     return String::from_utf8(string_view());
 }
 
-String StringBuilder::to_string_without_validation() const
+ErrorOr<String> StringBuilder::to_string() &&
+{
+    if (!Utf8View { string_view() }.validate())
+        return Error::from_string_literal("StringBuilder::to_string: Input was not valid UTF-8");
+    return move(*this).to_string_without_validation();
+}
+
+String StringBuilder::to_string_without_validation() const&
 {
     return String::from_utf8_without_validation(string_view().bytes());
 }
 
+String StringBuilder::to_string_without_validation() &&
+{
+    static_assert(sizeof(Detail::StringData) == string_data_header_size);
+
+    auto byte_count = length();
+
+    // Short strings live inside the String itself, and an inline buffer lives inside the builder, so both are copied.
+    if (byte_count <= Detail::MAX_SHORT_STRING_BYTE_COUNT || m_buffer.is_inline()) {
+        auto string = String::from_utf8_without_validation(string_view().bytes());
+        clear();
+        return string;
+    }
+
+    void* buffer = m_buffer.leak_outline_buffer({});
+    m_buffer.resize(string_data_header_size);
+
+    // Give back the unused capacity. Shrinking an allocation does not move it with any common allocator.
+    if (auto* shrunk_buffer = realloc(buffer, string_data_header_size + byte_count))
+        buffer = shrunk_buffer;
+
+    auto data = Detail::StringData::create_from_string_builder_buffer({}, buffer, byte_count);
+    return String::from_string_builder_buffer({}, move(data));
+}
+
 FlyString StringBuilder::to_fly_string_without_validation() const
 {
     return FlyString::from_utf8_without_validation(string_view().bytes());
@@ -160,22 +212,23 @@ ErrorOr<FlyString> StringBuilder::to_fly_string() const
 
 u8* StringBuilder::data()
 {
-    return m_buffer.data();
+    return m_buffer.data() + string_data_header_size;
 }
 
 u8 const* StringBuilder::data() const
 {
-    return m_buffer.data();
+    return m_buffer.data() + string_data_header_size;
 }
 
 StringView StringBuilder::string_view() const
 {
-    return StringView { data(), m_buffer.size() };
+    return StringView { data(), length() };
 }
 
 void StringBuilder::clear()
 {
     m_buffer.clear();
+    m_buffer.resize(string_data_header_size);
 }
 
 ErrorOr<void> StringBuilder::try_append_code_point(u32 code_point)
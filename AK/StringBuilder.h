@@ -31,6 +31,11 @@ public:
     explicit StringBuilder(UseInlineCapacityOnly use_inline_capacity_only);
     ~StringBuilder() = default;
 
+    StringBuilder(StringBuilder const&) = default;
+    StringBuilder& operator=(StringBuilder const&) = default;
+    StringBuilder(StringBuilder&&);
+    StringBuilder& operator=(StringBuilder&&);
+
     ErrorOr<void> try_append(StringView);
     ErrorOr<void> try_append(Utf16View const&);
     ErrorOr<void> try_append(Utf32View const&);
@@ -67,8 +72,12 @@ public:
 
     [[nodiscard]] ByteString to_byte_string() const;
 
-    [[nodiscard]] String to_string_without_validation() const;
-    ErrorOr<String> to_string() const;
+    // NOTE: Calling these on an rvalue builder (e.g. `move(builder).to_string()`) adopts the builder's buffer into the
+    //       resulting String instead of copying it, and leaves the builder empty.
+    [[nodiscard]] String to_string_without_validation() const&;
+    [[nodiscard]] String to_string_without_validation() &&;
+    ErrorOr<String> to_string() const&;
+    ErrorOr<String> to_string() &&;
 
     [[nodiscard]] FlyString to_fly_string_without_validation() const;
     ErrorOr<FlyString> to_fly_string() const;
@@ -102,12 +111,16 @@ public:
     }
 
 private:
+    // The buffer starts with room for a String's header (a Detail::StringData), so that the buffer can become a String
+    // without being copied.
+    static constexpr size_t string_data_header_size = 16;
+
     ErrorOr<void> will_append(size_t);
     u8* data();
     u8 const* data() const;
 
     UseInlineCapacityOnly m_use_inline_capacity_only { UseInlineCapacityOnly::No };
-    Detail::ByteBuffer<inline_capacity> m_buffer;
+    Detail::ByteBuffer<inline_capacity + string_data_header_size> m_buffer;
 };
 
 }
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Badge.h>
 #include <AK/RefCounted.h>
 #include <AK/kmalloc.h>
 
@@ -25,6 +26,13 @@ public:
         return new_string_data;
     }
 
+    // Takes ownership of a buffer with room for a StringData at its start, followed by byte_count bytes of string data.
+    static NonnullRefPtr<StringData> create_from_string_builder_buffer(Badge<StringBuilder>, void* slot, size_t byte_count)
+    {
+        VERIFY(byte_count);
+        return adopt_ref(*new (slot) StringData(byte_count));
+    }
+
     static ErrorOr<NonnullRefPtr<StringData>> create_substring(StringData const& superstring, size_t start, size_t byte_count)
     {
         // Strings of MAX_SHORT_STRING_BYTE_COUNT bytes or less should be handled by the String short string optimization.
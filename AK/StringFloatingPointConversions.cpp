@@ -66,6 +66,22 @@ FloatingPointExponentialForm inner_convert_floating_point_to_decimal_exponential
     i32 real_exponent = (exponent == 0 ? 1 : exponent) - Extractor::exponent_bias - Extractor::mantissa_bits;
     // abs(value) = real_mantissa * 2 ^ real_exponent
 
+    // OPTIMIZATION: Integers that fit into the mantissa are spaced at most one apart, so no number with fewer digits
+    //               rounds to them, except for the integer itself with its trailing zeros removed. This is the same
+    //               shortcut the reference implementation takes, and it saves the table lookups for the most common values.
+    if (real_exponent <= 0 && real_exponent >= -static_cast<i32>(Extractor::mantissa_bits)) {
+        auto fractional_bits = static_cast<u32>(-real_exponent);
+        if ((real_mantissa & ((1ull << fractional_bits) - 1)) == 0) {
+            u64 fraction = real_mantissa >> fractional_bits;
+            i32 decimal_exponent = 0;
+            while (fraction % 10 == 0) {
+                fraction /= 10;
+                ++decimal_exponent;
+            }
+            return { sign, fraction, decimal_exponent };
+        }
+    }
+
     // Step 2. Determine the interval of information-preserving outputs.
     // u, v, w are, respectively, lower bound for answer, exact value and upper bound for answer.
     i32 synthetic_exponent = real_exponent - 2;
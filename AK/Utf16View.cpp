@@ -27,8 +27,28 @@ static ErrorOr<Utf16Data> to_utf16_impl(UtfViewType const& view)
     Utf16Data utf16_data;
     TRY(utf16_data.try_ensure_capacity(view.length()));
 
-    for (auto code_point : view)
-        TRY(code_point_to_utf16(utf16_data, code_point));
+    if constexpr (IsSame<UtfViewType, Utf8View>) {
+        // OPTIMIZATION: ASCII bytes map to UTF-16 code units one to one, so runs of them can be copied over directly.
+        //               The remaining bytes are split up at ASCII bytes, which never belong to a multi-byte sequence.
+        auto const* bytes = view.bytes();
+        for (size_t offset = 0; offset < view.byte_length();) {
+            auto ascii_bytes = view.ascii_byte_count_from(offset);
+            TRY(utf16_data.try_ensure_capacity(utf16_data.size() + ascii_bytes));
+            for (size_t i = 0; i < ascii_bytes; ++i)
+                utf16_data.unchecked_append(bytes[offset + i]);
+            offset += ascii_bytes;
+
+            size_t non_ascii_bytes = 0;
+            while (offset + non_ascii_bytes < view.byte_length() && bytes[offset + non_ascii_bytes] > 0x7F)
+                ++non_ascii_bytes;
+            for (auto code_point : view.substring_view(offset, non_ascii_bytes))
+                TRY(code_point_to_utf16(utf16_data, code_point));
+            offset += non_ascii_bytes;
+        }
+    } else {
+        for (auto code_point : view)
+            TRY(code_point_to_utf16(utf16_data, code_point));
+    }
 
     return utf16_data;
 }
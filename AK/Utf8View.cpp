@@ -70,11 +70,39 @@ Utf8View Utf8View::unicode_substring_view(size_t code_point_offset, size_t code_
     VERIFY_NOT_REACHED();
 }
 
+size_t Utf8View::ascii_byte_count_from(size_t byte_offset) const
+{
+    VERIFY(byte_offset <= m_string.length());
+
+    auto const* bytes = begin_ptr();
+    size_t offset = byte_offset;
+
+    // OPTIMIZATION: Check a whole word at a time, as any non-ASCII byte has its high bit set.
+    static constexpr u64 high_bits = 0x8080808080808080;
+    for (; offset + sizeof(u64) <= m_string.length(); offset += sizeof(u64)) {
+        u64 word;
+        __builtin_memcpy(&word, bytes + offset, sizeof(word));
+        if (word & high_bits)
+            break;
+    }
+
+    while (offset < m_string.length() && bytes[offset] <= 0x7F)
+        ++offset;
+
+    return offset - byte_offset;
+}
+
 size_t Utf8View::calculate_length() const
 {
     size_t length = 0;
 
     for (size_t i = 0; i < m_string.length(); ++length) {
+        if (auto ascii_bytes = ascii_byte_count_from(i); ascii_bytes > 0) {
+            i += ascii_bytes;
+            length += ascii_bytes - 1;
+            continue;
+        }
+
         auto [byte_length, code_point, is_valid] = decode_leading_byte(static_cast<u8>(m_string[i]));
 
         // Similar to Utf8CodePointIterator::operator++, if the byte is invalid, try the next byte.
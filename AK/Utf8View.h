@@ -100,6 +100,9 @@ public:
     Utf8View unicode_substring_view(size_t code_point_offset, size_t code_point_length) const;
     Utf8View unicode_substring_view(size_t code_point_offset) const { return unicode_substring_view(code_point_offset, length() - code_point_offset); }
 
+    // Returns the number of consecutive ASCII bytes starting at the given byte offset.
+    size_t ascii_byte_count_from(size_t byte_offset) const;
+
     bool is_empty() const { return m_string.is_empty(); }
     bool is_null() const { return m_string.is_null(); }
     bool starts_with(Utf8View const&) const;
@@ -131,16 +134,22 @@ public:
     {
         valid_bytes = 0;
 
-        for (auto it = m_string.begin(); it != m_string.end(); ++it) {
-            auto [byte_length, code_point, is_valid] = decode_leading_byte(static_cast<u8>(*it));
+        while (valid_bytes < m_string.length()) {
+            // OPTIMIZATION: ASCII bytes are always valid, so skip over runs of them without decoding each one.
+            if (!is_constant_evaluated()) {
+                valid_bytes += ascii_byte_count_from(valid_bytes);
+                if (valid_bytes == m_string.length())
+                    break;
+            }
+
+            auto [byte_length, code_point, is_valid] = decode_leading_byte(static_cast<u8>(m_string[valid_bytes]));
             if (!is_valid)
                 return false;
+            if (byte_length > m_string.length() - valid_bytes)
+                return false;
 
             for (size_t i = 1; i < byte_length; ++i) {
-                if (++it == m_string.end())
-                    return false;
-
-                auto [code_point_bits, is_valid] = decode_continuation_byte(static_cast<u8>(*it));
+                auto [code_point_bits, is_valid] = decode_continuation_byte(static_cast<u8>(m_string[valid_bytes + i]));
                 if (!is_valid)
                     return false;
 
@@ -89,7 +89,7 @@ ErrorOr<IPC::File> ApplicationBridge::launch_web_worker()
     auto web_worker_paths = TRY(get_paths_for_helper_process("WebWorker"sv));
     auto worker_client = TRY(launch_web_worker_process(web_worker_paths, *m_impl->request_server_client));
 
-    return worker_client->dup_socket();
+    return connect_new_web_worker_client(move(worker_client));
 }
 
 }
@@ -129,6 +129,7 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
 
     auto database = TRY(WebView::Database::create());
     auto cookie_jar = TRY(WebView::CookieJar::create(*database));
+    web_view_app.set_storage_jar(TRY(WebView::StorageJar::create(*database)));
 
     // FIXME: Create an abstraction to re-spawn the RequestServer and re-hook up its client hooks to each tab on crash
     TRY([application launchRequestServer:certificates]);
@@ -7,6 +7,7 @@
 #include "HelperProcess.h"
 #include "Utilities.h"
 #include <AK/Enumerate.h>
+#include <LibCore/EventLoop.h>
 #include <LibCore/Process.h>
 #include <LibWebView/Application.h>
 
@@ -66,12 +67,10 @@ static ErrorOr<NonnullRefPtr<ClientType>> launch_server_process(
     VERIFY_NOT_REACHED();
 }
 
-ErrorOr<NonnullRefPtr<WebView::WebContentClient>> launch_web_content_process(
-    WebView::ViewImplementation& view,
-    ReadonlySpan<ByteString> candidate_web_content_paths,
+static Vector<ByteString> web_content_process_arguments(
     Ladybird::WebContentOptions const& web_content_options,
-    IPC::File image_decoder_socket,
-    Optional<IPC::File> request_server_socket)
+    IPC::File const& image_decoder_socket,
+    Optional<IPC::File> const& request_server_socket)
 {
     Vector<ByteString> arguments {
         "--command-line"sv,
@@ -94,10 +93,16 @@ ErrorOr<NonnullRefPtr<WebView::WebContentClient>> launch_web_content_process(
         arguments.append("--log-all-js-exceptions"sv);
     if (web_content_options.enable_idl_tracing == Ladybird::EnableIDLTracing::Yes)
         arguments.append("--enable-idl-tracing"sv);
+    if (web_content_options.save_console_profiles == Ladybird::SaveConsoleProfiles::Yes)
+        arguments.append("--save-console-profiles"sv);
     if (web_content_options.enable_http_cache == Ladybird::EnableHTTPCache::Yes)
         arguments.append("--enable-http-cache"sv);
     if (web_content_options.expose_internals_object == Ladybird::ExposeInternalsObject::Yes)
         arguments.append("--expose-internals-object"sv);
+    if (web_content_options.gc_allocation_sample_interval > 0) {
+        arguments.append("--gc-allocation-sample-interval"sv);
+        arguments.append(ByteString::number(web_content_options.gc_allocation_sample_interval));
+    }
     if (auto server = mach_server_name(); server.has_value()) {
         arguments.append("--mach-server-name"sv);
         arguments.append(server.value());
@@ -110,9 +115,54 @@ ErrorOr<NonnullRefPtr<WebView::WebContentClient>> launch_web_content_process(
     arguments.append("--image-decoder-socket"sv);
     arguments.append(ByteString::number(image_decoder_socket.fd()));
 
+    return arguments;
+}
+
+ErrorOr<NonnullRefPtr<WebView::WebContentClient>> launch_web_content_process(
+    WebView::ViewImplementation& view,
+    ReadonlySpan<ByteString> candidate_web_content_paths,
+    Ladybird::WebContentOptions const& web_content_options,
+    IPC::File image_decoder_socket,
+    Optional<IPC::File> request_server_socket)
+{
+    auto arguments = web_content_process_arguments(web_content_options, image_decoder_socket, request_server_socket);
     return launch_server_process<WebView::WebContentClient>("WebContent"sv, candidate_web_content_paths, move(arguments), web_content_options.enable_callgrind_profiling, view);
 }
 
+ErrorOr<NonnullRefPtr<WebView::WebContentClient>> launch_spare_web_content_process(
+    ReadonlySpan<ByteString> candidate_web_content_paths,
+    Ladybird::WebContentOptions const& web_content_options,
+    IPC::File image_decoder_socket,
+    Optional<IPC::File> request_server_socket)
+{
+    auto arguments = web_content_process_arguments(web_content_options, image_decoder_socket, request_server_socket);
+    return launch_server_process<WebView::WebContentClient>("WebContent"sv, candidate_web_content_paths, move(arguments), web_content_options.enable_callgrind_profiling);
+}
+
+WebContentProcessPool& WebContentProcessPool::the()
+{
+    static WebContentProcessPool s_the;
+    return s_the;
+}
+
+void WebContentProcessPool::initialize(size_t size, Ladybird::WebContentOptions const& web_content_options, Launcher launcher)
+{
+    // A process that waits for a debugger or runs under callgrind should only be started for a tab that wants it.
+    if (web_content_options.wait_for_debugger == Ladybird::WaitForDebugger::Yes || web_content_options.enable_callgrind_profiling == Ladybird::EnableCallgrindProfiling::Yes)
+        size = 0;
+
+    m_web_content_options = web_content_options;
+    SpareProcessPool::initialize(size, move(launcher));
+}
+
+RefPtr<WebView::WebContentClient> WebContentProcessPool::take_process(Ladybird::WebContentOptions const& web_content_options)
+{
+    if (web_content_options != m_web_content_options)
+        return nullptr;
+
+    return take_spare_process();
+}
+
 ErrorOr<NonnullRefPtr<ImageDecoderClient::Client>> launch_image_decoder_process(ReadonlySpan<ByteString> candidate_image_decoder_paths)
 {
     Vector<ByteString> arguments;
@@ -136,6 +186,21 @@ ErrorOr<NonnullRefPtr<Web::HTML::WebWorkerClient>> launch_web_worker_process(Rea
     return launch_server_process<Web::HTML::WebWorkerClient>("WebWorker"sv, candidate_web_worker_paths, move(arguments), Ladybird::EnableCallgrindProfiling::No);
 }
 
+WebWorkerProcessPool& WebWorkerProcessPool::the()
+{
+    static WebWorkerProcessPool s_the;
+    return s_the;
+}
+
+ErrorOr<NonnullRefPtr<Web::HTML::WebWorkerClient>> WebWorkerProcessPool::take_process()
+{
+    VERIFY(launcher());
+
+    if (auto process = take_spare_process())
+        return process.release_nonnull();
+    return launcher()();
+}
+
 ErrorOr<NonnullRefPtr<Protocol::RequestClient>> launch_request_server_process(ReadonlySpan<ByteString> candidate_request_server_paths, StringView serenity_resource_root, Vector<ByteString> const& certificates)
 {
     Vector<ByteString> arguments;
@@ -168,6 +233,29 @@ ErrorOr<IPC::File> connect_new_request_server_client(Protocol::RequestClient& cl
     return socket;
 }
 
+ErrorOr<IPC::File> connect_new_web_worker_client(NonnullRefPtr<Web::HTML::WebWorkerClient> client)
+{
+    static HashMap<Web::HTML::WebWorkerClient*, NonnullRefPtr<Web::HTML::WebWorkerClient>> s_clients_of_running_workers;
+
+    auto new_socket = client->send_sync_but_allow_failure<Messages::WebWorkerServer::ConnectNewClient>();
+    if (!new_socket)
+        return Error::from_string_literal("Failed to connect to WebWorker");
+
+    auto socket = new_socket->take_socket();
+    if (socket.fd() < 0)
+        return Error::from_string_literal("Failed to connect to WebWorker");
+
+    client->on_death = [client = client.ptr()] {
+        // The client must outlive the handling of its own death.
+        Core::deferred_invoke([client] {
+            s_clients_of_running_workers.remove(client);
+        });
+    };
+    s_clients_of_running_workers.set(client.ptr(), client);
+
+    return socket;
+}
+
 ErrorOr<IPC::File> connect_new_image_decoder_client(ImageDecoderClient::Client& client)
 {
     auto new_socket = client.send_sync_but_allow_failure<Messages::ImageDecoderServer::ConnectNewClients>(1);
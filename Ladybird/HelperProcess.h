@@ -8,9 +8,12 @@
 
 #include "Types.h"
 #include <AK/Error.h>
+#include <AK/Function.h>
 #include <AK/Optional.h>
 #include <AK/Span.h>
 #include <AK/StringView.h>
+#include <AK/Vector.h>
+#include <LibCore/EventLoop.h>
 #include <LibImageDecoderClient/Client.h>
 #include <LibProtocol/RequestClient.h>
 #include <LibWeb/Worker/WebWorkerClient.h>
@@ -24,9 +27,134 @@ ErrorOr<NonnullRefPtr<WebView::WebContentClient>> launch_web_content_process(
     IPC::File image_decoder_socket,
     Optional<IPC::File> request_server_socket = {});
 
+// Launches a WebContent process that isn't attached to a view yet, see WebContentProcessPool.
+ErrorOr<NonnullRefPtr<WebView::WebContentClient>> launch_spare_web_content_process(
+    ReadonlySpan<ByteString> candidate_web_content_paths,
+    Ladybird::WebContentOptions const&,
+    IPC::File image_decoder_socket,
+    Optional<IPC::File> request_server_socket = {});
+
 ErrorOr<NonnullRefPtr<ImageDecoderClient::Client>> launch_image_decoder_process(ReadonlySpan<ByteString> candidate_image_decoder_paths);
 ErrorOr<NonnullRefPtr<Web::HTML::WebWorkerClient>> launch_web_worker_process(ReadonlySpan<ByteString> candidate_web_worker_paths, NonnullRefPtr<Protocol::RequestClient>);
 ErrorOr<NonnullRefPtr<Protocol::RequestClient>> launch_request_server_process(ReadonlySpan<ByteString> candidate_request_server_paths, StringView serenity_resource_root, Vector<ByteString> const& certificates);
 
 ErrorOr<IPC::File> connect_new_request_server_client(Protocol::RequestClient&);
 ErrorOr<IPC::File> connect_new_image_decoder_client(ImageDecoderClient::Client&);
+
+// Connects a new client to a WebWorker process, for the WebContent process that runs the worker. The worker process
+// exits once that client disconnects, and the connection of the chrome is kept alive until then.
+ErrorOr<IPC::File> connect_new_web_worker_client(NonnullRefPtr<Web::HTML::WebWorkerClient>);
+
+// Keeps processes launched ahead of time, so that whoever needs one can take a process that has already finished
+// starting up instead of waiting for a new process to do so.
+template<typename Client>
+class SpareProcessPool {
+public:
+    using Launcher = Function<ErrorOr<NonnullRefPtr<Client>>()>;
+
+protected:
+    explicit SpareProcessPool(StringView process_name)
+        : m_process_name(process_name)
+    {
+    }
+
+    // Keeps `size` spare processes launched around. A size of 0 disables the pool.
+    void initialize(size_t size, Launcher launcher)
+    {
+        m_size = size;
+        m_launcher = move(launcher);
+        m_processes.clear();
+
+        schedule_refill();
+    }
+
+    // Returns a spare process, if there is one, and launches its replacement once the event loop is idle.
+    RefPtr<Client> take_spare_process()
+    {
+        RefPtr<Client> process;
+        while (!m_processes.is_empty()) {
+            auto candidate = m_processes.take_first();
+
+            // A spare process may have crashed while it was waiting to be used.
+            if (candidate->is_open()) {
+                process = move(candidate);
+                break;
+            }
+        }
+
+        schedule_refill();
+        return process;
+    }
+
+    Launcher const& launcher() const { return m_launcher; }
+
+private:
+    void schedule_refill()
+    {
+        if (m_refill_scheduled || m_processes.size() >= m_size)
+            return;
+
+        // Launching a process takes a while, so don't do it while the caller is busy setting up a tab, or starting
+        // several workers in a row.
+        m_refill_scheduled = true;
+        Core::deferred_invoke([this] {
+            m_refill_scheduled = false;
+            refill();
+        });
+    }
+
+    void refill()
+    {
+        while (m_processes.size() < m_size) {
+            auto process = m_launcher();
+            if (process.is_error()) {
+                dbgln("Failed to launch a spare {} process: {}", m_process_name, process.error());
+                return;
+            }
+            m_processes.append(process.release_value());
+        }
+    }
+
+    StringView m_process_name;
+    size_t m_size { 0 };
+    Launcher m_launcher;
+    Vector<NonnullRefPtr<Client>> m_processes;
+    bool m_refill_scheduled { false };
+};
+
+class WebContentProcessPool : public SpareProcessPool<WebView::WebContentClient> {
+public:
+    static WebContentProcessPool& the();
+
+    // Keeps `size` spare processes launched with the given options around. A size of 0 disables the pool.
+    void initialize(size_t size, Ladybird::WebContentOptions const&, Launcher);
+
+    // Returns a spare process that was launched with the given options, if there is one, and launches its replacement
+    // once the event loop is idle.
+    RefPtr<WebView::WebContentClient> take_process(Ladybird::WebContentOptions const&);
+
+private:
+    WebContentProcessPool()
+        : SpareProcessPool("WebContent"sv)
+    {
+    }
+
+    Ladybird::WebContentOptions m_web_content_options;
+};
+
+class WebWorkerProcessPool : public SpareProcessPool<Web::HTML::WebWorkerClient> {
+public:
+    static WebWorkerProcessPool& the();
+
+    using SpareProcessPool::initialize;
+
+    // Returns a spare process, or launches a new one if there isn't any, and launches a replacement for it once the
+    // event loop is idle.
+    ErrorOr<NonnullRefPtr<Web::HTML::WebWorkerClient>> take_process();
+
+private:
+    WebWorkerProcessPool()
+        : SpareProcessPool("WebWorker"sv)
+    {
+    }
+};
@@ -22,6 +22,7 @@
 #include <LibWeb/CSS/PreferredContrast.h>
 #include <LibWeb/CSS/PreferredMotion.h>
 #include <LibWeb/Loader/UserAgent.h>
+#include <LibWebView/Application.h>
 #include <LibWebView/CookieJar.h>
 #include <LibWebView/UserAgent.h>
 #include <QAction>
@@ -441,6 +442,42 @@ BrowserWindow::BrowserWindow(Vector<URL::URL> const& initial_urls, WebView::Cook
         }
     });
 
+    auto* record_js_profile_action = new QAction("Record JS Profile", this);
+    record_js_profile_action->setCheckable(true);
+    debug_menu->addAction(record_js_profile_action);
+    QObject::connect(record_js_profile_action, &QAction::triggered, this, [this](bool checked) {
+        if (!m_current_tab)
+            return;
+        if (checked) {
+            m_current_tab->view().start_js_profile();
+            return;
+        }
+        if (auto profile_path = m_current_tab->view().stop_js_profile(); profile_path.is_error()) {
+            warnln("\033[31;1mUnable to save JS profile: {}\033[0m", profile_path.error());
+        } else {
+            warnln("\033[33;1mSaved JS profile into {}"
+                   "\033[0m",
+                profile_path.value());
+        }
+    });
+
+    auto* record_trace_action = new QAction("Record &Trace", this);
+    record_trace_action->setCheckable(true);
+    debug_menu->addAction(record_trace_action);
+    QObject::connect(record_trace_action, &QAction::triggered, this, [](bool checked) {
+        if (checked) {
+            WebView::Application::the().start_tracing();
+            return;
+        }
+        if (auto trace_path = WebView::Application::the().stop_tracing(); trace_path.is_error()) {
+            warnln("\033[31;1mUnable to save trace: {}\033[0m", trace_path.error());
+        } else {
+            warnln("\033[33;1mSaved trace into {}"
+                   "\033[0m",
+                trace_path.value());
+        }
+    });
+
     auto* clear_cache_action = new QAction("Clear &Cache", this);
     clear_cache_action->setShortcut(QKeySequence(Qt::CTRL | Qt::SHIFT | Qt::Key_C));
     clear_cache_action->setIcon(load_icon_from_uri("resource://icons/browser/clear-cache.png"sv));
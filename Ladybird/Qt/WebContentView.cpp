@@ -108,9 +108,8 @@ WebContentView::WebContentView(QWidget* window, WebContentOptions const& web_con
     };
 
     on_request_worker_agent = []() {
-        auto& request_server_client = static_cast<Ladybird::Application*>(QApplication::instance())->request_server_client;
-        auto worker_client = MUST(launch_web_worker_process(MUST(get_paths_for_helper_process("WebWorker"sv)), *request_server_client));
-        return worker_client->dup_socket();
+        auto worker_client = MUST(WebWorkerProcessPool::the().take_process());
+        return MUST(connect_new_web_worker_client(move(worker_client)));
     };
 }
 
@@ -448,6 +447,15 @@ void WebContentView::set_device_pixel_ratio(double device_pixel_ratio)
     client().async_set_device_pixels_per_css_pixel(m_client_state.page_index, m_device_pixel_ratio * m_zoom_level);
     update_viewport_size();
     handle_resize();
+
+    // NOTE: The device pixel ratio is updated when the window moves to another screen, which may also refresh at a different rate.
+    update_display_refresh_rate();
+}
+
+void WebContentView::update_display_refresh_rate()
+{
+    if (auto* current_screen = screen())
+        set_display_refresh_rate(current_screen->refreshRate());
 }
 
 void WebContentView::update_viewport_size()
@@ -468,13 +476,13 @@ void WebContentView::update_zoom()
 void WebContentView::showEvent(QShowEvent* event)
 {
     QAbstractScrollArea::showEvent(event);
-    client().async_set_system_visibility_state(m_client_state.page_index, true);
+    set_system_visibility_state(true);
 }
 
 void WebContentView::hideEvent(QHideEvent* event)
 {
     QAbstractScrollArea::hideEvent(event);
-    client().async_set_system_visibility_state(m_client_state.page_index, false);
+    set_system_visibility_state(false);
 }
 
 static Core::AnonymousBuffer make_system_theme_from_qt_palette(QWidget& widget, WebContentView::PaletteMode mode)
@@ -540,22 +548,27 @@ void WebContentView::initialize_client(WebView::ViewImplementation::CreateNewCli
     if (create_new_client == CreateNewClient::Yes) {
         m_client_state = {};
 
-        Optional<IPC::File> request_server_socket;
-        if (m_web_content_options.use_lagom_networking == UseLagomNetworking::Yes) {
-            auto& protocol = static_cast<Ladybird::Application*>(QApplication::instance())->request_server_client;
+        if (auto spare_client = WebContentProcessPool::the().take_process(m_web_content_options)) {
+            spare_client->assign_initial_view(*this);
+            m_client_state.client = spare_client.release_nonnull();
+        } else {
+            Optional<IPC::File> request_server_socket;
+            if (m_web_content_options.use_lagom_networking == UseLagomNetworking::Yes) {
+                auto& protocol = static_cast<Ladybird::Application*>(QApplication::instance())->request_server_client;
 
-            // FIXME: Fail to open the tab, rather than crashing the whole application if this fails
-            auto socket = connect_new_request_server_client(*protocol).release_value_but_fixme_should_propagate_errors();
-            request_server_socket = AK::move(socket);
-        }
+                // FIXME: Fail to open the tab, rather than crashing the whole application if this fails
+                auto socket = connect_new_request_server_client(*protocol).release_value_but_fixme_should_propagate_errors();
+                request_server_socket = AK::move(socket);
+            }
 
-        auto image_decoder = static_cast<Ladybird::Application*>(QApplication::instance())->image_decoder_client();
-        auto image_decoder_socket = connect_new_image_decoder_client(*image_decoder).release_value_but_fixme_should_propagate_errors();
+            auto image_decoder = static_cast<Ladybird::Application*>(QApplication::instance())->image_decoder_client();
+            auto image_decoder_socket = connect_new_image_decoder_client(*image_decoder).release_value_but_fixme_should_propagate_errors();
 
-        auto candidate_web_content_paths = get_paths_for_helper_process("WebContent"sv).release_value_but_fixme_should_propagate_errors();
-        auto new_client = launch_web_content_process(*this, candidate_web_content_paths, m_web_content_options, AK::move(image_decoder_socket), AK::move(request_server_socket)).release_value_but_fixme_should_propagate_errors();
+            auto candidate_web_content_paths = get_paths_for_helper_process("WebContent"sv).release_value_but_fixme_should_propagate_errors();
+            auto new_client = launch_web_content_process(*this, candidate_web_content_paths, m_web_content_options, AK::move(image_decoder_socket), AK::move(request_server_socket)).release_value_but_fixme_should_propagate_errors();
 
-        m_client_state.client = new_client;
+            m_client_state.client = new_client;
+        }
     } else {
         m_client_state.client->register_view(m_client_state.page_index, *this);
     }
@@ -573,6 +586,7 @@ void WebContentView::initialize_client(WebView::ViewImplementation::CreateNewCli
     update_palette();
 
     update_screen_rects();
+    update_display_refresh_rate();
 
     if (!m_webdriver_content_ipc_path.is_empty())
         client().async_connect_to_webdriver(m_client_state.page_index, m_webdriver_content_ipc_path);
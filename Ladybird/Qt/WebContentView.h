@@ -102,6 +102,7 @@ private:
     void enqueue_native_event(Web::KeyEvent::Type, QKeyEvent const& event);
     void finish_handling_key_event(Web::KeyEvent const&);
     void update_screen_rects();
+    void update_display_refresh_rate();
 
     bool m_should_show_line_box_borders { false };
 
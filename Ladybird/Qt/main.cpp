@@ -96,10 +96,14 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     bool debug_web_content = false;
     bool log_all_js_exceptions = false;
     bool enable_idl_tracing = false;
+    bool save_console_profiles = false;
     bool enable_http_cache = false;
+    size_t gc_allocation_sample_interval = 0;
     bool new_window = false;
     bool force_new_process = false;
     bool allow_popups = false;
+    size_t web_content_process_pool_size = 1;
+    size_t web_worker_process_pool_size = 1;
 
     Core::ArgsParser args_parser;
     args_parser.set_general_help("The Ladybird web browser :^)");
@@ -114,11 +118,15 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     args_parser.add_option(certificates, "Path to a certificate file", "certificate", 'C', "certificate");
     args_parser.add_option(log_all_js_exceptions, "Log all JavaScript exceptions", "log-all-js-exceptions");
     args_parser.add_option(enable_idl_tracing, "Enable IDL tracing", "enable-idl-tracing");
+    args_parser.add_option(save_console_profiles, "Save profiles recorded with console.profile() to disk", "save-console-profiles");
     args_parser.add_option(enable_http_cache, "Enable HTTP cache", "enable-http-cache");
+    args_parser.add_option(gc_allocation_sample_interval, "Record the allocation site of every Nth GC allocation in WebContent, to be included when dumping the GC graph", "gc-allocation-sample-interval", 0, "n");
     args_parser.add_option(expose_internals_object, "Expose internals object", "expose-internals-object");
     args_parser.add_option(new_window, "Force opening in a new window", "new-window", 'n');
     args_parser.add_option(force_new_process, "Force creation of new browser/chrome process", "force-new-process");
     args_parser.add_option(allow_popups, "Disable popup blocking by default", "allow-popups");
+    args_parser.add_option(web_content_process_pool_size, "Number of WebContent processes to keep launched for new tabs", "web-content-process-pool-size", 0, "count");
+    args_parser.add_option(web_worker_process_pool_size, "Number of WebWorker processes to keep launched for new workers", "web-worker-process-pool-size", 0, "count");
     args_parser.parse(arguments);
 
     WebView::ChromeProcess chrome_process;
@@ -160,6 +168,8 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
         database = TRY(WebView::Database::create());
 
     auto cookie_jar = database ? TRY(WebView::CookieJar::create(*database)) : WebView::CookieJar::create();
+    if (database)
+        webview_app.set_storage_jar(TRY(WebView::StorageJar::create(*database)));
 
     // NOTE: WebWorker *always* needs a request server connection, even if WebContent uses Qt Networking
     // FIXME: Create an abstraction to re-spawn the RequestServer and re-hook up its client hooks to each tab on crash
@@ -181,10 +191,28 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
         .wait_for_debugger = debug_web_content ? Ladybird::WaitForDebugger::Yes : Ladybird::WaitForDebugger::No,
         .log_all_js_exceptions = log_all_js_exceptions ? Ladybird::LogAllJSExceptions::Yes : Ladybird::LogAllJSExceptions::No,
         .enable_idl_tracing = enable_idl_tracing ? Ladybird::EnableIDLTracing::Yes : Ladybird::EnableIDLTracing::No,
+        .save_console_profiles = save_console_profiles ? Ladybird::SaveConsoleProfiles::Yes : Ladybird::SaveConsoleProfiles::No,
         .enable_http_cache = enable_http_cache ? Ladybird::EnableHTTPCache::Yes : Ladybird::EnableHTTPCache::No,
         .expose_internals_object = expose_internals_object ? Ladybird::ExposeInternalsObject::Yes : Ladybird::ExposeInternalsObject::No,
+        .gc_allocation_sample_interval = gc_allocation_sample_interval,
     };
 
+    WebContentProcessPool::the().initialize(web_content_process_pool_size, web_content_options, [&app, web_content_options]() -> ErrorOr<NonnullRefPtr<WebView::WebContentClient>> {
+        Optional<IPC::File> request_server_socket;
+        if (web_content_options.use_lagom_networking == Ladybird::UseLagomNetworking::Yes)
+            request_server_socket = TRY(connect_new_request_server_client(*app.request_server_client));
+
+        auto image_decoder_socket = TRY(connect_new_image_decoder_client(*app.image_decoder_client()));
+
+        auto candidate_web_content_paths = TRY(get_paths_for_helper_process("WebContent"sv));
+        return launch_spare_web_content_process(candidate_web_content_paths, web_content_options, move(image_decoder_socket), move(request_server_socket));
+    });
+
+    WebWorkerProcessPool::the().initialize(web_worker_process_pool_size, [&app]() -> ErrorOr<NonnullRefPtr<Web::HTML::WebWorkerClient>> {
+        auto candidate_web_worker_paths = TRY(get_paths_for_helper_process("WebWorker"sv));
+        return launch_web_worker_process(candidate_web_worker_paths, *app.request_server_client);
+    });
+
     chrome_process.on_new_window = [&](auto const& urls) {
         app.new_window(sanitize_urls(urls), *cookie_jar, web_content_options, webdriver_content_ipc_path, allow_popups);
     };
@@ -50,6 +50,11 @@ enum class EnableIDLTracing {
     Yes
 };
 
+enum class SaveConsoleProfiles {
+    No,
+    Yes
+};
+
 enum class EnableHTTPCache {
     No,
     Yes
@@ -71,8 +76,12 @@ struct WebContentOptions {
     WaitForDebugger wait_for_debugger { WaitForDebugger::No };
     LogAllJSExceptions log_all_js_exceptions { LogAllJSExceptions::No };
     EnableIDLTracing enable_idl_tracing { EnableIDLTracing::No };
+    SaveConsoleProfiles save_console_profiles { SaveConsoleProfiles::No };
     EnableHTTPCache enable_http_cache { EnableHTTPCache::No };
     ExposeInternalsObject expose_internals_object { ExposeInternalsObject::No };
+    size_t gc_allocation_sample_interval { 0 };
+
+    bool operator==(WebContentOptions const&) const = default;
 };
 
 }
@@ -30,6 +30,7 @@
 #include <LibWebView/RequestServerAdapter.h>
 #include <WebContent/ConnectionFromClient.h>
 #include <WebContent/PageClient.h>
+#include <WebContent/WebContentConsoleClient.h>
 #include <WebContent/WebDriverConnection.h>
 
 #if defined(HAVE_QT)
@@ -104,7 +105,9 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     bool wait_for_debugger = false;
     bool log_all_js_exceptions = false;
     bool enable_idl_tracing = false;
+    bool save_console_profiles = false;
     bool enable_http_cache = false;
+    size_t gc_allocation_sample_interval = 0;
 
     Core::ArgsParser args_parser;
     args_parser.add_option(command_line, "Chrome process command line", "command-line", 0, "command_line");
@@ -120,7 +123,9 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     args_parser.add_option(mach_server_name, "Mach server name", "mach-server-name", 0, "mach_server_name");
     args_parser.add_option(log_all_js_exceptions, "Log all JavaScript exceptions", "log-all-js-exceptions");
     args_parser.add_option(enable_idl_tracing, "Enable IDL tracing", "enable-idl-tracing");
+    args_parser.add_option(save_console_profiles, "Send profiles recorded with console.profile() to the chrome process to be saved", "save-console-profiles");
     args_parser.add_option(enable_http_cache, "Enable HTTP cache", "enable-http-cache");
+    args_parser.add_option(gc_allocation_sample_interval, "Record the allocation site of every Nth GC allocation", "gc-allocation-sample-interval", 0, "n");
 
     args_parser.parse(arguments);
 
@@ -146,6 +151,10 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
         Web::Fetch::Fetching::g_http_cache_enabled = true;
     }
 
+    if (save_console_profiles) {
+        WebContent::WebContentConsoleClient::set_save_profiles();
+    }
+
 #if defined(AK_OS_MACOS)
     if (!mach_server_name.is_empty()) {
         auto server_port = Core::Platform::register_with_mach_server(mach_server_name);
@@ -176,6 +185,10 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
         Web::WebIDL::g_enable_idl_tracing = true;
     }
 
+    if (gc_allocation_sample_interval > 0) {
+        Web::Bindings::main_thread_vm().heap().set_allocation_sample_interval(gc_allocation_sample_interval);
+    }
+
     auto maybe_content_filter_error = load_content_filters();
     if (maybe_content_filter_error.is_error())
         dbgln("Failed to load content filters: {}", maybe_content_filter_error.error());
@@ -440,8 +440,11 @@ static void generate_to_integral(SourceGenerator& scoped_generator, ParameterTyp
     @cpp_name@ = @js_name@@js_suffix@.to_boolean();
 )~~~");
     } else {
+        // OPTIMIZATION: An Int32 that fits the integer type converts to itself, regardless of [EnforceRange] and [Clamp].
         scoped_generator.append(R"~~~(
-    @cpp_name@ = TRY(WebIDL::convert_to_int<@cpp_type@>(vm, @js_name@@js_suffix@, WebIDL::EnforceRange::@enforce_range@, WebIDL::Clamp::@clamp@));
+    @cpp_name@ = @js_name@@js_suffix@.is_int32() && AK::is_within_range<@cpp_type@>(@js_name@@js_suffix@.as_i32())
+        ? static_cast<@cpp_type@>(@js_name@@js_suffix@.as_i32())
+        : TRY(WebIDL::convert_to_int<@cpp_type@>(vm, @js_name@@js_suffix@, WebIDL::EnforceRange::@enforce_range@, WebIDL::Clamp::@clamp@));
 )~~~");
     }
 
@@ -570,10 +573,11 @@ static void generate_to_cpp(SourceGenerator& generator, ParameterType& parameter
             scoped_generator.set("parameter.type.name", "double");
         }
 
+        // OPTIMIZATION: Numbers are taken as they are, without going through ToNumber.
         bool is_wrapped_in_optional_type = false;
         if (!optional) {
             scoped_generator.append(R"~~~(
-    @parameter.type.name@ @cpp_name@ = TRY(@js_name@@js_suffix@.to_double(vm));
+    @parameter.type.name@ @cpp_name@ = @js_name@@js_suffix@.is_number() ? @js_name@@js_suffix@.as_double() : TRY(@js_name@@js_suffix@.to_double(vm));
 )~~~");
         } else {
             if (optional_default_value.has_value() && optional_default_value != "null"sv) {
@@ -588,7 +592,7 @@ static void generate_to_cpp(SourceGenerator& generator, ParameterType& parameter
             }
             scoped_generator.append(R"~~~(
     if (!@js_name@@js_suffix@.is_undefined())
-        @cpp_name@ = TRY(@js_name@@js_suffix@.to_double(vm));
+        @cpp_name@ = @js_name@@js_suffix@.is_number() ? @js_name@@js_suffix@.as_double() : TRY(@js_name@@js_suffix@.to_double(vm));
 )~~~");
             if (optional_default_value.has_value() && optional_default_value.value() != "null"sv) {
                 scoped_generator.append(R"~~~(
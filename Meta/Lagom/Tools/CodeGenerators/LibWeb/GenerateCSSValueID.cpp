@@ -64,9 +64,13 @@ enum class ValueID {
 )~~~");
     });
 
+    generator.set("last_value_id", title_casify(identifier_data.at(identifier_data.size() - 1).as_string()));
+
     generator.append(R"~~~(
 };
 
+constexpr ValueID last_value_id = ValueID::@last_value_id@;
+
 Optional<ValueID> value_id_from_string(StringView);
 StringView string_from_value_id(ValueID);
 
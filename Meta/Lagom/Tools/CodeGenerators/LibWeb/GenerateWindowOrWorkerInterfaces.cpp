@@ -257,12 +257,17 @@ static ErrorOr<void> generate_exposed_interface_implementation(StringView class_
         }
     }
 
+    generator.set("exposed_interface_count", ByteString::number(exposed_interfaces.size()));
     generator.append(R"~~~(
 namespace Web::Bindings {
 
 void add_@global_object_snake_name@_exposed_interfaces(JS::Object& global)
 {
     static constexpr u8 attr = JS::Attribute::Writable | JS::Attribute::Configurable;
+
+    // The interface objects are only created when they are first accessed, but there are hundreds of accessors to
+    // define on every new global object, so make room for them all at once.
+    global.ensure_intrinsic_accessor_capacity(@exposed_interface_count@);
 )~~~");
 
     auto add_interface = [](SourceGenerator& gen, StringView name, StringView prototype_class, Optional<LegacyConstructor> const& legacy_constructor, Optional<ByteString> const& legacy_alias_name) {
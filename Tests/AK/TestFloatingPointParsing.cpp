@@ -6,6 +6,7 @@
 
 #include <LibTest/TestCase.h>
 
+#include <AK/Array.h>
 #include <AK/FloatingPointStringConversions.h>
 
 static double parse_complete_double(StringView view)
@@ -607,3 +608,19 @@ BENCHMARK_CASE(inadequate_float)
 {
     BENCHMARK_DOUBLE_PARSING(7.4109846876186981626485318930233205854758970392148714663837852375101326090531312779794975454245398856969484704316857659638998506553390969459816219401617281718945106978546710679176872575177347315553307795408549809608457500958111373034747658096871009590975442271004757307809711118935784838675653998783503015228055934046593739791790738723868299395818481660169122019456499931289798411362062484498678713572180352209017023903285791732520220528974020802906854021606612375549983402671300035812486479041385743401875520901590172592547146296175134159774938718574737870961645638908718119841271673056017045493004705269590165763776884908267986972573366521765567941072508764337560846003984904972149117463085539556354188641513168478436313080237596295773983001708984375001e-324, 4);
 }
+
+BENCHMARK_CASE(mixed_numbers)
+{
+    // A mix of the kind of numbers found in JSON and CSS.
+    constexpr Array numbers { "0"sv, "1"sv, "42"sv, "-7"sv, "100"sv, "0.5"sv, "1.25"sv, "-0.75"sv, "3.14159"sv, "12.5"sv,
+        "1920"sv, "1080"sv, "0.001"sv, "123456.789"sv, "1e3"sv, "2.5e-3"sv, "-1.5e10"sv, "5e-324"sv };
+
+    double sum = 0;
+    for (int i = 0; i < 200'000; ++i) {
+        for (auto number : numbers) {
+            AK::taint_for_optimizer(number);
+            sum += number.to_number<double>().value();
+        }
+    }
+    EXPECT(sum < 0);
+}
@@ -301,10 +301,27 @@ TEST_CASE(floating_point_default_precision)
     EXPECT_FORMAT(42.f, "42");
     EXPECT_FORMAT(123456.78, "123456.78");
     EXPECT_FORMAT(23456.78910, "23456.7891");
+    EXPECT_FORMAT(-1.0, "-1");
+    EXPECT_FORMAT(1000.0, "1000");
+    EXPECT_FORMAT(16777216.f, "16777216");
+    EXPECT_FORMAT(9007199254740991.0, "9007199254740991");
+    EXPECT_FORMAT(9007199254740992.0, "9007199254740992");
+    EXPECT_FORMAT(1e21, "1e+21");
+    EXPECT_FORMAT(1e22, "1e+22");
 
 #undef EXPECT_FORMAT
 }
 
+BENCHMARK_CASE(floating_point_default_precision)
+{
+    StringBuilder builder;
+    for (int i = 0; i < 1'000'000; ++i) {
+        builder.clear();
+        builder.appendff("{} {}", static_cast<double>(i), i * 0.25);
+    }
+    EXPECT_EQ(builder.string_view(), "999999 249999.75"sv);
+}
+
 TEST_CASE(no_precision_no_trailing_number)
 {
     EXPECT_EQ(ByteString::formatted("{:.0}", 0.1), "0");
@@ -481,3 +481,68 @@ TEST_CASE(values)
     EXPECT_EQ(values[1], 30);
     EXPECT_EQ(values[2], 20);
 }
+
+TEST_CASE(lookup_misses_with_long_probe_runs)
+{
+    // Every value collides, so the table is one long run of buckets sorted by probe length.
+    struct CollidingTraits : public DefaultTraits<int> {
+        static unsigned hash(int value) { return value % 4; }
+    };
+
+    HashTable<int, CollidingTraits> table;
+    for (int i = 0; i < 600; ++i)
+        table.set(i);
+    for (int i = 0; i < 600; i += 3)
+        EXPECT(table.remove(i));
+
+    for (int i = 0; i < 600; ++i)
+        EXPECT_EQ(table.contains(i), i % 3 != 0);
+    for (int i = 600; i < 700; ++i)
+        EXPECT(!table.contains(i));
+}
+
+static constexpr int benchmark_table_size = 100'000;
+
+BENCHMARK_CASE(insert)
+{
+    for (size_t run = 0; run < 10; ++run) {
+        HashTable<int> table;
+        for (int i = 0; i < benchmark_table_size; ++i)
+            table.set(i * 7919);
+        EXPECT_EQ(table.size(), static_cast<size_t>(benchmark_table_size));
+    }
+}
+
+BENCHMARK_CASE(lookup_hits_and_misses)
+{
+    HashTable<ByteString> table;
+    Vector<ByteString> keys;
+    for (int i = 0; i < benchmark_table_size * 2; ++i) {
+        keys.append(ByteString::formatted("key-{}", i));
+        if (i % 2 == 0)
+            table.set(keys.last());
+    }
+
+    size_t hits = 0;
+    for (size_t run = 0; run < 10; ++run) {
+        for (auto const& key : keys) {
+            if (table.contains(key))
+                ++hits;
+        }
+    }
+    EXPECT_EQ(hits, 10u * benchmark_table_size);
+}
+
+BENCHMARK_CASE(iteration)
+{
+    HashTable<int> table;
+    for (int i = 0; i < benchmark_table_size; ++i)
+        table.set(i);
+
+    u64 sum = 0;
+    for (size_t run = 0; run < 100; ++run) {
+        for (auto value : table)
+            sum += value;
+    }
+    EXPECT_EQ(sum, 100ull * benchmark_table_size * (benchmark_table_size - 1) / 2);
+}
@@ -227,6 +227,63 @@ TEST_CASE(string_builder)
     EXPECT_EQ(string.bytes().size(), 8u);
 }
 
+TEST_CASE(string_builder_adopts_buffer)
+{
+    auto build_string = [](StringBuilder& builder, size_t repeat_count) {
+        for (size_t i = 0; i < repeat_count; ++i)
+            builder.appendff("{} bottles of beer; ", i);
+    };
+
+    StringBuilder builder;
+    build_string(builder, 1000);
+    auto expected = builder.to_byte_string();
+    EXPECT(expected.length() > StringBuilder::inline_capacity);
+
+    auto string = MUST(move(builder).to_string());
+    EXPECT_EQ(string, expected.view());
+    EXPECT(builder.is_empty());
+    EXPECT_EQ(builder.length(), 0u);
+
+    // The builder can be reused once its buffer has been adopted.
+    build_string(builder, 1000);
+    EXPECT_EQ(builder.string_view(), expected.view());
+    auto second_string = move(builder).to_string_without_validation();
+    EXPECT_EQ(second_string, string);
+    EXPECT_EQ(string, expected.view());
+
+    // Strings that fit in the builder's inline buffer, and short strings, are copied instead.
+    StringBuilder small_builder;
+    small_builder.append("well"sv);
+    EXPECT_EQ(MUST(move(small_builder).to_string()), "well"sv);
+    EXPECT(small_builder.is_empty());
+
+    small_builder.append("a string that is too long to be a short string"sv);
+    EXPECT_EQ(move(small_builder).to_string_without_validation(), "a string that is too long to be a short string"sv);
+
+    StringBuilder invalid_builder;
+    build_string(invalid_builder, 100);
+    invalid_builder.append("\xff"sv);
+    EXPECT(move(invalid_builder).to_string().is_error());
+}
+
+TEST_CASE(string_builder_moved_from)
+{
+    StringBuilder builder;
+    builder.append_repeated('a', 1000);
+
+    auto other_builder = move(builder);
+    EXPECT(builder.is_empty());
+    EXPECT_EQ(other_builder.length(), 1000u);
+
+    builder.append("reused"sv);
+    EXPECT_EQ(builder.string_view(), "reused"sv);
+
+    other_builder.trim(999);
+    EXPECT_EQ(other_builder.string_view(), "a"sv);
+    other_builder.clear();
+    EXPECT(other_builder.is_empty());
+}
+
 TEST_CASE(ak_format)
 {
     auto foo = MUST(String::formatted("Hello {}", "friends"_string));
@@ -67,6 +67,17 @@ TEST_CASE(encode_utf8)
     }
 }
 
+TEST_CASE(encode_utf8_with_long_ascii_runs)
+{
+    auto utf8_string = "The quick brown fox 😀 jumps over the lazy dog. \xe2 Привет, мир! The quick brown fox"sv;
+    auto string = MUST(AK::utf8_to_utf16(utf8_string));
+
+    Utf16Data expected;
+    for (auto code_point : Utf8View { utf8_string })
+        MUST(AK::code_point_to_utf16(expected, code_point));
+    EXPECT_EQ(string, expected);
+}
+
 TEST_CASE(decode_utf16)
 {
     // Same string as the decode_utf8 test.
@@ -336,3 +347,12 @@ TEST_CASE(starts_with)
     EXPECT(!emoji.starts_with(u"a"));
     EXPECT(!emoji.starts_with(u"🙃"));
 }
+
+BENCHMARK_CASE(encode_ascii)
+{
+    auto string = ByteString::repeated('a', 1 * MiB);
+    for (size_t i = 0; i < 100; ++i) {
+        auto utf16 = MUST(AK::utf8_to_utf16(string));
+        EXPECT_EQ(utf16.size(), string.length());
+    }
+}
@@ -7,6 +7,7 @@
 #include <LibTest/TestCase.h>
 
 #include <AK/ByteBuffer.h>
+#include <AK/StringBuilder.h>
 #include <AK/Utf8View.h>
 
 TEST_CASE(decode_ascii)
@@ -128,6 +129,31 @@ TEST_CASE(validate_overlong_utf8)
     EXPECT(valid_bytes == 2);
 }
 
+TEST_CASE(validate_long_ascii_runs)
+{
+    auto ascii = "The quick brown fox jumps over the lazy dog. "sv;
+
+    StringBuilder builder;
+    for (size_t i = 0; i < 4; ++i)
+        builder.append(ascii);
+    builder.append("\u00e9"sv);
+    builder.append(ascii);
+    auto valid = builder.to_byte_string();
+
+    size_t valid_bytes = 0;
+    EXPECT(Utf8View { valid.view() }.validate(valid_bytes));
+    EXPECT_EQ(valid_bytes, valid.length());
+    EXPECT_EQ(Utf8View { valid.view() }.length(), ascii.length() * 5 + 1);
+
+    builder.append('\xff');
+    builder.append(ascii);
+    auto invalid = builder.to_byte_string();
+
+    EXPECT(!Utf8View { invalid.view() }.validate(valid_bytes));
+    EXPECT_EQ(valid_bytes, valid.length());
+    EXPECT_EQ(Utf8View { invalid.view() }.length(), ascii.length() * 6 + 2);
+}
+
 TEST_CASE(iterate_utf8)
 {
     Utf8View view("Some weird characters \u00A9\u266A\uA755"sv);
@@ -300,3 +326,13 @@ TEST_CASE(trim)
         EXPECT_EQ(view.trim(whitespace, TrimMode::Right).as_string(), "\u180E");
     }
 }
+
+BENCHMARK_CASE(validate_and_count_ascii)
+{
+    auto string = ByteString::repeated('a', 1 * MiB);
+    Utf8View view { string.view() };
+    for (size_t i = 0; i < 500; ++i) {
+        EXPECT(view.validate());
+        EXPECT_EQ(Utf8View { string.view() }.length(), string.length());
+    }
+}
@@ -172,3 +172,9 @@ TEST_CASE(brotli_decompress_zero_one_bin)
     EXPECT(bytes_read == 32 * MiB);
     EXPECT(brotli_stream.is_eof());
 }
+
+BENCHMARK_CASE(brotli_decompress_happy3rd_html_repeatedly)
+{
+    for (size_t i = 0; i < 100; ++i)
+        run_test("happy3rd.html"sv);
+}
@@ -156,6 +156,33 @@ TEST_CASE(deflate_round_trip_compress_large)
     EXPECT(uncompressed == original);
 }
 
+TEST_CASE(deflate_decompress_with_small_reads)
+{
+    auto original = ByteBuffer::create_zeroed(64 * KiB).release_value();
+    fill_with_random(original.bytes().trim(16 * KiB));
+    auto compressed = TRY_OR_FAIL(Compress::DeflateCompressor::compress_all(original, Compress::DeflateCompressor::CompressionLevel::FAST));
+
+    // Reading in chunks much smaller than a back reference makes the decompressor hold decoded data across reads.
+    FixedMemoryStream memory_stream { compressed.bytes() };
+    LittleEndianInputBitStream bit_stream { MaybeOwned<Stream>(memory_stream) };
+    auto decompressor = TRY_OR_FAIL(Compress::DeflateDecompressor::construct(MaybeOwned<LittleEndianInputBitStream>(bit_stream)));
+    auto uncompressed = TRY_OR_FAIL(decompressor->read_until_eof(7));
+    EXPECT(uncompressed == original);
+}
+
+BENCHMARK_CASE(deflate_decompress_large)
+{
+    auto original = ByteBuffer::create_zeroed(16 * MiB).release_value();
+    for (size_t i = 0; i < original.size(); ++i)
+        original[i] = "abcdefghijklmnopqrstuvwxyz "[get_random_uniform(27)];
+    auto compressed = TRY_OR_FAIL(Compress::DeflateCompressor::compress_all(original, Compress::DeflateCompressor::CompressionLevel::FAST));
+
+    for (size_t i = 0; i < 5; ++i) {
+        auto uncompressed = TRY_OR_FAIL(Compress::DeflateDecompressor::decompress_all(compressed));
+        EXPECT(uncompressed == original);
+    }
+}
+
 TEST_CASE(deflate_compress_literals)
 {
     // This byte array is known to not produce any back references with our lz77 implementation even at the highest compression settings
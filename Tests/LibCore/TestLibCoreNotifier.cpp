@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/EventLoop.h>
+#include <LibCore/Notifier.h>
+#include <LibCore/System.h>
+#include <LibCore/Timer.h>
+#include <LibTest/TestCase.h>
+#include <sys/socket.h>
+
+TEST_CASE(read_and_write_notifiers_on_the_same_fd)
+{
+    Core::EventLoop event_loop;
+    int sockets[2];
+    TRY_OR_FAIL(Core::System::socketpair(AF_LOCAL, SOCK_STREAM, 0, sockets));
+
+    auto read_notifier = Core::Notifier::construct(sockets[0], Core::Notifier::Type::Read);
+    auto write_notifier = Core::Notifier::construct(sockets[0], Core::Notifier::Type::Write);
+
+    size_t write_activations = 0;
+    write_notifier->on_activation = [&] {
+        // The socket is writable right away, and the write notifier must not steal the read notifier's registration.
+        if (++write_activations == 3) {
+            write_notifier->set_enabled(false);
+            MUST(Core::System::write(sockets[1], "hello"sv.bytes()));
+        }
+    };
+
+    bool did_read = false;
+    read_notifier->on_activation = [&] {
+        char buffer[16];
+        auto nread = MUST(Core::System::read(sockets[0], { buffer, sizeof(buffer) }));
+        EXPECT_EQ(StringView(buffer, nread), "hello"sv);
+        did_read = true;
+    };
+
+    event_loop.spin_until([&] { return did_read; });
+    EXPECT_EQ(write_activations, 3u);
+
+    MUST(Core::System::close(sockets[0]));
+    MUST(Core::System::close(sockets[1]));
+}
+
+TEST_CASE(notifier_on_regular_file)
+{
+    Core::EventLoop event_loop;
+    char path[] = "/tmp/test-notifier-XXXXXX";
+    auto file = TRY_OR_FAIL(Core::System::mkstemp(path));
+    MUST(Core::System::unlink({ path, sizeof(path) - 1 }));
+
+    auto reaper = Core::Timer::create_single_shot(1000, [] {
+        warnln("The notifier for a regular file never fired!");
+        VERIFY_NOT_REACHED();
+    });
+    reaper->start();
+
+    // Regular files are always readable.
+    size_t activations = 0;
+    auto notifier = Core::Notifier::construct(file, Core::Notifier::Type::Read);
+    notifier->on_activation = [&] {
+        if (++activations == 2)
+            notifier->set_enabled(false);
+    };
+
+    event_loop.spin_until([&] { return activations == 2; });
+
+    MUST(Core::System::close(file));
+}
+
+TEST_CASE(notifier_sees_hang_up)
+{
+    Core::EventLoop event_loop;
+    int sockets[2];
+    TRY_OR_FAIL(Core::System::socketpair(AF_LOCAL, SOCK_STREAM, 0, sockets));
+
+    bool did_see_end_of_file = false;
+    auto notifier = Core::Notifier::construct(sockets[0], Core::Notifier::Type::Read);
+    notifier->on_activation = [&] {
+        char buffer[16];
+        if (MUST(Core::System::read(sockets[0], { buffer, sizeof(buffer) })) == 0) {
+            did_see_end_of_file = true;
+            notifier->set_enabled(false);
+        }
+    };
+
+    MUST(Core::System::close(sockets[1]));
+    event_loop.spin_until([&] { return did_see_end_of_file; });
+
+    MUST(Core::System::close(sockets[0]));
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <LibCore/TraceEvent.h>
+#include <LibTest/TestCase.h>
+#include <LibThreading/Thread.h>
+
+static JsonArray stop_and_parse_events()
+{
+    auto json = JsonValue::from_string(Core::TraceEvent::stop());
+    VERIFY(!json.is_error());
+    VERIFY(json.value().is_array());
+    return json.release_value().as_array();
+}
+
+static Vector<JsonObject const&> find_events(JsonArray const& events, StringView name)
+{
+    Vector<JsonObject const&> found_events;
+    for (auto const& event : events.values()) {
+        if (event.as_object().get_byte_string("name"sv) == name)
+            found_events.append(event.as_object());
+    }
+    return found_events;
+}
+
+TEST_CASE(events_are_only_recorded_while_tracing)
+{
+    EXPECT(!Core::TraceEvent::is_enabled());
+    Core::TraceEvent::instant("test"sv, "before"sv);
+
+    Core::TraceEvent::start();
+    EXPECT(Core::TraceEvent::is_enabled());
+    Core::TraceEvent::instant("test"sv, "during"sv);
+    auto events = stop_and_parse_events();
+    EXPECT(!Core::TraceEvent::is_enabled());
+
+    Core::TraceEvent::instant("test"sv, "after"sv);
+
+    EXPECT(find_events(events, "before"sv).is_empty());
+    EXPECT_EQ(find_events(events, "during"sv).size(), 1u);
+    EXPECT(find_events(events, "after"sv).is_empty());
+}
+
+TEST_CASE(events_are_serialized_in_the_chrome_trace_format)
+{
+    Core::TraceEvent::start();
+    {
+        TRACE_EVENT_SCOPE("test"sv, "scope"sv);
+        Core::TraceEvent::counter("test"sv, "counter"sv, 42);
+        Core::TraceEvent::async_begin("test"sv, "async"sv, 0x1234);
+        Core::TraceEvent::async_end("test"sv, "async"sv, 0x1234);
+    }
+    auto events = stop_and_parse_events();
+
+    auto scope_events = find_events(events, "scope"sv);
+    EXPECT_EQ(scope_events.size(), 2u);
+    EXPECT_EQ(scope_events[0].get_byte_string("ph"sv), "B"sv);
+    EXPECT_EQ(scope_events[0].get_byte_string("cat"sv), "test"sv);
+    EXPECT_EQ(scope_events[1].get_byte_string("ph"sv), "E"sv);
+    EXPECT(scope_events[0].get_i64("ts"sv).value() <= scope_events[1].get_i64("ts"sv).value());
+
+    auto counter_events = find_events(events, "counter"sv);
+    EXPECT_EQ(counter_events.size(), 1u);
+    EXPECT_EQ(counter_events[0].get_byte_string("ph"sv), "C"sv);
+    EXPECT_EQ(counter_events[0].get_object("args"sv)->get_i64("counter"sv), 42);
+
+    auto async_events = find_events(events, "async"sv);
+    EXPECT_EQ(async_events.size(), 2u);
+    EXPECT_EQ(async_events[0].get_byte_string("ph"sv), "b"sv);
+    EXPECT_EQ(async_events[1].get_byte_string("ph"sv), "e"sv);
+    EXPECT_EQ(async_events[0].get_byte_string("id"sv), "0x1234"sv);
+    EXPECT_EQ(async_events[1].get_byte_string("id"sv), "0x1234"sv);
+}
+
+TEST_CASE(starting_a_trace_discards_the_events_of_the_previous_one)
+{
+    Core::TraceEvent::start();
+    Core::TraceEvent::instant("test"sv, "first trace"sv);
+    (void)Core::TraceEvent::stop();
+
+    Core::TraceEvent::start();
+    Core::TraceEvent::instant("test"sv, "second trace"sv);
+    auto events = stop_and_parse_events();
+
+    EXPECT(find_events(events, "first trace"sv).is_empty());
+    EXPECT_EQ(find_events(events, "second trace"sv).size(), 1u);
+}
+
+TEST_CASE(events_of_threads_that_exited_during_a_trace_are_collected)
+{
+    Core::TraceEvent::start();
+    Core::TraceEvent::instant("test"sv, "main thread"sv);
+
+    auto thread = Threading::Thread::construct([] {
+        Core::TraceEvent::instant("test"sv, "exited thread"sv);
+        return 0;
+    });
+    thread->start();
+    (void)thread->join();
+
+    auto events = stop_and_parse_events();
+
+    auto main_thread_events = find_events(events, "main thread"sv);
+    auto exited_thread_events = find_events(events, "exited thread"sv);
+    EXPECT_EQ(main_thread_events.size(), 1u);
+    EXPECT_EQ(exited_thread_events.size(), 1u);
+    EXPECT_NE(main_thread_events[0].get_u64("tid"sv), exited_thread_events[0].get_u64("tid"sv));
+
+    // The buffer of the exited thread was freed once its events were collected.
+    Core::TraceEvent::start();
+    EXPECT(find_events(stop_and_parse_events(), "exited thread"sv).is_empty());
+}
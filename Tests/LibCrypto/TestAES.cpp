@@ -465,3 +465,14 @@ TEST_CASE(test_AES_GCM_128bit_decrypt_multiple_blocks_with_aad)
     EXPECT(memcmp(result_pt, out.data(), out.size()) == 0);
     EXPECT_EQ(consistency, Crypto::VerificationConsistency::Consistent);
 }
+
+BENCHMARK_CASE(aes_gcm_128bit_encrypt_1mib)
+{
+    Crypto::Cipher::AESCipher::GCMMode cipher("\xfe\xff\xe9\x92\x86\x65\x73\x1c\x6d\x6a\x8f\x94\x67\x30\x83\x08"_b, 128, Crypto::Cipher::Intent::Encryption);
+    auto input = ByteBuffer::create_zeroed(1 * MiB).release_value();
+    auto out = ByteBuffer::create_uninitialized(input.size()).release_value();
+    auto out_bytes = out.bytes();
+    auto tag = ByteBuffer::create_uninitialized(16).release_value();
+    for (size_t i = 0; i < 16; ++i)
+        cipher.encrypt(input, out_bytes, "\xca\xfe\xba\xbe\xfa\xce\xdb\xad\xde\xca\xf8\x88\x00\x00\x00\x00"_b, {}, tag);
+}
@@ -9,6 +9,7 @@
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/Font/FontDatabase.h>
 #include <LibGfx/Painter.h>
+#include <LibGfx/Path.h>
 #include <stdio.h>
 
 BENCHMARK_CASE(diagonal_lines)
@@ -52,3 +53,49 @@ BENCHMARK_CASE(fill_with_gradient)
         painter.fill_rect_with_gradient(bitmap->rect(), Color::Blue, Color::Red);
     }
 }
+
+BENCHMARK_CASE(fill_with_translucent_color)
+{
+    int const run_count = 100;
+    int const bitmap_size = 2000;
+
+    auto bitmap = TRY_OR_FAIL(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRx8888, { bitmap_size, bitmap_size }));
+    Gfx::Painter painter(bitmap);
+
+    for (int run = 0; run < run_count; run++) {
+        painter.fill_rect(bitmap->rect(), Color(Color::Blue).with_alpha(128));
+    }
+}
+
+static Gfx::Path make_star_path(int bitmap_size, int point_count)
+{
+    // A self-intersecting star, so both winding rules have plenty of edges to deal with on every scanline.
+    Gfx::Path path;
+    auto center = Gfx::FloatPoint { bitmap_size / 2.0f, bitmap_size / 2.0f };
+    auto radius = bitmap_size / 2.0f - 1;
+    for (int i = 0; i < point_count; i++) {
+        auto angle = static_cast<float>(i) * 2 * AK::Pi<float> * (point_count / 2 - 1) / point_count;
+        auto point = center + Gfx::FloatPoint { AK::cos(angle), AK::sin(angle) } * radius;
+        if (i == 0)
+            path.move_to(point);
+        else
+            path.line_to(point);
+    }
+    path.close();
+    return path;
+}
+
+BENCHMARK_CASE(fill_complex_path)
+{
+    int const run_count = 20;
+    int const bitmap_size = 2000;
+
+    auto bitmap = TRY_OR_FAIL(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRx8888, { bitmap_size, bitmap_size }));
+    Gfx::Painter painter(bitmap);
+    auto path = make_star_path(bitmap_size, 101);
+
+    for (int run = 0; run < run_count; run++) {
+        painter.fill_path(path, Color::Blue, Gfx::WindingRule::Nonzero);
+        painter.fill_path(path, Color(Color::Red).with_alpha(128), Gfx::WindingRule::EvenOdd);
+    }
+}
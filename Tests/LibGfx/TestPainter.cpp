@@ -6,6 +6,7 @@
 
 #include <LibTest/TestCase.h>
 
+#include <AK/Vector.h>
 #include <LibGfx/Painter.h>
 
 TEST_CASE(draw_scaled_bitmap_with_transform)
@@ -53,3 +54,27 @@ TEST_CASE(draw_rect_rough_bounds)
     painter.draw_rect(Gfx::IntRect(0, 0, 1, 1), Color::Black, true);
     painter.draw_rect(Gfx::IntRect(9, 9, 1, 1), Color::Black, true);
 }
+
+TEST_CASE(fill_rect_with_translucent_color)
+{
+    auto bitmap = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, { 13, 3 }));
+    Gfx::Painter painter(*bitmap);
+
+    Vector<Color> destination_colors;
+    for (int y = 0; y < bitmap->height(); ++y) {
+        for (int x = 0; x < bitmap->width(); ++x) {
+            // Mix opaque and translucent pixels, so both the vectorized and the scalar path are taken.
+            auto alpha = (y == 1 && x >= 6) ? static_cast<u8>(x * 20) : 0xff;
+            auto color = Color(x * 19, y * 80, 255 - x * 7, alpha);
+            bitmap->set_pixel(x, y, color);
+            destination_colors.append(color);
+        }
+    }
+
+    auto source_color = Color(200, 100, 50, 77);
+    painter.fill_rect(bitmap->rect(), source_color);
+    for (int y = 0; y < bitmap->height(); ++y) {
+        for (int x = 0; x < bitmap->width(); ++x)
+            EXPECT_EQ(bitmap->get_pixel(x, y), destination_colors[y * bitmap->width() + x].blend(source_color));
+    }
+}
@@ -0,0 +1,22 @@
+// The higher-order array builtins, and growing, sorting and copying arrays.
+
+let checksum = 0;
+for (let iteration = 0; iteration < 100; ++iteration) {
+    const array = [];
+    for (let i = 0; i < 5000; ++i) array.push((i * 7919) % 5000);
+
+    const doubled = array.map(value => value * 2);
+    const even = doubled.filter(value => value % 4 === 0);
+    checksum += even.reduce((total, value) => total + value, 0);
+    checksum += array.indexOf(4999) + (array.includes(-1) ? 1 : 0);
+    checksum += array.slice(100, 200).concat(array.slice(0, 10)).length;
+
+    const sorted = array.slice().sort((a, b) => a - b);
+    checksum += sorted[0] + sorted[sorted.length - 1];
+
+    array.forEach(value => {
+        checksum += value & 1;
+    });
+}
+
+if (checksum !== 1250493000) throw new Error(`Unexpected checksum ${checksum}`);
@@ -0,0 +1,28 @@
+// Calls to plain functions, methods, and functions with more arguments than they have parameters.
+
+function add(a, b) {
+    return a + b;
+}
+
+const calculator = {
+    total: 0,
+    accumulate(value) {
+        this.total += value;
+        return this;
+    },
+};
+
+function fibonacci(n) {
+    return n < 2 ? n : fibonacci(n - 1) + fibonacci(n - 2);
+}
+
+let sum = 0;
+for (let i = 0; i < 1000000; ++i) {
+    sum = add(sum, i);
+    calculator.accumulate(1);
+    sum = add(sum, 1, 2, 3);
+}
+sum += fibonacci(25);
+
+if (sum !== 499999500000 + 1000000 + 75025) throw new Error(`Unexpected sum ${sum}`);
+if (calculator.total !== 1000000) throw new Error(`Unexpected total ${calculator.total}`);
@@ -0,0 +1,23 @@
+// Creating closures, and reading and writing the variables they captured.
+
+function makeCounter() {
+    let count = 0;
+    return {
+        increment: () => ++count,
+        get: () => count,
+    };
+}
+
+function makeAdder(amount) {
+    return value => value + amount;
+}
+
+let sum = 0;
+for (let i = 0; i < 100000; ++i) {
+    const counter = makeCounter();
+    for (let j = 0; j < 5; ++j) counter.increment();
+    sum += counter.get();
+    sum = makeAdder(i)(sum);
+}
+
+if (sum !== 500000 + 4999950000) throw new Error(`Unexpected sum ${sum}`);
@@ -0,0 +1,26 @@
+// Resuming generators, both directly and through iteration protocols like for-of and spreading.
+
+function* range(start, end) {
+    for (let i = start; i < end; ++i) yield i;
+}
+
+function* pairs(iterable) {
+    let previous;
+    for (const value of iterable) {
+        if (previous !== undefined) yield [previous, value];
+        previous = value;
+    }
+}
+
+let checksum = 0;
+for (let iteration = 0; iteration < 50; ++iteration) {
+    for (const value of range(0, 2000)) checksum += value;
+    for (const [a, b] of pairs(range(0, 1000))) checksum += b - a;
+    checksum += [...range(0, 500)].length;
+
+    const generator = range(0, 100);
+    let result;
+    while (!(result = generator.next()).done) checksum += result.value & 1;
+}
+
+if (checksum !== 50 * (1999000 + 999 + 500 + 50)) throw new Error(`Unexpected checksum ${checksum}`);
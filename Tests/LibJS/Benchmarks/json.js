@@ -0,0 +1,23 @@
+// Serializing an object graph to JSON and parsing it back.
+
+const records = [];
+for (let i = 0; i < 500; ++i) {
+    records.push({
+        id: i,
+        name: `record ${i}`,
+        active: i % 2 === 0,
+        score: i * 1.5,
+        tags: ["a", "b", `tag${i % 10}`],
+        nested: { depth: 1, values: [i, i + 1, i + 2] },
+    });
+}
+
+let checksum = 0;
+for (let iteration = 0; iteration < 100; ++iteration) {
+    const text = JSON.stringify(records);
+    const parsed = JSON.parse(text);
+    checksum += text.length > 0 ? 1 : 0;
+    checksum += parsed.length + parsed[parsed.length - 1].nested.values[2];
+}
+
+if (checksum !== 100 * (1 + 500 + 501)) throw new Error(`Unexpected checksum ${checksum}`);
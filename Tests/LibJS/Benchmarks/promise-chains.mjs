@@ -0,0 +1,20 @@
+// Resolving promises, running reactions through long then() chains, and awaiting in async functions.
+
+async function sumAsync(count) {
+    let total = 0;
+    for (let i = 0; i < count; ++i) total += await i;
+    return total;
+}
+
+let chain = Promise.resolve(0);
+for (let i = 0; i < 100000; ++i) chain = chain.then(value => value + 1);
+
+const sums = [];
+for (let i = 0; i < 100; ++i) sums.push(sumAsync(1000));
+
+const mixed = Promise.all([Promise.resolve(1), 2, new Promise(resolve => resolve(3))]);
+
+// This is a module so that the result can be awaited at the top level, where throwing makes js exit with an error.
+const [chained, totals, values] = await Promise.all([chain, Promise.all(sums), mixed]);
+const checksum = chained + totals.reduce((a, b) => a + b, 0) + values.length;
+if (checksum !== 100000 + 100 * 499500 + 3) throw new Error(`Unexpected checksum ${checksum}`);
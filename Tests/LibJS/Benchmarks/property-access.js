@@ -0,0 +1,22 @@
+// Named property loads and stores on objects that share a shape, and on objects of a few different shapes.
+
+function makePoint(x, y) {
+    return { x, y };
+}
+
+const points = [];
+for (let i = 0; i < 1000; ++i) points.push(makePoint(i, i * 2));
+
+const shapes = [{ a: 1, x: 1 }, { b: 1, x: 2 }, { c: 1, x: 3 }, { d: 1, x: 4 }];
+
+let sum = 0;
+for (let iteration = 0; iteration < 1000; ++iteration) {
+    for (let i = 0; i < points.length; ++i) {
+        const point = points[i];
+        point.x = point.x + 1;
+        sum += point.x + point.y;
+    }
+    for (let i = 0; i < 1000; ++i) sum += shapes[i & 3].x;
+}
+
+if (sum !== 2001500000) throw new Error(`Unexpected sum ${sum}`);
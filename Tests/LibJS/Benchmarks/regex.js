@@ -0,0 +1,20 @@
+// Compiling regular expressions once, and then testing, executing and replacing with them over and over.
+
+const lines = [];
+for (let i = 0; i < 1000; ++i) lines.push(`2024-${(i % 12) + 1}-${(i % 28) + 1} user${i}@example.com GET /path/${i}?q=${i * 3}`);
+
+const date = /^(\d{4})-(\d{1,2})-(\d{1,2})/;
+const email = /[a-z0-9]+@[a-z]+\.com/;
+const digits = /\d+/g;
+
+let checksum = 0;
+for (let iteration = 0; iteration < 20; ++iteration) {
+    for (const line of lines) {
+        const match = date.exec(line);
+        checksum += Number(match[2]) + Number(match[3]);
+        if (email.test(line)) ++checksum;
+        checksum += line.replace(digits, "#").length;
+    }
+}
+
+if (checksum !== 1218080) throw new Error(`Unexpected checksum ${checksum}`);
@@ -0,0 +1,17 @@
+// Building strings by concatenation and templates, and searching, slicing and splitting them.
+
+let checksum = 0;
+for (let iteration = 0; iteration < 200; ++iteration) {
+    let text = "";
+    for (let i = 0; i < 1000; ++i) text += `item-${i},`;
+
+    checksum += text.length;
+    checksum += text.indexOf("item-999");
+    checksum += text.split(",").length;
+    checksum += text.slice(10, 50).toUpperCase().charCodeAt(5);
+    checksum += text.replaceAll("item", "x").length;
+    checksum += text.startsWith("item-0") ? 1 : 0;
+    checksum += ["a", "b", "c"].join(text.substring(0, 3)).length;
+}
+
+if (checksum !== 4951200) throw new Error(`Unexpected checksum ${checksum}`);
@@ -0,0 +1,30 @@
+// Builds a heap large enough to be marked by several threads when run with --gc-marking-threads, and checks that
+// nothing reachable from it gets collected.
+
+const nodeCount = 200_000;
+
+let list = null;
+const maps = [];
+for (let i = 0; i < nodeCount; ++i) {
+    list = { value: i, next: list, payload: [i, `${i}`] };
+    if (i % 10 === 0) maps.push(new Map([[i, { value: i }]]));
+
+    // Garbage in between the live cells, for the collector to sweep.
+    void { garbage: [i] };
+}
+
+for (let round = 0; round < 3; ++round) {
+    gc();
+
+    let expected = nodeCount - 1;
+    for (let node = list; node !== null; node = node.next) {
+        if (node.value !== expected || node.payload[0] !== expected || node.payload[1] !== `${expected}`)
+            throw new Error(`Round ${round}: list node ${expected} is damaged`);
+        --expected;
+    }
+    if (expected !== -1) throw new Error(`Round ${round}: list ended ${expected + 1} nodes early`);
+
+    for (let i = 0; i < maps.length; ++i) {
+        if (maps[i].get(i * 10)?.value !== i * 10) throw new Error(`Round ${round}: map ${i} is damaged`);
+    }
+}
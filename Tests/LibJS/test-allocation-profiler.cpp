@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Heap/AllocationProfiler.h>
+#include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibJS/Script.h>
+#include <LibTest/TestCase.h>
+
+// Allocates a known number of plain objects from a known line, and hands them back so they stay alive.
+static constexpr size_t object_count = 10;
+static constexpr auto source = R"(
+function makeObjects() {
+    const objects = [];
+    for (let i = 0; i < 10; ++i)
+        objects.push({ index: i });
+    return objects;
+}
+makeObjects();
+)"sv;
+
+static JsonObject const* find_site(JsonArray const& sites, size_t site_index)
+{
+    for (auto const& site : sites.values()) {
+        if (site.as_object().get_u64("id"sv) == site_index)
+            return &site.as_object();
+    }
+    return nullptr;
+}
+
+TEST_CASE(sampled_cells_are_attributed_to_their_allocation_site)
+{
+    auto vm = MUST(JS::VM::create());
+    auto root_execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto& realm = *root_execution_context->realm;
+
+    auto script = JS::Script::parse(source, realm, "allocations.js"sv);
+    EXPECT(!script.is_error());
+
+    // With an interval of 1, every allocated cell is sampled.
+    vm->heap().set_allocation_sample_interval(1);
+    auto result = vm->bytecode_interpreter().run(*script.value());
+    EXPECT(!result.is_error());
+    auto objects = JS::make_handle(result.value().as_object());
+
+    auto const* profiler = vm->heap().allocation_profiler();
+    EXPECT(profiler != nullptr);
+    EXPECT_EQ(profiler->sample_interval(), 1u);
+
+    Optional<size_t> object_site_index;
+    for (size_t i = 0; i < object_count; ++i) {
+        auto element = objects->get_without_side_effects(JS::PropertyKey { i });
+        EXPECT(element.is_object());
+        auto site_index = profiler->allocation_site_index(element.as_object());
+        EXPECT(site_index.has_value());
+        // Every object was allocated by the same object literal, so they all share a site.
+        if (!object_site_index.has_value())
+            object_site_index = site_index;
+        EXPECT_EQ(site_index, object_site_index);
+    }
+
+    auto profile = profiler->to_json();
+    auto const& sites = profile.get_array("sites"sv).value();
+    auto const* site = find_site(sites, object_site_index.value());
+    EXPECT(site != nullptr);
+    if (site) {
+        EXPECT_EQ(site->get_byte_string("class_name"sv), "Object"sv);
+        EXPECT(site->get_u64("sampled_allocations"sv).value() >= object_count);
+        EXPECT_EQ(site->get_u64("estimated_allocations"sv), site->get_u64("sampled_allocations"sv));
+
+        // The innermost frame is the function that ran the object literal, on the fifth line of the script.
+        auto const& js_stack = site->get_array("js_stack"sv).value();
+        EXPECT(js_stack.size() > 0);
+        if (js_stack.size() > 0)
+            EXPECT(js_stack[0].as_string().starts_with("makeObjects @ allocations.js:5:"sv));
+    }
+
+    // The array holding the objects was allocated elsewhere, by a site of its own.
+    auto array_site_index = profiler->allocation_site_index(*objects);
+    EXPECT(array_site_index.has_value());
+    EXPECT_NE(array_site_index, object_site_index);
+}
+
+TEST_CASE(zero_interval_turns_sampling_off)
+{
+    auto vm = MUST(JS::VM::create());
+
+    vm->heap().set_allocation_sample_interval(1);
+    EXPECT(vm->heap().allocation_profiler() != nullptr);
+
+    vm->heap().set_allocation_sample_interval(0);
+    EXPECT(vm->heap().allocation_profiler() == nullptr);
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/HashMap.h>
+#include <AK/HashTable.h>
+#include <LibJS/Heap/HeapBlock.h>
+#include <LibJS/Heap/MarkedVector.h>
+#include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/Object.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibTest/TestCase.h>
+
+// Enough objects to fill a number of blocks. Objects are much larger than a mark bit granule, so only every few bits of
+// these blocks' bitmaps belong to a cell, and the rest stay clear.
+static constexpr size_t object_count = 2000;
+
+static HashTable<JS::HeapBlock*> blocks_of(JS::MarkedVector<JS::NonnullGCPtr<JS::Object>> const& objects)
+{
+    HashTable<JS::HeapBlock*> blocks;
+    for (auto const& object : objects)
+        blocks.set(JS::HeapBlock::from_cell(object.ptr()));
+    return blocks;
+}
+
+TEST_CASE(blocks_with_all_live_cells_marked_are_skipped)
+{
+    auto vm = MUST(JS::VM::create());
+    auto root_execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto& realm = *root_execution_context->realm;
+    auto& heap = vm->heap();
+
+    JS::MarkedVector<JS::NonnullGCPtr<JS::Object>> objects(heap);
+    for (size_t i = 0; i < object_count; ++i)
+        objects.append(JS::Object::create(realm, nullptr));
+    auto blocks = blocks_of(objects);
+    EXPECT(blocks.size() > 1);
+
+    // The first collection gets rid of whatever garbage creating the realm left behind. After that, every cell is
+    // reachable, so the next collection marks all of them and can skip every block that holds the objects.
+    heap.collect_garbage();
+    heap.collect_garbage();
+    EXPECT(heap.last_sweep_statistics().skipped_block_count >= blocks.size());
+
+    for (auto* block : blocks) {
+        EXPECT_EQ(block->marked_cell_count(), 0u);
+        EXPECT(block->live_cell_count() > 0);
+    }
+}
+
+TEST_CASE(blocks_with_unmarked_live_cells_are_swept)
+{
+    auto vm = MUST(JS::VM::create());
+    auto root_execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto& realm = *root_execution_context->realm;
+    auto& heap = vm->heap();
+
+    JS::MarkedVector<JS::NonnullGCPtr<JS::Object>> objects(heap);
+    for (size_t i = 0; i < object_count; ++i)
+        objects.append(JS::Object::create(realm, nullptr));
+    heap.collect_garbage();
+
+    // Dropping every other object leaves every block with unmarked cells between its marked ones. Only the blocks that
+    // keep an object are looked at, as the others may be given back to the block allocator.
+    JS::MarkedVector<JS::NonnullGCPtr<JS::Object>> kept_objects(heap);
+    for (size_t i = 0; i < objects.size(); i += 2)
+        kept_objects.append(objects[i]);
+    auto blocks = blocks_of(kept_objects);
+    objects.clear();
+
+    HashMap<JS::HeapBlock*, size_t> live_cell_counts;
+    for (auto* block : blocks)
+        live_cell_counts.set(block, block->live_cell_count());
+
+    heap.collect_garbage();
+    EXPECT(heap.last_sweep_statistics().swept_block_count >= blocks.size());
+    for (auto* block : blocks)
+        EXPECT(block->live_cell_count() < live_cell_counts.get(block).value());
+
+    // With the garbage gone, the same blocks are skipped again.
+    heap.collect_garbage();
+    EXPECT(heap.last_sweep_statistics().skipped_block_count >= blocks.size());
+}
+
+TEST_CASE(sparse_mark_bitmap_is_compared_with_live_cell_count)
+{
+    auto vm = MUST(JS::VM::create());
+    auto root_execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto& realm = *root_execution_context->realm;
+
+    auto object = JS::Object::create(realm, nullptr);
+    auto& block = *JS::HeapBlock::from_cell(object.ptr());
+    EXPECT(block.cell_size() > JS::HeapBlock::mark_bit_granule);
+
+    Vector<JS::Cell*> live_cells;
+    block.for_each_cell_in_state<JS::Cell::State::Live>([&](JS::Cell* cell) { live_cells.append(cell); });
+    EXPECT_EQ(live_cells.size(), block.live_cell_count());
+
+    for (auto* cell : live_cells)
+        block.set_cell_marked(cell, true);
+    EXPECT_EQ(block.marked_cell_count(), block.live_cell_count());
+    EXPECT(!block.has_unmarked_live_cells());
+
+    block.set_cell_marked(object.ptr(), false);
+    EXPECT(block.has_unmarked_live_cells());
+
+    block.clear_mark_bits();
+    EXPECT_EQ(block.marked_cell_count(), 0u);
+}
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/ByteString.h>
+#include <AK/Format.h>
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <AK/LexicalPath.h>
+#include <AK/Math.h>
+#include <AK/QuickSort.h>
+#include <AK/Statistics.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibCore/ArgsParser.h>
+#include <LibCore/File.h>
+#include <LibCore/Process.h>
+#include <LibFileSystem/FileSystem.h>
+#include <LibMain/Main.h>
+#include <LibTest/TestRunnerUtil.h>
+#include <unistd.h>
+
+// Runs every benchmark script in its own `js` process, several times, and reports how long the runs took.
+// Each script is expected to do a fixed amount of work and to throw if it computed something unexpected. The time of
+// a run includes starting up js, so the work of a benchmark should take long enough to dwarf that.
+// Scripts ending in .mjs are run as modules, which lets them check results of asynchronous work with top-level await.
+
+struct BenchmarkResult {
+    ByteString name;
+    Statistics<u64> run_times_in_microseconds;
+};
+
+static ErrorOr<u64> run_benchmark(StringView js_command, ByteString const& path)
+{
+    Vector<ByteString> arguments { "--disable-debug-output"sv, path };
+    if (path.ends_with(".mjs"sv))
+        arguments.prepend("--as-module"sv);
+
+    auto start_time = MonotonicTime::now();
+    auto process = TRY(Core::Process::spawn({
+        .executable = js_command,
+        .search_for_executable_in_path = true,
+        .arguments = arguments,
+        .file_actions = {
+            Core::FileAction::OpenFile { .path = "/dev/null"sv, .mode = Core::File::OpenMode::Write, .fd = STDOUT_FILENO },
+        },
+    }));
+
+    if (!TRY(process.wait_for_termination()))
+        return Error::from_string_literal("Benchmark did not exit successfully");
+
+    return static_cast<u64>((MonotonicTime::now() - start_time).to_microseconds());
+}
+
+static double to_milliseconds(double microseconds)
+{
+    return microseconds / 1000.0;
+}
+
+static JsonObject to_json(Vector<BenchmarkResult>& results, size_t iterations)
+{
+    JsonObject benchmarks;
+    for (auto& result : results) {
+        auto& statistics = result.run_times_in_microseconds;
+
+        JsonArray runs;
+        for (auto run_time : statistics.values())
+            runs.must_append(to_milliseconds(run_time));
+
+        JsonObject benchmark;
+        benchmark.set("median_ms"sv, to_milliseconds(statistics.median()));
+        benchmark.set("mean_ms"sv, to_milliseconds(statistics.average()));
+        benchmark.set("min_ms"sv, to_milliseconds(statistics.min()));
+        benchmark.set("max_ms"sv, to_milliseconds(statistics.max()));
+        benchmark.set("stddev_ms"sv, to_milliseconds(statistics.standard_deviation()));
+        benchmark.set("runs_ms"sv, move(runs));
+        benchmarks.set(result.name, move(benchmark));
+    }
+
+    JsonObject report;
+    report.set("iterations"sv, iterations);
+    report.set("benchmarks"sv, move(benchmarks));
+    return report;
+}
+
+static void print_results(Vector<BenchmarkResult>& results, Optional<JsonObject> const& baseline)
+{
+    outln("{:<24} {:>10} {:>10} {:>10} {:>10}{}", "Benchmark", "Median", "Mean", "Min", "Stddev", baseline.has_value() ? "   Baseline    Change"sv : ""sv);
+
+    for (auto& result : results) {
+        auto& statistics = result.run_times_in_microseconds;
+        auto median = to_milliseconds(statistics.median());
+        auto stddev = to_milliseconds(statistics.standard_deviation());
+
+        out("{:<24} {:>8.2f}ms {:>8.2f}ms {:>8.2f}ms {:>8.2f}ms", result.name, median, to_milliseconds(statistics.average()), to_milliseconds(statistics.min()), stddev);
+
+        if (baseline.has_value()) {
+            auto baseline_benchmark = baseline->get_object(result.name);
+            auto baseline_median = baseline_benchmark.has_value() ? baseline_benchmark->get_double_with_precision_loss("median_ms"sv) : Optional<double> {};
+            if (!baseline_median.has_value() || *baseline_median <= 0) {
+                outln("          -         -");
+                continue;
+            }
+
+            // Differences that are within twice the noise of either run are not worth pointing out.
+            auto baseline_stddev = baseline_benchmark->get_double_with_precision_loss("stddev_ms"sv).value_or(0);
+            auto difference = median - *baseline_median;
+            bool is_significant = AK::fabs(difference) > 2 * max(stddev, baseline_stddev);
+
+            auto change = difference / *baseline_median * 100;
+            out(" {:>8.2f}ms {:>+8.1f}%", *baseline_median, change);
+            if (is_significant)
+                out(" {}", difference > 0 ? "\033[31;1mslower\033[0m"sv : "\033[32;1mfaster\033[0m"sv);
+        }
+        outln();
+    }
+}
+
+ErrorOr<int> serenity_main(Main::Arguments arguments)
+{
+    StringView benchmark_path;
+    StringView js_command = "js"sv;
+    StringView output_path;
+    StringView baseline_path;
+    size_t iterations = 10;
+    size_t warmup_iterations = 1;
+
+    Core::ArgsParser args_parser;
+    args_parser.set_general_help("Run JavaScript microbenchmarks through js and report how long they take.");
+    args_parser.add_positional_argument(benchmark_path, "Benchmark script, or directory to search for benchmark scripts", "benchmarks");
+    args_parser.add_option(js_command, "Path to the js executable", "js", 'j', "path");
+    args_parser.add_option(iterations, "Number of measured runs of each benchmark", "iterations", 'n', "count");
+    args_parser.add_option(warmup_iterations, "Number of runs of each benchmark that are not measured", "warmup", 'w', "count");
+    args_parser.add_option(output_path, "Save the results as JSON, to compare later runs against", "output", 'o', "path");
+    args_parser.add_option(baseline_path, "Compare the results against a JSON file saved with --output", "baseline", 'b', "path");
+    args_parser.parse(arguments);
+
+    if (iterations == 0) {
+        warnln("At least one iteration is needed");
+        return 1;
+    }
+
+    Optional<JsonObject> baseline;
+    if (!baseline_path.is_empty()) {
+        auto baseline_file = TRY(Core::File::open(baseline_path, Core::File::OpenMode::Read));
+        auto baseline_json = TRY(JsonValue::from_string(TRY(baseline_file->read_until_eof())));
+        if (!baseline_json.is_object() || !baseline_json.as_object().has_object("benchmarks"sv)) {
+            warnln("{} is not a report of this benchmark runner", baseline_path);
+            return 1;
+        }
+        baseline = baseline_json.as_object().get_object("benchmarks"sv).value();
+    }
+
+    Vector<ByteString> paths;
+    if (!FileSystem::is_directory(benchmark_path)) {
+        paths.append(benchmark_path);
+    } else {
+        Test::iterate_directory_recursively(LexicalPath::canonicalized_path(benchmark_path), [&](ByteString const& file_path) {
+            if (file_path.ends_with(".js"sv) || file_path.ends_with(".mjs"sv))
+                paths.append(file_path);
+        });
+        quick_sort(paths);
+    }
+
+    Vector<BenchmarkResult> results;
+    for (auto const& path : paths) {
+        BenchmarkResult result { .name = LexicalPath::title(path), .run_times_in_microseconds = {} };
+        warn("\033[2K\rRunning {}...", result.name);
+
+        bool failed = false;
+        for (size_t i = 0; i < warmup_iterations + iterations; ++i) {
+            auto run_time = run_benchmark(js_command, path);
+            if (run_time.is_error()) {
+                warnln("\033[2K\r\033[31;1m{} failed: {}\033[0m", result.name, run_time.error());
+                failed = true;
+                break;
+            }
+            if (i >= warmup_iterations)
+                result.run_times_in_microseconds.add(run_time.value());
+        }
+
+        if (!failed)
+            results.append(move(result));
+    }
+    warn("\033[2K\r");
+
+    print_results(results, baseline);
+
+    if (!output_path.is_empty()) {
+        auto output_file = TRY(Core::File::open(output_path, Core::File::OpenMode::Write));
+        TRY(output_file->write_until_depleted(to_json(results, iterations).to_byte_string()));
+    }
+
+    return results.size() == paths.size() ? 0 : 1;
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibJS/Script.h>
+#include <LibTest/TestCase.h>
+
+// Keeps the interpreter busy for long enough that the profiler has to take a number of samples.
+static constexpr auto source = R"(
+function fib(n) {
+    return n < 2 ? n : fib(n - 1) + fib(n - 2);
+}
+
+let start = Date.now();
+while (Date.now() - start < 100)
+    fib(15);
+)"sv;
+
+static JsonObject const* find_node_for_function(JsonArray const& nodes, StringView function_name)
+{
+    for (auto const& node : nodes.values()) {
+        auto const& call_frame = node.as_object().get_object("callFrame"sv).value();
+        if (call_frame.get_byte_string("functionName"sv) == function_name)
+            return &node.as_object();
+    }
+    return nullptr;
+}
+
+TEST_CASE(samples_are_attributed_to_the_running_function)
+{
+    auto vm = MUST(JS::VM::create());
+    auto root_execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto& realm = *root_execution_context->realm;
+
+    auto script = JS::Script::parse(source, realm, "profile.js"sv);
+    EXPECT(!script.is_error());
+
+    auto& profiler = vm->ensure_sampling_profiler();
+    profiler.start();
+    auto result = vm->bytecode_interpreter().run(*script.value());
+    profiler.stop();
+
+    EXPECT(!result.is_error());
+    EXPECT(!profiler.is_running());
+    EXPECT(profiler.sample_count() > 0);
+
+    auto profile = profiler.to_cpuprofile();
+    auto const& nodes = profile.get_array("nodes"sv).value();
+    auto const& samples = profile.get_array("samples"sv).value();
+    auto const& time_deltas = profile.get_array("timeDeltas"sv).value();
+    EXPECT_EQ(samples.size(), profiler.sample_count());
+    EXPECT_EQ(time_deltas.size(), profiler.sample_count());
+
+    // Every sample lands on exactly one node of the call tree.
+    size_t total_hit_count = 0;
+    for (auto const& node : nodes.values())
+        total_hit_count += node.as_object().get_u32("hitCount"sv).value();
+    EXPECT_EQ(total_hit_count, profiler.sample_count());
+
+    auto const* fib_node = find_node_for_function(nodes, "fib"sv);
+    EXPECT(fib_node != nullptr);
+    if (fib_node) {
+        auto const& call_frame = fib_node->get_object("callFrame"sv).value();
+        EXPECT_EQ(call_frame.get_byte_string("url"sv), "profile.js"sv);
+        // The function starts on the second line of the script, and DevTools lines are zero-based.
+        EXPECT_EQ(call_frame.get_i32("lineNumber"sv), 1);
+    }
+}
+
+TEST_CASE(restarting_discards_the_previous_profile)
+{
+    auto vm = MUST(JS::VM::create());
+    auto root_execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto& realm = *root_execution_context->realm;
+
+    auto script = JS::Script::parse(source, realm, "profile.js"sv);
+    EXPECT(!script.is_error());
+
+    auto& profiler = vm->ensure_sampling_profiler();
+    profiler.start();
+    (void)vm->bytecode_interpreter().run(*script.value());
+    profiler.stop();
+    EXPECT(profiler.sample_count() > 0);
+
+    profiler.start();
+    profiler.stop();
+    EXPECT_EQ(profiler.sample_count(), 0u);
+    EXPECT_EQ(profiler.to_cpuprofile().get_array("nodes"sv)->size(), 1u);
+}
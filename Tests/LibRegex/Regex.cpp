@@ -1078,6 +1078,28 @@ TEST_CASE(optimizer_alternation)
     }
 }
 
+TEST_CASE(optimizer_literal_prefix)
+{
+    Array tests {
+        // Pattern, Subject, Expected match count
+        Tuple { "a\\d+"sv, "xa1 a22 b3 a"sv, 2u },
+        Tuple { "foo\\d"sv, "foofoo1fo2foo3"sv, 2u },
+        Tuple { "ab\\d"sv, "aab1ab2ab"sv, 2u },
+        Tuple { "error: (\\d+)"sv, "error: x error: 42, error: 7"sv, 2u },
+        Tuple { "(?:ab)+c"sv, "abababc ab abc"sv, 2u },
+        Tuple { "x*y"sv, "axxyby"sv, 2u },
+    };
+
+    for (auto& test : tests) {
+        Regex<ECMA262> re(test.get<0>(), ECMAScriptFlags::Global);
+        auto result = re.match(test.get<1>());
+        EXPECT_EQ(result.count, test.get<2>());
+    }
+
+    Regex<ECMA262> insensitive("a\\d"sv, ECMAScriptFlags::Global | ECMAScriptFlags::Insensitive);
+    EXPECT_EQ(insensitive.match("A1a2"sv).count, 2u);
+}
+
 TEST_CASE(posix_basic_dollar_is_end_anchor)
 {
     // Ensure that a dollar sign at the end only matches the end of the line.
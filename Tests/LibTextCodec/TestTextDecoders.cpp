@@ -58,3 +58,25 @@ TEST_CASE(test_utf16le_decode)
     EXPECT(processed_code_points[2] == 0x6B);
     EXPECT(processed_code_points[3] == 0x1F600);
 }
+
+TEST_CASE(test_single_byte_decode_with_ascii_runs)
+{
+    auto decoder = TextCodec::decoder_for_exact_name("windows-1252"sv);
+    EXPECT(decoder.has_value());
+
+    // 0x80 is EURO SIGN and 0xE9 is LATIN SMALL LETTER E WITH ACUTE in windows-1252.
+    EXPECT_EQ(MUST(decoder->to_utf8(""sv)), ""sv);
+    EXPECT_EQ(MUST(decoder->to_utf8("caf\xe9"sv)), "café"sv);
+    EXPECT_EQ(MUST(decoder->to_utf8("\x80 price is 5\x80, a long run of plain ASCII text\x80"sv)), "€ price is 5€, a long run of plain ASCII text€"sv);
+
+    auto latin1_decoder = TextCodec::decoder_for_exact_name("iso-8859-1"sv);
+    EXPECT(latin1_decoder.has_value());
+    EXPECT_EQ(MUST(latin1_decoder->to_utf8("\xe4 caf\xe9 and more ASCII text after it\xff"sv)), "ä café and more ASCII text after itÿ"sv);
+}
+
+TEST_CASE(test_utf8_decode_invalid)
+{
+    auto decoder = TextCodec::UTF8Decoder();
+    EXPECT_EQ(MUST(decoder.to_utf8("\xef\xbb\xbf" "abc"sv)), "abc"sv);
+    EXPECT_EQ(MUST(decoder.to_utf8("abc\xff" "def"sv)), "abc\xef\xbf\xbd" "def"sv);
+}
@@ -0,0 +1,383 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/LexicalPath.h>
+#include <AK/StringBuilder.h>
+#include <LibCore/AnonymousBuffer.h>
+#include <LibCore/Environment.h>
+#include <LibCore/EventLoop.h>
+#include <LibFileSystem/FileSystem.h>
+#include <LibGfx/Bitmap.h>
+#include <LibGfx/Font/FontDatabase.h>
+#include <LibGfx/Palette.h>
+#include <LibGfx/SystemTheme.h>
+#include <LibJS/Heap/Handle.h>
+#include <LibWeb/Bindings/MainThreadVM.h>
+#include <LibWeb/CSS/CSSStyleSheet.h>
+#include <LibWeb/CSS/Parser/Parser.h>
+#include <LibWeb/CSS/SelectorEngine.h>
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOM/Element.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Responses.h>
+#include <LibWeb/HTML/DocumentState.h>
+#include <LibWeb/HTML/NavigationParams.h>
+#include <LibWeb/HTML/Parser/HTMLParser.h>
+#include <LibWeb/HTML/TraversableNavigable.h>
+#include <LibWeb/Page/Page.h>
+#include <LibWeb/Painting/DisplayList.h>
+#include <LibWeb/Painting/DisplayListPlayerCPU.h>
+#include <LibWeb/Painting/DisplayListPlayerSkia.h>
+#include <LibWeb/Painting/DisplayListRecorder.h>
+#include <LibWeb/Platform/EventLoopPluginSerenity.h>
+#include <LibWeb/Platform/FontPlugin.h>
+
+// These benchmarks build their documents in this process, with a page that is not connected to any UI, so that style,
+// layout and painting can be measured without any IPC or process startup in the way.
+
+namespace {
+
+// The resources of the source tree the benchmark was built from, unless BENCHMARK_RESOURCE_ROOT is set in the
+// environment to point somewhere else, e.g. at the resources of an installed build.
+static ByteString resource_root()
+{
+    if (auto resource_root = Core::Environment::get("BENCHMARK_RESOURCE_ROOT"sv); resource_root.has_value())
+        return *resource_root;
+    return BENCHMARK_RESOURCE_ROOT;
+}
+
+// Uses the fonts from the resources for everything, so that text is shaped the same way on every machine.
+class BenchmarkFontPlugin final : public Web::Platform::FontPlugin {
+public:
+    BenchmarkFontPlugin()
+    {
+        auto font_directory = LexicalPath::join(resource_root(), "fonts"sv);
+        if (!FileSystem::is_directory(font_directory.string())) {
+            warnln("Unable to find fonts in {}, set BENCHMARK_RESOURCE_ROOT to the Base/res directory", font_directory);
+            VERIFY_NOT_REACHED();
+        }
+        Gfx::FontDatabase::the().load_all_fonts_from_uri(MUST(String::formatted("file://{}", font_directory)));
+
+        m_default_font = Gfx::FontDatabase::the().get(font_family, 12.0, 400, Gfx::FontWidth::Normal, 0);
+        VERIFY(m_default_font);
+    }
+
+    virtual Gfx::Font& default_font() override { return *m_default_font; }
+    virtual Gfx::Font& default_fixed_width_font() override { return *m_default_font; }
+    virtual FlyString generic_font_name(Web::Platform::GenericFont) override { return font_family; }
+
+private:
+    static inline FlyString const font_family = "SerenitySans"_fly_string;
+
+    RefPtr<Gfx::Font> m_default_font;
+};
+
+class BenchmarkPageClient final : public Web::PageClient {
+    JS_CELL(BenchmarkPageClient, Web::PageClient);
+    JS_DECLARE_ALLOCATOR(BenchmarkPageClient);
+
+public:
+    static JS::NonnullGCPtr<BenchmarkPageClient> create(JS::VM& vm)
+    {
+        return vm.heap().allocate_without_realm<BenchmarkPageClient>();
+    }
+
+    JS::GCPtr<Web::Page> m_page;
+
+    virtual Web::Page& page() override { return *m_page; }
+    virtual Web::Page const& page() const override { return *m_page; }
+    virtual bool is_connection_open() const override { return false; }
+    virtual Gfx::Palette palette() const override { return Gfx::Palette(*m_palette_impl); }
+    virtual Web::DevicePixelRect screen_rect() const override { return {}; }
+    virtual double device_pixels_per_css_pixel() const override { return 1.0; }
+    virtual Web::CSS::PreferredColorScheme preferred_color_scheme() const override { return Web::CSS::PreferredColorScheme::Light; }
+    virtual Web::CSS::PreferredContrast preferred_contrast() const override { return Web::CSS::PreferredContrast::NoPreference; }
+    virtual Web::CSS::PreferredMotion preferred_motion() const override { return Web::CSS::PreferredMotion::NoPreference; }
+    virtual void request_file(Web::FileRequest) override { }
+    virtual void paint_next_frame() override { }
+    virtual void paint(Web::DevicePixelRect const&, Web::Painting::BackingStore&, Web::PaintOptions = {}) override { }
+    virtual void schedule_repaint() override { }
+    virtual bool is_ready_to_paint() const override { return true; }
+    virtual Web::DisplayListPlayerType display_list_player_type() const override { return Web::DisplayListPlayerType::Skia; }
+
+private:
+    BenchmarkPageClient()
+    {
+        auto buffer = MUST(Core::AnonymousBuffer::create_with_size(sizeof(Gfx::SystemTheme)));
+        m_palette_impl = Gfx::PaletteImpl::create_with_anonymous_buffer(buffer);
+    }
+
+    virtual void visit_edges(Visitor& visitor) override
+    {
+        Base::visit_edges(visitor);
+        visitor.visit(m_page);
+    }
+
+    RefPtr<Gfx::PaletteImpl> m_palette_impl;
+};
+
+JS_DEFINE_ALLOCATOR(BenchmarkPageClient);
+
+}
+
+static constexpr Gfx::IntSize viewport_size { 1280, 720 };
+
+static void initialize_libweb_once()
+{
+    static bool s_initialized = false;
+    if (s_initialized)
+        return;
+    s_initialized = true;
+
+    static Core::EventLoop s_event_loop;
+    Web::Platform::EventLoopPlugin::install(*new Web::Platform::EventLoopPluginSerenity);
+    Web::Platform::FontPlugin::install(*new BenchmarkFontPlugin);
+    MUST(Web::Bindings::initialize_main_thread_vm());
+}
+
+static JS::Handle<Web::DOM::Document> create_document(StringView html)
+{
+    initialize_libweb_once();
+    auto& vm = Web::Bindings::main_thread_vm();
+
+    // Every client keeps its page alive, which in turn keeps its navigables and their documents alive.
+    static Vector<JS::Handle<BenchmarkPageClient>> s_page_clients;
+    auto page_client = BenchmarkPageClient::create(vm);
+    s_page_clients.append(page_client);
+
+    auto page = Web::Page::create(vm, *page_client);
+    page_client->m_page = page.ptr();
+    page->set_top_level_traversable(MUST(Web::HTML::TraversableNavigable::create_a_new_top_level_traversable(*page, nullptr, {})));
+
+    // The same manual navigation as for SVG images.
+    JS::NonnullGCPtr<Web::HTML::Navigable> navigable = page->top_level_traversable();
+    URL::URL url { "about:blank"sv };
+    auto response = Web::Fetch::Infrastructure::Response::create(vm);
+    response->url_list().append(url);
+    auto navigation_params = vm.heap().allocate_without_realm<Web::HTML::NavigationParams>();
+    navigation_params->navigable = navigable;
+    navigation_params->response = response;
+    navigation_params->origin = Web::HTML::Origin {};
+    navigation_params->policy_container = Web::HTML::PolicyContainer {};
+    navigation_params->final_sandboxing_flag_set = Web::HTML::SandboxingFlagSet {};
+    navigation_params->cross_origin_opener_policy = Web::HTML::CrossOriginOpenerPolicy {};
+
+    auto document = MUST(Web::DOM::Document::create_and_initialize(Web::DOM::Document::Type::HTML, "text/html"_string, navigation_params));
+    navigable->set_ongoing_navigation({});
+    navigable->active_document()->destroy();
+    navigable->active_session_history_entry()->document_state()->set_document(document);
+
+    auto parser = Web::HTML::HTMLParser::create_with_uncertain_encoding(document, MUST(ByteBuffer::copy(html.bytes())));
+    parser->run(url);
+
+    navigable->set_viewport_size(viewport_size.to_type<Web::CSSPixels>());
+    document->update_layout();
+    return JS::make_handle(*document);
+}
+
+static String generate_stylesheet(size_t rule_count)
+{
+    StringBuilder builder;
+    for (size_t i = 0; i < rule_count; ++i) {
+        switch (i % 5) {
+        case 0:
+            builder.appendff(".item-{} {{ color: rgb({}, 0, 0); margin: {}px; }}\n", i, i % 256, i % 16);
+            break;
+        case 1:
+            builder.appendff("section > div.item:nth-child({}n + 1) {{ padding: 2px {}px; }}\n", i % 7 + 1, i % 9);
+            break;
+        case 2:
+            builder.appendff("#item-{} span.label {{ font-weight: bold; border: 1px solid #{:06x}; }}\n", i, i * 2654435761u % 0xffffff);
+            break;
+        case 3:
+            builder.appendff("div[data-index=\"{}\"] ~ div {{ background-color: hsl({}deg 50% 50%); }}\n", i, i % 360);
+            break;
+        case 4:
+            builder.appendff("section:not(.hidden) .item:hover, .item-{}:first-child {{ opacity: 0.{}; }}\n", i, i % 10);
+            break;
+        }
+    }
+    return MUST(builder.to_string());
+}
+
+static String generate_document(size_t section_count, size_t items_per_section, StringView style = {})
+{
+    StringBuilder builder;
+    builder.appendff("<!DOCTYPE html><html><head><style>{}</style></head><body>", style);
+    for (size_t section = 0; section < section_count; ++section) {
+        builder.append("<section>"sv);
+        for (size_t item = 0; item < items_per_section; ++item) {
+            auto index = section * items_per_section + item;
+            builder.appendff("<div class=\"item item-{}\" id=\"item-{}\" data-index=\"{}\"><span class=\"label\">Item {}</span> with some text</div>", index, index, index, index);
+        }
+        builder.append("</section>"sv);
+    }
+    builder.append("</body></html>"sv);
+    return MUST(builder.to_string());
+}
+
+BENCHMARK_CASE(parse_stylesheet)
+{
+    auto document = create_document("<!DOCTYPE html>"sv);
+    auto css = generate_stylesheet(5000);
+
+    for (size_t i = 0; i < 20; ++i) {
+        auto* style_sheet = Web::parse_css_stylesheet(Web::CSS::Parser::ParsingContext { *document }, css);
+        EXPECT_EQ(style_sheet->rules().length(), 5000u);
+    }
+}
+
+BENCHMARK_CASE(match_selectors)
+{
+    auto document = create_document(generate_document(50, 100));
+
+    Vector<NonnullRefPtr<Web::CSS::Selector>> selectors;
+    for (auto selector_text : { ".item"sv, "section > div.item"sv, "div.item:nth-child(3n + 1)"sv, "#item-4000 span"sv, "section:not(.hidden) .label"sv, "div[data-index=\"17\"] ~ div"sv, "body div span.label"sv, ":is(section, main) > .item:first-child"sv }) {
+        auto selector_list = Web::parse_selector(Web::CSS::Parser::ParsingContext { *document }, selector_text);
+        VERIFY(selector_list.has_value());
+        selectors.extend(selector_list.release_value());
+    }
+
+    size_t match_count = 0;
+    for (size_t i = 0; i < 20; ++i) {
+        document->for_each_in_subtree_of_type<Web::DOM::Element>([&](Web::DOM::Element const& element) {
+            for (auto const& selector : selectors) {
+                if (Web::SelectorEngine::matches(*selector, {}, element))
+                    ++match_count;
+            }
+            return TraversalDecision::Continue;
+        });
+    }
+    EXPECT(match_count > 0);
+}
+
+BENCHMARK_CASE(full_style_update)
+{
+    auto document = create_document(generate_document(50, 100, generate_stylesheet(1000)));
+
+    for (size_t i = 0; i < 20; ++i) {
+        document->set_needs_full_style_update(true);
+        document->update_style();
+    }
+}
+
+static void benchmark_layout(StringView html, size_t iterations)
+{
+    auto document = create_document(html);
+    for (size_t i = 0; i < iterations; ++i) {
+        document->set_needs_layout();
+        document->update_layout();
+    }
+    EXPECT(document->layout_node());
+}
+
+BENCHMARK_CASE(layout_block)
+{
+    StringBuilder builder;
+    builder.append("<!DOCTYPE html><body>"sv);
+    for (size_t i = 0; i < 2000; ++i)
+        builder.appendff("<div style=\"margin: {}px; padding: 4px; width: {}%\"><div style=\"height: 10px\"></div></div>", i % 10, 50 + i % 50);
+    benchmark_layout(builder.string_view(), 50);
+}
+
+BENCHMARK_CASE(layout_inline)
+{
+    StringBuilder builder;
+    builder.append("<!DOCTYPE html><body><p>"sv);
+    for (size_t i = 0; i < 5000; ++i)
+        builder.appendff("word{} <b>bold {}</b> <span style=\"font-size: {}px\">sized</span> ", i, i, 10 + i % 10);
+    builder.append("</p>"sv);
+    benchmark_layout(builder.string_view(), 20);
+}
+
+BENCHMARK_CASE(layout_flex)
+{
+    StringBuilder builder;
+    builder.append("<!DOCTYPE html><body>"sv);
+    for (size_t row = 0; row < 200; ++row) {
+        builder.append("<div style=\"display: flex; flex-wrap: wrap; gap: 4px\">"sv);
+        for (size_t item = 0; item < 20; ++item)
+            builder.appendff("<div style=\"flex: {} 1 {}px; min-width: 0\">item {}</div>", item % 3 + 1, 20 + item * 3, item);
+        builder.append("</div>"sv);
+    }
+    benchmark_layout(builder.string_view(), 20);
+}
+
+BENCHMARK_CASE(layout_grid)
+{
+    StringBuilder builder;
+    builder.append("<!DOCTYPE html><body>"sv);
+    for (size_t grid = 0; grid < 50; ++grid) {
+        builder.append("<div style=\"display: grid; grid-template-columns: repeat(auto-fill, minmax(80px, 1fr)); gap: 4px\">"sv);
+        for (size_t item = 0; item < 40; ++item)
+            builder.appendff("<div style=\"grid-column: span {}\">cell {}</div>", item % 3 + 1, item);
+        builder.append("</div>"sv);
+    }
+    benchmark_layout(builder.string_view(), 20);
+}
+
+BENCHMARK_CASE(layout_table)
+{
+    StringBuilder builder;
+    builder.append("<!DOCTYPE html><body><table style=\"border-collapse: collapse\">"sv);
+    for (size_t row = 0; row < 300; ++row) {
+        builder.append("<tr>"sv);
+        for (size_t column = 0; column < 10; ++column)
+            builder.appendff("<td style=\"border: 1px solid black\">{} x {}</td>", row, column);
+        builder.append("</tr>"sv);
+    }
+    builder.append("</table>"sv);
+    benchmark_layout(builder.string_view(), 20);
+}
+
+static String generate_painting_document()
+{
+    StringBuilder builder;
+    builder.append("<!DOCTYPE html><body>"sv);
+    for (size_t i = 0; i < 300; ++i) {
+        builder.appendff("<div style=\"display: inline-block; width: 60px; height: 30px; margin: 2px; background: hsl({}deg 60% 60%); border-radius: {}px; box-shadow: 0 1px 3px black; opacity: 0.{}\">{}</div>",
+            i % 360, i % 12, 5 + i % 5, i);
+    }
+    return MUST(builder.to_string());
+}
+
+BENCHMARK_CASE(record_display_list)
+{
+    auto document = create_document(generate_painting_document());
+
+    for (size_t i = 0; i < 200; ++i) {
+        Web::Painting::DisplayList display_list;
+        Web::Painting::DisplayListRecorder display_list_recorder(display_list);
+        document->navigable()->record_display_list(display_list_recorder, {});
+    }
+}
+
+template<typename Player>
+static void benchmark_display_list_playback(size_t iterations)
+{
+    auto document = create_document(generate_painting_document());
+
+    Web::Painting::DisplayList display_list;
+    Web::Painting::DisplayListRecorder display_list_recorder(display_list);
+    document->navigable()->record_display_list(display_list_recorder, {});
+
+    auto bitmap = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, viewport_size));
+    for (size_t i = 0; i < iterations; ++i) {
+        Player player(*bitmap);
+        display_list.execute(player);
+    }
+}
+
+BENCHMARK_CASE(play_display_list_cpu)
+{
+    benchmark_display_list_playback<Web::Painting::DisplayListPlayerCPU>(50);
+}
+
+BENCHMARK_CASE(play_display_list_skia)
+{
+    benchmark_display_list_playback<Web::Painting::DisplayListPlayerSkia>(50);
+}
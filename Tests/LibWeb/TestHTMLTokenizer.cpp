@@ -219,6 +219,21 @@ TEST_CASE(doctype)
     EXPECT_END_TAG_TOKEN(html, 23u, 27u);
 }
 
+TEST_CASE(newline_normalization)
+{
+    auto tokens = run_tokenizer("a\r\nb\rc\n\r"sv);
+    BEGIN_ENUMERATION(tokens);
+    EXPECT_CHARACTER_TOKEN('a');
+    EXPECT_CHARACTER_TOKEN('\n');
+    EXPECT_CHARACTER_TOKEN('b');
+    EXPECT_CHARACTER_TOKEN('\n');
+    EXPECT_CHARACTER_TOKEN('c');
+    EXPECT_CHARACTER_TOKEN('\n');
+    EXPECT_CHARACTER_TOKEN('\n');
+    EXPECT_END_OF_FILE_TOKEN();
+    END_ENUMERATION();
+}
+
 // NOTE: This relies on the format of HTMLToken::to_string() staying the same.
 //       If that changes, or something is added to the test HTML, the hash needs to be adjusted.
 TEST_CASE(regression)
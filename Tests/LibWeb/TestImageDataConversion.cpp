@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/Vector.h>
+#include <LibWeb/HTML/ImageData.h>
+
+TEST_CASE(swap_red_and_blue_channels)
+{
+    // Seven pixels, so both the vectorized loop and the scalar tail are exercised.
+    Vector<u32> bgra { 0xff112233, 0x80445566, 0x00778899, 0xffaabbcc, 0x01ddeeff, 0x7f000000, 0x12345678 };
+    Vector<u32> rgba;
+    rgba.resize(bgra.size());
+
+    Web::HTML::swap_red_and_blue_channels(bgra.span(), rgba.span());
+    EXPECT_EQ(rgba[0], 0xff332211u);
+    EXPECT_EQ(rgba[1], 0x80665544u);
+    EXPECT_EQ(rgba[2], 0x00998877u);
+    EXPECT_EQ(rgba[3], 0xffccbbaau);
+    EXPECT_EQ(rgba[4], 0x01ffeeddu);
+    EXPECT_EQ(rgba[5], 0x7f000000u);
+    EXPECT_EQ(rgba[6], 0x12785634u);
+
+    Vector<u32> round_trip;
+    round_trip.resize(rgba.size());
+    Web::HTML::swap_red_and_blue_channels(rgba.span(), round_trip.span());
+    EXPECT_EQ(round_trip, bgra);
+}
+
+BENCHMARK_CASE(swap_red_and_blue_channels_1080p)
+{
+    // One full-HD getImageData() or putImageData(), 100 times over.
+    Vector<u32> source;
+    source.resize(1920 * 1080);
+    for (size_t i = 0; i < source.size(); ++i)
+        source[i] = static_cast<u32>(i * 2654435761u);
+
+    Vector<u32> destination;
+    destination.resize(source.size());
+
+    for (size_t i = 0; i < 100; ++i)
+        Web::HTML::swap_red_and_blue_channels(source.span(), destination.span());
+
+    EXPECT_EQ(destination[1], (source[1] & 0xff00ff00) | ((source[1] & 0xff) << 16) | ((source[1] >> 16) & 0xff));
+}
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <LibCore/EventLoop.h>
+#include <LibWeb/DOMURL/DOMURL.h>
+#include <LibWeb/Loader/LoadRequest.h>
+#include <LibWeb/Loader/ResourceLoader.h>
+#include <LibWeb/Platform/EventLoopPluginSerenity.h>
+#include <LibWeb/WebSockets/WebSocket.h>
+
+class TestConnectorRequest final : public Web::ResourceLoaderConnectorRequest {
+public:
+    static NonnullRefPtr<TestConnectorRequest> create() { return adopt_ref(*new TestConnectorRequest); }
+
+    virtual void set_buffered_request_finished_callback(Protocol::Request::BufferedRequestFinished callback) override { m_on_finished = move(callback); }
+    virtual void set_unbuffered_request_callbacks(Protocol::Request::HeadersReceived, Protocol::Request::DataReceived, Protocol::Request::RequestFinished) override { VERIFY_NOT_REACHED(); }
+    virtual bool stop() override { return true; }
+
+    void finish(StringView body, HTTP::HeaderMap const& headers = {})
+    {
+        m_on_finished(true, body.length(), headers, 200, body.bytes());
+    }
+
+private:
+    TestConnectorRequest() = default;
+
+    Protocol::Request::BufferedRequestFinished m_on_finished;
+};
+
+class TestConnector final : public Web::ResourceLoaderConnector {
+public:
+    virtual void prefetch_dns(URL::URL const&) override { }
+    virtual void preconnect(URL::URL const&) override { }
+
+    virtual RefPtr<Web::ResourceLoaderConnectorRequest> start_request(ByteString const&, URL::URL const&, HTTP::HeaderMap const&, ReadonlyBytes, Core::ProxyData const&) override
+    {
+        auto request = TestConnectorRequest::create();
+        started_requests.append(request);
+        return request;
+    }
+
+    virtual RefPtr<Web::WebSockets::WebSocketClientSocket> websocket_connect(URL::URL const&, ByteString const&, Vector<ByteString> const&) override { return nullptr; }
+
+    Vector<NonnullRefPtr<TestConnectorRequest>> started_requests;
+};
+
+static TestConnector& connector()
+{
+    static Core::EventLoop s_event_loop;
+    static RefPtr<TestConnector> s_connector;
+    if (!s_connector) {
+        s_connector = adopt_ref(*new TestConnector);
+        Web::Platform::EventLoopPlugin::install(*new Web::Platform::EventLoopPluginSerenity);
+        Web::ResourceLoader::initialize(s_connector);
+    }
+    return *s_connector;
+}
+
+static void run_deferred_invocations()
+{
+    Core::EventLoop::current().pump(Core::EventLoop::WaitMode::PollForEvents);
+}
+
+static Web::HTML::Origin origin_of(StringView url)
+{
+    return Web::DOMURL::url_origin(URL::URL { url });
+}
+
+static void prefetch(StringView url, StringView initiator, StringView body, HTTP::HeaderMap const& headers = {})
+{
+    auto request_count = connector().started_requests.size();
+
+    Web::LoadRequest request;
+    request.set_url(URL::URL { url });
+    request.set_initiator_origin(origin_of(initiator));
+    Web::ResourceLoader::the().prefetch(request);
+
+    EXPECT_EQ(connector().started_requests.size(), request_count + 1);
+    connector().started_requests.last()->finish(body, headers);
+    run_deferred_invocations();
+}
+
+struct LoadResult {
+    bool went_to_network { false };
+    ByteString body;
+};
+
+static LoadResult load(StringView url, StringView initiator, bool is_navigation = true, bool may_use_stored_response = true)
+{
+    auto request_count = connector().started_requests.size();
+
+    Web::LoadRequest request;
+    request.set_url(URL::URL { url });
+    request.set_initiator_origin(origin_of(initiator));
+    request.set_navigation_request(is_navigation);
+    request.set_may_use_stored_response(may_use_stored_response);
+
+    LoadResult result;
+    Web::ResourceLoader::the().load(request, [&](ReadonlyBytes data, auto&, auto) { result.body = StringView { data }; });
+
+    if (connector().started_requests.size() > request_count) {
+        result.went_to_network = true;
+        connector().started_requests.last()->finish("network"sv);
+    }
+    run_deferred_invocations();
+    return result;
+}
+
+TEST_CASE(navigation_uses_prefetched_response_once)
+{
+    prefetch("https://example.com/once"sv, "https://example.com/"sv, "prefetched"sv);
+
+    auto first = load("https://example.com/once"sv, "https://example.com/"sv);
+    EXPECT(!first.went_to_network);
+    EXPECT_EQ(first.body, "prefetched"sv);
+
+    auto second = load("https://example.com/once"sv, "https://example.com/"sv);
+    EXPECT(second.went_to_network);
+    EXPECT_EQ(second.body, "network"sv);
+}
+
+TEST_CASE(navigation_from_another_origin_does_not_use_prefetched_response)
+{
+    prefetch("https://example.com/cross-site"sv, "https://example.com/"sv, "prefetched"sv);
+
+    auto cross_site = load("https://example.com/cross-site"sv, "https://other.example/"sv);
+    EXPECT(cross_site.went_to_network);
+    EXPECT_EQ(cross_site.body, "network"sv);
+
+    // The response is still there for the origin that prefetched it.
+    auto same_site = load("https://example.com/cross-site"sv, "https://example.com/"sv);
+    EXPECT(!same_site.went_to_network);
+    EXPECT_EQ(same_site.body, "prefetched"sv);
+}
+
+TEST_CASE(non_navigation_requests_do_not_use_prefetched_response)
+{
+    prefetch("https://example.com/fetch"sv, "https://example.com/"sv, "prefetched"sv);
+
+    auto fetch = load("https://example.com/fetch"sv, "https://example.com/"sv, false);
+    EXPECT(fetch.went_to_network);
+    EXPECT_EQ(fetch.body, "network"sv);
+
+    auto navigation = load("https://example.com/fetch"sv, "https://example.com/"sv);
+    EXPECT(!navigation.went_to_network);
+    EXPECT_EQ(navigation.body, "prefetched"sv);
+}
+
+TEST_CASE(requests_that_bypass_stored_responses_drop_prefetched_response)
+{
+    prefetch("https://example.com/reload"sv, "https://example.com/"sv, "prefetched"sv);
+
+    auto reload = load("https://example.com/reload"sv, "https://example.com/"sv, true, false);
+    EXPECT(reload.went_to_network);
+    EXPECT_EQ(reload.body, "network"sv);
+
+    auto navigation = load("https://example.com/reload"sv, "https://example.com/"sv);
+    EXPECT(navigation.went_to_network);
+}
+
+TEST_CASE(no_store_responses_are_not_kept)
+{
+    HTTP::HeaderMap headers;
+    headers.set("Cache-Control"sv, "no-store"sv);
+    prefetch("https://example.com/no-store"sv, "https://example.com/"sv, "prefetched"sv, headers);
+
+    auto navigation = load("https://example.com/no-store"sv, "https://example.com/"sv);
+    EXPECT(navigation.went_to_network);
+    EXPECT_EQ(navigation.body, "network"sv);
+}
+
+TEST_CASE(prefetch_without_initiator_origin_is_ignored)
+{
+    auto request_count = connector().started_requests.size();
+
+    Web::LoadRequest request;
+    request.set_url(URL::URL { "https://example.com/no-initiator"sv });
+    Web::ResourceLoader::the().prefetch(request);
+
+    EXPECT_EQ(connector().started_requests.size(), request_count);
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <LibWeb/HTML/Scripting/SpeculationRules.h>
+
+static URL::URL const base_url { "https://example.com/dir/page.html"sv };
+
+TEST_CASE(list_rules)
+{
+    auto rule_set = Web::HTML::parse_speculation_rule_set_string(R"~~~({
+        "prefetch": [{ "source": "list", "urls": ["next.html", "/other.html", "https://example.org/elsewhere"] }],
+        "prerender": [{ "urls": ["#fragment"] }]
+    })~~~"sv,
+        base_url);
+    EXPECT(rule_set.has_value());
+
+    EXPECT_EQ(rule_set->prefetch_rules.size(), 1u);
+    auto const& prefetch_urls = rule_set->prefetch_rules[0].urls;
+    EXPECT_EQ(prefetch_urls.size(), 3u);
+    EXPECT_EQ(prefetch_urls[0].serialize(), "https://example.com/dir/next.html"sv);
+    EXPECT_EQ(prefetch_urls[1].serialize(), "https://example.com/other.html"sv);
+    EXPECT_EQ(prefetch_urls[2].serialize(), "https://example.org/elsewhere"sv);
+
+    EXPECT_EQ(rule_set->prerender_rules.size(), 1u);
+    EXPECT_EQ(rule_set->prerender_rules[0].urls.size(), 1u);
+    EXPECT_EQ(rule_set->prerender_rules[0].urls[0].serialize(), "https://example.com/dir/page.html#fragment"sv);
+}
+
+TEST_CASE(invalid_top_level_value)
+{
+    EXPECT(!Web::HTML::parse_speculation_rule_set_string("not json"sv, base_url).has_value());
+    EXPECT(!Web::HTML::parse_speculation_rule_set_string("[]"sv, base_url).has_value());
+    EXPECT(!Web::HTML::parse_speculation_rule_set_string("\"prefetch\""sv, base_url).has_value());
+
+    auto empty = Web::HTML::parse_speculation_rule_set_string("{}"sv, base_url);
+    EXPECT(empty.has_value());
+    EXPECT(empty->prefetch_rules.is_empty());
+    EXPECT(empty->prerender_rules.is_empty());
+}
+
+TEST_CASE(document_rules_are_skipped)
+{
+    auto rule_set = Web::HTML::parse_speculation_rule_set_string(R"~~~({
+        "prefetch": [
+            { "source": "document", "where": { "href_matches": "/*" } },
+            { "where": { "selector_matches": "a" } },
+            { "source": "list", "urls": ["kept.html"] }
+        ]
+    })~~~"sv,
+        base_url);
+    EXPECT(rule_set.has_value());
+    EXPECT_EQ(rule_set->prefetch_rules.size(), 1u);
+    EXPECT_EQ(rule_set->prefetch_rules[0].urls[0].serialize(), "https://example.com/dir/kept.html"sv);
+}
+
+TEST_CASE(malformed_rules_and_urls_are_skipped)
+{
+    auto rule_set = Web::HTML::parse_speculation_rule_set_string(R"~~~({
+        "prefetch": [
+            "next.html",
+            { "urls": "next.html" },
+            { "urls": [42, null, "http://[invalid", "data:text/html,hi", "javascript:void(0)", "ok.html"] }
+        ],
+        "prerender": { "urls": ["not-a-list.html"] }
+    })~~~"sv,
+        base_url);
+    EXPECT(rule_set.has_value());
+    EXPECT_EQ(rule_set->prefetch_rules.size(), 1u);
+    EXPECT_EQ(rule_set->prefetch_rules[0].urls.size(), 1u);
+    EXPECT_EQ(rule_set->prefetch_rules[0].urls[0].serialize(), "https://example.com/dir/ok.html"sv);
+    EXPECT(rule_set->prerender_rules.is_empty());
+}
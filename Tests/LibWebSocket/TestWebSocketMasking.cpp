@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Array.h>
+#include <AK/ByteBuffer.h>
+#include <LibTest/TestCase.h>
+#include <LibWebSocket/Masking.h>
+
+TEST_CASE(rfc6455_masked_text_frame)
+{
+    // Section 5.7 of RFC 6455: A single-frame masked text message containing "Hello".
+    static constexpr u8 masking_key[4] = { 0x37, 0xfa, 0x21, 0x3d };
+    static constexpr Array<u8, 5> masked_payload { 0x7f, 0x9f, 0x4d, 0x51, 0x58 };
+
+    Array<u8, 5> payload {};
+    WebSocket::apply_masking_key(payload.span(), masked_payload.span(), masking_key);
+    EXPECT_EQ(StringView { payload.span() }, "Hello"sv);
+
+    Array<u8, 5> remasked_payload {};
+    WebSocket::apply_masking_key(remasked_payload.span(), payload.span(), masking_key);
+    EXPECT_EQ(remasked_payload, masked_payload);
+}
+
+TEST_CASE(matches_bytewise_masking_for_every_length)
+{
+    static constexpr u8 masking_key[4] = { 0x01, 0x80, 0xfe, 0x5a };
+
+    auto source = MUST(ByteBuffer::create_uninitialized(67));
+    for (size_t i = 0; i < source.size(); ++i)
+        source[i] = static_cast<u8>(i * 7);
+
+    for (size_t length = 0; length <= source.size(); ++length) {
+        auto destination = MUST(ByteBuffer::create_zeroed(length));
+        WebSocket::apply_masking_key(destination.bytes(), source.bytes().trim(length), masking_key);
+
+        for (size_t i = 0; i < length; ++i)
+            EXPECT_EQ(destination[i], static_cast<u8>(source[i] ^ masking_key[i % 4]));
+    }
+}
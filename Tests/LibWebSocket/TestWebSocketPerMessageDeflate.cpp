@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Array.h>
+#include <AK/ByteBuffer.h>
+#include <AK/ByteString.h>
+#include <LibTest/TestCase.h>
+#include <LibWebSocket/PerMessageDeflate.h>
+
+static ByteBuffer decompress(ReadonlyBytes payload, ReadonlyBytes window = {})
+{
+    return MUST(WebSocket::decompress_message_payload(payload, window));
+}
+
+static ByteString decompress_to_string(ReadonlyBytes payload, ReadonlyBytes window = {})
+{
+    return ByteString { decompress(payload, window).bytes() };
+}
+
+static Optional<WebSocket::PerMessageDeflateParameters> parse(StringView response)
+{
+    auto parameters = response.split_view(';');
+    return WebSocket::parse_per_message_deflate_response(parameters);
+}
+
+// Section 7.2.3 of RFC 7692: Examples
+
+TEST_CASE(rfc7692_a_message_compressed_using_1_compressed_deflate_block)
+{
+    static constexpr Array<u8, 7> payload { 0xf2, 0x48, 0xcd, 0xc9, 0xc9, 0x07, 0x00 };
+    EXPECT_EQ(decompress_to_string(payload), "Hello"sv);
+}
+
+TEST_CASE(rfc7692_sharing_lz77_sliding_window)
+{
+    static constexpr Array<u8, 7> first_payload { 0xf2, 0x48, 0xcd, 0xc9, 0xc9, 0x07, 0x00 };
+    static constexpr Array<u8, 5> second_payload { 0xf2, 0x00, 0x11, 0x00, 0x00 };
+
+    auto first_message = decompress(first_payload);
+    EXPECT_EQ(first_message.bytes(), "Hello"sv.bytes());
+
+    // The second message only refers back to the first one.
+    EXPECT_EQ(decompress_to_string(second_payload, first_message), "Hello"sv);
+    EXPECT(WebSocket::decompress_message_payload(second_payload).is_error());
+}
+
+TEST_CASE(rfc7692_deflate_block_with_no_compression)
+{
+    static constexpr Array<u8, 11> payload { 0x00, 0x05, 0x00, 0xfa, 0xff, 0x48, 0x65, 0x6c, 0x6c, 0x6f, 0x00 };
+    EXPECT_EQ(decompress_to_string(payload), "Hello"sv);
+}
+
+TEST_CASE(rfc7692_deflate_block_with_bfinal_set_to_1)
+{
+    static constexpr Array<u8, 8> payload { 0xf3, 0x48, 0xcd, 0xc9, 0xc9, 0x07, 0x00, 0x00 };
+    EXPECT_EQ(decompress_to_string(payload), "Hello"sv);
+}
+
+TEST_CASE(rfc7692_two_deflate_blocks_in_1_message)
+{
+    static constexpr Array<u8, 13> payload { 0xf2, 0x48, 0x05, 0x00, 0x00, 0x00, 0xff, 0xff, 0xca, 0xc9, 0xc9, 0x07, 0x00 };
+    EXPECT_EQ(decompress_to_string(payload), "Hello"sv);
+}
+
+TEST_CASE(compressed_messages_round_trip)
+{
+    auto message = MUST(ByteBuffer::create_uninitialized(100 * KiB));
+    for (size_t i = 0; i < message.size(); ++i)
+        message[i] = static_cast<u8>("permessage-deflate"sv[i % 18] + (i / 1000));
+
+    auto compressed = TRY_OR_FAIL(WebSocket::compress_message_payload(message));
+    EXPECT(compressed.size() < message.size());
+    EXPECT_EQ(decompress(compressed), message);
+
+    // Every message is compressed on its own, so it doesn't matter what came before it.
+    auto window = MUST(ByteBuffer::create_zeroed(WebSocket::per_message_deflate_max_window_size));
+    EXPECT_EQ(decompress(compressed, window), message);
+
+    auto empty_compressed = TRY_OR_FAIL(WebSocket::compress_message_payload({}));
+    EXPECT(decompress(empty_compressed).is_empty());
+}
+
+TEST_CASE(accepts_responses_to_our_offer)
+{
+    auto parameters = parse("client_no_context_takeover; server_no_context_takeover"sv);
+    EXPECT(parameters.has_value());
+    EXPECT(parameters->server_no_context_takeover);
+
+    parameters = parse("server_no_context_takeover; server_max_window_bits=10"sv);
+    EXPECT(parameters.has_value());
+    EXPECT(parameters->server_no_context_takeover);
+
+    parameters = parse("server_max_window_bits=\"15\""sv);
+    EXPECT(parameters.has_value());
+    EXPECT(!parameters->server_no_context_takeover);
+
+    parameters = parse(""sv);
+    EXPECT(parameters.has_value());
+    EXPECT(!parameters->server_no_context_takeover);
+}
+
+TEST_CASE(accepts_responses_that_keep_the_server_context)
+{
+    // The server is free to decline server_no_context_takeover, we then keep its sliding window around.
+    auto parameters = parse("client_no_context_takeover"sv);
+    EXPECT(parameters.has_value());
+    EXPECT(!parameters->server_no_context_takeover);
+}
+
+TEST_CASE(rejects_invalid_responses)
+{
+    EXPECT(!parse("client_max_window_bits=10"sv).has_value());
+    EXPECT(!parse("server_max_window_bits"sv).has_value());
+    EXPECT(!parse("server_max_window_bits=7"sv).has_value());
+    EXPECT(!parse("server_max_window_bits=16"sv).has_value());
+    EXPECT(!parse("server_no_context_takeover; server_no_context_takeover"sv).has_value());
+    EXPECT(!parse("server_no_context_takeover=1"sv).has_value());
+    EXPECT(!parse("unknown_parameter"sv).has_value());
+}
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+#include <LibWeb/HTML/StorageBottle.h>
+#include <LibWebView/StorageJar.h>
+
+static String origin()
+{
+    return "https://example.com"_string;
+}
+
+// Mimics how a WebContent process uses the jar: it applies its own changes to its copy right away and sends them to the
+// jar, which answers every process with the change it actually made. Those answers are only received later.
+struct WebContentProcess {
+    void set_item(WebView::StorageJar& jar, String const& key, String const& value)
+    {
+        items.set(key, value);
+        pending_requests.append([&jar, key, value] { return jar.set_local_storage_item(origin(), key, value); });
+    }
+
+    void remove_item(WebView::StorageJar& jar, String const& key)
+    {
+        items.remove(key);
+        pending_requests.append([&jar, key] { return jar.remove_local_storage_item(origin(), key); });
+    }
+
+    void receive_changes()
+    {
+        for (auto const& change : received_changes) {
+            if (!change.key.has_value())
+                items.clear();
+            else if (!change.value.has_value())
+                items.remove(*change.key);
+            else
+                items.set(*change.key, *change.value);
+        }
+        received_changes.clear();
+    }
+
+    WebView::StorageJar::Items items;
+    Vector<Function<WebView::LocalStorageChange()>> pending_requests;
+    Vector<WebView::LocalStorageChange> received_changes;
+};
+
+// Delivers the requests of both processes to the jar, alternating between them, and broadcasts every resulting change.
+static void deliver_requests(WebContentProcess& first, WebContentProcess& second)
+{
+    for (size_t i = 0; i < max(first.pending_requests.size(), second.pending_requests.size()); ++i) {
+        for (auto* process : { &first, &second }) {
+            if (i >= process->pending_requests.size())
+                continue;
+
+            auto change = process->pending_requests[i]();
+            first.received_changes.append(change);
+            second.received_changes.append(change);
+        }
+    }
+
+    first.pending_requests.clear();
+    second.pending_requests.clear();
+}
+
+static void expect_same_items(WebView::StorageJar::Items const& items, WebView::StorageJar::Items const& expected_items)
+{
+    EXPECT_EQ(items.size(), expected_items.size());
+
+    for (auto const& it : expected_items) {
+        auto value = items.get(it.key);
+        EXPECT(value.has_value());
+        if (value.has_value())
+            EXPECT_EQ(*value, it.value);
+    }
+}
+
+TEST_CASE(concurrent_writes_from_two_processes_converge)
+{
+    auto jar = WebView::StorageJar::create();
+
+    WebContentProcess first;
+    WebContentProcess second;
+    first.items = jar->local_storage_items(origin());
+    second.items = jar->local_storage_items(origin());
+
+    first.set_item(*jar, "shared"_string, "first"_string);
+    first.set_item(*jar, "only-first"_string, "1"_string);
+    second.set_item(*jar, "shared"_string, "second"_string);
+    second.remove_item(*jar, "only-first"_string);
+
+    // Before they hear from the jar, each process only sees its own writes.
+    EXPECT_EQ(first.items.get("shared"sv), "first"_string);
+    EXPECT_EQ(second.items.get("shared"sv), "second"_string);
+
+    deliver_requests(first, second);
+    first.receive_changes();
+    second.receive_changes();
+
+    // The jar received the second process's write last, and both processes agree with it.
+    EXPECT_EQ(jar->local_storage_items(origin()).get("shared"sv), "second"_string);
+    expect_same_items(first.items, jar->local_storage_items(origin()));
+    expect_same_items(second.items, jar->local_storage_items(origin()));
+}
+
+TEST_CASE(writes_beyond_the_quota_are_refused)
+{
+    auto jar = WebView::StorageJar::create();
+
+    WebContentProcess first;
+    WebContentProcess second;
+
+    // Each process's copy still has room for its own item, but the jar doesn't have room for both.
+    auto large_value = MUST(String::repeated('a', Web::HTML::StorageBottle::quota / 2 + 1));
+    first.set_item(*jar, "a"_string, large_value);
+    second.set_item(*jar, "b"_string, large_value);
+
+    deliver_requests(first, second);
+    first.receive_changes();
+    second.receive_changes();
+
+    EXPECT(jar->local_storage_items(origin()).contains("a"sv));
+    EXPECT(!jar->local_storage_items(origin()).contains("b"sv));
+    expect_same_items(first.items, jar->local_storage_items(origin()));
+    expect_same_items(second.items, jar->local_storage_items(origin()));
+}
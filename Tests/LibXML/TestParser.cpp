@@ -41,3 +41,28 @@ TEST_CASE(predefined_character_reference)
     auto const& content = node.children[0]->content.get<XML::Node::Text>();
     EXPECT_EQ(content.builder.string_view(), "Well hello &, <, >, ', and \"!");
 }
+
+TEST_CASE(parse_with_listener)
+{
+    struct RecordingListener : public XML::Listener {
+        void element_start(XML::Name const& name, HashMap<XML::Name, ByteString> const& attributes) override
+        {
+            events.append(ByteString::formatted("<{} value={}>", name, attributes.get("value"sv).value_or({})));
+        }
+        void element_end(XML::Name const& name) override { events.append(ByteString::formatted("</{}>", name)); }
+        void text(StringView text) override
+        {
+            if (!text.is_empty())
+                events.append(text);
+        }
+
+        Vector<ByteString> events;
+    };
+
+    XML::Parser parser("<a value='x &amp; y'><b value=\"1\"/>one<b>two</b>three</a>"sv);
+    RecordingListener listener;
+    MUST(parser.parse_with_listener(listener));
+
+    Vector<ByteString> expected { "<a value=x & y>", "<b value=1>", "</b>", "one", "<b value=>", "two", "</b>", "three", "</a>" };
+    EXPECT_EQ(listener.events, expected);
+}
@@ -809,7 +809,34 @@ ErrorOr<void, LoaderError> FlacLoaderPlugin::decode_custom_lpc(Vector<i64>& deco
     TRY(decode_residual(decoded, subframe, bit_input));
 
     // approximate the waveform with the predictor
-    for (size_t i = subframe.order; i < m_current_frame->sample_count; ++i) {
+    size_t first_unrestored_sample = subframe.order;
+
+    // OPTIMIZATION: Coefficients are at most 15 bits and samples at most 33 bits, so the sum of up to 32 of their products
+    //               can't overflow 64 bits as long as every restored sample stays within the subframe's bit depth.
+    //               This lets us skip the saturating arithmetic below for all valid streams, and walking the history
+    //               forwards lets the compiler vectorize the prediction.
+    if (lpc_shift >= 0) {
+        Vector<i64, 32> reversed_coefficients;
+        reversed_coefficients.ensure_capacity(subframe.order);
+        for (size_t t = subframe.order; t > 0; --t)
+            reversed_coefficients.unchecked_append(coefficients[t - 1]);
+
+        i64 const sample_limit = static_cast<i64>(1) << (subframe.bits_per_sample - 1);
+        for (; first_unrestored_sample < m_current_frame->sample_count; ++first_unrestored_sample) {
+            auto const* history = decoded.data() + first_unrestored_sample - subframe.order;
+            i64 prediction = 0;
+            for (size_t t = 0; t < subframe.order; ++t)
+                prediction += reversed_coefficients[t] * history[t];
+
+            Checked<i64> sample = decoded[first_unrestored_sample];
+            sample += prediction >> lpc_shift;
+            if (sample.has_overflow() || sample.value() < -sample_limit || sample.value() >= sample_limit)
+                break;
+            decoded[first_unrestored_sample] = sample.value();
+        }
+    }
+
+    for (size_t i = first_unrestored_sample; i < m_current_frame->sample_count; ++i) {
         // (see below)
         Checked<i64> sample = 0;
         for (size_t t = 0; t < subframe.order; ++t) {
@@ -8,18 +8,20 @@
 
 #include <AK/Array.h>
 #include <AK/Math.h>
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
 #include <AK/Span.h>
 
 namespace DSP {
 
 template<size_t N>
-requires(N % 2 == 0) class MDCT {
+requires(N % 4 == 0) class MDCT {
 public:
     constexpr MDCT()
     {
         for (size_t n = 0; n < N; n++) {
             for (size_t k = 0; k < N / 2; k++) {
-                m_phi[n][k] = AK::cos<float>(AK::Pi<float> / (2 * N) * (2 * static_cast<float>(n) + 1 + N / 2.0f) * static_cast<float>(2 * k + 1));
+                m_phi[k][n] = AK::cos<float>(AK::Pi<float> / (2 * N) * (2 * static_cast<float>(n) + 1 + N / 2.0f) * static_cast<float>(2 * k + 1));
             }
         }
     }
@@ -28,16 +30,23 @@ public:
     {
         VERIFY(N == 2 * data.size());
         VERIFY(N == output.size());
-        for (size_t n = 0; n < N; n++) {
-            output[n] = 0;
-            for (size_t k = 0; k < N / 2; k++) {
-                output[n] += data[k] * m_phi[n][k];
+
+        // OPTIMIZATION: The basis functions are stored by input coefficient, so that each input coefficient
+        //               can be accumulated into four consecutive outputs at a time.
+        Array<AK::SIMD::f32x4, N / 4> accumulators {};
+        for (size_t k = 0; k < N / 2; k++) {
+            auto coefficient = AK::SIMD::expand4(data[k]);
+            for (size_t n = 0; n < N / 4; n++) {
+                AK::SIMD::f32x4 phi;
+                __builtin_memcpy(&phi, m_phi[k].data() + n * 4, sizeof(phi));
+                accumulators[n] += coefficient * phi;
             }
         }
+        __builtin_memcpy(output.data(), accumulators.data(), N * sizeof(float));
     }
 
 private:
-    Array<Array<float, N / 2>, N> m_phi;
+    Array<Array<float, N>, N / 2> m_phi;
 };
 
 }
@@ -10,6 +10,7 @@
 #include "MP3Types.h"
 #include <AK/Endian.h>
 #include <AK/FixedArray.h>
+#include <AK/SIMD.h>
 #include <LibCore/File.h>
 
 namespace Audio {
@@ -829,36 +830,34 @@ void MP3LoaderPlugin::transform_samples_to_time(Array<float, MP3::granule_size>
 // ISO/IEC 11172-3 (Figure A.2)
 void MP3LoaderPlugin::synthesis(Array<float, 1024>& V, Array<float, 32>& samples, Array<float, 32>& result)
 {
-    for (size_t i = 1023; i >= 64; i--) {
-        V[i] = V[i - 64];
-    }
-
-    for (size_t i = 0; i < 64; i++) {
-        V[i] = 0;
-        for (size_t k = 0; k < 32; k++) {
-            float const N = MP3::Tables::SynthesisSubbandFilterCoefficients[i][k];
-            V[i] += N * samples[k];
-        }
-    }
+    using AK::SIMD::f32x4;
 
-    Array<float, 512> U;
-    for (size_t i = 0; i < 8; i++) {
-        for (size_t j = 0; j < 32; j++) {
-            U[i * 64 + j] = V[i * 128 + j];
-            U[i * 64 + 32 + j] = V[i * 128 + 96 + j];
-        }
-    }
+    auto load = [](float const* data) {
+        f32x4 vector;
+        __builtin_memcpy(&vector, data, sizeof(vector));
+        return vector;
+    };
 
-    Array<float, 512> W;
-    for (size_t i = 0; i < 512; i++) {
-        W[i] = U[i] * MP3::Tables::WindowSynthesis[i];
-    }
+    __builtin_memmove(V.data() + 64, V.data(), (V.size() - 64) * sizeof(float));
 
-    for (size_t j = 0; j < 32; j++) {
-        result[j] = 0;
+    for (size_t i = 0; i < 64; i++) {
+        auto const& N = MP3::Tables::SynthesisSubbandFilterCoefficients[i];
+        f32x4 sum {};
+        for (size_t k = 0; k < 32; k += 4)
+            sum += load(N.data() + k) * load(samples.data() + k);
+        V[i] = sum[0] + sum[1] + sum[2] + sum[3];
+    }
+
+    // OPTIMIZATION: The vectors U and W from the standard are never built. The windowed sum of each
+    //               output sample reads the 16 values of V that end up in U directly:
+    //               U[32 * k + j] is V[64 * k + j] for even k, and V[64 * k + 32 + j] for odd k.
+    for (size_t j = 0; j < 32; j += 4) {
+        f32x4 sum {};
         for (size_t k = 0; k < 16; k++) {
-            result[j] += W[j + 32 * k];
+            auto u = load(V.data() + 64 * k + (k % 2) * 32 + j);
+            sum += u * load(MP3::Tables::WindowSynthesis.data() + 32 * k + j);
         }
+        __builtin_memcpy(result.data() + j, &sum, sizeof(sum));
     }
 }
 
@@ -4,25 +4,42 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
-#include <AK/BinarySearch.h>
+#include <AK/IntegralMath.h>
 #include <AK/QuickSort.h>
 #include <LibCompress/Brotli.h>
 #include <LibCompress/BrotliDictionary.h>
 
 namespace Compress {
 
-ErrorOr<size_t> Brotli::CanonicalCode::read_symbol(LittleEndianInputBitStream& input_stream) const
+void Brotli::CanonicalCode::compute_code_length_counts()
 {
-    size_t code_bits = 1;
-
-    while (code_bits < (1 << 16)) {
-        // FIXME: This is very inefficient and could greatly be improved by implementing this
-        //        algorithm: https://www.hanshq.net/zip.html#huffdec
-        size_t index;
-        if (binary_search(m_symbol_codes.span(), code_bits, &index))
-            return m_symbol_values[index];
+    m_code_length_counts.fill(0);
+    for (auto code : m_symbol_codes) {
+        auto length = AK::log2(code);
+        VERIFY(length < m_code_length_counts.size());
+        m_code_length_counts[length]++;
+    }
+}
 
-        code_bits = (code_bits << 1) | TRY(input_stream.read_bit());
+ErrorOr<size_t> Brotli::CanonicalCode::read_symbol(LittleEndianInputBitStream& input_stream) const
+{
+    // Since the codes are canonical, all codes of one length are consecutive and start right after the last code of
+    // the previous length (shifted by one), so we only have to check whether the bits read so far fall into that range.
+    // See https://www.hanshq.net/zip.html#huffdec
+    size_t code = 0;
+    size_t first_code = 0;
+    size_t first_index = 0;
+
+    for (size_t length = 0; length < m_code_length_counts.size(); ++length) {
+        if (length != 0)
+            code = (code << 1) | TRY(input_stream.read_bit());
+
+        size_t count = m_code_length_counts[length];
+        if (code - first_code < count)
+            return m_symbol_values[first_index + code - first_code];
+
+        first_index += count;
+        first_code = (first_code + count) << 1;
     }
 
     return Error::from_string_literal("no matching code found");
@@ -227,6 +244,7 @@ ErrorOr<Brotli::CanonicalCode> Brotli::CanonicalCode::read_simple_prefix_code(Li
         }
     }
 
+    code.compute_code_length_counts();
     return code;
 }
 
@@ -286,6 +304,8 @@ ErrorOr<Brotli::CanonicalCode> Brotli::CanonicalCode::read_complex_prefix_code(L
         }
     }
 
+    temp_code.compute_code_length_counts();
+
     // Read the actual prefix code_value
     sum = 0;
     size_t i = 0;
@@ -381,6 +401,7 @@ ErrorOr<Brotli::CanonicalCode> Brotli::CanonicalCode::read_complex_prefix_code(L
         }
     }
 
+    final_code.compute_code_length_counts();
     return final_code;
 }
 
@@ -906,13 +927,20 @@ ErrorOr<Bytes> BrotliDecompressionStream::read_some(Bytes output_buffer)
                 m_current_state = State::CompressedCopy;
             }
         } else if (m_current_state == State::CompressedCopy) {
-            u8 copy_value = m_lookback_buffer.value().lookback(m_distance);
+            // OPTIMIZATION: Copy as much of the match as fits into the output buffer in one go, instead of going
+            //               through the state machine for every single byte.
+            size_t number_of_bytes_to_copy = min(min(m_copy_length, m_bytes_left), output_buffer.size() - bytes_read);
+            auto& lookback_buffer = m_lookback_buffer.value();
+
+            for (size_t i = 0; i < number_of_bytes_to_copy; i++) {
+                u8 copy_value = lookback_buffer.lookback(m_distance);
+                output_buffer[bytes_read + i] = copy_value;
+                lookback_buffer.write(copy_value);
+            }
 
-            output_buffer[bytes_read] = copy_value;
-            m_lookback_buffer.value().write(copy_value);
-            bytes_read++;
-            m_copy_length--;
-            m_bytes_left--;
+            bytes_read += number_of_bytes_to_copy;
+            m_copy_length -= number_of_bytes_to_copy;
+            m_bytes_left -= number_of_bytes_to_copy;
 
             if (m_bytes_left == 0)
                 m_current_state = State::Idle;
@@ -920,13 +948,16 @@ ErrorOr<Bytes> BrotliDecompressionStream::read_some(Bytes output_buffer)
                 m_current_state = State::CompressedCommand;
         } else if (m_current_state == State::CompressedDictionary) {
             size_t offset = m_dictionary_data.size() - m_copy_length;
-            u8 dictionary_value = m_dictionary_data[offset];
+            size_t number_of_bytes_to_copy = min(min(m_copy_length, m_bytes_left), output_buffer.size() - bytes_read);
+            auto dictionary_bytes = m_dictionary_data.bytes().slice(offset, number_of_bytes_to_copy);
 
-            output_buffer[bytes_read] = dictionary_value;
-            m_lookback_buffer.value().write(dictionary_value);
-            bytes_read++;
-            m_copy_length--;
-            m_bytes_left--;
+            dictionary_bytes.copy_to(output_buffer.slice(bytes_read));
+            for (auto dictionary_value : dictionary_bytes)
+                m_lookback_buffer.value().write(dictionary_value);
+
+            bytes_read += number_of_bytes_to_copy;
+            m_copy_length -= number_of_bytes_to_copy;
+            m_bytes_left -= number_of_bytes_to_copy;
 
             if (m_bytes_left == 0)
                 m_current_state = State::Idle;
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Array.h>
 #include <AK/BitStream.h>
 #include <AK/CircularQueue.h>
 #include <AK/FixedArray.h>
@@ -20,7 +21,10 @@ public:
     CanonicalCode() = default;
     CanonicalCode(Vector<size_t> codes, Vector<size_t> values)
         : m_symbol_codes(move(codes))
-        , m_symbol_values(move(values)) {};
+        , m_symbol_values(move(values))
+    {
+        compute_code_length_counts();
+    }
 
     static ErrorOr<CanonicalCode> read_prefix_code(LittleEndianInputBitStream&, size_t alphabet_size);
     static ErrorOr<CanonicalCode> read_simple_prefix_code(LittleEndianInputBitStream&, size_t alphabet_size);
@@ -31,8 +35,14 @@ public:
 private:
     static ErrorOr<size_t> read_complex_prefix_code_length(LittleEndianInputBitStream&);
 
+    void compute_code_length_counts();
+
+    // Codes are stored with a leading 1 bit marking their length, sorted by length and then by code.
     Vector<size_t> m_symbol_codes;
     Vector<size_t> m_symbol_values;
+
+    // The number of codes of each length, including the zero-length code of a single-symbol prefix code.
+    Array<u16, 16> m_code_length_counts {};
 };
 
 }
@@ -80,7 +90,8 @@ public:
         void write(u8 value)
         {
             m_buffer[m_offset] = value;
-            m_offset = (m_offset + 1) % m_buffer.size();
+            if (++m_offset == m_buffer.size())
+                m_offset = 0;
             m_total_written++;
         }
 
@@ -8,6 +8,9 @@
 #include <AK/Array.h>
 #include <AK/Assertions.h>
 #include <AK/BinarySearch.h>
+#include <AK/BuiltinWrappers.h>
+#include <AK/ByteReader.h>
+#include <AK/Endian.h>
 #include <AK/MemoryStream.h>
 #include <string.h>
 
@@ -309,7 +312,15 @@ ErrorOr<Bytes> DeflateDecompressor::read_some(Bytes bytes)
         if (m_state == State::ReadingCompressedBlock) {
             auto nread = m_output_buffer.read(slice).size();
 
-            while (nread < slice.size() && TRY(m_compressed_block.try_read_more())) {
+            // OPTIMIZATION: Decode as many symbols as the caller still needs (and the output buffer has room for) before
+            //               draining the output buffer, instead of draining it after every single symbol.
+            bool block_has_more_symbols = true;
+            while (nread < slice.size() && block_has_more_symbols) {
+                while (m_output_buffer.used_space() < slice.size() - nread && m_output_buffer.empty_space() >= max_back_reference_length) {
+                    block_has_more_symbols = TRY(m_compressed_block.try_read_more());
+                    if (!block_has_more_symbols)
+                        break;
+                }
                 nread += m_output_buffer.read(slice.slice(nread)).size();
             }
 
@@ -541,6 +552,20 @@ size_t DeflateCompressor::compare_match_candidate(size_t start, size_t candidate
 
     // Find the actual length
     auto match_length = previous_match_length + 1;
+
+    // OPTIMIZATION: Compare eight bytes at a time. Loaded as little-endian words, the first differing byte is the
+    //               lowest non-zero byte of their XOR.
+    while (match_length + sizeof(u64) <= maximum_match_length) {
+        auto current = AK::convert_between_host_and_little_endian(ByteReader::load64(&m_rolling_window[start + match_length]));
+        auto other = AK::convert_between_host_and_little_endian(ByteReader::load64(&m_rolling_window[candidate + match_length]));
+        if (auto difference = current ^ other; difference != 0) {
+            match_length += count_trailing_zeroes(difference) / 8;
+            VERIFY(match_length < maximum_match_length);
+            return match_length;
+        }
+        match_length += sizeof(u64);
+    }
+
     while (match_length < maximum_match_length && m_rolling_window[start + match_length] == m_rolling_window[candidate + match_length]) {
         match_length++;
     }
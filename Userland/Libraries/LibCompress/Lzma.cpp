@@ -229,7 +229,7 @@ ErrorOr<void> LzmaDecompressor::append_input_stream(MaybeOwned<Stream> stream, O
     return {};
 }
 
-ErrorOr<void> LzmaDecompressor::normalize_range_decoder()
+ALWAYS_INLINE ErrorOr<void> LzmaDecompressor::normalize_range_decoder()
 {
     // "The Normalize() function keeps the "Range" value in described range."
 
@@ -297,7 +297,7 @@ ErrorOr<void> LzmaCompressor::normalize_range_encoder()
     return {};
 }
 
-ErrorOr<u8> LzmaDecompressor::decode_direct_bit()
+ALWAYS_INLINE ErrorOr<u8> LzmaDecompressor::decode_direct_bit()
 {
     dbgln_if(LZMA_DEBUG, "Decoding direct bit {} with code = {:#x}, range = {:#x}", 1 - ((m_range_decoder_code - (m_range_decoder_range >> 1)) >> 31), m_range_decoder_code, m_range_decoder_range);
 
@@ -330,7 +330,7 @@ ErrorOr<void> LzmaCompressor::encode_direct_bit(u8 value)
     return {};
 }
 
-ErrorOr<u8> LzmaDecompressor::decode_bit_with_probability(Probability& probability)
+ALWAYS_INLINE ErrorOr<u8> LzmaDecompressor::decode_bit_with_probability(Probability& probability)
 {
     // "The LZMA decoder provides the pointer to CProb variable that contains
     //  information about estimated probability for symbol 0 and the Range Decoder
@@ -756,6 +756,9 @@ ErrorOr<void> XzDecompressor::finish_current_stream()
     return {};
 }
 
+// FIXME: Blocks are decoded one after another, even though multi-threaded encoders (like `xz -T0`) produce blocks that
+//        can be decoded independently. Decoding those in parallel needs the index up front, which sits at the end of the
+//        stream and is therefore only reachable if the underlying stream is seekable.
 ErrorOr<Bytes> XzDecompressor::read_some(Bytes bytes)
 {
     if (!m_stream_flags.has_value()) {
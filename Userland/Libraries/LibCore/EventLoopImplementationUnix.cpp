@@ -20,6 +20,10 @@
 #include <sys/select.h>
 #include <unistd.h>
 
+#if defined(AK_OS_LINUX)
+#    include <sys/epoll.h>
+#endif
+
 namespace Core {
 
 namespace {
@@ -33,6 +37,17 @@ static pthread_rwlock_t* s_thread_data_lock = nullptr;
 thread_local pthread_t s_thread_id;
 thread_local OwnPtr<ThreadData> s_this_thread_data;
 
+#if defined(AK_OS_LINUX)
+u32 notification_type_to_epoll_events(NotificationType type)
+{
+    u32 events = 0;
+    if (has_flag(type, NotificationType::Read))
+        events |= EPOLLIN;
+    if (has_flag(type, NotificationType::Write))
+        events |= EPOLLOUT;
+    return events;
+}
+#else
 short notification_type_to_poll_events(NotificationType type)
 {
     short events = 0;
@@ -42,6 +57,7 @@ short notification_type_to_poll_events(NotificationType type)
         events |= POLLOUT;
     return events;
 }
+#endif
 
 bool has_flag(int value, int flag)
 {
@@ -260,6 +276,11 @@ struct ThreadData {
 
     ~ThreadData()
     {
+#if defined(AK_OS_LINUX)
+        if (epoll_fd != -1)
+            close(epoll_fd);
+#endif
+
         pthread_rwlock_wrlock(&*s_thread_data_lock);
         s_thread_data.remove(s_thread_id);
         pthread_rwlock_unlock(&*s_thread_data_lock);
@@ -275,17 +296,48 @@ struct ThreadData {
         wake_pipe_fds = MUST(Core::System::pipe2(O_CLOEXEC));
 
         // The wake pipe informs us of POSIX signals as well as manual calls to wake()
+#if defined(AK_OS_LINUX)
+        // NOTE: After a fork, the epoll instance is still shared with the parent, so we need a new one.
+        if (epoll_fd != -1)
+            close(epoll_fd);
+
+        epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+        if (epoll_fd < 0) {
+            perror("EventLoopImplementationUnix: epoll_create1");
+            VERIFY_NOT_REACHED();
+        }
+
+        VERIFY(notifiers_by_fd.is_empty());
+        epoll_event event {};
+        event.events = EPOLLIN;
+        event.data.fd = wake_pipe_fds[0];
+        if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, wake_pipe_fds[0], &event) < 0) {
+            perror("EventLoopImplementationUnix: epoll_ctl");
+            VERIFY_NOT_REACHED();
+        }
+#else
         VERIFY(poll_fds.size() == 0);
         poll_fds.append({ .fd = wake_pipe_fds[0], .events = POLLIN, .revents = 0 });
         notifier_by_index.append(nullptr);
+#endif
     }
 
     // Each thread has its own timers, notifiers and a wake pipe.
     TimeoutSet timeouts;
 
+#if defined(AK_OS_LINUX)
+    // OPTIMIZATION: Notifiers stay registered with the kernel, so waiting for events doesn't cost O(number of notifiers).
+    //               epoll only allows a single registration per file descriptor, so notifiers are grouped by fd.
+    int epoll_fd { -1 };
+    HashMap<int, Vector<Notifier*, 1>> notifiers_by_fd;
+
+    // Regular files can't be registered with epoll, but (just like with poll()) they are always ready for reading and writing.
+    HashTable<int> always_ready_fds;
+#else
     Vector<pollfd> poll_fds;
     HashMap<Notifier*, size_t> notifier_by_ptr;
     Vector<Notifier*> notifier_by_index;
+#endif
 
     // The wake pipe is used to notify another event loop that someone has called wake(), or a signal has been received.
     // wake() writes 0i32 into the pipe, signals write the signal number (guaranteed non-zero).
@@ -375,8 +427,34 @@ retry:
         }
     }
 
+#if defined(AK_OS_LINUX)
+    // Files that are always ready would make poll() return immediately, so don't block on them either.
+    if (!thread_data.always_ready_fds.is_empty()) {
+        timeout = 0;
+        should_wait_forever = false;
+    }
+#endif
+
 try_select_again:
     // select() and wait for file system events, calls to wake(), POSIX signals, or timer expirations.
+#if defined(AK_OS_LINUX)
+    Array<epoll_event, 64> epoll_events;
+    int marked_fd_count = epoll_wait(thread_data.epoll_fd, epoll_events.data(), epoll_events.size(), should_wait_forever ? -1 : timeout);
+    auto time_after_poll = MonotonicTime::now_coarse();
+    // Because POSIX, we might spuriously return from epoll_wait() with EINTR; just wait again.
+    if (marked_fd_count < 0) {
+        if (errno == EINTR)
+            goto try_select_again;
+        perror("EventLoopImplementationUnix::wait_for_events: epoll_wait");
+        VERIFY_NOT_REACHED();
+    }
+
+    bool wake_pipe_is_readable = false;
+    for (int i = 0; i < marked_fd_count; ++i) {
+        if (epoll_events[i].data.fd == thread_data.wake_pipe_fds[0] && has_flag(epoll_events[i].events, EPOLLIN))
+            wake_pipe_is_readable = true;
+    }
+#else
     ErrorOr<int> error_or_marked_fd_count = System::poll(thread_data.poll_fds, should_wait_forever ? -1 : timeout);
     auto time_after_poll = MonotonicTime::now_coarse();
     // Because POSIX, we might spuriously return from select() with EINTR; just select again.
@@ -387,9 +465,13 @@ try_select_again:
         VERIFY_NOT_REACHED();
     }
 
+    int marked_fd_count = error_or_marked_fd_count.value();
+    bool wake_pipe_is_readable = has_flag(thread_data.poll_fds[0].revents, POLLIN);
+#endif
+
     // We woke up due to a call to wake() or a POSIX signal.
     // Handle signals and see whether we need to handle events as well.
-    if (has_flag(thread_data.poll_fds[0].revents, POLLIN)) {
+    if (wake_pipe_is_readable) {
         int wake_events[8];
         ssize_t nread;
         // We might receive another signal while read()ing here. The signal will go to the handle_signal properly,
@@ -418,7 +500,40 @@ try_select_again:
             goto retry;
     }
 
-    if (error_or_marked_fd_count.value() != 0) {
+#if defined(AK_OS_LINUX)
+    auto post_activation_events = [&](int fd, NotificationType type) {
+        auto it = thread_data.notifiers_by_fd.find(fd);
+        if (it == thread_data.notifiers_by_fd.end())
+            return;
+        for (auto* notifier : it->value) {
+            auto notifier_type = type & notifier->type();
+            if (notifier_type != NotificationType::None)
+                ThreadEventQueue::current().post_event(*notifier, make<NotifierActivationEvent>(fd, notifier_type));
+        }
+    };
+
+    // Handle file system notifiers by making them normal events.
+    for (int i = 0; i < marked_fd_count; ++i) {
+        auto const& event = epoll_events[i];
+        if (event.data.fd == thread_data.wake_pipe_fds[0])
+            continue;
+
+        NotificationType type = NotificationType::None;
+        if (has_flag(event.events, EPOLLIN))
+            type |= NotificationType::Read;
+        if (has_flag(event.events, EPOLLOUT))
+            type |= NotificationType::Write;
+        if (has_flag(event.events, EPOLLHUP))
+            type |= NotificationType::HangUp;
+        if (has_flag(event.events, EPOLLERR))
+            type |= NotificationType::Error;
+        post_activation_events(event.data.fd, type);
+    }
+
+    for (auto fd : thread_data.always_ready_fds)
+        post_activation_events(fd, NotificationType::Read | NotificationType::Write);
+#else
+    if (marked_fd_count != 0) {
         // Handle file system notifiers by making them normal events.
         for (size_t i = 1; i < thread_data.poll_fds.size(); ++i) {
             auto& revents = thread_data.poll_fds[i].revents;
@@ -438,6 +553,7 @@ try_select_again:
                 ThreadEventQueue::current().post_event(notifier, make<NotifierActivationEvent>(notifier.fd(), type));
         }
     }
+#endif
 
     // Handle expired timers.
     thread_data.timeouts.fire_expired(time_after_poll);
@@ -514,9 +630,14 @@ void EventLoopImplementationUnix::notify_forked_and_in_child()
 {
     auto& thread_data = ThreadData::the();
     thread_data.timeouts.clear();
+#if defined(AK_OS_LINUX)
+    thread_data.notifiers_by_fd.clear();
+    thread_data.always_ready_fds.clear();
+#else
     thread_data.poll_fds.clear();
     thread_data.notifier_by_ptr.clear();
     thread_data.notifier_by_index.clear();
+#endif
     thread_data.initialize_wake_pipe();
     if (auto* info = signals_info<false>()) {
         info->signal_handlers.clear();
@@ -668,10 +789,56 @@ void EventLoopManagerUnix::unregister_timer(intptr_t timer_id)
     }
 }
 
+#if defined(AK_OS_LINUX)
+static void update_epoll_registration(ThreadData& thread_data, int fd)
+{
+    auto it = thread_data.notifiers_by_fd.find(fd);
+    if (it == thread_data.notifiers_by_fd.end()) {
+        // NOTE: The file descriptor may already have been closed (which removes it from the epoll set), so ignore errors.
+        if (!thread_data.always_ready_fds.remove(fd))
+            (void)epoll_ctl(thread_data.epoll_fd, EPOLL_CTL_DEL, fd, nullptr);
+        return;
+    }
+
+    if (thread_data.always_ready_fds.contains(fd))
+        return;
+
+    epoll_event event {};
+    event.data.fd = fd;
+    for (auto* notifier : it->value)
+        event.events |= notification_type_to_epoll_events(notifier->type());
+
+    auto operation = it->value.size() == 1 ? EPOLL_CTL_ADD : EPOLL_CTL_MOD;
+    if (epoll_ctl(thread_data.epoll_fd, operation, fd, &event) == 0)
+        return;
+
+    // If the file descriptor was closed and reused behind our back, its registration changed as well.
+    if (errno == ENOENT && operation == EPOLL_CTL_MOD) {
+        if (epoll_ctl(thread_data.epoll_fd, EPOLL_CTL_ADD, fd, &event) == 0)
+            return;
+    } else if (errno == EEXIST && operation == EPOLL_CTL_ADD) {
+        if (epoll_ctl(thread_data.epoll_fd, EPOLL_CTL_MOD, fd, &event) == 0)
+            return;
+    }
+
+    if (errno == EPERM) {
+        thread_data.always_ready_fds.set(fd);
+        return;
+    }
+
+    // NOTE: poll() would silently ignore invalid file descriptors, so we do the same.
+    dbgln("EventLoopImplementationUnix: Failed to register fd {} with epoll: {}", fd, Error::from_errno(errno));
+}
+#endif
+
 void EventLoopManagerUnix::register_notifier(Notifier& notifier)
 {
     auto& thread_data = ThreadData::the();
 
+#if defined(AK_OS_LINUX)
+    thread_data.notifiers_by_fd.ensure(notifier.fd()).append(&notifier);
+    update_epoll_registration(thread_data, notifier.fd());
+#else
     thread_data.notifier_by_ptr.set(&notifier, thread_data.poll_fds.size());
     thread_data.notifier_by_index.append(&notifier);
     thread_data.poll_fds.append({
@@ -679,6 +846,7 @@ void EventLoopManagerUnix::register_notifier(Notifier& notifier)
         .events = notification_type_to_poll_events(notifier.type()),
         .revents = 0,
     });
+#endif
 
     notifier.set_owner_thread(s_thread_id);
 }
@@ -690,6 +858,17 @@ void EventLoopManagerUnix::unregister_notifier(Notifier& notifier)
         return;
 
     auto& thread_data = *thread_data_ptr;
+#if defined(AK_OS_LINUX)
+    auto it = thread_data.notifiers_by_fd.find(notifier.fd());
+    VERIFY(it != thread_data.notifiers_by_fd.end());
+
+    auto did_remove = it->value.remove_first_matching([&](auto* entry) { return entry == &notifier; });
+    VERIFY(did_remove);
+    if (it->value.is_empty())
+        thread_data.notifiers_by_fd.remove(it);
+
+    update_epoll_registration(thread_data, notifier.fd());
+#else
     auto it = thread_data.notifier_by_ptr.find(&notifier);
     VERIFY(it != thread_data.notifier_by_ptr.end());
 
@@ -703,6 +882,7 @@ void EventLoopManagerUnix::unregister_notifier(Notifier& notifier)
     }
     thread_data.poll_fds.take_last();
     thread_data.notifier_by_index.take_last();
+#endif
 }
 
 void EventLoopManagerUnix::did_post_event()
@@ -126,6 +126,11 @@ ErrorOr<ByteBuffer> File::read_until_eof(size_t block_size)
     // Note: This is used as a heuristic, it's not valid for devices or virtual files.
     auto const potential_file_size = TRY(System::fstat(m_fd)).st_size;
 
+    // OPTIMIZATION: Read the whole file with a single read() (and one more to detect EOF), instead of one per block.
+    //               The extra byte leaves room for noticing EOF without having to grow the buffer again.
+    if (potential_file_size > 0)
+        block_size = max(block_size, static_cast<size_t>(potential_file_size) + 1);
+
     return read_until_eof_impl(block_size, potential_file_size);
 }
 
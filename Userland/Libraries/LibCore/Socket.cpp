@@ -5,13 +5,28 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/HashMap.h>
+#include <AK/Time.h>
 #include <LibCore/Socket.h>
 #include <LibCore/System.h>
+#include <LibThreading/Mutex.h>
 
 namespace Core {
 
 static constexpr size_t MAX_LOCAL_SOCKET_TRANSFER_FDS = 64;
 
+// NOTE: getaddrinfo() doesn't tell us the TTL of the records it found, so cached results expire after a fixed, short time.
+static constexpr i64 RESOLVED_HOST_CACHE_LIFETIME_SECONDS = 60;
+static constexpr size_t RESOLVED_HOST_CACHE_MAX_ENTRIES = 1024;
+
+struct ResolvedHost {
+    IPv4Address address;
+    MonotonicTime expiry;
+};
+
+static Threading::Mutex s_resolved_host_cache_mutex;
+static HashMap<ByteString, ResolvedHost> s_resolved_host_cache;
+
 ErrorOr<int> Socket::create_fd(SocketDomain domain, SocketType type)
 {
     int socket_domain;
@@ -68,13 +83,28 @@ ErrorOr<IPv4Address> Socket::resolve_host(ByteString const& host, SocketType typ
     hints.ai_flags = 0;
     hints.ai_protocol = 0;
 
+    {
+        Threading::MutexLocker locker(s_resolved_host_cache_mutex);
+        if (auto it = s_resolved_host_cache.find(host); it != s_resolved_host_cache.end()) {
+            if (MonotonicTime::now_coarse() < it->value.expiry)
+                return it->value.address;
+            s_resolved_host_cache.remove(it);
+        }
+    }
+
     auto const results = TRY(Core::System::getaddrinfo(host.characters(), nullptr, hints));
 
     for (auto const& result : results.addresses()) {
         if (result.ai_family == AF_INET) {
             auto* socket_address = bit_cast<struct sockaddr_in*>(result.ai_addr);
             NetworkOrdered<u32> const network_ordered_address { socket_address->sin_addr.s_addr };
-            return IPv4Address { network_ordered_address };
+            IPv4Address address { network_ordered_address };
+
+            Threading::MutexLocker locker(s_resolved_host_cache_mutex);
+            if (s_resolved_host_cache.size() >= RESOLVED_HOST_CACHE_MAX_ENTRIES)
+                s_resolved_host_cache.clear();
+            s_resolved_host_cache.set(host, ResolvedHost { address, MonotonicTime::now_coarse() + Duration::from_seconds(RESOLVED_HOST_CACHE_LIFETIME_SECONDS) });
+            return address;
         }
     }
 
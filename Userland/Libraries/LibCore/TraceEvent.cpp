@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/FixedArray.h>
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/Time.h>
+#include <LibCore/Process.h>
+#include <LibCore/TraceEvent.h>
+#include <LibThreading/Mutex.h>
+#include <pthread.h>
+#include <unistd.h>
+
+namespace Core::TraceEvent {
+
+Atomic<bool> g_enabled { false };
+
+namespace {
+
+struct RecordedEvent {
+    Phase phase { Phase::Instant };
+    StringView category;
+    StringView name;
+    i64 timestamp_in_microseconds { 0 };
+    u64 id_or_value { 0 };
+    ByteString detail;
+};
+
+// Only the owning thread ever writes to its buffer. Other threads only read the events that were published by
+// storing the new size, which is all the synchronization that is needed.
+struct ThreadBuffer {
+    static constexpr size_t capacity = 16 * KiB;
+
+    u64 thread_id { 0 };
+    ByteString thread_name;
+
+    Atomic<u64> session { 0 };
+    Atomic<size_t> size { 0 };
+    Atomic<size_t> dropped_event_count { 0 };
+    FixedArray<RecordedEvent> events { FixedArray<RecordedEvent>::must_create_but_fixme_should_propagate_errors(capacity) };
+
+    // Set when the thread exits during a trace. The buffer is kept until its events have been collected.
+    bool thread_has_exited { false };
+};
+
+}
+
+// The lock only guards the list of buffers, which changes when a thread records its first event or exits. Recording
+// itself never takes it.
+static Threading::Mutex s_thread_buffers_lock;
+static Vector<ThreadBuffer*> s_thread_buffers;
+static Atomic<u64> s_session { 0 };
+static thread_local ThreadBuffer* t_thread_buffer { nullptr };
+
+static pthread_key_t s_thread_buffer_key;
+static pthread_once_t s_thread_buffer_key_once = PTHREAD_ONCE_INIT;
+
+static void free_buffers_of_exited_threads()
+{
+    s_thread_buffers.remove_all_matching([](auto* buffer) {
+        if (!buffer->thread_has_exited)
+            return false;
+        delete buffer;
+        return true;
+    });
+}
+
+static void release_thread_buffer(void* value)
+{
+    auto* buffer = static_cast<ThreadBuffer*>(value);
+    Threading::MutexLocker locker { s_thread_buffers_lock };
+
+    // The events of a running trace must survive their thread, stop() frees the buffer once it has collected them.
+    if (is_enabled()) {
+        buffer->thread_has_exited = true;
+        return;
+    }
+
+    s_thread_buffers.remove_first_matching([&](auto* other) { return other == buffer; });
+    delete buffer;
+}
+
+static u64 current_thread_id()
+{
+#if defined(AK_OS_MACOS)
+    u64 thread_id = 0;
+    pthread_threadid_np(nullptr, &thread_id);
+    return thread_id;
+#elif defined(AK_OS_LINUX) || defined(AK_OS_SERENITY)
+    return static_cast<u64>(gettid());
+#else
+    return bit_cast<FlatPtr>(pthread_self());
+#endif
+}
+
+static ThreadBuffer& thread_buffer()
+{
+    if (t_thread_buffer)
+        return *t_thread_buffer;
+
+    pthread_once(&s_thread_buffer_key_once, [] {
+        pthread_key_create(&s_thread_buffer_key, release_thread_buffer);
+    });
+
+    auto* buffer = new ThreadBuffer;
+    buffer->thread_id = current_thread_id();
+
+    char thread_name[64] {};
+    if (pthread_getname_np(pthread_self(), thread_name, sizeof(thread_name)) == 0)
+        buffer->thread_name = thread_name;
+
+    {
+        Threading::MutexLocker locker { s_thread_buffers_lock };
+        s_thread_buffers.append(buffer);
+    }
+
+    pthread_setspecific(s_thread_buffer_key, buffer);
+    t_thread_buffer = buffer;
+    return *buffer;
+}
+
+void start()
+{
+    Threading::MutexLocker locker { s_thread_buffers_lock };
+
+    // Threads that exited during a trace that was never stopped can't contribute to this one.
+    free_buffers_of_exited_threads();
+
+    s_session.fetch_add(1, AK::MemoryOrder::memory_order_release);
+    g_enabled.store(true, AK::MemoryOrder::memory_order_relaxed);
+}
+
+void record(Phase phase, StringView category, StringView name, u64 id_or_value, ByteString detail)
+{
+    auto& buffer = thread_buffer();
+
+    // Buffers are reset by their own thread the first time it records an event during a new trace.
+    auto session = s_session.load(AK::MemoryOrder::memory_order_acquire);
+    if (buffer.session.load(AK::MemoryOrder::memory_order_relaxed) != session) {
+        buffer.size.store(0, AK::MemoryOrder::memory_order_relaxed);
+        buffer.dropped_event_count.store(0, AK::MemoryOrder::memory_order_relaxed);
+        buffer.session.store(session, AK::MemoryOrder::memory_order_release);
+    }
+
+    auto index = buffer.size.load(AK::MemoryOrder::memory_order_relaxed);
+    if (index >= ThreadBuffer::capacity) {
+        buffer.dropped_event_count.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+        return;
+    }
+
+    buffer.events[index] = {
+        .phase = phase,
+        .category = category,
+        .name = name,
+        .timestamp_in_microseconds = MonotonicTime::now().nanoseconds() / 1000,
+        .id_or_value = id_or_value,
+        .detail = move(detail),
+    };
+    buffer.size.store(index + 1, AK::MemoryOrder::memory_order_release);
+}
+
+static StringView phase_name(Phase phase)
+{
+    switch (phase) {
+    case Phase::Begin:
+        return "B"sv;
+    case Phase::End:
+        return "E"sv;
+    case Phase::Instant:
+        return "i"sv;
+    case Phase::Counter:
+        return "C"sv;
+    case Phase::AsyncBegin:
+        return "b"sv;
+    case Phase::AsyncEnd:
+        return "e"sv;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+static JsonObject metadata_event(pid_t pid, u64 thread_id, StringView name, StringView value)
+{
+    JsonObject args;
+    args.set("name"sv, value);
+
+    JsonObject event;
+    event.set("ph"sv, "M"sv);
+    event.set("name"sv, name);
+    event.set("pid"sv, pid);
+    event.set("tid"sv, thread_id);
+    event.set("args"sv, move(args));
+    return event;
+}
+
+ByteString stop()
+{
+    Threading::MutexLocker locker { s_thread_buffers_lock };
+    g_enabled.store(false, AK::MemoryOrder::memory_order_relaxed);
+
+    auto session = s_session.load(AK::MemoryOrder::memory_order_acquire);
+    auto pid = getpid();
+
+    JsonArray events;
+    if (auto process_name = Process::get_name(); !process_name.is_error())
+        events.must_append(metadata_event(pid, 0, "process_name"sv, process_name.value()));
+
+    for (auto* buffer : s_thread_buffers) {
+        if (buffer->session.load(AK::MemoryOrder::memory_order_acquire) != session)
+            continue;
+
+        if (!buffer->thread_name.is_empty())
+            events.must_append(metadata_event(pid, buffer->thread_id, "thread_name"sv, buffer->thread_name));
+
+        auto size = buffer->size.load(AK::MemoryOrder::memory_order_acquire);
+        for (size_t i = 0; i < size; ++i) {
+            auto const& recorded_event = buffer->events[i];
+
+            JsonObject event;
+            event.set("ph"sv, phase_name(recorded_event.phase));
+            event.set("cat"sv, recorded_event.category);
+            event.set("name"sv, recorded_event.name);
+            event.set("ts"sv, recorded_event.timestamp_in_microseconds);
+            event.set("pid"sv, pid);
+            event.set("tid"sv, buffer->thread_id);
+
+            JsonObject args;
+            switch (recorded_event.phase) {
+            case Phase::Counter:
+                args.set(recorded_event.name, static_cast<i64>(recorded_event.id_or_value));
+                break;
+            case Phase::AsyncBegin:
+            case Phase::AsyncEnd:
+                event.set("id"sv, ByteString::formatted("{:#x}", recorded_event.id_or_value));
+                break;
+            case Phase::Instant:
+                // Instant events are only drawn on the track of their thread.
+                event.set("s"sv, "t"sv);
+                break;
+            case Phase::Begin:
+            case Phase::End:
+                break;
+            }
+            if (!recorded_event.detail.is_empty())
+                args.set("detail"sv, recorded_event.detail);
+            if (!args.is_empty())
+                event.set("args"sv, move(args));
+
+            events.must_append(move(event));
+        }
+
+        if (auto dropped_event_count = buffer->dropped_event_count.load(AK::MemoryOrder::memory_order_relaxed); dropped_event_count > 0)
+            dbgln("TraceEvent: Dropped {} events of thread {}, its buffer was full", dropped_event_count, buffer->thread_id);
+    }
+
+    free_buffers_of_exited_threads();
+
+    return events.to_byte_string();
+}
+
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/ByteString.h>
+#include <AK/Noncopyable.h>
+#include <AK/StringView.h>
+#include <AK/Types.h>
+
+// A lightweight recorder of trace events in the format of the Chrome trace viewer and Perfetto:
+// https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU
+//
+// Every thread records into a buffer of its own, so recording never takes a lock. Each process records its own
+// events, and the UI process asks all of its helper processes for theirs to merge them into a single trace.
+//
+// Categories and names must be string literals, as only the views are stored. While tracing is disabled, recording
+// an event costs a single relaxed atomic load.
+namespace Core::TraceEvent {
+
+extern Atomic<bool> g_enabled;
+
+ALWAYS_INLINE bool is_enabled() { return g_enabled.load(AK::MemoryOrder::memory_order_relaxed); }
+
+// Discards the events of any previous trace and starts recording events in this process.
+void start();
+
+// Stops recording, and returns the recorded events of this process as a JSON array of trace events.
+ByteString stop();
+
+enum class Phase : u8 {
+    Begin,
+    End,
+    Instant,
+    Counter,
+    AsyncBegin,
+    AsyncEnd,
+};
+
+void record(Phase, StringView category, StringView name, u64 id_or_value = 0, ByteString detail = {});
+
+// Begin and end must be balanced on the same thread, they are drawn as nested slices.
+ALWAYS_INLINE void begin(StringView category, StringView name)
+{
+    if (is_enabled()) [[unlikely]]
+        record(Phase::Begin, category, name);
+}
+
+ALWAYS_INLINE void end(StringView category, StringView name)
+{
+    if (is_enabled()) [[unlikely]]
+        record(Phase::End, category, name);
+}
+
+ALWAYS_INLINE void instant(StringView category, StringView name)
+{
+    if (is_enabled()) [[unlikely]]
+        record(Phase::Instant, category, name);
+}
+
+ALWAYS_INLINE void counter(StringView category, StringView name, i64 value)
+{
+    if (is_enabled()) [[unlikely]]
+        record(Phase::Counter, category, name, static_cast<u64>(value));
+}
+
+// Async events may begin and end on different threads, and are matched by their id instead of their nesting.
+ALWAYS_INLINE void async_begin(StringView category, StringView name, u64 id)
+{
+    if (is_enabled()) [[unlikely]]
+        record(Phase::AsyncBegin, category, name, id);
+}
+
+ALWAYS_INLINE void async_end(StringView category, StringView name, u64 id)
+{
+    if (is_enabled()) [[unlikely]]
+        record(Phase::AsyncEnd, category, name, id);
+}
+
+class Scope {
+    AK_MAKE_NONCOPYABLE(Scope);
+    AK_MAKE_NONMOVABLE(Scope);
+
+public:
+    ALWAYS_INLINE Scope(StringView category, StringView name)
+        : m_category(category)
+        , m_name(name)
+        , m_did_begin(is_enabled())
+    {
+        if (m_did_begin) [[unlikely]]
+            record(Phase::Begin, m_category, m_name);
+    }
+
+    ALWAYS_INLINE ~Scope()
+    {
+        if (m_did_begin) [[unlikely]]
+            record(Phase::End, m_category, m_name);
+    }
+
+private:
+    StringView m_category;
+    StringView m_name;
+    bool m_did_begin { false };
+};
+
+}
+
+#define __TRACE_EVENT_CONCATENATE(a, b) a##b
+#define __TRACE_EVENT_SCOPE_NAME(line) __TRACE_EVENT_CONCATENATE(__trace_event_scope_, line)
+#define TRACE_EVENT_SCOPE(category, name) Core::TraceEvent::Scope __TRACE_EVENT_SCOPE_NAME(__LINE__)((category), (name))
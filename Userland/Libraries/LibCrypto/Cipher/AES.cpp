@@ -4,10 +4,15 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Platform.h>
 #include <AK/StringBuilder.h>
 #include <LibCrypto/Cipher/AES.h>
 #include <LibCrypto/Cipher/AESTables.h>
 
+#if ARCH(X86_64)
+#    include <immintrin.h>
+#endif
+
 namespace Crypto::Cipher {
 
 template<typename T>
@@ -194,8 +199,58 @@ void AESCipherKey::expand_decrypt_key(ReadonlyBytes user_key, size_t bits)
     }
 }
 
+#if ARCH(X86_64)
+static bool cpu_supports_aes_ni()
+{
+    static bool const supported = [] {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("aes") && __builtin_cpu_supports("ssse3");
+    }();
+    return supported;
+}
+
+// NOTE: Our round keys are stored as big-endian words, AES-NI wants them in memory byte order.
+[[gnu::target("aes,ssse3")]] static __m128i load_round_key(u32 const* round_key)
+{
+    auto const byte_swap_words = _mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+    return _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(round_key)), byte_swap_words);
+}
+
+[[gnu::target("aes,ssse3")]] static void encrypt_block_with_aes_ni(AESCipherKey const& key, AESCipherBlock const& in, AESCipherBlock& out)
+{
+    auto const* round_keys = key.round_keys();
+    auto const rounds = key.rounds();
+
+    auto state = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<__m128i const*>(in.bytes().data())), load_round_key(round_keys));
+    for (size_t i = 1; i < rounds; ++i)
+        state = _mm_aesenc_si128(state, load_round_key(round_keys + 4 * i));
+    state = _mm_aesenclast_si128(state, load_round_key(round_keys + 4 * rounds));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out.bytes().data()), state);
+}
+
+// NOTE: expand_decrypt_key() produces the key schedule of the equivalent inverse cipher, which is exactly what AESDEC expects.
+[[gnu::target("aes,ssse3")]] static void decrypt_block_with_aes_ni(AESCipherKey const& key, AESCipherBlock const& in, AESCipherBlock& out)
+{
+    auto const* round_keys = key.round_keys();
+    auto const rounds = key.rounds();
+
+    auto state = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<__m128i const*>(in.bytes().data())), load_round_key(round_keys));
+    for (size_t i = 1; i < rounds; ++i)
+        state = _mm_aesdec_si128(state, load_round_key(round_keys + 4 * i));
+    state = _mm_aesdeclast_si128(state, load_round_key(round_keys + 4 * rounds));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out.bytes().data()), state);
+}
+#endif
+
 void AESCipher::encrypt_block(AESCipherBlock const& in, AESCipherBlock& out)
 {
+#if ARCH(X86_64)
+    if (cpu_supports_aes_ni()) {
+        encrypt_block_with_aes_ni(key(), in, out);
+        return;
+    }
+#endif
+
     u32 s0, s1, s2, s3, t0, t1, t2, t3;
     size_t r { 0 };
 
@@ -285,6 +340,13 @@ void AESCipher::encrypt_block(AESCipherBlock const& in, AESCipherBlock& out)
 
 void AESCipher::decrypt_block(AESCipherBlock const& in, AESCipherBlock& out)
 {
+#if ARCH(X86_64)
+    if (cpu_supports_aes_ni()) {
+        decrypt_block_with_aes_ni(key(), in, out);
+        return;
+    }
+#endif
+
     u32 s0, s1, s2, s3, t0, t1, t2, t3;
     size_t r { 0 };
 
@@ -405,11 +405,17 @@ FLATTEN __attribute__((hot)) void EdgeFlagPathRasterizer<SamplesPerPixel>::write
             write_pixel(dest_format, dest_ptr, scanline, x, sample, color_or_function);
         });
     };
-    // Fast fill case: Track spans of solid color and set the entire span via a fast_u32_fill().
-    // Used for opaque colors (i.e. alpha == 255).
+    // Fast fill case: Track spans of solid color and fill the entire span at once.
+    // Opaque colors (i.e. alpha == 255) are set via a fast_u32_fill(), semi-transparent colors are blended
+    // via Painter::fill_physical_rect() (which has the same result as blending the pixels individually).
     auto write_scanline_with_fast_fills = [&](Color color) {
-        if (color.alpha() != 255)
-            return write_scanline_pixelwise(color);
+        auto fill_span = [&](int start, int end) {
+            if (color.alpha() == 255) {
+                fast_fill_solid_color_span(dest_ptr, start, end, color);
+                return;
+            }
+            painter.fill_physical_rect({ start + m_blit_origin.x(), scanline + m_blit_origin.y(), end - start + 1, 1 }, color);
+        };
         constexpr SampleType full_converage = NumericLimits<SampleType>::max();
         int full_converage_count = 0;
         accumulate_scanline<WindingRule>(clipped_extent, acc, [&](int x, SampleType sample) {
@@ -420,12 +426,12 @@ FLATTEN __attribute__((hot)) void EdgeFlagPathRasterizer<SamplesPerPixel>::write
                 write_pixel(dest_format, dest_ptr, scanline, x, sample, color);
             }
             if (full_converage_count > 0) {
-                fast_fill_solid_color_span(dest_ptr, x - full_converage_count, x - 1, color);
+                fill_span(x - full_converage_count, x - 1);
                 full_converage_count = 0;
             }
         });
         if (full_converage_count > 0)
-            fast_fill_solid_color_span(dest_ptr, clipped_extent.max_x - full_converage_count + 1, clipped_extent.max_x, color);
+            fill_span(clipped_extent.max_x - full_converage_count + 1, clipped_extent.max_x);
     };
     switch_on_color_or_function(
         color_or_function, write_scanline_with_fast_fills, write_scanline_pixelwise);
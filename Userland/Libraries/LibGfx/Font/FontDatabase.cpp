@@ -6,9 +6,11 @@
 
 #include <AK/DeprecatedFlyString.h>
 #include <AK/FlyString.h>
+#include <AK/HashTable.h>
 #include <AK/LexicalPath.h>
 #include <AK/Queue.h>
 #include <LibCore/Resource.h>
+#include <LibCore/System.h>
 #include <LibGfx/Font/Font.h>
 #include <LibGfx/Font/FontDatabase.h>
 #include <LibGfx/Font/OpenType/Font.h>
@@ -23,10 +25,70 @@ FontDatabase& FontDatabase::the()
     return s_the;
 }
 
+// Identifies a font file by its inode, so that a file reachable through more than one font directory (or symlink)
+// is only mapped and parsed once.
+struct FontFileIdentifier {
+    dev_t device { 0 };
+    ino_t inode { 0 };
+
+    bool operator==(FontFileIdentifier const&) const = default;
+};
+
+}
+
+template<>
+struct AK::Traits<Gfx::FontFileIdentifier> : public DefaultTraits<Gfx::FontFileIdentifier> {
+    static unsigned hash(Gfx::FontFileIdentifier const& identifier)
+    {
+        return pair_int_hash(u64_hash(identifier.device), u64_hash(identifier.inode));
+    }
+};
+
+namespace Gfx {
+
 struct FontDatabase::Private {
     HashMap<FlyString, Vector<NonnullRefPtr<Typeface>>, AK::ASCIICaseInsensitiveFlyStringTraits> typeface_by_family;
+    HashTable<FontFileIdentifier> loaded_font_files;
 };
 
+static bool has_loadable_font_extension(LexicalPath const& path)
+{
+    // FIXME: What about .otf
+    return path.has_extension(".ttf"sv) || path.has_extension(".woff"sv);
+}
+
+// Like Core::Resource::for_each_descendant_file(), but only maps the files that look like fonts we can load. System
+// font directories contain plenty of other files (bitmap fonts, Type 1 fonts, fontconfig caches) that every process
+// would otherwise map just to look at their name.
+template<typename Callback>
+static void for_each_font_file(Core::Resource const& directory, HashTable<FontFileIdentifier>& seen_files, Callback const& callback)
+{
+    auto directory_path = directory.filesystem_path();
+    for (auto const& child : directory.children()) {
+        auto child_path = LexicalPath::join(directory_path, child);
+        auto stat_or_error = Core::System::stat(child_path.string());
+        if (stat_or_error.is_error())
+            continue;
+        auto const& stat = stat_or_error.value();
+
+        bool is_directory = S_ISDIR(stat.st_mode);
+        if (!is_directory && !has_loadable_font_extension(child_path))
+            continue;
+        if (!is_directory && seen_files.set({ stat.st_dev, stat.st_ino }) != HashSetResult::InsertedNewEntry)
+            continue;
+
+        auto resource_or_error = Core::Resource::load_from_uri(MUST(String::formatted("{}/{}", directory.uri(), child)));
+        if (resource_or_error.is_error())
+            continue;
+        auto resource = resource_or_error.release_value();
+
+        if (is_directory)
+            for_each_font_file(*resource, seen_files, callback);
+        else
+            callback(*resource);
+    }
+}
+
 void FontDatabase::load_all_fonts_from_uri(StringView uri)
 {
     auto root_or_error = Core::Resource::load_from_uri(uri);
@@ -39,28 +101,25 @@ void FontDatabase::load_all_fonts_from_uri(StringView uri)
     }
     auto root = root_or_error.release_value();
 
-    root->for_each_descendant_file([this](Core::Resource const& resource) -> IterationDecision {
+    auto add_typeface = [this](NonnullRefPtr<Typeface> typeface) {
+        auto& family = m_private->typeface_by_family.ensure(typeface->family(), [] {
+            return Vector<NonnullRefPtr<Typeface>> {};
+        });
+        family.append(move(typeface));
+    };
+
+    for_each_font_file(*root, m_private->loaded_font_files, [&](Core::Resource const& resource) {
         auto uri = resource.uri();
         auto path = LexicalPath(uri.bytes_as_string_view());
         if (path.has_extension(".ttf"sv)) {
-            // FIXME: What about .otf
-            if (auto font_or_error = OpenType::Font::try_load_from_resource(resource); !font_or_error.is_error()) {
-                auto font = font_or_error.release_value();
-                auto& family = m_private->typeface_by_family.ensure(font->family(), [] {
-                    return Vector<NonnullRefPtr<Typeface>> {};
-                });
-                family.append(font);
-            }
+            // The font is parsed in place: its tables are views into the read-only shared mapping of the file, so the
+            // pages are shared with every other process that loads the same font.
+            if (auto font_or_error = OpenType::Font::try_load_from_resource(resource); !font_or_error.is_error())
+                add_typeface(font_or_error.release_value());
         } else if (path.has_extension(".woff"sv)) {
-            if (auto font_or_error = WOFF::Font::try_load_from_resource(resource); !font_or_error.is_error()) {
-                auto font = font_or_error.release_value();
-                auto& family = m_private->typeface_by_family.ensure(font->family(), [] {
-                    return Vector<NonnullRefPtr<Typeface>> {};
-                });
-                family.append(font);
-            }
+            if (auto font_or_error = WOFF::Font::try_load_from_resource(resource); !font_or_error.is_error())
+                add_typeface(font_or_error.release_value());
         }
-        return IterationDecision::Continue;
     });
 }
 
@@ -5,12 +5,43 @@
  */
 
 #define AK_DONT_REPLACE_STD
+#include <AK/ByteReader.h>
+#include <AK/HashMap.h>
+#include <LibCrypto/Hash/SHA2.h>
 #include <LibGfx/Font/OpenType/Font.h>
 #include <LibGfx/Font/WOFF2/Font.h>
 #include <woff2/decode.h>
 
 namespace WOFF2 {
 
+using ContentDigest = Crypto::Hash::SHA256::DigestType;
+
+}
+
+template<>
+struct AK::Traits<WOFF2::ContentDigest> : public DefaultTraits<WOFF2::ContentDigest> {
+    static unsigned hash(WOFF2::ContentDigest const& digest)
+    {
+        // The digest is already uniformly distributed, so any part of it makes a good hash.
+        return ByteReader::load32(digest.immutable_data());
+    }
+};
+
+namespace WOFF2 {
+
+// The totalSfntSize field of the WOFF2 header is only a hint, so don't trust it with more memory than this up front.
+static constexpr size_t max_preallocated_ttf_size = 30 * MiB;
+
+// The same web fonts are used by page after page of a site, and converting them back to TTF is expensive. Keep the
+// most recently used fonts around, keyed by a digest of their WOFF2 data, so that loading them again is a lookup.
+static constexpr size_t max_cached_font_count = 16;
+
+static OrderedHashMap<ContentDigest, NonnullRefPtr<Font>>& font_cache()
+{
+    static OrderedHashMap<ContentDigest, NonnullRefPtr<Font>> cache;
+    return cache;
+}
+
 class WOFF2ByteBufferOut final : public woff2::WOFF2Out {
 public:
     explicit WOFF2ByteBufferOut(ByteBuffer& buffer)
@@ -56,14 +87,35 @@ private:
 
 ErrorOr<NonnullRefPtr<Font>> Font::try_load_from_externally_owned_memory(ReadonlyBytes bytes)
 {
+    auto digest = Crypto::Hash::SHA256::hash(bytes.data(), bytes.size());
+    auto& cache = font_cache();
+    if (auto it = cache.find(digest); it != cache.end()) {
+        // Move the font to the back of the cache, so that the least recently used font is evicted first.
+        auto font = it->value;
+        cache.remove(it);
+        cache.set(digest, font);
+        return font;
+    }
+
     auto ttf_buffer = TRY(ByteBuffer::create_uninitialized(0));
+
+    // The converter writes the TTF table by table, reserve the final size up front so that it isn't copied every
+    // time the buffer has to grow.
+    auto final_size = woff2::ComputeWOFF2FinalSize(bytes.data(), bytes.size());
+    TRY(ttf_buffer.try_ensure_capacity(min(final_size, max_preallocated_ttf_size)));
+
     auto output = WOFF2ByteBufferOut { ttf_buffer };
     auto result = woff2::ConvertWOFF2ToTTF(bytes.data(), bytes.size(), &output);
     if (!result) {
         return Error::from_string_literal("Failed to convert the WOFF2 font to TTF");
     }
     auto input_font = TRY(OpenType::Font::try_load_from_externally_owned_memory(ttf_buffer.bytes()));
-    return adopt_ref(*new Font(input_font, move(ttf_buffer)));
+    auto font = adopt_ref(*new Font(input_font, move(ttf_buffer)));
+
+    if (cache.size() >= max_cached_font_count)
+        cache.remove(cache.begin());
+    cache.set(digest, font);
+    return font;
 }
 
 }
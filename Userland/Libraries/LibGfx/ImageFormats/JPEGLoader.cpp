@@ -23,6 +23,12 @@ struct JPEGLoadingContext {
     RefPtr<Gfx::Bitmap> rgb_bitmap;
     RefPtr<Gfx::CMYKBitmap> cmyk_bitmap;
 
+    // The size of the image as stored in the file, which may be larger than the decoded bitmaps.
+    IntSize natural_size;
+
+    // The decoded bitmaps are natural_size scaled by scale_numerator / 8.
+    int scale_numerator { 8 };
+
     ReadonlyBytes data;
     Vector<u8> icc_data;
 
@@ -31,14 +37,25 @@ struct JPEGLoadingContext {
     {
     }
 
-    ErrorOr<void> decode();
+    ErrorOr<void> decode(Optional<IntSize> ideal_size = {});
+
+    // Picks the smallest scale of N/8 that still produces an image at least as large as the ideal size.
+    static int scale_numerator_for(Optional<IntSize> ideal_size, IntSize natural_size)
+    {
+        if (!ideal_size.has_value() || ideal_size->is_empty() || natural_size.is_empty())
+            return 8;
+        auto scale_for = [](int ideal, int natural) {
+            return clamp((8 * ideal + natural - 1) / natural, 1, 8);
+        };
+        return max(scale_for(ideal_size->width(), natural_size.width()), scale_for(ideal_size->height(), natural_size.height()));
+    }
 };
 
 struct JPEGErrorManager : jpeg_error_mgr {
     jmp_buf setjmp_buffer {};
 };
 
-ErrorOr<void> JPEGLoadingContext::decode()
+ErrorOr<void> JPEGLoadingContext::decode(Optional<IntSize> ideal_size)
 {
     struct jpeg_decompress_struct cinfo;
     struct JPEGErrorManager jerr;
@@ -89,6 +106,18 @@ ErrorOr<void> JPEGLoadingContext::decode()
         cinfo.out_color_space = JCS_EXT_BGRX;
     }
 
+    natural_size = { static_cast<int>(cinfo.image_width), static_cast<int>(cinfo.image_height) };
+
+    // OPTIMIZATION: If we're asked for a smaller image, let libjpeg scale it down in the IDCT, which is much cheaper
+    //               than decoding at full resolution and scaling the bitmap afterwards.
+    scale_numerator = scale_numerator_for(ideal_size, natural_size);
+    cinfo.scale_num = scale_numerator;
+    cinfo.scale_denom = 8;
+
+    rgb_bitmap = nullptr;
+    cmyk_bitmap = nullptr;
+    icc_data.clear();
+
     jpeg_start_decompress(&cinfo);
 
     if (cinfo.out_color_space == JCS_EXT_BGRX) {
@@ -137,11 +166,7 @@ IntSize JPEGImageDecoderPlugin::size()
 
     if (m_context->state == JPEGLoadingContext::State::Error)
         return {};
-    if (m_context->rgb_bitmap)
-        return m_context->rgb_bitmap->size();
-    if (m_context->cmyk_bitmap)
-        return m_context->cmyk_bitmap->size();
-    return {};
+    return m_context->natural_size;
 }
 
 bool JPEGImageDecoderPlugin::sniff(ReadonlyBytes data)
@@ -157,7 +182,7 @@ ErrorOr<NonnullOwnPtr<ImageDecoderPlugin>> JPEGImageDecoderPlugin::create(Readon
     return adopt_own(*new JPEGImageDecoderPlugin(make<JPEGLoadingContext>(data)));
 }
 
-ErrorOr<ImageFrameDescriptor> JPEGImageDecoderPlugin::frame(size_t index, Optional<IntSize>)
+ErrorOr<ImageFrameDescriptor> JPEGImageDecoderPlugin::frame(size_t index, Optional<IntSize> ideal_size)
 {
     if (index > 0)
         return Error::from_string_literal("JPEGImageDecoderPlugin: Invalid frame index");
@@ -165,8 +190,10 @@ ErrorOr<ImageFrameDescriptor> JPEGImageDecoderPlugin::frame(size_t index, Option
     if (m_context->state == JPEGLoadingContext::State::Error)
         return Error::from_string_literal("JPEGImageDecoderPlugin: Decoding failed");
 
-    if (m_context->state < JPEGLoadingContext::State::Decoded) {
-        TRY(m_context->decode());
+    // A bitmap that was decoded at a smaller scale can't be used for a larger ideal size, so decode again in that case.
+    if (m_context->state < JPEGLoadingContext::State::Decoded
+        || JPEGLoadingContext::scale_numerator_for(ideal_size, m_context->natural_size) > m_context->scale_numerator) {
+        TRY(m_context->decode(ideal_size));
         m_context->state = JPEGLoadingContext::State::Decoded;
     }
 
@@ -200,7 +227,7 @@ NaturalFrameFormat JPEGImageDecoderPlugin::natural_frame_format() const
 
 ErrorOr<NonnullRefPtr<CMYKBitmap>> JPEGImageDecoderPlugin::cmyk_frame()
 {
-    if (m_context->state == JPEGLoadingContext::State::NotDecoded)
+    if (m_context->state == JPEGLoadingContext::State::NotDecoded || m_context->scale_numerator != 8)
         (void)frame(0);
 
     if (m_context->state == JPEGLoadingContext::State::Error)
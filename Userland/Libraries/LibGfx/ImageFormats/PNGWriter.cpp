@@ -58,6 +58,9 @@ ErrorOr<ByteBuffer> PNGWriter::encode(Gfx::Bitmap const& bitmap, Options options
         context->row_pointers[y] = const_cast<u8*>(bitmap.scanline_u8(y));
     }
 
+    // FIXME: libpng deflates all rows as a single zlib stream on this thread. Encoding large images in parallel would mean
+    //        writing IDAT ourselves: deflate row ranges independently on worker threads (ending each with a sync flush,
+    //        like pigz does), concatenate them and combine their Adler-32 checksums.
     png_set_rows(png_ptr, info_ptr, context->row_pointers.data());
     png_write_png(png_ptr, info_ptr, PNG_TRANSFORM_IDENTITY, nullptr);
 
@@ -17,6 +17,7 @@
 #include <AK/Function.h>
 #include <AK/Math.h>
 #include <AK/Memory.h>
+#include <AK/SIMDExtras.h>
 #include <AK/Stack.h>
 #include <AK/StdLibExtras.h>
 #include <AK/Utf8View.h>
@@ -68,6 +69,21 @@ void Painter::clear_rect(IntRect const& a_rect, Color color)
     }
 }
 
+// For an opaque destination, Color::blend() reduces to `(destination * (255 - alpha) + source * alpha) / 255` for each
+// channel, which lets us blend 4 pixels at a time with exactly the same result.
+static ALWAYS_INLINE AK::SIMD::u32x4 blend_over_opaque_pixels(AK::SIMD::u32x4 destination, Color color)
+{
+    auto const source_alpha = AK::SIMD::expand4(static_cast<u32>(color.alpha()));
+    auto const inverse_source_alpha = AK::SIMD::expand4(static_cast<u32>(255 - color.alpha()));
+
+    auto blend_channel = [&](u32 shift, u32 source_channel) {
+        AK::SIMD::u32x4 value = ((destination >> shift) & 0xff) * inverse_source_alpha + source_channel * source_alpha;
+        // NOTE: This is an exact division by 255 for all values up to 255 * 255.
+        return ((value + 1 + (value >> 8)) >> 8) << shift;
+    };
+    return blend_channel(16, color.red()) | blend_channel(8, color.green()) | blend_channel(0, color.blue()) | 0xff000000u;
+}
+
 void Painter::fill_physical_rect(IntRect const& physical_rect, Color color)
 {
     // Callers must do clipping.
@@ -76,7 +92,17 @@ void Painter::fill_physical_rect(IntRect const& physical_rect, Color color)
 
     auto dst_format = target().format();
     for (int i = physical_rect.height() - 1; i >= 0; --i) {
-        for (int j = 0; j < physical_rect.width(); ++j)
+        int j = 0;
+        // OPTIMIZATION: Blend 4 pixels at a time, for as long as the destination pixels are opaque.
+        for (; j + 4 <= physical_rect.width(); j += 4) {
+            AK::SIMD::u32x4 pixels;
+            __builtin_memcpy(&pixels, &dst[j], sizeof(pixels));
+            if (dst_format == BitmapFormat::BGRA8888 && !AK::SIMD::all((pixels >> 24) == 0xff))
+                break;
+            pixels = blend_over_opaque_pixels(pixels, color);
+            __builtin_memcpy(&dst[j], &pixels, sizeof(pixels));
+        }
+        for (; j < physical_rect.width(); ++j)
             dst[j] = color_for_format(dst_format, dst[j]).blend(color).value();
         dst += dst_skip;
     }
@@ -349,7 +349,7 @@ void Path::segmentize_path()
         cursor = segment.point();
     }
 
-    m_split_lines = SplitLines { move(segments), bounding_box };
+    m_split_lines = adopt_ref(*new SplitLines(move(segments), bounding_box));
 }
 
 Path Path::copy_transformed(Gfx::AffineTransform const& transform) const
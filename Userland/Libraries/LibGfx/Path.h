@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/AtomicRefCounted.h>
 #include <AK/ByteString.h>
 #include <AK/Optional.h>
 #include <AK/Vector.h>
@@ -203,9 +204,9 @@ public:
 
     ReadonlySpan<FloatLine> split_lines() const
     {
-        if (!m_split_lines.has_value()) {
+        if (!m_split_lines) {
             const_cast<Path*>(this)->segmentize_path();
-            VERIFY(m_split_lines.has_value());
+            VERIFY(m_split_lines);
         }
         return m_split_lines->lines;
     }
@@ -250,7 +251,7 @@ private:
 
     void invalidate_split_lines()
     {
-        m_split_lines.clear();
+        m_split_lines = nullptr;
     }
     void segmentize_path();
 
@@ -268,12 +269,20 @@ private:
     Vector<FloatPoint> m_points {};
     Vector<PathSegment::Command> m_commands {};
 
-    struct SplitLines {
+    struct SplitLines : public AtomicRefCounted<SplitLines> {
+        SplitLines(Vector<FloatLine> lines, Gfx::FloatRect bounding_box)
+            : lines(move(lines))
+            , bounding_box(bounding_box)
+        {
+        }
+
         Vector<FloatLine> lines;
         Gfx::FloatRect bounding_box;
     };
 
-    Optional<SplitLines> m_split_lines {};
+    // Shared between copies of the path, as it is never modified once computed. This keeps copying a path that has
+    // already been split, e.g. into a display list command, from copying all of its lines as well.
+    RefPtr<SplitLines const> m_split_lines;
 };
 
 }
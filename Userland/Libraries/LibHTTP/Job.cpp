@@ -24,10 +24,11 @@ static ErrorOr<ByteBuffer> handle_content_encoding(ByteBuffer const& buf, ByteSt
 {
     dbgln_if(JOB_DEBUG, "Job::handle_content_encoding: buf has content_encoding={}", content_encoding);
 
-    // FIXME: Actually do the decompression of the data using streams, instead of all at once when everything has been
-    //        received. This will require that some of the decompression algorithms are implemented in a streaming way.
-    //        Gzip and Deflate are implemented using Stream, while Brotli uses the newer Core::Stream. The Gzip and
-    //        Deflate implementations will likely need to be changed to LibCore::Stream for this to work easily.
+    // FIXME: Actually do the decompression of the data as it arrives, instead of all at once when everything has been
+    //        received. All of our decompressors are AK::Streams already, but they pull their input and treat running out
+    //        of it as an error. Decoding incrementally from the socket read loop needs decompressors that can suspend
+    //        mid-block and resume once more input has been pushed into them.
+    // FIXME: Support the "zstd" content-coding once LibCompress has a Zstandard decompressor.
 
     if (content_encoding == "gzip") {
         if (!Compress::GzipDecompressor::is_likely_compressed(buf)) {
@@ -8,6 +8,7 @@
 #include <AK/Vector.h>
 #include <LibCore/Socket.h>
 #include <LibCore/Timer.h>
+#include <LibCore/TraceEvent.h>
 #include <LibIPC/Connection.h>
 #include <LibIPC/Message.h>
 #include <LibIPC/Stub.h>
@@ -37,9 +38,14 @@ bool ConnectionBase::is_open() const
 
 ErrorOr<void> ConnectionBase::post_message(Message const& message)
 {
+    if (Core::TraceEvent::is_enabled()) [[unlikely]]
+        Core::TraceEvent::instant("ipc"sv, { message.message_name(), __builtin_strlen(message.message_name()) });
     return post_message(TRY(message.encode()));
 }
 
+// FIXME: Every message is written to the socket with its own syscall. Small async messages posted during the same event
+//        loop turn could be coalesced into a single write, but that needs a flush before every synchronous request, on
+//        shutdown, and before the process blocks outside of the event loop, or messages would be lost or reordered.
 ErrorOr<void> ConnectionBase::post_message(MessageBuffer buffer)
 {
     // NOTE: If this connection is being shut down, but has not yet been destroyed,
@@ -73,6 +79,7 @@ void ConnectionBase::handle_messages()
     auto messages = move(m_unprocessed_messages);
     for (auto& message : messages) {
         if (message->endpoint_magic() == m_local_endpoint_magic) {
+            Core::TraceEvent::Scope trace_scope { "ipc"sv, { message->message_name(), __builtin_strlen(message->message_name()) } };
             auto handler_result = m_local_stub.handle(*message);
             if (handler_result.is_error()) {
                 dbgln("IPC::ConnectionBase::handle_messages: {}", handler_result.error());
@@ -46,6 +46,13 @@ ErrorOr<ByteString> decode(Decoder& decoder)
 template<>
 ErrorOr<ByteBuffer> decode(Decoder& decoder)
 {
+    if (TRY(decoder.decode<bool>())) {
+        auto buffer = TRY(decoder.decode<Core::AnonymousBuffer>());
+        if (!buffer.is_valid())
+            return Error::from_string_literal("Shared memory ByteBuffer is invalid");
+        return ByteBuffer::copy(ReadonlyBytes { buffer.data<u8>(), buffer.size() });
+    }
+
     auto length = TRY(decoder.decode_size());
     if (length == 0)
         return ByteBuffer {};
@@ -73,6 +73,17 @@ ErrorOr<void> encode(Encoder& encoder, ByteString const& value)
 template<>
 ErrorOr<void> encode(Encoder& encoder, ByteBuffer const& value)
 {
+    // OPTIMIZATION: Large buffers (like request and response bodies) would otherwise need many writes to make it through
+    //               the socket, and be copied by the kernel on both ends. Pass them through shared memory instead.
+    bool use_shared_memory = value.size() >= BYTE_BUFFER_SHARED_MEMORY_THRESHOLD;
+    TRY(encoder.encode(use_shared_memory));
+
+    if (use_shared_memory) {
+        auto buffer = TRY(Core::AnonymousBuffer::create_with_size(value.size()));
+        value.span().copy_to({ buffer.data<u8>(), buffer.size() });
+        return encoder.encode(buffer);
+    }
+
     TRY(encoder.encode_size(value.size()));
     TRY(encoder.append(value.data(), value.size()));
     return {};
@@ -35,6 +35,9 @@ private:
     int m_fd;
 };
 
+// ByteBuffers of at least this size are handed to the peer through shared memory instead of through the socket.
+static constexpr size_t BYTE_BUFFER_SHARED_MEMORY_THRESHOLD = 64 * KiB;
+
 class MessageBuffer {
 public:
     MessageBuffer();
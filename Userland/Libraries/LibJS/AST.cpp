@@ -98,7 +98,8 @@ Value FunctionExpression::instantiate_ordinary_function_expression(VM& vm, Depre
 
     auto const used_name = has_own_name ? name() : given_name.view();
     auto environment = NonnullGCPtr { *vm.running_execution_context().lexical_environment };
-    if (has_own_name) {
+    auto needs_name_binding = has_own_name && might_refer_to_own_name();
+    if (needs_name_binding) {
         VERIFY(environment);
         environment = new_declarative_environment(*environment);
         MUST(environment->create_immutable_binding(vm, name(), false));
@@ -112,7 +113,7 @@ Value FunctionExpression::instantiate_ordinary_function_expression(VM& vm, Depre
     // FIXME: 6. Perform SetFunctionName(closure, name).
     // FIXME: 7. Perform MakeConstructor(closure).
 
-    if (has_own_name)
+    if (needs_name_binding)
         MUST(environment->initialize_binding(vm, name(), closure, Environment::InitializeBindingHint::Normal));
 
     return closure;
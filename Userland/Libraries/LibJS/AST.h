@@ -698,6 +698,8 @@ struct FunctionParsingInsights {
     bool uses_this_from_environment { false };
     bool contains_direct_call_to_eval { false };
     bool might_need_arguments_object { false };
+    // The binding of a named function expression's own name only needs to be created if the function might refer to it.
+    bool might_refer_to_own_name { true };
 };
 
 class FunctionNode {
@@ -716,6 +718,7 @@ public:
     FunctionParsingInsights const& parsing_insights() const { return m_parsing_insights; }
     FunctionKind kind() const { return m_kind; }
     bool uses_this_from_environment() const { return m_parsing_insights.uses_this_from_environment; }
+    bool might_refer_to_own_name() const { return m_parsing_insights.might_refer_to_own_name; }
 
     virtual bool has_name() const = 0;
     virtual Value instantiate_ordinary_function_expression(VM&, DeprecatedFlyString given_name) const = 0;
@@ -1217,7 +1217,10 @@ Bytecode::CodeGenerationErrorOr<Optional<ScopedOperand>> FunctionExpression::gen
     bool has_name = !name().is_empty();
     Optional<Bytecode::IdentifierTableIndex> name_identifier;
 
-    if (has_name) {
+    // OPTIMIZATION: The environment holding the function's own name is only observable from inside the function.
+    bool needs_name_binding = has_name && might_refer_to_own_name();
+
+    if (needs_name_binding) {
         generator.begin_variable_scope();
 
         name_identifier = generator.intern_identifier(name());
@@ -1227,7 +1230,7 @@ Bytecode::CodeGenerationErrorOr<Optional<ScopedOperand>> FunctionExpression::gen
     auto new_function = choose_dst(generator, preferred_dst);
     generator.emit_new_function(new_function, *this, lhs_name);
 
-    if (has_name) {
+    if (needs_name_binding) {
         generator.emit<Bytecode::Op::InitializeLexicalBinding>(*name_identifier, new_function);
         generator.end_variable_scope();
     }
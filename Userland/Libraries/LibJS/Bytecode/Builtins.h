@@ -12,19 +12,37 @@
 namespace JS::Bytecode {
 
 // TitleCaseName, snake_case_name, base, property, argument_count
-#define JS_ENUMERATE_BUILTINS(O)             \
-    O(MathAbs, math_abs, Math, abs, 1)       \
-    O(MathLog, math_log, Math, log, 1)       \
-    O(MathPow, math_pow, Math, pow, 2)       \
-    O(MathExp, math_exp, Math, exp, 1)       \
-    O(MathCeil, math_ceil, Math, ceil, 1)    \
-    O(MathFloor, math_floor, Math, floor, 1) \
-    O(MathRound, math_round, Math, round, 1) \
-    O(MathSqrt, math_sqrt, Math, sqrt, 1)
+#define JS_ENUMERATE_BUILTINS(O)                       \
+    O(MathAbs, math_abs, Math, abs, 1)                 \
+    O(MathLog, math_log, Math, log, 1)                 \
+    O(MathPow, math_pow, Math, pow, 2)                 \
+    O(MathExp, math_exp, Math, exp, 1)                 \
+    O(MathCeil, math_ceil, Math, ceil, 1)              \
+    O(MathFloor, math_floor, Math, floor, 1)           \
+    O(MathRound, math_round, Math, round, 1)           \
+    O(MathSqrt, math_sqrt, Math, sqrt, 1)              \
+    O(MathTrunc, math_trunc, Math, trunc, 1)           \
+    O(MathSin, math_sin, Math, sin, 1)                 \
+    O(MathCos, math_cos, Math, cos, 1)                 \
+    O(MathTan, math_tan, Math, tan, 1)                 \
+    O(MathMin, math_min, Math, min, 2)                 \
+    O(MathMax, math_max, Math, max, 2)                 \
+    O(ObjectHasOwn, object_has_own, Object, hasOwn, 2)
+
+// Builtins that are called as methods, like `string.charCodeAt(index)`. As the base can be any expression, calls are
+// recognized by the name of the property alone.
+// TitleCaseName, snake_case_name, prototype, property, argument_count
+#define JS_ENUMERATE_PROTOTYPE_BUILTINS(O)                                             \
+    O(StringPrototypeCharCodeAt, string_prototype_char_code_at, String, charCodeAt, 1) \
+    O(StringPrototypeIndexOf, string_prototype_index_of, String, indexOf, 1)           \
+    O(StringPrototypeSlice, string_prototype_slice, String, slice, 2)                  \
+    O(ArrayPrototypePush, array_prototype_push, Array, push, 1)                        \
+    O(ArrayPrototypePop, array_prototype_pop, Array, pop, 0)
 
 enum class Builtin : u8 {
 #define DEFINE_BUILTIN_ENUM(name, ...) name,
     JS_ENUMERATE_BUILTINS(DEFINE_BUILTIN_ENUM)
+        JS_ENUMERATE_PROTOTYPE_BUILTINS(DEFINE_BUILTIN_ENUM)
 #undef DEFINE_BUILTIN_ENUM
         __Count,
 };
@@ -36,6 +54,11 @@ static StringView builtin_name(Builtin value)
     case Builtin::name:                                                 \
         return #base "." #property##sv;
         JS_ENUMERATE_BUILTINS(DEFINE_BUILTIN_CASE)
+#undef DEFINE_BUILTIN_CASE
+#define DEFINE_BUILTIN_CASE(name, snake_case_name, prototype, property, ...) \
+    case Builtin::name:                                                      \
+        return #prototype ".prototype." #property##sv;
+        JS_ENUMERATE_PROTOTYPE_BUILTINS(DEFINE_BUILTIN_CASE)
 #undef DEFINE_BUILTIN_CASE
     case Builtin::__Count:
         VERIFY_NOT_REACHED();
@@ -50,6 +73,7 @@ inline size_t builtin_argument_count(Builtin value)
     case Builtin::name:                                                            \
         return arg_count;
         JS_ENUMERATE_BUILTINS(DEFINE_BUILTIN_CASE)
+        JS_ENUMERATE_PROTOTYPE_BUILTINS(DEFINE_BUILTIN_CASE)
 #undef DEFINE_BUILTIN_CASE
     case Builtin::__Count:
         VERIFY_NOT_REACHED();
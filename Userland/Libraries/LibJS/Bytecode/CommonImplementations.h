@@ -128,37 +128,37 @@ inline ThrowCompletionOr<Value> get_by_id(VM& vm, Optional<DeprecatedFlyString c
 
     auto& shape = base_obj->shape();
 
-    if (cache.prototype) {
-        // OPTIMIZATION: If the prototype chain hasn't been mutated in a way that would invalidate the cache, we can use it.
-        bool can_use_cache = [&]() -> bool {
-            if (&shape != cache.shape)
-                return false;
-            if (!cache.prototype_chain_validity)
-                return false;
-            if (!cache.prototype_chain_validity->is_valid())
-                return false;
-            return true;
-        }();
-        if (can_use_cache)
-            return cache.prototype->get_direct(cache.property_offset.value());
-    } else if (&shape == cache.shape) {
-        // OPTIMIZATION: If the shape of the object hasn't changed, we can use the cached property offset.
-        return base_obj->get_direct(cache.property_offset.value());
+    for (auto& cache_entry : cache.entries) {
+        if (&shape != cache_entry.shape)
+            continue;
+        if (cache_entry.prototype) {
+            // OPTIMIZATION: If the prototype chain hasn't been mutated in a way that would invalidate the cache, we can use it.
+            if (cache_entry.prototype_chain_validity && cache_entry.prototype_chain_validity->is_valid()) {
+                cache.record_hit();
+                return cache_entry.prototype->get_direct(cache_entry.property_offset.value());
+            }
+            // The prototype chain has changed, so this entry can never hit again.
+            cache_entry = {};
+        } else {
+            // OPTIMIZATION: If the shape of the object hasn't changed, we can use the cached property offset.
+            cache.record_hit();
+            return base_obj->get_direct(cache_entry.property_offset.value());
+        }
     }
 
+    cache.record_miss();
+
     CacheablePropertyMetadata cacheable_metadata;
     auto value = TRY(base_obj->internal_get(property, this_value, &cacheable_metadata));
 
     if (cacheable_metadata.type == CacheablePropertyMetadata::Type::OwnProperty) {
-        cache = {};
-        cache.shape = shape;
-        cache.property_offset = cacheable_metadata.property_offset.value();
+        auto& cache_entry = cache.insert_new_entry(shape);
+        cache_entry.property_offset = cacheable_metadata.property_offset.value();
     } else if (cacheable_metadata.type == CacheablePropertyMetadata::Type::InPrototypeChain) {
-        cache = {};
-        cache.shape = &base_obj->shape();
-        cache.property_offset = cacheable_metadata.property_offset.value();
-        cache.prototype = *cacheable_metadata.prototype;
-        cache.prototype_chain_validity = *cacheable_metadata.prototype->shape().prototype_chain_validity();
+        auto& cache_entry = cache.insert_new_entry(base_obj->shape());
+        cache_entry.property_offset = cacheable_metadata.property_offset.value();
+        cache_entry.prototype = *cacheable_metadata.prototype;
+        cache_entry.prototype_chain_validity = *cacheable_metadata.prototype->shape().prototype_chain_validity();
     }
 
     return value;
@@ -210,6 +210,10 @@ inline ThrowCompletionOr<Value> get_by_value(VM& vm, Optional<DeprecatedFlyStrin
                     return fast_typed_array_get_element<i32>(typed_array, index);
                 case TypedArrayBase::Kind::Uint8ClampedArray:
                     return fast_typed_array_get_element<u8>(typed_array, index);
+                case TypedArrayBase::Kind::Float32Array:
+                    return fast_typed_array_get_element<float>(typed_array, index);
+                case TypedArrayBase::Kind::Float64Array:
+                    return fast_typed_array_get_element<double>(typed_array, index);
                 default:
                     // FIXME: Support more TypedArray kinds.
                     break;
@@ -245,14 +249,40 @@ inline ThrowCompletionOr<Value> get_global(Interpreter& interpreter, IdentifierT
     auto& binding_object = interpreter.global_object();
     auto& declarative_record = interpreter.global_declarative_environment();
 
-    // OPTIMIZATION: If the shape of the object hasn't changed, we can use the cached property offset.
     auto& shape = binding_object.shape();
-    if (cache.environment_serial_number == declarative_record.environment_serial_number()
-        && &shape == cache.shape) {
-        return binding_object.get_direct(cache.property_offset.value());
+    if (cache.environment.ptr() == &declarative_record && cache.environment_serial_number == declarative_record.environment_serial_number()) {
+        // OPTIMIZATION: Bindings of the module environment and the global declarative environment keep their index
+        //               as long as no bindings are added to the global declarative environment.
+        if (cache.environment_binding_index.has_value()) {
+            if (!cache.in_module_environment) {
+                cache.record_hit();
+                return declarative_record.get_binding_value_direct(vm, cache.environment_binding_index.value());
+            }
+            if (auto const* module = vm.running_execution_context().script_or_module.get_pointer<NonnullGCPtr<Module>>()) {
+                cache.record_hit();
+                auto& module_environment = static_cast<DeclarativeEnvironment&>(*(*module)->environment());
+                return module_environment.get_binding_value_direct(vm, cache.environment_binding_index.value());
+            }
+        } else if (auto& cache_entry = cache.entries[0]; &shape == cache_entry.shape) {
+            // OPTIMIZATION: If the shape of the object hasn't changed, we can use the cached property offset.
+            if (!cache_entry.prototype) {
+                cache.record_hit();
+                return binding_object.get_direct(cache_entry.property_offset.value());
+            }
+            // OPTIMIZATION: Globals that live on a prototype of the global object, like the methods of Window and
+            //               WorkerGlobalScope, can be used as long as the prototype chain hasn't changed.
+            if (cache_entry.prototype_chain_validity && cache_entry.prototype_chain_validity->is_valid()) {
+                cache.record_hit();
+                return cache_entry.prototype->get_direct(cache_entry.property_offset.value());
+            }
+        }
     }
 
+    cache.record_miss();
+    cache.environment = declarative_record;
     cache.environment_serial_number = declarative_record.environment_serial_number();
+    cache.environment_binding_index = {};
+    cache.in_module_environment = false;
 
     auto& identifier = interpreter.current_executable().get_identifier(identifier_index);
 
@@ -260,14 +290,21 @@ inline ThrowCompletionOr<Value> get_global(Interpreter& interpreter, IdentifierT
         // NOTE: GetGlobal is used to access variables stored in the module environment and global environment.
         //       The module environment is checked first since it precedes the global environment in the environment chain.
         auto& module_environment = *vm.running_execution_context().script_or_module.get<NonnullGCPtr<Module>>()->environment();
-        if (TRY(module_environment.has_binding(identifier))) {
-            // TODO: Cache offset of binding value
+        Optional<size_t> index;
+        if (TRY(module_environment.has_binding(identifier, &index))) {
+            // NOTE: Imported bindings don't have an index, as they live in the environment of another module.
+            if (index.has_value()) {
+                cache.environment_binding_index = static_cast<u32>(index.value());
+                cache.in_module_environment = true;
+            }
             return TRY(module_environment.get_binding_value(vm, identifier, vm.in_strict_mode()));
         }
     }
 
-    if (TRY(declarative_record.has_binding(identifier))) {
-        // TODO: Cache offset of binding value
+    Optional<size_t> index;
+    if (TRY(declarative_record.has_binding(identifier, &index))) {
+        if (index.has_value())
+            cache.environment_binding_index = static_cast<u32>(index.value());
         return TRY(declarative_record.get_binding_value(vm, identifier, vm.in_strict_mode()));
     }
 
@@ -275,8 +312,13 @@ inline ThrowCompletionOr<Value> get_global(Interpreter& interpreter, IdentifierT
         CacheablePropertyMetadata cacheable_metadata;
         auto value = TRY(binding_object.internal_get(identifier, js_undefined(), &cacheable_metadata));
         if (cacheable_metadata.type == CacheablePropertyMetadata::Type::OwnProperty) {
-            cache.shape = shape;
-            cache.property_offset = cacheable_metadata.property_offset.value();
+            auto& cache_entry = cache.insert_new_entry(shape);
+            cache_entry.property_offset = cacheable_metadata.property_offset.value();
+        } else if (cacheable_metadata.type == CacheablePropertyMetadata::Type::InPrototypeChain) {
+            auto& cache_entry = cache.insert_new_entry(shape);
+            cache_entry.property_offset = cacheable_metadata.property_offset.value();
+            cache_entry.prototype = *cacheable_metadata.prototype;
+            cache_entry.prototype_chain_validity = *cacheable_metadata.prototype->shape().prototype_chain_validity();
         }
         return value;
     }
@@ -316,17 +358,23 @@ inline ThrowCompletionOr<void> put_by_property_key(VM& vm, Value base, Value thi
         break;
     }
     case Op::PropertyKind::KeyValue: {
-        if (cache && cache->shape == &object->shape()) {
-            object->put_direct(*cache->property_offset, value);
-            return {};
+        if (cache) {
+            for (auto& cache_entry : cache->entries) {
+                if (cache_entry.shape == &object->shape()) {
+                    cache->record_hit();
+                    object->put_direct(*cache_entry.property_offset, value);
+                    return {};
+                }
+            }
+            cache->record_miss();
         }
 
         CacheablePropertyMetadata cacheable_metadata;
         bool succeeded = TRY(object->internal_set(name, value, this_value, &cacheable_metadata));
 
         if (succeeded && cache && cacheable_metadata.type == CacheablePropertyMetadata::Type::OwnProperty) {
-            cache->shape = object->shape();
-            cache->property_offset = cacheable_metadata.property_offset.value();
+            auto& cache_entry = cache->insert_new_entry(object->shape());
+            cache_entry.property_offset = cacheable_metadata.property_offset.value();
         }
 
         if (!succeeded && vm.in_strict_mode()) {
@@ -462,12 +510,31 @@ inline ThrowCompletionOr<void> put_by_value(VM& vm, Value base, Optional<Depreca
                 case TypedArrayBase::Kind::Uint8ClampedArray:
                     fast_typed_array_set_element<u8>(typed_array, index, clamp(value.as_i32(), 0, 255));
                     return {};
+                case TypedArrayBase::Kind::Float32Array:
+                    fast_typed_array_set_element<float>(typed_array, index, static_cast<float>(value.as_i32()));
+                    return {};
+                case TypedArrayBase::Kind::Float64Array:
+                    fast_typed_array_set_element<double>(typed_array, index, static_cast<double>(value.as_i32()));
+                    return {};
                 default:
                     // FIXME: Support more TypedArray kinds.
                     break;
                 }
             }
 
+            if (value.is_double() && is_valid_integer_index(typed_array, canonical_index)) {
+                switch (typed_array.kind()) {
+                case TypedArrayBase::Kind::Float32Array:
+                    fast_typed_array_set_element<float>(typed_array, index, static_cast<float>(value.as_double()));
+                    return {};
+                case TypedArrayBase::Kind::Float64Array:
+                    fast_typed_array_set_element<double>(typed_array, index, value.as_double());
+                    return {};
+                default:
+                    break;
+                }
+            }
+
             if (typed_array.kind() == TypedArrayBase::Kind::Uint32Array && value.is_integral_number()) {
                 auto integer = value.as_double();
 
@@ -4,14 +4,42 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
 #include <LibJS/Bytecode/BasicBlock.h>
 #include <LibJS/Bytecode/Executable.h>
 #include <LibJS/Bytecode/Instruction.h>
 #include <LibJS/Bytecode/RegexTable.h>
+#include <LibJS/Runtime/Shape.h>
 #include <LibJS/SourceCode.h>
 
 namespace JS::Bytecode {
 
+PropertyLookupCache::Entry& PropertyLookupCache::insert_new_entry(Shape& shape)
+{
+    auto can_still_hit = [&](Entry const& entry) {
+        if (!entry.shape || entry.shape.ptr() == &shape)
+            return false;
+        if (!entry.prototype)
+            return true;
+        return entry.prototype_chain_validity && entry.prototype_chain_validity->is_valid();
+    };
+
+    auto old_entries = move(entries);
+    entries = {};
+
+    // Slot 0 is taken by the new entry, so the entries that are kept move down by one.
+    size_t number_of_kept_entries = 1;
+    for (auto& entry : old_entries) {
+        if (number_of_kept_entries == entries.size())
+            break;
+        if (can_still_hit(entry))
+            entries[number_of_kept_entries++] = move(entry);
+    }
+
+    entries[0].shape = shape;
+    return entries[0];
+}
+
 JS_DEFINE_ALLOCATOR(Executable);
 
 Executable::Executable(
@@ -42,7 +70,7 @@ Executable::~Executable() = default;
 
 void Executable::dump() const
 {
-    warnln("\033[37;1mJS bytecode executable\033[0m \"{}\"", name);
+    warnln("\033[37;1mJS bytecode executable\033[0m \"{}\" (invocations: {}, back edges: {})", name, invocation_count, back_edge_count);
     InstructionStreamIterator it(bytecode, this);
 
     size_t basic_block_offset_index = 0;
@@ -68,6 +96,20 @@ void Executable::dump() const
         ++it;
     }
 
+    bool has_executed_property_lookups = any_of(property_lookup_caches, [](auto const& cache) {
+        return cache.hit_count != 0 || cache.miss_count != 0;
+    });
+    if (has_executed_property_lookups) {
+        warnln("");
+        warnln("Property lookup caches:");
+        for (size_t i = 0; i < property_lookup_caches.size(); ++i) {
+            auto const& cache = property_lookup_caches[i];
+            if (cache.hit_count == 0 && cache.miss_count == 0)
+                continue;
+            warnln("    #{}: {} hits, {} misses", i, cache.hit_count, cache.miss_count);
+        }
+    }
+
     if (!exception_handlers.is_empty()) {
         warnln("");
         warnln("Exception handlers:");
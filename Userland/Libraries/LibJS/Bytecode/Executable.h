@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <AK/Array.h>
+#include <AK/Debug.h>
 #include <AK/DeprecatedFlyString.h>
 #include <AK/HashMap.h>
 #include <AK/NonnullOwnPtr.h>
@@ -23,14 +25,46 @@
 namespace JS::Bytecode {
 
 struct PropertyLookupCache {
-    WeakPtr<Shape> shape;
-    Optional<u32> property_offset;
-    WeakPtr<Object> prototype;
-    WeakPtr<PrototypeChainValidity> prototype_chain_validity;
+    static constexpr size_t max_number_of_shapes_to_remember = 4;
+
+    struct Entry {
+        WeakPtr<Shape> shape;
+        Optional<u32> property_offset;
+        WeakPtr<Object> prototype;
+        WeakPtr<PrototypeChainValidity> prototype_chain_validity;
+    };
+
+    // Makes room for a new entry for the given shape at the front. An existing entry for the same shape is replaced,
+    // and entries that can no longer hit are dropped before the least recently added one is evicted.
+    Entry& insert_new_entry(Shape&);
+
+    // The hit and miss counts are only kept when bytecode statistics are enabled.
+    void record_hit()
+    {
+        if constexpr (JS_BYTECODE_STATS_DEBUG)
+            ++hit_count;
+    }
+
+    void record_miss()
+    {
+        if constexpr (JS_BYTECODE_STATS_DEBUG)
+            ++miss_count;
+    }
+
+    AK::Array<Entry, max_number_of_shapes_to_remember> entries;
+    u32 hit_count { 0 };
+    u32 miss_count { 0 };
 };
 
 struct GlobalVariableCache : public PropertyLookupCache {
+    // Parsed scripts can be shared between realms, so the serial number is only meaningful together with the
+    // global declarative environment it was read from.
+    WeakPtr<DeclarativeEnvironment> environment;
     u64 environment_serial_number { 0 };
+
+    // Set when the variable was found in the module environment or the global declarative environment.
+    Optional<u32> environment_binding_index;
+    bool in_module_environment { false };
 };
 
 struct SourceRecord {
@@ -70,6 +104,20 @@ public:
     size_t number_of_registers { 0 };
     bool is_strict_mode { false };
 
+    // Hotness counters, bumped by the interpreter on entry and on backward jumps.
+    // These are what a higher execution tier would key off to decide when an
+    // executable is worth compiling to native code.
+    u64 invocation_count { 0 };
+    u64 back_edge_count { 0 };
+
+    // Only counted when LibJS is built with JS_BYTECODE_STATS_DEBUG, see Interpreter::bytecode_statistics().
+    u64 executed_instruction_count { 0 };
+
+    static constexpr u32 hot_invocation_threshold = 1000;
+    static constexpr u32 hot_back_edge_threshold = 10000;
+
+    [[nodiscard]] bool is_hot() const { return invocation_count >= hot_invocation_threshold || back_edge_count >= hot_back_edge_threshold; }
+
     struct ExceptionHandlers {
         size_t start_offset;
         size_t end_offset;
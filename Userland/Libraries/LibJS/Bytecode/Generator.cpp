@@ -10,6 +10,7 @@
 #include <LibJS/Bytecode/BasicBlock.h>
 #include <LibJS/Bytecode/Generator.h>
 #include <LibJS/Bytecode/Instruction.h>
+#include <LibJS/Bytecode/Interpreter.h>
 #include <LibJS/Bytecode/Op.h>
 #include <LibJS/Bytecode/Register.h>
 #include <LibJS/Runtime/ECMAScriptFunctionObject.h>
@@ -319,6 +320,37 @@ CodeGenerationErrorOr<NonnullGCPtr<Executable>> Generator::compile(VM& vm, ASTNo
     if (undefined_constant.has_value())
         undefined_constant.value().operand().offset_index_by(number_of_registers);
 
+    // Pass: Thread jumps through blocks that do nothing but jump somewhere else.
+    if (g_optimize_bytecode) {
+        auto forwarded_target = [&](Label label) {
+            // NOTE: The hop limit keeps us from spinning forever on a cycle of jump-only blocks.
+            for (size_t hops = 0; hops < generator.m_root_basic_blocks.size(); ++hops) {
+                auto const& target_block = *generator.m_root_basic_blocks[label.basic_block_index()];
+                if (!target_block.is_terminated())
+                    break;
+                auto const& first_instruction = *InstructionStreamIterator { target_block.instruction_stream() };
+                if (first_instruction.type() != Instruction::Type::Jump)
+                    break;
+                auto next_label = static_cast<Op::Jump const&>(first_instruction).target();
+                if (next_label.basic_block_index() == label.basic_block_index())
+                    break;
+                label = next_label;
+            }
+            return label;
+        };
+
+        for (auto& block : generator.m_root_basic_blocks) {
+            Bytecode::InstructionStreamIterator it(block->instruction_stream());
+            while (!it.at_end()) {
+                auto& instruction = const_cast<Instruction&>(*it);
+                instruction.visit_labels([&](Label& label) {
+                    label = forwarded_target(label);
+                });
+                ++it;
+            }
+        }
+    }
+
     for (auto& block : generator.m_root_basic_blocks) {
         basic_block_start_offsets.append(bytecode.size());
         if (block->handler() || block->finalizer()) {
@@ -332,14 +364,27 @@ CodeGenerationErrorOr<NonnullGCPtr<Executable>> Generator::compile(VM& vm, ASTNo
 
         block_offsets.set(block.ptr(), bytecode.size());
 
-        for (auto& [offset, source_record] : block->source_map()) {
-            source_map.set(bytecode.size() + offset, source_record);
-        }
-
         Bytecode::InstructionStreamIterator it(block->instruction_stream());
         while (!it.at_end()) {
             auto& instruction = const_cast<Instruction&>(*it);
 
+            // NOTE: We map source records per instruction, since the optimizations below may drop or
+            //       replace instructions and shift everything after them. An instruction's record is only added
+            //       once something is emitted for it, so dropped instructions don't leave theirs behind.
+            auto map_source_record = [&, source_record = block->source_map().get(it.offset())] {
+                if (source_record.has_value())
+                    source_map.set(bytecode.size(), *source_record);
+            };
+
+            // OPTIMIZATION: Don't emit moves from an operand to itself.
+            if (g_optimize_bytecode && instruction.type() == Instruction::Type::Mov) {
+                auto& mov = static_cast<Bytecode::Op::Mov&>(instruction);
+                if (mov.dst() == mov.src()) {
+                    ++it;
+                    continue;
+                }
+            }
+
             if (instruction.type() == Instruction::Type::Jump) {
                 auto& jump = static_cast<Bytecode::Op::Jump&>(instruction);
 
@@ -362,6 +407,7 @@ CodeGenerationErrorOr<NonnullGCPtr<Executable>> Generator::compile(VM& vm, ASTNo
                     if (target_instruction.type() == Instruction::Type::Return) {
                         auto& return_instruction = static_cast<Bytecode::Op::Return const&>(target_instruction);
                         Op::Return return_op(return_instruction.value());
+                        map_source_record();
                         bytecode.append(reinterpret_cast<u8 const*>(&return_op), return_op.length());
                         ++it;
                         continue;
@@ -370,6 +416,7 @@ CodeGenerationErrorOr<NonnullGCPtr<Executable>> Generator::compile(VM& vm, ASTNo
                     if (target_instruction.type() == Instruction::Type::End) {
                         auto& return_instruction = static_cast<Bytecode::Op::End const&>(target_instruction);
                         Op::End end_op(return_instruction.value());
+                        map_source_record();
                         bytecode.append(reinterpret_cast<u8 const*>(&end_op), end_op.length());
                         ++it;
                         continue;
@@ -386,6 +433,7 @@ CodeGenerationErrorOr<NonnullGCPtr<Executable>> Generator::compile(VM& vm, ASTNo
                     auto& label = jump_false.target();
                     size_t label_offset = bytecode.size() + (bit_cast<FlatPtr>(&label) - bit_cast<FlatPtr>(&jump_false));
                     label_offsets.append(label_offset);
+                    map_source_record();
                     bytecode.append(reinterpret_cast<u8 const*>(&jump_false), jump_false.length());
                     ++it;
                     continue;
@@ -395,6 +443,7 @@ CodeGenerationErrorOr<NonnullGCPtr<Executable>> Generator::compile(VM& vm, ASTNo
                     auto& label = jump_true.target();
                     size_t label_offset = bytecode.size() + (bit_cast<FlatPtr>(&label) - bit_cast<FlatPtr>(&jump_true));
                     label_offsets.append(label_offset);
+                    map_source_record();
                     bytecode.append(reinterpret_cast<u8 const*>(&jump_true), jump_true.length());
                     ++it;
                     continue;
@@ -405,6 +454,7 @@ CodeGenerationErrorOr<NonnullGCPtr<Executable>> Generator::compile(VM& vm, ASTNo
                 size_t label_offset = bytecode.size() + (bit_cast<FlatPtr>(&label) - bit_cast<FlatPtr>(&instruction));
                 label_offsets.append(label_offset);
             });
+            map_source_record();
             bytecode.append(reinterpret_cast<u8 const*>(&instruction), instruction.length());
             ++it;
         }
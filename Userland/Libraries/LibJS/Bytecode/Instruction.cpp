@@ -111,8 +111,7 @@ RefPtr<SourceCode> InstructionStreamIterator::source_code() const
 }
 
 Operand::Operand(Register reg)
-    : m_type(Type::Register)
-    , m_index(reg.index())
+    : Operand(Type::Register, reg.index())
 {
 }
 
@@ -6,6 +6,8 @@
 
 #include <AK/Debug.h>
 #include <AK/HashTable.h>
+#include <AK/JsonArray.h>
+#include <AK/QuickSort.h>
 #include <AK/TemporaryChange.h>
 #include <LibJS/AST.h>
 #include <LibJS/Bytecode/BasicBlock.h>
@@ -17,6 +19,7 @@
 #include <LibJS/Bytecode/Op.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Array.h>
+#include <LibJS/Runtime/ArrayPrototype.h>
 #include <LibJS/Runtime/BigInt.h>
 #include <LibJS/Runtime/DeclarativeEnvironment.h>
 #include <LibJS/Runtime/ECMAScriptFunctionObject.h>
@@ -27,10 +30,13 @@
 #include <LibJS/Runtime/Iterator.h>
 #include <LibJS/Runtime/MathObject.h>
 #include <LibJS/Runtime/NativeFunction.h>
+#include <LibJS/Runtime/ObjectConstructor.h>
 #include <LibJS/Runtime/ObjectEnvironment.h>
 #include <LibJS/Runtime/Realm.h>
 #include <LibJS/Runtime/Reference.h>
 #include <LibJS/Runtime/RegExpObject.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
+#include <LibJS/Runtime/StringPrototype.h>
 #include <LibJS/Runtime/Value.h>
 #include <LibJS/Runtime/ValueInlines.h>
 #include <LibJS/SourceTextModule.h>
@@ -38,6 +44,7 @@
 namespace JS::Bytecode {
 
 bool g_dump_bytecode = false;
+bool g_optimize_bytecode = true;
 
 static ByteString format_operand(StringView name, Operand operand, Bytecode::Executable const& executable)
 {
@@ -154,6 +161,41 @@ Interpreter::~Interpreter()
 {
 }
 
+Span<Value> Interpreter::allocate_register_window(size_t count)
+{
+    while (m_current_register_stack_chunk < m_register_stack_chunks.size()) {
+        auto& chunk = m_register_stack_chunks[m_current_register_stack_chunk];
+        if (chunk.capacity() - chunk.size() >= count)
+            break;
+        // Chunks above the top of the stack are empty, so one that is too small can be made bigger.
+        if (chunk.is_empty() && m_current_register_stack_chunk == m_register_stack_chunks.size() - 1) {
+            chunk.ensure_capacity(count);
+            break;
+        }
+        ++m_current_register_stack_chunk;
+    }
+    if (m_current_register_stack_chunk == m_register_stack_chunks.size()) {
+        Vector<Value> chunk;
+        chunk.ensure_capacity(max(register_stack_chunk_size, count));
+        m_register_stack_chunks.append(move(chunk));
+    }
+
+    // NOTE: The capacity was reserved up front, so this never moves the values of windows that are in use.
+    auto& chunk = m_register_stack_chunks[m_current_register_stack_chunk];
+    auto offset = chunk.size();
+    chunk.resize(offset + count);
+    return chunk.span().slice(offset, count);
+}
+
+void Interpreter::deallocate_register_window(Span<Value> window)
+{
+    auto& chunk = m_register_stack_chunks[m_current_register_stack_chunk];
+    VERIFY(window.data() + window.size() == chunk.data() + chunk.size());
+    chunk.shrink(chunk.size() - window.size());
+    while (m_current_register_stack_chunk > 0 && m_register_stack_chunks[m_current_register_stack_chunk].is_empty())
+        --m_current_register_stack_chunk;
+}
+
 ALWAYS_INLINE Value Interpreter::get(Operand op) const
 {
     return m_registers_and_constants_and_locals.data()[op.index()];
@@ -355,6 +397,9 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
 
     TemporaryChange change(m_program_counter, Optional<size_t&>(program_counter));
 
+    if (auto* sampling_profiler = vm().sampling_profiler(); sampling_profiler && sampling_profiler->sample_requested()) [[unlikely]]
+        sampling_profiler->take_sample();
+
     // Declare a lookup table for computed goto with each of the `handle_*` labels
     // to avoid the overhead of a switch statement.
     // This is a GCC extension, but it's also supported by Clang.
@@ -365,6 +410,14 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
     };
 #undef SET_UP_LABEL
 
+#define COUNT_INSTRUCTION(type)                                         \
+    do {                                                                \
+        if constexpr (JS_BYTECODE_STATS_DEBUG) {                        \
+            ++m_instruction_execution_counts[static_cast<size_t>(type)]; \
+            ++executable.executed_instruction_count;                    \
+        }                                                               \
+    } while (0)
+
 #define DISPATCH_NEXT(name)                                                                         \
     do {                                                                                            \
         if constexpr (Op::name::IsVariableLength)                                                   \
@@ -372,12 +425,14 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
         else                                                                                        \
             program_counter += sizeof(Op::name);                                                    \
         auto& next_instruction = *reinterpret_cast<Instruction const*>(&bytecode[program_counter]); \
+        COUNT_INSTRUCTION(next_instruction.type());                                                 \
         goto* bytecode_dispatch_table[static_cast<size_t>(next_instruction.type())];                \
     } while (0)
 
     for (;;) {
     start:
         for (;;) {
+            COUNT_INSTRUCTION((*reinterpret_cast<Instruction const*>(&bytecode[program_counter])).type());
             goto* bytecode_dispatch_table[static_cast<size_t>((*reinterpret_cast<Instruction const*>(&bytecode[program_counter])).type())];
 
         handle_GetArgument: {
@@ -406,7 +461,13 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
 
         handle_Jump: {
             auto& instruction = *reinterpret_cast<Op::Jump const*>(&bytecode[program_counter]);
-            program_counter = instruction.target().address();
+            auto target = instruction.target().address();
+            if (target <= program_counter) {
+                ++executable.back_edge_count;
+                if (auto* sampling_profiler = vm().sampling_profiler(); sampling_profiler && sampling_profiler->sample_requested()) [[unlikely]]
+                    sampling_profiler->take_sample();
+            }
+            program_counter = target;
             goto start;
         }
 
@@ -708,12 +769,11 @@ Interpreter::ResultAndReturnRegister Interpreter::run_executable(Executable& exe
 
     auto& running_execution_context = vm().running_execution_context();
     u32 registers_and_constants_and_locals_count = executable.number_of_registers + executable.constants.size() + executable.local_variable_names.size();
-    if (running_execution_context.registers_and_constants_and_locals.size() < registers_and_constants_and_locals_count)
-        running_execution_context.registers_and_constants_and_locals.resize(registers_and_constants_and_locals_count);
+    running_execution_context.ensure_registers_and_constants_and_locals(registers_and_constants_and_locals_count);
 
     TemporaryChange restore_running_execution_context { m_running_execution_context, &running_execution_context };
     TemporaryChange restore_arguments { m_arguments, running_execution_context.arguments.span() };
-    TemporaryChange restore_registers_and_constants_and_locals { m_registers_and_constants_and_locals, running_execution_context.registers_and_constants_and_locals.span() };
+    TemporaryChange restore_registers_and_constants_and_locals { m_registers_and_constants_and_locals, running_execution_context.registers_and_constants_and_locals };
 
     reg(Register::accumulator()) = initial_accumulator_value;
     reg(Register::return_value()) = {};
@@ -727,6 +787,9 @@ Interpreter::ResultAndReturnRegister Interpreter::run_executable(Executable& exe
 
     running_execution_context.executable = &executable;
 
+    if (!entry_point.has_value())
+        ++executable.invocation_count;
+
     for (size_t i = 0; i < executable.constants.size(); ++i) {
         running_execution_context.registers_and_constants_and_locals[executable.number_of_registers + i] = executable.constants[i];
     }
@@ -765,6 +828,101 @@ Interpreter::ResultAndReturnRegister Interpreter::run_executable(Executable& exe
     return { return_value, running_execution_context.registers_and_constants_and_locals[0] };
 }
 
+static JsonObject inline_cache_statistics(u64 hit_count, u64 miss_count)
+{
+    JsonObject statistics;
+    statistics.set("hits"sv, hit_count);
+    statistics.set("misses"sv, miss_count);
+    if (auto lookup_count = hit_count + miss_count; lookup_count > 0)
+        statistics.set("hit_rate"sv, static_cast<double>(hit_count) / static_cast<double>(lookup_count));
+    return statistics;
+}
+
+JsonObject Interpreter::bytecode_statistics()
+{
+    static constexpr AK::Array instruction_type_names {
+#define __BYTECODE_OP(op) #op##sv,
+        ENUMERATE_BYTECODE_OPS(__BYTECODE_OP)
+#undef __BYTECODE_OP
+    };
+
+    JsonObject statistics;
+    statistics.set("instruction_counts_enabled"sv, JS_BYTECODE_STATS_DEBUG != 0);
+
+    Vector<size_t> instruction_types;
+    for (size_t type = 0; type < number_of_instruction_types; ++type) {
+        if (m_instruction_execution_counts[type] != 0)
+            instruction_types.append(type);
+    }
+    quick_sort(instruction_types, [&](auto a, auto b) { return m_instruction_execution_counts[a] > m_instruction_execution_counts[b]; });
+
+    JsonObject instruction_counts;
+    for (auto type : instruction_types)
+        instruction_counts.set(instruction_type_names[type], m_instruction_execution_counts[type]);
+    statistics.set("instructions"sv, move(instruction_counts));
+
+    // NOTE: Nothing is allocated on the GC heap while we look at these, so they can't go away.
+    Vector<Executable*> executables;
+    vm().heap().for_each_live_cell([&](Cell& cell, size_t) {
+        if (is<Executable>(cell) && static_cast<Executable&>(cell).invocation_count != 0)
+            executables.append(&static_cast<Executable&>(cell));
+    });
+    quick_sort(executables, [](Executable const* a, Executable const* b) {
+        if (a->executed_instruction_count != b->executed_instruction_count)
+            return a->executed_instruction_count > b->executed_instruction_count;
+        return a->invocation_count + a->back_edge_count > b->invocation_count + b->back_edge_count;
+    });
+
+    u64 total_property_lookup_hits = 0;
+    u64 total_property_lookup_misses = 0;
+    u64 total_global_variable_hits = 0;
+    u64 total_global_variable_misses = 0;
+
+    JsonArray executable_statistics;
+    for (auto* executable_pointer : executables) {
+        auto const& executable = *executable_pointer;
+        u64 property_lookup_hits = 0;
+        u64 property_lookup_misses = 0;
+        for (auto const& cache : executable.property_lookup_caches) {
+            property_lookup_hits += cache.hit_count;
+            property_lookup_misses += cache.miss_count;
+        }
+        u64 global_variable_hits = 0;
+        u64 global_variable_misses = 0;
+        for (auto const& cache : executable.global_variable_caches) {
+            global_variable_hits += cache.hit_count;
+            global_variable_misses += cache.miss_count;
+        }
+        total_property_lookup_hits += property_lookup_hits;
+        total_property_lookup_misses += property_lookup_misses;
+        total_global_variable_hits += global_variable_hits;
+        total_global_variable_misses += global_variable_misses;
+
+        JsonObject executable_object;
+        executable_object.set("name"sv, executable.name.is_empty() ? "(anonymous)"sv : executable.name.view());
+        executable_object.set("source"sv, executable.source_code->filename().bytes_as_string_view());
+        executable_object.set("invocations"sv, executable.invocation_count);
+        executable_object.set("back_edges"sv, executable.back_edge_count);
+        if constexpr (JS_BYTECODE_STATS_DEBUG)
+            executable_object.set("instructions"sv, executable.executed_instruction_count);
+        if constexpr (JS_BYTECODE_STATS_DEBUG) {
+            executable_object.set("property_lookup_caches"sv, inline_cache_statistics(property_lookup_hits, property_lookup_misses));
+            executable_object.set("global_variable_caches"sv, inline_cache_statistics(global_variable_hits, global_variable_misses));
+        }
+        executable_statistics.must_append(move(executable_object));
+    }
+    statistics.set("executables"sv, move(executable_statistics));
+
+    if constexpr (JS_BYTECODE_STATS_DEBUG) {
+        JsonObject inline_caches;
+        inline_caches.set("property_lookup"sv, inline_cache_statistics(total_property_lookup_hits, total_property_lookup_misses));
+        inline_caches.set("global_variable"sv, inline_cache_statistics(total_global_variable_hits, total_global_variable_misses));
+        statistics.set("inline_caches"sv, move(inline_caches));
+    }
+
+    return statistics;
+}
+
 void Interpreter::enter_unwind_context()
 {
     running_execution_context().unwind_contexts.empend(
@@ -952,6 +1110,27 @@ ThrowCompletionOr<void> Mul::execute_impl(Bytecode::Interpreter& interpreter) co
     return {};
 }
 
+ThrowCompletionOr<void> Mod::execute_impl(Bytecode::Interpreter& interpreter) const
+{
+    auto& vm = interpreter.vm();
+    auto const lhs = interpreter.get(m_lhs);
+    auto const rhs = interpreter.get(m_rhs);
+
+    // OPTIMIZATION: Fast path for non-negative Int32 dividends and positive Int32 divisors.
+    //               Negative dividends are left to the generic path, since they may produce -0.
+    if (lhs.is_int32() && rhs.is_int32()) {
+        auto const dividend = lhs.as_i32();
+        auto const divisor = rhs.as_i32();
+        if (dividend >= 0 && divisor > 0) {
+            interpreter.set(m_dst, Value(dividend % divisor));
+            return {};
+        }
+    }
+
+    interpreter.set(m_dst, TRY(mod(vm, lhs, rhs)));
+    return {};
+}
+
 ThrowCompletionOr<void> Sub::execute_impl(Bytecode::Interpreter& interpreter) const
 {
     auto& vm = interpreter.vm();
@@ -1614,7 +1793,7 @@ void GetImportMeta::execute_impl(Bytecode::Interpreter& interpreter) const
     interpreter.set(dst(), interpreter.vm().get_import_meta());
 }
 
-static ThrowCompletionOr<Value> dispatch_builtin_call(Bytecode::Interpreter& interpreter, Bytecode::Builtin builtin, ReadonlySpan<Operand> arguments)
+static ThrowCompletionOr<Value> dispatch_builtin_call(Bytecode::Interpreter& interpreter, Bytecode::Builtin builtin, Value this_value, ReadonlySpan<Operand> arguments)
 {
     switch (builtin) {
     case Builtin::MathAbs:
@@ -1633,6 +1812,36 @@ static ThrowCompletionOr<Value> dispatch_builtin_call(Bytecode::Interpreter& int
         return TRY(MathObject::round_impl(interpreter.vm(), interpreter.get(arguments[0])));
     case Builtin::MathSqrt:
         return TRY(MathObject::sqrt_impl(interpreter.vm(), interpreter.get(arguments[0])));
+    case Builtin::MathTrunc:
+        return TRY(MathObject::trunc_impl(interpreter.vm(), interpreter.get(arguments[0])));
+    case Builtin::MathSin:
+        return TRY(MathObject::sin_impl(interpreter.vm(), interpreter.get(arguments[0])));
+    case Builtin::MathCos:
+        return TRY(MathObject::cos_impl(interpreter.vm(), interpreter.get(arguments[0])));
+    case Builtin::MathTan:
+        return TRY(MathObject::tan_impl(interpreter.vm(), interpreter.get(arguments[0])));
+    case Builtin::MathMin: {
+        Value values[] = { interpreter.get(arguments[0]), interpreter.get(arguments[1]) };
+        return TRY(MathObject::min_impl(interpreter.vm(), values));
+    }
+    case Builtin::MathMax: {
+        Value values[] = { interpreter.get(arguments[0]), interpreter.get(arguments[1]) };
+        return TRY(MathObject::max_impl(interpreter.vm(), values));
+    }
+    case Builtin::ObjectHasOwn:
+        return TRY(ObjectConstructor::has_own_impl(interpreter.vm(), interpreter.get(arguments[0]), interpreter.get(arguments[1])));
+    case Builtin::StringPrototypeCharCodeAt:
+        return TRY(StringPrototype::char_code_at_impl(interpreter.vm(), this_value, interpreter.get(arguments[0])));
+    case Builtin::StringPrototypeIndexOf:
+        return TRY(StringPrototype::index_of_impl(interpreter.vm(), this_value, interpreter.get(arguments[0]), js_undefined()));
+    case Builtin::StringPrototypeSlice:
+        return TRY(StringPrototype::slice_impl(interpreter.vm(), this_value, interpreter.get(arguments[0]), interpreter.get(arguments[1])));
+    case Builtin::ArrayPrototypePush: {
+        Value item = interpreter.get(arguments[0]);
+        return TRY(ArrayPrototype::push_impl(interpreter.vm(), this_value, { &item, 1 }));
+    }
+    case Builtin::ArrayPrototypePop:
+        return TRY(ArrayPrototype::pop_impl(interpreter.vm(), this_value));
     case Bytecode::Builtin::__Count:
         VERIFY_NOT_REACHED();
     }
@@ -1649,7 +1858,7 @@ ThrowCompletionOr<void> Call::execute_impl(Bytecode::Interpreter& interpreter) c
         && m_argument_count == Bytecode::builtin_argument_count(m_builtin.value())
         && callee.is_object()
         && interpreter.realm().get_builtin_value(m_builtin.value()) == &callee.as_object()) {
-        interpreter.set(dst(), TRY(dispatch_builtin_call(interpreter, m_builtin.value(), { m_arguments, m_argument_count })));
+        interpreter.set(dst(), TRY(dispatch_builtin_call(interpreter, m_builtin.value(), interpreter.get(m_this_value), { m_arguments, m_argument_count })));
         return {};
     }
 
@@ -1744,6 +1953,15 @@ ThrowCompletionOr<void> Decrement::execute_impl(Bytecode::Interpreter& interpret
     auto& vm = interpreter.vm();
     auto old_value = interpreter.get(dst());
 
+    // OPTIMIZATION: Fast path for Int32 values.
+    if (old_value.is_int32()) {
+        auto integer_value = old_value.as_i32();
+        if (integer_value != NumericLimits<i32>::min()) [[likely]] {
+            interpreter.set(dst(), Value { integer_value - 1 });
+            return {};
+        }
+    }
+
     old_value = TRY(old_value.to_numeric(vm));
 
     if (old_value.is_number())
@@ -1758,6 +1976,16 @@ ThrowCompletionOr<void> PostfixDecrement::execute_impl(Bytecode::Interpreter& in
     auto& vm = interpreter.vm();
     auto old_value = interpreter.get(m_src);
 
+    // OPTIMIZATION: Fast path for Int32 values.
+    if (old_value.is_int32()) {
+        auto integer_value = old_value.as_i32();
+        if (integer_value != NumericLimits<i32>::min()) [[likely]] {
+            interpreter.set(m_dst, old_value);
+            interpreter.set(m_src, Value { integer_value - 1 });
+            return {};
+        }
+    }
+
     old_value = TRY(old_value.to_numeric(vm));
     interpreter.set(m_dst, old_value);
 
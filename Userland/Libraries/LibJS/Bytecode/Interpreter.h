@@ -6,7 +6,10 @@
 
 #pragma once
 
+#include <AK/Array.h>
+#include <AK/JsonObject.h>
 #include <LibJS/Bytecode/Executable.h>
+#include <LibJS/Bytecode/Instruction.h>
 #include <LibJS/Bytecode/Label.h>
 #include <LibJS/Bytecode/Register.h>
 #include <LibJS/Forward.h>
@@ -80,6 +83,17 @@ public:
 
     ExecutionContext& running_execution_context() { return *m_running_execution_context; }
 
+    // Hands out the registers, constants and locals of calls from a stack, so that calling a function doesn't allocate.
+    // Windows must be given back in the opposite order they were taken, which holds for execution contexts that are
+    // only used for a single call. Contexts that outlive their call (generators, async functions) run on a copy.
+    [[nodiscard]] Span<Value> allocate_register_window(size_t count);
+    void deallocate_register_window(Span<Value>);
+
+    // Summarizes how often each opcode and executable has run, and how well their inline caches did. The opcode
+    // and instruction counts are only collected when LibJS is built with JS_BYTECODE_STATS_DEBUG, as counting
+    // them slows down every dispatch.
+    JsonObject bytecode_statistics();
+
 private:
     void run_bytecode(size_t entry_point);
 
@@ -99,9 +113,21 @@ private:
     Span<Value> m_arguments;
     Span<Value> m_registers_and_constants_and_locals;
     ExecutionContext* m_running_execution_context { nullptr };
+
+    static constexpr size_t register_stack_chunk_size = 16384;
+    Vector<Vector<Value>> m_register_stack_chunks;
+    size_t m_current_register_stack_chunk { 0 };
+
+    static constexpr size_t number_of_instruction_types = 0
+#define __BYTECODE_OP(op) +1
+        ENUMERATE_BYTECODE_OPS(__BYTECODE_OP)
+#undef __BYTECODE_OP
+        ;
+    AK::Array<u64, number_of_instruction_types> m_instruction_execution_counts {};
 };
 
 extern bool g_dump_bytecode;
+extern bool g_optimize_bytecode;
 
 ThrowCompletionOr<NonnullGCPtr<Bytecode::Executable>> compile(VM&, ASTNode const&, JS::FunctionKind kind, DeprecatedFlyString const& name);
 ThrowCompletionOr<NonnullGCPtr<Bytecode::Executable>> compile(VM&, ECMAScriptFunctionObject const&);
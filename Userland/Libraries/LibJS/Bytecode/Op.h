@@ -116,6 +116,7 @@ private:
     O(LeftShift, left_shift)                             \
     O(LessThan, less_than)                               \
     O(LessThanEquals, less_than_equals)                  \
+    O(Mod, mod)                                          \
     O(Mul, mul)                                          \
     O(RightShift, right_shift)                           \
     O(Sub, sub)                                          \
@@ -124,7 +125,6 @@ private:
 #define JS_ENUMERATE_COMMON_BINARY_OPS_WITHOUT_FAST_PATH(O) \
     O(Div, div)                                             \
     O(Exp, exp)                                             \
-    O(Mod, mod)                                             \
     O(In, in)                                               \
     O(InstanceOf, instance_of)                              \
     O(LooselyInequals, loosely_inequals)                    \
@@ -166,6 +166,9 @@ JS_ENUMERATE_COMMON_BINARY_OPS_WITHOUT_FAST_PATH(JS_DECLARE_COMMON_BINARY_OP)
 JS_ENUMERATE_COMMON_BINARY_OPS_WITH_FAST_PATH(JS_DECLARE_COMMON_BINARY_OP)
 #undef JS_DECLARE_COMMON_BINARY_OP
 
+// NOTE: With 32-bit operands, a binary op fits its type and three operands in 16 bytes.
+static_assert(sizeof(Add) == 16);
+
 #define JS_ENUMERATE_COMMON_UNARY_OPS(O) \
     O(BitwiseNot, bitwise_not)           \
     O(Not, not_)                         \
@@ -6,43 +6,54 @@
 
 #pragma once
 
+#include <AK/Assertions.h>
 #include <AK/Types.h>
 #include <LibJS/Forward.h>
 
 namespace JS::Bytecode {
 
+// NOTE: Operands are packed into 32 bits, with the type in the topmost bits, to keep instructions small.
+//       Constants live in a table of their own, and operands only refer to them by index.
 class Operand {
 public:
-    enum class Type {
+    enum class Type : u8 {
         Register,
         Local,
         Constant,
     };
 
+    static constexpr u32 type_shift = 30;
+    static constexpr u32 index_mask = (1u << type_shift) - 1;
+
     [[nodiscard]] bool operator==(Operand const&) const = default;
 
     explicit Operand(Type type, u32 index)
-        : m_type(type)
-        , m_index(index)
+        : m_type_and_index((static_cast<u32>(type) << type_shift) | index)
     {
+        VERIFY(index <= index_mask);
     }
 
     explicit Operand(Register);
 
-    [[nodiscard]] bool is_register() const { return m_type == Type::Register; }
-    [[nodiscard]] bool is_local() const { return m_type == Type::Local; }
-    [[nodiscard]] bool is_constant() const { return m_type == Type::Constant; }
+    [[nodiscard]] bool is_register() const { return type() == Type::Register; }
+    [[nodiscard]] bool is_local() const { return type() == Type::Local; }
+    [[nodiscard]] bool is_constant() const { return type() == Type::Constant; }
 
-    [[nodiscard]] Type type() const { return m_type; }
-    [[nodiscard]] u32 index() const { return m_index; }
+    [[nodiscard]] Type type() const { return static_cast<Type>(m_type_and_index >> type_shift); }
+    [[nodiscard]] u32 index() const { return m_type_and_index & index_mask; }
 
     [[nodiscard]] Register as_register() const;
 
-    void offset_index_by(u32 offset) { m_index += offset; }
+    void offset_index_by(u32 offset)
+    {
+        VERIFY(index() + offset <= index_mask);
+        m_type_and_index += offset;
+    }
 
 private:
-    Type m_type {};
-    u32 m_index { 0 };
+    u32 m_type_and_index { 0 };
 };
 
+static_assert(sizeof(Operand) == sizeof(u32));
+
 }
@@ -12,6 +12,7 @@
 #include <LibJS/Print.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Completion.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
 #include <LibJS/Runtime/StringConstructor.h>
 #include <LibJS/Runtime/Temporal/Duration.h>
 #include <LibJS/Runtime/ValueInlines.h>
@@ -469,6 +470,58 @@ ThrowCompletionOr<Value> Console::time_end()
     return js_undefined();
 }
 
+// Non-standard: profile(label), https://developer.mozilla.org/en-US/docs/Web/API/console/profile_static
+ThrowCompletionOr<Value> Console::profile()
+{
+    auto& vm = realm().vm();
+    auto label = TRY(label_or_fallback(vm, ""sv));
+
+    // NOTE: The profiler samples every execution context of the VM, so only one profile can be recorded at a time.
+    auto& profiler = vm.ensure_sampling_profiler();
+    if (profiler.is_running()) {
+        if (m_client) {
+            MarkedVector<Value> profile_already_running_warning_message_as_vector { vm.heap() };
+
+            auto message = TRY_OR_THROW_OOM(vm, String::formatted("Cannot start profile '{}', another profile is already being recorded.", label));
+            profile_already_running_warning_message_as_vector.append(PrimitiveString::create(vm, move(message)));
+
+            TRY(m_client->printer(LogLevel::Warn, move(profile_already_running_warning_message_as_vector)));
+        }
+        return js_undefined();
+    }
+
+    m_profile_label = move(label);
+    profiler.start();
+    return js_undefined();
+}
+
+// Non-standard: profileEnd(label), https://developer.mozilla.org/en-US/docs/Web/API/console/profileEnd_static
+ThrowCompletionOr<Value> Console::profile_end()
+{
+    auto& vm = realm().vm();
+    auto label = TRY(label_or_fallback(vm, ""sv));
+
+    // NOTE: Without a label, whichever profile is being recorded is stopped.
+    auto* profiler = vm.sampling_profiler();
+    if (!m_profile_label.has_value() || !profiler || !profiler->is_running() || (!label.is_empty() && label != *m_profile_label)) {
+        if (m_client) {
+            MarkedVector<Value> profile_does_not_exist_warning_message_as_vector { vm.heap() };
+
+            auto message = TRY_OR_THROW_OOM(vm, String::formatted("Profile '{}' does not exist.", label));
+            profile_does_not_exist_warning_message_as_vector.append(PrimitiveString::create(vm, move(message)));
+
+            TRY(m_client->printer(LogLevel::Warn, move(profile_does_not_exist_warning_message_as_vector)));
+        }
+        return js_undefined();
+    }
+
+    profiler->stop();
+    auto profile_label = m_profile_label.release_value();
+    if (m_client)
+        m_client->report_profile(profile_label, *profiler);
+    return js_undefined();
+}
+
 MarkedVector<Value> Console::vm_arguments()
 {
     auto& vm = realm().vm();
@@ -84,6 +84,8 @@ public:
     ThrowCompletionOr<Value> time();
     ThrowCompletionOr<Value> time_log();
     ThrowCompletionOr<Value> time_end();
+    ThrowCompletionOr<Value> profile();
+    ThrowCompletionOr<Value> profile_end();
 
     void output_debug_message(LogLevel log_level, String const& output) const;
     void report_exception(JS::Error const&, bool) const;
@@ -102,6 +104,7 @@ private:
     HashMap<String, unsigned> m_counters;
     HashMap<String, Core::ElapsedTimer> m_timer_table;
     Vector<Group> m_group_stack;
+    Optional<String> m_profile_label;
 };
 
 class ConsoleClient : public Cell {
@@ -117,6 +120,7 @@ public:
 
     virtual void add_css_style_to_current_message(StringView) { }
     virtual void report_exception(JS::Error const&, bool) { }
+    virtual void report_profile(String const&, SamplingProfiler const&) { }
 
     virtual void clear() = 0;
     virtual void end_group() = 0;
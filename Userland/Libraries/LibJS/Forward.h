@@ -153,6 +153,7 @@ namespace JS {
 
 class ASTNode;
 class Accessor;
+class AllocationProfiler;
 struct AsyncGeneratorRequest;
 class BigInt;
 class BoundFunction;
@@ -205,6 +206,7 @@ class PropertyDescriptor;
 class PropertyKey;
 class Realm;
 class Reference;
+class SamplingProfiler;
 class ScopeNode;
 class Script;
 class Shape;
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Backtrace.h>
+#include <AK/JsonArray.h>
+#include <AK/QuickSort.h>
+#include <AK/StringBuilder.h>
+#include <LibJS/Bytecode/Executable.h>
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Heap/AllocationProfiler.h>
+#include <LibJS/Heap/Cell.h>
+#include <LibJS/Runtime/VM.h>
+
+#if defined(AK_HAS_BACKTRACE_HEADER)
+#    include <cxxabi.h>
+#endif
+
+namespace JS {
+
+unsigned AllocationProfiler::AllocationSiteTraits::hash(AllocationSite const& site)
+{
+    auto hash = site.class_name.hash();
+    for (auto const& frame : site.js_stack)
+        hash = pair_int_hash(hash, frame.hash());
+    for (auto address : site.native_stack)
+        hash = pair_int_hash(hash, ptr_hash(address));
+    return hash;
+}
+
+AllocationProfiler::AllocationProfiler(VM& vm, size_t sample_interval)
+    : m_vm(vm)
+    , m_sample_interval(sample_interval)
+    , m_allocations_until_next_sample(sample_interval)
+{
+    VERIFY(sample_interval > 0);
+}
+
+static String describe_frame(ExecutionContext const& context, Optional<size_t> program_counter)
+{
+    StringBuilder builder;
+    if (context.function_name && !context.function_name->is_empty())
+        builder.append(context.function_name->utf8_string());
+    else
+        builder.append("(anonymous)"sv);
+
+    if (context.executable && program_counter.has_value()) {
+        auto source_range = context.executable->source_range_at(*program_counter).realize();
+        builder.appendff(" @ {}:{}:{}", source_range.filename(), source_range.start.line, source_range.start.column);
+    }
+
+    return MUST(builder.to_string());
+}
+
+void AllocationProfiler::record_sample(Cell& cell, size_t cell_size)
+{
+    AllocationSite site;
+    site.class_name = cell.class_name();
+
+    auto const& stack = m_vm.execution_context_stack();
+    for (size_t i = stack.size(); i > 0 && site.js_stack.size() < max_js_stack_depth; --i) {
+        auto const& context = *stack[i - 1];
+        // Only the interpreter knows where the innermost frame currently is, the others store it when they call out.
+        auto program_counter = i == stack.size() ? m_vm.bytecode_interpreter().program_counter() : context.program_counter;
+        site.js_stack.append(describe_frame(context, program_counter));
+    }
+
+#if defined(AK_HAS_BACKTRACE_HEADER)
+    // The first frame is this function, which is never inlined so that it can be skipped reliably.
+    void* native_stack[max_native_stack_depth + 1] = {};
+    int native_stack_depth = backtrace(native_stack, array_size(native_stack));
+    for (int i = 1; i < native_stack_depth; ++i)
+        site.native_stack.append(bit_cast<FlatPtr>(native_stack[i]));
+#endif
+
+    auto site_index = m_site_indices.ensure(site, [&] {
+        m_sites.append(site);
+        m_statistics.append({});
+        return static_cast<u32>(m_sites.size() - 1);
+    });
+
+    auto& statistics = m_statistics[site_index];
+    ++statistics.sampled_allocation_count;
+    ++statistics.live_sample_count;
+    statistics.live_sampled_bytes += cell_size;
+
+    m_sampled_cells.set(&cell, { site_index, cell_size });
+}
+
+void AllocationProfiler::will_deallocate(Cell const& cell)
+{
+    auto sampled_cell = m_sampled_cells.take(&cell);
+    if (!sampled_cell.has_value())
+        return;
+
+    auto& statistics = m_statistics[sampled_cell->site_index];
+    --statistics.live_sample_count;
+    statistics.live_sampled_bytes -= sampled_cell->cell_size;
+}
+
+void AllocationProfiler::did_collect_garbage()
+{
+    for (auto& statistics : m_statistics)
+        statistics.sampled_bytes_retained_after_last_gc = statistics.live_sampled_bytes;
+}
+
+Optional<size_t> AllocationProfiler::allocation_site_index(Cell const& cell) const
+{
+    if (auto sampled_cell = m_sampled_cells.get(&cell); sampled_cell.has_value())
+        return sampled_cell->site_index;
+    return {};
+}
+
+Vector<size_t> AllocationProfiler::site_indices_by_retained_size() const
+{
+    Vector<size_t> site_indices;
+    site_indices.ensure_capacity(m_sites.size());
+    for (size_t i = 0; i < m_sites.size(); ++i)
+        site_indices.unchecked_append(i);
+
+    quick_sort(site_indices, [&](auto a, auto b) {
+        auto const& statistics_a = m_statistics[a];
+        auto const& statistics_b = m_statistics[b];
+        if (statistics_a.sampled_bytes_retained_after_last_gc != statistics_b.sampled_bytes_retained_after_last_gc)
+            return statistics_a.sampled_bytes_retained_after_last_gc > statistics_b.sampled_bytes_retained_after_last_gc;
+        return statistics_a.sampled_allocation_count > statistics_b.sampled_allocation_count;
+    });
+    return site_indices;
+}
+
+static ByteString symbolize(FlatPtr address)
+{
+#if defined(AK_HAS_BACKTRACE_HEADER)
+    void* frame = bit_cast<void*>(address);
+    char** symbols = backtrace_symbols(&frame, 1);
+    if (!symbols)
+        return ByteString::formatted("{:p}", address);
+
+    ByteString symbol { symbols[0], strlen(symbols[0]) };
+    free(symbols);
+
+    // Demangle the C++ symbol name if there is one, keeping the module and offset around it.
+    auto mangled_start = symbol.find("_Z"sv);
+    if (!mangled_start.has_value())
+        return symbol;
+    auto mangled_length = symbol.substring_view(*mangled_start).find_any_of("+) "sv).value_or(symbol.length() - *mangled_start);
+    auto mangled_name = symbol.substring(*mangled_start, mangled_length);
+
+    int status = 0;
+    char* demangled_name = abi::__cxa_demangle(mangled_name.characters(), nullptr, nullptr, &status);
+    if (status != 0)
+        return symbol;
+
+    auto result = ByteString::formatted("{}{}{}", symbol.substring_view(0, *mangled_start), demangled_name, symbol.substring_view(*mangled_start + mangled_length));
+    free(demangled_name);
+    return result;
+#else
+    return ByteString::formatted("{:p}", address);
+#endif
+}
+
+JsonObject AllocationProfiler::to_json() const
+{
+    JsonArray sites;
+    for (auto site_index : site_indices_by_retained_size()) {
+        auto const& site = m_sites[site_index];
+        auto const& statistics = m_statistics[site_index];
+
+        JsonArray js_stack;
+        for (auto const& frame : site.js_stack)
+            js_stack.must_append(frame.bytes_as_string_view());
+
+        JsonArray native_stack;
+        for (auto address : site.native_stack)
+            native_stack.must_append(symbolize(address));
+
+        JsonObject site_json;
+        site_json.set("id"sv, site_index);
+        site_json.set("class_name"sv, site.class_name);
+        site_json.set("js_stack"sv, move(js_stack));
+        site_json.set("native_stack"sv, move(native_stack));
+        site_json.set("sampled_allocations"sv, statistics.sampled_allocation_count);
+        site_json.set("live_samples"sv, statistics.live_sample_count);
+        site_json.set("estimated_allocations"sv, statistics.sampled_allocation_count * m_sample_interval);
+        site_json.set("estimated_live_bytes"sv, statistics.live_sampled_bytes * m_sample_interval);
+        site_json.set("estimated_retained_bytes_after_last_gc"sv, statistics.sampled_bytes_retained_after_last_gc * m_sample_interval);
+        sites.must_append(move(site_json));
+    }
+
+    JsonObject profile;
+    profile.set("sample_interval"sv, m_sample_interval);
+    profile.set("sites"sv, move(sites));
+    return profile;
+}
+
+void AllocationProfiler::dump_report(size_t max_site_count) const
+{
+    dbgln("Retained size by allocation site (1 in {} allocations sampled)", m_sample_interval);
+    size_t site_count = 0;
+    for (auto site_index : site_indices_by_retained_size()) {
+        auto const& statistics = m_statistics[site_index];
+        if (site_count++ == max_site_count || statistics.sampled_bytes_retained_after_last_gc == 0)
+            break;
+
+        auto const& site = m_sites[site_index];
+        dbgln("  ~{} bytes in {} @ {}", statistics.sampled_bytes_retained_after_last_gc * m_sample_interval, site.class_name, site.js_stack.is_empty() ? "(native)"_string : site.js_stack.first());
+    }
+}
+
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/JsonObject.h>
+#include <AK/Noncopyable.h>
+#include <AK/Optional.h>
+#include <AK/String.h>
+#include <AK/Vector.h>
+#include <LibJS/Forward.h>
+
+namespace JS {
+
+// Attributes heap growth to the code that allocated it by recording where every Nth cell was allocated: the type of
+// the cell, the JavaScript call stack and the native call stack. Sampled cells are followed until they are swept,
+// so the number of bytes each allocation site keeps alive can be estimated by scaling the sampled cells by the
+// sample interval.
+class AllocationProfiler {
+    AK_MAKE_NONCOPYABLE(AllocationProfiler);
+    AK_MAKE_NONMOVABLE(AllocationProfiler);
+
+public:
+    static constexpr size_t max_js_stack_depth = 16;
+    static constexpr size_t max_native_stack_depth = 16;
+
+    AllocationProfiler(VM&, size_t sample_interval);
+
+    size_t sample_interval() const { return m_sample_interval; }
+
+    ALWAYS_INLINE void did_allocate(Cell& cell, size_t cell_size)
+    {
+        if (--m_allocations_until_next_sample > 0)
+            return;
+        m_allocations_until_next_sample = m_sample_interval;
+        record_sample(cell, cell_size);
+    }
+
+    void will_deallocate(Cell const&);
+    void did_collect_garbage();
+
+    Optional<size_t> allocation_site_index(Cell const&) const;
+
+    // Allocation sites sorted by the number of bytes they retained after the last garbage collection.
+    JsonObject to_json() const;
+
+    void dump_report(size_t max_site_count) const;
+
+private:
+    struct AllocationSite {
+        StringView class_name;
+        Vector<String> js_stack;
+        Vector<FlatPtr> native_stack;
+
+        bool operator==(AllocationSite const&) const = default;
+    };
+
+    struct AllocationSiteTraits : public DefaultTraits<AllocationSite> {
+        static unsigned hash(AllocationSite const&);
+    };
+
+    struct AllocationSiteStatistics {
+        size_t sampled_allocation_count { 0 };
+        size_t live_sample_count { 0 };
+        size_t live_sampled_bytes { 0 };
+        size_t sampled_bytes_retained_after_last_gc { 0 };
+    };
+
+    struct SampledCell {
+        u32 site_index { 0 };
+        size_t cell_size { 0 };
+    };
+
+    NEVER_INLINE void record_sample(Cell&, size_t cell_size);
+    Vector<size_t> site_indices_by_retained_size() const;
+
+    VM& m_vm;
+    size_t m_sample_interval { 0 };
+    size_t m_allocations_until_next_sample { 0 };
+
+    Vector<AllocationSite> m_sites;
+    Vector<AllocationSiteStatistics> m_statistics;
+    HashMap<AllocationSite, u32, AllocationSiteTraits> m_site_indices;
+    HashMap<Cell const*, SampledCell> m_sampled_cells;
+};
+
+}
@@ -36,8 +36,11 @@ public:
     virtual void initialize(Realm&);
     virtual ~Cell() = default;
 
-    bool is_marked() const { return m_mark; }
-    void set_marked(bool b) { m_mark = b; }
+    ALWAYS_INLINE bool is_marked() const { return HeapBlockBase::from_cell(this)->is_cell_marked(this); }
+    ALWAYS_INLINE void set_marked(bool b) { HeapBlockBase::from_cell(this)->set_cell_marked(this, b); }
+
+    // Marks the cell unless another marking thread got to it first. Returns whether this call marked it.
+    ALWAYS_INLINE bool try_mark_atomically() { return HeapBlockBase::from_cell(this)->try_mark_cell_atomically(this); }
 
     enum class State : bool {
         Live,
@@ -89,8 +92,8 @@ public:
                 visit(value);
         }
 
-        template<typename T>
-        void visit(Vector<T> const& vector)
+        template<typename T, size_t inline_capacity>
+        void visit(Vector<T, inline_capacity> const& vector)
         {
             for (auto& value : vector)
                 visit(value);
@@ -169,7 +172,6 @@ protected:
     void set_overrides_must_survive_garbage_collection(bool b) { m_overrides_must_survive_garbage_collection = b; }
 
 private:
-    bool m_mark : 1 { false };
     bool m_overrides_must_survive_garbage_collection : 1 { false };
     State m_state : 1 { State::Live };
 };
@@ -5,6 +5,7 @@
  */
 
 #include <AK/Badge.h>
+#include <AK/QuickSort.h>
 #include <LibJS/Heap/BlockAllocator.h>
 #include <LibJS/Heap/CellAllocator.h>
 #include <LibJS/Heap/Heap.h>
@@ -25,11 +26,6 @@ Cell* CellAllocator::allocate_cell(Heap& heap)
 
     if (m_usable_blocks.is_empty()) {
         auto block = HeapBlock::create_with_cell_size(heap, *this, m_cell_size, m_class_name);
-        auto block_ptr = reinterpret_cast<FlatPtr>(block.ptr());
-        if (m_min_block_address > block_ptr)
-            m_min_block_address = block_ptr;
-        if (m_max_block_address < block_ptr)
-            m_max_block_address = block_ptr;
         m_usable_blocks.append(*block.leak_ptr());
     }
 
@@ -55,4 +51,20 @@ void CellAllocator::block_did_become_usable(Badge<Heap>, HeapBlock& block)
     m_usable_blocks.append(block);
 }
 
+void CellAllocator::sort_usable_blocks_by_occupancy(Badge<Heap>)
+{
+    // NOTE: Cells are allocated from the last usable block. Filling up the fullest blocks first leaves the sparsely
+    //       populated ones alone, so that their remaining cells can die off and the blocks can be given back to the
+    //       BlockAllocator, instead of being topped up again with new cells.
+    Vector<HeapBlock*> blocks;
+    for (auto& block : m_usable_blocks)
+        blocks.append(&block);
+    if (blocks.size() < 2)
+        return;
+
+    quick_sort(blocks, [](auto* a, auto* b) { return a->live_cell_count() < b->live_cell_count(); });
+    for (auto* block : blocks)
+        m_usable_blocks.append(*block);
+}
+
 }
@@ -6,15 +6,19 @@
  */
 
 #include <AK/Badge.h>
+#include <AK/BinarySearch.h>
 #include <AK/Debug.h>
 #include <AK/HashTable.h>
 #include <AK/JsonArray.h>
 #include <AK/JsonObject.h>
 #include <AK/Platform.h>
+#include <AK/QuickSort.h>
 #include <AK/StackInfo.h>
 #include <AK/TemporaryChange.h>
 #include <LibCore/ElapsedTimer.h>
+#include <LibCore/TraceEvent.h>
 #include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Heap/AllocationProfiler.h>
 #include <LibJS/Heap/CellAllocator.h>
 #include <LibJS/Heap/Handle.h>
 #include <LibJS/Heap/Heap.h>
@@ -22,6 +26,9 @@
 #include <LibJS/Runtime/Object.h>
 #include <LibJS/Runtime/WeakContainer.h>
 #include <LibJS/SafeFunction.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibThreading/Mutex.h>
+#include <LibThreading/Thread.h>
 #include <setjmp.h>
 
 #ifdef HAS_ADDRESS_SANITIZER
@@ -54,6 +61,25 @@ Heap::~Heap()
     collect_garbage(CollectionType::CollectEverything);
 }
 
+void Heap::set_allocation_sample_interval(size_t sample_interval)
+{
+    if (sample_interval == 0)
+        m_allocation_profiler = nullptr;
+    else if (!m_allocation_profiler || m_allocation_profiler->sample_interval() != sample_interval)
+        m_allocation_profiler = make<AllocationProfiler>(vm(), sample_interval);
+}
+
+void Heap::did_allocate_cell_while_profiling(Cell& cell)
+{
+    m_allocation_profiler->did_allocate(cell, HeapBlock::from_cell(&cell)->cell_size());
+}
+
+void Heap::set_marking_thread_count(size_t thread_count)
+{
+    VERIFY(!m_collecting_garbage);
+    m_marking_thread_count = thread_count;
+}
+
 void Heap::will_allocate(size_t size)
 {
     if (should_collect_on_every_allocation()) {
@@ -67,7 +93,39 @@ void Heap::will_allocate(size_t size)
     m_allocated_bytes_since_last_gc += size;
 }
 
-static void add_possible_value(HashMap<FlatPtr, HeapRoot>& possible_pointers, FlatPtr data, HeapRoot origin, FlatPtr min_block_address, FlatPtr max_block_address)
+// The addresses of all live heap blocks, sorted. Conservatively scanned values are checked against this before
+// anything else is done with them, so only the few that actually point into the heap are hashed and resolved to cells.
+class HeapBlockIndex {
+public:
+    explicit HeapBlockIndex(Heap& heap)
+    {
+        heap.for_each_block([&](auto& block) {
+            m_block_addresses.append(reinterpret_cast<FlatPtr>(&block));
+            return IterationDecision::Continue;
+        });
+        quick_sort(m_block_addresses);
+        if (!m_block_addresses.is_empty()) {
+            m_min_address = m_block_addresses.first();
+            m_max_address = m_block_addresses.last() + HeapBlockBase::block_size - 1;
+        }
+    }
+
+    ALWAYS_INLINE bool contains(FlatPtr address) const
+    {
+        // NOTE: Most values on the stack aren't anywhere near the heap, so they are turned away by the range check
+        //       without searching.
+        if (address < m_min_address || address > m_max_address)
+            return false;
+        return binary_search(m_block_addresses, address & ~(HeapBlockBase::block_size - 1)) != nullptr;
+    }
+
+private:
+    Vector<FlatPtr> m_block_addresses;
+    FlatPtr m_min_address { explode_byte(0xff) };
+    FlatPtr m_max_address { 0 };
+};
+
+static void add_possible_value(HashMap<FlatPtr, HeapRoot>& possible_pointers, FlatPtr data, HeapRoot origin, HeapBlockIndex const& block_index)
 {
     if constexpr (sizeof(FlatPtr*) == sizeof(Value)) {
         // Because Value stores pointers in non-canonical form we have to check if the top bytes
@@ -78,12 +136,12 @@ static void add_possible_value(HashMap<FlatPtr, HeapRoot>& possible_pointers, Fl
             possible_pointer = Value::extract_pointer_bits(data);
         else
             possible_pointer = data;
-        if (possible_pointer < min_block_address || possible_pointer > max_block_address)
+        if (!block_index.contains(possible_pointer))
             return;
         possible_pointers.set(possible_pointer, move(origin));
     } else {
         static_assert((sizeof(Value) % sizeof(FlatPtr*)) == 0);
-        if (data < min_block_address || data > max_block_address)
+        if (!block_index.contains(data))
             return;
         // In the 32-bit case we will look at the top and bottom part of Value separately we just
         // add both the upper and lower bytes as possible pointers.
@@ -91,25 +149,12 @@ static void add_possible_value(HashMap<FlatPtr, HeapRoot>& possible_pointers, Fl
     }
 }
 
-void Heap::find_min_and_max_block_addresses(FlatPtr& min_address, FlatPtr& max_address)
-{
-    min_address = explode_byte(0xff);
-    max_address = 0;
-    for (auto& allocator : m_all_cell_allocators) {
-        min_address = min(min_address, allocator.min_block_address());
-        max_address = max(max_address, allocator.max_block_address() + HeapBlockBase::block_size);
-    }
-}
-
+// NOTE: Every possible pointer has already been checked against the HeapBlockIndex by add_possible_value().
 template<typename Callback>
-static void for_each_cell_among_possible_pointers(HashTable<HeapBlock*> const& all_live_heap_blocks, HashMap<FlatPtr, HeapRoot>& possible_pointers, Callback callback)
+static void for_each_cell_among_possible_pointers(HashMap<FlatPtr, HeapRoot>& possible_pointers, Callback callback)
 {
     for (auto possible_pointer : possible_pointers.keys()) {
-        if (!possible_pointer)
-            continue;
         auto* possible_heap_block = HeapBlock::from_cell(reinterpret_cast<Cell const*>(possible_pointer));
-        if (!all_live_heap_blocks.contains(possible_heap_block))
-            continue;
         if (auto* cell = possible_heap_block->cell_from_possible_pointer(possible_pointer)) {
             callback(cell, possible_pointer);
         }
@@ -120,13 +165,8 @@ class GraphConstructorVisitor final : public Cell::Visitor {
 public:
     explicit GraphConstructorVisitor(Heap& heap, HashMap<Cell*, HeapRoot> const& roots)
         : m_heap(heap)
+        , m_block_index(heap)
     {
-        m_heap.find_min_and_max_block_addresses(m_min_block_address, m_max_block_address);
-        m_heap.for_each_block([&](auto& block) {
-            m_all_live_heap_blocks.set(&block);
-            return IterationDecision::Continue;
-        });
-
         for (auto& [root, root_origin] : roots) {
             auto& graph_node = m_graph.ensure(bit_cast<FlatPtr>(root));
             graph_node.class_name = root->class_name();
@@ -153,9 +193,9 @@ public:
 
         auto* raw_pointer_sized_values = reinterpret_cast<FlatPtr const*>(bytes.data());
         for (size_t i = 0; i < (bytes.size() / sizeof(FlatPtr)); ++i)
-            add_possible_value(possible_pointers, raw_pointer_sized_values[i], HeapRoot { .type = HeapRoot::Type::HeapFunctionCapturedPointer }, m_min_block_address, m_max_block_address);
+            add_possible_value(possible_pointers, raw_pointer_sized_values[i], HeapRoot { .type = HeapRoot::Type::HeapFunctionCapturedPointer }, m_block_index);
 
-        for_each_cell_among_possible_pointers(m_all_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr) {
+        for_each_cell_among_possible_pointers(possible_pointers, [&](Cell* cell, FlatPtr) {
             if (m_node_being_visited)
                 m_node_being_visited->edges.set(reinterpret_cast<FlatPtr>(&cell));
 
@@ -214,6 +254,10 @@ public:
             }
             node.set("class_name"sv, it.value.class_name);
             node.set("edges"sv, edges);
+            if (auto const* allocation_profiler = m_heap.allocation_profiler()) {
+                if (auto site_index = allocation_profiler->allocation_site_index(*bit_cast<Cell*>(it.key)); site_index.has_value())
+                    node.set("allocation_site"sv, *site_index);
+            }
             graph.set(ByteString::number(it.key), node);
         }
 
@@ -232,9 +276,7 @@ private:
     HashMap<FlatPtr, GraphNode> m_graph;
 
     Heap& m_heap;
-    HashTable<HeapBlock*> m_all_live_heap_blocks;
-    FlatPtr m_min_block_address;
-    FlatPtr m_max_block_address;
+    HeapBlockIndex m_block_index;
 };
 
 AK::JsonObject Heap::dump_graph()
@@ -243,7 +285,14 @@ AK::JsonObject Heap::dump_graph()
     gather_roots(roots);
     GraphConstructorVisitor visitor(*this, roots);
     visitor.visit_all_cells();
-    return visitor.dump();
+    auto graph = visitor.dump();
+
+    // Allocation sites are only known while the allocation profiler is running. Since the nodes of the graph are
+    // keyed by address, this key can't collide with any of them.
+    if (m_allocation_profiler)
+        graph.set("allocation_sites"sv, m_allocation_profiler->to_json());
+
+    return graph;
 }
 
 void Heap::collect_garbage(CollectionType collection_type, bool print_report)
@@ -251,21 +300,24 @@ void Heap::collect_garbage(CollectionType collection_type, bool print_report)
     VERIFY(!m_collecting_garbage);
     TemporaryChange change(m_collecting_garbage, true);
 
-    Core::ElapsedTimer collection_measurement_timer;
-    if (print_report)
-        collection_measurement_timer.start();
+    auto collection_measurement_timer = Core::ElapsedTimer::start_new();
+
+    if (collection_type == CollectionType::CollectGarbage && m_gc_deferrals) {
+        m_should_gc_when_deferral_ends = true;
+        return;
+    }
+
+    TRACE_EVENT_SCOPE("gc"sv, "Heap::collect_garbage"sv);
 
     if (collection_type == CollectionType::CollectGarbage) {
-        if (m_gc_deferrals) {
-            m_should_gc_when_deferral_ends = true;
-            return;
-        }
         HashMap<Cell*, HeapRoot> roots;
         gather_roots(roots);
         mark_live_cells(roots);
     }
     finalize_unmarked_cells();
     sweep_dead_cells(print_report, collection_measurement_timer);
+
+    m_total_time_spent_collecting_garbage += collection_measurement_timer.elapsed_time();
 }
 
 void Heap::gather_roots(HashMap<Cell*, HeapRoot>& roots)
@@ -287,7 +339,7 @@ void Heap::gather_roots(HashMap<Cell*, HeapRoot>& roots)
 }
 
 #ifdef HAS_ADDRESS_SANITIZER
-NO_SANITIZE_ADDRESS void Heap::gather_asan_fake_stack_roots(HashMap<FlatPtr, HeapRoot>& possible_pointers, FlatPtr addr, FlatPtr min_block_address, FlatPtr max_block_address)
+NO_SANITIZE_ADDRESS void Heap::gather_asan_fake_stack_roots(HashMap<FlatPtr, HeapRoot>& possible_pointers, FlatPtr addr, HeapBlockIndex const& block_index)
 {
     void* begin = nullptr;
     void* end = nullptr;
@@ -298,12 +350,12 @@ NO_SANITIZE_ADDRESS void Heap::gather_asan_fake_stack_roots(HashMap<FlatPtr, Hea
             void const* real_address = *real_stack_addr;
             if (real_address == nullptr)
                 continue;
-            add_possible_value(possible_pointers, reinterpret_cast<FlatPtr>(real_address), HeapRoot { .type = HeapRoot::Type::StackPointer }, min_block_address, max_block_address);
+            add_possible_value(possible_pointers, reinterpret_cast<FlatPtr>(real_address), HeapRoot { .type = HeapRoot::Type::StackPointer }, block_index);
         }
     }
 }
 #else
-void Heap::gather_asan_fake_stack_roots(HashMap<FlatPtr, HeapRoot>&, FlatPtr, FlatPtr, FlatPtr)
+void Heap::gather_asan_fake_stack_roots(HashMap<FlatPtr, HeapRoot>&, FlatPtr, HeapBlockIndex const&)
 {
 }
 #endif
@@ -321,45 +373,38 @@ NO_SANITIZE_ADDRESS void Heap::gather_conservative_roots(HashMap<Cell*, HeapRoot
 
     auto* raw_jmp_buf = reinterpret_cast<FlatPtr const*>(buf);
 
-    FlatPtr min_block_address, max_block_address;
-    find_min_and_max_block_addresses(min_block_address, max_block_address);
+    HeapBlockIndex block_index(*this);
 
     for (size_t i = 0; i < ((size_t)sizeof(buf)) / sizeof(FlatPtr); ++i)
-        add_possible_value(possible_pointers, raw_jmp_buf[i], HeapRoot { .type = HeapRoot::Type::RegisterPointer }, min_block_address, max_block_address);
+        add_possible_value(possible_pointers, raw_jmp_buf[i], HeapRoot { .type = HeapRoot::Type::RegisterPointer }, block_index);
 
     auto stack_reference = bit_cast<FlatPtr>(&dummy);
     auto& stack_info = m_vm.stack_info();
 
     for (FlatPtr stack_address = stack_reference; stack_address < stack_info.top(); stack_address += sizeof(FlatPtr)) {
         auto data = *reinterpret_cast<FlatPtr*>(stack_address);
-        add_possible_value(possible_pointers, data, HeapRoot { .type = HeapRoot::Type::StackPointer }, min_block_address, max_block_address);
-        gather_asan_fake_stack_roots(possible_pointers, data, min_block_address, max_block_address);
+        add_possible_value(possible_pointers, data, HeapRoot { .type = HeapRoot::Type::StackPointer }, block_index);
+        gather_asan_fake_stack_roots(possible_pointers, data, block_index);
     }
 
     // NOTE: If we have any custom ranges registered, scan those as well.
     //       This is where JS::SafeFunction closures get marked.
     if (s_custom_ranges_for_conservative_scan) {
         for (auto& custom_range : *s_custom_ranges_for_conservative_scan) {
+            auto safe_function_location = s_safe_function_locations->get(custom_range.key);
             for (size_t i = 0; i < (custom_range.value / sizeof(FlatPtr)); ++i) {
-                auto safe_function_location = s_safe_function_locations->get(custom_range.key);
-                add_possible_value(possible_pointers, custom_range.key[i], HeapRoot { .type = HeapRoot::Type::SafeFunction, .location = *safe_function_location }, min_block_address, max_block_address);
+                add_possible_value(possible_pointers, custom_range.key[i], HeapRoot { .type = HeapRoot::Type::SafeFunction, .location = *safe_function_location }, block_index);
             }
         }
     }
 
     for (auto& vector : m_conservative_vectors) {
         for (auto possible_value : vector.possible_values()) {
-            add_possible_value(possible_pointers, possible_value, HeapRoot { .type = HeapRoot::Type::ConservativeVector }, min_block_address, max_block_address);
+            add_possible_value(possible_pointers, possible_value, HeapRoot { .type = HeapRoot::Type::ConservativeVector }, block_index);
         }
     }
 
-    HashTable<HeapBlock*> all_live_heap_blocks;
-    for_each_block([&](auto& block) {
-        all_live_heap_blocks.set(&block);
-        return IterationDecision::Continue;
-    });
-
-    for_each_cell_among_possible_pointers(all_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr possible_pointer) {
+    for_each_cell_among_possible_pointers(possible_pointers, [&](Cell* cell, FlatPtr possible_pointer) {
         if (cell->state() == Cell::State::Live) {
             dbgln_if(HEAP_DEBUG, "  ?-> {}", (void const*)cell);
             roots.set(cell, *possible_pointers.get(possible_pointer));
@@ -369,17 +414,75 @@ NO_SANITIZE_ADDRESS void Heap::gather_conservative_roots(HashMap<Cell*, HeapRoot
     });
 }
 
+// Cells that one marking thread has found but not visited yet, handed over in segments to the threads that ran out
+// of work of their own. Marking is over once every thread is waiting for a segment.
+class MarkingWorklist {
+    AK_MAKE_NONCOPYABLE(MarkingWorklist);
+    AK_MAKE_NONMOVABLE(MarkingWorklist);
+
+public:
+    static constexpr size_t segment_size = 256;
+    using Segment = Vector<NonnullGCPtr<Cell>>;
+
+    explicit MarkingWorklist(size_t thread_count)
+        : m_thread_count(thread_count)
+        , m_segment_available(m_mutex)
+    {
+    }
+
+    // Checked without taking the lock, so threads only give away work when somebody is waiting for it.
+    bool has_waiting_threads() const
+    {
+        return m_waiting_thread_count.load(AK::memory_order_relaxed) > m_segment_count.load(AK::memory_order_relaxed);
+    }
+
+    void publish(Segment&& segment)
+    {
+        Threading::MutexLocker locker(m_mutex);
+        m_segments.append(move(segment));
+        m_segment_count.store(m_segments.size(), AK::memory_order_relaxed);
+        m_segment_available.signal();
+    }
+
+    // Waits until a segment is published, or returns false once no thread has work left to publish.
+    bool take(Segment& segment)
+    {
+        Threading::MutexLocker locker(m_mutex);
+        m_waiting_thread_count.fetch_add(1, AK::memory_order_relaxed);
+        while (m_segments.is_empty()) {
+            if (m_is_done || m_waiting_thread_count.load(AK::memory_order_relaxed) == m_thread_count) {
+                m_is_done = true;
+                m_segment_available.broadcast();
+                return false;
+            }
+            m_segment_available.wait();
+        }
+        m_waiting_thread_count.fetch_sub(1, AK::memory_order_relaxed);
+        segment = m_segments.take_last();
+        m_segment_count.store(m_segments.size(), AK::memory_order_relaxed);
+        return true;
+    }
+
+private:
+    size_t const m_thread_count { 0 };
+    Threading::Mutex m_mutex;
+    Threading::ConditionVariable m_segment_available;
+    Vector<Segment> m_segments;
+    bool m_is_done { false };
+    Atomic<size_t> m_segment_count { 0 };
+    Atomic<size_t> m_waiting_thread_count { 0 };
+};
+
 class MarkingVisitor final : public Cell::Visitor {
 public:
-    explicit MarkingVisitor(Heap& heap, HashMap<Cell*, HeapRoot> const& roots)
+    explicit MarkingVisitor(Heap& heap, MarkingWorklist* worklist = nullptr)
         : m_heap(heap)
+        , m_worklist(worklist)
     {
-        m_heap.find_min_and_max_block_addresses(m_min_block_address, m_max_block_address);
-        m_heap.for_each_block([&](auto& block) {
-            m_all_live_heap_blocks.set(&block);
-            return IterationDecision::Continue;
-        });
+    }
 
+    void visit_roots(HashMap<Cell*, HeapRoot> const& roots)
+    {
         for (auto* root : roots.keys()) {
             visit(root);
         }
@@ -387,54 +490,138 @@ public:
 
     virtual void visit_impl(Cell& cell) override
     {
-        if (cell.is_marked())
+        if (!mark(cell))
             return;
         dbgln_if(HEAP_DEBUG, "  ! {}", &cell);
 
-        cell.set_marked(true);
         m_work_queue.append(cell);
     }
 
     virtual void visit_possible_values(ReadonlyBytes bytes) override
     {
+        auto& block_index = ensure_block_index();
+
         HashMap<FlatPtr, HeapRoot> possible_pointers;
 
         auto* raw_pointer_sized_values = reinterpret_cast<FlatPtr const*>(bytes.data());
         for (size_t i = 0; i < (bytes.size() / sizeof(FlatPtr)); ++i)
-            add_possible_value(possible_pointers, raw_pointer_sized_values[i], HeapRoot { .type = HeapRoot::Type::HeapFunctionCapturedPointer }, m_min_block_address, m_max_block_address);
+            add_possible_value(possible_pointers, raw_pointer_sized_values[i], HeapRoot { .type = HeapRoot::Type::HeapFunctionCapturedPointer }, block_index);
 
-        for_each_cell_among_possible_pointers(m_all_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr) {
-            if (cell->is_marked())
-                return;
+        for_each_cell_among_possible_pointers(possible_pointers, [&](Cell* cell, FlatPtr) {
             if (cell->state() != Cell::State::Live)
                 return;
-            cell->set_marked(true);
+            if (!mark(*cell))
+                return;
             m_work_queue.append(*cell);
         });
     }
 
     void mark_all_live_cells()
     {
-        while (!m_work_queue.is_empty()) {
-            m_work_queue.take_last()->visit_edges(*this);
+        if (!m_worklist) {
+            while (!m_work_queue.is_empty()) {
+                m_work_queue.take_last()->visit_edges(*this);
+            }
+            return;
         }
+
+        MarkingWorklist::Segment segment;
+        do {
+            m_work_queue.extend(move(segment));
+            segment.clear();
+            while (!m_work_queue.is_empty()) {
+                m_work_queue.take_last()->visit_edges(*this);
+                if (m_work_queue.size() > MarkingWorklist::segment_size && m_worklist->has_waiting_threads())
+                    share_work();
+            }
+        } while (m_worklist->take(segment));
+    }
+
+    // Hands all queued cells to the worklist, so that the threads that start marking afterwards can take them.
+    void share_all_work()
+    {
+        while (!m_work_queue.is_empty())
+            share_work();
     }
 
 private:
+    // Returns whether the cell was newly marked, in which case its edges still have to be visited.
+    ALWAYS_INLINE bool mark(Cell& cell)
+    {
+        if (m_worklist)
+            return cell.try_mark_atomically();
+        if (cell.is_marked())
+            return false;
+        cell.set_marked(true);
+        return true;
+    }
+
+    void share_work()
+    {
+        MarkingWorklist::Segment segment;
+        segment.ensure_capacity(min(m_work_queue.size(), MarkingWorklist::segment_size));
+        for (size_t i = 0; i < MarkingWorklist::segment_size && !m_work_queue.is_empty(); ++i)
+            segment.unchecked_append(m_work_queue.take_last());
+        m_worklist->publish(move(segment));
+    }
+
+    // NOTE: The block index is only needed to resolve conservatively scanned values, which most marking
+    //       passes never encounter. Build it on first use instead of paying for it on every collection.
+    HeapBlockIndex const& ensure_block_index()
+    {
+        if (!m_block_index.has_value())
+            m_block_index.emplace(m_heap);
+        return *m_block_index;
+    }
+
     Heap& m_heap;
+    MarkingWorklist* m_worklist { nullptr };
     Vector<NonnullGCPtr<Cell>> m_work_queue;
-    HashTable<HeapBlock*> m_all_live_heap_blocks;
-    FlatPtr m_min_block_address;
-    FlatPtr m_max_block_address;
+    Optional<HeapBlockIndex> m_block_index;
 };
 
 void Heap::mark_live_cells(HashMap<Cell*, HeapRoot> const& roots)
 {
     dbgln_if(HEAP_DEBUG, "mark_live_cells:");
 
-    MarkingVisitor visitor(*this, roots);
+    size_t block_count = 0;
+    if (m_marking_thread_count > 0) {
+        for_each_block([&](auto&) {
+            ++block_count;
+            return IterationDecision::Continue;
+        });
+    }
+
+    if (block_count < GC_PARALLEL_MARKING_MIN_BLOCK_COUNT) {
+        MarkingVisitor visitor(*this);
+        visitor.visit_roots(roots);
+        visitor.mark_all_live_cells();
+    } else {
+        // The roots have been gathered on this thread, as the conservative scan has to look at its stack. The cells
+        // reachable from them are marked by this thread and the helper threads together.
+        MarkingWorklist worklist(m_marking_thread_count + 1);
+        MarkingVisitor visitor(*this, &worklist);
+        visitor.visit_roots(roots);
+        visitor.share_all_work();
+
+        Vector<NonnullRefPtr<Threading::Thread>> helper_threads;
+        helper_threads.ensure_capacity(m_marking_thread_count);
+        for (size_t i = 0; i < m_marking_thread_count; ++i) {
+            auto thread = Threading::Thread::construct([this, &worklist]() -> intptr_t {
+                MarkingVisitor helper_visitor(*this, &worklist);
+                helper_visitor.mark_all_live_cells();
+                return 0;
+            },
+                "GC marking"sv);
+            thread->start();
+            helper_threads.unchecked_append(move(thread));
+        }
+
+        visitor.mark_all_live_cells();
 
-    visitor.mark_all_live_cells();
+        for (auto& thread : helper_threads)
+            (void)thread->join();
+    }
 
     for (auto& inverse_root : m_uprooted_cells)
         inverse_root->set_marked(false);
@@ -452,6 +639,8 @@ bool Heap::cell_must_survive_garbage_collection(Cell const& cell)
 void Heap::finalize_unmarked_cells()
 {
     for_each_block([&](auto& block) {
+        if (!block.has_unmarked_live_cells())
+            return IterationDecision::Continue;
         block.template for_each_cell_in_state<Cell::State::Live>([](Cell* cell) {
             if (!cell->is_marked() && !cell_must_survive_garbage_collection(*cell))
                 cell->finalize();
@@ -463,6 +652,11 @@ void Heap::finalize_unmarked_cells()
 void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measurement_timer)
 {
     dbgln_if(HEAP_DEBUG, "sweep_dead_cells:");
+
+    Core::ElapsedTimer sweep_measurement_timer;
+    if (print_report)
+        sweep_measurement_timer.start();
+
     Vector<HeapBlock*, 32> empty_blocks;
     Vector<HeapBlock*, 32> full_blocks_that_became_usable;
 
@@ -470,23 +664,35 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
     size_t live_cells = 0;
     size_t collected_cell_bytes = 0;
     size_t live_cell_bytes = 0;
+    m_last_sweep_statistics = {};
 
     for_each_block([&](auto& block) {
+        if (block.live_cell_count() > 0 && !block.has_unmarked_live_cells()) {
+            live_cells += block.live_cell_count();
+            live_cell_bytes += block.live_cell_count() * block.cell_size();
+            block.clear_mark_bits();
+            ++m_last_sweep_statistics.skipped_block_count;
+            return IterationDecision::Continue;
+        }
+        ++m_last_sweep_statistics.swept_block_count;
+
         bool block_has_live_cells = false;
         bool block_was_full = block.is_full();
         block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
             if (!cell->is_marked() && !cell_must_survive_garbage_collection(*cell)) {
                 dbgln_if(HEAP_DEBUG, "  ~ {}", cell);
+                if (m_allocation_profiler) [[unlikely]]
+                    m_allocation_profiler->will_deallocate(*cell);
                 block.deallocate(cell);
                 ++collected_cells;
                 collected_cell_bytes += block.cell_size();
             } else {
-                cell->set_marked(false);
                 block_has_live_cells = true;
                 ++live_cells;
                 live_cell_bytes += block.cell_size();
             }
         });
+        block.clear_mark_bits();
         if (!block_has_live_cells)
             empty_blocks.append(&block);
         else if (block_was_full != block.is_full())
@@ -507,6 +713,9 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
         block->cell_allocator().block_did_become_usable({}, *block);
     }
 
+    for (auto& allocator : m_all_cell_allocators)
+        allocator.sort_usable_blocks_by_occupancy({});
+
     if constexpr (HEAP_DEBUG) {
         for_each_block([&](auto& block) {
             dbgln(" > Live HeapBlock @ {}: cell_size={}", &block, block.cell_size());
@@ -514,10 +723,20 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
         });
     }
 
+    if (m_allocation_profiler)
+        m_allocation_profiler->did_collect_garbage();
+
     m_gc_bytes_threshold = live_cell_bytes > GC_MIN_BYTES_THRESHOLD ? live_cell_bytes : GC_MIN_BYTES_THRESHOLD;
 
+    // NOTE: If this collection only reclaimed a small fraction of the heap, most of what's left is long-lived,
+    //       and another full collection after the usual amount of allocation would mostly re-mark the same cells.
+    //       Back off by letting more allocation happen before the next one.
+    if (collected_cell_bytes < (collected_cell_bytes + live_cell_bytes) / GC_LOW_YIELD_DIVISOR)
+        m_gc_bytes_threshold *= GC_LOW_YIELD_THRESHOLD_MULTIPLIER;
+
     if (print_report) {
         Duration const time_spent = measurement_timer.elapsed_time();
+        Duration const sweep_time_spent = sweep_measurement_timer.elapsed_time();
         size_t live_block_count = 0;
         for_each_block([&](auto&) {
             ++live_block_count;
@@ -527,11 +746,18 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
         dbgln("Garbage collection report");
         dbgln("=============================================");
         dbgln("     Time spent: {} ms", time_spent.to_milliseconds());
+        dbgln("  Mark/finalize: {} ms", (time_spent - sweep_time_spent).to_milliseconds());
+        dbgln("          Sweep: {} ms", sweep_time_spent.to_milliseconds());
         dbgln("     Live cells: {} ({} bytes)", live_cells, live_cell_bytes);
         dbgln("Collected cells: {} ({} bytes)", collected_cells, collected_cell_bytes);
         dbgln("    Live blocks: {} ({} bytes)", live_block_count, live_block_count * HeapBlock::block_size);
         dbgln("   Freed blocks: {} ({} bytes)", empty_blocks.size(), empty_blocks.size() * HeapBlock::block_size);
+        dbgln(" Skipped blocks: {} of {}", m_last_sweep_statistics.skipped_block_count, m_last_sweep_statistics.skipped_block_count + m_last_sweep_statistics.swept_block_count);
         dbgln("=============================================");
+        if (m_allocation_profiler) {
+            m_allocation_profiler->dump_report(10);
+            dbgln("=============================================");
+        }
     }
 }
 
@@ -11,6 +11,8 @@
 #include <AK/IntrusiveList.h>
 #include <AK/Noncopyable.h>
 #include <AK/NonnullOwnPtr.h>
+#include <AK/OwnPtr.h>
+#include <AK/Time.h>
 #include <AK/Types.h>
 #include <AK/Vector.h>
 #include <LibCore/Forward.h>
@@ -28,6 +30,8 @@
 
 namespace JS {
 
+class HeapBlockIndex;
+
 class Heap : public HeapBase {
     AK_MAKE_NONCOPYABLE(Heap);
     AK_MAKE_NONMOVABLE(Heap);
@@ -43,6 +47,7 @@ public:
         defer_gc();
         new (memory) T(forward<Args>(args)...);
         undefer_gc();
+        did_allocate_cell(*memory);
         return *static_cast<T*>(memory);
     }
 
@@ -53,6 +58,7 @@ public:
         defer_gc();
         new (memory) T(forward<Args>(args)...);
         undefer_gc();
+        did_allocate_cell(*memory);
         auto* cell = static_cast<T*>(memory);
         memory->initialize(realm);
         return *cell;
@@ -66,9 +72,27 @@ public:
     void collect_garbage(CollectionType = CollectionType::CollectGarbage, bool print_report = false);
     AK::JsonObject dump_graph();
 
+    AK::Duration total_time_spent_collecting_garbage() const { return m_total_time_spent_collecting_garbage; }
+
+    // Blocks whose live cells are all marked are skipped by the sweep, the others have each of their cells looked at.
+    struct SweepStatistics {
+        size_t swept_block_count { 0 };
+        size_t skipped_block_count { 0 };
+    };
+    SweepStatistics const& last_sweep_statistics() const { return m_last_sweep_statistics; }
+
     bool should_collect_on_every_allocation() const { return m_should_collect_on_every_allocation; }
     void set_should_collect_on_every_allocation(bool b) { m_should_collect_on_every_allocation = b; }
 
+    // Records the allocation site of every Nth allocated cell, see AllocationProfiler. Zero turns sampling off.
+    void set_allocation_sample_interval(size_t);
+    AllocationProfiler const* allocation_profiler() const { return m_allocation_profiler; }
+
+    // Spreads the marking of large heaps over this many threads in addition to the collecting one. Zero marks on
+    // the collecting thread only. Every visit_edges() has to be safe to run at the same time as the visit_edges() of
+    // other cells for this to be turned on.
+    void set_marking_thread_count(size_t);
+
     void did_create_handle(Badge<HandleImpl>, HandleImpl&);
     void did_destroy_handle(Badge<HandleImpl>, HandleImpl&);
 
@@ -88,7 +112,20 @@ public:
 
     void uproot_cell(Cell* cell);
 
+    // Calls the callback with every live cell and the size of the heap storage it occupies.
+    template<typename Callback>
+    void for_each_live_cell(Callback callback)
+    {
+        for_each_block([&](auto& block) {
+            block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
+                callback(*cell, block.cell_size());
+            });
+            return IterationDecision::Continue;
+        });
+    }
+
 private:
+    friend class HeapBlockIndex;
     friend class MarkingVisitor;
     friend class GraphConstructorVisitor;
     friend class DeferGC;
@@ -112,10 +149,17 @@ private:
 
     void will_allocate(size_t);
 
-    void find_min_and_max_block_addresses(FlatPtr& min_address, FlatPtr& max_address);
+    ALWAYS_INLINE void did_allocate_cell(Cell& cell)
+    {
+        if (m_allocation_profiler) [[unlikely]]
+            did_allocate_cell_while_profiling(cell);
+    }
+
+    void did_allocate_cell_while_profiling(Cell&);
+
     void gather_roots(HashMap<Cell*, HeapRoot>&);
     void gather_conservative_roots(HashMap<Cell*, HeapRoot>&);
-    void gather_asan_fake_stack_roots(HashMap<FlatPtr, HeapRoot>&, FlatPtr, FlatPtr min_block_address, FlatPtr max_block_address);
+    void gather_asan_fake_stack_roots(HashMap<FlatPtr, HeapRoot>&, FlatPtr, HeapBlockIndex const&);
     void mark_live_cells(HashMap<Cell*, HeapRoot> const& live_cells);
     void finalize_unmarked_cells();
     void sweep_dead_cells(bool print_report, Core::ElapsedTimer const&);
@@ -141,11 +185,21 @@ private:
     }
 
     static constexpr size_t GC_MIN_BYTES_THRESHOLD { 4 * 1024 * 1024 };
+    static constexpr size_t GC_LOW_YIELD_DIVISOR { 8 };
+    static constexpr size_t GC_LOW_YIELD_THRESHOLD_MULTIPLIER { 2 };
+    static constexpr size_t GC_PARALLEL_MARKING_MIN_BLOCK_COUNT { 1024 };
     size_t m_gc_bytes_threshold { GC_MIN_BYTES_THRESHOLD };
     size_t m_allocated_bytes_since_last_gc { 0 };
 
     bool m_should_collect_on_every_allocation { false };
 
+    OwnPtr<AllocationProfiler> m_allocation_profiler;
+
+    size_t m_marking_thread_count { 0 };
+
+    AK::Duration m_total_time_spent_collecting_garbage;
+    SweepStatistics m_last_sweep_statistics;
+
     Vector<NonnullOwnPtr<CellAllocator>> m_size_based_cell_allocators;
     CellAllocator::List m_all_cell_allocators;
 
@@ -47,6 +47,7 @@ void HeapBlock::deallocate(Cell* cell)
     freelist_entry->set_state(Cell::State::Dead);
     freelist_entry->next = m_freelist;
     m_freelist = freelist_entry;
+    --m_live_cell_count;
 
 #ifdef HAS_ADDRESS_SANITIZER
     auto dword_after_freelist = round_up_to_power_of_two(reinterpret_cast<uintptr_t>(freelist_entry) + sizeof(FreelistEntry), 8);
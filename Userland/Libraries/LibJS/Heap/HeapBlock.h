@@ -31,6 +31,11 @@ public:
     size_t cell_size() const { return m_cell_size; }
     size_t cell_count() const { return (block_size - sizeof(HeapBlock)) / m_cell_size; }
     bool is_full() const { return !has_lazy_freelist() && !m_freelist; }
+    size_t live_cell_count() const { return m_live_cell_count; }
+
+    // Whether sweeping has anything to do in this block. If every live cell is marked, there's nothing to finalize or
+    // deallocate, and the cells don't have to be looked at at all.
+    bool has_unmarked_live_cells() const { return marked_cell_count() != m_live_cell_count; }
 
     ALWAYS_INLINE Cell* allocate()
     {
@@ -44,6 +49,7 @@ public:
 
         if (allocated_cell) {
             ASAN_UNPOISON_MEMORY_REGION(allocated_cell, m_cell_size);
+            ++m_live_cell_count;
         }
         return allocated_cell;
     }
@@ -111,11 +117,13 @@ private:
     CellAllocator& m_cell_allocator;
     size_t m_cell_size { 0 };
     size_t m_next_lazy_freelist_index { 0 };
+    size_t m_live_cell_count { 0 };
     GCPtr<FreelistEntry> m_freelist;
     alignas(__BIGGEST_ALIGNMENT__) u8 m_storage[];
 
 public:
     static constexpr size_t min_possible_cell_size = sizeof(FreelistEntry);
+    static_assert(min_possible_cell_size >= mark_bit_granule);
 };
 
 }
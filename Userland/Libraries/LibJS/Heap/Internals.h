@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <AK/Atomic.h>
+#include <AK/BuiltinWrappers.h>
 #include <AK/Types.h>
 #include <LibJS/Forward.h>
 
@@ -41,13 +43,67 @@ public:
 
     Heap& heap() { return m_heap; }
 
+    // Mark bits live in a bitmap at the start of each block rather than in the cells themselves, so marking doesn't
+    // write to every live cell and sweeping can look at a whole word of cells at a time. There is one bit for every
+    // mark_bit_granule bytes of the block; no cell is smaller than that, so every cell gets a bit of its own.
+    static constexpr size_t mark_bit_granule = 16;
+    static constexpr size_t mark_bits_per_word = sizeof(u64) * 8;
+    static constexpr size_t mark_bitmap_word_count = block_size / mark_bit_granule / mark_bits_per_word;
+
+    ALWAYS_INLINE bool is_cell_marked(Cell const* cell) const
+    {
+        auto index = mark_bit_index(cell);
+        return m_mark_bits[index / mark_bits_per_word] & mark_bit(index);
+    }
+
+    ALWAYS_INLINE void set_cell_marked(Cell const* cell, bool marked)
+    {
+        auto index = mark_bit_index(cell);
+        if (marked)
+            m_mark_bits[index / mark_bits_per_word] |= mark_bit(index);
+        else
+            m_mark_bits[index / mark_bits_per_word] &= ~mark_bit(index);
+    }
+
+    // Marks the cell unless another marking thread got to it first. Returns whether this call marked it.
+    ALWAYS_INLINE bool try_mark_cell_atomically(Cell const* cell)
+    {
+        auto index = mark_bit_index(cell);
+        auto* word = &m_mark_bits[index / mark_bits_per_word];
+        auto bit = mark_bit(index);
+        if (AK::atomic_load(word, AK::memory_order_relaxed) & bit)
+            return false;
+        return !(AK::atomic_fetch_or(word, bit, AK::memory_order_relaxed) & bit);
+    }
+
+    size_t marked_cell_count() const
+    {
+        size_t count = 0;
+        for (auto word : m_mark_bits)
+            count += popcount(word);
+        return count;
+    }
+
+    void clear_mark_bits() { __builtin_memset(m_mark_bits, 0, sizeof(m_mark_bits)); }
+
 protected:
     HeapBlockBase(Heap& heap)
         : m_heap(heap)
     {
     }
 
+    static ALWAYS_INLINE size_t mark_bit_index(Cell const* cell)
+    {
+        return (bit_cast<FlatPtr>(cell) & (block_size - 1)) / mark_bit_granule;
+    }
+
+    static ALWAYS_INLINE u64 mark_bit(size_t index)
+    {
+        return static_cast<u64>(1) << (index % mark_bits_per_word);
+    }
+
     Heap& m_heap;
+    u64 m_mark_bits[mark_bitmap_word_count] {};
 };
 
 }
@@ -244,6 +244,13 @@ public:
     {
         m_contains_direct_call_to_eval = true;
         m_screwed_by_eval_in_scope_chain = true;
+        m_might_refer_to_any_name = true;
+    }
+
+    // Whether code in this scope or any scope nested in it might refer to a binding with the given name.
+    bool might_refer_to(DeprecatedFlyString const& name) const
+    {
+        return m_might_refer_to_any_name || m_identifier_groups.contains(name);
     }
     void set_contains_access_to_arguments_object() { m_contains_access_to_arguments_object = true; }
     void set_scope_node(ScopeNode* node) { m_node = node; }
@@ -270,6 +277,10 @@ public:
     {
         VERIFY(is_top_level() || m_parent_scope);
 
+        // NOTE: The identifiers of scopes that end inside a catch parameter are not passed on to the parent scope below.
+        if (m_parent_scope && (m_might_refer_to_any_name || (m_parser.m_state.in_catch_parameter_context && !m_identifier_groups.is_empty())))
+            m_parent_scope->m_might_refer_to_any_name = true;
+
         if (m_parent_scope && !m_function_parameters.has_value()) {
             m_parent_scope->m_contains_access_to_arguments_object |= m_contains_access_to_arguments_object;
             m_parent_scope->m_contains_direct_call_to_eval |= m_contains_direct_call_to_eval;
@@ -519,6 +530,9 @@ private:
     bool m_contains_await_expression { false };
     bool m_screwed_by_eval_in_scope_chain { false };
 
+    // Set when this scope contains a direct call to eval, or a reference to a name that isn't kept track of.
+    bool m_might_refer_to_any_name { false };
+
     // Function uses this binding from function environment if:
     // 1. It's an arrow function or establish parent scope for an arrow function
     // 2. Uses new.target
@@ -2964,6 +2978,8 @@ NonnullRefPtr<FunctionNodeType> Parser::parse_function_node(u16 parse_options, O
         consume(TokenType::CurlyOpen);
 
         auto body = parse_function_body(parameters, function_kind, parsing_insights);
+        if (name)
+            parsing_insights.might_refer_to_own_name = function_scope.might_refer_to(name->string());
         return body;
     }();
 
@@ -7,6 +7,7 @@
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/ArrayBuffer.h>
 #include <LibJS/Runtime/ArrayBufferConstructor.h>
+#include <LibJS/Runtime/AtomicsObject.h>
 #include <LibJS/Runtime/GlobalObject.h>
 
 namespace JS {
@@ -52,6 +53,15 @@ void ArrayBuffer::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_detach_key);
 }
 
+void ArrayBuffer::finalize()
+{
+    Base::finalize();
+
+    // Drop any waiters left behind by Atomics.wait and Atomics.waitAsync on this buffer.
+    if (is_shared_array_buffer())
+        remove_waiter_lists_of_buffer(*this);
+}
+
 // 6.2.9.1 CreateByteDataBlock ( size ), https://tc39.es/ecma262/#sec-createbytedatablock
 ThrowCompletionOr<DataBlock> create_byte_data_block(VM& vm, size_t size)
 {
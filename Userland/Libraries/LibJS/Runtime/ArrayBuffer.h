@@ -136,6 +136,7 @@ private:
     ArrayBuffer(ByteBuffer* buffer, Object& prototype);
 
     virtual void visit_edges(Visitor&) override;
+    virtual void finalize() override;
 
     DataBlock m_data_block;
     Optional<size_t> m_max_byte_length;
@@ -62,8 +62,8 @@ void ArrayPrototype::initialize(Realm& realm)
     define_native_function(realm, vm.names.keys, keys, 0, attr);
     define_native_function(realm, vm.names.lastIndexOf, last_index_of, 1, attr);
     define_native_function(realm, vm.names.map, map, 1, attr);
-    define_native_function(realm, vm.names.pop, pop, 0, attr);
-    define_native_function(realm, vm.names.push, push, 1, attr);
+    define_native_function(realm, vm.names.pop, pop, 0, attr, Bytecode::Builtin::ArrayPrototypePop);
+    define_native_function(realm, vm.names.push, push, 1, attr, Bytecode::Builtin::ArrayPrototypePush);
     define_native_function(realm, vm.names.reduce, reduce, 1, attr);
     define_native_function(realm, vm.names.reduceRight, reduce_right, 1, attr);
     define_native_function(realm, vm.names.reverse, reverse, 0, attr);
@@ -109,6 +109,23 @@ void ArrayPrototype::initialize(Realm& realm)
     define_direct_property(vm.well_known_symbol_unscopables(), unscopable_list, Attribute::Configurable);
 }
 
+// OPTIMIZATION: If an object can't intercept indexed property access and keeps its elements in simple storage,
+//               an element that's present there is an own data property. For those, HasProperty is known to be
+//               true and Get returns the stored value, so we can skip both and read the element directly.
+//               Holes (and everything else) still take the generic path, since they may hit the prototype chain.
+static Optional<Value> fast_get_own_element(Object const& object, size_t index)
+{
+    if (object.may_interfere_with_indexed_property_access())
+        return {};
+    auto const* storage = object.indexed_properties().storage();
+    if (!storage || !storage->is_simple_storage() || index >= NumericLimits<u32>::max())
+        return {};
+    auto maybe_value = static_cast<SimpleIndexedPropertyStorage const*>(storage)->inline_get(static_cast<u32>(index));
+    if (!maybe_value.has_value() || maybe_value->value.is_accessor())
+        return {};
+    return maybe_value->value;
+}
+
 // 10.4.2.3 ArraySpeciesCreate ( originalArray, length ), https://tc39.es/ecma262/#sec-arrayspeciescreate
 static ThrowCompletionOr<Object*> array_species_create(VM& vm, Object& original_array, size_t length)
 {
@@ -697,6 +714,11 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::for_each)
     // 4. Let k be 0.
     // 5. Repeat, while k < len,
     for (size_t k = 0; k < length; ++k) {
+        if (auto k_value = fast_get_own_element(*object, k); k_value.has_value()) {
+            TRY(call(vm, callback_function.as_function(), this_arg, *k_value, Value(k), object));
+            continue;
+        }
+
         // a. Let Pk be ! ToString(𝔽(k)).
         auto property_key = PropertyKey { k };
 
@@ -797,6 +819,12 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::index_of)
 
     // 10. Repeat, while k < len,
     for (; k < length; ++k) {
+        if (auto element_k = fast_get_own_element(*object, k); element_k.has_value()) {
+            if (is_strictly_equal(search_element, *element_k))
+                return Value(k);
+            continue;
+        }
+
         auto property_key = PropertyKey { k };
 
         // a. Let kPresent be ? HasProperty(O, ! ToString(𝔽(k))).
@@ -958,6 +986,12 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::map)
         // a. Let Pk be ! ToString(𝔽(k)).
         auto property_key = PropertyKey { k };
 
+        if (auto k_value = fast_get_own_element(*object, k); k_value.has_value()) {
+            auto mapped_value = TRY(call(vm, callback_function.as_function(), this_arg, *k_value, Value(k), object));
+            TRY(array->create_data_property_or_throw(property_key, mapped_value));
+            continue;
+        }
+
         // b. Let kPresent be ? HasProperty(O, Pk).
         auto k_present = TRY(object->has_property(property_key));
 
@@ -981,9 +1015,9 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::map)
 }
 
 // 23.1.3.22 Array.prototype.pop ( ), https://tc39.es/ecma262/#sec-array.prototype.pop
-JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::pop)
+ThrowCompletionOr<Value> ArrayPrototype::pop_impl(VM& vm, Value this_value)
 {
-    auto this_object = TRY(vm.this_value().to_object(vm));
+    auto this_object = TRY(this_value.to_object(vm));
     auto length = TRY(length_of_array_like(vm, this_object));
     if (length == 0) {
         TRY(this_object->set(vm.names.length, Value(0), Object::ShouldThrowExceptions::Yes));
@@ -996,22 +1030,31 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::pop)
     return element;
 }
 
+JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::pop)
+{
+    return pop_impl(vm, vm.this_value());
+}
+
 // 23.1.3.23 Array.prototype.push ( ...items ), https://tc39.es/ecma262/#sec-array.prototype.push
-JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::push)
+ThrowCompletionOr<Value> ArrayPrototype::push_impl(VM& vm, Value this_value, ReadonlySpan<Value> items)
 {
-    auto this_object = TRY(vm.this_value().to_object(vm));
+    auto this_object = TRY(this_value.to_object(vm));
     auto length = TRY(length_of_array_like(vm, this_object));
-    auto argument_count = vm.argument_count();
-    auto new_length = length + argument_count;
+    auto new_length = length + items.size();
     if (new_length > MAX_ARRAY_LIKE_INDEX)
         return vm.throw_completion<TypeError>(ErrorType::ArrayMaxSize);
-    for (size_t i = 0; i < argument_count; ++i)
-        TRY(this_object->set(length + i, vm.argument(i), Object::ShouldThrowExceptions::Yes));
+    for (size_t i = 0; i < items.size(); ++i)
+        TRY(this_object->set(length + i, items[i], Object::ShouldThrowExceptions::Yes));
     auto new_length_value = Value(new_length);
     TRY(this_object->set(vm.names.length, new_length_value, Object::ShouldThrowExceptions::Yes));
     return new_length_value;
 }
 
+JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::push)
+{
+    return push_impl(vm, vm.this_value(), vm.running_execution_context().arguments);
+}
+
 // 23.1.3.24 Array.prototype.reduce ( callbackfn [ , initialValue ] ), https://tc39.es/ecma262/#sec-array.prototype.reduce
 JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::reduce)
 {
@@ -19,6 +19,9 @@ public:
     virtual void initialize(Realm&) override;
     virtual ~ArrayPrototype() override = default;
 
+    static ThrowCompletionOr<Value> pop_impl(VM&, Value this_value);
+    static ThrowCompletionOr<Value> push_impl(VM&, Value this_value, ReadonlySpan<Value> items);
+
 private:
     explicit ArrayPrototype(Realm&);
 
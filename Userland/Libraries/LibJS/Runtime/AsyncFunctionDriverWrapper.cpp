@@ -7,9 +7,11 @@
 #include <AK/TypeCasts.h>
 #include <LibJS/Runtime/AsyncFunctionDriverWrapper.h>
 #include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/JobCallback.h>
 #include <LibJS/Runtime/NativeFunction.h>
 #include <LibJS/Runtime/PromiseCapability.h>
 #include <LibJS/Runtime/PromiseConstructor.h>
+#include <LibJS/Runtime/PromiseReaction.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibJS/Runtime/ValueInlines.h>
 
@@ -51,6 +53,35 @@ ThrowCompletionOr<void> AsyncFunctionDriverWrapper::await(JS::Value value)
     // 2. Let promise be ? PromiseResolve(%Promise%, value).
     auto* promise_object = TRY(promise_resolve(vm, realm.intrinsics().promise_constructor(), value));
 
+    // 3-7. Perform PerformPromiseThen(promise, onFulfilled, onRejected).
+    // OPTIMIZATION: The closures only capture asyncContext, which is the same for every await of this async function,
+    //               so the builtin functions and the reactions that refer to them are created once and shared by all
+    //               awaits. They are never exposed to user code, which makes this unobservable. HostMakeJobCallback is
+    //               also only called once, which is fine as it only depends on the running script, and that is always
+    //               the async function itself at this point.
+    if (!m_fulfill_reaction)
+        create_await_reactions(realm);
+
+    m_current_promise = verify_cast<Promise>(promise_object);
+    m_current_promise->perform_then(*m_fulfill_reaction, *m_reject_reaction);
+
+    // 8. Remove asyncContext from the execution context stack and restore the execution context that is at the top of the
+    //    execution context stack as the running execution context.
+    // NOTE: This is done later on for us in continue_async_execution.
+
+    // NOTE: None of these are necessary. 10-12 are handled by step d of the above lambdas.
+    // 9. Let callerContext be the running execution context.
+    // 10. Resume callerContext passing empty. If asyncContext is ever resumed again, let completion be the Completion Record with which it is resumed.
+    // 11. Assert: If control reaches here, then asyncContext is the running execution context again.
+    // 12. Return completion.
+    return {};
+}
+
+// 27.7.5.3 Await ( value ), steps 3-7, https://tc39.es/ecma262/#await
+void AsyncFunctionDriverWrapper::create_await_reactions(Realm& realm)
+{
+    auto& vm = this->vm();
+
     // 3. Let fulfilledClosure be a new Abstract Closure with parameters (v) that captures asyncContext and performs the
     //    following steps when called:
     auto fulfilled_closure = [this](VM& vm) -> ThrowCompletionOr<Value> {
@@ -108,19 +139,9 @@ ThrowCompletionOr<void> AsyncFunctionDriverWrapper::await(JS::Value value)
     auto on_rejected = NativeFunction::create(realm, move(rejected_closure), 1, "");
 
     // 7. Perform PerformPromiseThen(promise, onFulfilled, onRejected).
-    m_current_promise = verify_cast<Promise>(promise_object);
-    m_current_promise->perform_then(on_fulfilled, on_rejected, {});
-
-    // 8. Remove asyncContext from the execution context stack and restore the execution context that is at the top of the
-    //    execution context stack as the running execution context.
-    // NOTE: This is done later on for us in continue_async_execution.
-
-    // NOTE: None of these are necessary. 10-12 are handled by step d of the above lambdas.
-    // 9. Let callerContext be the running execution context.
-    // 10. Resume callerContext passing empty. If asyncContext is ever resumed again, let completion be the Completion Record with which it is resumed.
-    // 11. Assert: If control reaches here, then asyncContext is the running execution context again.
-    // 12. Return completion.
-    return {};
+    //    NOTE: This creates the reactions of steps 3-8 of PerformPromiseThen, without a result capability.
+    m_fulfill_reaction = PromiseReaction::create(vm, PromiseReaction::Type::Fulfill, {}, vm.host_make_job_callback(*on_fulfilled));
+    m_reject_reaction = PromiseReaction::create(vm, PromiseReaction::Type::Reject, {}, vm.host_make_job_callback(*on_rejected));
 }
 
 void AsyncFunctionDriverWrapper::continue_async_execution(VM& vm, Value value, bool is_successful, IsInitialExecution is_initial_execution)
@@ -192,6 +213,8 @@ void AsyncFunctionDriverWrapper::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_top_level_promise);
     if (m_current_promise)
         visitor.visit(m_current_promise);
+    visitor.visit(m_fulfill_reaction);
+    visitor.visit(m_reject_reaction);
     if (m_suspended_execution_context)
         m_suspended_execution_context->visit_edges(visitor);
 }
@@ -34,10 +34,13 @@ public:
 private:
     AsyncFunctionDriverWrapper(Realm&, NonnullGCPtr<GeneratorObject>, NonnullGCPtr<Promise> top_level_promise);
     ThrowCompletionOr<void> await(Value);
+    void create_await_reactions(Realm&);
 
     NonnullGCPtr<GeneratorObject> m_generator_object;
     NonnullGCPtr<Promise> m_top_level_promise;
     GCPtr<Promise> m_current_promise { nullptr };
+    GCPtr<PromiseReaction> m_fulfill_reaction;
+    GCPtr<PromiseReaction> m_reject_reaction;
     Handle<AsyncFunctionDriverWrapper> m_self_handle;
     OwnPtr<ExecutionContext> m_suspended_execution_context;
 };
@@ -13,15 +13,24 @@
 #endif
 
 #include <AK/Atomic.h>
+#include <AK/AtomicRefCounted.h>
 #include <AK/ByteBuffer.h>
 #include <AK/Endian.h>
+#include <AK/HashMap.h>
+#include <AK/NeverDestroyed.h>
+#include <AK/Time.h>
 #include <AK/TypeCasts.h>
+#include <LibJS/Heap/Handle.h>
 #include <LibJS/Runtime/Agent.h>
 #include <LibJS/Runtime/AtomicsObject.h>
 #include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/PromiseCapability.h>
+#include <LibJS/Runtime/PromiseConstructor.h>
 #include <LibJS/Runtime/TypedArray.h>
 #include <LibJS/Runtime/Value.h>
 #include <LibJS/Runtime/ValueInlines.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibThreading/Mutex.h>
 
 namespace JS {
 
@@ -146,6 +155,245 @@ enum class WaitMode {
     Async,
 };
 
+// 25.4.3.1 WaiterList Records, https://tc39.es/ecma262/#sec-waiterlist-records
+// 25.4.3.2 Waiter Records, https://tc39.es/ecma262/#sec-waiter-record
+struct Waiter : public AtomicRefCounted<Waiter> {
+    explicit Waiter(Threading::Mutex& critical_section)
+        : wake_up(critical_section)
+    {
+    }
+
+    // [[AgentSignifier]]
+    VM* agent { nullptr };
+
+    // [[PromiseCapability]], which is null if the agent is blocked waiting for the result.
+    Handle<PromiseCapability> promise_capability;
+
+    // [[TimeoutTime]], which is empty if the waiter never times out.
+    Optional<UnixDateTime> timeout_time;
+
+    // [[Result]]
+    StringView result { "ok"sv };
+
+    // Signaled by NotifyWaiter to wake a blocked agent.
+    Threading::ConditionVariable wake_up;
+};
+
+// NOTE: WaiterLists are keyed by the SharedArrayBuffer that owns the block rather than the block itself. The buffer is a
+//       GC cell, so its lists can be removed when it is finalized, before its address can be reused.
+struct WaiterListKey {
+    ArrayBuffer const* buffer { nullptr };
+    size_t byte_index_in_buffer { 0 };
+
+    bool operator==(WaiterListKey const&) const = default;
+};
+
+}
+
+template<>
+struct AK::Traits<JS::WaiterListKey> : public DefaultTraits<JS::WaiterListKey> {
+    static unsigned hash(JS::WaiterListKey const& key) { return pair_int_hash(ptr_hash(key.buffer), u64_hash(key.byte_index_in_buffer)); }
+};
+
+namespace JS {
+
+// NOTE: Every agent of this process is in the same agent cluster, so all WaiterLists share the one critical section.
+//       Both are never destroyed, as asynchronous waiters can outlive the VM that created them.
+static Threading::Mutex& waiter_list_critical_section()
+{
+    static NeverDestroyed<Threading::Mutex> critical_section;
+    return *critical_section;
+}
+
+static HashMap<WaiterListKey, Vector<NonnullRefPtr<Waiter>>>& waiter_lists()
+{
+    static NeverDestroyed<HashMap<WaiterListKey, Vector<NonnullRefPtr<Waiter>>>> lists;
+    return *lists;
+}
+
+void remove_waiter_lists_of_buffer(ArrayBuffer const& buffer)
+{
+    Threading::MutexLocker locker { waiter_list_critical_section() };
+    waiter_lists().remove_all_matching([&](auto const& key, auto const&) { return key.buffer == &buffer; });
+}
+
+void remove_waiters_of_agent(VM const& agent)
+{
+    Threading::MutexLocker locker { waiter_list_critical_section() };
+    waiter_lists().remove_all_matching([&](auto const&, auto& waiters) {
+        waiters.remove_all_matching([&](auto const& waiter) { return waiter->agent == &agent; });
+        return waiters.is_empty();
+    });
+}
+
+// 25.4.3.10 AddWaiter ( WL, waiterRecord ), https://tc39.es/ecma262/#sec-addwaiter
+static void add_waiter(WaiterListKey const& waiter_list, NonnullRefPtr<Waiter> waiter)
+{
+    // 1. Assert: The surrounding agent is in the critical section for WL.
+    // 2. Assert: There is no Waiter Record in WL.[[Waiters]] whose [[PromiseCapability]] field is waiterRecord.[[PromiseCapability]] and whose [[AgentSignifier]] field is waiterRecord.[[AgentSignifier]].
+    // 3. Append waiterRecord to WL.[[Waiters]].
+    waiter_lists().ensure(waiter_list).append(move(waiter));
+
+    // 4. Return unused.
+}
+
+static bool remove_waiter(WaiterListKey const& waiter_list, Waiter const& waiter)
+{
+    auto it = waiter_lists().find(waiter_list);
+    if (it == waiter_lists().end())
+        return false;
+
+    auto removed = it->value.remove_first_matching([&](auto const& other) { return other.ptr() == &waiter; });
+    if (it->value.is_empty())
+        waiter_lists().remove(it);
+    return removed;
+}
+
+// 25.4.3.11 RemoveWaiters ( WL, c ), https://tc39.es/ecma262/#sec-removewaiters
+static Vector<NonnullRefPtr<Waiter>> remove_waiters(WaiterListKey const& waiter_list, double count)
+{
+    // 1. Assert: The surrounding agent is in the critical section for WL.
+    Vector<NonnullRefPtr<Waiter>> removed_waiters;
+    auto it = waiter_lists().find(waiter_list);
+    if (it == waiter_lists().end())
+        return removed_waiters;
+
+    // 2. Let len be the number of elements in WL.[[Waiters]].
+    auto length = it->value.size();
+
+    // 3. Let n be min(c, len).
+    auto n = count < static_cast<double>(length) ? static_cast<size_t>(count) : length;
+
+    // 4. Let L be a List whose elements are the first n elements of WL.[[Waiters]].
+    // 5. Remove the first n elements of WL.[[Waiters]].
+    removed_waiters.ensure_capacity(n);
+    for (size_t i = 0; i < n; ++i)
+        removed_waiters.unchecked_append(it->value.take_first());
+    if (it->value.is_empty())
+        waiter_lists().remove(it);
+
+    // 6. Return L.
+    return removed_waiters;
+}
+
+// 25.4.3.12 SuspendThisAgent ( WL, waiterRecord ), https://tc39.es/ecma262/#sec-suspendthisagent
+static void suspend_this_agent(VM& vm, WaiterListKey const& waiter_list, Waiter& waiter)
+{
+    // 1. Assert: The surrounding agent is in the critical section for WL.
+    // 2. Assert: WL.[[Waiters]] contains waiterRecord.
+    // 3. Let thisAgent be AgentSignifier().
+    // 4. Assert: waiterRecord.[[AgentSignifier]] is thisAgent.
+    VERIFY(waiter.agent == &vm);
+
+    // 5. Assert: waiterRecord.[[PromiseCapability]] is blocking.
+    VERIFY(waiter.promise_capability.is_null());
+
+    // 6. Assert: AgentCanSuspend() is true.
+    VERIFY(agent_can_suspend(vm));
+
+    // 7. Perform LeaveCriticalSection(WL) and suspend the surrounding agent until the time is waiterRecord.[[TimeoutTime]],
+    //    performing the combined operation in such a way that a notification that arrives after the critical section is
+    //    exited but before the suspension takes effect is not lost. The surrounding agent can only wake from suspension
+    //    due to a timeout or due to another agent calling NotifyWaiter with arguments WL and thisAgent (i.e. via a call to
+    //    Atomics.notify).
+    // 8. Perform EnterCriticalSection(WL).
+    // NOTE: The condition variable releases and reacquires the critical section around the suspension atomically.
+    //       Spurious wake-ups are told apart from notifications by checking whether the waiter is still in the list.
+    auto is_waiting = [&] {
+        auto it = waiter_lists().find(waiter_list);
+        return it != waiter_lists().end() && it->value.contains_slow(waiter);
+    };
+    while (is_waiting()) {
+        if (!waiter.timeout_time.has_value()) {
+            waiter.wake_up.wait();
+            continue;
+        }
+        if (!waiter.wake_up.wait_until(*waiter.timeout_time) && UnixDateTime::now() >= *waiter.timeout_time)
+            break;
+    }
+
+    // 9. If WL.[[Waiters]] contains waiterRecord, then
+    if (remove_waiter(waiter_list, waiter)) {
+        // a. Let timeOfWakeup be the time value (UTC) identifying the current time.
+        // b. Assert: ℝ(timeOfWakeup) ≥ waiterRecord.[[TimeoutTime]] (ignoring potential non-monotonicity of time values).
+        // c. Set waiterRecord.[[Result]] to "timed-out".
+        waiter.result = "timed-out"sv;
+
+        // d. Perform RemoveWaiter(WL, waiterRecord).
+    }
+
+    // 10. Return unused.
+}
+
+// 25.4.3.13 NotifyWaiter ( WL, waiterRecord ), https://tc39.es/ecma262/#sec-notifywaiter
+static void notify_waiter(VM& vm, Waiter& waiter)
+{
+    // 1. Assert: The surrounding agent is in the critical section for WL.
+
+    // 2. If waiterRecord.[[PromiseCapability]] is blocking, then
+    if (waiter.promise_capability.is_null()) {
+        // a. Wake the agent whose signifier is waiterRecord.[[AgentSignifier]] from suspension.
+        // b. NOTE: This causes the agent to resume execution in SuspendThisAgent.
+        waiter.wake_up.signal();
+    }
+    // 3. Else if AgentSignifier() is waiterRecord.[[AgentSignifier]], then
+    else if (waiter.agent == &vm) {
+        // a. Let promiseCapability be waiterRecord.[[PromiseCapability]].
+        auto promise_capability = waiter.promise_capability.cell();
+
+        // b. Perform ! Call(promiseCapability.[[Resolve]], undefined, « waiterRecord.[[Result]] »).
+        MUST(call(vm, *promise_capability->resolve(), js_undefined(), PrimitiveString::create(vm, waiter.result)));
+    }
+    // 4. Else,
+    else {
+        // FIXME: a. Perform EnqueueResolveInAgentJob(waiterRecord.[[AgentSignifier]], waiterRecord.[[PromiseCapability]], waiterRecord.[[Result]]).
+        //        No SharedArrayBuffer can be shared with another agent yet, so this is not reachable.
+        VERIFY_NOT_REACHED();
+    }
+
+    // 5. Return unused.
+}
+
+// 25.4.3.15 EnqueueAtomicsWaitAsyncTimeoutJob ( WL, waiterRecord ), https://tc39.es/ecma262/#sec-enqueueatomicswaitasynctimeoutjob
+static void enqueue_atomics_wait_async_timeout_job(VM& vm, ArrayBuffer& buffer, WaiterListKey const& waiter_list, NonnullRefPtr<Waiter> waiter)
+{
+    // 1. Let timeoutJob be a new Job Abstract Closure with no parameters that captures WL and waiterRecord and performs the following steps when called:
+    // NOTE: Capturing the buffer keeps it, and with it WL, alive until the job has run.
+    auto timeout_job = create_heap_function(vm.heap(), [&vm, buffer = NonnullGCPtr { buffer }, waiter_list, waiter]() {
+        // a. Perform EnterCriticalSection(WL).
+        Threading::MutexLocker locker { waiter_list_critical_section() };
+
+        // b. If WL.[[Waiters]] contains waiterRecord, then
+        if (remove_waiter(waiter_list, *waiter)) {
+            // i. Let timeOfJobExecution be the time value (UTC) identifying the current time.
+            // ii. Assert: ℝ(timeOfJobExecution) ≥ waiterRecord.[[TimeoutTime]] (ignoring potential non-monotonicity of time values).
+            // iii. Set waiterRecord.[[Result]] to "timed-out".
+            waiter->result = "timed-out"sv;
+
+            // iv. Perform RemoveWaiter(WL, waiterRecord).
+            // NOTE: This was done above to check whether WL.[[Waiters]] contained waiterRecord.
+
+            // v. Perform NotifyWaiter(WL, waiterRecord).
+            notify_waiter(vm, *waiter);
+        }
+
+        // c. Perform LeaveCriticalSection(WL).
+        // d. Return unused.
+    });
+
+    // 2. Let now be the time value (UTC) identifying the current time.
+    auto now = UnixDateTime::now();
+
+    // 3. Let currentRealm be the current Realm Record.
+    auto& current_realm = *vm.current_realm();
+
+    // 4. Perform HostEnqueueTimeoutJob(timeoutJob, currentRealm, 𝔽(waiterRecord.[[TimeoutTime]]) - now).
+    auto milliseconds = max(static_cast<double>((*waiter->timeout_time - now).to_microseconds()) / 1000.0, 0.0);
+    vm.host_enqueue_timeout_job(timeout_job, current_realm, milliseconds);
+
+    // 5. Return unused.
+}
+
 // 25.4.3.14 DoWait ( mode, typedArray, index, value, timeout ), https://tc39.es/ecma262/#sec-dowait
 static ThrowCompletionOr<Value> do_wait(VM& vm, WaitMode mode, TypedArrayBase& typed_array, Value index_value, Value expected_value, Value timeout_value)
 {
@@ -186,15 +434,127 @@ static ThrowCompletionOr<Value> do_wait(VM& vm, WaitMode mode, TypedArrayBase& t
         timeout = max(timeout_number.as_double(), 0.0);
 
     // 10. If mode is sync and AgentCanSuspend() is false, throw a TypeError exception.
-    if (mode == WaitMode::Sync && !agent_can_suspend())
+    if (mode == WaitMode::Sync && !agent_can_suspend(vm))
         return vm.throw_completion<TypeError>(ErrorType::AgentCannotSuspend);
 
-    // FIXME: Implement the remaining steps when we support SharedArrayBuffer.
-    (void)index;
-    (void)value;
-    (void)timeout;
+    // 11. Let block be buffer.[[ArrayBufferData]].
+    auto& block = buffer->buffer();
+
+    // 12. Let offset be typedArray.[[ByteOffset]].
+    // 13. Let byteIndexInBuffer be (i × 4) + offset.
+    // NOTE: ValidateAtomicAccess has already turned the index into a byte index.
+    auto byte_index_in_buffer = index;
+
+    // 14. Let WL be GetWaiterList(block, byteIndexInBuffer).
+    WaiterListKey waiter_list { buffer, byte_index_in_buffer };
+
+    auto& realm = *vm.current_realm();
+    GCPtr<PromiseCapability> promise_capability;
+    GCPtr<Object> result_object;
+
+    // 15. If mode is sync, then
+    //     a. Let promiseCapability be blocking.
+    //     b. Let resultObject be undefined.
+    // 16. Else,
+    if (mode == WaitMode::Async) {
+        // a. Let promiseCapability be ! NewPromiseCapability(%Promise%).
+        promise_capability = MUST(new_promise_capability(vm, realm.intrinsics().promise_constructor()));
+
+        // b. Let resultObject be OrdinaryObjectCreate(%Object.prototype%).
+        result_object = Object::create(realm, realm.intrinsics().object_prototype());
+    }
+
+    // 17. Perform EnterCriticalSection(WL).
+    Threading::MutexLocker locker { waiter_list_critical_section() };
+
+    // 18. Let elementType be TypedArrayElementType(typedArray).
+    // 19. Let w be GetValueFromBuffer(buffer, byteIndexInBuffer, elementType, true, seq-cst).
+    i64 current_value = 0;
+    if (array_type_name == vm.names.BigInt64Array.as_string())
+        current_value = AK::atomic_load(reinterpret_cast<i64*>(block.data() + byte_index_in_buffer));
+    else
+        current_value = AK::atomic_load(reinterpret_cast<i32*>(block.data() + byte_index_in_buffer));
+
+    // 20. If v ≠ w, then
+    if (value != current_value) {
+        // a. Perform LeaveCriticalSection(WL).
+        locker.unlock();
 
-    return vm.throw_completion<InternalError>(ErrorType::NotImplemented, "SharedArrayBuffer"sv);
+        // b. If mode is sync, return "not-equal".
+        if (mode == WaitMode::Sync)
+            return PrimitiveString::create(vm, "not-equal"_string);
+
+        // c. Perform ! CreateDataPropertyOrThrow(resultObject, "async", false).
+        MUST(result_object->create_data_property_or_throw(vm.names.async_, Value(false)));
+
+        // d. Perform ! CreateDataPropertyOrThrow(resultObject, "value", "not-equal").
+        MUST(result_object->create_data_property_or_throw(vm.names.value, PrimitiveString::create(vm, "not-equal"_string)));
+
+        // e. Return resultObject.
+        return result_object;
+    }
+
+    // 21. If t = 0 and mode is async, then
+    if (timeout == 0 && mode == WaitMode::Async) {
+        // a. NOTE: There is no special handling of synchronous immediate timeouts. Asynchronous immediate timeouts have
+        //    special handling in order to fail fast and avoid unnecessary Promise jobs.
+
+        // b. Perform LeaveCriticalSection(WL).
+        locker.unlock();
+
+        // c. Perform ! CreateDataPropertyOrThrow(resultObject, "async", false).
+        MUST(result_object->create_data_property_or_throw(vm.names.async_, Value(false)));
+
+        // d. Perform ! CreateDataPropertyOrThrow(resultObject, "value", "timed-out").
+        MUST(result_object->create_data_property_or_throw(vm.names.value, PrimitiveString::create(vm, "timed-out"_string)));
+
+        // e. Return resultObject.
+        return result_object;
+    }
+
+    // 22. Let thisAgent be AgentSignifier().
+    // 23. Let now be the time value (UTC) identifying the current time.
+    // 24. Let additionalTimeout be an implementation-defined non-negative mathematical value.
+    // 25. Let timeoutTime be ℝ(now) + t + additionalTimeout.
+    // 26. NOTE: When t is +∞, timeoutTime is also +∞.
+    // 27. Let waiterRecord be a new Waiter Record { [[AgentSignifier]]: thisAgent, [[PromiseCapability]]: promiseCapability, [[TimeoutTime]]: timeoutTime, [[Result]]: "ok" }.
+    auto waiter = adopt_ref(*new Waiter(waiter_list_critical_section()));
+    waiter->agent = &vm;
+    if (promise_capability) {
+        waiter->promise_capability = make_handle(promise_capability);
+    }
+    if (!isinf(timeout))
+        waiter->timeout_time = UnixDateTime::now() + Duration::from_nanoseconds(static_cast<i64>(timeout * 1'000'000));
+
+    // 28. Perform AddWaiter(WL, waiterRecord).
+    add_waiter(waiter_list, waiter);
+
+    // 29. If mode is sync, then
+    if (mode == WaitMode::Sync) {
+        // a. Perform SuspendThisAgent(WL, waiterRecord).
+        suspend_this_agent(vm, waiter_list, *waiter);
+    }
+    // 30. Else if timeoutTime is finite, then
+    else if (waiter->timeout_time.has_value()) {
+        // a. Perform EnqueueAtomicsWaitAsyncTimeoutJob(WL, waiterRecord).
+        enqueue_atomics_wait_async_timeout_job(vm, *buffer, waiter_list, waiter);
+    }
+
+    // 31. Perform LeaveCriticalSection(WL).
+    locker.unlock();
+
+    // 32. If mode is sync, return waiterRecord.[[Result]].
+    if (mode == WaitMode::Sync)
+        return PrimitiveString::create(vm, waiter->result);
+
+    // 33. Perform ! CreateDataPropertyOrThrow(resultObject, "async", true).
+    MUST(result_object->create_data_property_or_throw(vm.names.async_, Value(true)));
+
+    // 34. Perform ! CreateDataPropertyOrThrow(resultObject, "value", promiseCapability.[[Promise]]).
+    MUST(result_object->create_data_property_or_throw(vm.names.value, promise_capability->promise()));
+
+    // 35. Return resultObject.
+    return result_object;
 }
 
 template<typename T, typename AtomicFunction>
@@ -538,18 +898,33 @@ JS_DEFINE_NATIVE_FUNCTION(AtomicsObject::notify)
     auto* buffer = typed_array->viewed_array_buffer();
 
     // 5. Let block be buffer.[[ArrayBufferData]].
-    auto& block = buffer->buffer();
+    // NOTE: WaiterLists are keyed by buffer, see WaiterListKey.
 
     // 6. If IsSharedArrayBuffer(buffer) is false, return +0𝔽.
     if (!buffer->is_shared_array_buffer())
         return Value { 0 };
 
-    // FIXME: Implement the remaining steps when we support SharedArrayBuffer.
-    (void)byte_index_in_buffer;
-    (void)count;
-    (void)block;
+    // 7. Let WL be GetWaiterList(block, byteIndexInBuffer).
+    WaiterListKey waiter_list { buffer, byte_index_in_buffer };
+
+    // 8. Perform EnterCriticalSection(WL).
+    Threading::MutexLocker locker { waiter_list_critical_section() };
+
+    // 9. Let S be RemoveWaiters(WL, c).
+    auto waiters = remove_waiters(waiter_list, count);
+
+    // 10. For each element W of S, do
+    for (auto& waiter : waiters) {
+        // a. Perform NotifyWaiter(WL, W).
+        notify_waiter(vm, *waiter);
+    }
+
+    // 11. Perform LeaveCriticalSection(WL).
+    locker.unlock();
 
-    return vm.throw_completion<InternalError>(ErrorType::NotImplemented, "SharedArrayBuffer"sv);
+    // 12. Let n be the number of elements in S.
+    // 13. Return 𝔽(n).
+    return Value { waiters.size() };
 }
 
 // 25.4.16 Atomics.xor ( typedArray, index, value ), https://tc39.es/ecma262/#sec-atomics.xor
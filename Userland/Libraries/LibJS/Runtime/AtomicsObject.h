@@ -36,4 +36,7 @@ private:
     JS_DECLARE_NATIVE_FUNCTION(xor_);
 };
 
+void remove_waiter_lists_of_buffer(ArrayBuffer const&);
+void remove_waiters_of_agent(VM const&);
+
 }
@@ -415,6 +415,8 @@ namespace JS {
     P(pop)                                   \
     P(pow)                                   \
     P(preventExtensions)                     \
+    P(profile)                               \
+    P(profileEnd)                            \
     P(promise)                               \
     P(propertyIsEnumerable)                  \
     P(prototype)                             \
@@ -607,6 +609,7 @@ namespace JS {
 
 struct CommonPropertyNames {
     PropertyKey and_ { "and", PropertyKey::StringMayBeNumber::No };
+    PropertyKey async_ { "async", PropertyKey::StringMayBeNumber::No };
     PropertyKey catch_ { "catch", PropertyKey::StringMayBeNumber::No };
     PropertyKey delete_ { "delete", PropertyKey::StringMayBeNumber::No };
     PropertyKey for_ { "for", PropertyKey::StringMayBeNumber::No };
@@ -50,6 +50,8 @@ void ConsoleObject::initialize(Realm& realm)
     define_native_function(realm, vm.names.time, time, 0, attr);
     define_native_function(realm, vm.names.timeLog, time_log, 0, attr);
     define_native_function(realm, vm.names.timeEnd, time_end, 0, attr);
+    define_native_function(realm, vm.names.profile, profile, 0, attr);
+    define_native_function(realm, vm.names.profileEnd, profile_end, 0, attr);
 }
 
 // 1.1.1. assert(condition, ...data), https://console.spec.whatwg.org/#assert
@@ -171,4 +173,18 @@ JS_DEFINE_NATIVE_FUNCTION(ConsoleObject::time_end)
     return console_object.console().time_end();
 }
 
+// Non-standard: profile(label), https://developer.mozilla.org/en-US/docs/Web/API/console/profile_static
+JS_DEFINE_NATIVE_FUNCTION(ConsoleObject::profile)
+{
+    auto& console_object = *vm.current_realm()->intrinsics().console_object();
+    return console_object.console().profile();
+}
+
+// Non-standard: profileEnd(label), https://developer.mozilla.org/en-US/docs/Web/API/console/profileEnd_static
+JS_DEFINE_NATIVE_FUNCTION(ConsoleObject::profile_end)
+{
+    auto& console_object = *vm.current_realm()->intrinsics().console_object();
+    return console_object.console().profile_end();
+}
+
 }
@@ -9,6 +9,7 @@
 
 #include <AK/Debug.h>
 #include <AK/Function.h>
+#include <AK/ScopeGuard.h>
 #include <LibJS/AST.h>
 #include <LibJS/Bytecode/BasicBlock.h>
 #include <LibJS/Bytecode/Generator.h>
@@ -102,6 +103,18 @@ ECMAScriptFunctionObject::ECMAScriptFunctionObject(DeprecatedFlyString name, Byt
         return true;
     });
 
+    m_uses_this = parsing_insights.uses_this;
+    m_uses_this_from_environment = parsing_insights.uses_this_from_environment;
+}
+
+// OPTIMIZATION: Most functions created while loading a page are never called, so we defer this
+//               until the first call instead of paying for it every time a function object is created.
+void ECMAScriptFunctionObject::prepare_function_declaration_instantiation()
+{
+    if (m_has_prepared_function_declaration_instantiation)
+        return;
+    m_has_prepared_function_declaration_instantiation = true;
+
     // NOTE: The following steps are from FunctionDeclarationInstantiation that could be executed once
     //       and then reused in all subsequent function instantiations.
 
@@ -331,8 +344,7 @@ ECMAScriptFunctionObject::ECMAScriptFunctionObject(DeprecatedFlyString name, Byt
         }));
     }
 
-    m_function_environment_needed = arguments_object_needs_binding || m_function_environment_bindings_count > 0 || m_var_environment_bindings_count > 0 || m_lex_environment_bindings_count > 0 || parsing_insights.uses_this_from_environment || m_contains_direct_call_to_eval;
-    m_uses_this = parsing_insights.uses_this;
+    m_function_environment_needed = arguments_object_needs_binding || m_function_environment_bindings_count > 0 || m_var_environment_bindings_count > 0 || m_lex_environment_bindings_count > 0 || m_uses_this_from_environment || m_contains_direct_call_to_eval;
 }
 
 void ECMAScriptFunctionObject::initialize(Realm& realm)
@@ -574,6 +586,8 @@ ThrowCompletionOr<void> ECMAScriptFunctionObject::prepare_for_ordinary_call(Exec
 {
     auto& vm = this->vm();
 
+    prepare_function_declaration_instantiation();
+
     // Non-standard
     callee_context.is_strict_mode = m_strict;
 
@@ -834,9 +848,19 @@ Completion ECMAScriptFunctionObject::ordinary_call_evaluate_body()
         m_bytecode_executable = m_ecmascript_code->bytecode_executable();
     }
 
-    vm.running_execution_context().registers_and_constants_and_locals.resize(m_local_variables_names.size() + m_bytecode_executable->number_of_registers + m_bytecode_executable->constants.size());
-
-    auto result_and_frame = vm.bytecode_interpreter().run_executable(*m_bytecode_executable, {});
+    // NOTE: The callee context was created by [[Call]] or [[Construct]] for this call alone, so its registers can live on
+    //       the register stack. Generator and async function objects make a copy of the context to keep.
+    auto& interpreter = vm.bytecode_interpreter();
+    auto& callee_context = vm.running_execution_context();
+    VERIFY(callee_context.registers_and_constants_and_locals.is_empty());
+    auto register_window = interpreter.allocate_register_window(m_local_variables_names.size() + m_bytecode_executable->number_of_registers + m_bytecode_executable->constants.size());
+    callee_context.registers_and_constants_and_locals = register_window;
+    ScopeGuard deallocate_register_window = [&] {
+        callee_context.registers_and_constants_and_locals = {};
+        interpreter.deallocate_register_window(register_window);
+    };
+
+    auto result_and_frame = interpreter.run_executable(*m_bytecode_executable, {});
 
     if (result_and_frame.value.is_error())
         return result_and_frame.value.release_error();
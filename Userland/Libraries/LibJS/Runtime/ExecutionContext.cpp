@@ -67,13 +67,26 @@ NonnullOwnPtr<ExecutionContext> ExecutionContext::copy() const
     copy->executable = executable;
     copy->arguments = arguments;
     copy->passed_argument_count = passed_argument_count;
-    copy->registers_and_constants_and_locals = registers_and_constants_and_locals;
+    // The copy may outlive the call it was made from, so it can't share a window of the register stack.
+    copy->m_owned_registers_and_constants_and_locals.append(registers_and_constants_and_locals.data(), registers_and_constants_and_locals.size());
+    copy->registers_and_constants_and_locals = copy->m_owned_registers_and_constants_and_locals.span();
     copy->unwind_contexts = unwind_contexts;
     copy->saved_lexical_environments = saved_lexical_environments;
     copy->previously_scheduled_jumps = previously_scheduled_jumps;
     return copy;
 }
 
+void ExecutionContext::grow_registers_and_constants_and_locals(size_t count)
+{
+    if (registers_and_constants_and_locals.data() != m_owned_registers_and_constants_and_locals.data()) {
+        m_owned_registers_and_constants_and_locals.clear();
+        m_owned_registers_and_constants_and_locals.ensure_capacity(count);
+        m_owned_registers_and_constants_and_locals.append(registers_and_constants_and_locals.data(), registers_and_constants_and_locals.size());
+    }
+    m_owned_registers_and_constants_and_locals.resize(count);
+    registers_and_constants_and_locals = m_owned_registers_and_constants_and_locals.span();
+}
+
 void ExecutionContext::visit_edges(Cell::Visitor& visitor)
 {
     visitor.visit(function);
@@ -70,14 +70,32 @@ public:
         return registers_and_constants_and_locals[index];
     }
 
+    // Makes room for at least the given number of registers, constants and locals, keeping the current ones.
+    // Any storage this needs is owned by the context itself.
+    void ensure_registers_and_constants_and_locals(size_t count)
+    {
+        if (registers_and_constants_and_locals.size() < count) [[unlikely]]
+            grow_registers_and_constants_and_locals(count);
+    }
+
     u32 passed_argument_count { 0 };
     bool is_strict_mode { false };
 
-    Vector<Value> arguments;
-    Vector<Value> registers_and_constants_and_locals;
+    // Most calls pass only a few arguments, which then fit in the context itself instead of a separate allocation.
+    static constexpr size_t inline_argument_capacity = 8;
+    Vector<Value, inline_argument_capacity> arguments;
+
+    // Either a window of the interpreter's register stack, for a call that is running, or owned storage.
+    Span<Value> registers_and_constants_and_locals;
+
     Vector<Bytecode::UnwindInfo> unwind_contexts;
     Vector<Optional<size_t>> previously_scheduled_jumps;
     Vector<GCPtr<Environment>> saved_lexical_environments;
+
+private:
+    void grow_registers_and_constants_and_locals(size_t count);
+
+    Vector<Value> m_owned_registers_and_constants_and_locals;
 };
 
 struct StackTraceElement {
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/StringBuilder.h>
+#include <LibJS/Runtime/Date.h>
+#include <LibJS/Runtime/Intl/FormatterCache.h>
+#include <LibJS/Runtime/Object.h>
+#include <LibJS/Runtime/PrimitiveString.h>
+#include <LibUnicode/Locale.h>
+
+namespace JS::Intl {
+
+Optional<String> FormatterCache::cache_key(Type type, Value locales, Value options)
+{
+    if (!options.is_undefined())
+        return {};
+    if (!locales.is_undefined() && !locales.is_string())
+        return {};
+
+    // An undefined locale list resolves to the default locale, and date-time formats default to the system time zone,
+    // both of which may change while the formatter is cached.
+    StringBuilder builder;
+    builder.append(locales.is_string() ? locales.as_string().utf8_string_view() : StringView {});
+    builder.append('\0');
+    builder.append(Unicode::default_locale());
+
+    if (type == Type::DateTimeFormatAny || type == Type::DateTimeFormatDate || type == Type::DateTimeFormatTime) {
+        builder.append('\0');
+        builder.append(system_time_zone_identifier());
+    }
+
+    return MUST(builder.to_string());
+}
+
+GCPtr<Object> FormatterCache::find(Type type, String const& key)
+{
+    for (size_t i = 0; i < m_entries.size(); ++i) {
+        if (m_entries[i].type != type || m_entries[i].key != key)
+            continue;
+
+        auto object = m_entries[i].object;
+        if (i != 0)
+            m_entries.prepend(m_entries.take(i));
+        return object;
+    }
+
+    return nullptr;
+}
+
+void FormatterCache::insert(Type type, String key, NonnullGCPtr<Object> object)
+{
+    if (m_entries.size() == capacity)
+        m_entries.take_last();
+    m_entries.prepend({ type, move(key), object });
+}
+
+void FormatterCache::visit_edges(Cell::Visitor& visitor)
+{
+    for (auto& entry : m_entries)
+        visitor.visit(entry.object);
+}
+
+}
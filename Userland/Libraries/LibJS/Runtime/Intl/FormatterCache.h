@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/String.h>
+#include <AK/Vector.h>
+#include <LibJS/Forward.h>
+#include <LibJS/Heap/Cell.h>
+#include <LibJS/Heap/GCPtr.h>
+#include <LibJS/Runtime/Completion.h>
+#include <LibJS/Runtime/Value.h>
+
+namespace JS::Intl {
+
+// Non-standard. Locale-sensitive methods such as Number.prototype.toLocaleString and String.prototype.localeCompare
+// create a new Intl object on every call, which means resolving the locale and creating an ICU formatter each time.
+// Calls that do not pass an options object (reading one may have side effects) and whose locales are undefined or a
+// single string always produce the same Intl object, so the most recently used ones are kept here and reused.
+class FormatterCache {
+public:
+    enum class Type : u8 {
+        Collator,
+        NumberFormat,
+        DateTimeFormatAny,
+        DateTimeFormatDate,
+        DateTimeFormatTime,
+    };
+
+    static constexpr size_t capacity = 16;
+
+    template<typename ObjectType, typename Callback>
+    ThrowCompletionOr<NonnullGCPtr<ObjectType>> get_or_create(Type type, Value locales, Value options, Callback&& create)
+    {
+        auto key = cache_key(type, locales, options);
+        if (!key.has_value())
+            return static_cast<ObjectType&>(*TRY(create()));
+
+        if (auto object = find(type, *key))
+            return static_cast<ObjectType&>(*object);
+
+        NonnullGCPtr<Object> object = TRY(create());
+        insert(type, key.release_value(), object);
+        return static_cast<ObjectType&>(*object);
+    }
+
+    void visit_edges(Cell::Visitor&);
+
+private:
+    struct Entry {
+        Type type;
+        String key;
+        NonnullGCPtr<Object> object;
+    };
+
+    static Optional<String> cache_key(Type, Value locales, Value options);
+
+    GCPtr<Object> find(Type, String const& key);
+    void insert(Type, String key, NonnullGCPtr<Object>);
+
+    // Ordered from the most to the least recently used.
+    Vector<Entry, capacity> m_entries;
+};
+
+}
@@ -202,12 +202,6 @@ ThrowCompletionOr<void> Intrinsics::initialize_intrinsics(Realm& realm)
     m_function_prototype->initialize(realm);
     m_object_prototype->initialize(realm);
 
-#define __JS_ENUMERATE(ClassName, snake_name) \
-    VERIFY(!m_##snake_name##_prototype);      \
-    m_##snake_name##_prototype = heap().allocate<ClassName##Prototype>(realm, realm);
-    JS_ENUMERATE_ITERATOR_PROTOTYPES
-#undef __JS_ENUMERATE
-
     // These must be initialized separately as they have no companion constructor
     m_async_from_sync_iterator_prototype = heap().allocate<AsyncFromSyncIteratorPrototype>(realm, realm);
     m_async_generator_prototype = heap().allocate<AsyncGeneratorPrototype>(realm, realm);
@@ -266,10 +260,8 @@ ThrowCompletionOr<void> Intrinsics::initialize_intrinsics(Realm& realm)
     // 27.6.1.1 AsyncGenerator.prototype.constructor, https://tc39.es/ecma262/#sec-asyncgenerator-prototype-constructor
     m_async_generator_prototype->define_direct_property(vm.names.constructor, m_async_generator_function_prototype, Attribute::Configurable);
 
-    m_array_prototype_values_function = &array_prototype()->get_without_side_effects(vm.names.values).as_function();
-    m_date_constructor_now_function = &date_constructor()->get_without_side_effects(vm.names.now).as_function();
-    m_json_parse_function = &json_object()->get_without_side_effects(vm.names.parse).as_function();
-    m_json_stringify_function = &json_object()->get_without_side_effects(vm.names.stringify).as_function();
+    // NOTE: The original functions of Array.prototype, Date and JSON are remembered when those objects are created on
+    //       first use, as creating every intrinsic up front makes setting up a realm much more expensive.
     m_object_prototype_to_string_function = &object_prototype()->get_without_side_effects(vm.names.toString).as_function();
 
     return {};
@@ -316,6 +308,12 @@ JS_ENUMERATE_TYPED_ARRAYS
             initialize_constructor(vm, vm.names.Symbol, *m_##snake_namespace##snake_name##_constructor, m_##snake_namespace##snake_name##_prototype);    \
         else                                                                                                                                             \
             initialize_constructor(vm, vm.names.ClassName, *m_##snake_namespace##snake_name##_constructor, m_##snake_namespace##snake_name##_prototype); \
+                                                                                                                                                         \
+        /* Remember the original functions that are intrinsics of their own, before anything can replace them. */                                       \
+        if constexpr (IsSame<Namespace::ConstructorName, ArrayConstructor>)                                                                              \
+            m_array_prototype_values_function = &m_##snake_namespace##snake_name##_prototype->get_without_side_effects(vm.names.values).as_function();   \
+        else if constexpr (IsSame<Namespace::ConstructorName, DateConstructor>)                                                                          \
+            m_date_constructor_now_function = &m_##snake_namespace##snake_name##_constructor->get_without_side_effects(vm.names.now).as_function();      \
     }                                                                                                                                                    \
                                                                                                                                                          \
     NonnullGCPtr<Namespace::ConstructorName> Intrinsics::snake_namespace##snake_name##_constructor()                                                     \
@@ -349,16 +347,61 @@ JS_ENUMERATE_TEMPORAL_OBJECTS
 
 #undef __JS_ENUMERATE_INNER
 
-#define __JS_ENUMERATE(ClassName, snake_name)                                       \
-    NonnullGCPtr<ClassName> Intrinsics::snake_name##_object()                       \
-    {                                                                               \
-        if (!m_##snake_name##_object)                                               \
-            m_##snake_name##_object = heap().allocate<ClassName>(m_realm, m_realm); \
-        return *m_##snake_name##_object;                                            \
+#define __JS_ENUMERATE(ClassName, snake_name)                                                                                       \
+    NonnullGCPtr<ClassName> Intrinsics::snake_name##_object()                                                                       \
+    {                                                                                                                               \
+        if (!m_##snake_name##_object) {                                                                                             \
+            m_##snake_name##_object = heap().allocate<ClassName>(m_realm, m_realm);                                                 \
+                                                                                                                                    \
+            /* Remember the original functions that are intrinsics of their own, before anything can replace them. */               \
+            if constexpr (IsSame<ClassName, JSONObject>) {                                                                          \
+                m_json_parse_function = &m_##snake_name##_object->get_without_side_effects(vm().names.parse).as_function();         \
+                m_json_stringify_function = &m_##snake_name##_object->get_without_side_effects(vm().names.stringify).as_function(); \
+            }                                                                                                                       \
+        }                                                                                                                           \
+        return *m_##snake_name##_object;                                                                                            \
     }
 JS_ENUMERATE_BUILTIN_NAMESPACE_OBJECTS
 #undef __JS_ENUMERATE
 
+#define __JS_ENUMERATE(ClassName, snake_name)                                                     \
+    NonnullGCPtr<Object> Intrinsics::snake_name##_prototype()                                     \
+    {                                                                                             \
+        if (!m_##snake_name##_prototype)                                                          \
+            m_##snake_name##_prototype = heap().allocate<ClassName##Prototype>(m_realm, m_realm); \
+        return *m_##snake_name##_prototype;                                                       \
+    }
+JS_ENUMERATE_ITERATOR_PROTOTYPES
+#undef __JS_ENUMERATE
+
+NonnullGCPtr<FunctionObject> Intrinsics::array_prototype_values_function()
+{
+    // Creating the prototype remembers the function.
+    (void)array_prototype();
+    return *m_array_prototype_values_function;
+}
+
+NonnullGCPtr<FunctionObject> Intrinsics::date_constructor_now_function()
+{
+    // Creating the constructor remembers the function.
+    (void)date_constructor();
+    return *m_date_constructor_now_function;
+}
+
+NonnullGCPtr<FunctionObject> Intrinsics::json_parse_function()
+{
+    // Creating the namespace object remembers the function.
+    (void)json_object();
+    return *m_json_parse_function;
+}
+
+NonnullGCPtr<FunctionObject> Intrinsics::json_stringify_function()
+{
+    // Creating the namespace object remembers the function.
+    (void)json_object();
+    return *m_json_stringify_function;
+}
+
 void Intrinsics::visit_edges(Visitor& visitor)
 {
     Base::visit_edges(visitor);
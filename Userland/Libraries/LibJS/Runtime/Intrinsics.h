@@ -57,10 +57,10 @@ public:
     NonnullGCPtr<FunctionObject> unescape_function() const { return *m_unescape_function; }
 
     // Namespace/constructor object functions
-    NonnullGCPtr<FunctionObject> array_prototype_values_function() const { return *m_array_prototype_values_function; }
-    NonnullGCPtr<FunctionObject> date_constructor_now_function() const { return *m_date_constructor_now_function; }
-    NonnullGCPtr<FunctionObject> json_parse_function() const { return *m_json_parse_function; }
-    NonnullGCPtr<FunctionObject> json_stringify_function() const { return *m_json_stringify_function; }
+    NonnullGCPtr<FunctionObject> array_prototype_values_function();
+    NonnullGCPtr<FunctionObject> date_constructor_now_function();
+    NonnullGCPtr<FunctionObject> json_parse_function();
+    NonnullGCPtr<FunctionObject> json_stringify_function();
     NonnullGCPtr<FunctionObject> object_prototype_to_string_function() const { return *m_object_prototype_to_string_function; }
     NonnullGCPtr<FunctionObject> throw_type_error_function() const { return *m_throw_type_error_function; }
 
@@ -87,11 +87,8 @@ public:
     JS_ENUMERATE_BUILTIN_NAMESPACE_OBJECTS
 #undef __JS_ENUMERATE
 
-#define __JS_ENUMERATE(ClassName, snake_name)     \
-    NonnullGCPtr<Object> snake_name##_prototype() \
-    {                                             \
-        return *m_##snake_name##_prototype;       \
-    }
+#define __JS_ENUMERATE(ClassName, snake_name) \
+    NonnullGCPtr<Object> snake_name##_prototype();
     JS_ENUMERATE_ITERATOR_PROTOTYPES
 #undef __JS_ENUMERATE
 
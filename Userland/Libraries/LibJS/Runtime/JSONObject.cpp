@@ -4,10 +4,12 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/CharacterTypes.h>
+#include <AK/FloatingPointStringConversions.h>
 #include <AK/Function.h>
+#include <AK/GenericLexer.h>
 #include <AK/JsonArray.h>
 #include <AK/JsonObject.h>
-#include <AK/JsonParser.h>
 #include <AK/StringBuilder.h>
 #include <AK/TypeCasts.h>
 #include <AK/Utf16View.h>
@@ -405,6 +407,251 @@ ByteString JSONObject::quote_json_string(ByteString string)
     return builder.to_byte_string();
 }
 
+// OPTIMIZATION: This builds JS values straight from the JSON text, rather than parsing it into an AK::JsonValue tree
+//               first and converting that, which allocated every object, array and string of the payload twice.
+//               The accepted grammar is the same as AK::JsonParser's, which is ECMA-404.
+class JSONParser : private GenericLexer {
+public:
+    JSONParser(VM& vm, StringView input)
+        : GenericLexer(input)
+        , m_vm(vm)
+        , m_realm(*vm.current_realm())
+    {
+    }
+
+    ThrowCompletionOr<Value> parse()
+    {
+        auto result = TRY(parse_value());
+        ignore_while(is_json_whitespace);
+        if (!is_eof())
+            return malformed();
+        return result;
+    }
+
+private:
+    static constexpr bool is_json_whitespace(char ch)
+    {
+        return ch == '\t' || ch == '\n' || ch == '\r' || ch == ' ';
+    }
+
+    Completion malformed() const
+    {
+        return m_vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
+    }
+
+    ThrowCompletionOr<Value> parse_value()
+    {
+        ignore_while(is_json_whitespace);
+        switch (peek()) {
+        case '{':
+            return parse_object();
+        case '[':
+            return parse_array();
+        case '"':
+            return Value(PrimitiveString::create(m_vm, TRY(parse_string())));
+        case '-':
+        case '0':
+        case '1':
+        case '2':
+        case '3':
+        case '4':
+        case '5':
+        case '6':
+        case '7':
+        case '8':
+        case '9':
+            return parse_number();
+        case 'f':
+            if (consume_specific("false"sv))
+                return Value(false);
+            break;
+        case 't':
+            if (consume_specific("true"sv))
+                return Value(true);
+            break;
+        case 'n':
+            if (consume_specific("null"sv))
+                return js_null();
+            break;
+        }
+        return malformed();
+    }
+
+    ThrowCompletionOr<Value> parse_object()
+    {
+        auto object = Object::create(m_realm, m_realm.intrinsics().object_prototype());
+        ignore(); // '{'
+        for (;;) {
+            ignore_while(is_json_whitespace);
+            if (peek() == '}')
+                break;
+            auto name = TRY(parse_string());
+            ignore_while(is_json_whitespace);
+            if (!consume_specific(':'))
+                return malformed();
+            auto value = TRY(parse_value());
+            object->define_direct_property(name, value, default_attributes);
+            ignore_while(is_json_whitespace);
+            if (peek() == '}')
+                break;
+            if (!consume_specific(','))
+                return malformed();
+            ignore_while(is_json_whitespace);
+            if (peek() == '}')
+                return malformed();
+        }
+        ignore(); // '}'
+        return Value(object);
+    }
+
+    ThrowCompletionOr<Value> parse_array()
+    {
+        auto array = MUST(Array::create(m_realm, 0));
+        ignore(); // '['
+        size_t index = 0;
+        for (;;) {
+            ignore_while(is_json_whitespace);
+            if (peek() == ']')
+                break;
+            auto element = TRY(parse_value());
+            array->define_direct_property(index++, element, default_attributes);
+            ignore_while(is_json_whitespace);
+            if (peek() == ']')
+                break;
+            if (!consume_specific(','))
+                return malformed();
+            ignore_while(is_json_whitespace);
+            if (peek() == ']')
+                return malformed();
+        }
+        ignore(); // ']'
+        return Value(array);
+    }
+
+    ThrowCompletionOr<ByteString> parse_string()
+    {
+        if (!consume_specific('"'))
+            return malformed();
+
+        // NOTE: Most strings contain no escapes, so they can be taken from the input as is.
+        StringBuilder builder;
+        for (;;) {
+            size_t literal_characters = 0;
+            for (;;) {
+                char ch = peek(literal_characters);
+                // NOTE: We get a 0 byte when we hit EOF.
+                if (ch == 0 || is_ascii_c0_control(ch))
+                    return malformed();
+                if (ch == '"' || ch == '\\')
+                    break;
+                ++literal_characters;
+            }
+            auto literal = consume(literal_characters);
+
+            if (peek() == '"') {
+                ignore();
+                if (builder.is_empty())
+                    return ByteString(literal);
+                builder.append(literal);
+                break;
+            }
+            builder.append(literal);
+
+            ignore(); // '\'
+            switch (peek()) {
+            case '"':
+            case '\\':
+            case '/':
+                builder.append(consume());
+                break;
+            case 'b':
+                ignore();
+                builder.append('\b');
+                break;
+            case 'f':
+                ignore();
+                builder.append('\f');
+                break;
+            case 'n':
+                ignore();
+                builder.append('\n');
+                break;
+            case 'r':
+                ignore();
+                builder.append('\r');
+                break;
+            case 't':
+                ignore();
+                builder.append('\t');
+                break;
+            case 'u': {
+                ignore(); // 'u'
+                if (tell_remaining() < 4)
+                    return malformed();
+                auto code_point = AK::StringUtils::convert_to_uint_from_hex(consume(4));
+                if (!code_point.has_value())
+                    return malformed();
+                builder.append_code_point(code_point.value());
+                break;
+            }
+            default:
+                return malformed();
+            }
+        }
+        return builder.to_byte_string();
+    }
+
+    ThrowCompletionOr<Value> parse_number()
+    {
+        auto start_index = tell();
+
+        bool negative = consume_specific('-');
+        if (!is_ascii_digit(peek()))
+            return malformed();
+        if (consume_specific('0')) {
+            // Leading zeros are not allowed.
+            if (is_ascii_digit(peek()))
+                return malformed();
+        } else {
+            ignore_while(is_ascii_digit);
+        }
+
+        bool is_integer = true;
+        if (consume_specific('.')) {
+            if (!is_ascii_digit(peek()))
+                return malformed();
+            ignore_while(is_ascii_digit);
+            is_integer = false;
+        }
+        if (peek() == 'e' || peek() == 'E') {
+            ignore();
+            if (peek() == '+' || peek() == '-')
+                ignore();
+            if (!is_ascii_digit(peek()))
+                return malformed();
+            ignore_while(is_ascii_digit);
+            is_integer = false;
+        }
+
+        auto number_string = m_input.substring_view(start_index, tell() - start_index);
+
+        // OPTIMIZATION: Most numbers in JSON payloads are small integers, which we can keep as such.
+        if (is_integer) {
+            if (auto value = number_string.to_number<i32>(); value.has_value() && !(negative && value.value() == 0))
+                return Value(value.value());
+        }
+
+        auto const* start = number_string.characters_without_null_termination();
+        auto parse_result = parse_first_floating_point(start, start + number_string.length());
+        if (!parse_result.parsed_value())
+            return malformed();
+        return Value(parse_result.value);
+    }
+
+    VM& m_vm;
+    Realm& m_realm;
+};
+
 // 25.5.1 JSON.parse ( text [ , reviver ] ), https://tc39.es/ecma262/#sec-json.parse
 JS_DEFINE_NATIVE_FUNCTION(JSONObject::parse)
 {
@@ -413,10 +660,7 @@ JS_DEFINE_NATIVE_FUNCTION(JSONObject::parse)
     auto string = TRY(vm.argument(0).to_byte_string(vm));
     auto reviver = vm.argument(1);
 
-    auto json = JsonValue::from_string(string);
-    if (json.is_error())
-        return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
-    Value unfiltered = parse_json_value(vm, json.value());
+    Value unfiltered = TRY(JSONParser(vm, string).parse());
     if (reviver.is_function()) {
         auto root = Object::create(realm, realm.intrinsics().object_prototype());
         auto root_name = ByteString::empty();
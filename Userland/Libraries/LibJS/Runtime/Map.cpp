@@ -20,74 +20,165 @@ Map::Map(Object& prototype)
 {
 }
 
+u32 Map::hash_key(Value key)
+{
+    return ValueTraits::hash(key);
+}
+
+Optional<u32> Map::find_position(Value const& key, u32 hash) const
+{
+    if (m_buckets.is_empty())
+        return {};
+
+    for (auto position = m_buckets[hash & (m_buckets.size() - 1)]; position != invalid_position; position = m_slots[position].next_in_bucket) {
+        auto const& slot = m_slots[position];
+        if (slot.hash == hash && ValueTraits::equals(slot.entry.key, key))
+            return position;
+    }
+    return {};
+}
+
+size_t Map::first_position_not_below(size_t insertion_id) const
+{
+    size_t low = 0;
+    size_t high = m_slots.size();
+    while (low < high) {
+        auto middle = low + (high - low) / 2;
+        if (m_slots[middle].insertion_id < insertion_id)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low;
+}
+
+void Map::rehash(size_t new_capacity)
+{
+    VERIFY(new_capacity >= m_size);
+    VERIFY(is_power_of_two(new_capacity));
+
+    Vector<Slot> slots;
+    slots.ensure_capacity(new_capacity);
+    for (auto& slot : m_slots) {
+        if (!slot.is_removed())
+            slots.unchecked_append(slot);
+    }
+    if (slots.size() != m_slots.size())
+        ++m_compaction_count;
+    m_slots = move(slots);
+
+    m_buckets.resize(new_capacity / 2);
+    for (auto& bucket : m_buckets)
+        bucket = invalid_position;
+
+    auto bucket_mask = m_buckets.size() - 1;
+    for (u32 position = 0; position < m_slots.size(); ++position) {
+        auto& bucket = m_buckets[m_slots[position].hash & bucket_mask];
+        m_slots[position].next_in_bucket = bucket;
+        bucket = position;
+    }
+}
+
 // 24.1.3.1 Map.prototype.clear ( ), https://tc39.es/ecma262/#sec-map.prototype.clear
 void Map::map_clear()
 {
-    m_keys.clear();
-    m_entries.clear();
+    if (m_slots.is_empty())
+        return;
+
+    m_slots.clear();
+    m_buckets.clear();
+    m_size = 0;
+
+    // Iterators continue with the entries that are added after clearing.
+    ++m_compaction_count;
 }
 
 // 24.1.3.3 Map.prototype.delete ( key ), https://tc39.es/ecma262/#sec-map.prototype.delete
 bool Map::map_remove(Value const& key)
 {
-    Optional<size_t> index;
+    if (m_buckets.is_empty())
+        return false;
 
-    for (auto it = m_keys.begin(); !it.is_end(); ++it) {
-        if (ValueTraits::equals(*it, key)) {
-            index = it.key();
-            break;
+    auto hash = hash_key(key);
+    auto* link = &m_buckets[hash & (m_buckets.size() - 1)];
+    while (*link != invalid_position) {
+        auto& slot = m_slots[*link];
+        if (slot.hash == hash && ValueTraits::equals(slot.entry.key, key)) {
+            *link = slot.next_in_bucket;
+            slot.entry = {};
+            slot.next_in_bucket = invalid_position;
+            --m_size;
+
+            // Give the memory of mostly empty maps back.
+            auto capacity = m_buckets.size() * 2;
+            if (capacity > minimum_capacity && m_size < capacity / 4)
+                rehash(capacity / 2);
+            return true;
         }
+        link = &slot.next_in_bucket;
     }
-
-    if (!index.has_value())
-        return false;
-
-    m_keys.remove(*index);
-    m_entries.remove(key);
-    return true;
+    return false;
 }
 
 // 24.1.3.6 Map.prototype.get ( key ), https://tc39.es/ecma262/#sec-map.prototype.get
 Optional<Value> Map::map_get(Value const& key) const
 {
-    if (auto it = m_entries.find(key); it != m_entries.end())
-        return it->value;
+    if (auto position = find_position(key, hash_key(key)); position.has_value())
+        return m_slots[*position].entry.value;
     return {};
 }
 
 // 24.1.3.7 Map.prototype.has ( key ), https://tc39.es/ecma262/#sec-map.prototype.has
 bool Map::map_has(Value const& key) const
 {
-    return m_entries.contains(key);
+    return find_position(key, hash_key(key)).has_value();
 }
 
 // 24.1.3.9 Map.prototype.set ( key, value ), https://tc39.es/ecma262/#sec-map.prototype.set
 void Map::map_set(Value const& key, Value value)
 {
-    auto it = m_entries.find(key);
-    if (it != m_entries.end()) {
-        it->value = value;
-    } else {
-        auto index = m_next_insertion_id++;
-        m_keys.insert(index, key);
-        m_entries.set(key, value);
+    auto hash = hash_key(key);
+    if (auto position = find_position(key, hash); position.has_value()) {
+        m_slots[*position].entry.value = value;
+        return;
     }
+
+    auto capacity = m_buckets.size() * 2;
+    if (m_slots.size() == capacity) {
+        // Compacting is enough if at least half of the slots belong to removed entries.
+        if (capacity == 0)
+            rehash(minimum_capacity);
+        else if (m_size <= capacity / 2)
+            rehash(capacity);
+        else
+            rehash(capacity * 2);
+    }
+
+    auto& bucket = m_buckets[hash & (m_buckets.size() - 1)];
+    m_slots.unchecked_append({
+        .entry = { key, value },
+        .insertion_id = m_next_insertion_id++,
+        .hash = hash,
+        .next_in_bucket = bucket,
+    });
+    bucket = static_cast<u32>(m_slots.size() - 1);
+    ++m_size;
 }
 
 size_t Map::map_size() const
 {
-    return m_keys.size();
+    return m_size;
 }
 
 void Map::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
-    for (auto& value : m_entries) {
-        visitor.visit(value.key);
-        visitor.visit(value.value);
+    for (auto& slot : m_slots) {
+        if (slot.is_removed())
+            continue;
+        visitor.visit(slot.entry.key);
+        visitor.visit(slot.entry.value);
     }
-    // NOTE: The entries in m_keys are already visited by the walk over m_entries above.
-    visitor.ignore(m_keys);
 }
 
 }
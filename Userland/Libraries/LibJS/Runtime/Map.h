@@ -6,8 +6,9 @@
 
 #pragma once
 
-#include <AK/HashMap.h>
-#include <AK/RedBlackTree.h>
+#include <AK/NumericLimits.h>
+#include <AK/Optional.h>
+#include <AK/Vector.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/Object.h>
 #include <LibJS/Runtime/Value.h>
@@ -31,36 +32,47 @@ public:
     void map_set(Value const&, Value);
     size_t map_size() const;
 
+    struct Entry {
+        Value key;
+        Value value;
+    };
+
     struct EndIterator {
     };
 
+    // Iterators follow the spec's index-based iteration of [[MapData]]: entries that are added while iterating are
+    // visited, and removed entries are skipped. They remember the insertion id of the next entry to visit, so they
+    // stay valid when removed entries are compacted away. Advancing steps past the entry that was last looked at,
+    // even if it has been removed since, so that removing the current entry does not skip the one after it.
     template<bool IsConst>
     struct IteratorImpl {
         bool is_end() const
         {
-            return m_map->m_keys.begin_from(m_index).is_end()
-                && m_map->m_keys.find_smallest_not_below_iterator(m_index).is_end();
+            ensure_next_element();
+            return m_position >= m_map->m_slots.size();
         }
 
         IteratorImpl& operator++()
         {
-            ++m_index;
+            m_next_insertion_id = m_current_insertion_id + 1;
+            if (m_compaction_count == m_map->m_compaction_count)
+                ++m_position;
             return *this;
         }
 
         decltype(auto) operator*()
         {
             ensure_next_element();
-            return *m_map->m_entries.find(*m_map->m_keys.begin_from(m_index));
+            return entry_at(m_position);
         }
 
         decltype(auto) operator*() const
         {
             ensure_next_element();
-            return *m_map->m_entries.find(*m_map->m_keys.begin_from(m_index));
+            return entry_at(m_position);
         }
 
-        bool operator==(IteratorImpl const& other) const { return m_index == other.m_index && &m_map == &other.m_map; }
+        bool operator==(IteratorImpl const& other) const { return m_next_insertion_id == other.m_next_insertion_id && &m_map == &other.m_map; }
         bool operator==(EndIterator const&) const { return is_end(); }
 
     private:
@@ -68,35 +80,47 @@ public:
         IteratorImpl(Map const& map)
         requires(IsConst)
             : m_map(map)
+            , m_compaction_count(map.m_compaction_count)
         {
-            ensure_index();
         }
 
         IteratorImpl(Map& map)
         requires(!IsConst)
             : m_map(map)
+            , m_compaction_count(map.m_compaction_count)
         {
-            ensure_index();
         }
 
-        void ensure_index() const
+        decltype(auto) entry_at(size_t position) const
         {
-            if (m_map->m_keys.is_empty())
-                m_index = m_map->m_next_insertion_id;
+            if constexpr (IsConst)
+                return static_cast<Entry const&>(m_map->m_slots[position].entry);
             else
-                m_index = m_map->m_keys.begin().key();
+                return static_cast<Entry&>(m_map->m_slots[position].entry);
         }
 
         void ensure_next_element() const
         {
-            if (auto it = m_map->m_keys.find_smallest_not_below_iterator(m_index); it.is_end())
-                m_index = m_map->m_next_insertion_id;
-            else
-                m_index = it.key();
+            auto const& slots = m_map->m_slots;
+
+            // Compaction moves entries to lower positions, find where the next one ended up.
+            if (m_compaction_count != m_map->m_compaction_count) {
+                m_compaction_count = m_map->m_compaction_count;
+                m_position = m_map->first_position_not_below(m_next_insertion_id);
+            }
+
+            while (m_position < slots.size() && slots[m_position].is_removed())
+                ++m_position;
+
+            if (m_position < slots.size())
+                m_current_insertion_id = slots[m_position].insertion_id;
         }
 
         Conditional<IsConst, NonnullGCPtr<Map const>, NonnullGCPtr<Map>> m_map;
-        mutable size_t m_index { 0 };
+        mutable size_t m_position { 0 };
+        size_t m_next_insertion_id { 0 };
+        mutable size_t m_current_insertion_id { 0 };
+        mutable size_t m_compaction_count { 0 };
     };
 
     using Iterator = IteratorImpl<false>;
@@ -110,9 +134,31 @@ private:
     explicit Map(Object& prototype);
     virtual void visit_edges(Visitor& visitor) override;
 
+    static constexpr u32 invalid_position = NumericLimits<u32>::max();
+    static constexpr size_t minimum_capacity = 8;
+
+    // The entries are kept in a dense array in insertion order, in the style of V8's OrderedHashTable. Removed entries
+    // leave their slot behind until the array is compacted the next time it would need to grow. Lookups go through a
+    // table of buckets, each of which is the head of a chain of slots whose keys hash to it.
+    struct Slot {
+        Entry entry;
+        size_t insertion_id { 0 };
+        u32 hash { 0 };
+        u32 next_in_bucket { invalid_position };
+
+        bool is_removed() const { return entry.key.is_empty(); }
+    };
+
+    static u32 hash_key(Value);
+    Optional<u32> find_position(Value const& key, u32 hash) const;
+    size_t first_position_not_below(size_t insertion_id) const;
+    void rehash(size_t new_capacity);
+
+    Vector<Slot> m_slots;
+    Vector<u32> m_buckets;
+    size_t m_size { 0 };
     size_t m_next_insertion_id { 0 };
-    RedBlackTree<size_t, Value> m_keys;
-    HashMap<Value, Value, ValueTraits> m_entries;
+    size_t m_compaction_count { 0 };
 };
 
 }
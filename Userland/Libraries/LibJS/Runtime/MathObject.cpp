@@ -35,12 +35,12 @@ void MathObject::initialize(Realm& realm)
     define_native_function(realm, vm.names.floor, floor, 1, attr, Bytecode::Builtin::MathFloor);
     define_native_function(realm, vm.names.ceil, ceil, 1, attr, Bytecode::Builtin::MathCeil);
     define_native_function(realm, vm.names.round, round, 1, attr, Bytecode::Builtin::MathRound);
-    define_native_function(realm, vm.names.max, max, 2, attr);
-    define_native_function(realm, vm.names.min, min, 2, attr);
-    define_native_function(realm, vm.names.trunc, trunc, 1, attr);
-    define_native_function(realm, vm.names.sin, sin, 1, attr);
-    define_native_function(realm, vm.names.cos, cos, 1, attr);
-    define_native_function(realm, vm.names.tan, tan, 1, attr);
+    define_native_function(realm, vm.names.max, max, 2, attr, Bytecode::Builtin::MathMax);
+    define_native_function(realm, vm.names.min, min, 2, attr, Bytecode::Builtin::MathMin);
+    define_native_function(realm, vm.names.trunc, trunc, 1, attr, Bytecode::Builtin::MathTrunc);
+    define_native_function(realm, vm.names.sin, sin, 1, attr, Bytecode::Builtin::MathSin);
+    define_native_function(realm, vm.names.cos, cos, 1, attr, Bytecode::Builtin::MathCos);
+    define_native_function(realm, vm.names.tan, tan, 1, attr, Bytecode::Builtin::MathTan);
     define_native_function(realm, vm.names.pow, pow, 2, attr, Bytecode::Builtin::MathPow);
     define_native_function(realm, vm.names.exp, exp, 1, attr, Bytecode::Builtin::MathExp);
     define_native_function(realm, vm.names.expm1, expm1, 1, attr);
@@ -386,10 +386,10 @@ JS_DEFINE_NATIVE_FUNCTION(MathObject::clz32)
 }
 
 // 21.3.2.12 Math.cos ( x ), https://tc39.es/ecma262/#sec-math.cos
-JS_DEFINE_NATIVE_FUNCTION(MathObject::cos)
+ThrowCompletionOr<Value> MathObject::cos_impl(VM& vm, Value x)
 {
     // 1. Let n be ? ToNumber(x).
-    auto number = TRY(vm.argument(0).to_number(vm));
+    auto number = TRY(x.to_number(vm));
 
     // 2. If n is NaN, n is +∞𝔽, or n is -∞𝔽, return NaN.
     if (number.is_nan() || number.is_infinity())
@@ -403,6 +403,12 @@ JS_DEFINE_NATIVE_FUNCTION(MathObject::cos)
     return Value(::cos(number.as_double()));
 }
 
+// 21.3.2.12 Math.cos ( x ), https://tc39.es/ecma262/#sec-math.cos
+JS_DEFINE_NATIVE_FUNCTION(MathObject::cos)
+{
+    return cos_impl(vm, vm.argument(0));
+}
+
 // 21.3.2.13 Math.cosh ( x ), https://tc39.es/ecma262/#sec-math.cosh
 JS_DEFINE_NATIVE_FUNCTION(MathObject::cosh)
 {
@@ -683,15 +689,16 @@ JS_DEFINE_NATIVE_FUNCTION(MathObject::log2)
 }
 
 // 21.3.2.24 Math.max ( ...args ), https://tc39.es/ecma262/#sec-math.max
-JS_DEFINE_NATIVE_FUNCTION(MathObject::max)
+ThrowCompletionOr<Value> MathObject::max_impl(VM& vm, ReadonlySpan<Value> args)
 {
     // 1. Let coerced be a new empty List.
-    Vector<Value> coerced;
+    Vector<Value, 2> coerced;
+    coerced.ensure_capacity(args.size());
 
     // 2. For each element arg of args, do
-    for (size_t i = 0; i < vm.argument_count(); ++i) {
+    for (auto arg : args) {
         // a. Let n be ? ToNumber(arg).
-        auto number = TRY(vm.argument(i).to_number(vm));
+        auto number = TRY(arg.to_number(vm));
 
         // b. Append n to coerced.
         coerced.append(number);
@@ -716,16 +723,23 @@ JS_DEFINE_NATIVE_FUNCTION(MathObject::max)
     return highest;
 }
 
+// 21.3.2.24 Math.max ( ...args ), https://tc39.es/ecma262/#sec-math.max
+JS_DEFINE_NATIVE_FUNCTION(MathObject::max)
+{
+    return max_impl(vm, vm.running_execution_context().arguments);
+}
+
 // 21.3.2.25 Math.min ( ...args ), https://tc39.es/ecma262/#sec-math.min
-JS_DEFINE_NATIVE_FUNCTION(MathObject::min)
+ThrowCompletionOr<Value> MathObject::min_impl(VM& vm, ReadonlySpan<Value> args)
 {
     // 1. Let coerced be a new empty List.
-    Vector<Value> coerced;
+    Vector<Value, 2> coerced;
+    coerced.ensure_capacity(args.size());
 
     // 2. For each element arg of args, do
-    for (size_t i = 0; i < vm.argument_count(); ++i) {
+    for (auto arg : args) {
         // a. Let n be ? ToNumber(arg).
-        auto number = TRY(vm.argument(i).to_number(vm));
+        auto number = TRY(arg.to_number(vm));
 
         // b. Append n to coerced.
         coerced.append(number);
@@ -750,6 +764,12 @@ JS_DEFINE_NATIVE_FUNCTION(MathObject::min)
     return lowest;
 }
 
+// 21.3.2.25 Math.min ( ...args ), https://tc39.es/ecma262/#sec-math.min
+JS_DEFINE_NATIVE_FUNCTION(MathObject::min)
+{
+    return min_impl(vm, vm.running_execution_context().arguments);
+}
+
 // 21.3.2.26 Math.pow ( base, exponent ), https://tc39.es/ecma262/#sec-math.pow
 ThrowCompletionOr<Value> MathObject::pow_impl(VM& vm, Value base, Value exponent)
 {
@@ -823,10 +843,10 @@ JS_DEFINE_NATIVE_FUNCTION(MathObject::sign)
 }
 
 // 21.3.2.30 Math.sin ( x ), https://tc39.es/ecma262/#sec-math.sin
-JS_DEFINE_NATIVE_FUNCTION(MathObject::sin)
+ThrowCompletionOr<Value> MathObject::sin_impl(VM& vm, Value x)
 {
     // 1. Let n be ? ToNumber(x).
-    auto number = TRY(vm.argument(0).to_number(vm));
+    auto number = TRY(x.to_number(vm));
 
     // 2. If n is NaN, n is +0𝔽, or n is -0𝔽, return n.
     if (number.is_nan() || number.is_positive_zero() || number.is_negative_zero())
@@ -840,6 +860,12 @@ JS_DEFINE_NATIVE_FUNCTION(MathObject::sin)
     return Value(::sin(number.as_double()));
 }
 
+// 21.3.2.30 Math.sin ( x ), https://tc39.es/ecma262/#sec-math.sin
+JS_DEFINE_NATIVE_FUNCTION(MathObject::sin)
+{
+    return sin_impl(vm, vm.argument(0));
+}
+
 // 21.3.2.31 Math.sinh ( x ), https://tc39.es/ecma262/#sec-math.sinh
 JS_DEFINE_NATIVE_FUNCTION(MathObject::sinh)
 {
@@ -879,10 +905,10 @@ JS_DEFINE_NATIVE_FUNCTION(MathObject::sqrt)
 }
 
 // 21.3.2.33 Math.tan ( x ), https://tc39.es/ecma262/#sec-math.tan
-JS_DEFINE_NATIVE_FUNCTION(MathObject::tan)
+ThrowCompletionOr<Value> MathObject::tan_impl(VM& vm, Value x)
 {
     // Let n be ? ToNumber(x).
-    auto number = TRY(vm.argument(0).to_number(vm));
+    auto number = TRY(x.to_number(vm));
 
     // 2. If n is NaN, n is +0𝔽, or n is -0𝔽, return n.
     if (number.is_nan() || number.is_positive_zero() || number.is_negative_zero())
@@ -896,6 +922,12 @@ JS_DEFINE_NATIVE_FUNCTION(MathObject::tan)
     return Value(::tan(number.as_double()));
 }
 
+// 21.3.2.33 Math.tan ( x ), https://tc39.es/ecma262/#sec-math.tan
+JS_DEFINE_NATIVE_FUNCTION(MathObject::tan)
+{
+    return tan_impl(vm, vm.argument(0));
+}
+
 // 21.3.2.34 Math.tanh ( x ), https://tc39.es/ecma262/#sec-math.tanh
 JS_DEFINE_NATIVE_FUNCTION(MathObject::tanh)
 {
@@ -919,10 +951,10 @@ JS_DEFINE_NATIVE_FUNCTION(MathObject::tanh)
 }
 
 // 21.3.2.35 Math.trunc ( x ), https://tc39.es/ecma262/#sec-math.trunc
-JS_DEFINE_NATIVE_FUNCTION(MathObject::trunc)
+ThrowCompletionOr<Value> MathObject::trunc_impl(VM& vm, Value x)
 {
     // 1. Let n be ? ToNumber(x).
-    auto number = TRY(vm.argument(0).to_number(vm));
+    auto number = TRY(x.to_number(vm));
 
     // 2. If n is not finite or n is either +0𝔽 or -0𝔽, return n.
     if (number.is_nan() || number.is_infinity() || number.as_double() == 0)
@@ -936,4 +968,10 @@ JS_DEFINE_NATIVE_FUNCTION(MathObject::trunc)
             : ::floor(number.as_double()));
 }
 
+// 21.3.2.35 Math.trunc ( x ), https://tc39.es/ecma262/#sec-math.trunc
+JS_DEFINE_NATIVE_FUNCTION(MathObject::trunc)
+{
+    return trunc_impl(vm, vm.argument(0));
+}
+
 }
@@ -26,6 +26,12 @@ public:
     static ThrowCompletionOr<Value> round_impl(VM&, Value);
     static ThrowCompletionOr<Value> exp_impl(VM&, Value);
     static ThrowCompletionOr<Value> abs_impl(VM&, Value);
+    static ThrowCompletionOr<Value> trunc_impl(VM&, Value);
+    static ThrowCompletionOr<Value> sin_impl(VM&, Value);
+    static ThrowCompletionOr<Value> cos_impl(VM&, Value);
+    static ThrowCompletionOr<Value> tan_impl(VM&, Value);
+    static ThrowCompletionOr<Value> min_impl(VM&, ReadonlySpan<Value> args);
+    static ThrowCompletionOr<Value> max_impl(VM&, ReadonlySpan<Value> args);
 
 private:
     explicit MathObject(Realm&);
@@ -272,7 +272,10 @@ JS_DEFINE_NATIVE_FUNCTION(NumberPrototype::to_locale_string)
     auto number_value = TRY(this_number_value(vm, vm.this_value()));
 
     // 2. Let numberFormat be ? Construct(%NumberFormat%, « locales, options »).
-    auto* number_format = static_cast<Intl::NumberFormat*>(TRY(construct(vm, realm.intrinsics().intl_number_format_constructor(), locales, options)).ptr());
+    //    NOTE: Number formats created without options are cached, as creating one for every call is very slow.
+    auto number_format = TRY(realm.intl_formatter_cache().get_or_create<Intl::NumberFormat>(Intl::FormatterCache::Type::NumberFormat, locales, options, [&] {
+        return construct(vm, realm.intrinsics().intl_number_format_constructor(), locales, options);
+    }));
 
     // 3. Return ? FormatNumeric(numberFormat, x).
     auto formatted = Intl::format_numeric(*number_format, number_value);
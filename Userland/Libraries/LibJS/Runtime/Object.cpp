@@ -1305,6 +1305,15 @@ void Object::define_intrinsic_accessor(PropertyKey const& property_key, Property
     intrinsics.set(property_key.as_string(), move(accessor));
 }
 
+void Object::ensure_intrinsic_accessor_capacity(size_t additional_accessor_count)
+{
+    m_storage.ensure_capacity(m_storage.size() + additional_accessor_count);
+
+    m_has_intrinsic_accessors = true;
+    auto& intrinsics = s_intrinsics.ensure(this);
+    intrinsics.ensure_capacity(intrinsics.size() + additional_accessor_count);
+}
+
 // Simple side-effect free property lookup, following the prototype chain. Non-standard.
 Value Object::get_without_side_effects(PropertyKey const& property_key) const
 {
@@ -274,7 +274,14 @@ void PrimitiveString::resolve_rope_if_needed(EncodingPreference preference) cons
         // The caller wants a UTF-16 string, so we can simply concatenate all the pieces
         // into a UTF-16 code unit buffer and create a Utf16String from it.
 
+        // OPTIMIZATION: Size the buffer up front, so that flattening a long chain of
+        //               concatenations doesn't repeatedly grow and copy it.
+        size_t total_length = 0;
+        for (auto const* current : pieces)
+            total_length += current->utf16_string_view().length_in_code_units();
+
         Utf16Data code_units;
+        code_units.ensure_capacity(total_length);
         for (auto const* current : pieces)
             code_units.extend(current->utf16_string().string());
 
@@ -286,7 +293,12 @@ void PrimitiveString::resolve_rope_if_needed(EncodingPreference preference) cons
     }
 
     // Now that we have all the pieces, we can concatenate them using a StringBuilder.
-    StringBuilder builder;
+    // OPTIMIZATION: As above, size the builder up front to avoid regrowing it while appending.
+    size_t total_length = 0;
+    for (auto const* current : pieces)
+        total_length += current->utf8_string_view().length();
+
+    StringBuilder builder(total_length);
 
     // We keep track of the previous piece in order to handle surrogate pairs spread across two pieces.
     PrimitiveString const* previous = nullptr;
@@ -13,6 +13,7 @@
 #include <LibJS/Runtime/JobCallback.h>
 #include <LibJS/Runtime/Promise.h>
 #include <LibJS/Runtime/PromiseCapability.h>
+#include <LibJS/Runtime/PromiseConstructor.h>
 #include <LibJS/Runtime/PromiseJobs.h>
 #include <LibJS/Runtime/PromiseReaction.h>
 #include <LibJS/Runtime/PromiseResolvingFunction.h>
@@ -34,6 +35,15 @@ ThrowCompletionOr<Object*> promise_resolve(VM& vm, Object& constructor, Value va
             return &static_cast<Promise&>(value.as_object());
     }
 
+    // OPTIMIZATION: Resolving a promise with a value that isn't an object fulfills it without running any user code, and
+    //               so does creating a promise with the intrinsic %Promise%. Skip the capability and its resolving
+    //               functions, which are otherwise allocated for every `await` of such a value.
+    if (!value.is_object() && &constructor == vm.current_realm()->intrinsics().promise_constructor().ptr()) {
+        auto promise = Promise::create(*vm.current_realm());
+        promise->fulfill(value);
+        return promise.ptr();
+    }
+
     // 2. Let promiseCapability be ? NewPromiseCapability(C).
     auto promise_capability = TRY(new_promise_capability(vm, &constructor));
 
@@ -326,6 +336,27 @@ Value Promise::perform_then(Value on_fulfilled, Value on_rejected, GCPtr<Promise
     // 8. Let rejectReaction be the PromiseReaction { [[Capability]]: resultCapability, [[Type]]: Reject, [[Handler]]: onRejectedJobCallback }.
     auto reject_reaction = PromiseReaction::create(vm, PromiseReaction::Type::Reject, result_capability, move(on_rejected_job_callback));
 
+    // 9-12.
+    perform_then(fulfill_reaction, reject_reaction);
+
+    // 13. If resultCapability is undefined, then
+    if (result_capability == nullptr) {
+        // a. Return undefined.
+        dbgln_if(PROMISE_DEBUG, "[Promise @ {} / perform_then()]: No result PromiseCapability, returning undefined", this);
+        return js_undefined();
+    }
+
+    // 14. Else,
+    //     a. Return resultCapability.[[Promise]].
+    dbgln_if(PROMISE_DEBUG, "[Promise @ {} / perform_then()]: Returning Promise @ {} from result PromiseCapability @ {}", this, result_capability->promise().ptr(), result_capability.ptr());
+    return result_capability->promise();
+}
+
+// 27.2.5.4.1 PerformPromiseThen ( promise, onFulfilled, onRejected [ , resultCapability ] ), steps 9-12, https://tc39.es/ecma262/#sec-performpromisethen
+void Promise::perform_then(NonnullGCPtr<PromiseReaction> fulfill_reaction, NonnullGCPtr<PromiseReaction> reject_reaction)
+{
+    auto& vm = this->vm();
+
     switch (m_state) {
     // 9. If promise.[[PromiseState]] is pending, then
     case Promise::State::Pending:
@@ -377,18 +408,6 @@ Value Promise::perform_then(Value on_fulfilled, Value on_rejected, GCPtr<Promise
 
     // 12. Set promise.[[PromiseIsHandled]] to true.
     m_is_handled = true;
-
-    // 13. If resultCapability is undefined, then
-    if (result_capability == nullptr) {
-        // a. Return undefined.
-        dbgln_if(PROMISE_DEBUG, "[Promise @ {} / perform_then()]: No result PromiseCapability, returning undefined", this);
-        return js_undefined();
-    }
-
-    // 14. Else,
-    //     a. Return resultCapability.[[Promise]].
-    dbgln_if(PROMISE_DEBUG, "[Promise @ {} / perform_then()]: Returning Promise @ {} from result PromiseCapability @ {}", this, result_capability->promise().ptr(), result_capability.ptr());
-    return result_capability->promise();
 }
 
 void Promise::visit_edges(Cell::Visitor& visitor)
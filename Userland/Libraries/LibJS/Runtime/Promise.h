@@ -45,6 +45,10 @@ public:
     void reject(Value reason);
     Value perform_then(Value on_fulfilled, Value on_rejected, GCPtr<PromiseCapability> result_capability);
 
+    // Adds reactions that were created ahead of time, so that callers that wait on many promises in a row with the
+    // same handlers (like await) can reuse them. Reactions are never modified, so they can be shared between promises.
+    void perform_then(NonnullGCPtr<PromiseReaction> fulfill_reaction, NonnullGCPtr<PromiseReaction> reject_reaction);
+
     bool is_handled() const { return m_is_handled; }
     void set_is_handled() { m_is_handled = true; }
 
@@ -123,6 +123,7 @@ void Realm::visit_edges(Visitor& visitor)
     visitor.visit(m_global_environment);
     if (m_host_defined)
         m_host_defined->visit_edges(visitor);
+    m_intl_formatter_cache.visit_edges(visitor);
 }
 
 }
@@ -14,6 +14,7 @@
 #include <LibJS/Bytecode/Builtins.h>
 #include <LibJS/Heap/Cell.h>
 #include <LibJS/Heap/CellAllocator.h>
+#include <LibJS/Runtime/Intl/FormatterCache.h>
 #include <LibJS/Runtime/Intrinsics.h>
 #include <LibJS/Runtime/Value.h>
 
@@ -55,11 +56,13 @@ public:
         m_builtins[to_underlying(builtin)] = value;
     }
 
-    NonnullGCPtr<NativeFunction> get_builtin_value(Bytecode::Builtin builtin)
+    GCPtr<NativeFunction> get_builtin_value(Bytecode::Builtin builtin)
     {
-        return *m_builtins[to_underlying(builtin)];
+        return m_builtins[to_underlying(builtin)];
     }
 
+    Intl::FormatterCache& intl_formatter_cache() { return m_intl_formatter_cache; }
+
 private:
     Realm() = default;
 
@@ -70,6 +73,7 @@ private:
     GCPtr<GlobalEnvironment> m_global_environment; // [[GlobalEnv]]
     OwnPtr<HostDefined> m_host_defined;            // [[HostDefined]]
     AK::Array<GCPtr<NativeFunction>, to_underlying(Bytecode::Builtin::__Count)> m_builtins;
+    Intl::FormatterCache m_intl_formatter_cache;
 };
 
 }
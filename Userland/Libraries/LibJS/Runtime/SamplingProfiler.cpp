@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <LibJS/AST.h>
+#include <LibJS/Bytecode/Executable.h>
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Runtime/ECMAScriptFunctionObject.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
+#include <LibJS/Runtime/VM.h>
+#include <unistd.h>
+
+namespace JS {
+
+unsigned SamplingProfiler::FrameTraits::hash(Frame const& frame)
+{
+    return pair_int_hash(frame.function_name.hash(), pair_int_hash(ptr_hash(frame.source_code.ptr()), frame.source_offset));
+}
+
+SamplingProfiler::SamplingProfiler(VM& vm, AK::Duration sample_interval)
+    : m_vm(vm)
+    , m_sample_interval(sample_interval)
+{
+}
+
+SamplingProfiler::~SamplingProfiler()
+{
+    stop();
+}
+
+void SamplingProfiler::start()
+{
+    if (is_running())
+        return;
+
+    m_frames.clear();
+    m_frame_indices.clear();
+    m_nodes.clear();
+    m_samples.clear();
+
+    // Every recorded stack hangs off a single root node, which is where samples would go if they had no frames.
+    m_frames.append({ .function_name = "(root)"_string, .source_code = nullptr, .source_offset = 0 });
+    m_nodes.append({ .frame_index = 0 });
+
+    m_start_time = MonotonicTime::now();
+    m_running.store(true, AK::MemoryOrder::memory_order_relaxed);
+
+    m_timer_thread = Threading::Thread::construct([this]() -> intptr_t {
+        auto interval_in_microseconds = static_cast<useconds_t>(m_sample_interval.to_microseconds());
+        while (m_running.load(AK::MemoryOrder::memory_order_relaxed)) {
+            usleep(interval_in_microseconds);
+            m_sample_requested.store(true, AK::MemoryOrder::memory_order_relaxed);
+        }
+        return 0;
+    },
+        "JS Profiler"sv);
+    m_timer_thread->start();
+}
+
+void SamplingProfiler::stop()
+{
+    if (!is_running())
+        return;
+
+    m_running.store(false, AK::MemoryOrder::memory_order_relaxed);
+    (void)m_timer_thread->join();
+    m_timer_thread = nullptr;
+    m_sample_requested.store(false, AK::MemoryOrder::memory_order_relaxed);
+
+    m_end_time = MonotonicTime::now();
+}
+
+void SamplingProfiler::take_sample()
+{
+    m_sample_requested.store(false, AK::MemoryOrder::memory_order_relaxed);
+
+    auto const& stack = m_vm.execution_context_stack();
+    if (stack.is_empty())
+        return;
+
+    u32 node_index = 0;
+    for (auto const* context : stack)
+        node_index = child_node_index(node_index, frame_index_for(*context));
+
+    auto& node = m_nodes[node_index];
+    ++node.hit_count;
+
+    // Samples are only taken at safepoints of the interpreter, so the innermost frame is the one it is executing.
+    auto const& running_context = *stack.last();
+    auto program_counter = m_vm.bytecode_interpreter().program_counter();
+    if (running_context.executable && program_counter.has_value()) {
+        auto source_range = running_context.executable->source_range_at(*program_counter);
+        if (source_range.source_code)
+            ++node.hit_count_by_source_offset.ensure(source_range.start_offset, [] { return 0u; });
+    }
+
+    m_samples.append({ node_index, MonotonicTime::now() });
+}
+
+u32 SamplingProfiler::frame_index_for(ExecutionContext const& context)
+{
+    Frame frame;
+    if (context.function_name)
+        frame.function_name = context.function_name->utf8_string();
+
+    // Frames are identified by the function they are running rather than the current position in it, so that all
+    // samples inside a function end up in the same node of the call tree.
+    if (context.function && is<ECMAScriptFunctionObject>(*context.function)) {
+        auto const& code = static_cast<ECMAScriptFunctionObject const&>(*context.function).ecmascript_code();
+        frame.source_code = code.source_code();
+        frame.source_offset = code.start_offset();
+    } else if (context.executable) {
+        frame.source_code = context.executable->source_code;
+    }
+
+    if (auto index = m_frame_indices.get(frame); index.has_value())
+        return *index;
+
+    auto index = static_cast<u32>(m_frames.size());
+    m_frame_indices.set(frame, index);
+    m_frames.append(move(frame));
+    return index;
+}
+
+u32 SamplingProfiler::child_node_index(u32 parent_index, u32 frame_index)
+{
+    if (auto index = m_nodes[parent_index].children_by_frame_index.get(frame_index); index.has_value())
+        return *index;
+
+    auto index = static_cast<u32>(m_nodes.size());
+    m_nodes[parent_index].children_by_frame_index.set(frame_index, index);
+    m_nodes.append({ .frame_index = frame_index, .parent_index = parent_index });
+    return index;
+}
+
+JsonObject SamplingProfiler::to_cpuprofile() const
+{
+    // Node ids must be positive, so they are offset by one from our indices.
+    auto node_id = [](u32 node_index) { return node_index + 1; };
+
+    HashMap<SourceCode const*, u32> script_ids;
+
+    JsonArray nodes;
+    for (u32 node_index = 0; node_index < m_nodes.size(); ++node_index) {
+        auto const& node = m_nodes[node_index];
+        auto const& frame = m_frames[node.frame_index];
+
+        JsonObject call_frame;
+        call_frame.set("functionName"sv, frame.function_name.is_empty() ? "(anonymous)"sv : frame.function_name.bytes_as_string_view());
+        if (frame.source_code) {
+            auto script_id = script_ids.ensure(frame.source_code.ptr(), [&] { return static_cast<u32>(script_ids.size() + 1); });
+            auto position = frame.source_code->range_from_offsets(frame.source_offset, frame.source_offset).start;
+            call_frame.set("scriptId"sv, ByteString::number(script_id));
+            call_frame.set("url"sv, frame.source_code->filename().bytes_as_string_view());
+            // DevTools positions are zero-based, ours start at one.
+            call_frame.set("lineNumber"sv, position.line > 0 ? position.line - 1 : 0);
+            call_frame.set("columnNumber"sv, position.column > 0 ? position.column - 1 : 0);
+        } else {
+            call_frame.set("scriptId"sv, "0"sv);
+            call_frame.set("url"sv, ""sv);
+            call_frame.set("lineNumber"sv, -1);
+            call_frame.set("columnNumber"sv, -1);
+        }
+
+        JsonArray children;
+        for (auto const& child : node.children_by_frame_index)
+            children.must_append(node_id(child.value));
+
+        // Attribute the self time of the node to the lines that were running, for the source view of the profile.
+        HashMap<size_t, u32> hit_count_by_line;
+        for (auto const& it : node.hit_count_by_source_offset) {
+            auto line = frame.source_code ? frame.source_code->range_from_offsets(it.key, it.key).start.line : 0;
+            hit_count_by_line.ensure(line, [] { return 0u; }) += it.value;
+        }
+        JsonArray position_ticks;
+        for (auto const& it : hit_count_by_line) {
+            JsonObject tick;
+            tick.set("line"sv, it.key);
+            tick.set("ticks"sv, it.value);
+            position_ticks.must_append(move(tick));
+        }
+
+        JsonObject json_node;
+        json_node.set("id"sv, node_id(node_index));
+        json_node.set("callFrame"sv, move(call_frame));
+        json_node.set("hitCount"sv, node.hit_count);
+        json_node.set("children"sv, move(children));
+        if (!position_ticks.is_empty())
+            json_node.set("positionTicks"sv, move(position_ticks));
+        nodes.must_append(move(json_node));
+    }
+
+    JsonArray samples;
+    JsonArray time_deltas;
+    auto previous_time = m_start_time;
+    for (auto const& sample : m_samples) {
+        samples.must_append(node_id(sample.node_index));
+        time_deltas.must_append((sample.time - previous_time).to_microseconds());
+        previous_time = sample.time;
+    }
+
+    auto end_time = is_running() ? MonotonicTime::now() : m_end_time;
+
+    JsonObject profile;
+    profile.set("nodes"sv, move(nodes));
+    profile.set("startTime"sv, m_start_time.nanoseconds() / 1000);
+    profile.set("endTime"sv, end_time.nanoseconds() / 1000);
+    profile.set("samples"sv, move(samples));
+    profile.set("timeDeltas"sv, move(time_deltas));
+    return profile;
+}
+
+}
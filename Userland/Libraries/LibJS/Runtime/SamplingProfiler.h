@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/HashMap.h>
+#include <AK/JsonObject.h>
+#include <AK/Noncopyable.h>
+#include <AK/RefPtr.h>
+#include <AK/String.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibJS/Forward.h>
+#include <LibJS/SourceCode.h>
+#include <LibThreading/Thread.h>
+
+namespace JS {
+
+// Records where the bytecode interpreter spends its time by periodically capturing the JavaScript call stack.
+// A timer thread only raises a flag, the stack is then captured by the interpreter itself at its next safepoint
+// (function entry or loop back-edge), so no other thread ever looks at the execution context stack. While no
+// profiler is running, the only cost to the interpreter is a null check at these safepoints.
+class SamplingProfiler {
+    AK_MAKE_NONCOPYABLE(SamplingProfiler);
+    AK_MAKE_NONMOVABLE(SamplingProfiler);
+
+public:
+    static constexpr AK::Duration default_sample_interval = AK::Duration::from_milliseconds(1);
+
+    explicit SamplingProfiler(VM&, AK::Duration sample_interval = default_sample_interval);
+    ~SamplingProfiler();
+
+    void start();
+    void stop();
+    bool is_running() const { return m_running.load(AK::MemoryOrder::memory_order_relaxed); }
+
+    ALWAYS_INLINE bool sample_requested() const { return m_sample_requested.load(AK::MemoryOrder::memory_order_relaxed); }
+    void take_sample();
+
+    size_t sample_count() const { return m_samples.size(); }
+
+    // Serializes the recorded samples in the .cpuprofile format understood by the Chrome DevTools and most flame
+    // graph viewers: https://chromedevtools.github.io/devtools-protocol/tot/Profiler/#type-Profile
+    JsonObject to_cpuprofile() const;
+
+private:
+    struct Frame {
+        String function_name;
+        RefPtr<SourceCode const> source_code;
+        u32 source_offset { 0 };
+
+        bool operator==(Frame const&) const = default;
+    };
+
+    struct FrameTraits : public DefaultTraits<Frame> {
+        static unsigned hash(Frame const&);
+    };
+
+    struct Node {
+        u32 frame_index { 0 };
+        Optional<u32> parent_index;
+        HashMap<u32, u32> children_by_frame_index;
+        u32 hit_count { 0 };
+
+        // The number of samples taken at each source offset while this frame was at the top of the stack.
+        HashMap<u32, u32> hit_count_by_source_offset;
+    };
+
+    struct Sample {
+        u32 node_index { 0 };
+        MonotonicTime time;
+    };
+
+    u32 frame_index_for(ExecutionContext const&);
+    u32 child_node_index(u32 parent_index, u32 frame_index);
+
+    VM& m_vm;
+    AK::Duration m_sample_interval;
+
+    RefPtr<Threading::Thread> m_timer_thread;
+    Atomic<bool> m_running { false };
+    Atomic<bool> m_sample_requested { false };
+
+    Vector<Frame> m_frames;
+    HashMap<Frame, u32, FrameTraits> m_frame_indices;
+    Vector<Node> m_nodes;
+    Vector<Sample> m_samples;
+    MonotonicTime m_start_time { MonotonicTime::now_coarse() };
+    MonotonicTime m_end_time { MonotonicTime::now_coarse() };
+};
+
+}
@@ -320,7 +320,7 @@ JS_DEFINE_NATIVE_FUNCTION(SetPrototype::intersection)
     // 6. If thisSize ≤ otherRec.[[Size]], then
     if (this_size <= other_record.size) {
         // a. For each element e of O.[[SetData]], do
-        for (auto& element : *set) {
+        for (auto element : *set) {
             // i. If e is not empty, then
             //     1. Let inOther be ToBoolean(? Call(otherRec.[[Has]], otherRec.[[Set]], « e »)).
             auto in_other = TRY(call(vm, *other_record.has, other_record.set, element.key)).to_boolean();
@@ -398,7 +398,7 @@ JS_DEFINE_NATIVE_FUNCTION(SetPrototype::difference)
     // 6. If thisSize ≤ otherRec.[[Size]], then
     if (this_size <= other_record.size) {
         // a. For each element e of resultSetData, do
-        for (auto& element : *set) {
+        for (auto element : *set) {
             // i. If e is not empty, then
             // 1.     Let inOther be ToBoolean(? Call(otherRec.[[Has]], otherRec.[[Set]], « e »)).
             auto in_other = TRY(call(vm, *other_record.has, other_record.set, element.key)).to_boolean();
@@ -53,6 +53,14 @@ GCPtr<Shape> Shape::get_or_prune_cached_forward_transition(TransitionKey const&
 {
     if (m_is_prototype_shape)
         return nullptr;
+    if (m_single_forward_transition_key == key) {
+        if (!m_single_forward_transition) {
+            // The inline forward transition has gone stale (from garbage collection). Prune it.
+            m_single_forward_transition_key = {};
+            return nullptr;
+        }
+        return m_single_forward_transition.ptr();
+    }
     if (!m_forward_transitions)
         return nullptr;
     auto it = m_forward_transitions->find(key);
@@ -66,6 +74,19 @@ GCPtr<Shape> Shape::get_or_prune_cached_forward_transition(TransitionKey const&
     return it->value.ptr();
 }
 
+void Shape::cache_forward_transition(TransitionKey const& key, Shape& new_shape)
+{
+    VERIFY(!m_is_prototype_shape);
+    if (!m_single_forward_transition) {
+        m_single_forward_transition_key = key;
+        m_single_forward_transition = new_shape;
+        return;
+    }
+    if (!m_forward_transitions)
+        m_forward_transitions = make<HashMap<TransitionKey, WeakPtr<Shape>>>();
+    m_forward_transitions->set(key, &new_shape);
+}
+
 GCPtr<Shape> Shape::get_or_prune_cached_delete_transition(StringOrSymbol const& key)
 {
     if (m_is_prototype_shape)
@@ -107,11 +128,8 @@ NonnullGCPtr<Shape> Shape::create_put_transition(StringOrSymbol const& property_
         return *existing_shape;
     auto new_shape = heap().allocate_without_realm<Shape>(*this, property_key, attributes, TransitionType::Put);
     invalidate_prototype_if_needed_for_new_prototype(new_shape);
-    if (!m_is_prototype_shape) {
-        if (!m_forward_transitions)
-            m_forward_transitions = make<HashMap<TransitionKey, WeakPtr<Shape>>>();
-        m_forward_transitions->set(key, new_shape.ptr());
-    }
+    if (!m_is_prototype_shape)
+        cache_forward_transition(key, *new_shape);
     return new_shape;
 }
 
@@ -122,11 +140,8 @@ NonnullGCPtr<Shape> Shape::create_configure_transition(StringOrSymbol const& pro
         return *existing_shape;
     auto new_shape = heap().allocate_without_realm<Shape>(*this, property_key, attributes, TransitionType::Configure);
     invalidate_prototype_if_needed_for_new_prototype(new_shape);
-    if (!m_is_prototype_shape) {
-        if (!m_forward_transitions)
-            m_forward_transitions = make<HashMap<TransitionKey, WeakPtr<Shape>>>();
-        m_forward_transitions->set(key, new_shape.ptr());
-    }
+    if (!m_is_prototype_shape)
+        cache_forward_transition(key, *new_shape);
     return new_shape;
 }
 
@@ -196,6 +211,7 @@ void Shape::visit_edges(Cell::Visitor& visitor)
     visitor.ignore(m_prototype_transitions);
 
     // FIXME: The forward transition keys should be weak, but we have to mark them for now in case they go stale.
+    m_single_forward_transition_key.property_key.visit_edges(visitor);
     if (m_forward_transitions) {
         for (auto& it : *m_forward_transitions)
             it.key.property_key.visit_edges(visitor);
@@ -117,6 +117,7 @@ private:
     virtual void visit_edges(Visitor&) override;
 
     [[nodiscard]] GCPtr<Shape> get_or_prune_cached_forward_transition(TransitionKey const&);
+    void cache_forward_transition(TransitionKey const&, Shape&);
     [[nodiscard]] GCPtr<Shape> get_or_prune_cached_prototype_transition(Object* prototype);
     [[nodiscard]] GCPtr<Shape> get_or_prune_cached_delete_transition(StringOrSymbol const&);
 
@@ -126,6 +127,10 @@ private:
 
     mutable OwnPtr<OrderedHashMap<StringOrSymbol, PropertyMetadata>> m_property_table;
 
+    // NOTE: Most shapes only ever transition to a single other shape, so the first forward transition is
+    //       stored inline, and the hash map is only allocated once a second one comes along.
+    TransitionKey m_single_forward_transition_key;
+    WeakPtr<Shape> m_single_forward_transition;
     OwnPtr<HashMap<TransitionKey, WeakPtr<Shape>>> m_forward_transitions;
     OwnPtr<HashMap<GCPtr<Object>, WeakPtr<Shape>>> m_prototype_transitions;
     OwnPtr<HashMap<StringOrSymbol, WeakPtr<Shape>>> m_delete_transitions;
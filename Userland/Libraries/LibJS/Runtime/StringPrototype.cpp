@@ -42,12 +42,17 @@ static ThrowCompletionOr<String> utf8_string_from(VM& vm)
     return TRY(this_value.to_string(vm));
 }
 
-static ThrowCompletionOr<Utf16String> utf16_string_from(VM& vm)
+static ThrowCompletionOr<Utf16String> utf16_string_from(VM& vm, Value this_value)
 {
-    auto this_value = TRY(require_object_coercible(vm, vm.this_value()));
+    TRY(require_object_coercible(vm, this_value));
     return TRY(this_value.to_utf16_string(vm));
 }
 
+static ThrowCompletionOr<Utf16String> utf16_string_from(VM& vm)
+{
+    return utf16_string_from(vm, vm.this_value());
+}
+
 // 22.1.3.21.1 SplitMatch ( S, q, R ), https://tc39.es/ecma262/#sec-splitmatch
 // FIXME: This no longer exists in the spec!
 static Optional<size_t> split_match(Utf16View const& haystack, size_t start, Utf16View const& needle)
@@ -175,12 +180,12 @@ void StringPrototype::initialize(Realm& realm)
     // 22.1.3 Properties of the String Prototype Object, https://tc39.es/ecma262/#sec-properties-of-the-string-prototype-object
     define_native_function(realm, vm.names.at, at, 1, attr);
     define_native_function(realm, vm.names.charAt, char_at, 1, attr);
-    define_native_function(realm, vm.names.charCodeAt, char_code_at, 1, attr);
+    define_native_function(realm, vm.names.charCodeAt, char_code_at, 1, attr, Bytecode::Builtin::StringPrototypeCharCodeAt);
     define_native_function(realm, vm.names.codePointAt, code_point_at, 1, attr);
     define_native_function(realm, vm.names.concat, concat, 1, attr);
     define_native_function(realm, vm.names.endsWith, ends_with, 1, attr);
     define_native_function(realm, vm.names.includes, includes, 1, attr);
-    define_native_function(realm, vm.names.indexOf, index_of, 1, attr);
+    define_native_function(realm, vm.names.indexOf, index_of, 1, attr, Bytecode::Builtin::StringPrototypeIndexOf);
     define_native_function(realm, vm.names.isWellFormed, is_well_formed, 0, attr);
     define_native_function(realm, vm.names.lastIndexOf, last_index_of, 1, attr);
     define_native_function(realm, vm.names.localeCompare, locale_compare, 1, attr);
@@ -193,7 +198,7 @@ void StringPrototype::initialize(Realm& realm)
     define_native_function(realm, vm.names.replace, replace, 2, attr);
     define_native_function(realm, vm.names.replaceAll, replace_all, 2, attr);
     define_native_function(realm, vm.names.search, search, 1, attr);
-    define_native_function(realm, vm.names.slice, slice, 2, attr);
+    define_native_function(realm, vm.names.slice, slice, 2, attr, Bytecode::Builtin::StringPrototypeSlice);
     define_native_function(realm, vm.names.split, split, 2, attr);
     define_native_function(realm, vm.names.startsWith, starts_with, 1, attr);
     define_native_function(realm, vm.names.substring, substring, 2, attr);
@@ -300,14 +305,14 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::char_at)
 }
 
 // 22.1.3.3 String.prototype.charCodeAt ( pos ), https://tc39.es/ecma262/#sec-string.prototype.charcodeat
-JS_DEFINE_NATIVE_FUNCTION(StringPrototype::char_code_at)
+ThrowCompletionOr<Value> StringPrototype::char_code_at_impl(VM& vm, Value this_value, Value pos)
 {
     // 1. Let O be ? RequireObjectCoercible(this value).
     // 2. Let S be ? ToString(O).
-    auto string = TRY(utf16_string_from(vm));
+    auto string = TRY(utf16_string_from(vm, this_value));
 
     // 3. Let position be ? ToIntegerOrInfinity(pos).
-    auto position = TRY(vm.argument(0).to_integer_or_infinity(vm));
+    auto position = TRY(pos.to_integer_or_infinity(vm));
 
     // 4. Let size be the length of S.
     // 5. If position < 0 or position ≥ size, return NaN.
@@ -318,6 +323,11 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::char_code_at)
     return Value(string.code_unit_at(position));
 }
 
+JS_DEFINE_NATIVE_FUNCTION(StringPrototype::char_code_at)
+{
+    return char_code_at_impl(vm, vm.this_value(), vm.argument(0));
+}
+
 // 22.1.3.4 String.prototype.codePointAt ( pos ), https://tc39.es/ecma262/#sec-string.prototype.codepointat
 JS_DEFINE_NATIVE_FUNCTION(StringPrototype::code_point_at)
 {
@@ -459,23 +469,23 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::includes)
 }
 
 // 22.1.3.9 String.prototype.indexOf ( searchString [ , position ] ), https://tc39.es/ecma262/#sec-string.prototype.indexof
-JS_DEFINE_NATIVE_FUNCTION(StringPrototype::index_of)
+ThrowCompletionOr<Value> StringPrototype::index_of_impl(VM& vm, Value this_value, Value search_string_value, Value position_value)
 {
     // 1. Let O be ? RequireObjectCoercible(this value).
     // 2. Let S be ? ToString(O).
-    auto string = TRY(utf16_string_from(vm));
+    auto string = TRY(utf16_string_from(vm, this_value));
 
     // 3. Let searchStr be ? ToString(searchString).
-    auto search_string = TRY(vm.argument(0).to_utf16_string(vm));
+    auto search_string = TRY(search_string_value.to_utf16_string(vm));
 
     auto utf16_string_view = string.view();
     auto utf16_search_view = search_string.view();
 
     size_t start = 0;
-    if (vm.argument_count() > 1) {
+    if (!position_value.is_undefined()) {
         // 4. Let pos be ? ToIntegerOrInfinity(position).
         // 5. Assert: If position is undefined, then pos is 0.
-        auto position = TRY(vm.argument(1).to_integer_or_infinity(vm));
+        auto position = TRY(position_value.to_integer_or_infinity(vm));
 
         // 6. Let len be the length of S.
         // 7. Let start be the result of clamping pos between 0 and len.
@@ -487,6 +497,11 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::index_of)
     return index.has_value() ? Value(*index) : Value(-1);
 }
 
+JS_DEFINE_NATIVE_FUNCTION(StringPrototype::index_of)
+{
+    return index_of_impl(vm, vm.this_value(), vm.argument(0), vm.argument(1));
+}
+
 // 22.1.3.10 String.prototype.isWellFormed ( ), https://tc39.es/ecma262/#sec-string.prototype.iswellformed
 JS_DEFINE_NATIVE_FUNCTION(StringPrototype::is_well_formed)
 {
@@ -563,10 +578,13 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::locale_compare)
     auto that_value = TRY(vm.argument(0).to_string(vm));
 
     // 4. Let collator be ? Construct(%Collator%, « locales, options »).
-    auto collator = TRY(construct(vm, realm.intrinsics().intl_collator_constructor(), vm.argument(1), vm.argument(2)));
+    //    NOTE: Collators created without options are cached, as creating one for every comparison is very slow.
+    auto collator = TRY(realm.intl_formatter_cache().get_or_create<Intl::Collator>(Intl::FormatterCache::Type::Collator, vm.argument(1), vm.argument(2), [&] {
+        return construct(vm, realm.intrinsics().intl_collator_constructor(), vm.argument(1), vm.argument(2));
+    }));
 
     // 5. Return CompareStrings(collator, S, thatValue).
-    return Intl::compare_strings(static_cast<Intl::Collator&>(*collator), string.code_points(), that_value.code_points());
+    return Intl::compare_strings(collator, string.code_points(), that_value.code_points());
 }
 
 // 22.1.3.13 String.prototype.match ( regexp ), https://tc39.es/ecma262/#sec-string.prototype.match
@@ -1011,14 +1029,11 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::search)
 }
 
 // 22.1.3.22 String.prototype.slice ( start, end ), https://tc39.es/ecma262/#sec-string.prototype.slice
-JS_DEFINE_NATIVE_FUNCTION(StringPrototype::slice)
+ThrowCompletionOr<Value> StringPrototype::slice_impl(VM& vm, Value this_value, Value start, Value end)
 {
-    auto start = vm.argument(0);
-    auto end = vm.argument(1);
-
     // 1. Let O be ? RequireObjectCoercible(this value).
     // 2. Let S be ? ToString(O).
-    auto string = TRY(utf16_string_from(vm));
+    auto string = TRY(utf16_string_from(vm, this_value));
 
     // 3. Let len be the length of S.
     auto string_length = static_cast<double>(string.length_in_code_units());
@@ -1059,6 +1074,11 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::slice)
     return PrimitiveString::create(vm, Utf16String::create(string.substring_view(int_start, int_end - int_start)));
 }
 
+JS_DEFINE_NATIVE_FUNCTION(StringPrototype::slice)
+{
+    return slice_impl(vm, vm.this_value(), vm.argument(0), vm.argument(1));
+}
+
 // 22.1.3.23 String.prototype.split ( separator, limit ), https://tc39.es/ecma262/#sec-string.prototype.split
 JS_DEFINE_NATIVE_FUNCTION(StringPrototype::split)
 {
@@ -31,6 +31,10 @@ public:
     virtual void initialize(Realm&) override;
     virtual ~StringPrototype() override = default;
 
+    static ThrowCompletionOr<Value> char_code_at_impl(VM&, Value this_value, Value position);
+    static ThrowCompletionOr<Value> index_of_impl(VM&, Value this_value, Value search_string, Value position);
+    static ThrowCompletionOr<Value> slice_impl(VM&, Value this_value, Value start, Value end);
+
 private:
     JS_DECLARE_NATIVE_FUNCTION(at);
     JS_DECLARE_NATIVE_FUNCTION(char_at);
@@ -18,6 +18,7 @@
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/ArrayBuffer.h>
+#include <LibJS/Runtime/AtomicsObject.h>
 #include <LibJS/Runtime/BoundFunction.h>
 #include <LibJS/Runtime/Completion.h>
 #include <LibJS/Runtime/ECMAScriptFunctionObject.h>
@@ -28,6 +29,7 @@
 #include <LibJS/Runtime/NativeFunction.h>
 #include <LibJS/Runtime/PromiseCapability.h>
 #include <LibJS/Runtime/Reference.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
 #include <LibJS/Runtime/Symbol.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibJS/SourceTextModule.h>
@@ -90,6 +92,10 @@ VM::VM(OwnPtr<CustomData> custom_data, ErrorMessages error_messages)
         enqueue_promise_job(job, realm);
     };
 
+    host_enqueue_timeout_job = [this](NonnullGCPtr<HeapFunction<void()>> job, Realm& realm, double milliseconds) {
+        enqueue_timeout_job(job, realm, milliseconds);
+    };
+
     host_make_job_callback = [](FunctionObject& function_object) {
         return make_job_callback(function_object);
     };
@@ -155,7 +161,11 @@ VM::VM(OwnPtr<CustomData> custom_data, ErrorMessages error_messages)
     };
 }
 
-VM::~VM() = default;
+VM::~VM()
+{
+    // Asynchronous waiters hold handles into our heap, so they have to go before it does.
+    remove_waiters_of_agent(*this);
+}
 
 String const& VM::error_message(ErrorMessage type) const
 {
@@ -172,6 +182,13 @@ Bytecode::Interpreter& VM::bytecode_interpreter()
     return *m_bytecode_interpreter;
 }
 
+SamplingProfiler& VM::ensure_sampling_profiler()
+{
+    if (!m_sampling_profiler)
+        m_sampling_profiler = make<SamplingProfiler>(*this);
+    return *m_sampling_profiler;
+}
+
 struct ExecutionContextRootsCollector : public Cell::Visitor {
     virtual void visit_impl(Cell& cell) override
     {
@@ -217,6 +234,9 @@ void VM::gather_roots(HashMap<Cell*, HeapRoot>& roots)
 
     for (auto& job : m_promise_jobs)
         roots.set(job, HeapRoot { .type = HeapRoot::Type::VM });
+
+    for (auto& timeout_job : m_timeout_jobs)
+        roots.set(timeout_job.job, HeapRoot { .type = HeapRoot::Type::VM });
 }
 
 // 9.1.2.1 GetIdentifierReference ( env, name, strict ), https://tc39.es/ecma262/#sec-getidentifierreference
@@ -394,6 +414,30 @@ void VM::run_queued_finalization_registry_cleanup_jobs()
     }
 }
 
+void VM::run_due_timeout_jobs()
+{
+    auto now = MonotonicTime::now();
+
+    Vector<NonnullGCPtr<HeapFunction<void()>>> due_jobs;
+    m_timeout_jobs.remove_all_matching([&](auto const& timeout_job) {
+        if (timeout_job.due_time > now)
+            return false;
+        due_jobs.append(timeout_job.job);
+        return true;
+    });
+
+    for (auto& job : due_jobs)
+        job->function()();
+}
+
+// 9.5.5 HostEnqueueTimeoutJob ( timeoutJob, realm, milliseconds ), https://tc39.es/ecma262/#sec-hostenqueuetimeoutjob
+void VM::enqueue_timeout_job(NonnullGCPtr<HeapFunction<void()>> job, Realm&, double milliseconds)
+{
+    // An implementation of HostEnqueueTimeoutJob must conform to the requirements in 9.5.
+    // NOTE: There is no event loop here, so the embedder has to call run_due_timeout_jobs() to run jobs that are due.
+    m_timeout_jobs.append({ job, MonotonicTime::now() + Duration::from_microseconds(static_cast<i64>(milliseconds * 1000)) });
+}
+
 // 9.10.4.1 HostEnqueueFinalizationRegistryCleanupJob ( finalizationRegistry ), https://tc39.es/ecma262/#sec-host-cleanup-finalization-registry
 void VM::enqueue_finalization_registry_cleanup_job(FinalizationRegistry& registry)
 {
@@ -14,6 +14,7 @@
 #include <AK/HashMap.h>
 #include <AK/RefCounted.h>
 #include <AK/StackInfo.h>
+#include <AK/Time.h>
 #include <AK/Variant.h>
 #include <LibJS/CyclicModule.h>
 #include <LibJS/Heap/Heap.h>
@@ -53,6 +54,10 @@ public:
 
     Bytecode::Interpreter& bytecode_interpreter();
 
+    // Returns the profiler of this VM, which may or may not be running, or null if none was ever created.
+    SamplingProfiler* sampling_profiler() { return m_sampling_profiler.ptr(); }
+    SamplingProfiler& ensure_sampling_profiler();
+
     void dump_backtrace() const;
 
     void gather_roots(HashMap<Cell*, HeapRoot>&);
@@ -75,6 +80,12 @@ public:
         return m_byte_string_cache;
     }
 
+    struct CachedScriptParse {
+        size_t line_number_offset { 0 };
+        NonnullRefPtr<Program> program;
+    };
+    Vector<CachedScriptParse>& script_parse_cache() { return m_script_parse_cache; }
+
     PrimitiveString& empty_string() { return *m_empty_string; }
 
     PrimitiveString& single_ascii_character_string(u8 character)
@@ -185,6 +196,10 @@ public:
     u32 execution_generation() const { return m_execution_generation; }
     void finish_execution_generation() { ++m_execution_generation; }
 
+    // [[CanBlock]] of the surrounding agent's Agent Record, https://tc39.es/ecma262/#sec-agents
+    bool agent_can_block() const { return m_agent_can_block; }
+    void set_agent_can_block(bool can_block) { m_agent_can_block = can_block; }
+
     ThrowCompletionOr<Reference> resolve_binding(DeprecatedFlyString const&, Environment* = nullptr);
     ThrowCompletionOr<Reference> get_identifier_reference(Environment*, DeprecatedFlyString, bool strict, size_t hops = 0);
 
@@ -218,6 +233,9 @@ public:
     void run_queued_finalization_registry_cleanup_jobs();
     void enqueue_finalization_registry_cleanup_job(FinalizationRegistry&);
 
+    void run_due_timeout_jobs();
+    void enqueue_timeout_job(NonnullGCPtr<HeapFunction<void()>> job, Realm&, double milliseconds);
+
     void promise_rejection_tracker(Promise&, Promise::RejectionOperation) const;
 
     Function<void()> on_call_stack_emptied;
@@ -254,6 +272,7 @@ public:
     Function<ThrowCompletionOr<Value>(JobCallback&, Value, ReadonlySpan<Value>)> host_call_job_callback;
     Function<void(FinalizationRegistry&)> host_enqueue_finalization_registry_cleanup_job;
     Function<void(NonnullGCPtr<HeapFunction<ThrowCompletionOr<Value>()>>, Realm*)> host_enqueue_promise_job;
+    Function<void(NonnullGCPtr<HeapFunction<void()>>, Realm&, double)> host_enqueue_timeout_job;
     Function<JS::NonnullGCPtr<JobCallback>(FunctionObject&)> host_make_job_callback;
     Function<ThrowCompletionOr<void>(Realm&)> host_ensure_can_compile_strings;
     Function<ThrowCompletionOr<void>(Object&)> host_ensure_can_add_private_element;
@@ -283,6 +302,9 @@ private:
 
     Heap m_heap;
 
+    // NOTE: Cached programs hold handles to their compiled executables, so this must be destroyed before the heap.
+    Vector<CachedScriptParse> m_script_parse_cache;
+
     Vector<ExecutionContext*> m_execution_context_stack;
 
     Vector<Vector<ExecutionContext*>> m_saved_execution_context_stacks;
@@ -296,6 +318,12 @@ private:
 
     Vector<GCPtr<FinalizationRegistry>> m_finalization_registry_cleanup_jobs;
 
+    struct TimeoutJob {
+        NonnullGCPtr<HeapFunction<void()>> job;
+        MonotonicTime due_time;
+    };
+    Vector<TimeoutJob> m_timeout_jobs;
+
     GCPtr<PrimitiveString> m_empty_string;
     GCPtr<PrimitiveString> m_single_ascii_character_strings[128] {};
     ErrorMessages m_error_messages;
@@ -320,7 +348,10 @@ private:
 
     OwnPtr<Bytecode::Interpreter> m_bytecode_interpreter;
 
+    OwnPtr<SamplingProfiler> m_sampling_profiler;
+
     bool m_dynamic_imports_allowed { false };
+    bool m_agent_can_block { true };
 };
 
 template<typename GlobalObjectType, typename... Args>
@@ -17,22 +17,27 @@ struct ValueTraits : public Traits<Value> {
     static unsigned hash(Value value)
     {
         VERIFY(!value.is_empty());
-        if (value.is_string()) {
-            // FIXME: Propagate this error.
-            return value.as_string().byte_string().hash();
-        }
+
+        // NOTE: -0 and +0 are equal under SameValueZero, so -0 has to be hashed like the Int32 0 it is equal to.
+        if (value.is_negative_zero())
+            value = Value(0);
+
+        if (value.is_int32())
+            return int_hash(static_cast<u32>(value.as_i32()));
+
+        // NOTE: Strings cache the hash of their UTF-8 representation, which also avoids making a ByteString copy.
+        if (value.is_string())
+            return value.as_string().utf8_string().hash();
 
         if (value.is_bigint())
             return value.as_bigint().big_integer().hash();
 
-        if (value.is_negative_zero())
-            value = Value(0);
         // In the IEEE 754 standard a NaN value is encoded as any value from 0x7ff0000000000001 to 0x7fffffffffffffff,
         // with the least significant bits (referred to as the 'payload') carrying some kind of diagnostic information
         // indicating the source of the NaN. Since ECMA262 does not differentiate between different kinds of NaN values,
         // Sets and Maps must not differentiate between them either.
         // This is achieved by replacing any NaN value by a canonical qNaN.
-        else if (value.is_nan())
+        if (value.is_nan())
             value = js_nan();
 
         return u64_hash(value.encoded()); // FIXME: Is this the best way to hash pointers, doubles & ints?
@@ -14,9 +14,48 @@ namespace JS {
 
 JS_DEFINE_ALLOCATOR(Script);
 
+// OPTIMIZATION: The same large scripts tend to get loaded over and over (across navigations, and by every
+//               iframe that embeds them), and the parsed AST does not depend on the realm it is evaluated in.
+//               The VM keeps a handful of recently parsed large programs around so repeat loads can skip parsing.
+static constexpr size_t minimum_source_length_for_parse_cache = 16 * KiB;
+static constexpr size_t maximum_parse_cache_entries = 8;
+
+static RefPtr<Program> find_cached_parse(VM& vm, StringView source_text, StringView filename, size_t line_number_offset)
+{
+    if (source_text.length() < minimum_source_length_for_parse_cache)
+        return nullptr;
+    auto& cache = vm.script_parse_cache();
+    for (size_t i = 0; i < cache.size(); ++i) {
+        auto& entry = cache[i];
+        if (entry.line_number_offset != line_number_offset)
+            continue;
+        auto const& source_code = entry.program->source_code();
+        if (source_code.code().bytes_as_string_view() != source_text || source_code.filename().bytes_as_string_view() != filename)
+            continue;
+        auto program = entry.program;
+        // Move the hit to the back so that the least recently used entry is the first to go.
+        cache.append(cache.take(i));
+        return program;
+    }
+    return nullptr;
+}
+
+static void cache_parse(VM& vm, StringView source_text, size_t line_number_offset, NonnullRefPtr<Program> program)
+{
+    if (source_text.length() < minimum_source_length_for_parse_cache)
+        return;
+    auto& cache = vm.script_parse_cache();
+    if (cache.size() >= maximum_parse_cache_entries)
+        cache.take_first();
+    cache.append({ line_number_offset, move(program) });
+}
+
 // 16.1.5 ParseScript ( sourceText, realm, hostDefined ), https://tc39.es/ecma262/#sec-parse-script
 Result<NonnullGCPtr<Script>, Vector<ParserError>> Script::parse(StringView source_text, Realm& realm, StringView filename, HostDefined* host_defined, size_t line_number_offset)
 {
+    if (auto cached_program = find_cached_parse(realm.vm(), source_text, filename, line_number_offset))
+        return realm.heap().allocate_without_realm<Script>(realm, filename, cached_program.release_nonnull(), host_defined);
+
     // 1. Let script be ParseText(sourceText, Script).
     auto parser = Parser(Lexer(source_text, filename, line_number_offset));
     auto script = parser.parse_program();
@@ -25,6 +64,8 @@ Result<NonnullGCPtr<Script>, Vector<ParserError>> Script::parse(StringView sourc
     if (parser.has_errors())
         return parser.errors();
 
+    cache_parse(realm.vm(), source_text, line_number_offset, script);
+
     // 3. Return Script Record { [[Realm]]: realm, [[ECMAScriptCode]]: script, [[HostDefined]]: hostDefined }.
     return realm.heap().allocate_without_realm<Script>(realm, filename, move(script), host_defined);
 }
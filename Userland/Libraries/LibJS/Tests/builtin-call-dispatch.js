@@ -0,0 +1,60 @@
+test("calls with the builtin's argument count give the same results", () => {
+    expect(Math.min(3, 1)).toBe(1);
+    expect(Math.max(3, 1)).toBe(3);
+    expect(Math.max(NaN, 1)).toBeNaN();
+    expect(Object.hasOwn({ a: 1 }, "a")).toBeTrue();
+    expect("abc".charCodeAt(1)).toBe(98);
+    expect("abcabc".indexOf("c")).toBe(2);
+    expect("abcdef".slice(1, -1)).toBe("bcde");
+
+    const array = [1];
+    expect(array.push(2)).toBe(2);
+    expect(array.pop()).toBe(2);
+    expect(array).toEqual([1]);
+});
+
+test("methods of the same name on other objects are called", () => {
+    expect([1, 2, 3].slice(1, 2)).toEqual([2]);
+    expect([1, 2, 3].indexOf(3)).toBe(2);
+
+    const object = {
+        calls: 0,
+        push() {
+            return ++this.calls;
+        },
+        charCodeAt() {
+            return "not a char code";
+        },
+    };
+    expect(object.push(1)).toBe(1);
+    expect(object.charCodeAt(0)).toBe("not a char code");
+});
+
+test("builtins are used with the receiver of the call", () => {
+    const arrayLike = { length: 0 };
+    Array.prototype.push.call(arrayLike, "x");
+    arrayLike.push = Array.prototype.push;
+    expect(arrayLike.push("y")).toBe(2);
+    expect(arrayLike[1]).toBe("y");
+
+    expect(() => String.prototype.charCodeAt.call(null, 0)).toThrow(TypeError);
+    const boxed = { charCodeAt: String.prototype.charCodeAt, toString: () => "z" };
+    expect(boxed.charCodeAt(0)).toBe(122);
+});
+
+test("overridden builtins are called", () => {
+    const originalMax = Math.max;
+    const originalPush = Array.prototype.push;
+    try {
+        Math.max = () => "overridden";
+        Array.prototype.push = function () {
+            return "overridden";
+        };
+        expect(Math.max(1, 2)).toBe("overridden");
+        expect([].push(1)).toBe("overridden");
+    } finally {
+        Math.max = originalMax;
+        Array.prototype.push = originalPush;
+    }
+    expect(Math.max(1, 2)).toBe(2);
+});
@@ -58,4 +58,32 @@ describe("normal behavior", () => {
         }, t);
         expect(t).toEqual([1, 2, 3]);
     });
+
+    test("holes are looked up on the prototype chain", () => {
+        const a = [1, , 3];
+        Object.defineProperty(Array.prototype, 1, {
+            get() {
+                a.length = 2;
+                return "from prototype";
+            },
+            configurable: true,
+        });
+        let seen = "";
+        try {
+            a.forEach(value => (seen += `${value};`));
+        } finally {
+            delete Array.prototype[1];
+        }
+        expect(seen).toBe("1;from prototype;");
+    });
+
+    test("elements removed during iteration are skipped", () => {
+        const a = [1, 2, 3, 4];
+        const seen = [];
+        a.forEach(value => {
+            seen.push(value);
+            if (value === 1) delete a[2];
+        });
+        expect(seen).toEqual([1, 2, 4]);
+    });
 });
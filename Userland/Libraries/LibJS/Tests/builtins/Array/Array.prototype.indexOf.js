@@ -23,3 +23,16 @@ test("basic functionality", () => {
     expect([].indexOf()).toBe(-1);
     expect([undefined].indexOf()).toBe(0);
 });
+
+test("holes and non-simple storage", () => {
+    expect([1, , 3].indexOf(undefined)).toBe(-1);
+    expect([NaN].indexOf(NaN)).toBe(-1);
+
+    const sparse = [1, 2, 3];
+    sparse[1000] = 4;
+    expect(sparse.indexOf(4)).toBe(1000);
+
+    const withAccessor = [1, 2, 3];
+    Object.defineProperty(withAccessor, 1, { get: () => 5 });
+    expect(withAccessor.indexOf(5)).toBe(1);
+});
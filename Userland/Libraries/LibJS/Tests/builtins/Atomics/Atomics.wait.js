@@ -73,4 +73,39 @@ test("basic functionality", () => {
     test("invariants", () => {
         expect(Atomics.wait).toHaveLength(4);
     });
+
+    test("value is not the expected value", () => {
+        const buffer = new SharedArrayBuffer(4 * Int32Array.BYTES_PER_ELEMENT);
+        const typedArray = new Int32Array(buffer);
+        typedArray[1] = 1;
+
+        expect(Atomics.wait(typedArray, 1, 0, 0)).toBe("not-equal");
+        expect(Atomics.wait(typedArray, 1, 0)).toBe("not-equal");
+
+        const bigIntArray = new BigInt64Array(buffer);
+        expect(Atomics.wait(bigIntArray, 0, 0n, 0)).toBe("not-equal");
+    });
+
+    test("timing out", () => {
+        const buffer = new SharedArrayBuffer(4 * Int32Array.BYTES_PER_ELEMENT);
+        const typedArray = new Int32Array(buffer);
+
+        expect(Atomics.wait(typedArray, 0, 0, 0)).toBe("timed-out");
+        expect(Atomics.wait(typedArray, 0, 0, -Infinity)).toBe("timed-out");
+
+        const start = Date.now();
+        expect(Atomics.wait(typedArray, 0, 0, 10)).toBe("timed-out");
+        expect(Date.now() - start).toBeGreaterThanOrEqual(10);
+
+        const bigIntArray = new BigInt64Array(buffer);
+        expect(Atomics.wait(bigIntArray, 1, 0n, 0)).toBe("timed-out");
+    });
+
+    test("timed out waiters are no longer notified", () => {
+        const buffer = new SharedArrayBuffer(4 * Int32Array.BYTES_PER_ELEMENT);
+        const typedArray = new Int32Array(buffer);
+
+        expect(Atomics.wait(typedArray, 0, 0, 0)).toBe("timed-out");
+        expect(Atomics.notify(typedArray, 0)).toBe(0);
+    });
 });
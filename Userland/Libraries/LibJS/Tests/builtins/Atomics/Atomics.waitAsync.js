@@ -73,4 +73,117 @@ test("basic functionality", () => {
     test("invariants", () => {
         expect(Atomics.waitAsync).toHaveLength(4);
     });
+
+    test("value is not the expected value", () => {
+        const buffer = new SharedArrayBuffer(4 * Int32Array.BYTES_PER_ELEMENT);
+        const typedArray = new Int32Array(buffer);
+        typedArray[0] = 1;
+
+        const result = Atomics.waitAsync(typedArray, 0, 0);
+        expect(Object.getPrototypeOf(result)).toBe(Object.prototype);
+        expect(result.async).toBeFalse();
+        expect(result.value).toBe("not-equal");
+    });
+
+    test("immediate timeout", () => {
+        const buffer = new SharedArrayBuffer(4 * Int32Array.BYTES_PER_ELEMENT);
+        const typedArray = new Int32Array(buffer);
+
+        const result = Atomics.waitAsync(typedArray, 0, 0, 0);
+        expect(result.async).toBeFalse();
+        expect(result.value).toBe("timed-out");
+    });
+
+    test("resolved by Atomics.notify", () => {
+        const buffer = new SharedArrayBuffer(4 * Int32Array.BYTES_PER_ELEMENT);
+        const typedArray = new Int32Array(buffer);
+
+        const first = Atomics.waitAsync(typedArray, 0, 0);
+        const second = Atomics.waitAsync(typedArray, 0, 0);
+        const other = Atomics.waitAsync(typedArray, 1, 0);
+        expect(first.async).toBeTrue();
+        expect(first.value).toBeInstanceOf(Promise);
+
+        const results = [];
+        first.value.then(value => results.push(["first", value]));
+        second.value.then(value => results.push(["second", value]));
+        other.value.then(value => results.push(["other", value]));
+
+        expect(Atomics.notify(typedArray, 0, 1)).toBe(1);
+        runQueuedPromiseJobs();
+        expect(results).toEqual([["first", "ok"]]);
+
+        expect(Atomics.notify(typedArray, 0)).toBe(1);
+        expect(Atomics.notify(typedArray, 0)).toBe(0);
+        runQueuedPromiseJobs();
+        expect(results).toEqual([
+            ["first", "ok"],
+            ["second", "ok"],
+        ]);
+
+        expect(Atomics.notify(typedArray, 1)).toBe(1);
+        runQueuedPromiseJobs();
+        expect(results).toHaveLength(3);
+    });
+
+    test("waiters are notified through every view of the buffer", () => {
+        const buffer = new SharedArrayBuffer(4 * Int32Array.BYTES_PER_ELEMENT);
+        const typedArray = new Int32Array(buffer);
+        const offsetArray = new Int32Array(buffer, Int32Array.BYTES_PER_ELEMENT);
+
+        let result;
+        Atomics.waitAsync(typedArray, 1, 0).value.then(value => (result = value));
+
+        expect(Atomics.notify(offsetArray, 1)).toBe(0);
+        expect(Atomics.notify(offsetArray, 0)).toBe(1);
+        runQueuedPromiseJobs();
+        expect(result).toBe("ok");
+    });
+
+    test("finite timeout", () => {
+        const buffer = new SharedArrayBuffer(4 * Int32Array.BYTES_PER_ELEMENT);
+        const typedArray = new Int32Array(buffer);
+
+        let result;
+        Atomics.waitAsync(typedArray, 0, 0, 10).value.then(value => (result = value));
+
+        runDueTimeoutJobs();
+        runQueuedPromiseJobs();
+        expect(result).toBeUndefined();
+
+        const start = Date.now();
+        while (Date.now() - start < 20) {}
+
+        runDueTimeoutJobs();
+        runQueuedPromiseJobs();
+        expect(result).toBe("timed-out");
+        expect(Atomics.notify(typedArray, 0)).toBe(0);
+    });
+
+    test("notified before the timeout", () => {
+        const buffer = new SharedArrayBuffer(4 * Int32Array.BYTES_PER_ELEMENT);
+        const typedArray = new Int32Array(buffer);
+
+        let result;
+        Atomics.waitAsync(typedArray, 0, 0, 10).value.then(value => (result = value));
+        expect(Atomics.notify(typedArray, 0)).toBe(1);
+
+        const start = Date.now();
+        while (Date.now() - start < 20) {}
+
+        runDueTimeoutJobs();
+        runQueuedPromiseJobs();
+        expect(result).toBe("ok");
+    });
+
+    test("waiters on a collected buffer are dropped", () => {
+        (() => {
+            const typedArray = new Int32Array(new SharedArrayBuffer(4 * Int32Array.BYTES_PER_ELEMENT));
+            Atomics.waitAsync(typedArray, 0, 0);
+        })();
+        gc();
+
+        const typedArray = new Int32Array(new SharedArrayBuffer(4 * Int32Array.BYTES_PER_ELEMENT));
+        expect(Atomics.notify(typedArray, 0)).toBe(0);
+    });
 });
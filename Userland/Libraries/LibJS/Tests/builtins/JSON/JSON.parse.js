@@ -30,6 +30,28 @@ test("syntax errors", () => {
         '{ "foo": "bar",}',
         '{ "foo": "bar", }',
         "",
+        "01",
+        "-01",
+        "1.",
+        ".5",
+        "+1",
+        "1e",
+        "1e+",
+        "-",
+        '"unterminated',
+        '"tab\tinside"',
+        '"\\x41"',
+        '"\\u12"',
+        '"\\u12G4"',
+        "[1 2]",
+        '{"a" 1}',
+        '{"a":1 "b":2}',
+        "{,}",
+        "[,]",
+        "tru",
+        "nul",
+        "[1]]",
+        "{}}",
     ].forEach(test => {
         expect(() => {
             JSON.parse(test);
@@ -74,3 +96,57 @@ test("does not truncate large integers", () => {
     expect(JSON.parse("18446744073709551616")).toEqual(18446744073709551616);
     expect(JSON.parse("18446744073709551617")).toEqual(18446744073709551617);
 });
+
+test("integers around the i32 range", () => {
+    expect(JSON.parse("-2147483648")).toBe(-2147483648);
+    expect(JSON.parse("-2147483649")).toBe(-2147483649);
+    expect(JSON.parse("-9007199254740993")).toBe(-9007199254740993);
+    expect(JSON.parse("[2147483647, 2147483648, -2147483649]")).toEqual([2147483647, 2147483648, -2147483649]);
+});
+
+test("numbers with fractions and exponents", () => {
+    expect(JSON.parse("1.5")).toBe(1.5);
+    expect(JSON.parse("-1.5")).toBe(-1.5);
+    expect(JSON.parse("1e3")).toBe(1000);
+    expect(JSON.parse("1E+3")).toBe(1000);
+    expect(JSON.parse("25e-1")).toBe(2.5);
+    expect(JSON.parse("1.0")).toBe(1);
+    expect(Object.is(JSON.parse("-0e5"), -0)).toBeTrue();
+});
+
+test("strings with escapes", () => {
+    expect(JSON.parse('"\\"\\\\\\/\\b\\f\\n\\r\\t"')).toBe('"\\/\b\f\n\r\t');
+    expect(JSON.parse('"\\u0041\\u00e9\\u4e2d"')).toBe("A\u00e9\u4e2d");
+    expect(JSON.parse('"before\\nafter"')).toBe("before\nafter");
+    expect(JSON.parse('""')).toBe("");
+    expect(JSON.parse('"caf\u00e9"')).toBe("caf\u00e9");
+});
+
+test("nested objects and arrays", () => {
+    const result = JSON.parse(' { "a" : [ 1 , { "b" : [ ] , "c" : { } } , null ] , "d" : "e" } ');
+    expect(result).toEqual({ a: [1, { b: [], c: {} }, null], d: "e" });
+    expect(Array.isArray(result.a)).toBeTrue();
+    expect(Object.getPrototypeOf(result)).toBe(Object.prototype);
+    expect(Object.getPrototypeOf(result.a)).toBe(Array.prototype);
+    expect(result.a).toHaveLength(3);
+});
+
+test("duplicate keys keep the last value", () => {
+    const result = JSON.parse('{"a":1,"b":2,"a":3}');
+    expect(result.a).toBe(3);
+    expect(Object.keys(result)).toEqual(["a", "b"]);
+});
+
+test("__proto__ is an own property", () => {
+    const result = JSON.parse('{"__proto__":{"polluted":true}}');
+    expect(Object.getPrototypeOf(result)).toBe(Object.prototype);
+    expect(Object.hasOwn(result, "__proto__")).toBeTrue();
+    expect({}.polluted).toBeUndefined();
+});
+
+test("deeply nested arrays", () => {
+    const depth = 1000;
+    let value = JSON.parse("[".repeat(depth) + "]".repeat(depth));
+    for (let i = 1; i < depth; ++i) value = value[0];
+    expect(value).toEqual([]);
+});
@@ -13,6 +13,16 @@ test("basic functionality", () => {
     expect(map).toHaveSize(2);
 });
 
+test("-0 and +0 are the same key", () => {
+    const map = new Map([[0, "a"]]);
+    expect(map.delete(-0)).toBeTrue();
+    expect(map).toHaveSize(0);
+
+    map.set(-0, "b");
+    expect(map.delete(0)).toBeTrue();
+    expect(map).toHaveSize(0);
+});
+
 describe("modification with active iterators", () => {
     test("deleted element is skipped", () => {
         const map = new Map([
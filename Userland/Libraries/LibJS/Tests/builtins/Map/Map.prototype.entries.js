@@ -17,3 +17,53 @@ test("basic functionality", () => {
     expect(it.next()).toEqual({ value: undefined, done: true });
     expect(it.next()).toEqual({ value: undefined, done: true });
 });
+
+test("iteration continues correctly while the map is modified", () => {
+    const map = new Map();
+    for (let i = 0; i < 100; ++i) map.set(i, i * 2);
+
+    const it = map.entries();
+    expect(it.next()).toEqual({ value: [0, 0], done: false });
+
+    // Removing most entries compacts the map, the iterator must still end up right after the entry it last returned.
+    for (let i = 0; i < 90; ++i) map.delete(i);
+    map.set(1000, "end");
+    expect(it.next()).toEqual({ value: [90, 180], done: false });
+
+    const keys = [];
+    for (let result = it.next(); !result.done; result = it.next()) keys.push(result.value[0]);
+    expect(keys).toEqual([91, 92, 93, 94, 95, 96, 97, 98, 99, 1000]);
+});
+
+test("entries added after clearing are visited", () => {
+    const map = new Map([
+        ["a", 1],
+        ["b", 2],
+    ]);
+    const it = map.keys();
+    expect(it.next()).toEqual({ value: "a", done: false });
+    map.clear();
+    map.set("c", 3);
+    expect(it.next()).toEqual({ value: "c", done: false });
+    expect(it.next()).toEqual({ value: undefined, done: true });
+});
+
+test("keys of different types and string representations", () => {
+    const map = new Map();
+    const object = {};
+    map.set(1, "int");
+    map.set(1.5, "double");
+    map.set("1", "string");
+    map.set("ab" + "cd".repeat(20), "rope");
+    map.set(object, "object");
+    map.set(NaN, "nan");
+    map.set(-0, "zero");
+    expect(map.get(1.0)).toBe("int");
+    expect(map.get(1.5)).toBe("double");
+    expect(map.get(String(1))).toBe("string");
+    expect(map.get("abcdcdcdcdcdcdcdcdcdcdcdcdcdcdcdcdcdcdcdcd")).toBe("rope");
+    expect(map.get(object)).toBe("object");
+    expect(map.get(0 / 0)).toBe("nan");
+    expect(map.get(0)).toBe("zero");
+    expect(map.size).toBe(7);
+});
@@ -53,4 +53,45 @@ describe("normal behavior", () => {
             expect(map).toBe(a);
         });
     });
+
+    test("deleting the current entry does not skip the next one", () => {
+        const map = new Map([
+            ["a", 0],
+            ["b", 1],
+            ["c", 2],
+        ]);
+        const visited = [];
+        map.forEach((value, key) => {
+            visited.push(key);
+            expect(map.delete(key)).toBeTrue();
+        });
+        expect(visited).toEqual(["a", "b", "c"]);
+        expect(map).toHaveSize(0);
+    });
+
+    test("deleting the current entry while the map shrinks does not skip the next one", () => {
+        const map = new Map();
+        for (let i = 0; i < 100; ++i) map.set(i, i);
+        const visited = [];
+        map.forEach((value, key) => {
+            visited.push(key);
+            map.delete(key);
+        });
+        expect(visited).toHaveLength(100);
+        expect(visited[99]).toBe(99);
+    });
+
+    test("deleting the current entry in a for..of loop does not skip the next one", () => {
+        const map = new Map([
+            ["a", 0],
+            ["b", 1],
+            ["c", 2],
+        ]);
+        const visited = [];
+        for (const [key] of map) {
+            visited.push(key);
+            map.delete(key);
+        }
+        expect(visited).toEqual(["a", "b", "c"]);
+    });
 });
@@ -18,3 +18,13 @@ test("NaN differentiation", () => {
     expect(map.get(0 * Infinity)).toBe("a");
     expect(map.get(Infinity - Infinity)).toBe("a");
 });
+
+test("-0 and +0 are the same key", () => {
+    const map = new Map();
+    map.set(0, "a");
+    expect(map.get(-0)).toBe("a");
+
+    map.set(-0, "b");
+    expect(map.get(0)).toBe("b");
+    expect(map).toHaveSize(1);
+});
@@ -15,3 +15,8 @@ test("basic functionality", () => {
     expect(map.has(1)).toBeTrue();
     expect(map.has("serenity")).toBeFalse();
 });
+
+test("-0 and +0 are the same key", () => {
+    expect(new Map([[0, "a"]]).has(-0)).toBeTrue();
+    expect(new Map([[-0, "a"]]).has(0)).toBeTrue();
+});
@@ -13,6 +13,29 @@ describe("correct behavior", () => {
     test("length", () => {
         expect(Number.prototype.toLocaleString).toHaveLength(0);
     });
+
+    test("repeated calls with different locales and options", () => {
+        for (let i = 0; i < 3; ++i) {
+            expect((1234).toLocaleString()).toBe("1,234");
+            expect((1234).toLocaleString("en")).toBe("1,234");
+            expect((1234).toLocaleString("de")).toBe("1.234");
+            expect((1234).toLocaleString("en", { useGrouping: false })).toBe("1234");
+        }
+    });
+
+    test("options are read on every call", () => {
+        let reads = 0;
+        const options = {
+            get style() {
+                ++reads;
+                return "decimal";
+            },
+        };
+
+        (1).toLocaleString("en", options);
+        (1).toLocaleString("en", options);
+        expect(reads).toBe(2);
+    });
 });
 
 describe("special values", () => {
@@ -8,3 +8,9 @@ test("basic functionality", () => {
     expect(set.delete("b")).toBeFalse();
     expect(set).toHaveSize(2);
 });
+
+test("-0 and +0 are the same value", () => {
+    const set = new Set([0]);
+    expect(set.delete(-0)).toBeTrue();
+    expect(set).toHaveSize(0);
+});
@@ -148,4 +148,25 @@ describe("modification during iteration", () => {
         expect(set).toHaveSize(2);
         expect(visited).toEqual([1, 2, 1, 2, 1]);
     });
+
+    test("deleting the current item does not skip the next one", () => {
+        const set = new Set([1, 2, 3]);
+        const visited = [];
+        set.forEach(val => {
+            visited.push(val);
+            expect(set.delete(val)).toBeTrue();
+        });
+        expect(visited).toEqual([1, 2, 3]);
+        expect(set).toHaveSize(0);
+    });
+
+    test("deleting the current item in a for..of loop does not skip the next one", () => {
+        const set = new Set([1, 2, 3]);
+        const visited = [];
+        for (const val of set) {
+            visited.push(val);
+            set.delete(val);
+        }
+        expect(visited).toEqual([1, 2, 3]);
+    });
 });
@@ -20,3 +20,8 @@ test("NaN differentiation", () => {
     expect(set.has(0 * Infinity)).toBeTrue();
     expect(set.has(Infinity - Infinity)).toBeTrue();
 });
+
+test("-0 and +0 are the same value", () => {
+    expect(new Set([0]).has(-0)).toBeTrue();
+    expect(new Set([-0]).has(0)).toBeTrue();
+});
@@ -37,3 +37,18 @@ test("UTF-16", () => {
     expect(s.localeCompare("\ud83d") > 0);
     expect(s.localeCompare("😀😀s") < 0);
 });
+
+test("sorting with many comparisons", () => {
+    const words = [];
+    for (let i = 0; i < 500; ++i) {
+        words.push(`word${(i * 7919) % 500}`);
+    }
+
+    const sorted = [...words].sort((a, b) => a.localeCompare(b));
+    for (let i = 1; i < sorted.length; ++i) {
+        expect(sorted[i - 1].localeCompare(sorted[i]) <= 0).toBeTrue();
+    }
+
+    expect("a".localeCompare("b", "en")).toBeLessThan(0);
+    expect("b".localeCompare("a", "de")).toBeGreaterThan(0);
+});
@@ -0,0 +1,77 @@
+// These exercise the jump threading and self-move elimination done while linking bytecode.
+
+test("assigning a variable to itself keeps its value", () => {
+    let a = 1;
+    a = a;
+    expect(a).toBe(1);
+
+    let b = { value: 2 };
+    for (let i = 0; i < 3; ++i) {
+        b = b;
+        b.value += i;
+    }
+    expect(b.value).toBe(5);
+});
+
+test("jumps through jump-only blocks reach the right place", () => {
+    const visited = [];
+    outer: for (let i = 0; i < 3; ++i) {
+        for (let j = 0; j < 3; ++j) {
+            if (j === 1) continue outer;
+            if (i === 2) break outer;
+            visited.push(`${i}${j}`);
+        }
+    }
+    expect(visited).toEqual(["00", "10"]);
+
+    let count = 0;
+    for (;;) {
+        if (count++ < 5) {
+        } else {
+            break;
+        }
+    }
+    expect(count).toBe(6);
+
+    function classify(value) {
+        switch (value) {
+            case 1:
+            case 2:
+                break;
+            default:
+                if (value > 10) {
+                } else {
+                    return "small";
+                }
+        }
+        return value > 10 ? "large" : "one or two";
+    }
+    expect(classify(1)).toBe("one or two");
+    expect(classify(5)).toBe("small");
+    expect(classify(50)).toBe("large");
+});
+
+test("source positions after threaded jumps and dropped moves", () => {
+    function throwAfterLoops() {
+        let x = 0;
+        while (x < 4) {
+            if (x % 2) {
+            } else {
+            }
+            x = x;
+            ++x;
+        }
+        throw new Error();
+    }
+
+    let error;
+    try {
+        throwAfterLoops();
+    } catch (e) {
+        error = e;
+    }
+
+    // The frame must point at the `throw new Error()` line above, not at a dropped or threaded instruction.
+    const frame = error.stack.split("\n").find(line => line.includes("throwAfterLoops"));
+    expect(!!frame.match(/^    at throwAfterLoops \(.+\/bytecode-optimizations\.js:64:\d+\)$/)).toBeTrue();
+});
@@ -0,0 +1,39 @@
+test("named function expressions can refer to themselves", () => {
+    const factorial = function f(n) {
+        return n <= 1 ? 1 : n * f(n - 1);
+    };
+    expect(factorial(5)).toBe(120);
+});
+
+test("own name is visible from nested functions", () => {
+    const outer = function f() {
+        return () => () => f;
+    };
+    expect(outer()()()).toBe(outer);
+});
+
+test("own name is visible through direct eval", () => {
+    const outer = function f() {
+        return (() => eval("f"))();
+    };
+    expect(outer()).toBe(outer);
+});
+
+test("own name is visible from functions in catch parameters", () => {
+    const outer = function f() {
+        try {
+            throw {};
+        } catch ({ value = (() => f)() }) {
+            return value;
+        }
+    };
+    expect(outer()).toBe(outer);
+});
+
+test("own name is immutable", () => {
+    const outer = function f() {
+        "use strict";
+        f = 1;
+    };
+    expect(outer).toThrowWithMessage(TypeError, "Invalid assignment to const variable");
+});
@@ -257,4 +257,8 @@ describe("scoping in modules", () => {
     test("functions within functions", () => {
         expectModulePassed("./function-in-function.mjs");
     });
+
+    test("module bindings read repeatedly from functions", () => {
+        expectModulePassed("./repeated-module-binding-access.mjs");
+    });
 });
@@ -0,0 +1,35 @@
+import { passed as importedPassed } from "./single-const-export.mjs";
+
+let counter = 0;
+const step = 2;
+
+function increment() {
+    counter += step;
+    return counter;
+}
+
+function readBeforeInitialization() {
+    try {
+        return lateBinding;
+    } catch (error) {
+        return error instanceof ReferenceError;
+    }
+}
+
+const threwBeforeInitialization = readBeforeInitialization();
+let lateBinding = "initialized";
+
+let sum = 0;
+for (let i = 0; i < 100; ++i) sum += increment();
+
+let importsSeen = 0;
+for (let i = 0; i < 100; ++i) {
+    if (importedPassed) ++importsSeen;
+}
+
+export const passed =
+    counter === 200 &&
+    sum === 10100 &&
+    importsSeen === 100 &&
+    threwBeforeInitialization === true &&
+    readBeforeInitialization() === "initialized";
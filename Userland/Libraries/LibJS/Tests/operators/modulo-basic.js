@@ -37,3 +37,21 @@ test("basic functionality", () => {
     expect(undefined % undefined).toBeNaN();
     expect(null % null).toBeNaN();
 });
+
+test("int32 operands", () => {
+    const values = [0, 1, 7, 2147483647, -1, -7, -2147483648];
+    const expected = [
+        [NaN, 0, 0, 0, 0, 0, 0],
+        [NaN, 0, 1, 1, 0, 1, 1],
+        [NaN, 0, 0, 7, 0, 0, 7],
+        [NaN, 0, 1, 0, 0, 1, 2147483647],
+        [NaN, -0, -1, -1, -0, -1, -1],
+        [NaN, -0, -0, -7, -0, -0, -7],
+        [NaN, -0, -2, -1, -0, -2, -0],
+    ];
+    for (let i = 0; i < values.length; ++i) {
+        for (let j = 0; j < values.length; ++j) {
+            expect(values[i] % values[j]).toBe(expected[i][j]);
+        }
+    }
+});
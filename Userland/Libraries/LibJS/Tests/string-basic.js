@@ -298,3 +298,18 @@ test("string object: string property name access", () => {
     expect(lastSetThisValue).toBeNull();
     lastSetThisValue = null;
 });
+
+test("long chains of concatenations", () => {
+    let str = "";
+    for (let i = 0; i < 10000; ++i) str += "ab";
+    expect(str).toHaveLength(20000);
+    expect(str.startsWith("abab")).toBeTrue();
+    expect(str.endsWith("abab")).toBeTrue();
+
+    let utf16 = "";
+    for (let i = 0; i < 1000; ++i) utf16 += "\ud83d" + "\ude00";
+    expect(utf16).toHaveLength(2000);
+    expect(utf16.codePointAt(0)).toBe(0x1f600);
+    expect(utf16.codePointAt(1998)).toBe(0x1f600);
+    expect(utf16 === "😀".repeat(1000)).toBeTrue();
+});
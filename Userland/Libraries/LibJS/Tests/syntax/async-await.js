@@ -292,3 +292,46 @@ describe("await observably looks up constructor of Promise objects", () => {
     runQueuedPromiseJobs();
     expect(calls).toBe(4);
 });
+
+describe("await interleaves with other promise jobs in spec order", () => {
+    test("awaiting primitives and promises", () => {
+        const log = [];
+        async function a() {
+            log.push("a1");
+            await 1;
+            log.push("a2");
+            await Promise.resolve(2);
+            log.push("a3");
+        }
+        async function b() {
+            log.push("b1");
+            await undefined;
+            log.push("b2");
+            await null;
+            log.push("b3");
+        }
+        a();
+        b();
+        Promise.resolve().then(() => log.push("then1")).then(() => log.push("then2"));
+        runQueuedPromiseJobs();
+        expect(log).toEqual(["a1", "b1", "a2", "b2", "then1", "a3", "b3", "then2"]);
+    });
+
+    test("many awaits in a row and a rejection", () => {
+        let result;
+        async function f() {
+            let sum = 0;
+            for (let i = 0; i < 1000; ++i) sum += await i;
+            try {
+                await Promise.reject(sum);
+            } catch (e) {
+                return e + 1;
+            }
+        }
+        f().then(value => {
+            result = value;
+        });
+        runQueuedPromiseJobs();
+        expect(result).toBe(499501);
+    });
+});
@@ -25,6 +25,20 @@ describe("correct behavior", () => {
         expect(b).toBe(0);
     });
 
+    test("updates at the edges of the int32 range", () => {
+        let n = -2147483648;
+        expect(--n).toBe(-2147483649);
+        expect(n).toBe(-2147483649);
+
+        n = -2147483648;
+        expect(n--).toBe(-2147483648);
+        expect(n).toBe(-2147483649);
+
+        n = 2147483647;
+        expect(++n).toBe(2147483648);
+        expect(n).toBe(2147483648);
+    });
+
     test("updates that produce NaN", () => {
         let s = "foo";
         expect(++s).toBeNaN();
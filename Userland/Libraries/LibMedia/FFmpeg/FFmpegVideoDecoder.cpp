@@ -12,8 +12,55 @@
 
 namespace Media::FFmpeg {
 
-static AVPixelFormat negotiate_output_format(AVCodecContext*, AVPixelFormat const* formats)
+#if defined(AK_OS_MACOS)
+static constexpr AVHWDeviceType preferred_hardware_device_type = AV_HWDEVICE_TYPE_VIDEOTOOLBOX;
+#elif defined(AK_OS_LINUX)
+static constexpr AVHWDeviceType preferred_hardware_device_type = AV_HWDEVICE_TYPE_VAAPI;
+#else
+static constexpr AVHWDeviceType preferred_hardware_device_type = AV_HWDEVICE_TYPE_NONE;
+#endif
+
+static bool is_hardware_pixel_format(AVPixelFormat format)
 {
+    return format == AV_PIX_FMT_VAAPI || format == AV_PIX_FMT_VIDEOTOOLBOX;
+}
+
+// Tries to make FFmpeg decode on the GPU. FFmpeg falls back to software decoding by itself if the hardware decoder
+// turns out not to support the stream, so failing here only means we never try.
+static void set_up_hardware_decoding(AVCodec const& codec, AVCodecContext& codec_context)
+{
+    if (preferred_hardware_device_type == AV_HWDEVICE_TYPE_NONE)
+        return;
+
+    for (int i = 0;; i++) {
+        auto const* config = avcodec_get_hw_config(&codec, i);
+        if (!config)
+            return;
+        if ((config->methods & AV_CODEC_HW_CONFIG_METHOD_HW_DEVICE_CTX) == 0 || config->device_type != preferred_hardware_device_type)
+            continue;
+
+        AVBufferRef* device_context = nullptr;
+        if (av_hwdevice_ctx_create(&device_context, preferred_hardware_device_type, nullptr, nullptr, 0) < 0) {
+            dbgln("FFmpegVideoDecoder: Failed to create a {} device, decoding in software", av_hwdevice_get_type_name(preferred_hardware_device_type));
+            return;
+        }
+
+        // NOTE: The codec context takes over our reference to the device.
+        codec_context.hw_device_ctx = device_context;
+        return;
+    }
+}
+
+static AVPixelFormat negotiate_output_format(AVCodecContext* codec_context, AVPixelFormat const* formats)
+{
+    // The formats are in order of preference, and FFmpeg lists the hardware ones first.
+    if (codec_context->hw_device_ctx) {
+        for (auto const* format = formats; *format >= 0; format++) {
+            if (is_hardware_pixel_format(*format))
+                return *format;
+        }
+    }
+
     while (*formats >= 0) {
         switch (*formats) {
         case AV_PIX_FMT_YUV420P:
@@ -57,6 +104,7 @@ DecoderErrorOr<NonnullOwnPtr<FFmpegVideoDecoder>> FFmpegVideoDecoder::try_create
         return DecoderError::format(DecoderErrorCategory::Memory, "Failed to allocate FFmpeg codec context for codec {}", codec_id);
 
     codec_context->get_format = negotiate_output_format;
+    set_up_hardware_decoding(*codec, *codec_context);
 
     codec_context->thread_count = static_cast<int>(min(Core::System::hardware_concurrency(), 4));
 
@@ -98,6 +146,7 @@ FFmpegVideoDecoder::~FFmpegVideoDecoder()
 {
     av_packet_free(&m_packet);
     av_frame_free(&m_frame);
+    av_frame_free(&m_hardware_transfer_frame);
     avcodec_free_context(&m_codec_context);
 }
 
@@ -148,15 +197,21 @@ DecoderErrorOr<NonnullOwnPtr<VideoFrame>> FFmpegVideoDecoder::get_decoded_frame(
         }();
         auto cicp = CodingIndependentCodePoints { color_primaries, transfer_characteristics, matrix_coefficients, color_range };
 
+        AVFrame const* pixels = m_frame;
+        if (is_hardware_pixel_format(static_cast<AVPixelFormat>(m_frame->format)))
+            pixels = TRY(download_hardware_frame());
+
         size_t bit_depth = [&] {
-            switch (m_frame->format) {
+            switch (pixels->format) {
             case AV_PIX_FMT_YUV420P:
             case AV_PIX_FMT_YUV422P:
             case AV_PIX_FMT_YUV444P:
+            case AV_PIX_FMT_NV12:
                 return 8;
             case AV_PIX_FMT_YUV420P10:
             case AV_PIX_FMT_YUV422P10:
             case AV_PIX_FMT_YUV444P10:
+            case AV_PIX_FMT_P010:
                 return 10;
             case AV_PIX_FMT_YUV420P12:
             case AV_PIX_FMT_YUV422P12:
@@ -168,10 +223,12 @@ DecoderErrorOr<NonnullOwnPtr<VideoFrame>> FFmpegVideoDecoder::get_decoded_frame(
         size_t component_size = (bit_depth + 7) / 8;
 
         auto subsampling = [&]() -> Subsampling {
-            switch (m_frame->format) {
+            switch (pixels->format) {
             case AV_PIX_FMT_YUV420P:
             case AV_PIX_FMT_YUV420P10:
             case AV_PIX_FMT_YUV420P12:
+            case AV_PIX_FMT_NV12:
+            case AV_PIX_FMT_P010:
                 return { true, true };
             case AV_PIX_FMT_YUV422P:
             case AV_PIX_FMT_YUV422P10:
@@ -192,25 +249,65 @@ DecoderErrorOr<NonnullOwnPtr<VideoFrame>> FFmpegVideoDecoder::get_decoded_frame(
         auto timestamp = Duration::from_microseconds(m_frame->pts);
         auto frame = DECODER_TRY_ALLOC(SubsampledYUVFrame::try_create(timestamp, size, bit_depth, cicp, subsampling));
 
-        for (u32 plane = 0; plane < 3; plane++) {
-            VERIFY(m_frame->linesize[plane] != 0);
-            if (m_frame->linesize[plane] < 0)
+        bool const is_semi_planar = pixels->format == AV_PIX_FMT_NV12 || pixels->format == AV_PIX_FMT_P010;
+        for (u32 plane = 0; plane < (is_semi_planar ? 2 : 3); plane++) {
+            VERIFY(pixels->linesize[plane] != 0);
+            if (pixels->linesize[plane] < 0)
                 return DecoderError::with_description(DecoderErrorCategory::NotImplemented, "Reversed scanlines are not supported"sv);
+        }
+
+        if (is_semi_planar) {
+            // Hardware decoders hand out the chroma samples interleaved in a single plane, and P010 keeps its 10 bits
+            // in the high bits of each component, so these are split up and shifted into the layout we use.
+            auto copy_semi_planar_frame = [&]<typename T>(T const shift) {
+                auto chroma_size = subsampling.subsampled_size(size).to_type<size_t>();
+
+                auto const* y_source = pixels->data[0];
+                auto* y_destination = frame->get_plane_data<T>(0);
+                for (size_t row = 0; row < size.height(); row++) {
+                    auto const* source_row = reinterpret_cast<T const*>(y_source);
+                    for (size_t column = 0; column < size.width(); column++)
+                        y_destination[column] = source_row[column] >> shift;
+                    y_source += pixels->linesize[0];
+                    y_destination += size.width();
+                }
+
+                auto const* chroma_source = pixels->data[1];
+                auto* u_destination = frame->get_plane_data<T>(1);
+                auto* v_destination = frame->get_plane_data<T>(2);
+                for (size_t row = 0; row < chroma_size.height(); row++) {
+                    auto const* source_row = reinterpret_cast<T const*>(chroma_source);
+                    for (size_t column = 0; column < chroma_size.width(); column++) {
+                        u_destination[column] = source_row[column * 2] >> shift;
+                        v_destination[column] = source_row[column * 2 + 1] >> shift;
+                    }
+                    chroma_source += pixels->linesize[1];
+                    u_destination += chroma_size.width();
+                    v_destination += chroma_size.width();
+                }
+            };
+            if (pixels->format == AV_PIX_FMT_P010)
+                copy_semi_planar_frame(static_cast<u16>(16 - bit_depth));
+            else
+                copy_semi_planar_frame(static_cast<u8>(0));
+            return frame;
+        }
 
+        for (u32 plane = 0; plane < 3; plane++) {
             bool const use_subsampling = plane > 0;
             auto plane_size = (use_subsampling ? subsampling.subsampled_size(size) : size).to_type<size_t>();
 
             auto output_line_size = plane_size.width() * component_size;
-            VERIFY(output_line_size <= static_cast<size_t>(m_frame->linesize[plane]));
+            VERIFY(output_line_size <= static_cast<size_t>(pixels->linesize[plane]));
 
-            auto const* source = m_frame->data[plane];
+            auto const* source = pixels->data[plane];
             VERIFY(source != nullptr);
             auto* destination = frame->get_raw_plane_data(plane);
             VERIFY(destination != nullptr);
 
             for (size_t row = 0; row < plane_size.height(); row++) {
                 memcpy(destination, source, output_line_size);
-                source += m_frame->linesize[plane];
+                source += pixels->linesize[plane];
                 destination += output_line_size;
             }
         }
@@ -228,6 +325,30 @@ DecoderErrorOr<NonnullOwnPtr<VideoFrame>> FFmpegVideoDecoder::get_decoded_frame(
     }
 }
 
+DecoderErrorOr<AVFrame*> FFmpegVideoDecoder::download_hardware_frame()
+{
+    if (!m_hardware_transfer_frame) {
+        m_hardware_transfer_frame = av_frame_alloc();
+        if (!m_hardware_transfer_frame)
+            return DecoderError::with_description(DecoderErrorCategory::Memory, "Failed to allocate FFmpeg frame"sv);
+    }
+
+    av_frame_unref(m_hardware_transfer_frame);
+
+    // NOTE: Leaving the format unset lets FFmpeg pick the one the device can transfer fastest, typically NV12 or P010.
+    if (av_hwframe_transfer_data(m_hardware_transfer_frame, m_frame, 0) < 0)
+        return DecoderError::with_description(DecoderErrorCategory::Unknown, "Failed to download a hardware decoded frame"sv);
+
+    switch (m_hardware_transfer_frame->format) {
+    case AV_PIX_FMT_NV12:
+    case AV_PIX_FMT_P010:
+    case AV_PIX_FMT_YUV420P:
+        return m_hardware_transfer_frame;
+    default:
+        return DecoderError::format(DecoderErrorCategory::NotImplemented, "Hardware decoded frames in FFmpeg pixel format {} are not supported", m_hardware_transfer_frame->format);
+    }
+}
+
 void FFmpegVideoDecoder::flush()
 {
     avcodec_flush_buffers(m_codec_context);
@@ -26,10 +26,14 @@ public:
 
 private:
     DecoderErrorOr<void> decode_single_sample(Duration timestamp, u8* data, int size);
+    DecoderErrorOr<AVFrame*> download_hardware_frame();
 
     AVCodecContext* m_codec_context;
     AVPacket* m_packet;
     AVFrame* m_frame;
+
+    // Frames decoded in hardware live in GPU memory, and are downloaded into this one before we convert them.
+    AVFrame* m_hardware_transfer_frame { nullptr };
 };
 
 }
@@ -146,6 +146,7 @@ bool PlaybackManager::dispatch_frame_queue_item(FrameQueueItem&& item)
     }
 
     dbgln_if(PLAYBACK_MANAGER_DEBUG, "Sent frame for presentation with timestamp {}ms, late by {}ms", item.timestamp().to_milliseconds(), (current_playback_time() - item.timestamp()).to_milliseconds());
+    m_last_presented_timestamp_in_microseconds.store(item.timestamp().to_microseconds());
     dispatch_new_frame(item.bitmap());
     return false;
 }
@@ -196,15 +197,40 @@ void PlaybackManager::restart_playback()
     seek_to_timestamp(Duration::zero());
 }
 
+void PlaybackManager::update_target_buffered_frame_count(Duration decode_time, Duration frame_timestamp)
+{
+    // Keep exponential moving averages of the measurements, so that a single slow frame doesn't grow the buffer.
+    auto update_average = [](i64& average, i64 measurement) {
+        if (average == 0)
+            average = measurement;
+        else
+            average += (measurement - average) / 8;
+    };
+
+    update_average(m_average_decode_time_in_microseconds, decode_time.to_microseconds());
+    if (m_last_decoded_timestamp.has_value() && frame_timestamp > m_last_decoded_timestamp.value())
+        update_average(m_average_frame_interval_in_microseconds, (frame_timestamp - m_last_decoded_timestamp.value()).to_microseconds());
+    m_last_decoded_timestamp = frame_timestamp;
+
+    if (m_average_frame_interval_in_microseconds <= 0)
+        return;
+
+    // Queue enough frames to cover four times the average decode time, so that a few slow frames in a row
+    // can be absorbed before playback has to stop and buffer.
+    auto frames_to_cover_decoding = static_cast<size_t>(ceil_div(4 * m_average_decode_time_in_microseconds, m_average_frame_interval_in_microseconds));
+    m_target_buffered_frame_count = clamp(minimum_buffered_frame_count + frames_to_cover_decoding, minimum_buffered_frame_count, maximum_buffered_frame_count);
+}
+
 void PlaybackManager::decode_and_queue_one_sample()
 {
-#if PLAYBACK_MANAGER_DEBUG
     auto start_time = MonotonicTime::now();
-#endif
 
     FrameQueueItem item_to_enqueue;
 
     while (item_to_enqueue.is_empty()) {
+        if (m_stop_decoding.load())
+            return;
+
         OwnPtr<VideoFrame> decoded_frame = nullptr;
         CodingIndependentCodePoints container_cicp;
 
@@ -244,6 +270,15 @@ void PlaybackManager::decode_and_queue_one_sample()
             }
         }
 
+        // The playback side would skip a frame older than the one it last presented, so drop it before spending
+        // time on converting it for display.
+        if (decoded_frame != nullptr && decoded_frame->timestamp().to_microseconds() < m_last_presented_timestamp_in_microseconds.load()) {
+            dbgln_if(PLAYBACK_MANAGER_DEBUG, "Media Decoder: Dropping frame at {}ms, playback is already past it", decoded_frame->timestamp().to_milliseconds());
+            m_skipped_frames++;
+            start_time = MonotonicTime::now();
+            continue;
+        }
+
         // Convert the frame for display.
         if (decoded_frame != nullptr) {
             auto& cicp = decoded_frame->cicp();
@@ -276,9 +311,10 @@ void PlaybackManager::decode_and_queue_one_sample()
     }
 
     VERIFY(!item_to_enqueue.is_empty());
-#if PLAYBACK_MANAGER_DEBUG
-    dbgln("Media Decoder: Sample at {}ms took {}ms to decode, queue contains ~{} items", item_to_enqueue.timestamp().to_milliseconds(), (MonotonicTime::now() - start_time).to_milliseconds(), m_frame_queue.weak_used());
-#endif
+    auto decode_time = MonotonicTime::now() - start_time;
+    if (!item_to_enqueue.is_error())
+        update_target_buffered_frame_count(decode_time, item_to_enqueue.timestamp());
+    dbgln_if(PLAYBACK_MANAGER_DEBUG, "Media Decoder: Sample at {}ms took {}ms to decode, queue contains ~{} of {} items", item_to_enqueue.timestamp().to_milliseconds(), decode_time.to_milliseconds(), m_frame_queue.weak_used(), m_target_buffered_frame_count);
 
     auto wait = [&] {
         auto wait_locker = Threading::MutexLocker(m_decode_wait_mutex);
@@ -287,7 +323,9 @@ void PlaybackManager::decode_and_queue_one_sample()
 
     bool had_error = item_to_enqueue.is_error();
     while (true) {
-        if (m_frame_queue.can_enqueue()) {
+        // The consumer may dequeue concurrently, so weak_used() can only overestimate the number of queued frames.
+        // In that case, we will be woken up by the dequeue.
+        if (m_frame_queue.weak_used() < m_target_buffered_frame_count && m_frame_queue.can_enqueue()) {
             MUST(m_frame_queue.enqueue(move(item_to_enqueue)));
             break;
         }
@@ -601,6 +639,9 @@ private:
                 while (manager().dequeue_one_frame().has_value()) { }
                 manager().m_next_frame.clear();
                 manager().m_last_present_in_media_time = keyframe_timestamp.value();
+                // This is done while the decoder is locked, so that no frame from after the keyframe is dropped for
+                // being older than a frame presented before the seek.
+                manager().m_last_presented_timestamp_in_microseconds.store(keyframe_timestamp->to_microseconds());
             } else if (m_target_timestamp >= manager().m_last_present_in_media_time && manager().m_next_frame.has_value() && manager().m_next_frame.value().timestamp() > m_target_timestamp) {
                 dbgln_if(PLAYBACK_MANAGER_DEBUG, "Target timestamp is between the last presented frame and the next frame, exiting seek at {}ms", m_target_timestamp.to_milliseconds());
                 manager().m_last_present_in_media_time = m_target_timestamp;
@@ -88,7 +88,12 @@ private:
     Duration m_timestamp { no_timestamp };
 };
 
-static constexpr size_t frame_buffer_count = 4;
+// This is the capacity of the queue, the decode thread only fills it up to PlaybackManager's target buffered frame count,
+// which is adjusted based on how long frames take to decode.
+static constexpr size_t frame_buffer_count = 16;
+static constexpr size_t minimum_buffered_frame_count = 2;
+// One slot in the queue always stays empty to distinguish a full queue from an empty one.
+static constexpr size_t maximum_buffered_frame_count = frame_buffer_count - 1;
 using VideoFrameQueue = Core::SharedSingleProducerCircularQueue<FrameQueueItem, frame_buffer_count>;
 
 enum class PlaybackState {
@@ -165,6 +170,7 @@ private:
     void set_state_update_timer(int delay_ms);
 
     void decode_and_queue_one_sample();
+    void update_target_buffered_frame_count(Duration decode_time, Duration frame_timestamp);
 
     void dispatch_decoder_error(DecoderError error);
     void dispatch_new_frame(RefPtr<Gfx::Bitmap> frame);
@@ -191,10 +197,20 @@ private:
     Threading::ConditionVariable m_decode_wait_condition;
     Atomic<bool> m_buffer_is_full { false };
 
+    // These are only accessed by the decode thread.
+    i64 m_average_decode_time_in_microseconds { 0 };
+    i64 m_average_frame_interval_in_microseconds { 0 };
+    Optional<Duration> m_last_decoded_timestamp;
+    size_t m_target_buffered_frame_count { 4 };
+
+    // The timestamp of the last frame sent for presentation. The decode thread drops any frame older than this, since
+    // it would only be skipped once it is dequeued.
+    Atomic<i64> m_last_presented_timestamp_in_microseconds { NumericLimits<i64>::min() };
+
     OwnPtr<PlaybackStateHandler> m_playback_handler;
     Optional<FrameQueueItem> m_next_frame;
 
-    u64 m_skipped_frames { 0 };
+    Atomic<u64> m_skipped_frames { 0 };
 
     // This is a nested class to allow private access.
     class PlaybackStateHandler {
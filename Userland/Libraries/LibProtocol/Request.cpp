@@ -9,6 +9,9 @@
 
 namespace Protocol {
 
+// We don't want a bogus Content-Length to make us allocate more memory up front than a real response is likely to need.
+static constexpr u64 max_preallocated_payload_size = 256 * MiB;
+
 Request::Request(RequestClient& client, i32 request_id)
     : m_client(client)
     , m_request_id(request_id)
@@ -51,23 +54,27 @@ void Request::set_buffered_request_finished_callback(BufferedRequestFinished on_
     on_headers_received = [this](auto& headers, auto response_code) {
         m_internal_buffered_data->response_headers = headers;
         m_internal_buffered_data->response_code = move(response_code);
+
+        // Growing the payload as data arrives would copy it over and over for large responses. The Content-Length is
+        // only a hint (the body may be encoded, or the server may lie), so we still grow as needed if it was wrong.
+        if (auto content_length = headers.get("Content-Length"); content_length.has_value()) {
+            if (auto length = content_length->template to_number<u64>(); length.has_value() && *length <= max_preallocated_payload_size)
+                (void)m_internal_buffered_data->payload.try_ensure_capacity(*length);
+        }
     };
 
     on_finish = [this, on_buffered_request_finished = move(on_buffered_request_finished)](auto success, auto total_size) {
-        auto output_buffer = ByteBuffer::create_uninitialized(m_internal_buffered_data->payload_stream.used_buffer_size()).release_value_but_fixme_should_propagate_errors();
-        m_internal_buffered_data->payload_stream.read_until_filled(output_buffer).release_value_but_fixme_should_propagate_errors();
-
         on_buffered_request_finished(
             success,
             total_size,
             m_internal_buffered_data->response_headers,
             m_internal_buffered_data->response_code,
-            output_buffer);
+            m_internal_buffered_data->payload);
     };
 
     set_up_internal_stream_data([this](auto read_bytes) {
         // FIXME: What do we do if this fails?
-        m_internal_buffered_data->payload_stream.write_until_depleted(read_bytes).release_value_but_fixme_should_propagate_errors();
+        m_internal_buffered_data->payload.try_append(read_bytes).release_value_but_fixme_should_propagate_errors();
     });
 }
 
@@ -83,7 +83,8 @@ private:
     RequestFinished on_finish;
 
     struct InternalBufferedData {
-        AllocatingMemoryStream payload_stream;
+        // NOTE: The payload is accumulated in a single contiguous buffer, so it can be handed out at the end without another copy.
+        ByteBuffer payload;
         HTTP::HeaderMap response_headers;
         Optional<u32> response_code;
     };
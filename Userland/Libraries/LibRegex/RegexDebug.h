@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/CharacterTypes.h>
 #include <AK/StringBuilder.h>
 #include <LibRegex/RegexMatcher.h>
 
@@ -34,9 +35,29 @@ public:
     template<typename T>
     void print_bytecode(Regex<T> const& regex) const
     {
+        print_optimization_data(regex);
         print_bytecode(regex.parser_result.bytecode);
     }
 
+    template<typename T>
+    void print_optimization_data(Regex<T> const& regex) const
+    {
+        auto const& optimization_data = regex.parser_result.optimization_data;
+        if (optimization_data.pure_substring_search.has_value())
+            outln(m_file, "Pure substring search: '{}'", *optimization_data.pure_substring_search);
+
+        if (!optimization_data.literal_prefix.is_empty()) {
+            StringBuilder builder;
+            for (auto code_unit : optimization_data.literal_prefix) {
+                if (is_ascii_printable(code_unit))
+                    builder.append(static_cast<char>(code_unit));
+                else
+                    builder.appendff("\\u{{{:x}}}", code_unit);
+            }
+            outln(m_file, "Literal prefix: '{}'", builder.string_view());
+        }
+    }
+
     void print_bytecode(ByteCode const& bytecode) const
     {
         MatchState state;
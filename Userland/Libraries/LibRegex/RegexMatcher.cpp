@@ -7,6 +7,7 @@
 #include <AK/BumpAllocator.h>
 #include <AK/ByteString.h>
 #include <AK/Debug.h>
+#include <AK/MemMem.h>
 #include <AK/StringBuilder.h>
 #include <LibRegex/RegexMatcher.h>
 #include <LibRegex/RegexParser.h>
@@ -99,6 +100,34 @@ ByteString Regex<Parser>::error_string(Optional<ByteString> message) const
     return eb.to_byte_string();
 }
 
+static Optional<size_t> find_literal_prefix(RegexStringView view, size_t start, Vector<u32> const& prefix, Optional<ByteString> const& prefix_bytes)
+{
+    auto view_length = view.length();
+    if (start + prefix.size() > view_length)
+        return {};
+
+    if (prefix_bytes.has_value() && view.is_string_view()) {
+        auto haystack = view.string_view().bytes().slice(start);
+        auto offset = AK::memmem_optional(haystack.data(), haystack.size(), prefix_bytes->characters(), prefix_bytes->length());
+        if (!offset.has_value())
+            return {};
+        return start + *offset;
+    }
+
+    for (auto position = start; position + prefix.size() <= view_length; ++position) {
+        bool matches = true;
+        for (size_t i = 0; i < prefix.size(); ++i) {
+            if (view.code_unit_at(position + i) != prefix[i]) {
+                matches = false;
+                break;
+            }
+        }
+        if (matches)
+            return position;
+    }
+    return {};
+}
+
 template<typename Parser>
 RegexResult Matcher<Parser>::match(RegexStringView view, Optional<typename ParserTraits<Parser>::OptionsType> regex_options) const
 {
@@ -185,6 +214,14 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
 
     auto single_match_only = input.regex_options.has_flag_set(AllFlags::SingleMatch);
 
+    // OPTIMIZATION: If every match has to start with a literal prefix, skip ahead to the positions holding it
+    //               instead of setting up and running the bytecode at every single one.
+    //               This is only done for the simple (non-unicode, case-sensitive) comparison in compare_char().
+    auto const& optimization_data = m_pattern->parser_result.optimization_data;
+    bool use_literal_prefix = continue_search
+        && !optimization_data.literal_prefix.is_empty()
+        && !input.regex_options.has_flag_set(AllFlags::Insensitive);
+
     for (auto const& view : views) {
         if (lines_to_skip != 0) {
             ++input.line;
@@ -245,6 +282,13 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
             if (match_length_minimum && match_length_minimum > view_length - view_index)
                 break;
 
+            if (use_literal_prefix && !view.unicode()) {
+                auto candidate = find_literal_prefix(view, view_index, optimization_data.literal_prefix, optimization_data.literal_prefix_bytes);
+                if (!candidate.has_value())
+                    break;
+                view_index = *candidate;
+            }
+
             input.column = match_count;
             input.match_index = match_count;
 
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
 #include <AK/Debug.h>
 #include <AK/Function.h>
 #include <AK/Queue.h>
@@ -23,6 +24,11 @@ namespace regex {
 
 using Detail::Block;
 
+// FIXME: Patterns without backreferences or lookaround could be matched in linear time by a lazily built DFA
+//        instead of the backtracking VM, which would rule out catastrophic backtracking on user-supplied patterns.
+//        That needs the bytecode lowered to an NFA first: Fork/Jump/ForkReplace/Repeat would become epsilon edges
+//        and the Compare ops their character transitions. Capture groups would need a separate pass to recover
+//        group boundaries. Once that exists, the engine can be chosen here, based on the opcodes the pattern uses.
 template<typename Parser>
 void Regex<Parser>::run_optimization_passes()
 {
@@ -37,6 +43,8 @@ void Regex<Parser>::run_optimization_passes()
     attempt_rewrite_loops_as_atomic_groups(blocks);
 
     parser_result.bytecode.flatten();
+
+    fill_literal_prefix();
 }
 
 template<typename Parser>
@@ -572,6 +580,45 @@ bool Regex<Parser>::attempt_rewrite_entire_match_as_substring_search(BasicBlockL
     return true;
 }
 
+template<typename Parser>
+void Regex<Parser>::fill_literal_prefix()
+{
+    // Every match starts by running the leading Compare instructions in order, so if those only compare against
+    // single characters, no match can start at a position that doesn't hold exactly those characters.
+    // The matcher uses this to jump straight to candidate positions without running the bytecode at all.
+    // e.g. /error: (\d+)/ -> literal prefix "error: "
+    auto& bytecode = parser_result.bytecode;
+    auto& literal_prefix = parser_result.optimization_data.literal_prefix;
+
+    MatchState state;
+    while (state.instruction_position < bytecode.size()) {
+        auto& opcode = bytecode.get_opcode(state);
+        if (opcode.opcode_id() != OpCodeId::Compare)
+            break;
+
+        bool reached_non_literal = false;
+        for (auto& flat_compare : static_cast<OpCode_Compare const&>(opcode).flat_compares()) {
+            if (flat_compare.type != CharacterCompareType::Char) {
+                reached_non_literal = true;
+                break;
+            }
+            literal_prefix.append(static_cast<u32>(flat_compare.value));
+        }
+        if (reached_non_literal)
+            break;
+
+        state.instruction_position += opcode.size();
+    }
+
+    if (literal_prefix.is_empty() || any_of(literal_prefix, [](auto code_unit) { return code_unit > 0xff; }))
+        return;
+
+    StringBuilder builder;
+    for (auto code_unit : literal_prefix)
+        builder.append(bit_cast<char>(static_cast<u8>(code_unit)));
+    parser_result.optimization_data.literal_prefix_bytes = builder.to_byte_string();
+}
+
 template<typename Parser>
 void Regex<Parser>::attempt_rewrite_loops_as_atomic_groups(BasicBlockList const& basic_blocks)
 {
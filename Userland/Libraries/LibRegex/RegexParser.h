@@ -58,6 +58,10 @@ public:
 
         struct {
             Optional<ByteString> pure_substring_search;
+            // The (case-sensitive) code units that every match has to start with, if any.
+            Vector<u32> literal_prefix;
+            // The same prefix as raw bytes, if every code unit in it fits in a byte.
+            Optional<ByteString> literal_prefix_bytes;
         } optimization_data {};
     };
 
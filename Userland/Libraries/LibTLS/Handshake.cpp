@@ -34,6 +34,9 @@ ByteBuffer TLSv12::build_hello()
     builder.append(version);
     builder.append(m_context.local_random, sizeof(m_context.local_random));
 
+    // FIXME: Offer the session ID (or a session ticket) from a previous connection to the same host, and handle the
+    //        abbreviated handshake when the server accepts it. That would save a full round trip and the key exchange
+    //        on every reconnect. TLS 1.3 with PSK resumption would be the long-term answer.
     builder.append(m_context.session_id_size);
     if (m_context.session_id_size)
         builder.append(m_context.session_id, m_context.session_id_size);
@@ -351,6 +351,24 @@ ErrorOr<String> Decoder::to_utf8(StringView input)
     return builder.to_string_without_validation();
 }
 
+// OPTIMIZATION: ASCII bytes decode to themselves in single-byte encodings, so runs of them can be appended to the output
+//               as is, and only the bytes in between need to be looked up.
+template<typename ByteToCodePoint>
+static ErrorOr<String> single_byte_encoding_to_utf8(StringView input, ByteToCodePoint byte_to_code_point)
+{
+    StringBuilder builder(input.length());
+    Utf8View view { input };
+    for (size_t offset = 0; offset < input.length();) {
+        auto ascii_bytes = view.ascii_byte_count_from(offset);
+        TRY(builder.try_append(input.substring_view(offset, ascii_bytes)));
+        offset += ascii_bytes;
+
+        if (offset < input.length())
+            TRY(builder.try_append_code_point(byte_to_code_point(static_cast<u8>(input[offset++]))));
+    }
+    return builder.to_string_without_validation();
+}
+
 ErrorOr<void> UTF8Decoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
 {
     for (auto c : Utf8View(input)) {
@@ -372,6 +390,10 @@ ErrorOr<String> UTF8Decoder::to_utf8(StringView input)
         bomless_input = input.substring_view(3);
     }
 
+    // OPTIMIZATION: Valid UTF-8 comes out of the decoder unchanged, so there is no need to re-encode it code point by code point.
+    if (Utf8View(bomless_input).validate(Utf8View::AllowSurrogates::No))
+        return String::from_utf8_without_validation(bomless_input.bytes());
+
     return Decoder::to_utf8(bomless_input);
 }
 
@@ -531,6 +553,11 @@ ErrorOr<void> Latin1Decoder::process(StringView input, Function<ErrorOr<void>(u3
     return {};
 }
 
+ErrorOr<String> Latin1Decoder::to_utf8(StringView input)
+{
+    return single_byte_encoding_to_utf8(input, [](u8 byte) -> u32 { return byte; });
+}
+
 ErrorOr<void> PDFDocEncodingDecoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
 {
     // PDF 1.7 spec, Appendix D.2 "PDFDocEncoding Character Set"
@@ -625,6 +652,12 @@ ErrorOr<void> SingleByteDecoder<ArrayType>::process(StringView input, Function<E
     return {};
 }
 
+template<Integral ArrayType>
+ErrorOr<String> SingleByteDecoder<ArrayType>::to_utf8(StringView input)
+{
+    return single_byte_encoding_to_utf8(input, [this](u8 byte) -> u32 { return m_translation_table[byte - 0x80]; });
+}
+
 // https://encoding.spec.whatwg.org/#index-gb18030-ranges-code-point
 static Optional<u32> index_gb18030_ranges_code_point(u32 pointer)
 {
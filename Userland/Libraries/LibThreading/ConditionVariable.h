@@ -7,7 +7,9 @@
 #pragma once
 
 #include <AK/Function.h>
+#include <AK/Time.h>
 #include <LibThreading/Mutex.h>
+#include <errno.h>
 #include <pthread.h>
 #include <sys/types.h>
 
@@ -42,6 +44,14 @@ public:
         while (condition())
             wait();
     }
+    // Wait until signaled or until the deadline has passed. Returns false if the deadline passed.
+    ALWAYS_INLINE bool wait_until(UnixDateTime deadline)
+    {
+        auto time = deadline.to_timespec();
+        auto result = pthread_cond_timedwait(&m_condition, &m_to_wait_on.m_mutex, &time);
+        VERIFY(result == 0 || result == ETIMEDOUT);
+        return result == 0;
+    }
     // Release at least one of the threads waiting on this variable.
     ALWAYS_INLINE void signal()
     {
@@ -415,6 +415,15 @@ public:
     {
         MemoryInstance instance { type };
 
+        // OPTIMIZATION: When the memory declares a maximum size of at most 16 MiB (max_eagerly_reserved_memory_size), reserve
+        //               all of it up front so that memory.grow never has to reallocate and copy the existing contents.
+        //               The cap keeps this from committing lots of memory up front on systems that do not overcommit.
+        if (auto max = type.limits().max(); max.has_value()) {
+            u64 max_size = static_cast<u64>(max.value()) * Constants::page_size;
+            if (max_size <= Constants::max_eagerly_reserved_memory_size)
+                (void)instance.m_data.try_ensure_capacity(max_size);
+        }
+
         if (!instance.grow(type.limits().min() * Constants::page_size))
             return Error::from_string_literal("Failed to grow to requested size");
 
@@ -66,24 +66,26 @@ void BytecodeInterpreter::interpret(Configuration& configuration)
 void BytecodeInterpreter::branch_to_label(Configuration& configuration, LabelIndex index)
 {
     dbgln_if(WASM_TRACE_DEBUG, "Branch to label with index {}...", index.value());
-    auto label = configuration.nth_label(index.value());
-    dbgln_if(WASM_TRACE_DEBUG, "...which is actually IP {}, and has {} result(s)", label->continuation().value(), label->arity());
-    auto results = pop_values(configuration, label->arity());
-
-    size_t drop_count = index.value() + 1;
-    for (; !configuration.stack().is_empty();) {
-        auto& entry = configuration.stack().peek();
-        if (entry.has<Label>()) {
-            if (--drop_count == 0)
-                break;
+    auto label_index = configuration.nth_label_index(index.value());
+    VERIFY(label_index.has_value());
+    auto& entries = configuration.stack().entries();
+    auto label = entries[*label_index].get<Label>();
+    dbgln_if(WASM_TRACE_DEBUG, "...which is actually IP {}, and has {} result(s)", label.continuation().value(), label.arity());
+
+    // OPTIMIZATION: Slide the results down to sit right above the label and drop everything in between in one go,
+    //               instead of popping the results into a temporary vector and pushing them back one at a time.
+    auto results_start = entries.size() - label.arity();
+    auto new_size = *label_index + 1 + label.arity();
+    if (results_start != *label_index + 1) {
+        for (size_t i = 0; i < label.arity(); ++i) {
+            auto& result = entries[results_start + i];
+            TRAP_IF_NOT(result.has<Value>());
+            entries[*label_index + 1 + i] = move(result);
         }
-        configuration.stack().pop();
     }
+    entries.shrink(new_size);
 
-    for (auto& result : results.in_reverse())
-        configuration.stack().push(move(result));
-
-    configuration.ip() = label->continuation();
+    configuration.ip() = label.continuation();
 }
 
 template<typename ReadType, typename PushType>
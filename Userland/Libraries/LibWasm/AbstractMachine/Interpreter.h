@@ -10,6 +10,9 @@
 
 namespace Wasm {
 
+// FIXME: Add a single-pass baseline compiler as another Interpreter, translating validated function bodies to native
+//        code (keeping locals in registers and relying on guard pages around memories for bounds checks), calling back
+//        into the AbstractMachine for host functions and falling back to the BytecodeInterpreter per function.
 struct Interpreter {
     virtual ~Interpreter() = default;
     virtual void interpret(Configuration&) = 0;
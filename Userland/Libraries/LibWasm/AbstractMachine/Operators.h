@@ -48,6 +48,9 @@ DEFINE_BINARY_OPERATOR(BitXor, ^);
 
 #undef DEFINE_BINARY_OPERATOR
 
+template<typename Op>
+constexpr bool IsNativeVectorComparison = IsOneOf<Op, Equals, NotEquals, GreaterThan, LessThan, LessThanOrEquals, GreaterThanOrEquals>;
+
 struct Divide {
     template<typename Lhs, typename Rhs>
     auto operator()(Lhs lhs, Rhs rhs) const
@@ -275,6 +278,9 @@ struct VectorCmpOp {
         auto result = bit_cast<Native128ByteVectorOf<ElementType, SetSign>>(c1);
         auto other = bit_cast<Native128ByteVectorOf<ElementType, SetSign>>(c2);
         Op op;
+        // NOTE: Comparing two vectors directly yields all-ones or all-zeros lanes, which is exactly what Wasm wants.
+        if constexpr (IsNativeVectorComparison<Op>)
+            return bit_cast<u128>(op(result, other));
         for (size_t i = 0; i < VectorSize; ++i)
             result[i] = op(result[i], other[i]) ? static_cast<MakeUnsigned<ElementType>>(-1) : 0;
         return bit_cast<u128>(result);
@@ -306,6 +312,8 @@ struct VectorFloatCmpOp {
         using ElementType = NativeIntegralType<128 / VectorSize>;
         Native128ByteVectorOf<ElementType, MakeUnsigned> result;
         Op op;
+        if constexpr (IsNativeVectorComparison<Op>)
+            return bit_cast<u128>(op(first, other));
         for (size_t i = 0; i < VectorSize; ++i)
             result[i] = op(first[i], other[i]) ? static_cast<ElementType>(-1) : 0;
         return bit_cast<u128>(result);
@@ -489,6 +497,10 @@ struct VectorFloatBinaryOp {
         using VectorType = NativeFloatingVectorType<128, VectorSize, NativeFloatingType<128 / VectorSize>>;
         auto first = bit_cast<VectorType>(lhs);
         auto second = bit_cast<VectorType>(rhs);
+        if constexpr (IsOneOf<Op, Add, Subtract, Multiply>)
+            return bit_cast<u128>(Op {}(first, second));
+        else if constexpr (IsSame<Op, Divide>)
+            return bit_cast<u128>(first / second);
         VectorType result;
         Op op;
         for (size_t i = 0; i < VectorSize; ++i) {
@@ -279,6 +279,8 @@ ErrorOr<void, ValidationError> Validator::validate(TableSection const& section)
     return {};
 }
 
+// FIXME: Function bodies only depend on the module-level context, so they could be validated on a thread pool.
+//        That needs the forked validators to stop sharing the non-atomically refcounted COWVectors in m_context first.
 ErrorOr<void, ValidationError> Validator::validate(CodeSection const& section)
 {
     size_t index = m_context.imported_function_count;
@@ -38,6 +38,7 @@
 #include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
 #include <LibWeb/HTML/TagNames.h>
 #include <LibWeb/HTML/Window.h>
+#include <LibWeb/HTML/WindowOrWorkerGlobalScope.h>
 #include <LibWeb/HTML/WindowProxy.h>
 #include <LibWeb/MathML/TagNames.h>
 #include <LibWeb/Namespace.h>
@@ -85,6 +86,10 @@ ErrorOr<void> initialize_main_thread_vm()
         dbgln("FIXME: Unimplemented IDL interface: '{}.{}'", object.class_name(), property_key.to_string());
     };
 
+    // NOTE: The main thread runs similar-origin window agents, whose [[CanBlock]] is false. Worker processes turn this back on.
+    //       https://html.spec.whatwg.org/multipage/webappapis.html#obtain-similar-origin-window-agent
+    s_main_thread_vm->set_agent_can_block(false);
+
     // NOTE: We intentionally leak the main thread JavaScript VM.
     //       This avoids doing an exhaustive garbage collection on process exit.
     s_main_thread_vm->ref();
@@ -323,6 +328,27 @@ ErrorOr<void> initialize_main_thread_vm()
         }));
     };
 
+    // HostEnqueueTimeoutJob(job, realm, milliseconds), https://html.spec.whatwg.org/multipage/webappapis.html#hostenqueuetimeoutjob
+    s_main_thread_vm->host_enqueue_timeout_job = [](JS::NonnullGCPtr<JS::HeapFunction<void()>> job, JS::Realm& realm, double milliseconds) {
+        // 1. Let global be realm's global object.
+        auto& global = realm.global_object();
+        auto* window_or_worker = dynamic_cast<HTML::WindowOrWorkerGlobalScopeMixin*>(&global);
+        VERIFY(window_or_worker);
+
+        // 2. Let timeoutStep be an algorithm step which queues a global task on the JavaScript engine task source given global to perform job().
+        auto timeout_step = [&realm, &global, job] {
+            HTML::queue_global_task(HTML::Task::Source::JavaScriptEngine, global, JS::create_heap_function(realm.heap(), [&realm, job] {
+                // NOTE: The job may resolve promises, which needs an execution context to call the resolving functions in.
+                HTML::TemporaryExecutionContext context { host_defined_environment_settings_object(realm) };
+                job->function()();
+            }));
+        };
+
+        // 3. Run steps after a timeout given global, "JavaScript", milliseconds, and timeoutStep.
+        auto timeout = static_cast<i32>(clamp(milliseconds, 0.0, static_cast<double>(NumericLimits<i32>::max())));
+        window_or_worker->run_steps_after_a_timeout(timeout, move(timeout_step));
+    };
+
     // 8.1.5.4.4 HostMakeJobCallback(callable), https://html.spec.whatwg.org/multipage/webappapis.html#hostmakejobcallback
     s_main_thread_vm->host_make_job_callback = [](JS::FunctionObject& callable) -> JS::NonnullGCPtr<JS::JobCallback> {
         // 1. Let incumbent settings be the incumbent settings object.
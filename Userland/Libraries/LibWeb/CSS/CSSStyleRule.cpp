@@ -7,6 +7,7 @@
 #include <LibWeb/Bindings/CSSStyleRulePrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/CSS/CSSStyleRule.h>
+#include <LibWeb/CSS/Parser/Block.h>
 #include <LibWeb/CSS/Parser/Parser.h>
 #include <LibWeb/CSS/StyleComputer.h>
 #include <LibWeb/WebIDL/ExceptionOr.h>
@@ -20,6 +21,11 @@ JS::NonnullGCPtr<CSSStyleRule> CSSStyleRule::create(JS::Realm& realm, Vector<Non
     return realm.heap().allocate<CSSStyleRule>(realm, realm, move(selectors), declaration);
 }
 
+JS::NonnullGCPtr<CSSStyleRule> CSSStyleRule::create_with_unparsed_declarations(JS::Realm& realm, Vector<NonnullRefPtr<Web::CSS::Selector>>&& selectors, Parser::Block const& declarations, JS::GCPtr<DOM::Document const> document, URL::URL url)
+{
+    return realm.heap().allocate<CSSStyleRule>(realm, realm, move(selectors), declarations, document, move(url));
+}
+
 CSSStyleRule::CSSStyleRule(JS::Realm& realm, Vector<NonnullRefPtr<Selector>>&& selectors, PropertyOwningCSSStyleDeclaration& declaration)
     : CSSRule(realm)
     , m_selectors(move(selectors))
@@ -28,6 +34,17 @@ CSSStyleRule::CSSStyleRule(JS::Realm& realm, Vector<NonnullRefPtr<Selector>>&& s
     m_declaration->set_parent_rule(*this);
 }
 
+CSSStyleRule::CSSStyleRule(JS::Realm& realm, Vector<NonnullRefPtr<Selector>>&& selectors, Parser::Block const& declarations, JS::GCPtr<DOM::Document const> document, URL::URL url)
+    : CSSRule(realm)
+    , m_selectors(move(selectors))
+    , m_unparsed_declarations(declarations)
+    , m_document_for_parsing(document)
+    , m_url_for_parsing(move(url))
+{
+}
+
+CSSStyleRule::~CSSStyleRule() = default;
+
 void CSSStyleRule::initialize(JS::Realm& realm)
 {
     Base::initialize(realm);
@@ -38,11 +55,33 @@ void CSSStyleRule::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(m_declaration);
+    visitor.visit(m_document_for_parsing);
+}
+
+PropertyOwningCSSStyleDeclaration const& CSSStyleRule::declaration() const
+{
+    if (!m_declaration)
+        parse_declarations();
+    return *m_declaration;
+}
+
+void CSSStyleRule::parse_declarations() const
+{
+    VERIFY(m_unparsed_declarations);
+
+    auto context = m_document_for_parsing
+        ? Parser::ParsingContext { *m_document_for_parsing, m_url_for_parsing }
+        : Parser::ParsingContext { realm(), m_url_for_parsing };
+    m_declaration = Parser::Parser::parse_style_block_contents(context, *m_unparsed_declarations);
+    m_declaration->set_parent_rule(const_cast<CSSStyleRule&>(*this));
+    m_unparsed_declarations = nullptr;
 }
 
 // https://www.w3.org/TR/cssom/#dom-cssstylerule-style
 CSSStyleDeclaration* CSSStyleRule::style()
 {
+    if (!m_declaration)
+        parse_declarations();
     return m_declaration;
 }
 
@@ -109,7 +148,7 @@ void CSSStyleRule::set_selector_text(StringView selector_text)
         if (auto* sheet = parent_style_sheet()) {
             if (auto style_sheet_list = sheet->style_sheet_list()) {
                 auto& document = style_sheet_list->document();
-                document.style_computer().invalidate_rule_cache();
+                document.style_computer().invalidate_author_rule_cache();
                 document.invalidate_style();
             }
         }
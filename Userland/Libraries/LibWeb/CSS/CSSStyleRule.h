@@ -8,6 +8,8 @@
 #pragma once
 
 #include <AK/NonnullRefPtr.h>
+#include <AK/RefPtr.h>
+#include <LibURL/URL.h>
 #include <LibWeb/CSS/CSSRule.h>
 #include <LibWeb/CSS/CSSStyleDeclaration.h>
 #include <LibWeb/CSS/Selector.h>
@@ -20,11 +22,12 @@ class CSSStyleRule final : public CSSRule {
 
 public:
     [[nodiscard]] static JS::NonnullGCPtr<CSSStyleRule> create(JS::Realm&, Vector<NonnullRefPtr<Selector>>&&, PropertyOwningCSSStyleDeclaration&);
+    [[nodiscard]] static JS::NonnullGCPtr<CSSStyleRule> create_with_unparsed_declarations(JS::Realm&, Vector<NonnullRefPtr<Selector>>&&, Parser::Block const&, JS::GCPtr<DOM::Document const>, URL::URL);
 
-    virtual ~CSSStyleRule() override = default;
+    virtual ~CSSStyleRule() override;
 
     Vector<NonnullRefPtr<Selector>> const& selectors() const { return m_selectors; }
-    PropertyOwningCSSStyleDeclaration const& declaration() const { return m_declaration; }
+    PropertyOwningCSSStyleDeclaration const& declaration() const;
 
     virtual Type type() const override { return Type::Style; }
 
@@ -35,13 +38,21 @@ public:
 
 private:
     CSSStyleRule(JS::Realm&, Vector<NonnullRefPtr<Selector>>&&, PropertyOwningCSSStyleDeclaration&);
+    CSSStyleRule(JS::Realm&, Vector<NonnullRefPtr<Selector>>&&, Parser::Block const&, JS::GCPtr<DOM::Document const>, URL::URL);
 
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
     virtual String serialized() const override;
 
+    void parse_declarations() const;
+
     Vector<NonnullRefPtr<Selector>> m_selectors;
-    JS::NonnullGCPtr<PropertyOwningCSSStyleDeclaration> m_declaration;
+    mutable JS::GCPtr<PropertyOwningCSSStyleDeclaration> m_declaration;
+
+    // The declaration block as it appeared in the style sheet, until it's parsed into m_declaration on first use.
+    mutable RefPtr<Parser::Block const> m_unparsed_declarations;
+    JS::GCPtr<DOM::Document const> m_document_for_parsing;
+    URL::URL m_url_for_parsing;
 };
 
 template<>
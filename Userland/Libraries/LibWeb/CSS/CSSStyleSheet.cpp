@@ -154,7 +154,7 @@ WebIDL::ExceptionOr<unsigned> CSSStyleSheet::insert_rule(StringView rule, unsign
         parsed_rule->set_parent_style_sheet(this);
 
         if (m_style_sheet_list) {
-            m_style_sheet_list->document().style_computer().invalidate_rule_cache();
+            m_style_sheet_list->document().style_computer().did_insert_rule(*this, *parsed_rule, result.value());
             m_style_sheet_list->document().invalidate_style();
         }
     }
@@ -175,7 +175,7 @@ WebIDL::ExceptionOr<void> CSSStyleSheet::delete_rule(unsigned index)
     auto result = m_rules->remove_a_css_rule(index);
     if (!result.is_exception()) {
         if (m_style_sheet_list) {
-            m_style_sheet_list->document().style_computer().invalidate_rule_cache();
+            m_style_sheet_list->document().style_computer().invalidate_author_rule_cache();
             m_style_sheet_list->document().invalidate_style();
         }
     }
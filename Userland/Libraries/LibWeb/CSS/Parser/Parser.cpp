@@ -1475,16 +1475,9 @@ CSSRule* Parser::convert_to_rule(NonnullRefPtr<Rule> rule)
     if (!rule->block()->is_curly())
         return {};
 
-    auto stream = TokenStream(rule->block()->values());
-    auto declarations_and_at_rules = parse_a_style_blocks_contents(stream);
-
-    auto* declaration = convert_to_style_declaration(declarations_and_at_rules);
-    if (!declaration) {
-        dbgln_if(CSS_PARSER_DEBUG, "CSSParser: style rule declaration invalid; discarding.");
-        return {};
-    }
-
-    return CSSStyleRule::create(m_context.realm(), move(selectors.value()), *declaration);
+    // NOTE: Most rules in large style sheets never match anything, so we only parse a rule's declarations
+    //       once they're needed. See CSSStyleRule::declaration().
+    return CSSStyleRule::create_with_unparsed_declarations(m_context.realm(), move(selectors.value()), *rule->block(), m_context.document(), m_context.url());
 }
 
 auto Parser::extract_properties(Vector<DeclarationOrAtRule> const& declarations_and_at_rules) -> PropertiesAndCustomProperties
@@ -5564,6 +5557,39 @@ RefPtr<StyleValue> Parser::parse_transition_value(TokenStream<ComponentValue>& t
     return TransitionStyleValue::create(move(transitions));
 }
 
+// https://drafts.csswg.org/css-will-change/#will-change
+RefPtr<StyleValue> Parser::parse_will_change_value(TokenStream<ComponentValue>& tokens)
+{
+    // auto | <animateable-feature>#
+    if (tokens.peek_token().is_ident("auto"sv)) {
+        (void)tokens.next_token();
+        return IdentifierStyleValue::create(ValueID::Auto);
+    }
+
+    // <animateable-feature> = scroll-position | contents | <custom-ident>
+    return parse_comma_separated_value_list(tokens, [](auto& tokens) -> RefPtr<StyleValue> {
+        auto const& token = tokens.next_token();
+        if (!token.is(Token::Type::Ident))
+            return nullptr;
+
+        auto const& ident = token.token().ident();
+        if (ident.equals_ignoring_ascii_case("scroll-position"sv))
+            return IdentifierStyleValue::create(ValueID::ScrollPosition);
+        if (ident.equals_ignoring_ascii_case("contents"sv))
+            return IdentifierStyleValue::create(ValueID::Contents);
+
+        // The <custom-ident> production in <animateable-feature> excludes the keywords will-change, none, all, and auto.
+        if (is_css_wide_keyword(ident)
+            || ident.equals_ignoring_ascii_case("will-change"sv)
+            || ident.equals_ignoring_ascii_case("none"sv)
+            || ident.equals_ignoring_ascii_case("all"sv)
+            || ident.equals_ignoring_ascii_case("auto"sv))
+            return nullptr;
+
+        return CustomIdentStyleValue::create(ident);
+    });
+}
+
 RefPtr<StyleValue> Parser::parse_as_css_value(PropertyID property_id)
 {
     auto component_values = parse_a_list_of_component_values(m_token_stream);
@@ -6497,6 +6523,10 @@ Parser::ParseErrorOr<NonnullRefPtr<StyleValue>> Parser::parse_css_value(Property
         if (auto parsed_value = parse_transition_value(tokens); parsed_value && !tokens.has_next_token())
             return parsed_value.release_nonnull();
         return ParseError::SyntaxError;
+    case PropertyID::WillChange:
+        if (auto parsed_value = parse_will_change_value(tokens); parsed_value && !tokens.has_next_token())
+            return parsed_value.release_nonnull();
+        return ParseError::SyntaxError;
     default:
         break;
     }
@@ -7172,6 +7202,14 @@ NonnullRefPtr<StyleValue> Parser::resolve_unresolved_style_value(ParsingContext
     return parser.resolve_unresolved_style_value(element, pseudo_element, property_id, unresolved);
 }
 
+PropertyOwningCSSStyleDeclaration* Parser::parse_style_block_contents(ParsingContext const& context, Block const& block)
+{
+    auto parser = MUST(Parser::create(context, ""sv));
+    auto stream = TokenStream(block.values());
+    auto declarations_and_at_rules = parser.parse_a_style_blocks_contents(stream);
+    return parser.convert_to_style_declaration(declarations_and_at_rules);
+}
+
 class PropertyDependencyNode : public RefCounted<PropertyDependencyNode> {
 public:
     static NonnullRefPtr<PropertyDependencyNode> create(FlyString name)
@@ -72,6 +72,7 @@ public:
     Vector<ParsedFontFace::Source> parse_as_font_face_src();
 
     static NonnullRefPtr<StyleValue> resolve_unresolved_style_value(ParsingContext const&, DOM::Element&, Optional<CSS::Selector::PseudoElement::Type>, PropertyID, UnresolvedStyleValue const&);
+    static PropertyOwningCSSStyleDeclaration* parse_style_block_contents(ParsingContext const&, Block const&);
 
     [[nodiscard]] LengthOrCalculated parse_as_sizes_attribute();
 
@@ -332,6 +333,7 @@ private:
     RefPtr<StyleValue> parse_transform_value(TokenStream<ComponentValue>&);
     RefPtr<StyleValue> parse_transform_origin_value(TokenStream<ComponentValue>&);
     RefPtr<StyleValue> parse_transition_value(TokenStream<ComponentValue>&);
+    RefPtr<StyleValue> parse_will_change_value(TokenStream<ComponentValue>&);
     RefPtr<StyleValue> parse_grid_track_size_list(TokenStream<ComponentValue>&, bool allow_separate_line_name_blocks = false);
     RefPtr<StyleValue> parse_grid_auto_track_sizes(TokenStream<ComponentValue>&);
     RefPtr<GridAutoFlowStyleValue> parse_grid_auto_flow_value(TokenStream<ComponentValue>&);
@@ -32,6 +32,7 @@ public:
     DOM::Document const* document() const { return m_document; }
     HTML::Window const* window() const;
     URL::URL complete_url(StringView) const;
+    URL::URL const& url() const { return m_url; }
 
     PropertyID current_property_id() const { return m_current_property_id; }
     void set_current_property_id(PropertyID property_id) { m_current_property_id = property_id; }
@@ -260,9 +260,10 @@ ErrorOr<Vector<Token>> Tokenizer::tokenize()
         auto token = TRY(consume_a_token());
         token.m_start_position = token_start;
         token.m_end_position = m_position;
-        TRY(tokens.try_append(token));
+        bool is_end_of_file = token.is(Token::Type::EndOfFile);
+        TRY(tokens.try_append(move(token)));
 
-        if (token.is(Token::Type::EndOfFile)) {
+        if (is_end_of_file) {
             return tokens;
         }
     }
@@ -593,6 +594,12 @@ ErrorOr<FlyString> Tokenizer::consume_an_ident_sequence()
     // If that is the intended use, ensure that the stream starts with an ident sequence before
     // calling this algorithm.
 
+    // OPTIMIZATION: Most ident sequences contain no escapes, so their value is exactly the input they were
+    //               consumed from. We only copy code points into `result` once we've seen an escape, and
+    //               otherwise look up the input bytes directly, which avoids allocating for known idents.
+    auto start_byte_offset = current_byte_offset();
+    bool has_escapes = false;
+
     // Let result initially be an empty string.
     StringBuilder result;
 
@@ -606,12 +613,18 @@ ErrorOr<FlyString> Tokenizer::consume_an_ident_sequence()
         // name code point
         if (is_ident_code_point(input)) {
             // Append the code point to result.
-            TRY(result.try_append_code_point(input));
+            if (has_escapes)
+                TRY(result.try_append_code_point(input));
             continue;
         }
 
         // the stream starts with a valid escape
         if (is_valid_escape_sequence(start_of_input_stream_twin())) {
+            if (!has_escapes) {
+                auto escape_byte_offset = static_cast<size_t>(m_prev_utf8_iterator.ptr() - m_utf8_view.bytes());
+                TRY(result.try_append(m_decoded_input.bytes_as_string_view().substring_view(start_byte_offset, escape_byte_offset - start_byte_offset)));
+                has_escapes = true;
+            }
             // Consume an escaped code point. Append the returned code point to result.
             TRY(result.try_append_code_point(consume_escaped_code_point()));
             continue;
@@ -623,6 +636,8 @@ ErrorOr<FlyString> Tokenizer::consume_an_ident_sequence()
         break;
     }
 
+    if (!has_escapes)
+        return FlyString::from_utf8_without_validation(m_decoded_input.bytes().slice(start_byte_offset, current_byte_offset() - start_byte_offset));
     return result.to_fly_string_without_validation();
 }
 
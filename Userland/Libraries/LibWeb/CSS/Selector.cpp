@@ -25,6 +25,35 @@ Selector::Selector(Vector<CompoundSelector>&& compound_selectors)
     }
 
     collect_ancestor_hashes();
+    compute_simple_compound_fast_path();
+}
+
+void Selector::compute_simple_compound_fast_path()
+{
+    if (m_compound_selectors.size() != 1)
+        return;
+
+    SimpleCompoundFastPath fast_path;
+    for (auto const& simple_selector : m_compound_selectors.first().simple_selectors) {
+        switch (simple_selector.type) {
+        case SimpleSelector::Type::TagName:
+            if (fast_path.type.has_value())
+                return;
+            fast_path.type = simple_selector.qualified_name();
+            break;
+        case SimpleSelector::Type::Id:
+            if (fast_path.id.has_value())
+                return;
+            fast_path.id = simple_selector.name();
+            break;
+        case SimpleSelector::Type::Class:
+            fast_path.class_names.append(simple_selector.name());
+            break;
+        default:
+            return;
+        }
+    }
+    m_simple_compound_fast_path = move(fast_path);
 }
 
 void Selector::collect_ancestor_hashes()
@@ -41,10 +70,12 @@ void Selector::collect_ancestor_hashes()
         return false;
     };
 
+    // NOTE: Any compound followed by a descendant or child combinator has to match an ancestor of the subject,
+    //       even if there are sibling combinators in between, since siblings share all of their ancestors.
     auto last_combinator = m_compound_selectors.last().combinator;
     for (ssize_t compound_selector_index = static_cast<ssize_t>(m_compound_selectors.size()) - 2; compound_selector_index >= 0; --compound_selector_index) {
         auto const& compound_selector = m_compound_selectors[compound_selector_index];
-        if (last_combinator == Combinator::Descendant) {
+        if (last_combinator == Combinator::Descendant || last_combinator == Combinator::ImmediateChild) {
             for (auto const& simple_selector : compound_selector.simple_selectors) {
                 switch (simple_selector.type) {
                 case SimpleSelector::Type::Id:
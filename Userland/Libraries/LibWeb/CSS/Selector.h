@@ -244,6 +244,15 @@ public:
 
     auto const& ancestor_hashes() const { return m_ancestor_hashes; }
 
+    // A selector that is a single compound selector made only of type, id and class selectors (like `div`, `.a`,
+    // `#b` or `div.a`) can be matched with a few direct comparisons, without walking its simple selectors.
+    struct SimpleCompoundFastPath {
+        Optional<SimpleSelector::QualifiedName> type;
+        Optional<FlyString> id;
+        Vector<FlyString, 2> class_names;
+    };
+    Optional<SimpleCompoundFastPath> const& simple_compound_fast_path() const { return m_simple_compound_fast_path; }
+
 private:
     explicit Selector(Vector<CompoundSelector>&&);
 
@@ -252,8 +261,10 @@ private:
     Optional<Selector::PseudoElement> m_pseudo_element;
 
     void collect_ancestor_hashes();
+    void compute_simple_compound_fast_path();
 
     Array<u32, 8> m_ancestor_hashes;
+    Optional<SimpleCompoundFastPath> m_simple_compound_fast_path;
 };
 
 String serialize_a_group_of_selectors(Vector<NonnullRefPtr<Selector>> const& selectors);
@@ -757,6 +757,30 @@ bool fast_matches(CSS::Selector const& selector, Optional<CSS::CSSStyleSheet con
     }
 }
 
+bool matches_simple_compound_fast_path(CSS::Selector::SimpleCompoundFastPath const& fast_path, Optional<CSS::CSSStyleSheet const&> style_sheet_for_rule, DOM::Element const& element)
+{
+    // NOTE: Ids and classes are checked first, since they are far more likely to reject an element than its type.
+    if (fast_path.id.has_value() && element.id() != fast_path.id)
+        return false;
+
+    for (auto const& class_name : fast_path.class_names) {
+        if (!element.has_class(class_name))
+            return false;
+    }
+
+    if (!fast_path.type.has_value())
+        return true;
+
+    auto const& qualified_name = fast_path.type.value();
+    if (element.document().document_type() == DOM::Document::Type::HTML) {
+        if (qualified_name.name.lowercase_name != element.local_name())
+            return false;
+    } else if (!Infra::is_ascii_case_insensitive_match(qualified_name.name.name, element.local_name())) {
+        return false;
+    }
+    return matches_namespace(qualified_name, element, style_sheet_for_rule);
+}
+
 bool can_use_fast_matches(CSS::Selector const& selector)
 {
     for (auto const& compound_selector : selector.compound_selectors()) {
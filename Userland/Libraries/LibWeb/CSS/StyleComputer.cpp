@@ -308,16 +308,27 @@ StyleComputer::RuleCache const& StyleComputer::rule_cache_for_cascade_origin(Cas
 
 bool StyleComputer::should_reject_with_ancestor_filter(Selector const& selector) const
 {
+    // NOTE: The filter is only populated while walking the tree in Document::update_style() and the layout tree builder.
+    //       Style computed outside of those (e.g. for getComputedStyle() on an element without a layout node) can't use it.
+    if (m_ancestor_filter_depth == 0)
+        return false;
+
+    if constexpr (LIBWEB_CSS_DEBUG)
+        ++m_ancestor_filter_statistics.checks;
+
     for (u32 hash : selector.ancestor_hashes()) {
         if (hash == 0)
             break;
-        if (!m_ancestor_filter.may_contain(hash))
+        if (!m_ancestor_filter.may_contain(hash)) {
+            if constexpr (LIBWEB_CSS_DEBUG)
+                ++m_ancestor_filter_statistics.rejections;
             return true;
+        }
     }
     return false;
 }
 
-Vector<MatchingRule> StyleComputer::collect_matching_rules(DOM::Element const& element, CascadeOrigin cascade_origin, Optional<CSS::Selector::PseudoElement::Type> pseudo_element) const
+MatchingRuleList StyleComputer::collect_matching_rules(DOM::Element const& element, CascadeOrigin cascade_origin, Optional<CSS::Selector::PseudoElement::Type> pseudo_element) const
 {
     auto const& root_node = element.root();
     auto shadow_root = is<DOM::ShadowRoot>(root_node) ? static_cast<DOM::ShadowRoot const*>(&root_node) : nullptr;
@@ -363,8 +374,7 @@ Vector<MatchingRule> StyleComputer::collect_matching_rules(DOM::Element const& e
 
     add_rules_to_run(rule_cache.other_rules);
 
-    Vector<MatchingRule> matching_rules;
-    matching_rules.ensure_capacity(rules_to_run.size());
+    MatchingRuleList matching_rules;
     for (auto const& rule_to_run : rules_to_run) {
         // FIXME: This needs to be revised when adding support for the :host and ::shadow selectors, which transition shadow tree boundaries
         auto rule_root = rule_to_run.shadow_root;
@@ -374,6 +384,13 @@ Vector<MatchingRule> StyleComputer::collect_matching_rules(DOM::Element const& e
 
         auto const& selector = rule_to_run.rule->selectors()[rule_to_run.selector_index];
 
+        if (auto const& fast_path = selector->simple_compound_fast_path(); fast_path.has_value()) {
+            if (!SelectorEngine::matches_simple_compound_fast_path(*fast_path, *rule_to_run.sheet, element))
+                continue;
+            matching_rules.append(rule_to_run);
+            continue;
+        }
+
         if (should_reject_with_ancestor_filter(*selector))
             continue;
 
@@ -389,7 +406,7 @@ Vector<MatchingRule> StyleComputer::collect_matching_rules(DOM::Element const& e
     return matching_rules;
 }
 
-static void sort_matching_rules(Vector<MatchingRule>& matching_rules)
+static void sort_matching_rules(Span<MatchingRule> matching_rules)
 {
     quick_sort(matching_rules, [&](MatchingRule& a, MatchingRule& b) {
         auto const& a_selector = a.rule->selectors()[a.selector_index];
@@ -745,17 +762,17 @@ void StyleComputer::set_all_properties(DOM::Element& element, Optional<CSS::Sele
         auto property_id = (CSS::PropertyID)i;
 
         if (value.is_revert()) {
-            style.m_property_values[to_underlying(property_id)] = properties_for_revert[to_underlying(property_id)];
-            style.m_property_values[to_underlying(property_id)].important = important;
+            style.mutable_property_values()[to_underlying(property_id)] = properties_for_revert[to_underlying(property_id)];
+            style.mutable_property_values()[to_underlying(property_id)].important = important;
             continue;
         }
 
         if (value.is_unset()) {
             if (is_inherited_property(property_id))
-                style.m_property_values[to_underlying(property_id)] = { get_inherit_value(document.realm(), property_id, &element, pseudo_element), nullptr };
+                style.mutable_property_values()[to_underlying(property_id)] = { get_inherit_value(document.realm(), property_id, &element, pseudo_element), nullptr };
             else
-                style.m_property_values[to_underlying(property_id)] = { property_initial_value(document.realm(), property_id), nullptr };
-            style.m_property_values[to_underlying(property_id)].important = important;
+                style.mutable_property_values()[to_underlying(property_id)] = { property_initial_value(document.realm(), property_id), nullptr };
+            style.mutable_property_values()[to_underlying(property_id)].important = important;
             continue;
         }
 
@@ -765,15 +782,17 @@ void StyleComputer::set_all_properties(DOM::Element& element, Optional<CSS::Sele
         if (!property_value->is_unresolved())
             set_property_expanding_shorthands(style, property_id, property_value, declaration, properties_for_revert);
 
-        style.m_property_values[to_underlying(property_id)].important = important;
+        style.mutable_property_values()[to_underlying(property_id)].important = important;
 
         set_property_expanding_shorthands(style, property_id, value, declaration, properties_for_revert, important);
     }
 }
 
-void StyleComputer::cascade_declarations(StyleProperties& style, DOM::Element& element, Optional<CSS::Selector::PseudoElement::Type> pseudo_element, Vector<MatchingRule> const& matching_rules, CascadeOrigin cascade_origin, Important important) const
+void StyleComputer::cascade_declarations(StyleProperties& style, DOM::Element& element, Optional<CSS::Selector::PseudoElement::Type> pseudo_element, ReadonlySpan<MatchingRule> matching_rules, CascadeOrigin cascade_origin, Important important) const
 {
-    auto properties_for_revert = style.properties();
+    // NOTE: The snapshot shares its property values with `style` until the first declaration is applied.
+    NonnullRefPtr<StyleProperties const> style_for_revert = style.clone();
+    auto const& properties_for_revert = style_for_revert->properties();
 
     for (auto const& match : matching_rules) {
         for (auto const& property : match.rule->declaration().properties()) {
@@ -814,7 +833,7 @@ void StyleComputer::cascade_declarations(StyleProperties& style, DOM::Element& e
     }
 }
 
-static void cascade_custom_properties(DOM::Element& element, Optional<CSS::Selector::PseudoElement::Type> pseudo_element, Vector<MatchingRule> const& matching_rules)
+static void cascade_custom_properties(DOM::Element& element, Optional<CSS::Selector::PseudoElement::Type> pseudo_element, ReadonlySpan<MatchingRule> matching_rules)
 {
     size_t needed_capacity = 0;
     for (auto const& matching_rule : matching_rules)
@@ -1599,12 +1618,14 @@ static void apply_dimension_attribute(StyleProperties& style, DOM::Element const
 void StyleComputer::compute_cascaded_values(StyleProperties& style, DOM::Element& element, Optional<CSS::Selector::PseudoElement::Type> pseudo_element, bool& did_match_any_pseudo_element_rules, ComputeStyleMode mode) const
 {
     // First, we collect all the CSS rules whose selectors match `element`:
-    MatchingRuleSet matching_rule_set;
-    matching_rule_set.user_agent_rules = collect_matching_rules(element, CascadeOrigin::UserAgent, pseudo_element);
+    // NOTE: The lists are constructed in place, since moving a vector with inline storage copies its elements.
+    MatchingRuleSet matching_rule_set {
+        .user_agent_rules = collect_matching_rules(element, CascadeOrigin::UserAgent, pseudo_element),
+        .user_rules = collect_matching_rules(element, CascadeOrigin::User, pseudo_element),
+        .author_rules = collect_matching_rules(element, CascadeOrigin::Author, pseudo_element),
+    };
     sort_matching_rules(matching_rule_set.user_agent_rules);
-    matching_rule_set.user_rules = collect_matching_rules(element, CascadeOrigin::User, pseudo_element);
     sort_matching_rules(matching_rule_set.user_rules);
-    matching_rule_set.author_rules = collect_matching_rules(element, CascadeOrigin::Author, pseudo_element);
     sort_matching_rules(matching_rule_set.author_rules);
 
     if (mode == ComputeStyleMode::CreatePseudoElementStyleIfNeeded) {
@@ -1641,7 +1662,7 @@ void StyleComputer::compute_cascaded_values(StyleProperties& style, DOM::Element
             // FIXME: This is not very efficient, we should only resolve the custom properties that are actually used.
             for (auto i = to_underlying(CSS::first_property_id); i <= to_underlying(CSS::last_property_id); ++i) {
                 auto property_id = (CSS::PropertyID)i;
-                auto& property = style.m_property_values[i];
+                auto& property = style.mutable_property_values()[i];
                 if (property.style && property.style->is_unresolved())
                     property.style = Parser::Parser::resolve_unresolved_style_value(Parser::ParsingContext { document() }, element, pseudo_element, property_id, property.style->as_unresolved());
             }
@@ -1750,12 +1771,12 @@ void StyleComputer::compute_defaulted_property_value(StyleProperties& style, DOM
 {
     // FIXME: If we don't know the correct initial value for a property, we fall back to InitialStyleValue.
 
-    auto& value_slot = style.m_property_values[to_underlying(property_id)];
+    auto& value_slot = style.mutable_property_values()[to_underlying(property_id)];
     if (!value_slot.style) {
         if (is_inherited_property(property_id))
-            style.m_property_values[to_underlying(property_id)] = { get_inherit_value(document().realm(), property_id, element, pseudo_element), nullptr, StyleProperties::Important::No, StyleProperties::Inherited::Yes };
+            value_slot = { get_inherit_value(document().realm(), property_id, element, pseudo_element), nullptr, StyleProperties::Important::No, StyleProperties::Inherited::Yes };
         else
-            style.m_property_values[to_underlying(property_id)] = { property_initial_value(document().realm(), property_id), nullptr };
+            value_slot = { property_initial_value(document().realm(), property_id), nullptr };
         return;
     }
 
@@ -2212,7 +2233,8 @@ void StyleComputer::absolutize_values(StyleProperties& style) const
     //       We have to resolve them right away, so that the *computed* line-height is ready for inheritance.
     //       We can't simply absolutize *all* percentage values against the font size,
     //       because most percentages are relative to containing block metrics.
-    auto& line_height_value_slot = style.m_property_values[to_underlying(CSS::PropertyID::LineHeight)].style;
+    auto& property_values = style.mutable_property_values();
+    auto& line_height_value_slot = property_values[to_underlying(CSS::PropertyID::LineHeight)].style;
     if (line_height_value_slot && line_height_value_slot->is_percentage()) {
         line_height_value_slot = LengthStyleValue::create(
             Length::make_px(CSSPixels::nearest_value_for(font_size * static_cast<double>(line_height_value_slot->as_percentage().percentage().as_fraction()))));
@@ -2225,8 +2247,8 @@ void StyleComputer::absolutize_values(StyleProperties& style) const
     if (line_height_value_slot && line_height_value_slot->is_length())
         line_height_value_slot = LengthStyleValue::create(Length::make_px(line_height));
 
-    for (size_t i = 0; i < style.m_property_values.size(); ++i) {
-        auto& value_slot = style.m_property_values[i];
+    for (size_t i = 0; i < property_values.size(); ++i) {
+        auto& value_slot = property_values[i];
         if (!value_slot.style)
             continue;
         value_slot.style = value_slot.style->absolutized(viewport_rect(), font_metrics, m_root_element_font_metrics);
@@ -2386,7 +2408,154 @@ NonnullRefPtr<StyleProperties> StyleComputer::create_document_style() const
 
 NonnullRefPtr<StyleProperties> StyleComputer::compute_style(DOM::Element& element, Optional<CSS::Selector::PseudoElement::Type> pseudo_element) const
 {
-    return compute_style_impl(element, move(pseudo_element), ComputeStyleMode::Normal).release_nonnull();
+    if (pseudo_element.has_value() || !can_share_style(element))
+        return compute_style_impl(element, move(pseudo_element), ComputeStyleMode::Normal).release_nonnull();
+
+    if (auto shared_style = find_shared_style(element))
+        return shared_style.release_nonnull();
+
+    auto style = compute_style_impl(element, {}, ComputeStyleMode::Normal).release_nonnull();
+
+    // NOTE: Computing the style may have started a CSS animation on the element, in which case its style is no longer
+    //       determined by the cascade alone.
+    if (!element.has_associated_animations() && !element.cached_animation_name_animation())
+        remember_style_for_sharing(element, *style);
+    return style;
+}
+
+// Returns true if the subject of the selector could match one of two sibling elements with identical tag names and
+// attributes, but not the other. Compounds that match ancestors of the subject don't matter, as siblings share those.
+static bool selector_can_distinguish_identical_siblings(Selector const& selector)
+{
+    auto const& subject = selector.compound_selectors().last();
+    if (first_is_one_of(subject.combinator, Selector::Combinator::NextSibling, Selector::Combinator::SubsequentSibling, Selector::Combinator::Column))
+        return true;
+
+    for (auto const& simple_selector : subject.simple_selectors) {
+        if (simple_selector.type != Selector::SimpleSelector::Type::PseudoClass)
+            continue;
+        auto const& pseudo_class = simple_selector.pseudo_class();
+        switch (pseudo_class.type) {
+        // These only depend on the element's own attributes and its ancestors.
+        case PseudoClass::AnyLink:
+        case PseudoClass::Lang:
+        case PseudoClass::Link:
+        case PseudoClass::LocalLink:
+        case PseudoClass::Root:
+        case PseudoClass::Scope:
+        case PseudoClass::Visited:
+        // These depend on where the hovered, focused, active and target elements are, which can_share_style() checks.
+        case PseudoClass::Active:
+        case PseudoClass::Focus:
+        case PseudoClass::FocusVisible:
+        case PseudoClass::FocusWithin:
+        case PseudoClass::Hover:
+        case PseudoClass::Target:
+        case PseudoClass::TargetWithin:
+            break;
+        case PseudoClass::Is:
+        case PseudoClass::Not:
+        case PseudoClass::Where:
+            for (auto const& argument_selector : pseudo_class.argument_selector_list) {
+                if (selector_can_distinguish_identical_siblings(*argument_selector))
+                    return true;
+            }
+            break;
+        default:
+            return true;
+        }
+    }
+    return false;
+}
+
+void StyleComputer::set_style_sharing_enabled(Badge<DOM::Document>, bool enabled)
+{
+    m_style_sharing_enabled = enabled;
+    m_style_sharing_candidates.clear();
+}
+
+bool StyleComputer::can_share_style(DOM::Element const& element) const
+{
+    if (!m_style_sharing_enabled)
+        return false;
+
+    if (element.use_pseudo_element().has_value() || element.shadow_root() || !element.parent())
+        return false;
+
+    // FIXME: Elements with identical inline styles could share style too, but the declarations would have to be compared.
+    if (element.has_attribute(HTML::AttributeNames::style))
+        return false;
+
+    if (element.has_associated_animations() || element.cached_animation_name_animation())
+        return false;
+
+    auto const& document = element.document();
+    auto contains = [&](DOM::Node const* node) {
+        return node && element.is_inclusive_ancestor_of(*node);
+    };
+    if (contains(document.hovered_node()) || contains(document.focused_element()) || contains(document.active_element()) || contains(document.target_element()))
+        return false;
+
+    build_rule_cache_if_needed();
+    for (auto cascade_origin : { CascadeOrigin::UserAgent, CascadeOrigin::User, CascadeOrigin::Author }) {
+        auto const& blockers = rule_cache_for_cascade_origin(cascade_origin).style_sharing_blockers;
+        if (blockers.any_element)
+            return false;
+        if (auto id = element.id(); id.has_value() && blockers.ids.contains(id.value()))
+            return false;
+        for (auto const& class_name : element.class_names()) {
+            if (blockers.classes.contains(class_name))
+                return false;
+        }
+        if (blockers.tag_names.contains(element.local_name()))
+            return false;
+        if (!blockers.attribute_names.is_empty()) {
+            bool has_blocking_attribute = false;
+            element.for_each_attribute([&](auto& name, auto&) {
+                if (blockers.attribute_names.contains(name))
+                    has_blocking_attribute = true;
+            });
+            if (has_blocking_attribute)
+                return false;
+        }
+    }
+    return true;
+}
+
+RefPtr<StyleProperties> StyleComputer::find_shared_style(DOM::Element& element) const
+{
+    auto has_identical_attributes = [&](DOM::Element const& candidate) {
+        if (candidate.attribute_list_size() != element.attribute_list_size())
+            return false;
+        if (!element.attributes())
+            return true;
+        for (size_t i = 0; i < element.attribute_list_size(); ++i) {
+            auto const* attribute = element.attributes()->item(i);
+            if (candidate.get_attribute_ns(attribute->namespace_uri(), attribute->local_name()) != attribute->value())
+                return false;
+        }
+        return true;
+    };
+
+    for (auto const& candidate : m_style_sharing_candidates) {
+        if (candidate.element->parent() != element.parent()
+            || candidate.element->local_name() != element.local_name()
+            || candidate.element->namespace_uri() != element.namespace_uri()
+            || !has_identical_attributes(*candidate.element))
+            continue;
+
+        // NOTE: Custom properties are stored on the element during the cascade, so we have to carry those over as well.
+        element.set_custom_properties({}, candidate.element->custom_properties({}));
+        return candidate.style->clone();
+    }
+    return nullptr;
+}
+
+void StyleComputer::remember_style_for_sharing(DOM::Element const& element, StyleProperties const& style) const
+{
+    if (m_style_sharing_candidates.size() == max_style_sharing_candidates)
+        m_style_sharing_candidates.take_first();
+    m_style_sharing_candidates.append({ element, style.clone() });
 }
 
 RefPtr<StyleProperties> StyleComputer::compute_pseudo_element_style_if_needed(DOM::Element& element, Optional<CSS::Selector::PseudoElement::Type> pseudo_element) const
@@ -2451,144 +2620,191 @@ void StyleComputer::build_rule_cache_if_needed() const
     const_cast<StyleComputer&>(*this).build_rule_cache();
 }
 
-NonnullOwnPtr<StyleComputer::RuleCache> StyleComputer::make_rule_cache_for_cascade_origin(CascadeOrigin cascade_origin)
+void StyleComputer::add_style_sheet_to_rule_cache(RuleCache& rule_cache, CascadeOrigin cascade_origin, CSSStyleSheet const& sheet, JS::GCPtr<DOM::ShadowRoot> shadow_root, size_t style_sheet_index, size_t first_rule_index)
 {
-    auto rule_cache = make<RuleCache>();
-
-    size_t num_class_rules = 0;
-    size_t num_id_rules = 0;
-    size_t num_tag_name_rules = 0;
-    size_t num_pseudo_element_rules = 0;
-    size_t num_root_rules = 0;
-    size_t num_attribute_rules = 0;
+    size_t rule_index = 0;
+    sheet.for_each_effective_style_rule([&](auto const& rule) {
+        // NOTE: Rules that are already in the cache are skipped when appending rules to a style sheet.
+        if (rule_index < first_rule_index) {
+            ++rule_index;
+            return;
+        }
+        size_t selector_index = 0;
+        for (CSS::Selector const& selector : rule.selectors()) {
+            MatchingRule matching_rule {
+                shadow_root,
+                &rule,
+                sheet,
+                style_sheet_index,
+                rule_index,
+                selector_index,
+                selector.specificity(),
+                cascade_origin,
+                false,
+                false,
+                SelectorEngine::can_use_fast_matches(selector),
+            };
 
-    Vector<MatchingRule> matching_rules;
-    size_t style_sheet_index = 0;
-    for_each_stylesheet(cascade_origin, [&](auto& sheet, JS::GCPtr<DOM::ShadowRoot> shadow_root) {
-        size_t rule_index = 0;
-        sheet.for_each_effective_style_rule([&](auto const& rule) {
-            size_t selector_index = 0;
-            for (CSS::Selector const& selector : rule.selectors()) {
-                MatchingRule matching_rule {
-                    shadow_root,
-                    &rule,
-                    sheet,
-                    style_sheet_index,
-                    rule_index,
-                    selector_index,
-                    selector.specificity(),
-                    cascade_origin,
-                    false,
-                    false,
-                    SelectorEngine::can_use_fast_matches(selector),
-                };
+            for (auto const& simple_selector : selector.compound_selectors().last().simple_selectors) {
+                if (simple_selector.type == CSS::Selector::SimpleSelector::Type::PseudoElement)
+                    matching_rule.contains_pseudo_element = true;
+                if (simple_selector.type == CSS::Selector::SimpleSelector::Type::PseudoClass
+                    && simple_selector.pseudo_class().type == CSS::PseudoClass::Root)
+                    matching_rule.contains_root_pseudo_class = true;
+            }
 
-                for (auto const& simple_selector : selector.compound_selectors().last().simple_selectors) {
-                    if (!matching_rule.contains_pseudo_element) {
-                        if (simple_selector.type == CSS::Selector::SimpleSelector::Type::PseudoElement) {
-                            matching_rule.contains_pseudo_element = true;
-                            ++num_pseudo_element_rules;
-                        }
-                    }
-                    if (!matching_rule.contains_root_pseudo_class) {
-                        if (simple_selector.type == CSS::Selector::SimpleSelector::Type::PseudoClass
-                            && simple_selector.pseudo_class().type == CSS::PseudoClass::Root) {
-                            matching_rule.contains_root_pseudo_class = true;
-                            ++num_root_rules;
-                        }
-                    }
-                }
+            collect_invalidation_scopes(rule_cache, selector, {});
 
-                bool added_to_bucket = false;
+            // NOTE: Rules with a pseudo-element never apply to the element's own style, which is all we share.
+            if (!matching_rule.contains_pseudo_element && selector_can_distinguish_identical_siblings(selector)) {
+                auto& blockers = rule_cache.style_sharing_blockers;
+                bool added_to_blockers = false;
                 for (auto const& simple_selector : selector.compound_selectors().last().simple_selectors) {
                     if (simple_selector.type == CSS::Selector::SimpleSelector::Type::Id) {
-                        rule_cache->rules_by_id.ensure(simple_selector.name()).append(move(matching_rule));
-                        ++num_id_rules;
-                        added_to_bucket = true;
+                        blockers.ids.set(simple_selector.name());
+                        added_to_blockers = true;
                         break;
                     }
                     if (simple_selector.type == CSS::Selector::SimpleSelector::Type::Class) {
-                        rule_cache->rules_by_class.ensure(simple_selector.name()).append(move(matching_rule));
-                        ++num_class_rules;
-                        added_to_bucket = true;
+                        blockers.classes.set(simple_selector.name());
+                        added_to_blockers = true;
                         break;
                     }
                     if (simple_selector.type == CSS::Selector::SimpleSelector::Type::TagName) {
-                        rule_cache->rules_by_tag_name.ensure(simple_selector.qualified_name().name.lowercase_name).append(move(matching_rule));
-                        ++num_tag_name_rules;
-                        added_to_bucket = true;
+                        blockers.tag_names.set(simple_selector.qualified_name().name.lowercase_name);
+                        added_to_blockers = true;
                         break;
                     }
                 }
-                if (!added_to_bucket) {
-                    if (matching_rule.contains_pseudo_element) {
-                        rule_cache->pseudo_element_rules.append(move(matching_rule));
-                    } else if (matching_rule.contains_root_pseudo_class) {
-                        rule_cache->root_rules.append(move(matching_rule));
-                    } else {
-                        for (auto const& simple_selector : selector.compound_selectors().last().simple_selectors) {
-                            if (simple_selector.type == CSS::Selector::SimpleSelector::Type::Attribute) {
-                                rule_cache->rules_by_attribute_name.ensure(simple_selector.attribute().qualified_name.name.lowercase_name).append(move(matching_rule));
-                                ++num_attribute_rules;
-                                added_to_bucket = true;
-                                break;
-                            }
-                        }
-                        if (!added_to_bucket) {
-                            rule_cache->other_rules.append(move(matching_rule));
+                if (!added_to_blockers) {
+                    for (auto const& simple_selector : selector.compound_selectors().last().simple_selectors) {
+                        if (simple_selector.type == CSS::Selector::SimpleSelector::Type::Attribute) {
+                            blockers.attribute_names.set(simple_selector.attribute().qualified_name.name.lowercase_name);
+                            added_to_blockers = true;
+                            break;
                         }
                     }
                 }
-
-                ++selector_index;
+                if (!added_to_blockers)
+                    blockers.any_element = true;
             }
-            ++rule_index;
-        });
 
-        // Loosely based on https://drafts.csswg.org/css-animations-2/#keyframe-processing
-        sheet.for_each_effective_keyframes_at_rule([&](CSSKeyframesRule const& rule) {
-            auto keyframe_set = adopt_ref(*new Animations::KeyframeEffect::KeyFrameSet);
-            HashTable<PropertyID> animated_properties;
-
-            // Forwards pass, resolve all the user-specified keyframe properties.
-            for (auto const& keyframe_rule : *rule.css_rules()) {
-                auto const& keyframe = verify_cast<CSSKeyframeRule>(*keyframe_rule);
-                Animations::KeyframeEffect::KeyFrameSet::ResolvedKeyFrame resolved_keyframe;
-
-                auto key = static_cast<u64>(keyframe.key().value() * Animations::KeyframeEffect::AnimationKeyFrameKeyScaleFactor);
-                auto const& keyframe_style = *keyframe.style_as_property_owning_style_declaration();
-                for (auto const& it : keyframe_style.properties()) {
-                    // Unresolved properties will be resolved in collect_animation_into()
-                    for_each_property_expanding_shorthands(it.property_id, it.value, AllowUnresolved::Yes, [&](PropertyID shorthand_id, StyleValue const& shorthand_value) {
-                        animated_properties.set(shorthand_id);
-                        resolved_keyframe.properties.set(shorthand_id, NonnullRefPtr<StyleValue const> { shorthand_value });
-                    });
+            bool added_to_bucket = false;
+            for (auto const& simple_selector : selector.compound_selectors().last().simple_selectors) {
+                if (simple_selector.type == CSS::Selector::SimpleSelector::Type::Id) {
+                    rule_cache.rules_by_id.ensure(simple_selector.name()).append(move(matching_rule));
+                    added_to_bucket = true;
+                    break;
+                }
+                if (simple_selector.type == CSS::Selector::SimpleSelector::Type::Class) {
+                    rule_cache.rules_by_class.ensure(simple_selector.name()).append(move(matching_rule));
+                    added_to_bucket = true;
+                    break;
+                }
+                if (simple_selector.type == CSS::Selector::SimpleSelector::Type::TagName) {
+                    rule_cache.rules_by_tag_name.ensure(simple_selector.qualified_name().name.lowercase_name).append(move(matching_rule));
+                    added_to_bucket = true;
+                    break;
+                }
+            }
+            if (!added_to_bucket) {
+                if (matching_rule.contains_pseudo_element) {
+                    rule_cache.pseudo_element_rules.append(move(matching_rule));
+                } else if (matching_rule.contains_root_pseudo_class) {
+                    rule_cache.root_rules.append(move(matching_rule));
+                } else {
+                    for (auto const& simple_selector : selector.compound_selectors().last().simple_selectors) {
+                        if (simple_selector.type == CSS::Selector::SimpleSelector::Type::Attribute) {
+                            rule_cache.rules_by_attribute_name.ensure(simple_selector.attribute().qualified_name.name.lowercase_name).append(move(matching_rule));
+                            added_to_bucket = true;
+                            break;
+                        }
+                    }
+                    if (!added_to_bucket) {
+                        rule_cache.other_rules.append(move(matching_rule));
+                    }
                 }
-
-                keyframe_set->keyframes_by_key.insert(key, resolved_keyframe);
             }
 
-            Animations::KeyframeEffect::generate_initial_and_final_frames(keyframe_set, animated_properties);
+            ++selector_index;
+        }
+        ++rule_index;
+    });
+
+    if (first_rule_index > 0) {
+        rule_cache.style_sheets.find(&sheet)->value.rule_count = rule_index;
+    } else {
+        auto result = rule_cache.style_sheets.set(&sheet, { shadow_root, style_sheet_index, rule_index });
+        if (result == HashSetResult::ReplacedExistingEntry)
+            rule_cache.style_sheets.find(&sheet)->value.is_used_more_than_once = true;
+    }
 
-            if constexpr (LIBWEB_CSS_DEBUG) {
-                dbgln("Resolved keyframe set '{}' into {} keyframes:", rule.name(), keyframe_set->keyframes_by_key.size());
-                for (auto it = keyframe_set->keyframes_by_key.begin(); it != keyframe_set->keyframes_by_key.end(); ++it)
-                    dbgln("    - keyframe {}: {} properties", it.key(), it->properties.size());
+    // NOTE: When appending rules to a sheet that's already in the cache, its keyframes have already been processed.
+    if (first_rule_index > 0)
+        return;
+
+    // Loosely based on https://drafts.csswg.org/css-animations-2/#keyframe-processing
+    sheet.for_each_effective_keyframes_at_rule([&](CSSKeyframesRule const& rule) {
+        auto keyframe_set = adopt_ref(*new Animations::KeyframeEffect::KeyFrameSet);
+        HashTable<PropertyID> animated_properties;
+
+        // Forwards pass, resolve all the user-specified keyframe properties.
+        for (auto const& keyframe_rule : *rule.css_rules()) {
+            auto const& keyframe = verify_cast<CSSKeyframeRule>(*keyframe_rule);
+            Animations::KeyframeEffect::KeyFrameSet::ResolvedKeyFrame resolved_keyframe;
+
+            auto key = static_cast<u64>(keyframe.key().value() * Animations::KeyframeEffect::AnimationKeyFrameKeyScaleFactor);
+            auto const& keyframe_style = *keyframe.style_as_property_owning_style_declaration();
+            for (auto const& it : keyframe_style.properties()) {
+                // Unresolved properties will be resolved in collect_animation_into()
+                for_each_property_expanding_shorthands(it.property_id, it.value, AllowUnresolved::Yes, [&](PropertyID shorthand_id, StyleValue const& shorthand_value) {
+                    animated_properties.set(shorthand_id);
+                    resolved_keyframe.properties.set(shorthand_id, NonnullRefPtr<StyleValue const> { shorthand_value });
+                });
             }
 
-            rule_cache->rules_by_animation_keyframes.set(rule.name(), move(keyframe_set));
-        });
-        ++style_sheet_index;
+            keyframe_set->keyframes_by_key.insert(key, resolved_keyframe);
+        }
+
+        Animations::KeyframeEffect::generate_initial_and_final_frames(keyframe_set, animated_properties);
+
+        if constexpr (LIBWEB_CSS_DEBUG) {
+            dbgln("Resolved keyframe set '{}' into {} keyframes:", rule.name(), keyframe_set->keyframes_by_key.size());
+            for (auto it = keyframe_set->keyframes_by_key.begin(); it != keyframe_set->keyframes_by_key.end(); ++it)
+                dbgln("    - keyframe {}: {} properties", it.key(), it->properties.size());
+        }
+
+        rule_cache.rules_by_animation_keyframes.set(rule.name(), move(keyframe_set));
+    });
+}
+
+NonnullOwnPtr<StyleComputer::RuleCache> StyleComputer::make_rule_cache_for_cascade_origin(CascadeOrigin cascade_origin)
+{
+    auto rule_cache = make<RuleCache>();
+
+    size_t style_sheet_index = 0;
+    for_each_stylesheet(cascade_origin, [&](auto& sheet, JS::GCPtr<DOM::ShadowRoot> shadow_root) {
+        add_style_sheet_to_rule_cache(*rule_cache, cascade_origin, sheet, shadow_root, style_sheet_index++);
     });
 
-    size_t total_rules = num_class_rules + num_id_rules + num_tag_name_rules + num_pseudo_element_rules + num_root_rules + num_attribute_rules + rule_cache->other_rules.size();
     if constexpr (LIBWEB_CSS_DEBUG) {
+        auto count_rules = [](auto const& rules_by_key) {
+            size_t count = 0;
+            for (auto const& it : rules_by_key)
+                count += it.value.size();
+            return count;
+        };
+        auto num_id_rules = count_rules(rule_cache->rules_by_id);
+        auto num_class_rules = count_rules(rule_cache->rules_by_class);
+        auto num_tag_name_rules = count_rules(rule_cache->rules_by_tag_name);
+        auto num_attribute_rules = count_rules(rule_cache->rules_by_attribute_name);
+        size_t total_rules = num_class_rules + num_id_rules + num_tag_name_rules + rule_cache->pseudo_element_rules.size() + rule_cache->root_rules.size() + num_attribute_rules + rule_cache->other_rules.size();
         dbgln("Built rule cache!");
         dbgln("           ID: {}", num_id_rules);
         dbgln("        Class: {}", num_class_rules);
         dbgln("      TagName: {}", num_tag_name_rules);
-        dbgln("PseudoElement: {}", num_pseudo_element_rules);
-        dbgln("         Root: {}", num_root_rules);
+        dbgln("PseudoElement: {}", rule_cache->pseudo_element_rules.size());
+        dbgln("         Root: {}", rule_cache->root_rules.size());
         dbgln("    Attribute: {}", num_attribute_rules);
         dbgln("        Other: {}", rule_cache->other_rules.size());
         dbgln("        Total: {}", total_rules);
@@ -2596,19 +2812,119 @@ NonnullOwnPtr<StyleComputer::RuleCache> StyleComputer::make_rule_cache_for_casca
     return rule_cache;
 }
 
+void StyleComputer::collect_invalidation_scopes(RuleCache& rule_cache, Selector const& selector, StyleInvalidationScope scope_of_subject)
+{
+    // Walking from the subject to the left, each combinator tells us how the next compound relates to the subject.
+    // A change to an ancestor can affect its descendants, and a change to a preceding sibling its following siblings.
+    auto scope = scope_of_subject;
+    auto const& compound_selectors = selector.compound_selectors();
+    for (size_t i = compound_selectors.size(); i > 0; --i) {
+        auto const& compound_selector = compound_selectors[i - 1];
+        for (auto const& simple_selector : compound_selector.simple_selectors) {
+            switch (simple_selector.type) {
+            case Selector::SimpleSelector::Type::Class:
+                rule_cache.invalidation_scopes_by_class.ensure(simple_selector.name()) |= scope;
+                break;
+            case Selector::SimpleSelector::Type::Id:
+                rule_cache.invalidation_scopes_by_id.ensure(simple_selector.name()) |= scope;
+                break;
+            case Selector::SimpleSelector::Type::Attribute:
+                rule_cache.invalidation_scopes_by_attribute_name.ensure(simple_selector.attribute().qualified_name.name.name) |= scope;
+                break;
+            case Selector::SimpleSelector::Type::PseudoClass: {
+                // NOTE: We don't track what the argument selectors of functional pseudo-classes are relative to,
+                //       so anything they mention may affect descendants and siblings. :has() may affect anything.
+                //       The selectors of :nth-last-child() and :nth-last-of-type() count the siblings that follow
+                //       the subject, so a change to one of those affects the siblings before it.
+                auto const& pseudo_class = simple_selector.pseudo_class();
+                auto argument_scope = scope;
+                if (pseudo_class.type == PseudoClass::Has) {
+                    argument_scope.whole_document = true;
+                } else {
+                    argument_scope.descendants = true;
+                    argument_scope.following_siblings = true;
+                    if (pseudo_class.type == PseudoClass::NthLastChild || pseudo_class.type == PseudoClass::NthLastOfType)
+                        argument_scope.preceding_siblings = true;
+                }
+                for (auto const& argument_selector : pseudo_class.argument_selector_list)
+                    collect_invalidation_scopes(rule_cache, *argument_selector, argument_scope);
+                break;
+            }
+            default:
+                break;
+            }
+        }
+
+        switch (compound_selector.combinator) {
+        case Selector::Combinator::None:
+            break;
+        case Selector::Combinator::ImmediateChild:
+        case Selector::Combinator::Descendant:
+            scope.descendants = true;
+            break;
+        case Selector::Combinator::NextSibling:
+        case Selector::Combinator::SubsequentSibling:
+            scope.following_siblings = true;
+            break;
+        case Selector::Combinator::Column:
+            scope.whole_document = true;
+            break;
+        }
+    }
+}
+
+Optional<StyleComputer::StyleInvalidationScope> StyleComputer::invalidation_scope_for_class_change(FlyString const& class_name) const
+{
+    if (!m_author_rule_cache || !m_user_rule_cache || !m_user_agent_rule_cache)
+        return {};
+
+    StyleInvalidationScope scope;
+    for (auto cascade_origin : { CascadeOrigin::UserAgent, CascadeOrigin::User, CascadeOrigin::Author }) {
+        auto const& rule_cache = rule_cache_for_cascade_origin(cascade_origin);
+        if (auto class_scope = rule_cache.invalidation_scopes_by_class.get(class_name); class_scope.has_value())
+            scope |= class_scope.value();
+        // NOTE: Attribute selectors like [class~=foo] see class changes too.
+        if (auto attribute_scope = rule_cache.invalidation_scopes_by_attribute_name.get(HTML::AttributeNames::class_); attribute_scope.has_value())
+            scope |= attribute_scope.value();
+    }
+    return scope;
+}
+
+Optional<StyleComputer::StyleInvalidationScope> StyleComputer::invalidation_scope_for_id_change(FlyString const& id) const
+{
+    if (!m_author_rule_cache || !m_user_rule_cache || !m_user_agent_rule_cache)
+        return {};
+
+    StyleInvalidationScope scope;
+    for (auto cascade_origin : { CascadeOrigin::UserAgent, CascadeOrigin::User, CascadeOrigin::Author }) {
+        auto const& rule_cache = rule_cache_for_cascade_origin(cascade_origin);
+        if (auto id_scope = rule_cache.invalidation_scopes_by_id.get(id); id_scope.has_value())
+            scope |= id_scope.value();
+        if (auto attribute_scope = rule_cache.invalidation_scopes_by_attribute_name.get(HTML::AttributeNames::id); attribute_scope.has_value())
+            scope |= attribute_scope.value();
+    }
+    return scope;
+}
+
 void StyleComputer::build_rule_cache()
 {
-    if (auto user_style_source = document().page().user_style(); user_style_source.has_value()) {
-        m_user_style_sheet = JS::make_handle(parse_css_stylesheet(CSS::Parser::ParsingContext(document()), user_style_source.value()));
+    if (!m_user_rule_cache) {
+        if (auto user_style_source = document().page().user_style(); user_style_source.has_value()) {
+            m_user_style_sheet = JS::make_handle(parse_css_stylesheet(CSS::Parser::ParsingContext(document()), user_style_source.value()));
+        }
+        m_user_rule_cache = make_rule_cache_for_cascade_origin(CascadeOrigin::User);
     }
 
-    m_author_rule_cache = make_rule_cache_for_cascade_origin(CascadeOrigin::Author);
-    m_user_rule_cache = make_rule_cache_for_cascade_origin(CascadeOrigin::User);
-    m_user_agent_rule_cache = make_rule_cache_for_cascade_origin(CascadeOrigin::UserAgent);
+    if (!m_author_rule_cache)
+        m_author_rule_cache = make_rule_cache_for_cascade_origin(CascadeOrigin::Author);
+    if (!m_user_agent_rule_cache)
+        m_user_agent_rule_cache = make_rule_cache_for_cascade_origin(CascadeOrigin::UserAgent);
 }
 
 void StyleComputer::invalidate_rule_cache()
 {
+    m_style_sharing_candidates.clear();
+
     m_author_rule_cache = nullptr;
 
     // NOTE: We could be smarter about keeping the user rule cache, and style sheet.
@@ -2622,6 +2938,68 @@ void StyleComputer::invalidate_rule_cache()
     m_user_agent_rule_cache = nullptr;
 }
 
+void StyleComputer::invalidate_author_rule_cache()
+{
+    m_style_sharing_candidates.clear();
+    m_author_rule_cache = nullptr;
+}
+
+void StyleComputer::did_add_style_sheet(CSSStyleSheet const& sheet)
+{
+    if (!m_author_rule_cache || m_author_rule_cache->style_sheets.contains(&sheet)) {
+        invalidate_author_rule_cache();
+        return;
+    }
+
+    // NOTE: Every sheet in the cache is indexed by its position in for_each_stylesheet() order, so a sheet that
+    //       comes last in that order cascades after every rule we already have and its rules can simply be appended.
+    //       Sheets anywhere else (including before any shadow root sheets) need a rebuild.
+    size_t style_sheet_index = 0;
+    CSSStyleSheet const* last_sheet = nullptr;
+    JS::GCPtr<DOM::ShadowRoot> last_sheet_shadow_root;
+    for_each_stylesheet(CascadeOrigin::Author, [&](CSSStyleSheet& author_sheet, JS::GCPtr<DOM::ShadowRoot> shadow_root) {
+        if (last_sheet)
+            ++style_sheet_index;
+        last_sheet = &author_sheet;
+        last_sheet_shadow_root = shadow_root;
+    });
+    if (last_sheet != &sheet) {
+        invalidate_author_rule_cache();
+        return;
+    }
+
+    m_style_sharing_candidates.clear();
+    add_style_sheet_to_rule_cache(*m_author_rule_cache, CascadeOrigin::Author, sheet, last_sheet_shadow_root, style_sheet_index);
+}
+
+void StyleComputer::did_remove_style_sheet(CSSStyleSheet const& sheet)
+{
+    // NOTE: Removing a cached sheet shifts the position of every sheet after it, so the indices no longer match.
+    if (m_author_rule_cache && m_author_rule_cache->style_sheets.contains(&sheet))
+        invalidate_author_rule_cache();
+}
+
+void StyleComputer::did_insert_rule(CSSStyleSheet const& sheet, CSSRule const& rule, size_t index)
+{
+    if (!m_author_rule_cache)
+        return;
+
+    // NOTE: A style rule appended to the end of a sheet cascades after all of that sheet's rules,
+    //       so it can be added with the sheet's existing index. Anything else needs a rebuild.
+    auto it = m_author_rule_cache->style_sheets.find(&sheet);
+    if (it == m_author_rule_cache->style_sheets.end()
+        || it->value.is_used_more_than_once
+        || it->value.rule_count == 0
+        || rule.type() != CSSRule::Type::Style
+        || index + 1 != sheet.rules().length()) {
+        invalidate_author_rule_cache();
+        return;
+    }
+
+    m_style_sharing_candidates.clear();
+    add_style_sheet_to_rule_cache(*m_author_rule_cache, CascadeOrigin::Author, sheet, it->value.shadow_root, it->value.style_sheet_index, it->value.rule_count);
+}
+
 void StyleComputer::did_load_font(FlyString const&)
 {
     document().invalidate_style();
@@ -2745,11 +3123,20 @@ static void for_each_element_hash(DOM::Element const& element, auto callback)
 
 void StyleComputer::reset_ancestor_filter()
 {
+    if constexpr (LIBWEB_CSS_DEBUG) {
+        auto const& statistics = m_ancestor_filter_statistics;
+        if (statistics.checks > 0)
+            dbgln("Ancestor filter rejected {} of {} selectors ({}%)", statistics.rejections, statistics.checks, statistics.rejections * 100 / statistics.checks);
+        m_ancestor_filter_statistics = {};
+    }
+
     m_ancestor_filter.clear();
+    m_ancestor_filter_depth = 0;
 }
 
 void StyleComputer::push_ancestor(DOM::Element const& element)
 {
+    ++m_ancestor_filter_depth;
     for_each_element_hash(element, [&](u32 hash) {
         m_ancestor_filter.increment(hash);
     });
@@ -2757,6 +3144,7 @@ void StyleComputer::push_ancestor(DOM::Element const& element)
 
 void StyleComputer::pop_ancestor(DOM::Element const& element)
 {
+    --m_ancestor_filter_depth;
     for_each_element_hash(element, [&](u32 hash) {
         m_ancestor_filter.decrement(hash);
     });
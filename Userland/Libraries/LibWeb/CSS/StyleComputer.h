@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AK/HashMap.h>
+#include <AK/HashTable.h>
 #include <AK/Optional.h>
 #include <AK/OwnPtr.h>
 #include <LibGfx/Font/Typeface.h>
@@ -95,6 +96,10 @@ struct MatchingRule {
     bool can_use_fast_matches { false };
 };
 
+// NOTE: Most elements only match a handful of rules from each cascade origin, so the rules matched while computing
+//       an element's style are kept in inline storage instead of allocating a fresh buffer for every element.
+using MatchingRuleList = Vector<MatchingRule, 32>;
+
 struct FontFaceKey {
     FlyString family_name;
     int weight { 0 };
@@ -131,9 +136,37 @@ public:
     NonnullRefPtr<StyleProperties> compute_style(DOM::Element&, Optional<CSS::Selector::PseudoElement::Type> = {}) const;
     RefPtr<StyleProperties> compute_pseudo_element_style_if_needed(DOM::Element&, Optional<CSS::Selector::PseudoElement::Type>) const;
 
-    Vector<MatchingRule> collect_matching_rules(DOM::Element const&, CascadeOrigin, Optional<CSS::Selector::PseudoElement::Type>) const;
+    MatchingRuleList collect_matching_rules(DOM::Element const&, CascadeOrigin, Optional<CSS::Selector::PseudoElement::Type>) const;
 
     void invalidate_rule_cache();
+    void invalidate_author_rule_cache();
+
+    // These update the author rule cache in place when the change only appends rules at the end of the cascade,
+    // and fall back to invalidating it otherwise.
+    void did_add_style_sheet(CSSStyleSheet const&);
+    void did_remove_style_sheet(CSSStyleSheet const&);
+    void did_insert_rule(CSSStyleSheet const&, CSSRule const&, size_t index);
+
+    // Describes which other elements may need their style recomputed when a class or id is added to or removed from
+    // an element, based on where that class or id appears in selectors. The element itself always needs an update.
+    struct StyleInvalidationScope {
+        bool descendants { false };
+        bool following_siblings { false };
+        bool preceding_siblings { false };
+        bool whole_document { false };
+
+        void operator|=(StyleInvalidationScope const& other)
+        {
+            descendants |= other.descendants;
+            following_siblings |= other.following_siblings;
+            preceding_siblings |= other.preceding_siblings;
+            whole_document |= other.whole_document;
+        }
+    };
+
+    // NOTE: These return an empty Optional if the rule cache hasn't been built, in which case nothing is known.
+    [[nodiscard]] Optional<StyleInvalidationScope> invalidation_scope_for_class_change(FlyString const& class_name) const;
+    [[nodiscard]] Optional<StyleInvalidationScope> invalidation_scope_for_id_change(FlyString const& id) const;
 
     Gfx::Font const& initial_font() const;
 
@@ -147,6 +180,10 @@ public:
 
     void set_viewport_rect(Badge<DOM::Document>, CSSPixelRect const& viewport_rect) { m_viewport_rect = viewport_rect; }
 
+    // NOTE: Style sharing is only enabled for the duration of a single style update pass,
+    //       since the shared styles are only valid as long as nothing in the DOM changes.
+    void set_style_sharing_enabled(Badge<DOM::Document>, bool);
+
     enum class AnimationRefresh {
         No,
         Yes,
@@ -187,16 +224,20 @@ private:
     [[nodiscard]] Length::FontMetrics calculate_root_element_font_metrics(StyleProperties const&) const;
 
     struct MatchingRuleSet {
-        Vector<MatchingRule> user_agent_rules;
-        Vector<MatchingRule> user_rules;
-        Vector<MatchingRule> author_rules;
+        MatchingRuleList user_agent_rules;
+        MatchingRuleList user_rules;
+        MatchingRuleList author_rules;
     };
 
-    void cascade_declarations(StyleProperties&, DOM::Element&, Optional<CSS::Selector::PseudoElement::Type>, Vector<MatchingRule> const&, CascadeOrigin, Important) const;
+    void cascade_declarations(StyleProperties&, DOM::Element&, Optional<CSS::Selector::PseudoElement::Type>, ReadonlySpan<MatchingRule>, CascadeOrigin, Important) const;
 
     void build_rule_cache();
     void build_rule_cache_if_needed() const;
 
+    [[nodiscard]] bool can_share_style(DOM::Element const&) const;
+    RefPtr<StyleProperties> find_shared_style(DOM::Element&) const;
+    void remember_style_for_sharing(DOM::Element const&, StyleProperties const&) const;
+
     JS::NonnullGCPtr<DOM::Document> m_document;
 
     struct RuleCache {
@@ -209,9 +250,33 @@ private:
         Vector<MatchingRule> other_rules;
 
         HashMap<FlyString, NonnullRefPtr<Animations::KeyframeEffect::KeyFrameSet>> rules_by_animation_keyframes;
+
+        // Selectors whose subject could match one of two siblings with identical tag names and attributes, but not the other.
+        // These are bucketed like the rules above, so that only elements they could apply to are kept from sharing style.
+        struct {
+            HashTable<FlyString> ids;
+            HashTable<FlyString> classes;
+            HashTable<FlyString> tag_names;
+            HashTable<FlyString, AK::ASCIICaseInsensitiveFlyStringTraits> attribute_names;
+            bool any_element { false };
+        } style_sharing_blockers;
+
+        HashMap<FlyString, StyleInvalidationScope> invalidation_scopes_by_class;
+        HashMap<FlyString, StyleInvalidationScope> invalidation_scopes_by_id;
+        HashMap<FlyString, StyleInvalidationScope, AK::ASCIICaseInsensitiveFlyStringTraits> invalidation_scopes_by_attribute_name;
+
+        struct StyleSheetInfo {
+            JS::GCPtr<DOM::ShadowRoot> shadow_root;
+            size_t style_sheet_index { 0 };
+            size_t rule_count { 0 };
+            bool is_used_more_than_once { false };
+        };
+        HashMap<CSSStyleSheet const*, StyleSheetInfo> style_sheets;
     };
 
     NonnullOwnPtr<RuleCache> make_rule_cache_for_cascade_origin(CascadeOrigin);
+    static void add_style_sheet_to_rule_cache(RuleCache&, CascadeOrigin, CSSStyleSheet const&, JS::GCPtr<DOM::ShadowRoot>, size_t style_sheet_index, size_t first_rule_index = 0);
+    static void collect_invalidation_scopes(RuleCache&, Selector const&, StyleInvalidationScope scope_of_subject);
 
     RuleCache const& rule_cache_for_cascade_origin(CascadeOrigin) const;
 
@@ -229,6 +294,21 @@ private:
     CSSPixelRect m_viewport_rect;
 
     CountingBloomFilter<u8, 14> m_ancestor_filter;
+    size_t m_ancestor_filter_depth { 0 };
+
+    struct AncestorFilterStatistics {
+        size_t checks { 0 };
+        size_t rejections { 0 };
+    };
+    mutable AncestorFilterStatistics m_ancestor_filter_statistics;
+
+    struct StyleSharingCandidate {
+        JS::GCPtr<DOM::Element const> element;
+        NonnullRefPtr<StyleProperties> style;
+    };
+    static constexpr size_t max_style_sharing_candidates = 8;
+    bool m_style_sharing_enabled { false };
+    mutable Vector<StyleSharingCandidate, max_style_sharing_candidates> m_style_sharing_candidates;
 };
 
 class FontLoader : public ResourceClient {
@@ -30,6 +30,11 @@ RequiredInvalidationAfterStyleChange compute_property_invalidation(CSS::Property
         return RequiredInvalidationAfterStyleChange::full();
     }
 
+    // NOTE: content-visibility decides whether an element's descendants get boxes at all, so it also requires a layout tree rebuild.
+    if (property_id == CSS::PropertyID::ContentVisibility) {
+        return RequiredInvalidationAfterStyleChange::full();
+    }
+
     // OPTIMIZATION: Special handling for CSS `visibility`:
     if (property_id == CSS::PropertyID::Visibility) {
         // We don't need to relayout if the visibility changes from visible to hidden or vice versa. Only collapse requires relayout.
@@ -11,6 +11,7 @@
 #include <LibWeb/CSS/StyleProperties.h>
 #include <LibWeb/CSS/StyleValues/AngleStyleValue.h>
 #include <LibWeb/CSS/StyleValues/ContentStyleValue.h>
+#include <LibWeb/CSS/StyleValues/CustomIdentStyleValue.h>
 #include <LibWeb/CSS/StyleValues/DisplayStyleValue.h>
 #include <LibWeb/CSS/StyleValues/GridAutoFlowStyleValue.h>
 #include <LibWeb/CSS/StyleValues/GridTemplateAreaStyleValue.h>
@@ -34,19 +35,40 @@
 
 namespace Web::CSS {
 
+NonnullRefPtr<StyleProperties> StyleProperties::clone() const
+{
+    auto clone = create();
+    clone->m_data = m_data;
+    clone->m_animated_property_values = m_animated_property_values;
+    clone->m_math_depth = m_math_depth;
+    clone->m_font_list = m_font_list;
+    clone->m_line_height = m_line_height;
+    return clone;
+}
+
+auto StyleProperties::mutable_property_values() -> PropertyValues&
+{
+    if (m_data->ref_count() > 1) {
+        auto data = adopt_ref(*new Data);
+        data->property_values = m_data->property_values;
+        m_data = move(data);
+    }
+    return m_data->property_values;
+}
+
 bool StyleProperties::is_property_important(CSS::PropertyID property_id) const
 {
-    return m_property_values[to_underlying(property_id)].style && m_property_values[to_underlying(property_id)].important == Important::Yes;
+    return m_data->property_values[to_underlying(property_id)].style && m_data->property_values[to_underlying(property_id)].important == Important::Yes;
 }
 
 bool StyleProperties::is_property_inherited(CSS::PropertyID property_id) const
 {
-    return m_property_values[to_underlying(property_id)].style && m_property_values[to_underlying(property_id)].inherited == Inherited::Yes;
+    return m_data->property_values[to_underlying(property_id)].style && m_data->property_values[to_underlying(property_id)].inherited == Inherited::Yes;
 }
 
 void StyleProperties::set_property(CSS::PropertyID id, NonnullRefPtr<StyleValue const> value, CSS::CSSStyleDeclaration const* source_declaration, Inherited inherited, Important important)
 {
-    m_property_values[to_underlying(id)] = StyleAndSourceDeclaration { move(value), source_declaration, important, inherited };
+    mutable_property_values()[to_underlying(id)] = StyleAndSourceDeclaration { move(value), source_declaration, important, inherited };
 }
 
 void StyleProperties::set_animated_property(CSS::PropertyID id, NonnullRefPtr<StyleValue const> value)
@@ -65,19 +87,19 @@ NonnullRefPtr<StyleValue const> StyleProperties::property(CSS::PropertyID proper
         return *animated_value;
 
     // By the time we call this method, all properties have values assigned.
-    return *m_property_values[to_underlying(property_id)].style;
+    return *m_data->property_values[to_underlying(property_id)].style;
 }
 
 RefPtr<StyleValue const> StyleProperties::maybe_null_property(CSS::PropertyID property_id) const
 {
     if (auto animated_value = m_animated_property_values.get(property_id).value_or(nullptr))
         return *animated_value;
-    return m_property_values[to_underlying(property_id)].style;
+    return m_data->property_values[to_underlying(property_id)].style;
 }
 
 CSS::CSSStyleDeclaration const* StyleProperties::property_source_declaration(CSS::PropertyID property_id) const
 {
-    return m_property_values[to_underlying(property_id)].declaration;
+    return m_data->property_values[to_underlying(property_id)].declaration;
 }
 
 CSS::Size StyleProperties::size_value(CSS::PropertyID id) const
@@ -510,6 +532,28 @@ Vector<CSS::Transformation> StyleProperties::transformations() const
     return transformations_for_style_value(property(CSS::PropertyID::Transform));
 }
 
+Vector<CSS::PropertyID> StyleProperties::will_change() const
+{
+    // NOTE: We only keep the properties that are named in will-change. `scroll-position`, `contents` and
+    //       identifiers that aren't CSS properties are valid, but we don't do anything with them.
+    Vector<CSS::PropertyID> properties;
+    auto append_property = [&](StyleValue const& value) {
+        if (!value.is_custom_ident())
+            return;
+        if (auto property_id = property_id_from_string(value.as_custom_ident().custom_ident()); property_id.has_value())
+            properties.append(property_id.value());
+    };
+
+    auto value = property(CSS::PropertyID::WillChange);
+    if (value->is_value_list()) {
+        for (auto const& item : value->as_value_list().values())
+            append_property(item);
+    } else {
+        append_property(value);
+    }
+    return properties;
+}
+
 static Optional<LengthPercentage> length_percentage_for_style_value(StyleValue const& value)
 {
     if (value.is_length())
@@ -611,12 +655,15 @@ Optional<CSS::Positioning> StyleProperties::position() const
 
 bool StyleProperties::operator==(StyleProperties const& other) const
 {
-    if (m_property_values.size() != other.m_property_values.size())
-        return false;
+    if (m_data == other.m_data)
+        return true;
 
-    for (size_t i = 0; i < m_property_values.size(); ++i) {
-        auto const& my_style = m_property_values[i];
-        auto const& other_style = other.m_property_values[i];
+    auto const& property_values = m_data->property_values;
+    auto const& other_property_values = other.m_data->property_values;
+
+    for (size_t i = 0; i < property_values.size(); ++i) {
+        auto const& my_style = property_values[i];
+        auto const& other_style = other_property_values[i];
         if (!my_style.style) {
             if (other_style.style)
                 return false;
@@ -689,6 +736,12 @@ Optional<CSS::Clear> StyleProperties::clear() const
     return value_id_to_clear(value->to_identifier());
 }
 
+Optional<CSS::ContentVisibility> StyleProperties::content_visibility() const
+{
+    auto value = property(CSS::PropertyID::ContentVisibility);
+    return value_id_to_content_visibility(value->to_identifier());
+}
+
 StyleProperties::ContentDataAndQuoteNestingLevel StyleProperties::content(u32 initial_quote_nesting_level) const
 {
     auto value = property(CSS::PropertyID::Content);
@@ -24,12 +24,15 @@ public:
 
     static NonnullRefPtr<StyleProperties> create() { return adopt_ref(*new StyleProperties); }
 
+    NonnullRefPtr<StyleProperties> clone() const;
+
     template<typename Callback>
     inline void for_each_property(Callback callback) const
     {
-        for (size_t i = 0; i < m_property_values.size(); ++i) {
-            if (m_property_values[i].style)
-                callback((CSS::PropertyID)i, *m_property_values[i].style);
+        auto const& property_values = m_data->property_values;
+        for (size_t i = 0; i < property_values.size(); ++i) {
+            if (property_values[i].style)
+                callback((CSS::PropertyID)i, *property_values[i].style);
         }
     }
 
@@ -51,8 +54,8 @@ public:
     };
     using PropertyValues = Array<StyleAndSourceDeclaration, to_underlying(CSS::last_property_id) + 1>;
 
-    auto& properties() { return m_property_values; }
-    auto const& properties() const { return m_property_values; }
+    auto& properties() { return mutable_property_values(); }
+    auto const& properties() const { return m_data->property_values; }
 
     HashMap<CSS::PropertyID, NonnullRefPtr<StyleValue const>> const& animated_property_values() const { return m_animated_property_values; }
     void reset_animated_properties();
@@ -81,6 +84,7 @@ public:
     CSS::Display display() const;
     Optional<CSS::Float> float_() const;
     Optional<CSS::Clear> clear() const;
+    Optional<CSS::ContentVisibility> content_visibility() const;
     struct ContentDataAndQuoteNestingLevel {
         CSS::ContentData content_data;
         u32 final_quote_nesting_level { 0 };
@@ -139,6 +143,7 @@ public:
 
     static Vector<CSS::Transformation> transformations_for_style_value(StyleValue const& value);
     Vector<CSS::Transformation> transformations() const;
+    Vector<CSS::PropertyID> will_change() const;
     Optional<CSS::TransformBox> transform_box() const;
     CSS::TransformOrigin transform_origin() const;
 
@@ -188,7 +193,14 @@ public:
 private:
     friend class StyleComputer;
 
-    PropertyValues m_property_values;
+    // NOTE: The property values are shared between clones, and only copied once one of them is modified.
+    //       This makes clone() cheap, which style sharing and cascade_declarations() rely on.
+    struct Data : public RefCounted<Data> {
+        PropertyValues property_values;
+    };
+    PropertyValues& mutable_property_values();
+
+    NonnullRefPtr<Data> m_data { adopt_ref(*new Data) };
     HashMap<CSS::PropertyID, NonnullRefPtr<StyleValue const>> m_animated_property_values;
 
     Optional<CSS::Overflow> overflow(CSS::PropertyID) const;
@@ -107,7 +107,7 @@ void StyleSheetList::add_sheet(CSSStyleSheet& sheet)
         return;
     }
 
-    m_document->style_computer().invalidate_rule_cache();
+    m_document->style_computer().did_add_style_sheet(sheet);
     m_document->style_computer().load_fonts_from_sheet(sheet);
     m_document->invalidate_style();
 }
@@ -118,11 +118,12 @@ void StyleSheetList::remove_sheet(CSSStyleSheet& sheet)
     m_sheets.remove_first_matching([&](auto& entry) { return entry.ptr() == &sheet; });
 
     if (sheet.rules().length() == 0) {
-        // NOTE: If the removed sheet had no rules, we don't have to invalidate anything.
+        // NOTE: If the removed sheet had no rules, we don't have to invalidate any styles.
+        m_document->style_computer().did_remove_style_sheet(sheet);
         return;
     }
 
-    m_document->style_computer().invalidate_rule_cache();
+    m_document->style_computer().invalidate_author_rule_cache();
     m_document->invalidate_style();
 }
 
@@ -8,6 +8,7 @@
  */
 
 #include "IdentifierStyleValue.h"
+#include <AK/Array.h>
 #include <LibGfx/Palette.h>
 #include <LibWeb/CSS/SystemColor.h>
 #include <LibWeb/DOM/Document.h>
@@ -16,6 +17,16 @@
 
 namespace Web::CSS {
 
+ValueComparingNonnullRefPtr<IdentifierStyleValue> IdentifierStyleValue::create(ValueID id)
+{
+    // NOTE: Identifiers are immutable and there are only a few hundred of them, so we share one instance of each.
+    static Array<RefPtr<IdentifierStyleValue>, to_underlying(last_value_id) + 1> values;
+    auto& value = values[to_underlying(id)];
+    if (!value)
+        value = adopt_ref(*new (nothrow) IdentifierStyleValue(id));
+    return *value;
+}
+
 String IdentifierStyleValue::to_string() const
 {
     return MUST(String::from_utf8(CSS::string_from_value_id(m_id)));
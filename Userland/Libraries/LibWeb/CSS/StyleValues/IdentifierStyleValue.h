@@ -16,10 +16,7 @@ namespace Web::CSS {
 
 class IdentifierStyleValue final : public StyleValueWithDefaultOperators<IdentifierStyleValue> {
 public:
-    static ValueComparingNonnullRefPtr<IdentifierStyleValue> create(ValueID id)
-    {
-        return adopt_ref(*new (nothrow) IdentifierStyleValue(id));
-    }
+    static ValueComparingNonnullRefPtr<IdentifierStyleValue> create(ValueID);
     virtual ~IdentifierStyleValue() override = default;
 
     ValueID id() const { return m_id; }
@@ -14,6 +14,14 @@ class IntegerStyleValue : public StyleValueWithDefaultOperators<IntegerStyleValu
 public:
     static ValueComparingNonnullRefPtr<IntegerStyleValue> create(i64 value)
     {
+        if (value == 0) {
+            static auto zero = adopt_ref(*new (nothrow) IntegerStyleValue(0));
+            return zero;
+        }
+        if (value == 1) {
+            static auto one = adopt_ref(*new (nothrow) IntegerStyleValue(1));
+            return one;
+        }
         return adopt_ref(*new (nothrow) IntegerStyleValue(value));
     }
 
@@ -17,6 +17,15 @@ class NumberStyleValue : public StyleValueWithDefaultOperators<NumberStyleValue>
 public:
     static ValueComparingNonnullRefPtr<NumberStyleValue> create(double value)
     {
+        // NOTE: -0 is also == 0, but it must keep its sign.
+        if (value == 0 && !__builtin_signbit(value)) {
+            static auto zero = adopt_ref(*new (nothrow) NumberStyleValue(0));
+            return zero;
+        }
+        if (value == 1) {
+            static auto one = adopt_ref(*new (nothrow) NumberStyleValue(1));
+            return one;
+        }
         return adopt_ref(*new (nothrow) NumberStyleValue(value));
     }
 
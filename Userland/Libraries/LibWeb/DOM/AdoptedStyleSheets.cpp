@@ -31,12 +31,12 @@ JS::NonnullGCPtr<WebIDL::ObservableArray> create_adopted_style_sheets_list(Docum
             return WebIDL::NotAllowedError::create(document.realm(), "Sharing a StyleSheet between documents is not allowed."_fly_string);
 
         document.style_computer().load_fonts_from_sheet(style_sheet);
-        document.style_computer().invalidate_rule_cache();
+        document.style_computer().invalidate_author_rule_cache();
         document.invalidate_style();
         return {};
     });
     adopted_style_sheets->set_on_delete_an_indexed_value_callback([&document]() -> WebIDL::ExceptionOr<void> {
-        document.style_computer().invalidate_rule_cache();
+        document.style_computer().invalidate_author_rule_cache();
         document.invalidate_style();
         return {};
     });
@@ -8,13 +8,16 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
 #include <AK/CharacterTypes.h>
 #include <AK/Debug.h>
 #include <AK/GenericLexer.h>
 #include <AK/InsertionSort.h>
 #include <AK/StringBuilder.h>
 #include <AK/Utf8View.h>
+#include <LibCore/ElapsedTimer.h>
 #include <LibCore/Timer.h>
+#include <LibCore/TraceEvent.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/FunctionObject.h>
 #include <LibJS/Runtime/NativeFunction.h>
@@ -29,6 +32,7 @@
 #include <LibWeb/CSS/FontFaceSet.h>
 #include <LibWeb/CSS/MediaQueryList.h>
 #include <LibWeb/CSS/MediaQueryListEvent.h>
+#include <LibWeb/CSS/Parser/Parser.h>
 #include <LibWeb/CSS/StyleComputer.h>
 #include <LibWeb/CSS/SystemColor.h>
 #include <LibWeb/CSS/VisualViewport.h>
@@ -97,6 +101,8 @@
 #include <LibWeb/HTML/Scripting/ClassicScript.h>
 #include <LibWeb/HTML/Scripting/ExceptionReporter.h>
 #include <LibWeb/HTML/Scripting/WindowEnvironmentSettingsObject.h>
+#include <LibWeb/HTML/SharedImageRequest.h>
+#include <LibWeb/HTML/StorageBottle.h>
 #include <LibWeb/HTML/TraversableNavigable.h>
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/HTML/WindowProxy.h>
@@ -311,6 +317,9 @@ WebIDL::ExceptionOr<JS::NonnullGCPtr<Document>> Document::create_and_initialize(
     // 11. Set window's associated Document to document.
     window->set_associated_document(*document);
 
+    // AD-HOC: Start loading the localStorage of the document's origin, so that its first use doesn't wait for the browser.
+    HTML::StorageBottle::preload_local_storage_bottle(window->page(), document->origin());
+
     // FIXME: 12. Run CSP initialization for a Document given document.
 
     // 13. If navigationParams's request is non-null, then:
@@ -479,6 +488,7 @@ void Document::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_adopted_style_sheets);
 
     visitor.visit(m_shadow_roots);
+    visitor.visit(m_content_visibility_auto_elements);
 
     visitor.visit(m_top_layer_elements);
     visitor.visit(m_top_layer_pending_removals);
@@ -915,6 +925,8 @@ void Document::tear_down_layout_tree()
 {
     m_layout_root = nullptr;
     m_paintable = nullptr;
+    m_next_layout_node_index = 0;
+    m_content_visibility_auto_elements.clear();
 }
 
 Color Document::background_color() const
@@ -1009,11 +1021,53 @@ URL::URL Document::parse_url(StringView url) const
     // 1. Let baseURL be environment's base URL, if environment is a Document object; otherwise environment's API base URL.
     auto base_url = this->base_url();
 
+    // NOTE: Compare the serialized base URL, since URL's operator== serializes both sides and never matches an invalid URL.
+    auto serialized_base_url = base_url.serialize();
+    if (m_parsed_url_cache_base_url != serialized_base_url) {
+        m_parsed_url_cache.clear();
+        m_parsed_url_cache_base_url = move(serialized_base_url);
+    }
+    if (auto it = m_parsed_url_cache.find(url); it != m_parsed_url_cache.end())
+        return it->value;
+
     // 2. Return the result of applying the URL parser to url, with baseURL.
-    return DOMURL::parse(url, base_url);
+    auto parsed_url = DOMURL::parse(url, base_url);
+
+    // NOTE: Blob URLs are resolved against the blob URL store, which can change at any time, so they are not cached.
+    if (parsed_url.scheme() != "blob"sv) {
+        if (auto key = String::from_utf8(url); !key.is_error()) {
+            if (m_parsed_url_cache.size() >= max_parsed_url_cache_size)
+                m_parsed_url_cache.clear();
+            m_parsed_url_cache.set(key.release_value(), parsed_url);
+        }
+    }
+    return parsed_url;
+}
+
+Optional<CSS::SelectorList> Document::parse_selector_list(StringView selector_text) const
+{
+    if (auto it = m_parsed_selector_cache.find(selector_text); it != m_parsed_selector_cache.end())
+        return it->value;
+
+    auto selectors = parse_selector(CSS::Parser::ParsingContext(*this), selector_text);
+    if (!selectors.has_value())
+        return {};
+
+    if (auto key = String::from_utf8(selector_text); !key.is_error()) {
+        if (m_parsed_selector_cache.size() >= max_parsed_selector_cache_size)
+            m_parsed_selector_cache.clear();
+        m_parsed_selector_cache.set(key.release_value(), *selectors);
+    }
+    return selectors;
 }
 
 void Document::set_needs_layout()
+{
+    ++m_intrinsic_sizes_generation;
+    set_needs_layout_for_viewport_resize();
+}
+
+void Document::set_needs_layout_for_viewport_resize()
 {
     if (m_needs_layout)
         return;
@@ -1091,6 +1145,9 @@ void Document::update_layout()
     if (!navigable)
         return;
 
+    TRACE_EVENT_SCOPE("layout"sv, "Document::update_layout"sv);
+    auto layout_timer = Core::ElapsedTimer::start_new();
+
     auto* document_element = this->document_element();
     auto viewport_rect = this->viewport_rect();
 
@@ -1104,6 +1161,13 @@ void Document::update_layout()
         }
     }
 
+    // FIXME: We always lay out the whole tree from the viewport down, even if only a single box changed.
+    //        Doing less would need:
+    //        - Per-box "needs layout" and "child needs layout" bits, set when a box is invalidated and propagated to ancestors.
+    //        - A LayoutState that outlives a single pass, so the UsedValues of clean subtrees are still around to reuse.
+    //          Right now it is created here and thrown away after commit(), which also recreates every paintable.
+    //        - Formatting contexts that skip a clean child whose available space and containing block haven't changed,
+    //          and take its previous size and position instead of running layout inside it.
     Layout::LayoutState layout_state;
 
     {
@@ -1127,6 +1191,14 @@ void Document::update_layout()
                 Layout::AvailableSize::make_definite(viewport_rect.height())));
     }
 
+    if constexpr (LIBWEB_CSS_DEBUG) {
+        // NOTE: Nested grids are counted both on their own and as part of their ancestor grid's time.
+        auto const& grid_layout_statistics = layout_state.grid_layout_statistics();
+        page().current_frame_timings().grid_layout += grid_layout_statistics.elapsed_time;
+        if (grid_layout_statistics.layout_count > 0)
+            dbgln("Layout: {} grid layouts took {}us", grid_layout_statistics.layout_count, grid_layout_statistics.elapsed_time.to_microseconds());
+    }
+
     layout_state.commit(*m_layout_root);
 
     // Broadcast the current viewport rect to any new paintables, so they know whether they're visible or not.
@@ -1148,13 +1220,15 @@ void Document::update_layout()
 
     m_needs_layout = false;
 
+    page().current_frame_timings().layout += layout_timer.elapsed_time();
+
     // Scrolling by zero offset will clamp scroll offset back to valid range if it was out of bounds
     // after the viewport size change.
     if (auto window = this->window())
         window->scroll_by(0, 0);
 }
 
-[[nodiscard]] static CSS::RequiredInvalidationAfterStyleChange update_style_recursively(Node& node, CSS::StyleComputer& style_computer)
+[[nodiscard]] static CSS::RequiredInvalidationAfterStyleChange update_style_recursively(Node& node, CSS::StyleComputer& style_computer, bool parent_style_changed = false)
 {
     bool const needs_full_style_update = node.document().needs_full_style_update();
     CSS::RequiredInvalidationAfterStyleChange invalidation;
@@ -1167,17 +1241,28 @@ void Document::update_layout()
     //       We will still recompute style for the children, though.
     bool is_display_none = false;
 
+    // NOTE: If the element's style changed, its children have to be updated as well, since they may inherit from it.
+    //       Non-element nodes (like shadow roots) pass this on to their children.
+    bool children_need_style_update = !is<Element>(node) && parent_style_changed;
+
     if (is<Element>(node)) {
-        invalidation |= static_cast<Element&>(node).recompute_style();
-        is_display_none = static_cast<Element&>(node).computed_css_values()->display().is_none();
+        auto& element = static_cast<Element&>(node);
+        auto element_invalidation = element.recompute_style();
+        children_need_style_update = !element_invalidation.is_none();
+        invalidation |= element_invalidation;
+        is_display_none = element.computed_css_values()->display().is_none();
+
+        // NOTE: var() is resolved against the custom properties of all ancestors, so if those changed, the whole subtree needs an update.
+        if (element.take_custom_properties_changed())
+            element.invalidate_style();
     }
     node.set_needs_style_update(false);
 
-    if (needs_full_style_update || node.child_needs_style_update()) {
+    if (needs_full_style_update || children_need_style_update || node.child_needs_style_update()) {
         if (node.is_element()) {
             if (auto shadow_root = static_cast<DOM::Element&>(node).shadow_root()) {
-                if (needs_full_style_update || shadow_root->needs_style_update() || shadow_root->child_needs_style_update()) {
-                    auto subtree_invalidation = update_style_recursively(*shadow_root, style_computer);
+                if (needs_full_style_update || children_need_style_update || shadow_root->needs_style_update() || shadow_root->child_needs_style_update()) {
+                    auto subtree_invalidation = update_style_recursively(*shadow_root, style_computer, children_need_style_update);
                     if (!is_display_none)
                         invalidation |= subtree_invalidation;
                 }
@@ -1185,8 +1270,8 @@ void Document::update_layout()
         }
 
         node.for_each_child([&](auto& child) {
-            if (needs_full_style_update || child.needs_style_update() || child.child_needs_style_update()) {
-                auto subtree_invalidation = update_style_recursively(child, style_computer);
+            if (needs_full_style_update || children_need_style_update || child.needs_style_update() || child.child_needs_style_update()) {
+                auto subtree_invalidation = update_style_recursively(child, style_computer, children_need_style_update);
                 if (!is_display_none)
                     invalidation |= subtree_invalidation;
             }
@@ -1220,6 +1305,9 @@ void Document::update_style()
     if (m_created_for_appropriate_template_contents)
         return;
 
+    TRACE_EVENT_SCOPE("style"sv, "Document::update_style"sv);
+    auto style_timer = Core::ElapsedTimer::start_new();
+
     // Fetch the viewport rect once, instead of repeatedly, during style computation.
     style_computer().set_viewport_rect({}, viewport_rect());
 
@@ -1227,7 +1315,14 @@ void Document::update_style()
 
     style_computer().reset_ancestor_filter();
 
+    // FIXME: Independent subtrees could be styled in parallel, but compute_style() isn't safe to call off the main thread:
+    //        - It allocates GC cells (CSSAnimation, KeyframeEffect) and writes to the element (custom properties, cached animations).
+    //        - StyleValue, StyleProperties and FontCascadeList use non-atomic reference counting.
+    //        - FlyString interning, the font cache and the style sharing/ancestor filter state in StyleComputer are unsynchronized.
+    //        The cascade itself would have to be split from those side effects, which would then be applied in a second, serial pass.
+    style_computer().set_style_sharing_enabled({}, true);
     auto invalidation = update_style_recursively(*this, style_computer());
+    style_computer().set_style_sharing_enabled({}, false);
     if (invalidation.rebuild_layout_tree) {
         invalidate_layout();
     } else {
@@ -1237,6 +1332,8 @@ void Document::update_style()
             invalidate_stacking_context_tree();
     }
     m_needs_full_style_update = false;
+
+    page().current_frame_timings().style += style_timer.elapsed_time();
 }
 
 void Document::update_animated_style_if_needed()
@@ -1884,6 +1981,16 @@ DocumentType const* Document::doctype() const
     return first_child_of_type<DocumentType>();
 }
 
+void Document::set_quirks_mode(QuirksMode mode)
+{
+    if (m_quirks_mode == mode)
+        return;
+    m_quirks_mode = mode;
+
+    // NOTE: The user agent rule cache includes the quirks mode style sheet.
+    m_style_computer->invalidate_rule_cache();
+}
+
 String const& Document::compat_mode() const
 {
     static String const back_compat = "BackCompat"_string;
@@ -2491,6 +2598,13 @@ bool Document::is_active() const
     return navigable && navigable->active_document() == this;
 }
 
+// AD-HOC: See TraversableNavigable::is_frozen().
+bool Document::is_frozen() const
+{
+    auto navigable = this->navigable();
+    return navigable && navigable->traversable_navigable()->is_frozen();
+}
+
 // https://html.spec.whatwg.org/multipage/history.html#dom-document-location
 JS::GCPtr<HTML::Location> Document::location()
 {
@@ -2537,6 +2651,12 @@ void Document::update_the_visibility_state(HTML::VisibilityState visibility_stat
     m_visibility_state = visibility_state;
 
     // FIXME: 3. Run any page visibility change steps which may be defined in other specifications, with visibility state and document.
+    // AD-HOC: Timers of hidden documents are throttled, so their wakeups need to be recomputed.
+    if (m_window)
+        m_window->timer_throttling_may_have_changed();
+    // AD-HOC: The animations of hidden documents are paused, so they have to catch up once they are visible again.
+    if (visibility_state == HTML::VisibilityState::Visible && m_animation_driver_timer)
+        ensure_animation_timer();
 
     // 4. Fire an event named visibilitychange at document, with its bubbles attribute initialized to true.
     auto event = DOM::Event::create(realm(), HTML::EventNames::visibilitychange);
@@ -2639,7 +2759,7 @@ void Document::evaluate_media_rules()
     });
 
     if (any_media_queries_changed_match_state) {
-        style_computer().invalidate_rule_cache();
+        style_computer().invalidate_author_rule_cache();
         invalidate_style();
         invalidate_layout();
     }
@@ -3323,7 +3443,7 @@ void Document::unload(JS::GCPtr<Document>)
     //           set unloadTimingInfo to null.
 
     // 5. Let intendToStoreInBfcache be true if the user agent intends to keep oldDocument alive in a session history entry, such that it can later be used for history traversal.
-    auto intend_to_store_in_bfcache = false;
+    auto intend_to_store_in_bfcache = can_be_stored_in_back_forward_cache();
 
     // 6. Let eventLoop be oldDocument's relevant agent's event loop.
     auto& event_loop = *verify_cast<Bindings::WebEngineCustomData>(*vm.custom_data()).event_loop;
@@ -3388,9 +3508,43 @@ void Document::unload(JS::GCPtr<Document>)
     // FIXME: 21. If newDocument is given, newDocument's was created via cross-origin redirects is false, and newDocument's origin is the same as oldDocument's origin, then set
     //            newDocument's previous document unload timing to unloadTimingInfo.
 
+    // AD-HOC: Let the traversable know it's keeping this document alive, so it can bound how many of them there are.
+    if (m_salvageable)
+        navigable()->traversable_navigable()->store_document_in_back_forward_cache(*this);
+
     did_stop_being_active_document_in_navigable();
 }
 
+bool Document::can_be_stored_in_back_forward_cache()
+{
+    // NOTE: Aborting a document that was still loading, or using a WebSocket, already made it unsalvageable.
+    if (!m_salvageable || m_is_initial_about_blank || m_readiness != HTML::DocumentReadyState::Complete)
+        return false;
+
+    // Only top-level documents are cached, as nested documents would have to be suspended and restored along with their parents.
+    auto navigable = this->navigable();
+    if (!navigable || !navigable->is_top_level_traversable() || !document_tree_child_navigables().is_empty())
+        return false;
+
+    // The document is only worth keeping if traversing to its session history entry would show it again. A reload loads
+    // a new document into the same entry, and a replace navigation removes the entry altogether.
+    auto entry = latest_entry();
+    if (!entry || entry->document_state()->document() != this)
+        return false;
+    if (!any_of(navigable->get_session_history_entries(), [&](auto& session_history_entry) { return session_history_entry.ptr() == entry.ptr(); }))
+        return false;
+
+    // A page that listens for unload relies on it firing, which it doesn't for a document that is kept alive.
+    if (!m_window || m_window->has_event_listener(HTML::EventNames::unload))
+        return false;
+
+    // Open EventSource connections would keep receiving events for a document that can't handle them.
+    if (m_window->has_registered_event_sources())
+        return false;
+
+    return true;
+}
+
 // https://html.spec.whatwg.org/multipage/document-lifecycle.html#unload-a-document-and-its-descendants
 void Document::unload_a_document_and_its_descendants(JS::GCPtr<Document> new_document, JS::GCPtr<JS::HeapFunction<void()>> after_all_unloads)
 {
@@ -3444,6 +3598,16 @@ void Document::unload_a_document_and_its_descendants(JS::GCPtr<Document> new_doc
         return number_unloaded == unloaded_documents_count;
     });
 
+    // AD-HOC: A document that is kept in the back/forward cache stays alive in its session history entry, so only the
+    //         steps that would have followed its destruction are run.
+    if (m_salvageable) {
+        HTML::queue_global_task(HTML::Task::Source::NavigationAndTraversal, relevant_global_object(*this), JS::create_heap_function(heap(), [after_all_unloads = move(after_all_unloads)] {
+            if (after_all_unloads)
+                after_all_unloads->function()();
+        }));
+        return;
+    }
+
     destroy_a_document_and_its_descendants(move(after_all_unloads));
 }
 
@@ -3926,9 +4090,13 @@ void Document::start_intersection_observing_a_lazy_loading_element(Element& elem
             return JS::js_undefined();
         });
 
-        // FIXME: The options is an IntersectionObserverInit dictionary with the following dictionary members: «[ "rootMargin" → lazy load root margin ]»
+        // - The options is an IntersectionObserverInit dictionary with the following dictionary members: «[ "rootMargin" → lazy load root margin ]»
         // Spec Note: This allows for fetching the image during scrolling, when it does not yet — but is about to — intersect the viewport.
-        auto options = IntersectionObserver::IntersectionObserverInit {};
+        // NOTE: The lazy load root margin is implementation-defined. This is far enough ahead of the viewport for images
+        //       and iframes to have usually loaded by the time they are scrolled into view.
+        auto options = IntersectionObserver::IntersectionObserverInit {
+            .root_margin = "1250px"_string,
+        };
 
         auto wrapped_callback = realm.heap().allocate_without_realm<WebIDL::CallbackType>(callback, Bindings::host_defined_environment_settings_object(realm));
         m_lazy_load_intersection_observer = IntersectionObserver::IntersectionObserver::construct_impl(realm, wrapped_callback, options).release_value_but_fixme_should_propagate_errors();
@@ -4219,15 +4387,68 @@ void Document::update_for_history_step_application(JS::NonnullGCPtr<HTML::Sessio
     // NOTE: This is for bfcache restoration
     if (!documents_entry_changed && !do_not_reactivate) {
         // FIXME: 1. Assert: entriesForNavigationAPI is given.
-        // FIXME: 2. Reactivate document given entry and entriesForNavigationAPI.
+        // 2. Reactivate document given entry and entriesForNavigationAPI.
+        reactivate();
     }
 }
 
+// https://html.spec.whatwg.org/multipage/browsing-the-web.html#reactivate-a-document
+void Document::reactivate()
+{
+    // AD-HOC: The document is no longer cached once it is the active document again.
+    if (auto navigable = this->navigable())
+        navigable->traversable_navigable()->remove_document_from_back_forward_cache(*this);
+
+    // FIXME: 1. For each formControl of form controls in document with an autofill field name of "off", invoke the reset algorithm for formControl.
+
+    // FIXME: 2. If document's suspended timer handles is not empty:
+    // FIXME: 3. Set document's suspended timer handles to an empty list.
+    // NOTE: Timers of a document that is not fully active keep running, but their tasks are held back until it is fully active again.
+
+    // FIXME: 4. Update the navigation API entries for reactivation given document's relevant global object's navigation API, navigationAPIEntries, and reactivatedEntry.
+
+    // 5. If document's current document readiness is "complete", and document's page showing is false:
+    if (m_readiness == HTML::DocumentReadyState::Complete && !m_page_showing) {
+        // 1. Set document's page showing to true.
+        m_page_showing = true;
+
+        // FIXME: 2. Set document's has been revealed to false.
+
+        // 3. Update the visibility state of document to "visible".
+        // NOTE: Making the document active already set its visibility state, which makes this a no-op. The animations and
+        //       timers that were paused while it was hidden still have to pick up where they left off.
+        update_the_visibility_state(HTML::VisibilityState::Visible);
+        if (m_window)
+            m_window->timer_throttling_may_have_changed();
+        if (m_animation_driver_timer)
+            ensure_animation_timer();
+
+        // 4. Fire a page transition event named pageshow at document's relevant global object with true.
+        verify_cast<HTML::Window>(relevant_global_object(*this)).fire_a_page_transition_event(HTML::EventNames::pageshow, true);
+    }
+
+    // AD-HOC: The layout tree was torn down when the document stopped being active, so it has to be built again.
+    invalidate_layout();
+}
+
 HashMap<URL::URL, JS::GCPtr<HTML::SharedImageRequest>>& Document::shared_image_requests()
 {
     return m_shared_image_requests;
 }
 
+void Document::release_unused_image_data()
+{
+    // https://html.spec.whatwg.org/multipage/images.html#list-of-available-images
+    // User agents may also remove images from such lists at any time (e.g. to save memory).
+    if (m_list_of_available_images)
+        m_list_of_available_images->clear();
+
+    // Requests that are still fetching have callbacks waiting on them, so they have to stay discoverable.
+    m_shared_image_requests.remove_all_matching([](auto const&, auto const& request) {
+        return !request->is_fetching();
+    });
+}
+
 // https://www.w3.org/TR/web-animations-1/#dom-document-timeline
 JS::NonnullGCPtr<Animations::DocumentTimeline> Document::timeline()
 {
@@ -4423,7 +4644,9 @@ void Document::ensure_animation_timer()
                     break;
                 }
             }
-            if (!has_animations) {
+            // NOTE: Hidden documents aren't rendered, so there is no point in updating their animations until they are
+            //       visible again.
+            if (!has_animations || hidden()) {
                 m_animation_driver_timer->stop();
                 return;
             }
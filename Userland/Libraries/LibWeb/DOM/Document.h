@@ -21,6 +21,7 @@
 #include <LibWeb/CSS/CSSStyleSheet.h>
 #include <LibWeb/CSS/StyleSheetList.h>
 #include <LibWeb/Cookie/Cookie.h>
+#include <LibWeb/DOM/ElementByIdMap.h>
 #include <LibWeb/DOM/NonElementParentNode.h>
 #include <LibWeb/DOM/ParentNode.h>
 #include <LibWeb/HTML/BrowsingContext.h>
@@ -147,6 +148,8 @@ public:
 
     URL::URL parse_url(StringView) const;
 
+    Optional<CSS::SelectorList> parse_selector_list(StringView) const;
+
     CSS::StyleComputer& style_computer() { return *m_style_computer; }
     const CSS::StyleComputer& style_computer() const { return *m_style_computer; }
 
@@ -233,6 +236,12 @@ public:
 
     void set_needs_layout();
 
+    // Like set_needs_layout(), but for when only the size of the viewport changed.
+    // This keeps the intrinsic sizes cached on boxes, as they don't depend on the viewport.
+    void set_needs_layout_for_viewport_resize();
+
+    u64 intrinsic_sizes_generation() const { return m_intrinsic_sizes_generation; }
+
     void invalidate_layout();
     void invalidate_stacking_context_tree();
 
@@ -241,6 +250,13 @@ public:
     Layout::Viewport const* layout_node() const;
     Layout::Viewport* layout_node();
 
+    // Layout nodes are numbered densely from 0 each time the layout tree is rebuilt, see LayoutState.
+    size_t allocate_layout_node_index(Badge<Layout::Node>) { return m_next_layout_node_index++; }
+
+    // Elements with content-visibility: auto that got a box in the current layout tree, see EventLoop::process().
+    void register_content_visibility_auto_element(Badge<Layout::TreeBuilder>, Element& element) { m_content_visibility_auto_elements.set(element); }
+    HashTable<JS::NonnullGCPtr<Element>> const& content_visibility_auto_elements() const { return m_content_visibility_auto_elements; }
+
     Painting::ViewportPaintable const* paintable() const;
     Painting::ViewportPaintable* paintable();
 
@@ -304,7 +320,7 @@ public:
 
     QuirksMode mode() const { return m_quirks_mode; }
     bool in_quirks_mode() const { return m_quirks_mode == QuirksMode::Yes; }
-    void set_quirks_mode(QuirksMode mode) { m_quirks_mode = mode; }
+    void set_quirks_mode(QuirksMode);
 
     Type document_type() const { return m_type; }
     void set_document_type(Type type) { m_type = type; }
@@ -399,6 +415,7 @@ public:
 
     bool is_fully_active() const;
     bool is_active() const;
+    bool is_frozen() const;
 
     [[nodiscard]] bool allow_declarative_shadow_roots() const;
     void set_allow_declarative_shadow_roots(bool);
@@ -539,6 +556,13 @@ public:
     // https://html.spec.whatwg.org/multipage/document-lifecycle.html#unload-a-document-and-its-descendants
     void unload_a_document_and_its_descendants(JS::GCPtr<Document> new_document, JS::GCPtr<JS::HeapFunction<void()>> after_all_unloads = {});
 
+    // https://html.spec.whatwg.org/multipage/browsing-the-web.html#reactivate-a-document
+    void reactivate();
+
+    // AD-HOC: Whether this document can be kept alive in its session history entry when it is unloaded, so that
+    //         traversing back to it later doesn't have to fetch, parse and run it again.
+    bool can_be_stored_in_back_forward_cache();
+
     // https://html.spec.whatwg.org/multipage/dom.html#active-parser
     JS::GCPtr<HTML::HTMLParser> active_parser();
 
@@ -547,6 +571,11 @@ public:
     DocumentLoadTimingInfo const& load_timing_info() const { return m_load_timing_info; }
     void set_load_timing_info(DocumentLoadTimingInfo const& load_timing_info) { m_load_timing_info = load_timing_info; }
 
+    // AD-HOC: The time at which a frame of this document was painted for the first time, relative to the time origin
+    //         of its relevant global object. This is what the "first-paint" entry of the Paint Timing API reports.
+    Optional<double> first_paint_time() const { return m_first_paint_time; }
+    void set_first_paint_time(double time) { m_first_paint_time = time; }
+
     // https://html.spec.whatwg.org/multipage/dom.html#previous-document-unload-timing
     DocumentUnloadTimingInfo& previous_document_unload_timing() { return m_previous_document_unload_timing; }
     DocumentUnloadTimingInfo const& previous_document_unload_timing() const { return m_previous_document_unload_timing; }
@@ -597,6 +626,10 @@ public:
 
     HashMap<URL::URL, JS::GCPtr<HTML::SharedImageRequest>>& shared_image_requests();
 
+    // Drops the document's own references to decoded images, so that the next garbage collection can reclaim the
+    // ones that are no longer in use. They are fetched and decoded again if they are needed later.
+    void release_unused_image_data();
+
     void restore_the_history_object_state(JS::NonnullGCPtr<HTML::SessionHistoryEntry> entry);
 
     JS::NonnullGCPtr<Animations::DocumentTimeline> timeline();
@@ -631,6 +664,9 @@ public:
     void element_with_name_was_added(Badge<DOM::Element>, JS::NonnullGCPtr<DOM::Element> element);
     void element_with_name_was_removed(Badge<DOM::Element>, JS::NonnullGCPtr<DOM::Element> element);
 
+    ElementByIdMap& element_by_id() { return m_element_by_id; }
+    ElementByIdMap const& element_by_id() const { return m_element_by_id; }
+
     void add_form_associated_element_with_form_attribute(HTML::FormAssociatedElement&);
     void remove_form_associated_element_with_form_attribute(HTML::FormAssociatedElement&);
 
@@ -718,6 +754,8 @@ private:
     JS::GCPtr<HTML::Window> m_window;
 
     JS::GCPtr<Layout::Viewport> m_layout_root;
+    size_t m_next_layout_node_index { 0 };
+    HashTable<JS::NonnullGCPtr<Element>> m_content_visibility_auto_elements;
 
     Optional<Color> m_normal_link_color;
     Optional<Color> m_active_link_color;
@@ -800,6 +838,7 @@ private:
     Vector<WeakPtr<CSS::MediaQueryList>> m_media_query_lists;
 
     bool m_needs_layout { false };
+    u64 m_intrinsic_sizes_generation { 0 };
 
     bool m_needs_full_style_update { false };
 
@@ -815,6 +854,17 @@ private:
     // https://html.spec.whatwg.org/multipage/dom.html#concept-document-about-base-url
     Optional<URL::URL> m_about_base_url;
 
+    // NOTE: Pages resolve the same href and src values against the same base URL many times over, so parse_url()
+    //       remembers its results keyed on the serialized base URL and the input string.
+    static constexpr size_t max_parsed_url_cache_size = 1024;
+    mutable ByteString m_parsed_url_cache_base_url;
+    mutable HashMap<String, URL::URL> m_parsed_url_cache;
+
+    // NOTE: Scripts pass the same few selectors to querySelector() and friends over and over, and parsing a selector
+    //       doesn't depend on the state of the document, so parse_selector_list() remembers what it has parsed.
+    static constexpr size_t max_parsed_selector_cache_size = 256;
+    mutable HashMap<String, CSS::SelectorList> m_parsed_selector_cache;
+
     // https://html.spec.whatwg.org/multipage/dom.html#concept-document-coop
     HTML::CrossOriginOpenerPolicy m_cross_origin_opener_policy;
 
@@ -853,6 +903,7 @@ private:
 
     // https://html.spec.whatwg.org/multipage/dom.html#load-timing-info
     DocumentLoadTimingInfo m_load_timing_info;
+    Optional<double> m_first_paint_time;
 
     // https://html.spec.whatwg.org/multipage/dom.html#previous-document-unload-timing
     DocumentUnloadTimingInfo m_previous_document_unload_timing;
@@ -917,6 +968,8 @@ private:
 
     Vector<JS::NonnullGCPtr<DOM::Element>> m_potentially_named_elements;
 
+    ElementByIdMap m_element_by_id;
+
     bool m_design_mode_enabled { false };
 
     bool m_needs_to_resolve_paint_only_properties { true };
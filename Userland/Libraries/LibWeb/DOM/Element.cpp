@@ -23,6 +23,7 @@
 #include <LibWeb/DOM/DOMTokenList.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/Element.h>
+#include <LibWeb/DOM/ElementByIdMap.h>
 #include <LibWeb/DOM/ElementFactory.h>
 #include <LibWeb/DOM/HTMLCollection.h>
 #include <LibWeb/DOM/NamedNodeMap.h>
@@ -446,9 +447,9 @@ void Element::run_attribute_change_steps(FlyString const& local_name, Optional<S
 
     // AD-HOC: Run our own internal attribute change handler.
     attribute_changed(local_name, value);
-    invalidate_style_after_attribute_change(local_name);
+    invalidate_style_after_attribute_change(local_name, old_value, value);
 
-    document().bump_dom_tree_version();
+    bump_subtree_dom_tree_version();
 }
 
 void Element::attribute_changed(FlyString const& name, Optional<String> const& value)
@@ -456,11 +457,13 @@ void Element::attribute_changed(FlyString const& name, Optional<String> const& v
     auto value_or_empty = value.value_or(String {});
 
     if (name == HTML::AttributeNames::id) {
+        remove_from_element_by_id_map();
         if (!value.has_value())
             m_id = {};
         else
             m_id = value_or_empty;
 
+        add_to_element_by_id_map();
         document().element_id_changed({}, *this);
     } else if (name == HTML::AttributeNames::name) {
         if (!value.has_value())
@@ -706,7 +709,7 @@ JS::GCPtr<ShadowRoot> Element::shadow_root_for_bindings() const
 WebIDL::ExceptionOr<bool> Element::matches(StringView selectors) const
 {
     // 1. Let s be the result of parse a selector from selectors.
-    auto maybe_selectors = parse_selector(CSS::Parser::ParsingContext(static_cast<ParentNode&>(const_cast<Element&>(*this))), selectors);
+    auto maybe_selectors = document().parse_selector_list(selectors);
 
     // 2. If s is failure, then throw a "SyntaxError" DOMException.
     if (!maybe_selectors.has_value())
@@ -725,7 +728,7 @@ WebIDL::ExceptionOr<bool> Element::matches(StringView selectors) const
 WebIDL::ExceptionOr<DOM::Element const*> Element::closest(StringView selectors) const
 {
     // 1. Let s be the result of parse a selector from selectors.
-    auto maybe_selectors = parse_selector(CSS::Parser::ParsingContext(static_cast<ParentNode&>(const_cast<Element&>(*this))), selectors);
+    auto maybe_selectors = document().parse_selector_list(selectors);
 
     // 2. If s is failure, then throw a "SyntaxError" DOMException.
     if (!maybe_selectors.has_value())
@@ -1073,12 +1076,36 @@ double Element::current_css_zoom() const
     return 1.0;
 }
 
+void Element::add_to_element_by_id_map()
+{
+    if (!m_id.has_value())
+        return;
+    auto& root = this->root();
+    if (m_element_by_id_root && m_element_by_id_root.ptr() != &root)
+        remove_from_element_by_id_map();
+    if (auto* element_by_id = ElementByIdMap::for_root(root)) {
+        element_by_id->add(*m_id, *this);
+        m_element_by_id_root = root;
+    }
+}
+
+void Element::remove_from_element_by_id_map()
+{
+    if (!m_element_by_id_root)
+        return;
+    if (m_id.has_value())
+        ElementByIdMap::for_root(*m_element_by_id_root.ptr())->remove(*m_id, *this);
+    m_element_by_id_root = nullptr;
+}
+
 void Element::inserted()
 {
     Base::inserted();
 
-    if (m_id.has_value())
+    if (m_id.has_value()) {
+        add_to_element_by_id_map();
         document().element_with_id_was_added({}, *this);
+    }
 
     if (m_name.has_value())
         document().element_with_name_was_added({}, *this);
@@ -1088,6 +1115,10 @@ void Element::removed_from(Node* node)
 {
     Base::removed_from(node);
 
+    // NOTE: Elements in a shadow tree stay in it (and its map) when their host is removed.
+    if (m_element_by_id_root && m_element_by_id_root.ptr() != &root())
+        remove_from_element_by_id_map();
+
     if (m_id.has_value())
         document().element_with_id_was_removed({}, *this);
 
@@ -1881,10 +1912,75 @@ ErrorOr<void> Element::scroll_into_view(Optional<Variant<bool, ScrollIntoViewOpt
     // FIXME: 8. Optionally perform some other action that brings the element to the user’s attention.
 }
 
-void Element::invalidate_style_after_attribute_change(FlyString const& attribute_name)
+static Optional<CSS::StyleComputer::StyleInvalidationScope> invalidation_scope_for_class_or_id_change(Document const& document, FlyString const& attribute_name, Optional<String> const& old_value, Optional<String> const& new_value)
 {
+    // NOTE: Classes and ids match case-insensitively in quirks mode, which the invalidation scopes don't account for.
+    if (document.in_quirks_mode())
+        return {};
+
+    auto const& style_computer = document.style_computer();
+    CSS::StyleComputer::StyleInvalidationScope scope;
+
+    if (attribute_name == HTML::AttributeNames::id) {
+        for (auto const& id : { old_value, new_value }) {
+            if (!id.has_value() || id->is_empty())
+                continue;
+            auto id_scope = style_computer.invalidation_scope_for_id_change(FlyString::from_utf8_without_validation(id->bytes()));
+            if (!id_scope.has_value())
+                return {};
+            scope |= id_scope.value();
+        }
+        return scope;
+    }
+
+    VERIFY(attribute_name == HTML::AttributeNames::class_);
+    auto old_classes = old_value.value_or(String {}).bytes_as_string_view().split_view_if(Infra::is_ascii_whitespace);
+    auto new_classes = new_value.value_or(String {}).bytes_as_string_view().split_view_if(Infra::is_ascii_whitespace);
+
+    // Only classes that were added or removed can change which rules match.
+    auto include_changed_classes = [&](Vector<StringView> const& classes, Vector<StringView> const& other_classes) -> bool {
+        for (auto class_name : classes) {
+            if (other_classes.contains_slow(class_name))
+                continue;
+            auto class_scope = style_computer.invalidation_scope_for_class_change(FlyString::from_utf8_without_validation(class_name.bytes()));
+            if (!class_scope.has_value())
+                return false;
+            scope |= class_scope.value();
+        }
+        return true;
+    };
+    if (!include_changed_classes(old_classes, new_classes) || !include_changed_classes(new_classes, old_classes))
+        return {};
+    return scope;
+}
+
+void Element::invalidate_style_after_attribute_change(FlyString const& attribute_name, Optional<String> const& old_value, Optional<String> const& new_value)
+{
+    // OPTIMIZATION: For class and id changes, we can tell from the rule cache which elements could be affected,
+    //               instead of invalidating the whole subtree.
+    if (attribute_name == HTML::AttributeNames::class_ || attribute_name == HTML::AttributeNames::id) {
+        if (auto scope = invalidation_scope_for_class_or_id_change(document(), attribute_name, old_value, new_value); scope.has_value()) {
+            if (scope->whole_document) {
+                document().invalidate_style();
+                return;
+            }
+            if (scope->descendants)
+                invalidate_style();
+            else
+                set_needs_style_update(true);
+            if (scope->following_siblings) {
+                for (auto* sibling = next_sibling(); sibling; sibling = sibling->next_sibling())
+                    sibling->invalidate_style();
+            }
+            if (scope->preceding_siblings) {
+                for (auto* sibling = previous_sibling(); sibling; sibling = sibling->previous_sibling())
+                    sibling->invalidate_style();
+            }
+            return;
+        }
+    }
+
     // FIXME: Only invalidate if the attribute can actually affect style.
-    (void)attribute_name;
 
     // FIXME: This will need to become smarter when we implement the :has() selector.
     invalidate_style();
@@ -2218,9 +2314,24 @@ auto Element::pseudo_element_custom_properties() const -> PseudoElementCustomPro
     return *m_pseudo_element_custom_properties;
 }
 
+static bool custom_properties_are_equal(HashMap<FlyString, CSS::StyleProperty> const& a, HashMap<FlyString, CSS::StyleProperty> const& b)
+{
+    if (a.size() != b.size())
+        return false;
+    for (auto const& it : a) {
+        auto other = b.get(it.key);
+        if (!other.has_value() || other->important != it.value.important || *other->value != *it.value.value)
+            return false;
+    }
+    return true;
+}
+
 void Element::set_custom_properties(Optional<CSS::Selector::PseudoElement::Type> pseudo_element, HashMap<FlyString, CSS::StyleProperty> custom_properties)
 {
     if (!pseudo_element.has_value()) {
+        // NOTE: Comparing here, before the old properties are replaced, saves copying them for every style update.
+        if (!m_custom_properties_changed && !custom_properties_are_equal(m_custom_properties, custom_properties))
+            m_custom_properties_changed = true;
         m_custom_properties = move(custom_properties);
         return;
     }
@@ -2664,4 +2775,74 @@ WebIDL::ExceptionOr<void> Element::set_html_unsafe(StringView html)
     return {};
 }
 
+// https://drafts.csswg.org/css-contain-2/#determine-proximity-to-the-viewport
+void Element::determine_proximity_to_the_viewport()
+{
+    // NOTE: Elements without a box can't be close to the viewport.
+    auto const* paintable_box = this->paintable_box();
+    if (!paintable_box) {
+        m_proximity_to_the_viewport = ProximityToTheViewport::FarAwayFromTheViewport;
+        return;
+    }
+
+    // An element is close to the viewport if it is within an implementation-defined margin of the viewport.
+    // We use half of the viewport size in each direction, so content is laid out a bit before it scrolls into view.
+    // FIXME: This ignores the scroll offsets of nested scroll containers.
+    auto viewport_rect = document().viewport_rect();
+    auto expanded_viewport_rect = viewport_rect.inflated(viewport_rect.width(), viewport_rect.height());
+    if (paintable_box->absolute_border_box_rect().intersects(expanded_viewport_rect))
+        m_proximity_to_the_viewport = ProximityToTheViewport::CloseToTheViewport;
+    else
+        m_proximity_to_the_viewport = ProximityToTheViewport::FarAwayFromTheViewport;
+}
+
+// https://drafts.csswg.org/css-contain-2/#relevant-to-the-user
+bool Element::is_relevant_to_the_user() const
+{
+    // An element is relevant to the user if any of the following conditions are true:
+
+    // The element is "close to the viewport".
+    if (m_proximity_to_the_viewport == ProximityToTheViewport::CloseToTheViewport)
+        return true;
+
+    // Either the element or its contents are focused, as described in the focus section of the HTML spec.
+    auto const* focused_element = document().focused_element();
+    if (focused_element && is_shadow_including_inclusive_ancestor_of(*focused_element))
+        return true;
+
+    // FIXME: Either the element or its contents are selected, where selection is described in the selection API.
+
+    // Either the element or its contents are placed in the top layer.
+    if (in_top_layer())
+        return true;
+
+    return false;
+}
+
+// https://drafts.csswg.org/css-contain-2/#skips-its-contents
+bool Element::skips_its_contents() const
+{
+    auto const* style = computed_css_values();
+    if (!style)
+        return false;
+
+    // NOTE: content-visibility only applies to elements for which size containment can apply, which excludes
+    //       non-atomic inline-level boxes and internal table boxes other than table cells.
+    auto display = style->display();
+    if (display.is_inline_outside() && display.is_flow_inside())
+        return false;
+    if (display.is_internal() && !display.is_table_cell())
+        return false;
+
+    auto content_visibility = style->content_visibility();
+    if (content_visibility == CSS::ContentVisibility::Hidden)
+        return true;
+
+    // An element with content-visibility: auto skips its contents if it is not relevant to the user.
+    if (content_visibility == CSS::ContentVisibility::Auto)
+        return !is_relevant_to_the_user();
+
+    return false;
+}
+
 }
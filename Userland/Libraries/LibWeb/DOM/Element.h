@@ -213,6 +213,9 @@ public:
     void set_custom_properties(Optional<CSS::Selector::PseudoElement::Type>, HashMap<FlyString, CSS::StyleProperty> custom_properties);
     [[nodiscard]] HashMap<FlyString, CSS::StyleProperty> const& custom_properties(Optional<CSS::Selector::PseudoElement::Type>) const;
 
+    // Whether the element's own custom properties were replaced by different ones since this was last called.
+    [[nodiscard]] bool take_custom_properties_changed() { return exchange(m_custom_properties_changed, false); }
+
     // NOTE: The function is wrapped in a JS::HeapFunction immediately.
     int queue_an_element_task(HTML::Task::Source, Function<void()>);
 
@@ -390,6 +393,18 @@ public:
     void set_in_top_layer(bool in_top_layer) { m_in_top_layer = in_top_layer; }
     bool in_top_layer() const { return m_in_top_layer; }
 
+    // https://drafts.csswg.org/css-contain-2/#proximity-to-the-viewport
+    enum class ProximityToTheViewport {
+        NotDetermined,
+        CloseToTheViewport,
+        FarAwayFromTheViewport,
+    };
+    ProximityToTheViewport proximity_to_the_viewport() const { return m_proximity_to_the_viewport; }
+    void determine_proximity_to_the_viewport();
+
+    bool is_relevant_to_the_user() const;
+    bool skips_its_contents() const;
+
 protected:
     Element(Document&, DOM::QualifiedName);
     virtual void initialize(JS::Realm&) override;
@@ -410,7 +425,10 @@ protected:
 private:
     void make_html_uppercased_qualified_name();
 
-    void invalidate_style_after_attribute_change(FlyString const& attribute_name);
+    void invalidate_style_after_attribute_change(FlyString const& attribute_name, Optional<String> const& old_value, Optional<String> const& new_value);
+
+    void add_to_element_by_id_map();
+    void remove_from_element_by_id_map();
 
     WebIDL::ExceptionOr<JS::GCPtr<Node>> insert_adjacent(StringView where, JS::NonnullGCPtr<Node> node);
 
@@ -430,6 +448,7 @@ private:
 
     RefPtr<CSS::StyleProperties> m_computed_css_values;
     HashMap<FlyString, CSS::StyleProperty> m_custom_properties;
+    bool m_custom_properties_changed { false };
 
     using PseudoElementCustomProperties = Array<HashMap<FlyString, CSS::StyleProperty>, to_underlying(CSS::Selector::PseudoElement::Type::KnownPseudoElementCount)>;
     mutable OwnPtr<PseudoElementCustomProperties> m_pseudo_element_custom_properties;
@@ -443,6 +462,9 @@ private:
     Optional<FlyString> m_id;
     Optional<FlyString> m_name;
 
+    // The document or shadow root whose ElementByIdMap this element is registered with under m_id, if any.
+    WeakPtr<Node> m_element_by_id_root;
+
     using PseudoElementLayoutNodes = Array<JS::GCPtr<Layout::Node>, to_underlying(CSS::Selector::PseudoElement::Type::KnownPseudoElementCount)>;
     OwnPtr<PseudoElementLayoutNodes> m_pseudo_element_nodes;
 
@@ -467,6 +489,8 @@ private:
     Array<CSSPixelPoint, 3> m_scroll_offset;
 
     bool m_in_top_layer { false };
+
+    ProximityToTheViewport m_proximity_to_the_viewport { ProximityToTheViewport::NotDetermined };
 };
 
 template<>
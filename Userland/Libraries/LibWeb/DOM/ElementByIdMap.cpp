@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOM/Element.h>
+#include <LibWeb/DOM/ElementByIdMap.h>
+#include <LibWeb/DOM/ShadowRoot.h>
+
+namespace Web::DOM {
+
+ElementByIdMap* ElementByIdMap::for_root(Node& root)
+{
+    if (is<Document>(root))
+        return &static_cast<Document&>(root).element_by_id();
+    if (is<ShadowRoot>(root))
+        return &static_cast<ShadowRoot&>(root).element_by_id();
+    return nullptr;
+}
+
+void ElementByIdMap::add(FlyString const& id, Element& element)
+{
+    auto& elements = m_map.ensure(id);
+    for (auto& entry : elements) {
+        if (entry.ptr() == &element)
+            return;
+    }
+    elements.append(element);
+}
+
+void ElementByIdMap::remove(FlyString const& id, Element& element)
+{
+    auto it = m_map.find(id);
+    if (it == m_map.end())
+        return;
+
+    auto& elements = it->value;
+    elements.remove_all_matching([&](auto& entry) { return !entry || entry.ptr() == &element; });
+    if (elements.is_empty())
+        m_map.remove(it);
+}
+
+JS::GCPtr<Element> ElementByIdMap::get(FlyString const& id) const
+{
+    auto it = m_map.find(id);
+    if (it == m_map.end())
+        return nullptr;
+
+    JS::GCPtr<Element> first_element;
+    for (auto const& entry : it->value) {
+        if (!entry)
+            continue;
+        if (!first_element || (entry->compare_document_position(first_element) & Node::DOCUMENT_POSITION_FOLLOWING))
+            first_element = entry.ptr();
+    }
+    return first_element;
+}
+
+}
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/FlyString.h>
+#include <AK/HashMap.h>
+#include <AK/Vector.h>
+#include <AK/WeakPtr.h>
+#include <LibJS/Heap/GCPtr.h>
+#include <LibWeb/Forward.h>
+
+namespace Web::DOM {
+
+// An index from id to the elements of a single tree (rooted at a document or a shadow root) that have that id.
+// NOTE: Elements add themselves when they are inserted or their id changes, and remove themselves again when they
+//       leave the tree or their id changes. Each element remembers which root it is registered with, see Element.
+class ElementByIdMap {
+public:
+    static ElementByIdMap* for_root(Node&);
+
+    void add(FlyString const& id, Element&);
+    void remove(FlyString const& id, Element&);
+    JS::GCPtr<Element> get(FlyString const& id) const;
+
+private:
+    HashMap<FlyString, Vector<WeakPtr<Element>, 1>> m_map;
+};
+
+}
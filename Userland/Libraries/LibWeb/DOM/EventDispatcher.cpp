@@ -5,6 +5,7 @@
  */
 
 #include <AK/Assertions.h>
+#include <AK/Function.h>
 #include <AK/TypeCasts.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/FunctionObject.h>
@@ -106,7 +107,7 @@ bool EventDispatcher::inner_invoke(Event& event, Vector<JS::Handle<DOM::DOMEvent
         }
 
         // 9. If listener’s passive is true, then set event’s in passive listener flag.
-        if (listener->passive)
+        if (listener->passive.value_or(false))
             event.set_in_passive_listener(true);
 
         // 10. Call a user object’s operation with listener’s callback, "handleEvent", « event », and event’s currentTarget attribute value. If this throws an exception, then:
@@ -169,7 +170,8 @@ void EventDispatcher::invoke(Event::PathEntry& struct_, Event& event, Event::Pha
 
     // 6. Let listeners be a clone of event’s currentTarget attribute value’s event listener list.
     // NOTE: This avoids event listeners added after this point from being run. Note that removal still has an effect due to the removed field.
-    auto listeners = event.current_target()->event_listener_list();
+    // NOTE: Only listeners whose type is event's type can run, so only those are cloned.
+    auto listeners = event.current_target()->event_listener_list(event.type());
 
     // 7. Let invocationTargetInShadowTree be struct’s invocation-target-in-shadow-tree.
     bool invocation_target_in_shadow_tree = struct_.invocation_target_in_shadow_tree;
@@ -195,6 +197,9 @@ void EventDispatcher::invoke(Event::PathEntry& struct_, Event& event, Event::Pha
         else
             return;
 
+        // NOTE: No listener ran above, so cloning the list again only picks up listeners for the legacy type, which is what the spec's clone would give.
+        listeners = event.current_target()->event_listener_list(event.type());
+
         // 3. Inner invoke with event, listeners, phase, invocationTargetInShadowTree, and legacyOutputDidListenersThrowFlag if given.
         inner_invoke(event, listeners, phase, invocation_target_in_shadow_tree);
 
@@ -203,6 +208,51 @@ void EventDispatcher::invoke(Event::PathEntry& struct_, Event& event, Event::Pha
     }
 }
 
+// NOTE: This walks a superset of the event path. A shadow root's get the parent looks at the event's path,
+//       which hasn't been built yet, so we always continue to its host.
+static bool any_target_along_event_path(EventTarget& target, Event const& event, Function<bool(EventTarget&)> const& callback)
+{
+    for (EventTarget* current = &target; current;) {
+        if (callback(*current))
+            return true;
+        if (is<ShadowRoot>(*current))
+            current = static_cast<ShadowRoot&>(*current).host();
+        else
+            current = current->get_parent(event);
+    }
+    return false;
+}
+
+// Returns true if dispatching event to target can't run any listener and leaves no trace besides setting event's target.
+static bool event_path_has_no_listeners(EventTarget& target, Event const& event)
+{
+    if (event.related_target() || !event.touch_target_list().is_empty())
+        return false;
+
+    // Activation behavior and the legacy event type fallbacks run without a listener for event's type.
+    if (is<UIEvents::MouseEvent>(event) && event.type() == HTML::EventNames::click)
+        return false;
+    if (event.type().is_one_of(HTML::EventNames::animationend, HTML::EventNames::animationiteration, HTML::EventNames::animationstart, HTML::EventNames::transitionend))
+        return false;
+
+    // Targets in shadow trees get retargeted or cleared at the end of dispatch.
+    if (is<Node>(target) && is<ShadowRoot>(static_cast<Node&>(target).root()))
+        return false;
+
+    if (!EventTarget::may_have_event_listeners_of_type(event.type()))
+        return true;
+
+    return !any_target_along_event_path(target, event, [&](EventTarget& current) { return current.has_event_listener(event.type()); });
+}
+
+bool EventDispatcher::path_may_have_non_passive_listeners(EventTarget& target, Event const& event)
+{
+    if (!EventTarget::may_have_event_listeners_of_type(event.type()))
+        return false;
+
+    return any_target_along_event_path(target, event, [&](EventTarget& current) { return current.has_non_passive_event_listener(event.type()); });
+}
+
 // https://dom.spec.whatwg.org/#concept-event-dispatch
 bool EventDispatcher::dispatch(JS::NonnullGCPtr<EventTarget> target, Event& event, bool legacy_target_override)
 {
@@ -218,6 +268,18 @@ bool EventDispatcher::dispatch(JS::NonnullGCPtr<EventTarget> target, Event& even
         target_override = &verify_cast<HTML::Window>(*target).associated_document();
     }
 
+    // OPTIMIZATION: If no listener can run, skip building the event path and go straight to the end of the algorithm.
+    //               The last invoke would have set event's target to targetOverride, and nothing sets clearTargets.
+    if (event_path_has_no_listeners(*target, event)) {
+        event.set_target(target_override);
+        event.set_phase(Event::Phase::None);
+        event.set_current_target(nullptr);
+        event.set_dispatched(false);
+        event.set_stop_propagation(false);
+        event.set_stop_immediate_propagation(false);
+        return !event.cancelled();
+    }
+
     // 3. Let activationTarget be null.
     JS::GCPtr<EventTarget> activation_target;
 
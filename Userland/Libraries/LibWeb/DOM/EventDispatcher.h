@@ -16,6 +16,9 @@ class EventDispatcher {
 public:
     static bool dispatch(JS::NonnullGCPtr<EventTarget>, Event&, bool legacy_target_override = false);
 
+    // Returns false if dispatching the event to the target can only run passive listeners, which means it can't be canceled by a listener.
+    static bool path_may_have_non_passive_listeners(EventTarget&, Event const&);
+
 private:
     static void invoke(Event::PathEntry&, Event&, Event::Phase);
     static bool inner_invoke(Event&, Vector<JS::Handle<DOM::DOMEventListener>>&, Event::Phase, bool);
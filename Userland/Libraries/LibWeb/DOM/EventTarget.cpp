@@ -70,18 +70,44 @@ void EventTarget::visit_edges(Cell::Visitor& visitor)
     Base::visit_edges(visitor);
 
     if (auto const* data = m_data.ptr()) {
-        visitor.visit(data->event_listener_list);
+        for (auto const& it : data->event_listener_list)
+            visitor.visit(it.value);
         visitor.visit(data->event_handler_map);
     }
 }
 
-Vector<JS::Handle<DOMEventListener>> EventTarget::event_listener_list()
+// The number of listeners of each type currently in some event target's event listener list.
+static HashMap<FlyString, size_t> s_event_listener_counts_by_type;
+
+bool EventTarget::may_have_event_listeners_of_type(FlyString const& type)
+{
+    return s_event_listener_counts_by_type.contains(type);
+}
+
+static void did_add_event_listener_of_type(FlyString const& type)
+{
+    ++s_event_listener_counts_by_type.ensure(type, [] { return 0; });
+}
+
+static void did_remove_event_listener_of_type(FlyString const& type)
+{
+    auto it = s_event_listener_counts_by_type.find(type);
+    VERIFY(it != s_event_listener_counts_by_type.end());
+    if (--it->value == 0)
+        s_event_listener_counts_by_type.remove(it);
+}
+
+Vector<JS::Handle<DOMEventListener>> EventTarget::event_listener_list(FlyString const& type)
 {
     Vector<JS::Handle<DOMEventListener>> list;
     if (!m_data)
         return list;
-    for (auto& listener : m_data->event_listener_list)
-        list.append(*listener);
+    auto it = m_data->event_listener_list.find(type);
+    if (it == m_data->event_listener_list.end())
+        return list;
+    list.ensure_capacity(it->value.size());
+    for (auto& listener : it->value)
+        list.unchecked_append(*listener);
     return list;
 }
 
@@ -108,7 +134,7 @@ static bool flatten_event_listener_options(Variant<AddEventListenerOptions, bool
 
 struct FlattenedAddEventListenerOptions {
     bool capture { false };
-    bool passive { false };
+    Optional<bool> passive;
     bool once { false };
     JS::GCPtr<AbortSignal> signal;
 };
@@ -119,22 +145,25 @@ static FlattenedAddEventListenerOptions flatten_add_event_listener_options(Varia
     // 1. Let capture be the result of flattening options.
     bool capture = flatten_event_listener_options(options);
 
-    // 2. Let once and passive be false.
+    // 2. Let once be false.
     bool once = false;
-    bool passive = false;
 
-    // 3. Let signal be null.
+    // 3. Let passive and signal be null.
+    Optional<bool> passive;
     JS::GCPtr<AbortSignal> signal;
 
     // 4. If options is a dictionary, then:
     if (options.has<AddEventListenerOptions>()) {
         auto& add_event_listener_options = options.get<AddEventListenerOptions>();
 
-        // 1. Set passive to options["passive"] and once to options["once"].
-        passive = add_event_listener_options.passive;
+        // 1. Set once to options["once"].
         once = add_event_listener_options.once;
 
-        // 2. If options["signal"] exists, then set signal to options["signal"].
+        // 2. If options["passive"] exists, then set passive to options["passive"].
+        if (add_event_listener_options.passive.has_value())
+            passive = add_event_listener_options.passive;
+
+        // 3. If options["signal"] exists, then set signal to options["signal"].
         if (add_event_listener_options.signal)
             signal = add_event_listener_options.signal;
     }
@@ -143,6 +172,29 @@ static FlattenedAddEventListenerOptions flatten_add_event_listener_options(Varia
     return FlattenedAddEventListenerOptions { .capture = capture, .passive = passive, .once = once, .signal = signal.ptr() };
 }
 
+// https://dom.spec.whatwg.org/#default-passive-value
+static bool default_passive_value(FlyString const& type, EventTarget& event_target)
+{
+    // 1. Return true if all of the following are true:
+    //    - type is one of "touchstart", "touchmove", "wheel", and "mousewheel".
+    if (!type.is_one_of("touchstart"sv, "touchmove"sv, UIEvents::EventNames::wheel, "mousewheel"sv))
+        return false;
+
+    //    - eventTarget is a Window object, or is a node whose node document is eventTarget, or is a node whose node document’s document element
+    //      is eventTarget, or is a node whose node document’s body element is eventTarget.
+    if (is<HTML::Window>(event_target))
+        return true;
+    if (is<Node>(event_target)) {
+        auto& node = static_cast<Node&>(event_target);
+        auto& document = node.document();
+        if (&node == &document || &node == document.document_element() || &node == document.body())
+            return true;
+    }
+
+    // 2. Return false.
+    return false;
+}
+
 // https://dom.spec.whatwg.org/#dom-eventtarget-addeventlistener
 void EventTarget::add_event_listener(FlyString const& type, IDLEventListener* callback, Variant<AddEventListenerOptions, bool> const& options)
 {
@@ -151,7 +203,6 @@ void EventTarget::add_event_listener(FlyString const& type, IDLEventListener* ca
 
     // 2. Add an event listener with this and an event listener whose type is type, callback is callback, capture is capture, passive is passive,
     //    once is once, and signal is signal.
-
     auto event_listener = heap().allocate_without_realm<DOMEventListener>();
     event_listener->type = type;
     event_listener->callback = callback;
@@ -184,17 +235,23 @@ void EventTarget::add_an_event_listener(DOMEventListener& listener)
     if (!listener.callback)
         return;
 
-    // 4. If eventTarget’s event listener list does not contain an event listener whose type is listener’s type, callback is listener’s callback,
+    // 4. If listener’s passive is null, then set it to the default passive value given listener’s type and eventTarget.
+    if (!listener.passive.has_value())
+        listener.passive = default_passive_value(listener.type, *this);
+
+    // 5. If eventTarget’s event listener list does not contain an event listener whose type is listener’s type, callback is listener’s callback,
     //    and capture is listener’s capture, then append listener to eventTarget’s event listener list.
-    auto it = event_listener_list.find_if([&](auto& entry) {
-        return entry->type == listener.type
-            && entry->callback->callback().callback == listener.callback->callback().callback
+    auto& listeners_of_type = event_listener_list.ensure(listener.type);
+    auto it = listeners_of_type.find_if([&](auto& entry) {
+        return entry->callback->callback().callback == listener.callback->callback().callback
             && entry->capture == listener.capture;
     });
-    if (it == event_listener_list.end())
-        event_listener_list.append(listener);
+    if (it == listeners_of_type.end()) {
+        listeners_of_type.append(listener);
+        did_add_event_listener_of_type(listener.type);
+    }
 
-    // 5. If listener’s signal is not null, then add the following abort steps to it:
+    // 6. If listener’s signal is not null, then add the following abort steps to it:
     if (listener.signal) {
         // NOTE: `this` and `listener` are protected by AbortSignal using JS::SafeFunction.
         listener.signal->add_abort_algorithm([this, &listener] {
@@ -207,11 +264,15 @@ void EventTarget::add_an_event_listener(DOMEventListener& listener)
 // https://dom.spec.whatwg.org/#dom-eventtarget-removeeventlistener
 void EventTarget::remove_event_listener(FlyString const& type, IDLEventListener* callback, Variant<EventListenerOptions, bool> const& options)
 {
-    auto& event_listener_list = ensure_data().event_listener_list;
-
     // 1. Let capture be the result of flattening options.
     bool capture = flatten_event_listener_options(options);
 
+    if (!m_data)
+        return;
+    auto listeners_of_type = m_data->event_listener_list.find(type);
+    if (listeners_of_type == m_data->event_listener_list.end())
+        return;
+
     // 2. If this’s event listener list contains an event listener whose type is type, callback is callback, and capture is capture,
     //    then remove an event listener with this and that event listener.
     auto callbacks_match = [&](DOMEventListener& entry) {
@@ -221,12 +282,11 @@ void EventTarget::remove_event_listener(FlyString const& type, IDLEventListener*
             return false;
         return entry.callback->callback().callback == callback->callback().callback;
     };
-    auto it = event_listener_list.find_if([&](auto& entry) {
-        return entry->type == type
-            && callbacks_match(*entry)
+    auto it = listeners_of_type->value.find_if([&](auto& entry) {
+        return callbacks_match(*entry)
             && entry->capture == capture;
     });
-    if (it != event_listener_list.end())
+    if (it != listeners_of_type->value.end())
         remove_an_event_listener(**it);
 }
 
@@ -244,14 +304,26 @@ void EventTarget::remove_an_event_listener(DOMEventListener& listener)
     // 2. Set listener’s removed to true and remove listener from eventTarget’s event listener list.
     listener.removed = true;
     VERIFY(m_data);
-    m_data->event_listener_list.remove_first_matching([&](auto& entry) { return entry.ptr() == &listener; });
+    remove_from_event_listener_list_impl(listener);
 }
 
 void EventTarget::remove_from_event_listener_list(DOMEventListener& listener)
 {
     if (!m_data)
         return;
-    m_data->event_listener_list.remove_first_matching([&](auto& entry) { return entry.ptr() == &listener; });
+    remove_from_event_listener_list_impl(listener);
+}
+
+void EventTarget::remove_from_event_listener_list_impl(DOMEventListener& listener)
+{
+    auto listeners_of_type = m_data->event_listener_list.find(listener.type);
+    if (listeners_of_type == m_data->event_listener_list.end())
+        return;
+    if (!listeners_of_type->value.remove_first_matching([&](auto& entry) { return entry.ptr() == &listener; }))
+        return;
+    if (listeners_of_type->value.is_empty())
+        m_data->event_listener_list.remove(listeners_of_type);
+    did_remove_event_listener_of_type(listener.type);
 }
 
 // https://dom.spec.whatwg.org/#dom-eventtarget-dispatchevent
@@ -823,14 +895,18 @@ bool EventTarget::dispatch_event(Event& event)
 }
 
 bool EventTarget::has_event_listener(FlyString const& type) const
+{
+    return m_data && m_data->event_listener_list.contains(type);
+}
+
+bool EventTarget::has_non_passive_event_listener(FlyString const& type) const
 {
     if (!m_data)
         return false;
-    for (auto& listener : m_data->event_listener_list) {
-        if (listener->type == type)
-            return true;
-    }
-    return false;
+    auto it = m_data->event_listener_list.find(type);
+    if (it == m_data->event_listener_list.end())
+        return false;
+    return it->value.first_matching([](auto& listener) { return !listener->passive.value_or(false); }).has_value();
 }
 
 bool EventTarget::has_event_listeners() const
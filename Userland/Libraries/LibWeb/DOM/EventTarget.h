@@ -44,7 +44,9 @@ public:
     void remove_an_event_listener(DOMEventListener&);
     void remove_from_event_listener_list(DOMEventListener&);
 
-    Vector<JS::Handle<DOMEventListener>> event_listener_list();
+    // Returns a clone of the listeners in this target's event listener list whose type is the given type, in list order.
+    // Listeners of different types never run for the same event, so the list is kept bucketed by type.
+    Vector<JS::Handle<DOMEventListener>> event_listener_list(FlyString const& type);
 
     virtual bool has_activation_behavior() const;
     virtual void activation_behavior(Event const&);
@@ -58,8 +60,13 @@ public:
     void set_event_handler_attribute(FlyString const& name, WebIDL::CallbackType*);
 
     bool has_event_listener(FlyString const& type) const;
+    bool has_non_passive_event_listener(FlyString const& type) const;
     bool has_event_listeners() const;
 
+    // Returns false only if no event target in this process has ever had a listener of the given type that is still registered.
+    // Targets that are garbage collected with listeners still attached keep their listeners counted, so this errs on the side of true.
+    static bool may_have_event_listeners_of_type(FlyString const& type);
+
 protected:
     explicit EventTarget(JS::Realm&, MayInterfereWithIndexedPropertyAccess = MayInterfereWithIndexedPropertyAccess::No);
 
@@ -70,7 +77,8 @@ protected:
 
 private:
     struct Data {
-        Vector<JS::NonnullGCPtr<DOMEventListener>> event_listener_list;
+        // The event listener list, bucketed by listener type. Each bucket keeps the listeners of its type in list order.
+        HashMap<FlyString, Vector<JS::NonnullGCPtr<DOMEventListener>>> event_listener_list;
 
         // https://html.spec.whatwg.org/multipage/webappapis.html#event-handler-map
         // Spec Note: The order of the entries of event handler map could be arbitrary. It is not observable through any algorithms that operate on the map.
@@ -78,6 +86,7 @@ private:
     };
 
     Data& ensure_data();
+    void remove_from_event_listener_list_impl(DOMEventListener&);
     OwnPtr<Data> m_data;
 
     WebIDL::CallbackType* get_current_value_of_event_handler(FlyString const& name);
@@ -52,8 +52,8 @@ void HTMLCollection::visit_edges(Cell::Visitor& visitor)
 
 void HTMLCollection::update_cache_if_needed() const
 {
-    // Nothing to do, the DOM hasn't updated since we last built the cache.
-    if (m_cached_dom_tree_version == root()->document().dom_tree_version())
+    // Nothing to do, nothing underneath our root has changed since we last built the cache.
+    if (m_cached_dom_tree_version == m_root->subtree_dom_tree_version())
         return;
 
     m_cached_elements.clear();
@@ -70,7 +70,7 @@ void HTMLCollection::update_cache_if_needed() const
             return IterationDecision::Continue;
         });
     }
-    m_cached_dom_tree_version = root()->document().dom_tree_version();
+    m_cached_dom_tree_version = m_root->subtree_dom_tree_version();
 }
 
 JS::MarkedVector<JS::NonnullGCPtr<Element>> HTMLCollection::collect_matching_elements() const
@@ -58,7 +58,7 @@ private:
 
     void update_cache_if_needed() const;
 
-    mutable u64 m_cached_dom_tree_version { 0 };
+    mutable Optional<u64> m_cached_dom_tree_version;
     mutable Vector<JS::NonnullGCPtr<Element>> m_cached_elements;
 
     JS::NonnullGCPtr<ParentNode> m_root;
@@ -12,8 +12,6 @@
 
 namespace Web::DOM {
 
-// FIXME: Just like HTMLCollection, LiveNodeList currently does no caching.
-
 class LiveNodeList : public NodeList {
     WEB_PLATFORM_OBJECT(LiveNodeList, NodeList);
     JS_DECLARE_ALLOCATOR(LiveNodeList);
@@ -40,7 +38,10 @@ protected:
 private:
     virtual void visit_edges(Cell::Visitor&) override;
 
-    JS::MarkedVector<Node*> collection() const;
+    void update_cache_if_needed() const;
+
+    mutable Optional<u64> m_cached_dom_tree_version;
+    mutable Vector<JS::NonnullGCPtr<Node>> m_cached_nodes;
 
     JS::NonnullGCPtr<Node const> m_root;
     Function<bool(Node const&)> m_filter;
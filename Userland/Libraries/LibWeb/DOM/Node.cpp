@@ -209,7 +209,7 @@ void Node::set_text_content(Optional<String> const& maybe_content)
         document().invalidate_layout();
     }
 
-    document().bump_dom_tree_version();
+    bump_subtree_dom_tree_version();
 }
 
 // https://dom.spec.whatwg.org/#dom-node-nodevalue
@@ -423,15 +423,17 @@ void Node::insert_before(JS::NonnullGCPtr<Node> node, JS::GCPtr<Node> child, boo
 
     // 5. If child is non-null, then:
     if (child) {
+        auto child_index = child->index();
+
         // 1. For each live range whose start node is parent and start offset is greater than child’s index, increase its start offset by count.
         for (auto& range : Range::live_ranges()) {
-            if (range->start_container() == this && range->start_offset() > child->index())
+            if (range->start_container() == this && range->start_offset() > child_index)
                 range->increase_start_offset({}, count);
         }
 
         // 2. For each live range whose end node is parent and end offset is greater than child’s index, increase its end offset by count.
         for (auto& range : Range::live_ranges()) {
-            if (range->end_container() == this && range->end_offset() > child->index())
+            if (range->end_container() == this && range->end_offset() > child_index)
                 range->increase_end_offset({}, count);
         }
     }
@@ -470,7 +472,8 @@ void Node::insert_before(JS::NonnullGCPtr<Node> node, JS::GCPtr<Node> child, boo
 
         // 5. If parent’s root is a shadow root, and parent is a slot whose assigned nodes is the empty list, then run
         //    signal a slot change for parent.
-        if (root().is_shadow_root() && is<HTML::HTMLSlotElement>(*this)) {
+        auto& root = node_to_insert->root();
+        if (root.is_shadow_root() && is<HTML::HTMLSlotElement>(*this)) {
             auto& slot = static_cast<HTML::HTMLSlotElement&>(*this);
 
             if (slot.assigned_nodes_internal().is_empty())
@@ -478,9 +481,14 @@ void Node::insert_before(JS::NonnullGCPtr<Node> node, JS::GCPtr<Node> child, boo
         }
 
         // 6. Run assign slottables for a tree with node’s root.
-        assign_slottables_for_a_tree(node_to_insert->root());
+        // NOTE: node is a child of parent at this point, so they share a root.
+        assign_slottables_for_a_tree(root);
 
-        node_to_insert->invalidate_style();
+        // OPTIMIZATION: If parent is connected, its whole subtree has its style invalidated once the batch is in, so
+        //               there's no need to walk each inserted subtree here as well. Nodes that are not connected
+        //               don't have any style to invalidate until they are inserted into a document again.
+        if (!is_connected())
+            node_to_insert->invalidate_style();
 
         // 7. For each shadow-including inclusive descendant inclusiveDescendant of node, in shadow-including tree order:
         node_to_insert->for_each_shadow_including_inclusive_descendant([&](Node& inclusive_descendant) {
@@ -525,7 +533,7 @@ void Node::insert_before(JS::NonnullGCPtr<Node> node, JS::GCPtr<Node> child, boo
         document().invalidate_layout();
     }
 
-    document().bump_dom_tree_version();
+    bump_subtree_dom_tree_version();
 }
 
 // https://dom.spec.whatwg.org/#concept-node-pre-insert
@@ -724,7 +732,7 @@ void Node::remove(bool suppress_observers)
         document().invalidate_layout();
     }
 
-    document().bump_dom_tree_version();
+    parent->bump_subtree_dom_tree_version();
 }
 
 // https://dom.spec.whatwg.org/#concept-node-replace
@@ -997,6 +1005,18 @@ void Node::set_needs_style_update(bool value)
     }
 }
 
+void Node::bump_subtree_dom_tree_version()
+{
+    document().bump_dom_tree_version();
+
+    // NOTE: Nodes can move between documents, so subtree versions come from a single counter rather than from
+    //       the document's own DOM tree version.
+    static u64 s_next_subtree_dom_tree_version = 0;
+    auto version = ++s_next_subtree_dom_tree_version;
+    for (auto* node = this; node; node = node->parent())
+        node->m_subtree_dom_tree_version = version;
+}
+
 void Node::inserted()
 {
     set_needs_style_update(true);
@@ -1594,6 +1614,18 @@ Painting::PaintableBox* Node::paintable_box()
 // https://dom.spec.whatwg.org/#queue-a-mutation-record
 void Node::queue_mutation_record(FlyString const& type, Optional<FlyString> const& attribute_name, Optional<FlyString> const& attribute_namespace, Optional<String> const& old_value, Vector<JS::Handle<Node>> added_nodes, Vector<JS::Handle<Node>> removed_nodes, Node* previous_sibling, Node* next_sibling) const
 {
+    // OPTIMIZATION: Most mutations happen without any mutation observers around, so check for that before building up
+    //               the set of interested observers.
+    auto has_registered_observers = false;
+    for (auto* node = this; node; node = node->parent()) {
+        if (node->m_registered_observer_list && !node->m_registered_observer_list->is_empty()) {
+            has_registered_observers = true;
+            break;
+        }
+    }
+    if (!has_registered_observers)
+        return;
+
     // NOTE: We defer garbage collection until the end of the scope, since we can't safely use MutationObserver* as a hashmap key otherwise.
     // FIXME: This is a total hack.
     JS::DeferGC defer_gc(heap());
@@ -194,6 +194,10 @@ public:
     Element* parent_element();
     Element const* parent_element() const;
 
+    // NOTE: Every mutation records a new DOM tree version on the node it happened at and all of its ancestors, so
+    //       live collections can tell whether anything changed underneath their root.
+    u64 subtree_dom_tree_version() const { return m_subtree_dom_tree_version; }
+
     virtual void inserted();
     virtual void removed_from(Node*);
     virtual void children_changed() { }
@@ -715,6 +719,8 @@ protected:
 
     void build_accessibility_tree(AccessibilityTreeNode& parent);
 
+    void bump_subtree_dom_tree_version();
+
     ErrorOr<String> name_or_description(NameOrDescription, Document const&, HashTable<i32>&) const;
 
 private:
@@ -737,6 +743,8 @@ private:
     JS::GCPtr<Node> m_previous_sibling;
 
     JS::GCPtr<NodeList> m_child_nodes;
+
+    u64 m_subtree_dom_tree_version { 0 };
 };
 
 }
@@ -9,6 +9,7 @@
 #include <AK/FlyString.h>
 #include <AK/Forward.h>
 #include <LibJS/Heap/GCPtr.h>
+#include <LibWeb/DOM/ElementByIdMap.h>
 #include <LibWeb/Forward.h>
 #include <LibWeb/HTML/AttributeNames.h>
 #include <LibWeb/TreeNode.h>
@@ -20,24 +21,22 @@ class NonElementParentNode {
 public:
     JS::GCPtr<Element const> get_element_by_id(FlyString const& id) const
     {
-        JS::GCPtr<Element const> found_element;
-        static_cast<NodeType const*>(this)->template for_each_in_inclusive_subtree_of_type<Element>([&](auto& element) {
-            if (element.id() == id) {
-                found_element = &element;
-                return TraversalDecision::Break;
-            }
-            return TraversalDecision::Continue;
-        });
-        return found_element;
+        return const_cast<NonElementParentNode*>(this)->get_element_by_id(id);
     }
 
     JS::GCPtr<Element> get_element_by_id(FlyString const& id)
     {
+        auto& node = *static_cast<NodeType*>(this);
+
+        // OPTIMIZATION: Documents and shadow roots keep an index of their elements by id, so we don't have to walk the whole tree.
+        if (auto* element_by_id = ElementByIdMap::for_root(node))
+            return element_by_id->get(id);
+
         JS::GCPtr<Element> found_element;
-        static_cast<NodeType*>(this)->template for_each_in_inclusive_subtree_of_type<Element>([&](auto& element) {
+        node.template for_each_in_inclusive_subtree_of_type<Element>([&](auto& element) {
             if (element.id() == id) {
                 found_element = &element;
-                return TraversalDecision::Continue;
+                return TraversalDecision::Break;
             }
             return TraversalDecision::Continue;
         });
@@ -9,6 +9,7 @@
 #include <LibWeb/CSS/Parser/Parser.h>
 #include <LibWeb/CSS/SelectorEngine.h>
 #include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOM/ElementByIdMap.h>
 #include <LibWeb/DOM/HTMLCollection.h>
 #include <LibWeb/DOM/NodeOperations.h>
 #include <LibWeb/DOM/ParentNode.h>
@@ -21,6 +22,14 @@ namespace Web::DOM {
 
 JS_DEFINE_ALLOCATOR(ParentNode);
 
+static bool matches_selector(CSS::Selector const& selector, Element const& element, ParentNode const& scope)
+{
+    // OPTIMIZATION: Selectors like `div`, `.a` or `div.a` are matched with a few direct comparisons.
+    if (auto const& fast_path = selector.simple_compound_fast_path(); fast_path.has_value())
+        return SelectorEngine::matches_simple_compound_fast_path(*fast_path, {}, element);
+    return SelectorEngine::matches(selector, {}, element, {}, &scope);
+}
+
 // https://dom.spec.whatwg.org/#dom-parentnode-queryselector
 WebIDL::ExceptionOr<JS::GCPtr<Element>> ParentNode::query_selector(StringView selector_text)
 {
@@ -30,20 +39,30 @@ WebIDL::ExceptionOr<JS::GCPtr<Element>> ParentNode::query_selector(StringView se
     // https://dom.spec.whatwg.org/#scope-match-a-selectors-string
     // To scope-match a selectors string selectors against a node, run these steps:
     // 1. Let s be the result of parse a selector selectors.
-    auto maybe_selectors = parse_selector(CSS::Parser::ParsingContext(*this), selector_text);
+    auto maybe_selectors = document().parse_selector_list(selector_text);
 
     // 2. If s is failure, then throw a "SyntaxError" DOMException.
     if (!maybe_selectors.has_value())
         return WebIDL::SyntaxError::create(realm(), "Failed to parse selector"_fly_string);
 
-    auto selectors = maybe_selectors.value();
+    auto selectors = maybe_selectors.release_value();
+
+    // OPTIMIZATION: A lone "#id" selector matches exactly the elements with that id, so documents and shadow roots can
+    //               answer it from their index of elements by id.
+    if (selectors.size() == 1 && selectors[0]->compound_selectors().size() == 1) {
+        auto const& simple_selectors = selectors[0]->compound_selectors()[0].simple_selectors;
+        if (simple_selectors.size() == 1 && simple_selectors[0].type == CSS::Selector::SimpleSelector::Type::Id) {
+            if (auto* element_by_id = ElementByIdMap::for_root(*this))
+                return element_by_id->get(simple_selectors[0].name());
+        }
+    }
 
     // 3. Return the result of match a selector against a tree with s and node’s root using scoping root node.
     JS::GCPtr<Element> result;
     // FIXME: This should be shadow-including. https://drafts.csswg.org/selectors-4/#match-a-selector-against-a-tree
     for_each_in_subtree_of_type<Element>([&](auto& element) {
         for (auto& selector : selectors) {
-            if (SelectorEngine::matches(selector, {}, element, {}, this)) {
+            if (matches_selector(selector, element, *this)) {
                 result = &element;
                 return TraversalDecision::Break;
             }
@@ -62,21 +81,22 @@ WebIDL::ExceptionOr<JS::NonnullGCPtr<NodeList>> ParentNode::query_selector_all(S
     // https://dom.spec.whatwg.org/#scope-match-a-selectors-string
     // To scope-match a selectors string selectors against a node, run these steps:
     // 1. Let s be the result of parse a selector selectors.
-    auto maybe_selectors = parse_selector(CSS::Parser::ParsingContext(*this), selector_text);
+    auto maybe_selectors = document().parse_selector_list(selector_text);
 
     // 2. If s is failure, then throw a "SyntaxError" DOMException.
     if (!maybe_selectors.has_value())
         return WebIDL::SyntaxError::create(realm(), "Failed to parse selector"_fly_string);
 
-    auto selectors = maybe_selectors.value();
+    auto selectors = maybe_selectors.release_value();
 
     // 3. Return the result of match a selector against a tree with s and node’s root using scoping root node.
     Vector<JS::Handle<Node>> elements;
     // FIXME: This should be shadow-including. https://drafts.csswg.org/selectors-4/#match-a-selector-against-a-tree
     for_each_in_subtree_of_type<Element>([&](auto& element) {
         for (auto& selector : selectors) {
-            if (SelectorEngine::matches(selector, {}, element, {}, this)) {
+            if (matches_selector(selector, element, *this)) {
                 elements.append(&element);
+                break;
             }
         }
         return TraversalDecision::Continue;
@@ -8,6 +8,7 @@
 
 #include <LibWeb/Bindings/ShadowRootPrototype.h>
 #include <LibWeb/DOM/DocumentFragment.h>
+#include <LibWeb/DOM/ElementByIdMap.h>
 #include <LibWeb/WebIDL/ObservableArray.h>
 
 namespace Web::DOM {
@@ -62,6 +63,9 @@ public:
 
     Vector<JS::NonnullGCPtr<Animations::Animation>> get_animations();
 
+    ElementByIdMap& element_by_id() { return m_element_by_id; }
+    ElementByIdMap const& element_by_id() const { return m_element_by_id; }
+
     virtual void finalize() override;
 
 protected:
@@ -92,6 +96,8 @@ private:
 
     JS::GCPtr<CSS::StyleSheetList> m_style_sheets;
     mutable JS::GCPtr<WebIDL::ObservableArray> m_adopted_style_sheets;
+
+    ElementByIdMap m_element_by_id;
 };
 
 template<>
@@ -477,7 +477,7 @@ static WebIDL::ExceptionOr<String> serialize_element_attributes(DOM::Element con
     }
 
     // 4. Return the value of result.
-    return MUST(result.to_string());
+    return MUST(move(result).to_string());
 }
 
 // https://w3c.github.io/DOM-Parsing/#xml-serializing-an-element-node
@@ -693,7 +693,7 @@ static WebIDL::ExceptionOr<String> serialize_element(DOM::Element const& element
 
     // 17. If the value of skip end tag is true, then return the value of markup and skip the remaining steps. The node is a leaf-node.
     if (skip_end_tag)
-        return MUST(markup.to_string());
+        return MUST(move(markup).to_string());
 
     // 18. If ns is the HTML namespace, and the node's localName matches the string "template", then this is a template element.
     if (ns == Namespace::HTML && element.local_name() == HTML::TagNames::template_) {
@@ -719,7 +719,7 @@ static WebIDL::ExceptionOr<String> serialize_element(DOM::Element const& element
     markup.append('>');
 
     // 21. Return the value of markup.
-    return MUST(markup.to_string());
+    return MUST(move(markup).to_string());
 }
 
 // https://w3c.github.io/DOM-Parsing/#xml-serializing-a-document-node
@@ -739,7 +739,7 @@ static WebIDL::ExceptionOr<String> serialize_document(DOM::Document const& docum
         serialized_document.append(TRY(serialize_node_to_xml_string_impl(*child, namespace_, namespace_prefix_map, prefix_index, require_well_formed)));
 
     // 3. Return the value of serialized document.
-    return MUST(serialized_document.to_string());
+    return MUST(move(serialized_document).to_string());
 }
 
 // https://w3c.github.io/DOM-Parsing/#xml-serializing-a-comment-node
@@ -796,7 +796,7 @@ static WebIDL::ExceptionOr<String> serialize_document_fragment(DOM::DocumentFrag
         markup.append(TRY(serialize_node_to_xml_string_impl(*child, namespace_, namespace_prefix_map, prefix_index, require_well_formed)));
 
     // 3. Return the value of markup.
-    return MUST(markup.to_string());
+    return MUST(move(markup).to_string());
 }
 
 // https://w3c.github.io/DOM-Parsing/#xml-serializing-a-documenttype-node
@@ -862,7 +862,7 @@ static WebIDL::ExceptionOr<String> serialize_document_type(DOM::DocumentType con
     markup.append('>');
 
     // 11. Return the value of markup.
-    return MUST(markup.to_string());
+    return MUST(move(markup).to_string());
 }
 
 // https://w3c.github.io/DOM-Parsing/#dfn-xml-serializing-a-processinginstruction-node
@@ -903,7 +903,7 @@ static WebIDL::ExceptionOr<String> serialize_processing_instruction(DOM::Process
     markup.append("?>"sv);
 
     // 4. Return the value of markup.
-    return MUST(markup.to_string());
+    return MUST(move(markup).to_string());
 }
 
 // FIXME: This is ad-hoc
@@ -917,7 +917,7 @@ static WebIDL::ExceptionOr<String> serialize_cdata_section(DOM::CDATASection con
     markup.append(cdata_section.data());
     markup.append("]]>"sv);
 
-    return MUST(markup.to_string());
+    return MUST(move(markup).to_string());
 }
 
 }
@@ -199,7 +199,7 @@ WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::Promise>> consume_body(JS::Realm& realm
         HTML::TemporaryExecutionContext execution_context { Bindings::host_defined_environment_settings_object(realm) };
 
         auto value_or_error = Bindings::throw_dom_exception_if_needed(vm, [&]() -> WebIDL::ExceptionOr<JS::Value> {
-            return package_data(realm, data, type, object.mime_type_impl());
+            return package_data(realm, move(data), type, object.mime_type_impl());
         });
 
         if (value_or_error.is_error()) {
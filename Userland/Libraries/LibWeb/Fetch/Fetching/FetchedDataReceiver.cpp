@@ -40,10 +40,8 @@ void FetchedDataReceiver::set_pending_promise(JS::NonnullGCPtr<WebIDL::Promise>
     auto had_pending_promise = m_pending_promise != nullptr;
     m_pending_promise = promise;
 
-    if (!had_pending_promise && !m_buffer.is_empty()) {
-        on_data_received(m_buffer);
-        m_buffer.clear();
-    }
+    if (!had_pending_promise && !m_buffer.is_empty())
+        pull_bytes_into_stream(move(m_buffer));
 }
 
 // This implements the parallel steps of the pullAlgorithm in HTTP-network-fetch.
@@ -61,11 +59,17 @@ void FetchedDataReceiver::on_data_received(ReadonlyBytes bytes)
         return;
     }
 
+    // NOTE: This is the only copy of the bytes we make, the stream takes ownership of it.
+    pull_bytes_into_stream(MUST(ByteBuffer::copy(bytes)));
+}
+
+void FetchedDataReceiver::pull_bytes_into_stream(ByteBuffer bytes)
+{
     // 3. Queue a fetch task to run the following steps, with fetchParams’s task destination.
     Infrastructure::queue_fetch_task(
         m_fetch_params->controller(),
         m_fetch_params->task_destination().get<JS::NonnullGCPtr<JS::Object>>(),
-        JS::create_heap_function(heap(), [this, bytes = MUST(ByteBuffer::copy(bytes))]() mutable {
+        JS::create_heap_function(heap(), [this, bytes = move(bytes)]() mutable {
             HTML::TemporaryExecutionContext execution_context { Bindings::host_defined_environment_settings_object(m_stream->realm()), HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
 
             // 1. Pull from bytes buffer into stream.
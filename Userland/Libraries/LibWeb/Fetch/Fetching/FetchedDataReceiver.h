@@ -28,6 +28,8 @@ private:
 
     virtual void visit_edges(Visitor& visitor) override;
 
+    void pull_bytes_into_stream(ByteBuffer);
+
     JS::NonnullGCPtr<Infrastructure::FetchParams const> m_fetch_params;
     JS::NonnullGCPtr<Streams::ReadableStream> m_stream;
     JS::GCPtr<WebIDL::Promise> m_pending_promise;
@@ -2064,6 +2064,19 @@ WebIDL::ExceptionOr<JS::NonnullGCPtr<PendingResponse>> nonstandard_resource_load
     load_request.set_url(request->current_url());
     load_request.set_page(page);
     load_request.set_method(ByteString::copy(request->method()));
+    load_request.set_navigation_request(request->mode() == Infrastructure::Request::Mode::Navigate);
+    if (auto const* origin = request->origin().get_pointer<HTML::Origin>())
+        load_request.set_initiator_origin(*origin);
+
+    switch (request->cache_mode()) {
+    case Infrastructure::Request::CacheMode::NoStore:
+    case Infrastructure::Request::CacheMode::Reload:
+    case Infrastructure::Request::CacheMode::NoCache:
+        load_request.set_may_use_stored_response(false);
+        break;
+    default:
+        break;
+    }
 
     for (auto const& header : *request->header_list())
         load_request.set_header(ByteString::copy(header.name), ByteString::copy(header.value));
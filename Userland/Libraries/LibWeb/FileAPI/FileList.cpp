@@ -78,7 +78,7 @@ WebIDL::ExceptionOr<void> FileList::serialization_steps(HTML::SerializationRecor
     // 2. For each file in value, append the sub-serialization of file to serialized.[[Files]].
     HTML::serialize_primitive_type(serialized, m_files.size());
     for (auto& file : m_files)
-        serialized.extend(TRY(HTML::structured_serialize_internal(vm, file, for_storage, memory)));
+        TRY(HTML::structured_serialize_internal(vm, serialized, file, for_storage, memory));
 
     return {};
 }
@@ -25,6 +25,7 @@ class XMLDocumentBuilder;
 
 namespace Web::Painting {
 class BackingStore;
+class DisplayList;
 class DisplayListRecorder;
 class SVGGradientPaintStyle;
 using PaintStyle = RefPtr<SVGGradientPaintStyle>;
@@ -244,6 +245,7 @@ class DOMEventListener;
 class DOMImplementation;
 class DOMTokenList;
 class Element;
+class ElementByIdMap;
 class Event;
 class EventHandler;
 class EventTarget;
@@ -456,15 +458,19 @@ class NavigationDestination;
 class NavigationHistoryEntry;
 class NavigationTransition;
 class Navigator;
+class OffscreenCanvas;
+class OffscreenCanvasRenderingContext2D;
 class Origin;
 class PageTransitionEvent;
 class Path2D;
 class Plugin;
 class PluginArray;
 class PromiseRejectionEvent;
+class Scheduler;
 class SelectedFile;
 class SharedImageRequest;
 class Storage;
+class StorageBottle;
 class SubmitEvent;
 class TextMetrics;
 class Timer;
@@ -704,6 +710,7 @@ class Table;
 namespace Web::WebAudio {
 class AudioBuffer;
 class AudioContext;
+class AudioDestinationNode;
 class AudioNode;
 class AudioParam;
 class AudioScheduledSourceNode;
@@ -13,6 +13,13 @@ namespace Web::HTML {
 
 JS_DEFINE_ALLOCATOR(AnimatedBitmapDecodedImageData);
 
+static size_t s_total_decoded_bytes = 0;
+
+size_t AnimatedBitmapDecodedImageData::total_decoded_bytes()
+{
+    return s_total_decoded_bytes;
+}
+
 ErrorOr<JS::NonnullGCPtr<AnimatedBitmapDecodedImageData>> AnimatedBitmapDecodedImageData::create(JS::Realm& realm, Vector<Frame>&& frames, size_t loop_count, bool animated)
 {
     return realm.heap().allocate<AnimatedBitmapDecodedImageData>(realm, move(frames), loop_count, animated);
@@ -23,9 +30,17 @@ AnimatedBitmapDecodedImageData::AnimatedBitmapDecodedImageData(Vector<Frame>&& f
     , m_loop_count(loop_count)
     , m_animated(animated)
 {
+    for (auto const& frame : m_frames) {
+        if (frame.bitmap)
+            m_decoded_bytes += frame.bitmap->bitmap().size_in_bytes();
+    }
+    s_total_decoded_bytes += m_decoded_bytes;
 }
 
-AnimatedBitmapDecodedImageData::~AnimatedBitmapDecodedImageData() = default;
+AnimatedBitmapDecodedImageData::~AnimatedBitmapDecodedImageData()
+{
+    s_total_decoded_bytes -= m_decoded_bytes;
+}
 
 RefPtr<Gfx::ImmutableBitmap> AnimatedBitmapDecodedImageData::bitmap(size_t frame_index, Gfx::IntSize) const
 {
@@ -35,10 +35,14 @@ public:
     virtual Optional<CSSPixels> intrinsic_height() const override;
     virtual Optional<CSSPixelFraction> intrinsic_aspect_ratio() const override;
 
+    // Total size of all decoded frames currently held by live AnimatedBitmapDecodedImageData objects in this process.
+    static size_t total_decoded_bytes();
+
 private:
     AnimatedBitmapDecodedImageData(Vector<Frame>&&, size_t loop_count, bool animated);
 
     Vector<Frame> m_frames;
+    size_t m_decoded_bytes { 0 };
     size_t m_loop_count { 0 };
     bool m_animated { false };
 };
@@ -17,19 +17,12 @@ namespace Web::HTML {
 struct AnimationFrameCallbackDriver {
     using Callback = Function<void(double)>;
 
-    AnimationFrameCallbackDriver()
-    {
-        m_timer = Core::Timer::create_single_shot(16, [] {
-            HTML::main_thread_event_loop().schedule();
-        });
-    }
-
     i32 add(Callback handler)
     {
         auto id = m_id_allocator.allocate();
         m_callbacks.set(id, move(handler));
-        if (!m_timer->is_active())
-            m_timer->start();
+        // NOTE: The event loop runs the callbacks when it updates the rendering, which it does at most once per display frame.
+        HTML::main_thread_event_loop().schedule();
         return id;
     }
 
@@ -58,7 +51,6 @@ struct AnimationFrameCallbackDriver {
 private:
     OrderedHashMap<i32, Callback> m_callbacks;
     IDAllocator m_id_allocator;
-    RefPtr<Core::Timer> m_timer;
 };
 
 }
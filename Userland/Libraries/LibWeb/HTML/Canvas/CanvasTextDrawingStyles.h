@@ -11,6 +11,7 @@
 #include <LibWeb/CSS/StyleValues/ShorthandStyleValue.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/HTML/Canvas/CanvasState.h>
+#include <LibWeb/Platform/FontPlugin.h>
 
 namespace Web::HTML {
 
@@ -52,13 +53,20 @@ public:
 
         // Load font with font style value properties
         auto const& font_style_value = my_drawing_state().font_style_value->as_shorthand();
-        auto& canvas_element = reinterpret_cast<IncludingClass&>(*this).canvas_element();
+        auto font_style_source = reinterpret_cast<IncludingClass&>(*this).font_style_source_object();
         auto& font_style = *font_style_value.longhand(CSS::PropertyID::FontStyle);
         auto& font_weight = *font_style_value.longhand(CSS::PropertyID::FontWeight);
         auto& font_stretch = *font_style_value.longhand(CSS::PropertyID::FontStretch);
         auto& font_size = *font_style_value.longhand(CSS::PropertyID::FontSize);
         auto& font_family = *font_style_value.longhand(CSS::PropertyID::FontFamily);
-        auto font_list = canvas_element.document().style_computer().compute_font_for_style_values(&canvas_element, {}, font_family, font_size, font_style, font_weight, font_stretch);
+
+        // FIXME: Workers have no style computer to resolve the font with, so they always get the default font for now.
+        if (!font_style_source) {
+            my_drawing_state().current_font = Platform::FontPlugin::the().default_font();
+            return;
+        }
+        auto const* element = dynamic_cast<DOM::Element const*>(font_style_source.ptr());
+        auto font_list = font_style_source->document().style_computer().compute_font_for_style_values(element, {}, font_family, font_size, font_style, font_weight, font_stretch);
         my_drawing_state().current_font = font_list->first();
     }
 
@@ -10,6 +10,7 @@
 #include <LibGfx/Painter.h>
 #include <LibGfx/Quad.h>
 #include <LibGfx/Rect.h>
+#include <LibJS/Runtime/ValueInlines.h>
 #include <LibUnicode/Segmenter.h>
 #include <LibWeb/Bindings/CanvasRenderingContext2DPrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
@@ -18,10 +19,15 @@
 #include <LibWeb/HTML/HTMLImageElement.h>
 #include <LibWeb/HTML/ImageBitmap.h>
 #include <LibWeb/HTML/ImageData.h>
+#include <LibWeb/HTML/OffscreenCanvas.h>
 #include <LibWeb/HTML/Path2D.h>
 #include <LibWeb/HTML/TextMetrics.h>
 #include <LibWeb/Infra/CharacterTypes.h>
 #include <LibWeb/Layout/TextNode.h>
+#include <LibWeb/Page/Page.h>
+#include <LibWeb/Painting/DisplayList.h>
+#include <LibWeb/Painting/DisplayListPlayerSkia.h>
+#include <LibWeb/Painting/DisplayListRecorder.h>
 #include <LibWeb/Painting/Paintable.h>
 #include <LibWeb/Platform/FontPlugin.h>
 #include <LibWeb/WebIDL/ExceptionOr.h>
@@ -30,15 +36,41 @@ namespace Web::HTML {
 
 JS_DEFINE_ALLOCATOR(CanvasRenderingContext2D);
 
-JS::NonnullGCPtr<CanvasRenderingContext2D> CanvasRenderingContext2D::create(JS::Realm& realm, HTMLCanvasElement& element)
+JS::ThrowCompletionOr<CanvasRenderingContext2DSettings> convert_value_to_context_2d_settings_dictionary(JS::VM& vm, JS::Value value)
 {
-    return realm.heap().allocate<CanvasRenderingContext2D>(realm, realm, element);
+    if (!value.is_nullish() && !value.is_object())
+        return vm.throw_completion<JS::TypeError>(JS::ErrorType::NotAnObjectOfType, "CanvasRenderingContext2DSettings");
+
+    CanvasRenderingContext2DSettings settings {};
+
+    JS::Value will_read_frequently;
+    if (value.is_nullish())
+        will_read_frequently = JS::js_undefined();
+    else
+        will_read_frequently = TRY(value.as_object().get("willReadFrequently"));
+
+    if (!will_read_frequently.is_undefined())
+        settings.will_read_frequently = will_read_frequently.to_boolean();
+
+    return settings;
 }
 
-CanvasRenderingContext2D::CanvasRenderingContext2D(JS::Realm& realm, HTMLCanvasElement& element)
+JS::NonnullGCPtr<CanvasRenderingContext2D> CanvasRenderingContext2D::create(JS::Realm& realm, HTMLCanvasElement& element, CanvasRenderingContext2DSettings settings)
+{
+    return realm.heap().allocate<CanvasRenderingContext2D>(realm, realm, element, settings);
+}
+
+CanvasRenderingContext2D::CanvasRenderingContext2D(JS::Realm& realm, HTMLCanvasElement& element, CanvasRenderingContext2DSettings settings)
     : PlatformObject(realm)
     , CanvasPath(static_cast<Bindings::PlatformObject&>(*this), *this)
     , m_element(element)
+    , m_settings(settings)
+{
+}
+
+CanvasRenderingContext2D::CanvasRenderingContext2D(JS::Realm& realm)
+    : PlatformObject(realm)
+    , CanvasPath(static_cast<Bindings::PlatformObject&>(*this), *this)
 {
 }
 
@@ -66,11 +98,49 @@ HTMLCanvasElement const& CanvasRenderingContext2D::canvas_element() const
     return *m_element;
 }
 
-JS::NonnullGCPtr<HTMLCanvasElement> CanvasRenderingContext2D::canvas_for_binding() const
+WebIDL::ExceptionOr<JS::NonnullGCPtr<HTMLCanvasElement>> CanvasRenderingContext2D::canvas_for_binding() const
 {
+    // NOTE: OffscreenCanvasRenderingContext2D shares our implementation but has no canvas element, and the bindings let
+    //       this getter be called on one of those, e.g. through Function.prototype.call().
+    if (!m_element)
+        return vm().throw_completion<JS::TypeError>(JS::ErrorType::NotAnObjectOfType, "CanvasRenderingContext2D");
     return *m_element;
 }
 
+JS::GCPtr<DOM::Node> CanvasRenderingContext2D::font_style_source_object()
+{
+    // The font style source object of a CanvasRenderingContext2D is the context's canvas element.
+    return m_element;
+}
+
+Gfx::Bitmap* CanvasRenderingContext2D::output_bitmap()
+{
+    return canvas_element().bitmap();
+}
+
+Gfx::Bitmap const* CanvasRenderingContext2D::output_bitmap() const
+{
+    return canvas_element().bitmap();
+}
+
+bool CanvasRenderingContext2D::has_output_bitmap() const
+{
+    return canvas_element().has_bitmap();
+}
+
+bool CanvasRenderingContext2D::create_output_bitmap()
+{
+    return canvas_element().create_bitmap();
+}
+
+bool CanvasRenderingContext2D::can_record_drawing() const
+{
+    // NOTE: Contexts that are read back frequently keep painting right away, so reading never waits on rasterizing a batch.
+    if (m_settings.will_read_frequently)
+        return false;
+    return canvas_element().document().page().client().display_list_player_type() == DisplayListPlayerType::Skia;
+}
+
 Gfx::Path CanvasRenderingContext2D::rect_path(float x, float y, float width, float height)
 {
     auto& drawing_state = this->drawing_state();
@@ -183,10 +253,10 @@ void CanvasRenderingContext2D::did_draw(Gfx::FloatRect const&)
 
 Gfx::Painter* CanvasRenderingContext2D::painter()
 {
-    if (!canvas_element().bitmap()) {
-        if (!canvas_element().create_bitmap())
+    if (!output_bitmap()) {
+        if (!create_output_bitmap())
             return nullptr;
-        m_painter = make<Gfx::Painter>(*canvas_element().bitmap());
+        m_painter = make<Gfx::Painter>(*output_bitmap());
     }
     return m_painter.ptr();
 }
@@ -199,6 +269,55 @@ Optional<Gfx::AntiAliasingPainter> CanvasRenderingContext2D::antialiased_painter
     return {};
 }
 
+// Recorded commands hold on to their paths, so we don't let an unpainted canvas queue up an unbounded amount of them.
+static constexpr size_t max_pending_canvas_commands = 4096;
+
+Painting::DisplayListRecorder* CanvasRenderingContext2D::display_list_recorder()
+{
+    if (!can_record_drawing())
+        return nullptr;
+
+    // The display list can't express canvas clip paths, so clipped drawing is painted right away.
+    if (drawing_state().clip.has_value())
+        return nullptr;
+
+    // NOTE: This goes through painter() so that the painter is always set up for the same bitmap we draw into.
+    if (!has_output_bitmap() && !painter())
+        return nullptr;
+
+    // NOTE: Accessing the canvas bitmap flushes the pending drawing.
+    if (m_pending_command_count >= max_pending_canvas_commands)
+        (void)output_bitmap();
+
+    if (!m_pending_display_list) {
+        m_pending_display_list = make<Painting::DisplayList>();
+        m_pending_display_list_recorder = make<Painting::DisplayListRecorder>(*m_pending_display_list);
+    }
+    ++m_pending_command_count;
+    return m_pending_display_list_recorder.ptr();
+}
+
+void CanvasRenderingContext2D::flush_pending_drawing(Badge<HTMLCanvasElement>, Gfx::Bitmap& bitmap)
+{
+    if (!m_pending_display_list)
+        return;
+
+    // NOTE: Canvas bitmaps hold unpremultiplied pixels, which is what getImageData() and putImageData() work with.
+    auto display_list = m_pending_display_list.release_nonnull();
+    m_pending_display_list_recorder = nullptr;
+    m_pending_command_count = 0;
+
+    Painting::DisplayListPlayerSkia player { bitmap, Painting::DisplayListPlayerSkia::AlphaType::Unpremultiplied };
+    display_list->execute(player);
+}
+
+void CanvasRenderingContext2D::discard_pending_drawing()
+{
+    m_pending_display_list_recorder = nullptr;
+    m_pending_display_list = nullptr;
+    m_pending_command_count = 0;
+}
+
 Gfx::Path CanvasRenderingContext2D::text_path(StringView text, float x, float y, Optional<double> max_width)
 {
     if (max_width.has_value() && max_width.value() <= 0)
@@ -270,6 +389,19 @@ void CanvasRenderingContext2D::begin_path()
 
 void CanvasRenderingContext2D::stroke_internal(Gfx::Path const& path)
 {
+    if (auto color = drawing_state().stroke_style.as_color(); color.has_value()) {
+        if (auto* recorder = display_list_recorder()) {
+            auto& drawing_state = this->drawing_state();
+            recorder->stroke_path({
+                .path = path,
+                .color = color->with_opacity(drawing_state.global_alpha),
+                .thickness = drawing_state.line_width,
+            });
+            did_draw(path.bounding_box());
+            return;
+        }
+    }
+
     draw_clipped([&](auto& painter) {
         auto& drawing_state = this->drawing_state();
         if (auto color = drawing_state.stroke_style.as_color(); color.has_value()) {
@@ -304,6 +436,20 @@ static Gfx::WindingRule parse_fill_rule(StringView fill_rule)
 
 void CanvasRenderingContext2D::fill_internal(Gfx::Path const& path, Gfx::WindingRule winding_rule)
 {
+    if (auto color = drawing_state().fill_style.as_color(); color.has_value()) {
+        if (auto* recorder = display_list_recorder()) {
+            auto path_to_fill = path;
+            path_to_fill.close_all_subpaths();
+            recorder->fill_path({
+                .path = path_to_fill,
+                .color = color->with_opacity(drawing_state().global_alpha),
+                .winding_rule = winding_rule,
+            });
+            did_draw(path_to_fill.bounding_box());
+            return;
+        }
+    }
+
     draw_clipped([&, this](auto& painter) mutable {
         auto path_to_fill = path;
         path_to_fill.close_all_subpaths();
@@ -349,21 +495,21 @@ WebIDL::ExceptionOr<JS::GCPtr<ImageData>> CanvasRenderingContext2D::get_image_da
     auto image_data = TRY(ImageData::create(realm(), width, height, settings));
 
     // NOTE: We don't attempt to create the underlying bitmap here; if it doesn't exist, it's like copying only transparent black pixels (which is a no-op).
-    if (!canvas_element().bitmap())
+    if (!output_bitmap())
         return image_data;
-    auto const& bitmap = *canvas_element().bitmap();
+    auto const& bitmap = *output_bitmap();
 
     // 5. Let the source rectangle be the rectangle whose corners are the four points (sx, sy), (sx+sw, sy), (sx+sw, sy+sh), (sx, sy+sh).
     auto source_rect = Gfx::Rect { x, y, width, height };
     auto source_rect_intersected = source_rect.intersected(bitmap.rect());
 
     // 6. Set the pixel values of imageData to be the pixels of this's output bitmap in the area specified by the source rectangle in the bitmap's coordinate space units, converted from this's color space to imageData's colorSpace using 'relative-colorimetric' rendering intent.
-    // FIXME: Can't use a Gfx::Painter + blit() here as it doesn't support ImageData bitmap's RGBA8888 format.
-    for (int target_y = 0; target_y < source_rect_intersected.height(); ++target_y) {
-        for (int target_x = 0; target_x < source_rect_intersected.width(); ++target_x) {
-            auto pixel = bitmap.get_pixel(target_x + x, target_y + y);
-            image_data->bitmap().set_pixel(target_x, target_y, pixel);
-        }
+    VERIFY(bitmap.format() == Gfx::BitmapFormat::BGRA8888);
+    auto& destination = image_data->bitmap();
+    for (int row = 0; row < source_rect_intersected.height(); ++row) {
+        auto const* source_scanline = bitmap.scanline(source_rect_intersected.y() + row) + source_rect_intersected.x();
+        auto* destination_scanline = destination.scanline(source_rect_intersected.y() - y + row) + (source_rect_intersected.x() - x);
+        swap_red_and_blue_channels({ source_scanline, static_cast<size_t>(source_rect_intersected.width()) }, { destination_scanline, static_cast<size_t>(source_rect_intersected.width()) });
     }
 
     // 7. Set the pixels values of imageData for areas of the source rectangle that are outside of the output bitmap to transparent black.
@@ -373,17 +519,40 @@ WebIDL::ExceptionOr<JS::GCPtr<ImageData>> CanvasRenderingContext2D::get_image_da
     return image_data;
 }
 
+// https://html.spec.whatwg.org/multipage/canvas.html#dom-context-2d-putimagedata
 void CanvasRenderingContext2D::put_image_data(ImageData const& image_data, float x, float y)
 {
-    draw_clipped([&](auto& painter) {
-        painter.underlying_painter().blit(Gfx::IntPoint(x, y), image_data.bitmap(), image_data.bitmap().rect());
-        return Gfx::FloatRect(x, y, image_data.width(), image_data.height());
-    });
+    // NOTE: This goes through painter() so that the painter is always set up for the same bitmap we draw into.
+    if (!painter())
+        return;
+
+    // NOTE: Accessing the output bitmap flushes any pending drawing, which has to land underneath the image data.
+    auto* bitmap = output_bitmap();
+    VERIFY(bitmap && bitmap->format() == Gfx::BitmapFormat::BGRA8888);
+
+    // The pixels are placed as-is, without applying the current transformation matrix, global alpha, compositing or
+    // clipping region, so this is a plain copy of the rows that overlap the output bitmap.
+    auto destination_position = Gfx::IntPoint(x, y);
+    auto destination_rect = Gfx::IntRect { destination_position, image_data.bitmap().size() }.intersected(bitmap->rect());
+    if (destination_rect.is_empty())
+        return;
+
+    auto const& source = image_data.bitmap();
+    for (int row = 0; row < destination_rect.height(); ++row) {
+        auto const* source_scanline = source.scanline(destination_rect.y() - destination_position.y() + row) + (destination_rect.x() - destination_position.x());
+        auto* destination_scanline = bitmap->scanline(destination_rect.y() + row) + destination_rect.x();
+        swap_red_and_blue_channels({ source_scanline, static_cast<size_t>(destination_rect.width()) }, { destination_scanline, static_cast<size_t>(destination_rect.width()) });
+    }
+
+    did_draw(destination_rect.to_type<float>());
 }
 
 // https://html.spec.whatwg.org/multipage/canvas.html#reset-the-rendering-context-to-its-default-state
 void CanvasRenderingContext2D::reset_to_default_state()
 {
+    // Anything we haven't painted yet would be cleared right away.
+    discard_pending_drawing();
+
     auto painter = this->painter();
 
     // 1. Clear canvas's bitmap to transparent black.
@@ -584,11 +753,11 @@ WebIDL::ExceptionOr<CanvasImageSourceUsability> check_usability_of_image(CanvasI
         // If image's readyState attribute is either HAVE_NOTHING or HAVE_METADATA, then return bad.
 
         // HTMLCanvasElement
-        // FIXME: OffscreenCanvas
-        [](JS::Handle<HTMLCanvasElement> const& canvas_element) -> WebIDL::ExceptionOr<Optional<CanvasImageSourceUsability>> {
+        // OffscreenCanvas
+        [](OneOf<JS::Handle<HTMLCanvasElement>, JS::Handle<OffscreenCanvas>> auto const& canvas) -> WebIDL::ExceptionOr<Optional<CanvasImageSourceUsability>> {
             // If image has either a horizontal dimension or a vertical dimension equal to zero, then throw an "InvalidStateError" DOMException.
-            if (canvas_element->width() == 0 || canvas_element->height() == 0)
-                return WebIDL::InvalidStateError::create(canvas_element->realm(), "Canvas width or height is zero"_fly_string);
+            if (canvas->width() == 0 || canvas->height() == 0)
+                return WebIDL::InvalidStateError::create(canvas->realm(), "Canvas width or height is zero"_fly_string);
             return Optional<CanvasImageSourceUsability> {};
         },
 
@@ -621,7 +790,8 @@ bool image_is_not_origin_clean(CanvasImageSource const& image)
         // image's media data is CORS-cross-origin.
 
         // HTMLCanvasElement
-        [](OneOf<JS::Handle<HTMLCanvasElement>, JS::Handle<ImageBitmap>> auto const&) {
+        // OffscreenCanvas
+        [](OneOf<JS::Handle<HTMLCanvasElement>, JS::Handle<ImageBitmap>, JS::Handle<OffscreenCanvas>> auto const&) {
             // FIXME: image's bitmap's origin-clean flag is false.
             return false;
         });
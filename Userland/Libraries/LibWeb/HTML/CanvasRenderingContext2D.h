@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <AK/Badge.h>
 #include <AK/String.h>
 #include <AK/Variant.h>
 #include <LibGfx/AffineTransform.h>
@@ -36,6 +37,14 @@
 
 namespace Web::HTML {
 
+// https://html.spec.whatwg.org/multipage/canvas.html#canvasrenderingcontext2dsettings
+struct CanvasRenderingContext2DSettings {
+    // FIXME: alpha, desynchronized, colorSpace
+    bool will_read_frequently { false };
+};
+
+JS::ThrowCompletionOr<CanvasRenderingContext2DSettings> convert_value_to_context_2d_settings_dictionary(JS::VM&, JS::Value);
+
 class CanvasRenderingContext2D
     : public Bindings::PlatformObject
     , public CanvasPath
@@ -56,7 +65,7 @@ class CanvasRenderingContext2D
     JS_DECLARE_ALLOCATOR(CanvasRenderingContext2D);
 
 public:
-    [[nodiscard]] static JS::NonnullGCPtr<CanvasRenderingContext2D> create(JS::Realm&, HTMLCanvasElement&);
+    [[nodiscard]] static JS::NonnullGCPtr<CanvasRenderingContext2D> create(JS::Realm&, HTMLCanvasElement&, CanvasRenderingContext2DSettings = {});
     virtual ~CanvasRenderingContext2D() override;
 
     virtual void fill_rect(float x, float y, float width, float height) override;
@@ -81,7 +90,7 @@ public:
 
     virtual void reset_to_default_state() override;
 
-    JS::NonnullGCPtr<HTMLCanvasElement> canvas_for_binding() const;
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<HTMLCanvasElement>> canvas_for_binding() const;
 
     virtual JS::NonnullGCPtr<TextMetrics> measure_text(StringView text) override;
 
@@ -99,12 +108,35 @@ public:
     HTMLCanvasElement& canvas_element();
     HTMLCanvasElement const& canvas_element() const;
 
-private:
-    explicit CanvasRenderingContext2D(JS::Realm&, HTMLCanvasElement&);
+    // https://html.spec.whatwg.org/multipage/canvas.html#font-style-source-object
+    // Returns null when there is nothing to resolve fonts against, e.g. in a worker.
+    virtual JS::GCPtr<DOM::Node> font_style_source_object();
+
+    // Rasterizes the drawing operations that were recorded instead of being painted right away.
+    void flush_pending_drawing(Badge<HTMLCanvasElement>, Gfx::Bitmap&);
+    void discard_pending_drawing();
+
+protected:
+    // Used by contexts that don't draw into a canvas element, and which override the output bitmap hooks below.
+    explicit CanvasRenderingContext2D(JS::Realm&);
 
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
 
+    // https://html.spec.whatwg.org/multipage/canvas.html#output-bitmap
+    virtual Gfx::Bitmap* output_bitmap();
+    virtual Gfx::Bitmap const* output_bitmap() const;
+    virtual bool has_output_bitmap() const;
+    virtual bool create_output_bitmap();
+
+    virtual void did_draw(Gfx::FloatRect const&);
+
+    // Whether drawing may be recorded into a display list and rasterized later, see display_list_recorder().
+    virtual bool can_record_drawing() const;
+
+private:
+    CanvasRenderingContext2D(JS::Realm&, HTMLCanvasElement&, CanvasRenderingContext2DSettings);
+
     struct PreparedTextGlyph {
         String glyph;
         Gfx::IntPoint position;
@@ -116,8 +148,6 @@ private:
         Gfx::IntRect bounding_box;
     };
 
-    void did_draw(Gfx::FloatRect const&);
-
     template<typename TDrawFunction>
     void draw_clipped(TDrawFunction draw_function)
     {
@@ -138,6 +168,8 @@ private:
     Gfx::Painter* painter();
     Optional<Gfx::AntiAliasingPainter> antialiased_painter();
 
+    Painting::DisplayListRecorder* display_list_recorder();
+
     Gfx::Path rect_path(float x, float y, float width, float height);
 
     Gfx::Path text_path(StringView text, float x, float y, Optional<double> max_width);
@@ -146,9 +178,16 @@ private:
     void fill_internal(Gfx::Path const&, Gfx::WindingRule);
     void clip_internal(Gfx::Path&, Gfx::WindingRule);
 
-    JS::NonnullGCPtr<HTMLCanvasElement> m_element;
+    JS::GCPtr<HTMLCanvasElement> m_element;
+    CanvasRenderingContext2DSettings m_settings;
     OwnPtr<Gfx::Painter> m_painter;
 
+    // When the page paints with Skia, solid color fills and strokes are recorded here and rasterized with Skia as one
+    // batch once somebody needs the bitmap, instead of going through the AntiAliasingPainter one at a time.
+    OwnPtr<Painting::DisplayList> m_pending_display_list;
+    OwnPtr<Painting::DisplayListRecorder> m_pending_display_list_recorder;
+    size_t m_pending_command_count { 0 };
+
     // https://html.spec.whatwg.org/multipage/canvas.html#concept-canvas-origin-clean
     bool m_origin_clean { true };
 };
@@ -5,13 +5,17 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Math.h>
 #include <LibCore/EventLoop.h>
+#include <LibCore/TraceEvent.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
 #include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOM/Element.h>
 #include <LibWeb/HTML/BrowsingContext.h>
 #include <LibWeb/HTML/EventLoop/EventLoop.h>
 #include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/TraversableNavigable.h>
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/HighResolutionTime/Performance.h>
 #include <LibWeb/HighResolutionTime/TimeOrigin.h>
@@ -52,6 +56,40 @@ void EventLoop::schedule()
         m_system_event_loop_timer->restart();
 }
 
+void EventLoop::set_display_refresh_rate(double refresh_rate)
+{
+    if (refresh_rate <= 0)
+        return;
+    m_display_refresh_rate = refresh_rate;
+}
+
+bool EventLoop::begin_rendering_frame()
+{
+    auto now = HighResolutionTime::unsafe_shared_current_time();
+    auto frame_interval = 1000.0 / m_display_refresh_rate;
+
+    // NOTE: Platform timers have millisecond granularity, so we allow a frame to start slightly early rather than wait a whole extra frame.
+    static constexpr double frame_start_tolerance = 0.5;
+    if (now + frame_start_tolerance < m_next_rendering_frame_time) {
+        if (!m_rendering_frame_timer) {
+            m_rendering_frame_timer = Platform::Timer::create_single_shot(0, [this] {
+                schedule();
+            });
+        }
+        if (!m_rendering_frame_timer->is_active())
+            m_rendering_frame_timer->restart(static_cast<int>(AK::ceil(m_next_rendering_frame_time - now)));
+        return false;
+    }
+
+    // Advance by whole frame intervals so that frames stay on the same phase instead of drifting,
+    // skipping the frames we were too busy to render.
+    if (m_next_rendering_frame_time == 0)
+        m_next_rendering_frame_time = now;
+    auto missed_frames = AK::floor(max(0.0, now - m_next_rendering_frame_time) / frame_interval);
+    m_next_rendering_frame_time += (missed_frames + 1) * frame_interval;
+    return true;
+}
+
 EventLoop& main_thread_event_loop()
 {
     return *static_cast<Bindings::WebEngineCustomData*>(Bindings::main_thread_vm().custom_data())->event_loop;
@@ -163,14 +201,63 @@ void EventLoop::process()
         m_currently_running_task = oldest_task.ptr();
 
         // 6. Perform oldestTask's steps.
-        oldest_task->execute();
+        {
+            TRACE_EVENT_SCOPE("event_loop"sv, "Task"sv);
+            oldest_task->execute();
+        }
 
         // 7. Set the event loop's currently running task back to null.
         m_currently_running_task = nullptr;
     }
 
     // 8. Microtasks: Perform a microtask checkpoint.
-    perform_a_microtask_checkpoint();
+    {
+        TRACE_EVENT_SCOPE("event_loop"sv, "Microtask checkpoint"sv);
+        perform_a_microtask_checkpoint();
+    }
+
+    // 9. - 12. See update_the_rendering().
+    // AD-HOC: Rendering updates are aligned to the display's refresh rate, so we only run these steps once per frame.
+    //         Iterations that come in between frames skip them and make sure we get to process the next frame.
+    if (m_type != Type::Window || begin_rendering_frame())
+        update_the_rendering(task_start_time);
+
+    // 13. If all of the following are true
+    // - this is a window event loop
+    // - there is no task in this event loop's task queues whose document is fully active
+    // - this event loop's microtask queue is empty
+    // - hasARenderingOpportunity is false
+    // FIXME: has_a_rendering_opportunity is always true
+    if (m_type == Type::Window && !task_queue.has_runnable_tasks() && m_microtask_queue->is_empty() /*&& !has_a_rendering_opportunity*/) {
+        // 1. Set this event loop's last idle period start time to the unsafe shared current time.
+        m_last_idle_period_start_time = HighResolutionTime::unsafe_shared_current_time();
+
+        // 2. Let computeDeadline be the following steps:
+        // NOTE: instead of passing around a function we use this event loop, which has compute_deadline()
+
+        // 3. For each win of the same-loop windows for this event loop,
+        //    perform the start an idle period algorithm for win with computeDeadline. [REQUESTIDLECALLBACK]
+        for (auto& win : same_loop_windows())
+            win->start_an_idle_period();
+    }
+
+    // FIXME: 14. If this is a worker event loop, then:
+
+    // FIXME:     1. If this event loop's agent's single realm's global object is a supported DedicatedWorkerGlobalScope and the user agent believes that it would benefit from having its rendering updated at this time, then:
+    // FIXME:        1. Let now be the current high resolution time. [HRT]
+    // FIXME:        2. Run the animation frame callbacks for that DedicatedWorkerGlobalScope, passing in now as the timestamp.
+    // FIXME:        3. Update the rendering of that dedicated worker to reflect the current state.
+
+    // FIXME:     2. If there are no tasks in the event loop's task queues and the WorkerGlobalScope object's closing flag is true, then destroy the event loop, aborting these steps, resuming the run a worker steps described in the Web workers section below.
+
+    // If there are eligible tasks in the queue, schedule a new round of processing. :^)
+    if (m_task_queue->has_runnable_tasks() || (!m_microtask_queue->is_empty() && !m_performing_a_microtask_checkpoint))
+        schedule();
+}
+
+void EventLoop::update_the_rendering(double task_start_time)
+{
+    TRACE_EVENT_SCOPE("event_loop"sv, "EventLoop::update_the_rendering"sv);
 
     // 9. Let hasARenderingOpportunity be false.
     [[maybe_unused]] bool has_a_rendering_opportunity = false;
@@ -207,6 +294,10 @@ void EventLoop::process()
     //         loop processing.
     for_each_fully_active_document_in_docs([&](DOM::Document& document) {
         auto navigable = document.navigable();
+        // NOTE: A hidden navigable only gets a rendering opportunity once it becomes visible again, which is what
+        //       will update its rendering. Waiting for it here would keep the event loop spinning in the meantime.
+        if (navigable && navigable->traversable_navigable()->system_visibility_state() == VisibilityState::Hidden)
+            return;
         if (navigable && !navigable->has_a_rendering_opportunity() && navigable->needs_repaint())
             schedule();
         if (navigable && navigable->has_a_rendering_opportunity())
@@ -290,9 +381,43 @@ void EventLoop::process()
             // NOTE: Recalculation of styles is handled by update_layout()
             document.update_layout();
 
-            // FIXME: 2. Let hadInitialVisibleContentVisibilityDetermination be false.
-            // FIXME: 3. For each element element with 'auto' used value of 'content-visibility':
-            // FIXME: 4. If hadInitialVisibleContentVisibilityDetermination is true, then continue.
+            // 2. Let hadInitialVisibleContentVisibilityDetermination be false.
+            bool had_initial_visible_content_visibility_determination = false;
+            bool content_visibility_changed = false;
+
+            // 3. For each element element with 'auto' used value of 'content-visibility':
+            // NOTE: Only elements with a box can have a used value, and the layout tree builder registers those with the document.
+            for (auto& element : document.content_visibility_auto_elements()) {
+                // FIXME: This only notices changes caused by proximity, not e.g. focus moving into a skipped element.
+                bool was_skipping_its_contents = element->skips_its_contents();
+
+                // 1. Let checkForInitialDetermination be true if element's proximity to the viewport is not determined and it is not relevant to the user. Otherwise, let checkForInitialDetermination be false.
+                bool check_for_initial_determination = element->proximity_to_the_viewport() == DOM::Element::ProximityToTheViewport::NotDetermined && !element->is_relevant_to_the_user();
+
+                // 2. Determine proximity to the viewport for element.
+                element->determine_proximity_to_the_viewport();
+
+                // 3. If checkForInitialDetermination is true and element is now relevant to the user, then set hadInitialVisibleContentVisibilityDetermination to true.
+                if (check_for_initial_determination && element->is_relevant_to_the_user())
+                    had_initial_visible_content_visibility_determination = true;
+
+                if (was_skipping_its_contents != element->skips_its_contents())
+                    content_visibility_changed = true;
+            }
+
+            // NOTE: Whether an element skips its contents decides which boxes the layout tree has, so we have to rebuild it.
+            if (content_visibility_changed)
+                document.invalidate_layout();
+
+            // 4. If hadInitialVisibleContentVisibilityDetermination is true, then continue.
+            if (had_initial_visible_content_visibility_determination)
+                continue;
+
+            // NOTE: Proximity changes that aren't initial determinations are only picked up on the next rendering update,
+            //       which keeps elements from flipping back and forth within one. We still need layout to be up to date for
+            //       the resize observations below.
+            if (content_visibility_changed)
+                document.update_layout();
 
             // 5. Gather active resize observations at depth resizeObserverDepth for doc.
             document.gather_active_observations_at_depth(resize_observer_depth);
@@ -336,38 +461,6 @@ void EventLoop::process()
         }
     });
 
-    // 13. If all of the following are true
-    // - this is a window event loop
-    // - there is no task in this event loop's task queues whose document is fully active
-    // - this event loop's microtask queue is empty
-    // - hasARenderingOpportunity is false
-    // FIXME: has_a_rendering_opportunity is always true
-    if (m_type == Type::Window && !task_queue.has_runnable_tasks() && m_microtask_queue->is_empty() /*&& !has_a_rendering_opportunity*/) {
-        // 1. Set this event loop's last idle period start time to the unsafe shared current time.
-        m_last_idle_period_start_time = HighResolutionTime::unsafe_shared_current_time();
-
-        // 2. Let computeDeadline be the following steps:
-        // NOTE: instead of passing around a function we use this event loop, which has compute_deadline()
-
-        // 3. For each win of the same-loop windows for this event loop,
-        //    perform the start an idle period algorithm for win with computeDeadline. [REQUESTIDLECALLBACK]
-        for (auto& win : same_loop_windows())
-            win->start_an_idle_period();
-    }
-
-    // FIXME: 14. If this is a worker event loop, then:
-
-    // FIXME:     1. If this event loop's agent's single realm's global object is a supported DedicatedWorkerGlobalScope and the user agent believes that it would benefit from having its rendering updated at this time, then:
-    // FIXME:        1. Let now be the current high resolution time. [HRT]
-    // FIXME:        2. Run the animation frame callbacks for that DedicatedWorkerGlobalScope, passing in now as the timestamp.
-    // FIXME:        3. Update the rendering of that dedicated worker to reflect the current state.
-
-    // FIXME:     2. If there are no tasks in the event loop's task queues and the WorkerGlobalScope object's closing flag is true, then destroy the event loop, aborting these steps, resuming the run a worker steps described in the Web workers section below.
-
-    // If there are eligible tasks in the queue, schedule a new round of processing. :^)
-    if (m_task_queue->has_runnable_tasks() || (!m_microtask_queue->is_empty() && !m_performing_a_microtask_checkpoint))
-        schedule();
-
     // For each doc of docs, process top layer removals given doc.
     for_each_fully_active_document_in_docs([&](DOM::Document& document) {
         document.process_top_layer_removals();
@@ -559,8 +652,7 @@ double EventLoop::compute_deadline() const
     // 4. If hasPendingRenders is true, then:
     if (has_pending_renders) {
         // 1. Let nextRenderDeadline be this event loop's last render opportunity time plus (1000 divided by the current refresh rate).
-        // FIXME: Hardcoded to 60Hz
-        auto next_render_deadline = m_last_render_opportunity_time + (1000.0 / 60.0);
+        auto next_render_deadline = m_last_render_opportunity_time + (1000.0 / m_display_refresh_rate);
         // 2. If nextRenderDeadline is less than deadline, then return nextRenderDeadline.
         if (next_render_deadline < deadline)
             return next_render_deadline;
@@ -71,6 +71,10 @@ public:
 
     double compute_deadline() const;
 
+    // The refresh rate of the display the rendering is presented on, in frames per second. The rendering is updated at most once per frame.
+    double display_refresh_rate() const { return m_display_refresh_rate; }
+    void set_display_refresh_rate(double);
+
     // https://html.spec.whatwg.org/multipage/webappapis.html#pause
     void set_execution_paused(bool execution_paused) { m_execution_paused = execution_paused; }
     bool execution_paused() const { return m_execution_paused; }
@@ -80,6 +84,12 @@ private:
 
     virtual void visit_edges(Visitor&) override;
 
+    void update_the_rendering(double task_start_time);
+
+    // Returns true and advances the frame clock if the next rendering frame is due.
+    // Otherwise, arranges for the event loop to be processed again when it is.
+    bool begin_rendering_frame();
+
     Type m_type { Type::Window };
 
     JS::GCPtr<TaskQueue> m_task_queue;
@@ -95,6 +105,10 @@ private:
 
     RefPtr<Platform::Timer> m_system_event_loop_timer;
 
+    double m_display_refresh_rate { 60 };
+    double m_next_rendering_frame_time { 0 };
+    RefPtr<Platform::Timer> m_rendering_frame_timer;
+
     // https://html.spec.whatwg.org/#performing-a-microtask-checkpoint
     bool m_performing_a_microtask_checkpoint { false };
 
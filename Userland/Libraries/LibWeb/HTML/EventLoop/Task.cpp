@@ -23,6 +23,7 @@ JS::NonnullGCPtr<Task> Task::create(JS::VM& vm, Source source, JS::GCPtr<DOM::Do
 Task::Task(Source source, JS::GCPtr<DOM::Document const> document, JS::NonnullGCPtr<JS::HeapFunction<void()>> steps)
     : m_id(s_task_id_allocator.allocate())
     , m_source(source)
+    , m_priority(default_priority_for_source(source))
     , m_steps(steps)
     , m_document(document)
 {
@@ -42,6 +43,21 @@ void Task::visit_edges(Visitor& visitor)
     visitor.visit(m_document);
 }
 
+Task::Priority Task::default_priority_for_source(Source source)
+{
+    switch (source) {
+    // Input latency is what users notice first, so input events go ahead of everything else.
+    case Source::UserInteraction:
+        return Priority::High;
+    case Source::TimerTask:
+        return Priority::Low;
+    case Source::IdleTask:
+        return Priority::Idle;
+    default:
+        return Priority::Normal;
+    }
+}
+
 void Task::execute()
 {
     m_steps->function()();
@@ -51,7 +67,8 @@ void Task::execute()
 bool Task::is_runnable() const
 {
     // A task is runnable if its document is either null or fully active.
-    return !m_document.ptr() || m_document->is_fully_active();
+    // AD-HOC: Tasks of a frozen document wait until it is resumed, see TraversableNavigable::is_frozen().
+    return !m_document.ptr() || (m_document->is_fully_active() && !m_document->is_frozen());
 }
 
 DOM::Document const* Task::document() const
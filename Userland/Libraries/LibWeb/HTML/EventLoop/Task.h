@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Time.h>
 #include <LibJS/Heap/Cell.h>
 #include <LibJS/Heap/CellAllocator.h>
 #include <LibJS/SafeFunction.h>
@@ -60,12 +61,26 @@ public:
         // https://html.spec.whatwg.org/multipage/server-sent-events.html#remote-event-task-source
         RemoteEvent,
 
+        // https://wicg.github.io/scheduling-apis/#posted-task-task-source
+        PostedTask,
+
         // !!! IMPORTANT: Keep this field last!
         // This serves as the base value of all unique task sources.
         // Some elements, such as the HTMLMediaElement, must have a unique task source per instance.
         UniqueTaskSourceStart
     };
 
+    // NOTE: The event loop may pick tasks from any of its task queues, so we use priorities to choose between sources.
+    //       Tasks of equal priority, and thus all tasks of a single source, still run in the order they were queued.
+    enum class Priority {
+        Idle,
+        Low,
+        Normal,
+        High,
+    };
+
+    static Priority default_priority_for_source(Source);
+
     static JS::NonnullGCPtr<Task> create(JS::VM&, Source, JS::GCPtr<DOM::Document const>, JS::NonnullGCPtr<JS::HeapFunction<void()>> steps);
 
     virtual ~Task() override;
@@ -75,6 +90,11 @@ public:
     Source source() const { return m_source; }
     void execute();
 
+    Priority priority() const { return m_priority; }
+    void set_priority(Priority priority) { m_priority = priority; }
+
+    MonotonicTime queued_time() const { return m_queued_time; }
+
     DOM::Document const* document() const;
 
     bool is_runnable() const;
@@ -86,6 +106,8 @@ private:
 
     int m_id { 0 };
     Source m_source { Source::Unspecified };
+    Priority m_priority { Priority::Normal };
+    MonotonicTime m_queued_time { MonotonicTime::now_coarse() };
     JS::NonnullGCPtr<JS::HeapFunction<void()>> m_steps;
     JS::GCPtr<DOM::Document const> m_document;
 };
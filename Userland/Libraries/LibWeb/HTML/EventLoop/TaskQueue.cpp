@@ -4,7 +4,12 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AllOf.h>
+#include <AK/AnyOf.h>
+#include <AK/HashTable.h>
+#include <AK/QuickSort.h>
 #include <LibJS/Heap/MarkedVector.h>
+#include <LibWeb/DOM/Document.h>
 #include <LibWeb/HTML/EventLoop/EventLoop.h>
 #include <LibWeb/HTML/EventLoop/TaskQueue.h>
 
@@ -23,25 +28,135 @@ void TaskQueue::visit_edges(Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(m_event_loop);
-    visitor.visit(m_tasks);
+    for (auto& document_tasks : m_tasks_by_document) {
+        visitor.visit(document_tasks.document);
+        for (auto& tasks : document_tasks.tasks_by_priority) {
+            for (auto& queued_task : tasks)
+                visitor.visit(queued_task.task);
+        }
+    }
+}
+
+bool TaskQueue::DocumentTasks::is_empty() const
+{
+    return all_of(tasks_by_priority, [](auto const& tasks) { return tasks.is_empty(); });
+}
+
+bool TaskQueue::DocumentTasks::is_runnable() const
+{
+    // NOTE: All of these tasks have the same document, so they are either all runnable or none of them are.
+    for (auto const& tasks : tasks_by_priority) {
+        if (!tasks.is_empty())
+            return tasks.first().task->is_runnable();
+    }
+    return false;
+}
+
+TaskQueue::DocumentTasks& TaskQueue::tasks_for_document(DOM::Document const* document)
+{
+    for (auto& document_tasks : m_tasks_by_document) {
+        if (document_tasks.document.ptr() == document)
+            return document_tasks;
+    }
+    m_tasks_by_document.append({ .document = document, .tasks_by_priority = {} });
+    return m_tasks_by_document.last();
+}
+
+JS::NonnullGCPtr<Task> TaskQueue::take_first_task(size_t document_index, size_t priority_index)
+{
+    auto& document_tasks = m_tasks_by_document[document_index];
+    auto task = document_tasks.tasks_by_priority[priority_index].take_first().task;
+    --m_size;
+    if (document_tasks.is_empty())
+        m_tasks_by_document.remove(document_index);
+    return task;
+}
+
+void TaskQueue::remove_empty_documents()
+{
+    m_tasks_by_document.remove_all_matching([](auto const& document_tasks) {
+        return document_tasks.is_empty();
+    });
 }
 
 void TaskQueue::add(JS::NonnullGCPtr<Task> task)
 {
-    m_tasks.append(task);
+    auto& document_tasks = tasks_for_document(task->document());
+    document_tasks.tasks_by_priority[to_underlying(task->priority())].append({ task, m_next_sequence_number++ });
+    ++m_size;
     m_event_loop->schedule();
 }
 
+// A task gains one priority level for every this long it has been waiting, so that a steady stream of
+// higher priority tasks can only ever delay lower priority tasks by a bounded amount of time.
+static constexpr auto task_aging_interval = Duration::from_milliseconds(100);
+
+static int effective_priority(Task const& task, MonotonicTime now)
+{
+    auto waited = now - task.queued_time();
+    return to_underlying(task.priority()) + static_cast<int>(waited.to_milliseconds() / task_aging_interval.to_milliseconds());
+}
+
 JS::GCPtr<Task> TaskQueue::take_first_runnable()
 {
     if (m_event_loop->execution_paused())
         return nullptr;
 
-    for (size_t i = 0; i < m_tasks.size(); ++i) {
-        if (m_tasks[i]->is_runnable())
-            return m_tasks.take(i);
+    // NOTE: We pick the runnable task with the highest effective priority, and the earliest queued one among equals.
+    //       Only the first task of each list needs to be looked at: the tasks in a list share their base priority,
+    //       and older tasks have aged at least as much as newer ones. Unless a caller overrides it, every task of a
+    //       given source has the same base priority, so such tasks still run in order.
+    auto now = MonotonicTime::now_coarse();
+    Optional<size_t> best_document_index;
+    size_t best_priority_index = 0;
+    int best_priority = 0;
+    u64 best_sequence_number = 0;
+    for (size_t document_index = 0; document_index < m_tasks_by_document.size(); ++document_index) {
+        auto const& document_tasks = m_tasks_by_document[document_index];
+        if (!document_tasks.is_runnable())
+            continue;
+        for (size_t priority_index = 0; priority_index < document_tasks.tasks_by_priority.size(); ++priority_index) {
+            auto const& tasks = document_tasks.tasks_by_priority[priority_index];
+            if (tasks.is_empty())
+                continue;
+            auto const& candidate = tasks.first();
+            auto priority = effective_priority(*candidate.task, now);
+            if (!best_document_index.has_value() || priority > best_priority || (priority == best_priority && candidate.sequence_number < best_sequence_number)) {
+                best_document_index = document_index;
+                best_priority_index = priority_index;
+                best_priority = priority;
+                best_sequence_number = candidate.sequence_number;
+            }
+        }
+    }
+
+    if (!best_document_index.has_value())
+        return nullptr;
+    return take_first_task(*best_document_index, best_priority_index);
+}
+
+JS::GCPtr<Task> TaskQueue::dequeue()
+{
+    Optional<size_t> oldest_document_index;
+    size_t oldest_priority_index = 0;
+    u64 oldest_sequence_number = 0;
+    for (size_t document_index = 0; document_index < m_tasks_by_document.size(); ++document_index) {
+        auto const& document_tasks = m_tasks_by_document[document_index];
+        for (size_t priority_index = 0; priority_index < document_tasks.tasks_by_priority.size(); ++priority_index) {
+            auto const& tasks = document_tasks.tasks_by_priority[priority_index];
+            if (tasks.is_empty())
+                continue;
+            if (!oldest_document_index.has_value() || tasks.first().sequence_number < oldest_sequence_number) {
+                oldest_document_index = document_index;
+                oldest_priority_index = priority_index;
+                oldest_sequence_number = tasks.first().sequence_number;
+            }
+        }
     }
-    return nullptr;
+
+    if (!oldest_document_index.has_value())
+        return nullptr;
+    return take_first_task(*oldest_document_index, oldest_priority_index);
 }
 
 bool TaskQueue::has_runnable_tasks() const
@@ -49,43 +164,72 @@ bool TaskQueue::has_runnable_tasks() const
     if (m_event_loop->execution_paused())
         return false;
 
-    for (auto& task : m_tasks) {
-        if (task->is_runnable())
-            return true;
-    }
-    return false;
+    // NOTE: Lists are removed once they become empty, so any runnable list has a runnable task.
+    return any_of(m_tasks_by_document, [](auto const& document_tasks) { return document_tasks.is_runnable(); });
 }
 
 void TaskQueue::remove_tasks_matching(Function<bool(HTML::Task const&)> filter)
 {
-    m_tasks.remove_all_matching([&](auto& task) {
-        return filter(*task);
-    });
+    for (auto& document_tasks : m_tasks_by_document) {
+        for (auto& tasks : document_tasks.tasks_by_priority) {
+            m_size -= tasks.size();
+            tasks.remove_all_matching([&](auto& queued_task) {
+                return filter(*queued_task.task);
+            });
+            m_size += tasks.size();
+        }
+    }
+    remove_empty_documents();
 }
 
 JS::MarkedVector<JS::NonnullGCPtr<Task>> TaskQueue::take_tasks_matching(Function<bool(HTML::Task const&)> filter)
 {
-    JS::MarkedVector<JS::NonnullGCPtr<Task>> matching_tasks(heap());
-
-    for (size_t i = 0; i < m_tasks.size();) {
-        auto& task = m_tasks.at(i);
+    // NOTE: The filter is run before any task is taken out, so the tasks stay visible to the GC while it runs.
+    HashTable<u64> matching_sequence_numbers;
+    for (auto const& document_tasks : m_tasks_by_document) {
+        for (auto const& tasks : document_tasks.tasks_by_priority) {
+            for (auto const& queued_task : tasks) {
+                if (filter(*queued_task.task))
+                    matching_sequence_numbers.set(queued_task.sequence_number);
+            }
+        }
+    }
 
-        if (filter(*task)) {
-            matching_tasks.append(task);
-            m_tasks.remove(i);
-        } else {
-            ++i;
+    Vector<QueuedTask> matching_queued_tasks;
+    for (auto& document_tasks : m_tasks_by_document) {
+        for (auto& tasks : document_tasks.tasks_by_priority) {
+            tasks.remove_all_matching([&](auto& queued_task) {
+                if (!matching_sequence_numbers.contains(queued_task.sequence_number))
+                    return false;
+                matching_queued_tasks.append(queued_task);
+                return true;
+            });
         }
     }
+    m_size -= matching_queued_tasks.size();
+    remove_empty_documents();
+
+    // NOTE: The matching tasks are returned in the order they were queued.
+    quick_sort(matching_queued_tasks, [](auto const& a, auto const& b) { return a.sequence_number < b.sequence_number; });
 
+    JS::MarkedVector<JS::NonnullGCPtr<Task>> matching_tasks(heap());
+    for (auto& queued_task : matching_queued_tasks)
+        matching_tasks.append(queued_task.task);
     return matching_tasks;
 }
 
 Task const* TaskQueue::last_added_task() const
 {
-    if (m_tasks.is_empty())
+    QueuedTask const* last_added_task = nullptr;
+    for (auto const& document_tasks : m_tasks_by_document) {
+        for (auto const& tasks : document_tasks.tasks_by_priority) {
+            if (!tasks.is_empty() && (!last_added_task || tasks.last().sequence_number > last_added_task->sequence_number))
+                last_added_task = &tasks.last();
+        }
+    }
+    if (!last_added_task)
         return nullptr;
-    return m_tasks.last();
+    return last_added_task->task;
 }
 
 }
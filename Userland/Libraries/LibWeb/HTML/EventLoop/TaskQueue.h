@@ -6,7 +6,8 @@
 
 #pragma once
 
-#include <AK/Queue.h>
+#include <AK/Array.h>
+#include <AK/Vector.h>
 #include <LibJS/Heap/Cell.h>
 #include <LibWeb/HTML/EventLoop/Task.h>
 
@@ -20,7 +21,7 @@ public:
     explicit TaskQueue(HTML::EventLoop&);
     virtual ~TaskQueue() override;
 
-    bool is_empty() const { return m_tasks.is_empty(); }
+    bool is_empty() const { return m_size == 0; }
 
     bool has_runnable_tasks() const;
 
@@ -28,12 +29,7 @@ public:
     JS::GCPtr<HTML::Task> take_first_runnable();
 
     void enqueue(JS::NonnullGCPtr<HTML::Task> task) { add(task); }
-    JS::GCPtr<HTML::Task> dequeue()
-    {
-        if (m_tasks.is_empty())
-            return {};
-        return m_tasks.take_first();
-    }
+    JS::GCPtr<HTML::Task> dequeue();
 
     void remove_tasks_matching(Function<bool(HTML::Task const&)>);
     JS::MarkedVector<JS::NonnullGCPtr<Task>> take_tasks_matching(Function<bool(HTML::Task const&)>);
@@ -43,9 +39,31 @@ public:
 private:
     virtual void visit_edges(Visitor&) override;
 
+    struct QueuedTask {
+        JS::NonnullGCPtr<HTML::Task> task;
+        u64 sequence_number { 0 };
+    };
+
+    // NOTE: Whether a task is runnable only depends on its document, so tasks are kept in one list per document, and
+    //       the tasks of a document that isn't fully active (or is frozen) are skipped without looking at each of them.
+    //       Within a document, tasks are split up by priority, each list being in the order the tasks were queued.
+    struct DocumentTasks {
+        JS::GCPtr<DOM::Document const> document;
+        Array<Vector<QueuedTask>, to_underlying(Task::Priority::High) + 1> tasks_by_priority;
+
+        bool is_empty() const;
+        bool is_runnable() const;
+    };
+
+    DocumentTasks& tasks_for_document(DOM::Document const*);
+    JS::NonnullGCPtr<HTML::Task> take_first_task(size_t document_index, size_t priority_index);
+    void remove_empty_documents();
+
     JS::NonnullGCPtr<HTML::EventLoop> m_event_loop;
 
-    Vector<JS::NonnullGCPtr<HTML::Task>> m_tasks;
+    Vector<DocumentTasks> m_tasks_by_document;
+    size_t m_size { 0 };
+    u64 m_next_sequence_number { 0 };
 };
 
 }
@@ -98,6 +98,27 @@ unsigned HTMLCanvasElement::height() const
     return parse_non_negative_integer(get_attribute_value(HTML::AttributeNames::height)).value_or(150);
 }
 
+Gfx::Bitmap const* HTMLCanvasElement::bitmap() const
+{
+    // FIXME: Remove this const_cast.
+    const_cast<HTMLCanvasElement&>(*this).flush_pending_drawing();
+    return m_bitmap;
+}
+
+Gfx::Bitmap* HTMLCanvasElement::bitmap()
+{
+    flush_pending_drawing();
+    return m_bitmap;
+}
+
+void HTMLCanvasElement::flush_pending_drawing()
+{
+    if (!m_bitmap)
+        return;
+    if (auto* context = m_context.get_pointer<JS::NonnullGCPtr<CanvasRenderingContext2D>>())
+        (*context)->flush_pending_drawing({}, *m_bitmap);
+}
+
 void HTMLCanvasElement::reset_context_to_default_state()
 {
     m_context.visit(
@@ -133,12 +154,16 @@ JS::GCPtr<Layout::Node> HTMLCanvasElement::create_layout_node(NonnullRefPtr<CSS:
     return heap().allocate_without_realm<Layout::CanvasBox>(document(), *this, move(style));
 }
 
-HTMLCanvasElement::HasOrCreatedContext HTMLCanvasElement::create_2d_context()
+JS::ThrowCompletionOr<HTMLCanvasElement::HasOrCreatedContext> HTMLCanvasElement::create_2d_context(JS::Value options)
 {
     if (!m_context.has<Empty>())
         return m_context.has<JS::NonnullGCPtr<CanvasRenderingContext2D>>() ? HasOrCreatedContext::Yes : HasOrCreatedContext::No;
 
-    m_context = CanvasRenderingContext2D::create(realm(), *this);
+    // https://html.spec.whatwg.org/multipage/canvas.html#2d-context-creation-algorithm
+    // 1. Let settings be the result of converting options to a CanvasRenderingContext2DSettings dictionary.
+    auto settings = TRY(convert_value_to_context_2d_settings_dictionary(vm(), options));
+
+    m_context = CanvasRenderingContext2D::create(realm(), *this, settings);
     return HasOrCreatedContext::Yes;
 }
 
@@ -168,7 +193,7 @@ JS::ThrowCompletionOr<HTMLCanvasElement::RenderingContext> HTMLCanvasElement::ge
     // 3. Run the steps in the cell of the following table whose column header matches this canvas element's canvas context mode and whose row header matches contextId:
     // NOTE: See the spec for the full table.
     if (type == "2d"sv) {
-        if (create_2d_context() == HasOrCreatedContext::Yes)
+        if (TRY(create_2d_context(options)) == HasOrCreatedContext::Yes)
             return JS::make_handle(*m_context.get<JS::NonnullGCPtr<HTML::CanvasRenderingContext2D>>());
 
         return Empty {};
@@ -22,8 +22,10 @@ public:
 
     virtual ~HTMLCanvasElement() override;
 
-    Gfx::Bitmap const* bitmap() const { return m_bitmap; }
-    Gfx::Bitmap* bitmap() { return m_bitmap; }
+    // NOTE: These rasterize any drawing the context has recorded but not painted yet.
+    Gfx::Bitmap const* bitmap() const;
+    Gfx::Bitmap* bitmap();
+    bool has_bitmap() const { return m_bitmap; }
     bool create_bitmap(size_t minimum_width = 0, size_t minimum_height = 0);
 
     JS::ThrowCompletionOr<RenderingContext> get_context(String const& type, JS::Value options);
@@ -54,9 +56,10 @@ private:
         Yes,
     };
 
-    HasOrCreatedContext create_2d_context();
+    JS::ThrowCompletionOr<HasOrCreatedContext> create_2d_context(JS::Value options);
     JS::ThrowCompletionOr<HasOrCreatedContext> create_webgl_context(JS::Value options);
     void reset_context_to_default_state();
+    void flush_pending_drawing();
 
     RefPtr<Gfx::Bitmap> m_bitmap;
 
@@ -51,6 +51,9 @@ void HTMLIFrameElement::attribute_changed(FlyString const& name, Optional<String
         if (name == AttributeNames::srcdoc || (name == AttributeNames::src && !has_attribute(AttributeNames::srcdoc)))
             process_the_iframe_attributes();
     }
+
+    if (name == AttributeNames::loading)
+        lazy_loading_attribute_changed();
 }
 
 // https://html.spec.whatwg.org/multipage/iframe-embed-object.html#the-iframe-element:the-iframe-element-6
@@ -108,6 +108,9 @@ void HTMLImageElement::form_associated_element_attribute_changed(FlyString const
         if (layout_node())
             did_update_alt_text(verify_cast<Layout::ImageBox>(*layout_node()));
     }
+
+    if (name == HTML::AttributeNames::loading)
+        lazy_loading_attribute_changed();
 }
 
 JS::GCPtr<Layout::Node> HTMLImageElement::create_layout_node(NonnullRefPtr<CSS::StyleProperties> style)
@@ -83,6 +83,14 @@ void HTMLLinkElement::inserted()
         ResourceLoader::the().prefetch_dns(document().parse_url(get_attribute_value(HTML::AttributeNames::href)));
     } else if (m_relationship & Relationship::Preconnect) {
         ResourceLoader::the().preconnect(document().parse_url(get_attribute_value(HTML::AttributeNames::href)));
+    } else if (m_relationship & Relationship::Prefetch) {
+        // https://html.spec.whatwg.org/multipage/links.html#link-type-prefetch
+        auto url = document().parse_url(get_attribute_value(HTML::AttributeNames::href));
+        if (url.is_valid()) {
+            auto request = LoadRequest::create_for_url_on_page(url, &document().page());
+            request.set_initiator_origin(document().origin());
+            ResourceLoader::the().prefetch(request);
+        }
     } else if (m_relationship & Relationship::Icon) {
         auto favicon_url = document().parse_url(href());
         auto favicon_request = LoadRequest::create_for_url_on_page(favicon_url, &document().page());
@@ -154,6 +162,8 @@ void HTMLLinkElement::attribute_changed(FlyString const& name, Optional<String>
                 m_relationship |= Relationship::Preconnect;
             else if (part == "icon"sv)
                 m_relationship |= Relationship::Icon;
+            else if (part == "prefetch"sv)
+                m_relationship |= Relationship::Prefetch;
         }
 
         if (m_rel_list)
@@ -14,14 +14,18 @@
 #include <LibWeb/DOM/Event.h>
 #include <LibWeb/DOM/ShadowRoot.h>
 #include <LibWeb/DOM/Text.h>
+#include <LibWeb/DOMURL/DOMURL.h>
 #include <LibWeb/HTML/EventNames.h>
 #include <LibWeb/HTML/HTMLScriptElement.h>
 #include <LibWeb/HTML/Scripting/ClassicScript.h>
 #include <LibWeb/HTML/Scripting/Fetching.h>
 #include <LibWeb/HTML/Scripting/ImportMapParseResult.h>
+#include <LibWeb/HTML/Scripting/SpeculationRules.h>
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/Infra/CharacterTypes.h>
 #include <LibWeb/Infra/Strings.h>
+#include <LibWeb/Loader/LoadRequest.h>
+#include <LibWeb/Loader/ResourceLoader.h>
 #include <LibWeb/MimeSniff/MimeType.h>
 
 namespace Web::HTML {
@@ -146,6 +150,32 @@ void HTMLScriptElement::execute_script()
         dispatch_event(DOM::Event::create(realm(), HTML::EventNames::load));
 }
 
+// https://wicg.github.io/nav-speculation/speculation-rules.html#consider-speculative-loads
+// NOTE: Only same-origin URLs are loaded. Prerender rules are treated like prefetch rules, so the page itself is fetched
+//       ahead of time but not rendered.
+static void register_speculation_rules(DOM::Document& document, String const& source_text, URL::URL const& base_url)
+{
+    auto rule_set = parse_speculation_rule_set_string(source_text.bytes_as_string_view(), base_url);
+    if (!rule_set.has_value()) {
+        dbgln("HTMLScriptElement: Ignoring speculation rules that are not a JSON object.");
+        return;
+    }
+
+    auto prefetch = [&](SpeculationRule const& rule) {
+        for (auto const& url : rule.urls) {
+            if (!DOMURL::url_origin(url).is_same_origin(document.origin()))
+                continue;
+            auto request = LoadRequest::create_for_url_on_page(url, &document.page());
+            request.set_initiator_origin(document.origin());
+            ResourceLoader::the().prefetch(request);
+        }
+    };
+    for (auto const& rule : rule_set->prefetch_rules)
+        prefetch(rule);
+    for (auto const& rule : rule_set->prerender_rules)
+        prefetch(rule);
+}
+
 // https://html.spec.whatwg.org/multipage/scripting.html#prepare-a-script
 void HTMLScriptElement::prepare_script()
 {
@@ -219,6 +249,12 @@ void HTMLScriptElement::prepare_script()
         // then set el's type to "importmap".
         m_script_type = ScriptType::ImportMap;
     }
+    // https://wicg.github.io/nav-speculation/speculation-rules.html#script-type
+    // Otherwise, if the script block's type string is an ASCII case-insensitive match for the string "speculationrules",
+    else if (Infra::is_ascii_case_insensitive_match(script_block_type, "speculationrules"sv)) {
+        // then set el's type to "speculationrules".
+        m_script_type = ScriptType::SpeculationRules;
+    }
     // 12. Otherwise, return. (No script is executed, and el's type is left as null.)
     else {
         VERIFY(m_script_type == ScriptType::Null);
@@ -344,8 +380,8 @@ void HTMLScriptElement::prepare_script()
 
     // 31. If el has a src content attribute, then:
     if (has_attribute(HTML::AttributeNames::src)) {
-        // 1. If el's type is "importmap",
-        if (m_script_type == ScriptType::ImportMap) {
+        // 1. If el's type is "importmap" or "speculationrules",
+        if (m_script_type == ScriptType::ImportMap || m_script_type == ScriptType::SpeculationRules) {
             // then queue an element task on the DOM manipulation task source given el to fire an event named error at el, and return.
             queue_an_element_task(HTML::Task::Source::DOMManipulation, [this] {
                 dispatch_event(DOM::Event::create(realm(), HTML::EventNames::error));
@@ -464,6 +500,13 @@ void HTMLScriptElement::prepare_script()
             // 4. Mark as ready el given result.
             mark_as_ready(Result(move(result)));
         }
+        // -> "speculationrules"
+        else if (m_script_type == ScriptType::SpeculationRules) {
+            // NOTE: Speculation rules have no result to execute, so they are registered right away rather than when
+            //       el is marked as ready.
+            register_speculation_rules(document(), source_text, base_url);
+            return;
+        }
     }
 
     // 33. If el's type is "classic" and el has a src attribute, or el's type is "module":
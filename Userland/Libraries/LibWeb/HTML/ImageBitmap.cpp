@@ -4,9 +4,13 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibCore/AnonymousBuffer.h>
 #include <LibGfx/Bitmap.h>
+#include <LibIPC/File.h>
 #include <LibWeb/Bindings/ImageBitmapPrototype.h>
 #include <LibWeb/HTML/ImageBitmap.h>
+#include <LibWeb/HTML/StructuredSerialize.h>
+#include <LibWeb/WebIDL/DOMException.h>
 
 namespace Web::HTML {
 
@@ -47,25 +51,67 @@ WebIDL::ExceptionOr<void> ImageBitmap::deserialization_steps(ReadonlySpan<u32> c
     return {};
 }
 
-WebIDL::ExceptionOr<void> ImageBitmap::transfer_steps(HTML::TransferDataHolder&)
+// https://html.spec.whatwg.org/multipage/imagebitmap-and-animations.html#the-imagebitmap-interface:transfer-steps
+WebIDL::ExceptionOr<void> ImageBitmap::transfer_steps(HTML::TransferDataHolder& data_holder)
 {
-    // FIXME: Implement this
-    dbgln("(STUBBED) ImageBitmap::transfer_steps(HTML::TransferDataHolder&)");
+    // FIXME: 1. If value's origin-clean flag is not set, then throw a "DataCloneError" DOMException.
+
+    // 2. Set dataHolder.[[BitmapData]] to value's bitmap.
+    // NOTE: The bitmap is handed over in shared memory, so it only needs copying if it isn't in shared memory already.
+    HTML::append_to_transfer_data_holder(data_holder, m_bitmap != nullptr);
+    if (m_bitmap) {
+        auto bitmap = NonnullRefPtr { *m_bitmap };
+        if (!bitmap->anonymous_buffer().is_valid()) {
+            auto shareable_bitmap = bitmap->to_bitmap_backed_by_anonymous_buffer();
+            if (shareable_bitmap.is_error())
+                return WebIDL::DataCloneError::create(realm(), MUST(String::formatted("Cannot transfer ImageBitmap: {}", shareable_bitmap.error())));
+            bitmap = shareable_bitmap.release_value();
+        }
+
+        auto file = IPC::File::clone_fd(bitmap->anonymous_buffer().fd());
+        if (file.is_error())
+            return WebIDL::DataCloneError::create(realm(), MUST(String::formatted("Cannot transfer ImageBitmap: {}", file.error())));
+
+        HTML::append_to_transfer_data_holder(data_holder, bitmap->format());
+        HTML::append_to_transfer_data_holder(data_holder, bitmap->width());
+        HTML::append_to_transfer_data_holder(data_holder, bitmap->height());
+        HTML::append_to_transfer_data_holder(data_holder, static_cast<u64>(bitmap->anonymous_buffer().size()));
+        data_holder.fds.append(file.release_value());
+    }
+
+    // 3. Unset value's bitmap.
+    m_bitmap = nullptr;
+
     return {};
 }
 
-WebIDL::ExceptionOr<void> ImageBitmap::transfer_receiving_steps(HTML::TransferDataHolder&)
+// https://html.spec.whatwg.org/multipage/imagebitmap-and-animations.html#the-imagebitmap-interface:transfer-receiving-steps
+WebIDL::ExceptionOr<void> ImageBitmap::transfer_receiving_steps(HTML::TransferDataHolder& data_holder)
 {
-    // FIXME: Implement this
-    dbgln("(STUBBED) ImageBitmap::transfer_receiving_steps(HTML::TransferDataHolder&)");
+    // 1. Set value's bitmap to dataHolder.[[BitmapData]].
+    if (!HTML::take_from_transfer_data_holder<bool>(data_holder))
+        return {};
+
+    auto format = HTML::take_from_transfer_data_holder<Gfx::BitmapFormat>(data_holder);
+    auto width = HTML::take_from_transfer_data_holder<int>(data_holder);
+    auto height = HTML::take_from_transfer_data_holder<int>(data_holder);
+    auto size_in_bytes = HTML::take_from_transfer_data_holder<u64>(data_holder);
+
+    auto buffer = Core::AnonymousBuffer::create_from_anon_fd(data_holder.fds.take_first().take_fd(), size_in_bytes);
+    if (buffer.is_error())
+        return WebIDL::DataCloneError::create(realm(), MUST(String::formatted("Cannot receive ImageBitmap: {}", buffer.error())));
+
+    auto bitmap = Gfx::Bitmap::create_with_anonymous_buffer(format, buffer.release_value(), { width, height });
+    if (bitmap.is_error())
+        return WebIDL::DataCloneError::create(realm(), MUST(String::formatted("Cannot receive ImageBitmap: {}", bitmap.error())));
+    set_bitmap(bitmap.release_value());
+
     return {};
 }
 
 HTML::TransferType ImageBitmap::primary_interface() const
 {
-    // FIXME: Implement this
-    dbgln("(STUBBED) ImageBitmap::primary_interface()");
-    return {};
+    return HTML::TransferType::ImageBitmap;
 }
 
 // https://html.spec.whatwg.org/multipage/imagebitmap-and-animations.html#dom-imagebitmap-width
@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/SIMD.h>
 #include <LibGfx/Bitmap.h>
 #include <LibJS/Runtime/TypedArray.h>
 #include <LibWeb/Bindings/ImageDataPrototype.h>
@@ -16,6 +17,8 @@
 
 namespace Web::HTML {
 
+using AK::SIMD::u32x4;
+
 JS_DEFINE_ALLOCATOR(ImageData);
 
 // https://html.spec.whatwg.org/multipage/canvas.html#dom-imagedata
@@ -125,4 +128,24 @@ const JS::Uint8ClampedArray* ImageData::data() const
     return m_data;
 }
 
+void swap_red_and_blue_channels(ReadonlySpan<u32> source, Span<u32> destination)
+{
+    VERIFY(source.size() == destination.size());
+
+    auto swap = [](auto pixel) { return (pixel & 0xff00ff00) | ((pixel & 0xff) << 16) | ((pixel >> 16) & 0xff); };
+
+    size_t i = 0;
+
+    // OPTIMIZATION: Convert four pixels at a time.
+    for (; i + 4 <= source.size(); i += 4) {
+        u32x4 pixels;
+        __builtin_memcpy(&pixels, source.data() + i, sizeof(pixels));
+        pixels = swap(pixels);
+        __builtin_memcpy(destination.data() + i, &pixels, sizeof(pixels));
+    }
+
+    for (; i < source.size(); ++i)
+        destination[i] = swap(source[i]);
+}
+
 }
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <AK/Span.h>
 #include <LibGfx/Forward.h>
 #include <LibWeb/Bindings/ImageDataPrototype.h>
 #include <LibWeb/Bindings/PlatformObject.h>
@@ -49,4 +50,8 @@ private:
     JS::NonnullGCPtr<JS::Uint8ClampedArray> m_data;
 };
 
+// Converts a row of pixels between the BGRA8888 format of canvas bitmaps and the RGBA8888 format of ImageData.
+// The two only differ in the order of the red and blue channels, so the same conversion goes both ways.
+void swap_red_and_blue_channels(ReadonlySpan<u32> source, Span<u32> destination);
+
 }
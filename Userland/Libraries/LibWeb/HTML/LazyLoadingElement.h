@@ -59,6 +59,25 @@ public:
         return lazy_loading_attribute() == LazyLoading::Lazy;
     }
 
+    // https://html.spec.whatwg.org/multipage/urls-and-fetching.html#lazy-loading-attributes
+    void lazy_loading_attribute_changed()
+    {
+        // When the loading attribute's state is changed to the Eager state, the user agent must run these steps:
+        if (lazy_loading_attribute() != LazyLoading::Eager)
+            return;
+
+        // 1. Let resumptionSteps be the element's lazy load resumption steps.
+        // 3. Set the element's lazy load resumption steps to null.
+        auto resumption_steps = take_lazy_load_resumption_steps_internal();
+
+        // 2. If resumptionSteps is null, then return.
+        if (!resumption_steps)
+            return;
+
+        // 4. Invoke resumptionSteps.
+        resumption_steps->function()();
+    }
+
     void set_lazy_load_resumption_steps(Function<void()> steps)
     {
         auto& element = static_cast<T&>(*this);
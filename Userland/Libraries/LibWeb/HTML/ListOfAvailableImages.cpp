@@ -49,6 +49,11 @@ void ListOfAvailableImages::remove(Key const& key)
     m_images.remove(key);
 }
 
+void ListOfAvailableImages::clear()
+{
+    m_images.clear();
+}
+
 ListOfAvailableImages::Entry* ListOfAvailableImages::get(Key const& key)
 {
     auto it = m_images.find(key);
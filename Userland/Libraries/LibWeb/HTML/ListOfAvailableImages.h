@@ -49,6 +49,7 @@ public:
 
     void add(Key const&, JS::NonnullGCPtr<DecodedImageData>, bool ignore_higher_layer_caching);
     void remove(Key const&);
+    void clear();
     [[nodiscard]] Entry* get(Key const&);
 
     void visit_edges(JS::Cell::Visitor& visitor) override;
@@ -2002,7 +2002,7 @@ void Navigable::set_viewport_size(CSSPixelSize size)
     if (auto document = active_document()) {
         // NOTE: Resizing the viewport changes the reference value for viewport-relative CSS lengths.
         document->invalidate_style();
-        document->set_needs_layout();
+        document->set_needs_layout_for_viewport_resize();
     }
     m_needs_repaint = true;
 
@@ -2038,6 +2038,11 @@ void Navigable::set_needs_display(CSSPixelRect const&)
 {
     // FIXME: Ignore updates outside the visible viewport rect.
     //        This requires accounting for fixed-position elements in the input rect, which we don't do yet.
+    // FIXME: Accumulate these rects as damage so that we only re-record and replay the dirty region of the frame
+    //        (and only upload that part of the backing store in the UI process). That isn't safe yet: the rects we
+    //        get here ignore transforms, scroll offsets of nested scroll containers, ink overflow (shadows, outlines)
+    //        and fixed positioning, and with double-buffered backing stores the back buffer is two frames old, so the
+    //        damage of the previous frame would have to be repainted as well.
 
     m_needs_repaint = true;
 
@@ -2066,7 +2071,10 @@ bool Navigable::has_a_rendering_opportunity() const
     // or whether the document's visibility state is "visible".
     // Rendering opportunities typically occur at regular intervals.
 
-    // FIXME: Return `false` here if we're an inactive browser tab.
+    // A hidden tab can't be presented to the user at all.
+    if (auto traversable = traversable_navigable(); traversable && traversable->system_visibility_state() == VisibilityState::Hidden)
+        return false;
+
     auto browsing_context = const_cast<Navigable*>(this)->active_browsing_context();
     if (!browsing_context)
         return false;
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Checked.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/HTML/ImageBitmap.h>
+#include <LibWeb/HTML/OffscreenCanvas.h>
+#include <LibWeb/HTML/OffscreenCanvasRenderingContext2D.h>
+
+namespace Web::HTML {
+
+JS_DEFINE_ALLOCATOR(OffscreenCanvas);
+
+// NOTE: This matches the limit we put on canvas elements.
+static constexpr auto max_offscreen_canvas_area = 16384 * 16384;
+
+// https://html.spec.whatwg.org/multipage/canvas.html#dom-offscreencanvas
+WebIDL::ExceptionOr<JS::NonnullGCPtr<OffscreenCanvas>> OffscreenCanvas::construct_impl(JS::Realm& realm, WebIDL::UnsignedLongLong width, WebIDL::UnsignedLongLong height)
+{
+    // The new OffscreenCanvas(width, height) constructor steps are:
+    // 1. Initialize the bitmap of this to a rectangular array of transparent black pixels of the dimensions specified by width and height.
+    // 2. Initialize the width of this to width.
+    // 3. Initialize the height of this to height.
+    // NOTE: The bitmap is allocated lazily, see create_bitmap().
+    return realm.heap().allocate<OffscreenCanvas>(realm, realm, width, height);
+}
+
+OffscreenCanvas::OffscreenCanvas(JS::Realm& realm, WebIDL::UnsignedLongLong width, WebIDL::UnsignedLongLong height)
+    : DOM::EventTarget(realm)
+    , m_width(width)
+    , m_height(height)
+{
+}
+
+OffscreenCanvas::~OffscreenCanvas() = default;
+
+void OffscreenCanvas::initialize(JS::Realm& realm)
+{
+    Base::initialize(realm);
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(OffscreenCanvas);
+}
+
+void OffscreenCanvas::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_context);
+}
+
+// https://html.spec.whatwg.org/multipage/canvas.html#dom-offscreencanvas-width
+void OffscreenCanvas::set_width(WebIDL::UnsignedLongLong width)
+{
+    m_width = width;
+    bitmap_dimensions_changed();
+}
+
+// https://html.spec.whatwg.org/multipage/canvas.html#dom-offscreencanvas-height
+void OffscreenCanvas::set_height(WebIDL::UnsignedLongLong height)
+{
+    m_height = height;
+    bitmap_dimensions_changed();
+}
+
+void OffscreenCanvas::bitmap_dimensions_changed()
+{
+    // When either of these attributes are set, they must be set to the new value, and, if the OffscreenCanvas object's
+    // context mode is 2d, then reset the rendering context to its default state and resize the OffscreenCanvas object's
+    // bitmap to the new values of the width and height attributes.
+    m_bitmap = nullptr;
+    if (m_context)
+        m_context->reset_to_default_state();
+}
+
+bool OffscreenCanvas::create_bitmap()
+{
+    Checked<size_t> area = m_width;
+    area *= m_height;
+
+    if (m_width == 0 || m_height == 0 || area.has_overflow() || area.value() > max_offscreen_canvas_area) {
+        m_bitmap = nullptr;
+        return false;
+    }
+
+    Gfx::IntSize size(static_cast<int>(m_width), static_cast<int>(m_height));
+    if (!m_bitmap || m_bitmap->size() != size) {
+        auto bitmap_or_error = Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, size);
+        if (bitmap_or_error.is_error())
+            return false;
+        m_bitmap = bitmap_or_error.release_value();
+    }
+    return true;
+}
+
+// https://html.spec.whatwg.org/multipage/canvas.html#dom-offscreencanvas-getcontext
+WebIDL::ExceptionOr<JS::GCPtr<OffscreenCanvasRenderingContext2D>> OffscreenCanvas::get_context(String const& context_id, JS::Value options)
+{
+    // NOTE: This is what converting contextId to an OffscreenRenderingContextId would do.
+    if (!context_id.is_one_of("2d"sv, "bitmaprenderer"sv, "webgl"sv, "webgl2"sv, "webgpu"sv))
+        return vm().throw_completion<JS::TypeError>(JS::ErrorType::InvalidEnumerationValue, context_id, "OffscreenRenderingContextId");
+
+    // 1. If options is not an object, then set options to null.
+    // 2. Set options to the result of converting options to a JavaScript value.
+    // NOTE: No-op, the 2d context doesn't take any settings we support yet.
+    (void)options;
+
+    // FIXME: 3. If this's [[Detached]] internal slot is set to true, then throw an "InvalidStateError" DOMException.
+
+    // 4. Run the steps in the cell of the following table whose column header matches this OffscreenCanvas object's
+    //    context mode and whose row header matches contextId:
+    // NOTE: See the spec for the full table.
+    if (context_id == "2d"sv) {
+        // none: Let context be the result of running the offscreen 2D context creation algorithm given this and options.
+        //       Set this's context mode to 2d. Return context.
+        // 2d: Return the same object as was returned the last time the method was invoked with this same first argument.
+        if (!m_context)
+            m_context = OffscreenCanvasRenderingContext2D::create(realm(), *this);
+        return m_context;
+    }
+
+    // 2d: Throw an "InvalidStateError" DOMException.
+    if (m_context)
+        return WebIDL::InvalidStateError::create(realm(), "OffscreenCanvas already has a 2d context"_fly_string);
+
+    // FIXME: Support the "bitmaprenderer", "webgl", "webgl2" and "webgpu" contexts.
+    return nullptr;
+}
+
+// https://html.spec.whatwg.org/multipage/canvas.html#dom-offscreencanvas-transfertoimagebitmap
+WebIDL::ExceptionOr<JS::NonnullGCPtr<ImageBitmap>> OffscreenCanvas::transfer_to_image_bitmap()
+{
+    // FIXME: 1. If the value of this OffscreenCanvas object's [[Detached]] internal slot is set to true, then throw an "InvalidStateError" DOMException.
+
+    // 2. If this OffscreenCanvas object's context mode is set to none, then throw an "InvalidStateError" DOMException.
+    if (!m_context)
+        return WebIDL::InvalidStateError::create(realm(), "OffscreenCanvas has no rendering context"_fly_string);
+
+    // 3. Let image be a newly created ImageBitmap object that references the same underlying bitmap data as this
+    //    OffscreenCanvas object's bitmap.
+    // NOTE: Our bitmap is only allocated once something is drawn, so make sure the image gets a transparent black bitmap
+    //       of our size even if nothing has been drawn yet. A canvas without any pixels gives an empty image.
+    auto image = ImageBitmap::create(realm());
+    if (create_bitmap())
+        image->set_bitmap(m_bitmap.release_nonnull());
+
+    // 4. Set this OffscreenCanvas object's bitmap to reference a newly created bitmap of the same dimensions and color
+    //    space as the previous bitmap, and with its pixels initialized to transparent black, or opaque black if the
+    //    rendering context's alpha is false.
+    // NOTE: We released our bitmap above, so the next drawing operation creates a fresh transparent one.
+
+    // 5. Return image.
+    return image;
+}
+
+}
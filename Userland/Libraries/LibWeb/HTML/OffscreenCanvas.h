@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibGfx/Bitmap.h>
+#include <LibWeb/DOM/EventTarget.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/WebIDL/ExceptionOr.h>
+#include <LibWeb/WebIDL/Types.h>
+
+namespace Web::HTML {
+
+// https://html.spec.whatwg.org/multipage/canvas.html#the-offscreencanvas-interface
+class OffscreenCanvas final : public DOM::EventTarget {
+    WEB_PLATFORM_OBJECT(OffscreenCanvas, DOM::EventTarget);
+    JS_DECLARE_ALLOCATOR(OffscreenCanvas);
+
+public:
+    static WebIDL::ExceptionOr<JS::NonnullGCPtr<OffscreenCanvas>> construct_impl(JS::Realm&, WebIDL::UnsignedLongLong width, WebIDL::UnsignedLongLong height);
+    virtual ~OffscreenCanvas() override;
+
+    WebIDL::UnsignedLongLong width() const { return m_width; }
+    WebIDL::UnsignedLongLong height() const { return m_height; }
+    void set_width(WebIDL::UnsignedLongLong);
+    void set_height(WebIDL::UnsignedLongLong);
+
+    WebIDL::ExceptionOr<JS::GCPtr<OffscreenCanvasRenderingContext2D>> get_context(String const& context_id, JS::Value options);
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<ImageBitmap>> transfer_to_image_bitmap();
+
+    Gfx::Bitmap* bitmap() const { return m_bitmap; }
+    bool create_bitmap();
+
+private:
+    OffscreenCanvas(JS::Realm&, WebIDL::UnsignedLongLong width, WebIDL::UnsignedLongLong height);
+
+    virtual void initialize(JS::Realm&) override;
+    virtual void visit_edges(Cell::Visitor&) override;
+
+    void bitmap_dimensions_changed();
+
+    WebIDL::UnsignedLongLong m_width { 0 };
+    WebIDL::UnsignedLongLong m_height { 0 };
+
+    // NOTE: Like a canvas element, we only allocate the bitmap once something draws into it.
+    RefPtr<Gfx::Bitmap> m_bitmap;
+
+    // https://html.spec.whatwg.org/multipage/canvas.html#offscreencanvas-context-mode
+    // FIXME: Support the "bitmaprenderer", "webgl", "webgl2", "webgpu" and "detached" context modes.
+    JS::GCPtr<OffscreenCanvasRenderingContext2D> m_context;
+};
+
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/Bindings/OffscreenCanvasRenderingContext2DPrototype.h>
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/HTML/OffscreenCanvas.h>
+#include <LibWeb/HTML/OffscreenCanvasRenderingContext2D.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/Window.h>
+
+namespace Web::HTML {
+
+JS_DEFINE_ALLOCATOR(OffscreenCanvasRenderingContext2D);
+
+JS::NonnullGCPtr<OffscreenCanvasRenderingContext2D> OffscreenCanvasRenderingContext2D::create(JS::Realm& realm, OffscreenCanvas& canvas)
+{
+    return realm.heap().allocate<OffscreenCanvasRenderingContext2D>(realm, realm, canvas);
+}
+
+OffscreenCanvasRenderingContext2D::OffscreenCanvasRenderingContext2D(JS::Realm& realm, OffscreenCanvas& canvas)
+    : CanvasRenderingContext2D(realm)
+    , m_canvas(canvas)
+{
+}
+
+OffscreenCanvasRenderingContext2D::~OffscreenCanvasRenderingContext2D() = default;
+
+void OffscreenCanvasRenderingContext2D::initialize(JS::Realm& realm)
+{
+    Base::initialize(realm);
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(OffscreenCanvasRenderingContext2D);
+}
+
+void OffscreenCanvasRenderingContext2D::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_canvas);
+}
+
+// https://html.spec.whatwg.org/multipage/canvas.html#dom-offscreencontext2d-canvas
+JS::NonnullGCPtr<OffscreenCanvas> OffscreenCanvasRenderingContext2D::offscreen_canvas_for_binding() const
+{
+    // The canvas attribute, on getting, must return this OffscreenCanvasRenderingContext2D's associated OffscreenCanvas object.
+    return m_canvas;
+}
+
+JS::GCPtr<DOM::Node> OffscreenCanvasRenderingContext2D::font_style_source_object()
+{
+    // For OffscreenCanvasRenderingContext2D objects, the font style source object is the OffscreenCanvas object's
+    // relevant global object's associated Document when that is a Window; workers don't have a Document.
+    // FIXME: Use the placeholder canvas element when the OffscreenCanvas was created by transferControlToOffscreen().
+    auto& global_object = relevant_global_object(*m_canvas);
+    if (is<Window>(global_object))
+        return verify_cast<Window>(global_object).associated_document();
+    return nullptr;
+}
+
+Gfx::Bitmap* OffscreenCanvasRenderingContext2D::output_bitmap()
+{
+    return m_canvas->bitmap();
+}
+
+Gfx::Bitmap const* OffscreenCanvasRenderingContext2D::output_bitmap() const
+{
+    return m_canvas->bitmap();
+}
+
+bool OffscreenCanvasRenderingContext2D::has_output_bitmap() const
+{
+    return m_canvas->bitmap();
+}
+
+bool OffscreenCanvasRenderingContext2D::create_output_bitmap()
+{
+    return m_canvas->create_bitmap();
+}
+
+}
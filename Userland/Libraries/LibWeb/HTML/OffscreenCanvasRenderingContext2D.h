@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibWeb/HTML/CanvasRenderingContext2D.h>
+
+namespace Web::HTML {
+
+// https://html.spec.whatwg.org/multipage/canvas.html#offscreencanvasrenderingcontext2d
+// This draws exactly like a CanvasRenderingContext2D, except into the bitmap of an OffscreenCanvas, which also works in workers.
+class OffscreenCanvasRenderingContext2D final : public CanvasRenderingContext2D {
+    WEB_PLATFORM_OBJECT(OffscreenCanvasRenderingContext2D, CanvasRenderingContext2D);
+    JS_DECLARE_ALLOCATOR(OffscreenCanvasRenderingContext2D);
+
+public:
+    [[nodiscard]] static JS::NonnullGCPtr<OffscreenCanvasRenderingContext2D> create(JS::Realm&, OffscreenCanvas&);
+    virtual ~OffscreenCanvasRenderingContext2D() override;
+
+    JS::NonnullGCPtr<OffscreenCanvas> offscreen_canvas_for_binding() const;
+
+    virtual JS::GCPtr<DOM::Node> font_style_source_object() override;
+
+private:
+    OffscreenCanvasRenderingContext2D(JS::Realm&, OffscreenCanvas&);
+
+    virtual void initialize(JS::Realm&) override;
+    virtual void visit_edges(Cell::Visitor&) override;
+
+    virtual Gfx::Bitmap* output_bitmap() override;
+    virtual Gfx::Bitmap const* output_bitmap() const override;
+    virtual bool has_output_bitmap() const override;
+    virtual bool create_output_bitmap() override;
+
+    // Nothing is displayed until the bitmap is transferred somewhere else, so there is nothing to invalidate.
+    virtual void did_draw(Gfx::FloatRect const&) override { }
+
+    // FIXME: Record the drawing here as well, once the worker can tell which display list player the page uses.
+    virtual bool can_record_drawing() const override { return false; }
+
+    JS::NonnullGCPtr<OffscreenCanvas> m_canvas;
+};
+
+}
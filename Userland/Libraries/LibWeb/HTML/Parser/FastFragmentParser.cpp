@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/CharacterTypes.h>
+#include <AK/GenericLexer.h>
+#include <AK/HashTable.h>
+#include <AK/StringBuilder.h>
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOM/Element.h>
+#include <LibWeb/DOM/ElementFactory.h>
+#include <LibWeb/DOM/Text.h>
+#include <LibWeb/HTML/AttributeNames.h>
+#include <LibWeb/HTML/Parser/FastFragmentParser.h>
+#include <LibWeb/HTML/TagNames.h>
+#include <LibWeb/Namespace.h>
+
+namespace Web::HTML {
+
+enum class ElementKind {
+    Unsupported,
+    // Phrasing elements never close an open p element, and only get special treatment from the tree builder when misnested.
+    Phrasing,
+    PhrasingVoid,
+    // Any of these closes an open p element, so we bail if one shows up while a p element is open.
+    Block,
+    BlockVoid,
+    Heading,
+    ListItem,
+};
+
+static ElementKind element_kind(FlyString const& local_name)
+{
+    if (local_name.is_one_of(
+            TagNames::a, TagNames::abbr, TagNames::b, TagNames::bdi, TagNames::bdo, TagNames::cite, TagNames::code,
+            TagNames::data, TagNames::dfn, TagNames::em, TagNames::i, TagNames::kbd, TagNames::mark, TagNames::q,
+            TagNames::s, TagNames::samp, TagNames::small, TagNames::span, TagNames::strong, TagNames::sub, TagNames::sup,
+            TagNames::time, TagNames::u, TagNames::var))
+        return ElementKind::Phrasing;
+    if (local_name.is_one_of(TagNames::br, TagNames::img, TagNames::wbr))
+        return ElementKind::PhrasingVoid;
+    if (local_name.is_one_of(
+            TagNames::address, TagNames::article, TagNames::aside, TagNames::blockquote, TagNames::div, TagNames::footer,
+            TagNames::header, TagNames::main, TagNames::nav, TagNames::ol, TagNames::p, TagNames::section, TagNames::ul))
+        return ElementKind::Block;
+    if (local_name == TagNames::hr)
+        return ElementKind::BlockVoid;
+    if (local_name.is_one_of(TagNames::h1, TagNames::h2, TagNames::h3, TagNames::h4, TagNames::h5, TagNames::h6))
+        return ElementKind::Heading;
+    if (local_name == TagNames::li)
+        return ElementKind::ListItem;
+    return ElementKind::Unsupported;
+}
+
+// Returns whether the context element puts the fragment parser into the "in body" insertion mode with the tokenizer in the data state.
+static bool context_element_is_supported(DOM::Element const& context_element)
+{
+    if (context_element.namespace_uri() != Namespace::HTML)
+        return false;
+    return !context_element.local_name().is_one_of(
+        TagNames::caption, TagNames::colgroup, TagNames::frameset, TagNames::head, TagNames::html, TagNames::iframe,
+        TagNames::noembed, TagNames::noframes, TagNames::noscript, TagNames::plaintext, TagNames::script, TagNames::select,
+        TagNames::style, TagNames::table, TagNames::tbody, TagNames::td, TagNames::template_, TagNames::textarea,
+        TagNames::tfoot, TagNames::th, TagNames::thead, TagNames::title, TagNames::tr, TagNames::xmp);
+}
+
+static bool is_html_whitespace(char ch)
+{
+    return ch == '\t' || ch == '\n' || ch == '\f' || ch == ' ';
+}
+
+class FastFragmentParser {
+public:
+    FastFragmentParser(DOM::Document& document, StringView markup)
+        : m_document(document)
+        , m_lexer(markup)
+    {
+    }
+
+    Optional<Vector<JS::Handle<DOM::Node>>> parse()
+    {
+        while (!m_lexer.is_eof()) {
+            if (!m_lexer.next_is('<')) {
+                if (!consume_text())
+                    return {};
+                continue;
+            }
+            if (!flush_text())
+                return {};
+            m_lexer.ignore();
+            if (m_lexer.next_is('/')) {
+                m_lexer.ignore();
+                if (!consume_end_tag())
+                    return {};
+                continue;
+            }
+            if (!consume_start_tag())
+                return {};
+        }
+        if (!flush_text())
+            return {};
+
+        // Leaving elements open would make the full parser generate implied end tags, so leave that to it.
+        if (!m_open_elements.is_empty())
+            return {};
+        return move(m_top_level_nodes);
+    }
+
+private:
+    bool consume_text()
+    {
+        while (!m_lexer.is_eof() && !m_lexer.next_is('<')) {
+            auto run = m_lexer.consume_until([](char ch) { return ch == '<' || ch == '&' || ch == '\0' || ch == '\r'; });
+            m_text.append(run);
+            if (m_lexer.next_is('&')) {
+                if (!consume_character_reference(m_text))
+                    return false;
+                continue;
+            }
+            // NULL characters and carriage returns are rewritten by the tokenizer and input stream preprocessing.
+            if (m_lexer.next_is('\0') || m_lexer.next_is('\r'))
+                return false;
+        }
+        return true;
+    }
+
+    // Only the handful of character references that are common in generated markup are handled here.
+    // Anything else, including references without a trailing semicolon, goes through the full tokenizer.
+    bool consume_character_reference(StringBuilder& builder)
+    {
+        VERIFY(m_lexer.next_is('&'));
+        m_lexer.ignore();
+        if (m_lexer.consume_specific("amp;"sv))
+            builder.append('&');
+        else if (m_lexer.consume_specific("lt;"sv))
+            builder.append('<');
+        else if (m_lexer.consume_specific("gt;"sv))
+            builder.append('>');
+        else if (m_lexer.consume_specific("quot;"sv))
+            builder.append('"');
+        else if (m_lexer.consume_specific("#39;"sv))
+            builder.append('\'');
+        else if (m_lexer.consume_specific("nbsp;"sv))
+            builder.append_code_point(0xA0);
+        else
+            return false;
+        return true;
+    }
+
+    bool flush_text()
+    {
+        if (m_text.is_empty())
+            return true;
+        auto data = String::from_utf8(m_text.string_view());
+        m_text.clear();
+        if (data.is_error())
+            return false;
+        auto text = m_document->realm().heap().allocate<DOM::Text>(m_document->realm(), *m_document, data.release_value());
+        append_node(text);
+        return true;
+    }
+
+    void append_node(DOM::Node& node)
+    {
+        if (m_open_elements.is_empty())
+            m_top_level_nodes.append(JS::make_handle(node));
+        else
+            MUST(m_open_elements.last()->append_child(node));
+    }
+
+    Optional<FlyString> consume_name()
+    {
+        if (!is_ascii_alpha(m_lexer.peek()))
+            return {};
+        auto name = m_lexer.consume_while([](char ch) { return is_ascii_alphanumeric(ch) || ch == '-' || ch == '_' || ch == ':' || ch == '.'; });
+        auto lowercase_name = name.to_lowercase_string();
+        return MUST(FlyString::from_utf8(lowercase_name.view()));
+    }
+
+    bool current_node_is_one_of_the_headings() const
+    {
+        if (m_open_elements.is_empty())
+            return false;
+        return element_kind(m_open_elements.last()->local_name()) == ElementKind::Heading;
+    }
+
+    bool has_open_element(FlyString const& local_name) const
+    {
+        for (auto const& element : m_open_elements) {
+            if (element->local_name() == local_name)
+                return true;
+        }
+        return false;
+    }
+
+    bool consume_start_tag()
+    {
+        auto local_name = consume_name();
+        if (!local_name.has_value())
+            return false;
+
+        auto kind = element_kind(*local_name);
+        switch (kind) {
+        case ElementKind::Unsupported:
+            return false;
+        case ElementKind::Phrasing:
+        case ElementKind::PhrasingVoid:
+            // A nested a element runs the adoption agency algorithm.
+            if (*local_name == TagNames::a && has_open_element(TagNames::a))
+                return false;
+            break;
+        case ElementKind::Block:
+        case ElementKind::BlockVoid:
+        case ElementKind::Heading:
+        case ElementKind::ListItem:
+            // None of the elements we accept have button scope boundaries, so any open p element would be closed here.
+            if (has_open_element(TagNames::p))
+                return false;
+            // A heading start tag pops a heading that is the current node.
+            if (kind == ElementKind::Heading && current_node_is_one_of_the_headings())
+                return false;
+            // A list item start tag closes list items up the stack; that can only be skipped when it sits directly in a list.
+            if (kind == ElementKind::ListItem && (m_open_elements.is_empty() || !m_open_elements.last()->local_name().is_one_of(TagNames::ul, TagNames::ol)))
+                return false;
+            break;
+        }
+
+        auto element = DOM::create_element(*m_document, *local_name, Namespace::HTML).release_value_but_fixme_should_propagate_errors();
+
+        HashTable<FlyString> seen_attribute_names;
+        bool self_closing = false;
+        for (;;) {
+            bool had_whitespace = !m_lexer.consume_while(is_html_whitespace).is_empty();
+            if (m_lexer.is_eof())
+                return false;
+            if (m_lexer.consume_specific('>'))
+                break;
+            if (m_lexer.consume_specific("/>"sv)) {
+                self_closing = true;
+                break;
+            }
+            if (!had_whitespace)
+                return false;
+
+            auto attribute_name = consume_name();
+            if (!attribute_name.has_value())
+                return false;
+            // Duplicate attributes are dropped by the tokenizer, and the "is" attribute selects a customized built-in element.
+            if (seen_attribute_names.set(*attribute_name) != HashSetResult::InsertedNewEntry || *attribute_name == AttributeNames::is)
+                return false;
+
+            StringBuilder value;
+            m_lexer.consume_while(is_html_whitespace);
+            if (m_lexer.consume_specific('=')) {
+                m_lexer.consume_while(is_html_whitespace);
+                if (!consume_attribute_value(value))
+                    return false;
+            }
+            auto attribute_value = String::from_utf8(value.string_view());
+            if (attribute_value.is_error())
+                return false;
+            element->append_attribute(*attribute_name, attribute_value.release_value());
+        }
+
+        bool is_void = kind == ElementKind::PhrasingVoid || kind == ElementKind::BlockVoid;
+        // The self-closing flag is ignored on non-void HTML elements, which would leave the element open.
+        if (self_closing && !is_void)
+            return false;
+
+        append_node(element);
+        if (!is_void)
+            m_open_elements.append(element);
+        return true;
+    }
+
+    bool consume_attribute_value(StringBuilder& builder)
+    {
+        if (m_lexer.next_is('"') || m_lexer.next_is('\'')) {
+            char quote = m_lexer.consume();
+            for (;;) {
+                builder.append(m_lexer.consume_until([quote](char ch) { return ch == quote || ch == '&' || ch == '\0' || ch == '\r'; }));
+                if (m_lexer.is_eof())
+                    return false;
+                if (m_lexer.consume_specific(quote))
+                    return true;
+                if (!m_lexer.next_is('&') || !consume_character_reference(builder))
+                    return false;
+            }
+        }
+
+        auto value = m_lexer.consume_while([](char ch) {
+            return !is_html_whitespace(ch) && ch != '>' && ch != '"' && ch != '\'' && ch != '<' && ch != '=' && ch != '`' && ch != '&' && ch != '/' && ch != '\0' && ch != '\r';
+        });
+        if (value.is_empty())
+            return false;
+        if (m_lexer.next_is('&') || m_lexer.next_is('"') || m_lexer.next_is('\'') || m_lexer.next_is('<') || m_lexer.next_is('=') || m_lexer.next_is('`') || m_lexer.next_is('/'))
+            return false;
+        builder.append(value);
+        return true;
+    }
+
+    bool consume_end_tag()
+    {
+        auto local_name = consume_name();
+        if (!local_name.has_value())
+            return false;
+        m_lexer.consume_while(is_html_whitespace);
+        if (!m_lexer.consume_specific('>'))
+            return false;
+
+        // Only end tags for the current node are accepted, so no end tags are ever implied.
+        if (m_open_elements.is_empty() || m_open_elements.last()->local_name() != *local_name)
+            return false;
+        m_open_elements.take_last();
+        return true;
+    }
+
+    JS::NonnullGCPtr<DOM::Document> m_document;
+    GenericLexer m_lexer;
+    StringBuilder m_text;
+
+    // Every open element is reachable from m_top_level_nodes through its ancestors.
+    Vector<JS::NonnullGCPtr<DOM::Element>> m_open_elements;
+    Vector<JS::Handle<DOM::Node>> m_top_level_nodes;
+};
+
+Optional<Vector<JS::Handle<DOM::Node>>> try_parse_simple_html_fragment(DOM::Element& context_element, StringView markup)
+{
+    if (!context_element_is_supported(context_element))
+        return {};
+
+    FastFragmentParser parser { context_element.document(), markup };
+    return parser.parse();
+}
+
+}
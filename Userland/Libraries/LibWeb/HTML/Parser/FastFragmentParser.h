@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Optional.h>
+#include <AK/StringView.h>
+#include <AK/Vector.h>
+#include <LibJS/Heap/Handle.h>
+#include <LibWeb/Forward.h>
+
+namespace Web::HTML {
+
+// Builds the result of the HTML fragment parsing algorithm directly for simple, well-formed markup made of a small set of
+// elements whose tree construction rules are trivial when properly nested. Returns an empty Optional as soon as the markup
+// needs anything the full parser would handle specially, in which case the caller must run the full algorithm instead.
+Optional<Vector<JS::Handle<DOM::Node>>> try_parse_simple_html_fragment(DOM::Element& context_element, StringView markup);
+
+}
@@ -7,6 +7,7 @@
  */
 
 #include <AK/Debug.h>
+#include <AK/HashTable.h>
 #include <AK/SourceLocation.h>
 #include <AK/Utf32View.h>
 #include <LibTextCodec/Decoder.h>
@@ -32,6 +33,7 @@
 #include <LibWeb/HTML/HTMLScriptElement.h>
 #include <LibWeb/HTML/HTMLTableElement.h>
 #include <LibWeb/HTML/HTMLTemplateElement.h>
+#include <LibWeb/HTML/Parser/FastFragmentParser.h>
 #include <LibWeb/HTML/Parser/HTMLEncodingDetection.h>
 #include <LibWeb/HTML/Parser/HTMLParser.h>
 #include <LibWeb/HTML/Parser/HTMLToken.h>
@@ -40,6 +42,7 @@
 #include <LibWeb/HighResolutionTime/TimeOrigin.h>
 #include <LibWeb/Infra/CharacterTypes.h>
 #include <LibWeb/Infra/Strings.h>
+#include <LibWeb/Loader/ResourceLoader.h>
 #include <LibWeb/MathML/TagNames.h>
 #include <LibWeb/Namespace.h>
 #include <LibWeb/SVG/SVGScriptElement.h>
@@ -174,10 +177,21 @@ void HTMLParser::visit_edges(Cell::Visitor& visitor)
 
 void HTMLParser::run(HTMLTokenizer::StopAtInsertionPoint stop_at_insertion_point)
 {
-    for (;;) {
+    (void)run_until(stop_at_insertion_point, {});
+}
+
+// How long an incrementally running parser may process tokens before yielding to the event loop.
+static constexpr auto incremental_parsing_time_budget = AK::Duration::from_milliseconds(10);
+
+// Looking at the clock after every token would be needlessly expensive, so it is only done every this many tokens.
+static constexpr size_t tokens_between_deadline_checks = 256;
+
+HTMLParser::RunResult HTMLParser::run_until(HTMLTokenizer::StopAtInsertionPoint stop_at_insertion_point, Optional<MonotonicTime> deadline)
+{
+    for (size_t token_count = 1;; ++token_count) {
         // FIXME: Find a better way to say that we come from Document::close() and want to process EOF.
         if (!m_tokenizer.is_eof_inserted() && m_tokenizer.is_insertion_point_reached())
-            return;
+            return RunResult::Finished;
 
         auto optional_token = m_tokenizer.next_token(stop_at_insertion_point);
         if (!optional_token.has_value())
@@ -214,9 +228,15 @@ void HTMLParser::run(HTMLTokenizer::StopAtInsertionPoint stop_at_insertion_point
             dbgln_if(HTML_PARSER_DEBUG, "Stop parsing{}! :^)", m_parsing_fragment ? " fragment" : "");
             break;
         }
+
+        if (deadline.has_value() && token_count % tokens_between_deadline_checks == 0 && MonotonicTime::now() >= *deadline) {
+            flush_character_insertions();
+            return RunResult::Yielded;
+        }
     }
 
     flush_character_insertions();
+    return RunResult::Finished;
 }
 
 void HTMLParser::run(const URL::URL& url, HTMLTokenizer::StopAtInsertionPoint stop_at_insertion_point)
@@ -228,6 +248,31 @@ void HTMLParser::run(const URL::URL& url, HTMLTokenizer::StopAtInsertionPoint st
     m_document->detach_parser({});
 }
 
+void HTMLParser::run_incrementally(URL::URL const& url)
+{
+    m_document->set_url(url);
+    m_document->set_source(MUST(String::from_byte_string(m_tokenizer.source())));
+    continue_running_incrementally();
+}
+
+void HTMLParser::continue_running_incrementally()
+{
+    // If a script aborted us while we were yielding (e.g. by calling document.open()), there is nothing left to do.
+    if (m_aborted)
+        return;
+
+    if (run_until(HTMLTokenizer::StopAtInsertionPoint::No, MonotonicTime::now() + incremental_parsing_time_budget) == RunResult::Yielded) {
+        // NOTE: Like the tasks that would feed a streaming parser more input, this is queued on the networking task source.
+        queue_global_task(HTML::Task::Source::Networking, *m_document, JS::create_heap_function(heap(), [this] {
+            continue_running_incrementally();
+        }));
+        return;
+    }
+
+    the_end(*m_document, this);
+    m_document->detach_parser({});
+}
+
 // https://html.spec.whatwg.org/multipage/parsing.html#the-end
 void HTMLParser::the_end(JS::NonnullGCPtr<DOM::Document> document, JS::GCPtr<HTMLParser> parser)
 {
@@ -1147,25 +1192,75 @@ void HTMLParser::flush_character_insertions()
 {
     if (m_character_insertion_builder.is_empty())
         return;
-    m_character_insertion_node->set_data(MUST(m_character_insertion_builder.to_string()));
-    m_character_insertion_builder.clear();
+    m_character_insertion_node->set_data(MUST(move(m_character_insertion_builder).to_string()));
 }
 
 void HTMLParser::insert_character(u32 data)
 {
+    // NOTE: Consecutive characters going into the same text node are collected in m_character_insertion_builder,
+    //       and the node's data is only set once the run ends (see flush_character_insertions()).
     auto node = find_character_insertion_node();
-    if (node == m_character_insertion_node.ptr()) {
-        m_character_insertion_builder.append(Utf32View { &data, 1 });
-        return;
+    if (node != m_character_insertion_node.ptr()) {
+        flush_character_insertions();
+        m_character_insertion_node = node;
     }
-    if (!m_character_insertion_node.ptr()) {
-        m_character_insertion_node = JS::make_handle(node);
-        m_character_insertion_builder.append(Utf32View { &data, 1 });
+    m_character_insertion_builder.append_code_point(data);
+}
+
+// https://html.spec.whatwg.org/multipage/parsing.html#start-the-speculative-html-parser
+void HTMLParser::start_the_speculative_html_parser()
+{
+    // NOTE: This is a much reduced take on the speculative HTML parser. Rather than building a speculative mock tree
+    //       and fetching resources from it, we scan the not-yet-parsed input for the URLs of subresources that the
+    //       document is about to need, and warm up connections to their origins while the parser is blocked.
+    //       That never touches the DOM, and can't cause anything to be fetched twice.
+    auto input = m_tokenizer.source();
+    auto offset = m_tokenizer.next_input_character_byte_offset();
+
+    // The input up to the furthest point we've looked at before has already been scanned.
+    if (m_speculatively_parsed_input_end.has_value() && offset < *m_speculatively_parsed_input_end)
         return;
+    m_speculatively_parsed_input_end = input.length();
+
+    HTMLTokenizer tokenizer { input.substring_view(offset), "UTF-8"sv };
+    HashTable<ByteString> seen_origins;
+
+    auto preconnect_to = [&](Optional<String> const& value) {
+        if (!value.has_value() || value->is_empty())
+            return;
+        auto url = document().parse_url(*value);
+        if (!url.is_valid() || !url.scheme().is_one_of("http"sv, "https"sv))
+            return;
+        if (seen_origins.set(url.serialize_origin()) != AK::HashSetResult::InsertedNewEntry)
+            return;
+        ResourceLoader::the().preconnect(url);
+    };
+
+    for (;;) {
+        auto token = tokenizer.next_token();
+        if (!token.has_value() || token->is_end_of_file())
+            break;
+        if (!token->is_start_tag())
+            continue;
+
+        auto const& tag_name = token->tag_name();
+        if (tag_name == HTML::TagNames::script) {
+            preconnect_to(token->attribute(HTML::AttributeNames::src));
+            tokenizer.switch_to(HTMLTokenizer::State::ScriptData);
+        } else if (tag_name == HTML::TagNames::link) {
+            auto rel = token->attribute(HTML::AttributeNames::rel);
+            if (rel.has_value() && (rel->contains("stylesheet"sv, CaseSensitivity::CaseInsensitive) || rel->contains("preload"sv, CaseSensitivity::CaseInsensitive)))
+                preconnect_to(token->attribute(HTML::AttributeNames::href));
+        } else if (tag_name == HTML::TagNames::img) {
+            preconnect_to(token->attribute(HTML::AttributeNames::src));
+        } else if (tag_name.is_one_of(HTML::TagNames::style, HTML::TagNames::xmp, HTML::TagNames::iframe, HTML::TagNames::noembed, HTML::TagNames::noframes, HTML::TagNames::noscript)) {
+            tokenizer.switch_to(HTMLTokenizer::State::RAWTEXT);
+        } else if (tag_name.is_one_of(HTML::TagNames::textarea, HTML::TagNames::title)) {
+            tokenizer.switch_to(HTMLTokenizer::State::RCDATA);
+        } else if (tag_name == HTML::TagNames::plaintext) {
+            break;
+        }
     }
-    flush_character_insertions();
-    m_character_insertion_node = JS::make_handle(node);
-    m_character_insertion_builder.append(Utf32View { &data, 1 });
 }
 
 void HTMLParser::handle_after_head(HTMLToken& token)
@@ -2929,7 +3024,8 @@ void HTMLParser::handle_text(HTMLToken& token)
                     // 2. Set the pending parsing-blocking script to null.
                     auto the_script = document().take_pending_parsing_blocking_script({});
 
-                    // FIXME: 3. Start the speculative HTML parser for this instance of the HTML parser.
+                    // 3. Start the speculative HTML parser for this instance of the HTML parser.
+                    start_the_speculative_html_parser();
 
                     // 4. Block the tokenizer for this instance of the HTML parser, such that the event loop will not run tasks that invoke the tokenizer.
                     m_tokenizer.set_blocked(true);
@@ -2948,7 +3044,8 @@ void HTMLParser::handle_text(HTMLToken& token)
                     if (m_aborted)
                         return;
 
-                    // FIXME: 7. Stop the speculative HTML parser for this instance of the HTML parser.
+                    // 7. Stop the speculative HTML parser for this instance of the HTML parser.
+                    // NOTE: Our speculative HTML parser runs to completion when started, so there's nothing to stop.
 
                     // 8. Unblock the tokenizer for this instance of the HTML parser, such that tasks that invoke the tokenizer can again be run.
                     m_tokenizer.set_blocked(false);
@@ -4268,6 +4365,11 @@ DOM::Document& HTMLParser::document()
 // https://html.spec.whatwg.org/multipage/parsing.html#parsing-html-fragments
 Vector<JS::Handle<DOM::Node>> HTMLParser::parse_html_fragment(DOM::Element& context_element, StringView markup, AllowDeclarativeShadowRoots allow_declarative_shadow_roots)
 {
+    // NOTE: Simple markup produces the same nodes without a temporary document and the full tree construction stage.
+    //       The nodes are created in the context element's node document directly, so they don't need adopting afterwards.
+    if (auto children = try_parse_simple_html_fragment(context_element, markup); children.has_value())
+        return children.release_value();
+
     // 1. Create a new Document node, and mark it as being an HTML document.
     auto temp_document = DOM::Document::create(context_element.realm());
     temp_document->set_document_type(DOM::Document::Type::HTML);
@@ -4411,7 +4513,7 @@ static String escape_string(StringView string, AttributeMode attribute_mode)
         else
             builder.append_code_point(code_point);
     }
-    return builder.to_string_without_validation();
+    return move(builder).to_string_without_validation();
 }
 
 // https://html.spec.whatwg.org/multipage/parsing.html#html-fragment-serialisation-algorithm
@@ -4504,7 +4606,7 @@ String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableSh
 
     if (fragment_serialization_mode == DOM::FragmentSerializationMode::Outer) {
         serialize_element(verify_cast<DOM::Element>(node));
-        return builder.to_string_without_validation();
+        return move(builder).to_string_without_validation();
     }
 
     // The algorithm takes as input a DOM Element, Document, or DocumentFragment referred to as the node.
@@ -4646,7 +4748,7 @@ String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableSh
     });
 
     // 6. Return s.
-    return MUST(builder.to_string());
+    return MUST(move(builder).to_string());
 }
 
 // https://html.spec.whatwg.org/multipage/common-microsyntaxes.html#current-dimension-value
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Time.h>
 #include <LibGfx/Color.h>
 #include <LibJS/Heap/Cell.h>
 #include <LibWeb/DOM/Node.h>
@@ -56,6 +57,11 @@ public:
     void run(HTMLTokenizer::StopAtInsertionPoint = HTMLTokenizer::StopAtInsertionPoint::No);
     void run(const URL::URL&, HTMLTokenizer::StopAtInsertionPoint = HTMLTokenizer::StopAtInsertionPoint::No);
 
+    // AD-HOC: Like run(URL), but the parser yields to the event loop whenever it has been running for a while, and
+    //         queues a task to pick up where it left off. This gives the document rendering opportunities, and lets
+    //         input be handled, while a large document is being parsed.
+    void run_incrementally(URL::URL const&);
+
     static void the_end(JS::NonnullGCPtr<DOM::Document>, JS::GCPtr<HTMLParser> = nullptr);
 
     DOM::Document& document();
@@ -96,6 +102,13 @@ private:
 
     virtual void visit_edges(Cell::Visitor&) override;
 
+    enum class RunResult {
+        Finished,
+        Yielded,
+    };
+    RunResult run_until(HTMLTokenizer::StopAtInsertionPoint, Optional<MonotonicTime> deadline);
+    void continue_running_incrementally();
+
     char const* insertion_mode_name() const;
 
     DOM::QuirksMode which_quirks_mode(HTMLToken const&) const;
@@ -160,6 +173,7 @@ private:
     void increment_script_nesting_level();
     void decrement_script_nesting_level();
     void reset_the_insertion_mode_appropriately();
+    void start_the_speculative_html_parser();
 
     void adjust_mathml_attributes(HTMLToken&);
     void adjust_svg_tag_names(HTMLToken&);
@@ -200,6 +214,9 @@ private:
     bool m_stop_parsing { false };
     size_t m_script_nesting_level { 0 };
 
+    // The byte offset in the input up to which the speculative HTML parser has already looked ahead.
+    Optional<size_t> m_speculatively_parsed_input_end;
+
     JS::Realm& realm();
 
     JS::GCPtr<DOM::Document> m_document;
@@ -155,6 +155,8 @@ namespace Web::HTML {
     do {                                                \
         create_new_token(HTMLToken::Type::Character);   \
         m_current_token.set_code_point(code_point);     \
+        if (m_queued_tokens.is_empty())                 \
+            return move(m_current_token);               \
         m_queued_tokens.enqueue(move(m_current_token)); \
         return m_queued_tokens.dequeue();               \
     } while (0)
@@ -198,20 +200,21 @@ Optional<u32> HTMLTokenizer::next_code_point()
     if (m_utf8_iterator == m_utf8_view.end())
         return {};
 
-    u32 code_point;
+    // OPTIMIZATION: Decode the current code point once, rather than peeking (and decoding) it twice for the
+    //               CR checks below and then a third time after skipping over it.
+    u32 code_point = *m_utf8_iterator;
     // https://html.spec.whatwg.org/multipage/parsing.html#preprocessing-the-input-stream:tokenization
     // https://infra.spec.whatwg.org/#normalize-newlines
-    if (peek_code_point(0).value_or(0) == '\r' && peek_code_point(1).value_or(0) == '\n') {
+    if (code_point == '\r' && peek_code_point(1).value_or(0) == '\n') {
         // replace every U+000D CR U+000A LF code point pair with a single U+000A LF code point,
         skip(2);
         code_point = '\n';
-    } else if (peek_code_point(0).value_or(0) == '\r') {
+    } else if (code_point == '\r') {
         // replace every remaining U+000D CR code point with a U+000A LF code point.
         skip(1);
         code_point = '\n';
     } else {
         skip(1);
-        code_point = *m_prev_utf8_iterator;
     }
 
     dbgln_if(TOKENIZER_TRACE_DEBUG, "(Tokenizer) Next code_point: {}", code_point);
@@ -129,6 +129,7 @@ public:
     bool is_blocked() const { return m_blocked; }
 
     ByteString source() const { return m_decoded_input; }
+    size_t next_input_character_byte_offset() const { return m_utf8_view.byte_offset_of(m_utf8_iterator); }
 
     void insert_input_at_insertion_point(StringView input);
     void insert_eof();
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Runtime/Promise.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/Bindings/MainThreadVM.h>
+#include <LibWeb/DOM/AbortSignal.h>
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/Scheduler.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
+#include <LibWeb/HTML/Window.h>
+#include <LibWeb/HTML/WindowOrWorkerGlobalScope.h>
+#include <LibWeb/WebIDL/AbstractOperations.h>
+#include <LibWeb/WebIDL/Promise.h>
+
+namespace Web::HTML {
+
+JS_DEFINE_ALLOCATOR(Scheduler);
+
+JS::NonnullGCPtr<Scheduler> Scheduler::create(JS::Realm& realm)
+{
+    return realm.heap().allocate<Scheduler>(realm, realm);
+}
+
+Scheduler::Scheduler(JS::Realm& realm)
+    : Bindings::PlatformObject(realm)
+    , m_event_loop(*verify_cast<Bindings::WebEngineCustomData>(*realm.vm().custom_data()).event_loop)
+{
+}
+
+Scheduler::~Scheduler() = default;
+
+void Scheduler::initialize(JS::Realm& realm)
+{
+    Base::initialize(realm);
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(Scheduler);
+}
+
+void Scheduler::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_event_loop);
+}
+
+static Task::Priority task_priority_to_event_loop_priority(Bindings::TaskPriority priority)
+{
+    switch (priority) {
+    case Bindings::TaskPriority::UserBlocking:
+        return Task::Priority::High;
+    case Bindings::TaskPriority::UserVisible:
+        return Task::Priority::Normal;
+    case Bindings::TaskPriority::Background:
+        return Task::Priority::Low;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+// https://wicg.github.io/scheduling-apis/#dom-scheduler-posttask
+JS::NonnullGCPtr<JS::Promise> Scheduler::post_task(WebIDL::CallbackType& callback, SchedulerPostTaskOptions const& options)
+{
+    auto& realm = this->realm();
+
+    // 1. Let result be a new promise.
+    auto result = WebIDL::create_promise(realm);
+
+    // 2. Let signal be options["signal"] if options["signal"] exists, or otherwise null.
+    auto signal = options.signal;
+
+    // 3. If signal is not null and it is aborted, then reject result with signal's abort reason and return result.
+    if (signal && signal->aborted()) {
+        WebIDL::reject_promise(realm, result, signal->reason());
+        return JS::NonnullGCPtr { verify_cast<JS::Promise>(*result->promise()) };
+    }
+
+    // FIXME: 4. - 6. Support TaskSignal priority sources. Until then, the priority is fixed when the task is posted.
+    auto priority = options.priority.value_or(Bindings::TaskPriority::UserVisible);
+
+    // AD-HOC: Instead of removing the task from its queue when signal is aborted, the task checks for that when it runs.
+    if (signal) {
+        signal->add_abort_algorithm([&realm, signal, result] {
+            WebIDL::reject_promise(realm, result, signal->reason());
+        });
+    }
+
+    // 7. If options["delay"] is greater than 0, then run steps after a timeout given scheduler's relevant global object,
+    //    "scheduler-postTask", options["delay"], and the following steps:
+    if (options.delay > 0) {
+        auto* global = dynamic_cast<WindowOrWorkerGlobalScopeMixin*>(&relevant_global_object(*this));
+        VERIFY(global);
+        auto timeout = static_cast<i32>(min(options.delay, static_cast<WebIDL::UnsignedLongLong>(NumericLimits<i32>::max())));
+        global->run_steps_after_a_timeout(timeout, [this, callback = JS::make_handle(callback), priority, signal = JS::make_handle(signal), result = JS::make_handle(result)] {
+            // 1. Schedule a task to invoke a callback for scheduler given callback, state, and result.
+            schedule_a_task_to_invoke_a_callback(*callback, priority, signal.ptr(), *result);
+        });
+    }
+    // 8. Otherwise, schedule a task to invoke a callback for scheduler given callback, state, and result.
+    else {
+        schedule_a_task_to_invoke_a_callback(callback, priority, signal, result);
+    }
+
+    // 9. Return result.
+    return JS::NonnullGCPtr { verify_cast<JS::Promise>(*result->promise()) };
+}
+
+// https://wicg.github.io/scheduling-apis/#schedule-a-task-to-invoke-a-callback
+void Scheduler::schedule_a_task_to_invoke_a_callback(WebIDL::CallbackType& callback, Bindings::TaskPriority priority, JS::GCPtr<DOM::AbortSignal> signal, JS::NonnullGCPtr<WebIDL::Promise> result)
+{
+    auto& realm = this->realm();
+
+    JS::GCPtr<DOM::Document> document;
+    if (auto* window = dynamic_cast<Window*>(&relevant_global_object(*this)))
+        document = &window->associated_document();
+
+    // NOTE: Instead of keeping one scheduler task queue per priority, we give the task a priority in the event loop's
+    //       task queue, which will pick the highest priority runnable task first.
+    auto task = Task::create(vm(), Task::Source::PostedTask, document, JS::create_heap_function(heap(), [&realm, callback = JS::NonnullGCPtr { callback }, signal, result] {
+        // NOTE: If signal was aborted before the task ran, result has already been rejected.
+        if (signal && signal->aborted())
+            return;
+
+        // 1. Let callbackResult be the result of invoking callback with « ». If that threw an exception, then reject
+        //    result with that. Otherwise, resolve result with callbackResult.
+        auto callback_result = WebIDL::invoke_callback(*callback, {});
+
+        TemporaryExecutionContext execution_context { Bindings::host_defined_environment_settings_object(realm) };
+        if (callback_result.is_error())
+            WebIDL::reject_promise(realm, result, callback_result.release_error().value().value());
+        else
+            WebIDL::resolve_promise(realm, result, callback_result.release_value().value_or(JS::js_undefined()));
+    }));
+    task->set_priority(task_priority_to_event_loop_priority(priority));
+    m_event_loop->task_queue().add(task);
+}
+
+}
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/Bindings/SchedulerPrototype.h>
+#include <LibWeb/WebIDL/Types.h>
+
+namespace Web::HTML {
+
+// https://wicg.github.io/scheduling-apis/#dictdef-schedulerposttaskoptions
+struct SchedulerPostTaskOptions {
+    JS::GCPtr<DOM::AbortSignal> signal;
+    Optional<Bindings::TaskPriority> priority;
+    WebIDL::UnsignedLongLong delay { 0 };
+};
+
+// https://wicg.github.io/scheduling-apis/#scheduler
+class Scheduler final : public Bindings::PlatformObject {
+    WEB_PLATFORM_OBJECT(Scheduler, Bindings::PlatformObject);
+    JS_DECLARE_ALLOCATOR(Scheduler);
+
+public:
+    [[nodiscard]] static JS::NonnullGCPtr<Scheduler> create(JS::Realm&);
+
+    virtual ~Scheduler() override;
+
+    JS::NonnullGCPtr<JS::Promise> post_task(WebIDL::CallbackType& callback, SchedulerPostTaskOptions const& options = {});
+
+private:
+    explicit Scheduler(JS::Realm&);
+
+    virtual void initialize(JS::Realm&) override;
+    virtual void visit_edges(Cell::Visitor&) override;
+
+    void schedule_a_task_to_invoke_a_callback(WebIDL::CallbackType&, Bindings::TaskPriority, JS::GCPtr<DOM::AbortSignal>, JS::NonnullGCPtr<WebIDL::Promise>);
+
+    // The event loop of the agent this scheduler's global belongs to, which may be a worker's.
+    JS::NonnullGCPtr<EventLoop> m_event_loop;
+};
+
+}
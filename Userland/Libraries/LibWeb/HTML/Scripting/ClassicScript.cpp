@@ -49,6 +49,10 @@ JS::NonnullGCPtr<ClassicScript> ClassicScript::create(ByteString filename, Strin
     script->set_error_to_rethrow(JS::js_null());
 
     // 10. Let result be ParseScript(source, settings's Realm, script).
+    // FIXME: For external scripts, it would be nice to run the parser on a background thread while the response body
+    //        is still streaming in, and only do the realm-dependent work here. That's blocked on the AST not being
+    //        thread-safe: it's built from non-atomically ref-counted nodes and interns every identifier into the
+    //        process-wide (and unsynchronized) DeprecatedFlyString table, which the main thread uses concurrently.
     auto parse_timer = Core::ElapsedTimer::start_new();
     auto result = JS::Script::parse(source, environment_settings_object.realm(), script->filename(), script, source_line_number);
     dbgln_if(HTML_SCRIPT_DEBUG, "ClassicScript: Parsed {} in {}ms", script->filename(), parse_timer.elapsed());
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <LibWeb/DOMURL/DOMURL.h>
+#include <LibWeb/HTML/Scripting/SpeculationRules.h>
+
+namespace Web::HTML {
+
+// https://wicg.github.io/nav-speculation/speculation-rules.html#parse-a-speculation-rule
+static Optional<SpeculationRule> parse_speculation_rule(JsonValue const& input, URL::URL const& base_url)
+{
+    if (!input.is_object())
+        return {};
+    auto const& rule = input.as_object();
+
+    // NOTE: A rule without a "source" is a list rule if it has "urls".
+    if (auto source = rule.get_byte_string("source"sv); source.has_value() && source != "list"sv)
+        return {};
+
+    auto urls = rule.get_array("urls"sv);
+    if (!urls.has_value())
+        return {};
+
+    SpeculationRule result;
+    urls->for_each([&](JsonValue const& url_value) {
+        if (!url_value.is_string())
+            return;
+        auto url = DOMURL::parse(url_value.as_string(), base_url);
+        if (!url.is_valid() || !url.scheme().is_one_of("http"sv, "https"sv))
+            return;
+        result.urls.append(move(url));
+    });
+    return result;
+}
+
+// https://wicg.github.io/nav-speculation/speculation-rules.html#parse-a-speculation-rule-set-string
+Optional<SpeculationRuleSet> parse_speculation_rule_set_string(StringView input, URL::URL const& base_url)
+{
+    auto parsed = JsonValue::from_string(input);
+    if (parsed.is_error() || !parsed.value().is_object())
+        return {};
+    auto const& parsed_object = parsed.value().as_object();
+
+    SpeculationRuleSet result;
+    auto parse_rules = [&](StringView key, Vector<SpeculationRule>& rules) {
+        auto parsed_rules = parsed_object.get_array(key);
+        if (!parsed_rules.has_value())
+            return;
+        parsed_rules->for_each([&](JsonValue const& parsed_rule) {
+            if (auto rule = parse_speculation_rule(parsed_rule, base_url); rule.has_value())
+                rules.append(rule.release_value());
+        });
+    };
+    parse_rules("prefetch"sv, result.prefetch_rules);
+    parse_rules("prerender"sv, result.prerender_rules);
+    return result;
+}
+
+}
@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Optional.h>
+#include <AK/StringView.h>
+#include <AK/Vector.h>
+#include <LibURL/URL.h>
+
+namespace Web::HTML {
+
+// https://wicg.github.io/nav-speculation/speculation-rules.html#speculation-rule
+struct SpeculationRule {
+    Vector<URL::URL> urls;
+};
+
+// https://wicg.github.io/nav-speculation/speculation-rules.html#speculation-rule-set
+struct SpeculationRuleSet {
+    Vector<SpeculationRule> prefetch_rules;
+    Vector<SpeculationRule> prerender_rules;
+};
+
+// NOTE: Only list rules are supported. Document rules are skipped, and so are rules and URLs that are not well-formed.
+//       An empty Optional is returned if the input is not a JSON object.
+Optional<SpeculationRuleSet> parse_speculation_rule_set_string(StringView input, URL::URL const& base_url);
+
+}
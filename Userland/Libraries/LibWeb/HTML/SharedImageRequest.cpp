@@ -21,13 +21,25 @@ namespace Web::HTML {
 
 JS_DEFINE_ALLOCATOR(SharedImageRequest);
 
+// NOTE: These only count how often a document reuses a request for the same URL. Decoded frames stay alive for as
+//       long as their document does; there is no byte budget, eviction or re-decoding of images.
+static SharedImageRequest::Statistics s_statistics;
+
+SharedImageRequest::Statistics const& SharedImageRequest::statistics()
+{
+    return s_statistics;
+}
+
 JS::NonnullGCPtr<SharedImageRequest> SharedImageRequest::get_or_create(JS::Realm& realm, JS::NonnullGCPtr<Page> page, URL::URL const& url)
 {
     auto document = Bindings::host_defined_environment_settings_object(realm).responsible_document();
     VERIFY(document);
     auto& shared_image_requests = document->shared_image_requests();
-    if (auto it = shared_image_requests.find(url); it != shared_image_requests.end())
+    if (auto it = shared_image_requests.find(url); it != shared_image_requests.end()) {
+        ++s_statistics.reused_request_count;
         return *it->value;
+    }
+    ++s_statistics.created_request_count;
     auto request = realm.heap().allocate<SharedImageRequest>(realm, page, url, *document);
     shared_image_requests.set(url, request);
     return request;
@@ -46,7 +58,10 @@ void SharedImageRequest::finalize()
 {
     Base::finalize();
     auto& shared_image_requests = m_document->shared_image_requests();
-    shared_image_requests.remove(m_url);
+
+    // The document may have let go of this request already, and started a new one for the same URL since.
+    if (auto it = shared_image_requests.find(m_url); it != shared_image_requests.end() && it->value == this)
+        shared_image_requests.remove(it);
 }
 
 void SharedImageRequest::visit_edges(JS::Cell::Visitor& visitor)
@@ -24,6 +24,14 @@ class SharedImageRequest final : public JS::Cell {
 public:
     [[nodiscard]] static JS::NonnullGCPtr<SharedImageRequest> get_or_create(JS::Realm&, JS::NonnullGCPtr<Page>, URL::URL const&);
 
+    struct Statistics {
+        // Number of get_or_create() calls that reused an existing request in the document.
+        size_t reused_request_count { 0 };
+        // Number of get_or_create() calls that had to create a new request.
+        size_t created_request_count { 0 };
+    };
+    static Statistics const& statistics();
+
     virtual ~SharedImageRequest() override;
 
     URL::URL const& url() const { return m_url; }
@@ -8,19 +8,23 @@
 #include <AK/String.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Bindings/StoragePrototype.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
 #include <LibWeb/HTML/Storage.h>
+#include <LibWeb/HTML/Window.h>
+#include <LibWeb/Page/Page.h>
 
 namespace Web::HTML {
 
 JS_DEFINE_ALLOCATOR(Storage);
 
-JS::NonnullGCPtr<Storage> Storage::create(JS::Realm& realm)
+JS::NonnullGCPtr<Storage> Storage::create(JS::Realm& realm, NonnullRefPtr<StorageBottle> storage_bottle)
 {
-    return realm.heap().allocate<Storage>(realm, realm);
+    return realm.heap().allocate<Storage>(realm, realm, move(storage_bottle));
 }
 
-Storage::Storage(JS::Realm& realm)
+Storage::Storage(JS::Realm& realm, NonnullRefPtr<StorageBottle> storage_bottle)
     : Bindings::PlatformObject(realm)
+    , m_storage_bottle(move(storage_bottle))
 {
     m_legacy_platform_object_flags = LegacyPlatformObjectFlags {
         .supports_named_properties = true,
@@ -44,18 +48,18 @@ void Storage::initialize(JS::Realm& realm)
 size_t Storage::length() const
 {
     // The length getter steps are to return this's map's size.
-    return m_map.size();
+    return m_storage_bottle->map().size();
 }
 
 // https://html.spec.whatwg.org/multipage/webstorage.html#dom-storage-key
 Optional<String> Storage::key(size_t index)
 {
     // 1. If index is greater than or equal to this's map's size, then return null.
-    if (index >= m_map.size())
+    if (index >= m_storage_bottle->map().size())
         return {};
 
     // 2. Let keys be the result of running get the keys on this's map.
-    auto keys = m_map.keys();
+    auto keys = m_storage_bottle->map().keys();
 
     // 3. Return keys[index].
     return keys[index];
@@ -65,8 +69,8 @@ Optional<String> Storage::key(size_t index)
 Optional<String> Storage::get_item(StringView key) const
 {
     // 1. If this's map[key] does not exist, then return null.
-    auto it = m_map.find(key);
-    if (it == m_map.end())
+    auto it = m_storage_bottle->map().find(key);
+    if (it == m_storage_bottle->map().end())
         return {};
 
     // 2. Return this's map[key].
@@ -83,7 +87,7 @@ WebIDL::ExceptionOr<void> Storage::set_item(String const& key, String const& val
     bool reorder = true;
 
     // 3. If this's map[key] exists:
-    if (auto it = m_map.find(key); it != m_map.end()) {
+    if (auto it = m_storage_bottle->map().find(key); it != m_storage_bottle->map().end()) {
         // 1. Set oldValue to this's map[key].
         old_value = it->value;
 
@@ -95,15 +99,19 @@ WebIDL::ExceptionOr<void> Storage::set_item(String const& key, String const& val
         reorder = false;
     }
 
-    // FIXME: 4. If value cannot be stored, then throw a "QuotaExceededError" DOMException exception.
+    // 4. If value cannot be stored, then throw a "QuotaExceededError" DOMException exception.
+    if (!m_storage_bottle->can_store(key, value))
+        return WebIDL::QuotaExceededError::create(realm(), "Setting the item would exceed the storage quota"_fly_string);
 
     // 5. Set this's map[key] to value.
-    m_map.set(key, value);
+    m_storage_bottle->set(key, value);
 
     // 6. If reorder is true, then reorder this.
     if (reorder)
         this->reorder();
 
+    persist(key, value);
+
     // 7. Broadcast this with key, oldValue, and value.
     broadcast(key, old_value, value);
 
@@ -115,19 +123,21 @@ void Storage::remove_item(StringView key)
 {
     // 1. If this's map[key] does not exist, then return null.
     // FIXME: Return null?
-    auto it = m_map.find(key);
-    if (it == m_map.end())
+    auto it = m_storage_bottle->map().find(key);
+    if (it == m_storage_bottle->map().end())
         return;
 
     // 2. Set oldValue to this's map[key].
     auto old_value = it->value;
 
     // 3. Remove this's map[key].
-    m_map.remove(it);
+    m_storage_bottle->remove(it->key);
 
     // 4. Reorder this.
     reorder();
 
+    persist(key, {});
+
     // 5. Broadcast this with key, oldValue, and null.
     broadcast(key, old_value, {});
 }
@@ -136,7 +146,9 @@ void Storage::remove_item(StringView key)
 void Storage::clear()
 {
     // 1. Clear this's map.
-    m_map.clear();
+    m_storage_bottle->clear();
+
+    persist({}, {});
 
     // 2. Broadcast this with null, null, and null.
     broadcast({}, {}, {});
@@ -149,6 +161,25 @@ void Storage::reorder()
     // NOTE: This basically means that we're not required to maintain any particular iteration order.
 }
 
+// AD-HOC: Hands a change to this's map over to the browser, which persists it and shares it with the other processes.
+//         A key with no value was removed, and no key means that the map was cleared.
+void Storage::persist(Optional<String> const& key, Optional<String> const& value)
+{
+    auto const& origin = m_storage_bottle->persisted_origin();
+    if (!origin.has_value())
+        return;
+
+    auto& client = verify_cast<Window>(relevant_global_object(*this)).page().client();
+    m_storage_bottle->did_send_change(key);
+
+    if (!key.has_value())
+        client.page_did_clear_local_storage(*origin);
+    else if (!value.has_value())
+        client.page_did_remove_local_storage_item(*origin, *key);
+    else
+        client.page_did_set_local_storage_item(*origin, *key, *value);
+}
+
 // https://html.spec.whatwg.org/multipage/webstorage.html#concept-storage-broadcast
 void Storage::broadcast(StringView key, StringView old_value, StringView new_value)
 {
@@ -162,8 +193,8 @@ Vector<FlyString> Storage::supported_property_names() const
 {
     // The supported property names on a Storage object storage are the result of running get the keys on storage's map.
     Vector<FlyString> names;
-    names.ensure_capacity(m_map.size());
-    for (auto const& key : m_map.keys())
+    names.ensure_capacity(m_storage_bottle->map().size());
+    for (auto const& key : m_storage_bottle->map().keys())
         names.unchecked_append(key);
     return names;
 }
@@ -192,9 +223,9 @@ WebIDL::ExceptionOr<void> Storage::set_value_of_named_property(String const& key
 
 void Storage::dump() const
 {
-    dbgln("Storage ({} key(s))", m_map.size());
+    dbgln("Storage ({} key(s))", m_storage_bottle->map().size());
     size_t i = 0;
-    for (auto const& it : m_map) {
+    for (auto const& it : m_storage_bottle->map()) {
         dbgln("[{}] \"{}\": \"{}\"", i, it.key, it.value);
         ++i;
     }
@@ -9,6 +9,7 @@
 
 #include <AK/HashMap.h>
 #include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/HTML/StorageBottle.h>
 #include <LibWeb/WebIDL/ExceptionOr.h>
 
 namespace Web::HTML {
@@ -18,7 +19,7 @@ class Storage : public Bindings::PlatformObject {
     JS_DECLARE_ALLOCATOR(Storage);
 
 public:
-    [[nodiscard]] static JS::NonnullGCPtr<Storage> create(JS::Realm&);
+    [[nodiscard]] static JS::NonnullGCPtr<Storage> create(JS::Realm&, NonnullRefPtr<StorageBottle>);
     ~Storage();
 
     size_t length() const;
@@ -28,12 +29,12 @@ public:
     void remove_item(StringView key);
     void clear();
 
-    auto const& map() const { return m_map; }
+    auto const& map() const { return m_storage_bottle->map(); }
 
     void dump() const;
 
 private:
-    explicit Storage(JS::Realm&);
+    Storage(JS::Realm&, NonnullRefPtr<StorageBottle>);
 
     virtual void initialize(JS::Realm&) override;
 
@@ -45,8 +46,9 @@ private:
 
     void reorder();
     void broadcast(StringView key, StringView old_value, StringView new_value);
+    void persist(Optional<String> const& key, Optional<String> const& value);
 
-    OrderedHashMap<String, String> m_map;
+    NonnullRefPtr<StorageBottle> m_storage_bottle;
 };
 
 }
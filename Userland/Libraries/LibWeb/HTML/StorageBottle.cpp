@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/HashTable.h>
+#include <LibWeb/HTML/Origin.h>
+#include <LibWeb/HTML/StorageBottle.h>
+#include <LibWeb/Page/Page.h>
+
+namespace Web::HTML {
+
+static HashMap<String, NonnullRefPtr<StorageBottle>> s_persisted_local_storage_bottles;
+static HashTable<String> s_local_storage_origins_being_preloaded;
+static HashMap<Origin, NonnullRefPtr<StorageBottle>> s_transient_local_storage_bottles;
+static HashMap<Origin, NonnullRefPtr<StorageBottle>> s_session_storage_bottles;
+
+StorageBottle::StorageBottle(OrderedHashMap<String, String> map, Optional<String> persisted_origin)
+    : m_map(move(map))
+    , m_persisted_origin(move(persisted_origin))
+{
+    for (auto const& it : m_map)
+        m_size_in_bytes += size_of_item(it.key, it.value);
+}
+
+NonnullRefPtr<StorageBottle> StorageBottle::obtain_local_storage_bottle(Page& page, Origin const& origin)
+{
+    // FIXME: Opaque origins don't have a storage key, so obtaining their storage should fail instead.
+    if (origin.is_opaque()) {
+        return s_transient_local_storage_bottles.ensure(origin, [] {
+            return adopt_ref(*new StorageBottle({}, {}));
+        });
+    }
+
+    auto serialized_origin = MUST(String::from_byte_string(origin.serialize()));
+
+    // If the preloaded items haven't arrived yet, we have to wait for them. Once they do, they are dropped, as the
+    // changes made since are going to be applied to what we get here.
+    return s_persisted_local_storage_bottles.ensure(serialized_origin, [&] {
+        auto map = page.client().page_did_request_local_storage_items(serialized_origin);
+        return adopt_ref(*new StorageBottle(move(map), serialized_origin));
+    });
+}
+
+NonnullRefPtr<StorageBottle> StorageBottle::obtain_session_storage_bottle(Origin const& origin)
+{
+    // FIXME: sessionStorage should be scoped to the top-level traversable rather than shared by the whole process.
+    return s_session_storage_bottles.ensure(origin, [] {
+        return adopt_ref(*new StorageBottle({}, {}));
+    });
+}
+
+void StorageBottle::preload_local_storage_bottle(Page& page, Origin const& origin)
+{
+    if (origin.is_opaque())
+        return;
+
+    auto serialized_origin = MUST(String::from_byte_string(origin.serialize()));
+    if (s_persisted_local_storage_bottles.contains(serialized_origin))
+        return;
+    if (s_local_storage_origins_being_preloaded.set(serialized_origin) != HashSetResult::InsertedNewEntry)
+        return;
+
+    page.client().page_did_request_local_storage_preload(serialized_origin);
+}
+
+void StorageBottle::local_storage_did_load(String const& origin, OrderedHashMap<String, String> items)
+{
+    s_local_storage_origins_being_preloaded.remove(origin);
+
+    s_persisted_local_storage_bottles.ensure(origin, [&] {
+        return adopt_ref(*new StorageBottle(move(items), origin));
+    });
+}
+
+void StorageBottle::local_storage_did_change(String const& origin, Optional<String> const& key, Optional<String> const& value, bool is_own_change)
+{
+    auto it = s_persisted_local_storage_bottles.find(origin);
+    if (it == s_persisted_local_storage_bottles.end())
+        return;
+
+    auto& bottle = *it->value;
+
+    // NOTE: The browser sends us its changes in the order it accepted them. Until our latest change to an item is
+    //       confirmed, every change to it that we receive was accepted before ours, and our map already reflects ours.
+    if (!key.has_value()) {
+        if (is_own_change) {
+            if (bottle.m_unconfirmed_clears > 0)
+                --bottle.m_unconfirmed_clears;
+            return;
+        }
+        if (bottle.m_unconfirmed_clears > 0)
+            return;
+
+        // FIXME: Fire storage events at the windows of this origin.
+        Vector<String> keys_to_remove;
+        for (auto const& item : bottle.m_map) {
+            if (!bottle.m_unconfirmed_changes_by_key.contains(item.key))
+                keys_to_remove.append(item.key);
+        }
+        for (auto const& key_to_remove : keys_to_remove)
+            bottle.remove(key_to_remove);
+        return;
+    }
+
+    if (is_own_change) {
+        // Once our latest change to the item is confirmed, the browser's value is the one to keep. It differs from ours
+        // if the browser refused the change.
+        if (auto unconfirmed = bottle.m_unconfirmed_changes_by_key.find(*key); unconfirmed != bottle.m_unconfirmed_changes_by_key.end()) {
+            if (--unconfirmed->value > 0)
+                return;
+            bottle.m_unconfirmed_changes_by_key.remove(unconfirmed);
+        }
+    } else if (bottle.m_unconfirmed_changes_by_key.contains(*key)) {
+        return;
+    }
+    if (bottle.m_unconfirmed_clears > 0)
+        return;
+
+    // FIXME: Fire storage events at the windows of this origin.
+    if (!value.has_value())
+        bottle.remove(*key);
+    else
+        bottle.set(*key, *value);
+}
+
+bool StorageBottle::can_store(String const& key, String const& value) const
+{
+    auto size_in_bytes = m_size_in_bytes + size_of_item(key, value);
+    if (auto it = m_map.find(key); it != m_map.end())
+        size_in_bytes -= size_of_item(it->key, it->value);
+    return size_in_bytes <= quota;
+}
+
+void StorageBottle::set(String const& key, String const& value)
+{
+    if (auto it = m_map.find(key); it != m_map.end())
+        m_size_in_bytes -= size_of_item(it->key, it->value);
+    m_map.set(key, value);
+    m_size_in_bytes += size_of_item(key, value);
+}
+
+void StorageBottle::remove(String const& key)
+{
+    auto it = m_map.find(key);
+    if (it == m_map.end())
+        return;
+
+    m_size_in_bytes -= size_of_item(it->key, it->value);
+    m_map.remove(it);
+}
+
+void StorageBottle::clear()
+{
+    m_map.clear();
+    m_size_in_bytes = 0;
+}
+
+void StorageBottle::did_send_change(Optional<String> const& key)
+{
+    if (key.has_value())
+        ++m_unconfirmed_changes_by_key.ensure(*key, [] { return 0; });
+    else
+        ++m_unconfirmed_clears;
+}
+
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/Optional.h>
+#include <AK/RefCounted.h>
+#include <AK/String.h>
+#include <LibWeb/Forward.h>
+
+namespace Web::HTML {
+
+// https://storage.spec.whatwg.org/#storage-bottle
+// Every Storage object of the same type and origin in this process shares a bottle, so writes are immediately visible
+// to the other documents of the origin. The localStorage bottles of tuple origins mirror the browser's localStorage,
+// which is the authority on their contents: they are loaded from it, the Storage objects send their changes back to it
+// without waiting, and the changes it accepts are applied in the order it accepted them. While the browser has yet to
+// confirm a change we made to an item, the changes it accepted before ours are skipped, as ours replaces them.
+class StorageBottle : public RefCounted<StorageBottle> {
+public:
+    // https://storage.spec.whatwg.org/#storage-bottle-quota
+    // The spec suggests 5 MiB for both localStorage and sessionStorage. We count the UTF-8 bytes of the keys and values.
+    static constexpr size_t quota = 5 * MiB;
+    static size_t size_of_item(String const& key, String const& value) { return key.bytes().size() + value.bytes().size(); }
+
+    static NonnullRefPtr<StorageBottle> obtain_local_storage_bottle(Page&, Origin const&);
+    static NonnullRefPtr<StorageBottle> obtain_session_storage_bottle(Origin const&);
+
+    // Asks the browser for the localStorage of an origin ahead of time, so that the first use of it doesn't have to
+    // wait for the browser.
+    static void preload_local_storage_bottle(Page&, Origin const&);
+    static void local_storage_did_load(String const& origin, OrderedHashMap<String, String> items);
+
+    // Applies a change that the browser accepted to the localStorage of an origin, if we have loaded it. A key with no
+    // value was removed, and no key means that the localStorage was cleared. Our own changes come back as well, with
+    // is_own_change set, which confirms them.
+    static void local_storage_did_change(String const& origin, Optional<String> const& key, Optional<String> const& value, bool is_own_change);
+
+    // https://storage.spec.whatwg.org/#storage-bottle-map
+    OrderedHashMap<String, String> const& map() const { return m_map; }
+
+    // Whether setting key to value would keep the map within the quota.
+    bool can_store(String const& key, String const& value) const;
+
+    void set(String const& key, String const& value);
+    void remove(String const& key);
+    void clear();
+
+    // Records that a change made to the map in this process was sent to the browser. No key means it was cleared.
+    void did_send_change(Optional<String> const& key);
+
+    // The serialized origin that the browser persists this bottle's map under, if it does.
+    Optional<String> const& persisted_origin() const { return m_persisted_origin; }
+
+private:
+    StorageBottle(OrderedHashMap<String, String> map, Optional<String> persisted_origin);
+
+    OrderedHashMap<String, String> m_map;
+    size_t m_size_in_bytes { 0 };
+    Optional<String> m_persisted_origin;
+
+    // The changes we sent to the browser that it has yet to confirm.
+    HashMap<String, size_t> m_unconfirmed_changes_by_key;
+    size_t m_unconfirmed_clears { 0 };
+};
+
+}
@@ -10,6 +10,7 @@
 #include <AK/StdLibExtras.h>
 #include <AK/String.h>
 #include <AK/Vector.h>
+#include <LibCore/AnonymousBuffer.h>
 #include <LibIPC/Decoder.h>
 #include <LibIPC/Encoder.h>
 #include <LibIPC/File.h>
@@ -44,6 +45,7 @@
 #include <LibWeb/Geometry/DOMQuad.h>
 #include <LibWeb/Geometry/DOMRect.h>
 #include <LibWeb/Geometry/DOMRectReadOnly.h>
+#include <LibWeb/HTML/ImageBitmap.h>
 #include <LibWeb/HTML/MessagePort.h>
 #include <LibWeb/HTML/StructuredSerialize.h>
 #include <LibWeb/WebIDL/ExceptionOr.h>
@@ -149,20 +151,24 @@ static ErrorType error_name_to_type(String const& name)
 
 class Serializer {
 public:
-    Serializer(JS::VM& vm, SerializationMemory& memory, bool for_storage)
+    Serializer(JS::VM& vm, SerializationRecord& serialized, SerializationMemory& memory, bool for_storage)
         : m_vm(vm)
+        , m_serialized(serialized)
         , m_memory(memory)
         , m_for_storage(for_storage)
     {
     }
 
     // https://html.spec.whatwg.org/multipage/structured-data.html#structuredserializeinternal
-    WebIDL::ExceptionOr<SerializationRecord> serialize(JS::Value value)
+    // NOTE: Nested values are serialized by calling this recursively, which appends them straight to the record of
+    //       the outermost value instead of building a record for each of them.
+    WebIDL::ExceptionOr<void> serialize(JS::Value value)
     {
         // 2. If memory[value] exists, then return memory[value].
-        if (m_memory.contains(value)) {
-            auto index = m_memory.get(value).value();
-            return Vector<u32> { ValueTag::ObjectReference, index };
+        if (auto index = m_memory.get(value); index.has_value()) {
+            serialize_enum(m_serialized, ValueTag::ObjectReference);
+            m_serialized.append(*index);
+            return {};
         }
 
         // 3. Let deep be false.
@@ -191,7 +197,7 @@ public:
         }
 
         if (return_primitive_type)
-            return m_serialized;
+            return {};
 
         // 5. If Type(value) is Symbol, then throw a "DataCloneError" DOMException.
         if (value.is_symbol())
@@ -348,7 +354,9 @@ public:
         }
 
         // 25. Set memory[value] to serialized.
-        m_memory.set(make_handle(value), m_next_id++);
+        // NOTE: Values are numbered in the order they are serialized, which is the order they will be deserialized in.
+        auto id = static_cast<u32>(m_memory.size());
+        m_memory.set(make_handle(value), id);
 
         // 26. If deep is true, then:
         if (deep) {
@@ -371,10 +379,8 @@ public:
                 for (auto copied_value : copied_list) {
                     // 1. Let serializedKey be ? StructuredSerializeInternal(entry.[[Key]], forStorage, memory).
                     // 2. Let serializedValue be ? StructuredSerializeInternal(entry.[[Value]], forStorage, memory).
-                    auto serialized_value = TRY(structured_serialize_internal(m_vm, copied_value, m_for_storage, m_memory));
-
                     // 3. Append { [[Key]]: serializedKey, [[Value]]: serializedValue } to serialized.[[MapData]].
-                    m_serialized.extend(serialized_value);
+                    TRY(serialize(copied_value));
                 }
             }
 
@@ -393,10 +399,8 @@ public:
                 // 3. For each entry of copiedList:
                 for (auto copied_value : copied_list) {
                     // 1. Let serializedEntry be ? StructuredSerializeInternal(entry, forStorage, memory).
-                    auto serialized_value = TRY(structured_serialize_internal(m_vm, copied_value, m_for_storage, m_memory));
-
                     // 2. Append serializedEntry to serialized.[[SetData]].
-                    m_serialized.extend(serialized_value);
+                    TRY(serialize(copied_value));
                 }
             }
 
@@ -420,11 +424,9 @@ public:
                         auto input_value = TRY(value.as_object().internal_get(property_key, value));
 
                         // 2. Let outputValue be ? StructuredSerializeInternal(inputValue, forStorage, memory).
-                        auto output_value = TRY(structured_serialize_internal(m_vm, input_value, m_for_storage, m_memory));
-
                         // 3. Append { [[Key]]: key, [[Value]]: outputValue } to serialized.[[Properties]].
                         TRY(serialize_string(m_vm, m_serialized, key.as_string()));
-                        m_serialized.extend(output_value);
+                        TRY(serialize(input_value));
 
                         property_count++;
                     }
@@ -434,14 +436,13 @@ public:
         }
 
         // 27. Return serialized.
-        return m_serialized;
+        return {};
     }
 
 private:
     JS::VM& m_vm;
+    SerializationRecord& m_serialized;
     SerializationMemory& m_memory; // JS value -> index
-    u32 m_next_id { 0 };
-    SerializationRecord m_serialized;
     bool m_for_storage { false };
 };
 
@@ -526,19 +527,14 @@ WebIDL::ExceptionOr<void> serialize_bytes(JS::VM& vm, Vector<u32>& vector, Reado
     // Append size of the buffer to the serialized structure.
     u64 const size = bytes.size();
     serialize_primitive_type(vector, size);
-    // Append the bytes of the buffer to the serialized structure.
-    u64 byte_position = 0;
-    while (byte_position < size) {
-        u32 combined_value = 0;
-        for (u8 i = 0; i < 4; ++i) {
-            u8 const byte = bytes[byte_position];
-            combined_value |= byte << (i * 8);
-            byte_position++;
-            if (byte_position == size)
-                break;
-        }
-        TRY_OR_THROW_OOM(vm, vector.try_append(combined_value));
-    }
+    if (size == 0)
+        return {};
+
+    // Append the bytes of the buffer to the serialized structure, packed into as few u32s as possible.
+    auto offset = vector.size();
+    TRY_OR_THROW_OOM(vm, vector.try_resize(offset + ceil_div(size, sizeof(u32))));
+    vector.last() = 0;
+    memcpy(vector.data() + offset, bytes.data(), size);
     return {};
 }
 
@@ -588,14 +584,11 @@ WebIDL::ExceptionOr<void> serialize_array_buffer(JS::VM& vm, Vector<u32>& vector
             return WebIDL::DataCloneError::create(*vm.current_realm(), "Cannot serialize detached ArrayBuffer"_fly_string);
 
         // 2. Let size be value.[[ArrayBufferByteLength]].
-        auto size = array_buffer.byte_length();
-
         // 3. Let dataCopy be ? CreateByteDataBlock(size).
         //    NOTE: This can throw a RangeError exception upon allocation failure.
-        auto data_copy = TRY(JS::create_byte_data_block(vm, size));
-
         // 4. Perform CopyDataBlockBytes(dataCopy, 0, value.[[ArrayBufferData]], 0, size).
-        JS::copy_data_block_bytes(data_copy.buffer(), 0, array_buffer.buffer(), 0, size);
+        // IMPLEMENTATION DEFINED: The bytes are copied straight into the serialized record below, which is what dataCopy
+        //                         would end up in anyway.
 
         // FIXME: 5. If value has an [[ArrayBufferMaxByteLength]] internal slot, then set serialized to { [[Type]]: "ResizableArrayBuffer",
         //    [[ArrayBufferData]]: dataCopy, [[ArrayBufferByteLength]]: size, [[ArrayBufferMaxByteLength]]: value.[[ArrayBufferMaxByteLength]] }.
@@ -604,7 +597,7 @@ WebIDL::ExceptionOr<void> serialize_array_buffer(JS::VM& vm, Vector<u32>& vector
         // 6. Otherwise, set serialized to { [[Type]]: "ArrayBuffer", [[ArrayBufferData]]: dataCopy, [[ArrayBufferByteLength]]: size }.
         else {
             serialize_enum(vector, ValueTag::ArrayBuffer);
-            TRY(serialize_bytes(vm, vector, data_copy.buffer().bytes()));
+            TRY(serialize_bytes(vm, vector, array_buffer.buffer().bytes()));
         }
     }
     return {};
@@ -635,18 +628,20 @@ WebIDL::ExceptionOr<void> serialize_viewed_array_buffer(JS::VM& vm, Vector<u32>&
     // 2. Let buffer be the value of value's [[ViewedArrayBuffer]] internal slot.
     auto* buffer = view.viewed_array_buffer();
 
+    // NOTE: The buffer is serialized right after the tag of the view, so that it goes straight into the record.
+    serialize_enum(vector, ValueTag::ArrayBufferView);
+    auto buffer_position = vector.size();
+
     // 3. Let bufferSerialized be ? StructuredSerializeInternal(buffer, forStorage, memory).
-    auto buffer_serialized = TRY(structured_serialize_internal(vm, JS::Value(buffer), for_storage, memory));
+    TRY(structured_serialize_internal(vm, vector, JS::Value(buffer), for_storage, memory)); // [[ArrayBufferSerialized]]
 
     // 4. Assert: bufferSerialized.[[Type]] is "ArrayBuffer", "ResizableArrayBuffer", "SharedArrayBuffer", or "GrowableSharedArrayBuffer".
-    // NOTE: We currently only implement this for ArrayBuffer
-    VERIFY(buffer_serialized[0] == ValueTag::ArrayBuffer);
+    // NOTE: We currently only implement this for ArrayBuffer. The buffer is a reference if it was serialized or transferred before.
+    VERIFY(vector[buffer_position] == ValueTag::ArrayBuffer || vector[buffer_position] == ValueTag::ObjectReference);
 
     // 5. If value has a [[DataView]] internal slot, then set serialized to { [[Type]]: "ArrayBufferView", [[Constructor]]: "DataView",
     //    [[ArrayBufferSerialized]]: bufferSerialized, [[ByteLength]]: value.[[ByteLength]], [[ByteOffset]]: value.[[ByteOffset]] }.
     if constexpr (IsSame<ViewType, JS::DataView>) {
-        serialize_enum(vector, ValueTag::ArrayBufferView);
-        vector.extend(move(buffer_serialized));               // [[ArrayBufferSerialized]]
         TRY(serialize_string(vm, vector, "DataView"_string)); // [[Constructor]]
         serialize_primitive_type(vector, JS::get_view_byte_length(view_record));
         serialize_primitive_type(vector, view.byte_offset());
@@ -659,8 +654,6 @@ WebIDL::ExceptionOr<void> serialize_viewed_array_buffer(JS::VM& vm, Vector<u32>&
         // 2. Set serialized to { [[Type]]: "ArrayBufferView", [[Constructor]]: value.[[TypedArrayName]],
         //    [[ArrayBufferSerialized]]: bufferSerialized, [[ByteLength]]: value.[[ByteLength]],
         //    [[ByteOffset]]: value.[[ByteOffset]], [[ArrayLength]]: value.[[ArrayLength]] }.
-        serialize_enum(vector, ValueTag::ArrayBufferView);
-        vector.extend(move(buffer_serialized));                 // [[ArrayBufferSerialized]]
         TRY(serialize_string(vm, vector, view.element_name())); // [[Constructor]]
         serialize_primitive_type(vector, JS::typed_array_byte_length(view_record));
         serialize_primitive_type(vector, view.byte_offset());
@@ -692,9 +685,6 @@ public:
         // 2. If memory[serialized] exists, then return memory[serialized].
         if (tag == ValueTag::ObjectReference) {
             auto index = m_serialized[m_position++];
-            if (index == NumericLimits<u32>::max()) {
-                return JS::Object::create(*m_vm.current_realm(), nullptr);
-            }
             return m_memory[index];
         }
 
@@ -973,7 +963,7 @@ public:
 private:
     JS::VM& m_vm;
     ReadonlySpan<u32> m_serialized;
-    JS::MarkedVector<JS::Value> m_memory; // Index -> JS value
+    DeserializationMemory& m_memory; // Index -> JS value
     size_t m_position { 0 };
 
     static WebIDL::ExceptionOr<JS::NonnullGCPtr<Bindings::PlatformObject>> create_serialized_type(StringView interface_name, JS::Realm& realm)
@@ -1064,16 +1054,12 @@ WebIDL::ExceptionOr<ByteBuffer> deserialize_bytes(JS::VM& vm, ReadonlySpan<u32>
 {
     u64 const size = deserialize_primitive_type<u64>(vector, position);
 
+    auto size_in_u32s = ceil_div(size, sizeof(u32));
+    VERIFY(position + size_in_u32s <= vector.size());
+
     auto bytes = TRY_OR_THROW_OOM(vm, ByteBuffer::create_uninitialized(size));
-    u64 byte_position = 0;
-    while (position < vector.size() && byte_position < size) {
-        for (u8 i = 0; i < 4; ++i) {
-            bytes[byte_position++] = (vector[position] >> (i * 8) & 0xFF);
-            if (byte_position == size)
-                break;
-        }
-        position++;
-    }
+    memcpy(bytes.data(), vector.offset_pointer(position), size);
+    position += size_in_u32s;
     return bytes;
 }
 
@@ -1102,6 +1088,45 @@ WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::BigInt>> deserialize_big_int_primitive(
     return JS::BigInt::create(vm, bigint);
 }
 
+// NOTE: The data of a transferred ArrayBuffer is copied into shared memory, which is sent as a file descriptor rather
+//       than as part of the serialized message. The receiver copies it out again, as an ArrayBuffer's data block is
+//       a plain ByteBuffer that cannot adopt the mapping. Unlike an ImageBitmap, its memory is not handed over.
+static WebIDL::ExceptionOr<void> transfer_array_buffer_data(JS::VM& vm, TransferDataHolder& data_holder, JS::ArrayBuffer const& array_buffer)
+{
+    u64 byte_length = array_buffer.byte_length();
+    append_to_transfer_data_holder(data_holder, byte_length);
+    if (byte_length == 0)
+        return {};
+
+    auto buffer = Core::AnonymousBuffer::create_with_size(byte_length);
+    if (buffer.is_error())
+        return WebIDL::DataCloneError::create(*vm.current_realm(), MUST(String::formatted("Cannot transfer ArrayBuffer: {}", buffer.error())));
+    memcpy(buffer.value().data<void>(), array_buffer.buffer().data(), byte_length);
+
+    auto file = IPC::File::clone_fd(buffer.value().fd());
+    if (file.is_error())
+        return WebIDL::DataCloneError::create(*vm.current_realm(), MUST(String::formatted("Cannot transfer ArrayBuffer: {}", file.error())));
+    data_holder.fds.append(file.release_value());
+    return {};
+}
+
+static WebIDL::ExceptionOr<ByteBuffer> receive_array_buffer_data(JS::Realm& realm, TransferDataHolder& data_holder)
+{
+    auto byte_length = take_from_transfer_data_holder<u64>(data_holder);
+
+    auto data = ByteBuffer::create_uninitialized(byte_length);
+    if (data.is_error())
+        return WebIDL::DataCloneError::create(realm, "out of memory"_fly_string);
+    if (byte_length == 0)
+        return data.release_value();
+
+    auto buffer = Core::AnonymousBuffer::create_from_anon_fd(data_holder.fds.take_first().take_fd(), byte_length);
+    if (buffer.is_error())
+        return WebIDL::DataCloneError::create(realm, MUST(String::formatted("Cannot receive ArrayBuffer: {}", buffer.error())));
+    memcpy(data.value().data(), buffer.value().data<void>(), byte_length);
+    return data.release_value();
+}
+
 // https://html.spec.whatwg.org/multipage/structured-data.html#structuredserializewithtransfer
 WebIDL::ExceptionOr<SerializedTransferRecord> structured_serialize_with_transfer(JS::VM& vm, JS::Value value, Vector<JS::Handle<JS::Object>> const& transfer_list)
 {
@@ -1112,12 +1137,14 @@ WebIDL::ExceptionOr<SerializedTransferRecord> structured_serialize_with_transfer
     for (auto const& transferable : transfer_list) {
 
         // 1. If transferable has neither an [[ArrayBufferData]] internal slot nor a [[Detached]] internal slot, then throw a "DataCloneError" DOMException.
-        // FIXME: Handle transferring ArrayBufferData objects
-        if (!is<Bindings::Transferable>(*transferable)) {
+        if (!is<JS::ArrayBuffer>(*transferable) && !is<Bindings::Transferable>(*transferable)) {
             return WebIDL::DataCloneError::create(*vm.current_realm(), "Cannot transfer type"_fly_string);
         }
 
-        // FIXME: 2. If transferable has an [[ArrayBufferData]] internal slot and IsSharedArrayBuffer(transferable) is true, then throw a "DataCloneError" DOMException.
+        // 2. If transferable has an [[ArrayBufferData]] internal slot and IsSharedArrayBuffer(transferable) is true, then throw a "DataCloneError" DOMException.
+        if (is<JS::ArrayBuffer>(*transferable) && static_cast<JS::ArrayBuffer const&>(*transferable).is_shared_array_buffer()) {
+            return WebIDL::DataCloneError::create(*vm.current_realm(), "Cannot transfer shared array buffer"_fly_string);
+        }
 
         // 3. If memory[transferable] exists, then throw a "DataCloneError" DOMException.
         auto transferable_value = JS::Value(transferable);
@@ -1126,7 +1153,9 @@ WebIDL::ExceptionOr<SerializedTransferRecord> structured_serialize_with_transfer
         }
 
         // 4. Set memory[transferable] to { [[Type]]: an uninitialized value }.
-        memory.set(JS::make_handle(transferable_value), NumericLimits<u32>::max());
+        // NOTE: Transferred values are numbered by their position in transferList, which is where deserialization puts them in its memory.
+        auto id = static_cast<u32>(memory.size());
+        memory.set(JS::make_handle(transferable_value), id);
     }
 
     // 3. Let serialized be ? StructuredSerializeInternal(value, false, memory).
@@ -1138,7 +1167,10 @@ WebIDL::ExceptionOr<SerializedTransferRecord> structured_serialize_with_transfer
 
     // 5. For each transferable of transferList:
     for (auto& transferable : transfer_list) {
-        // 1. FIXME: If transferable has an [[ArrayBufferData]] internal slot and IsDetachedBuffer(transferable) is true, then throw a "DataCloneError" DOMException.
+        // 1. If transferable has an [[ArrayBufferData]] internal slot and IsDetachedBuffer(transferable) is true, then throw a "DataCloneError" DOMException.
+        if (is<JS::ArrayBuffer>(*transferable) && static_cast<JS::ArrayBuffer const&>(*transferable).is_detached()) {
+            return WebIDL::DataCloneError::create(*vm.current_realm(), "Cannot transfer detached buffer"_fly_string);
+        }
 
         // 2. If transferable has a [[Detached]] internal slot and transferable.[[Detached]] is true, then throw a "DataCloneError" DOMException.
         if (is<Bindings::Transferable>(*transferable)) {
@@ -1152,8 +1184,36 @@ WebIDL::ExceptionOr<SerializedTransferRecord> structured_serialize_with_transfer
         // IMPLEMENTATION DEFINED: We just create a data holder here, our memory holds indices into the SerializationRecord
         TransferDataHolder data_holder;
 
-        // FIXME 4. If transferable has an [[ArrayBufferData]] internal slot, then:
-        if (false) {
+        // 4. If transferable has an [[ArrayBufferData]] internal slot, then:
+        if (is<JS::ArrayBuffer>(*transferable)) {
+            auto& array_buffer = static_cast<JS::ArrayBuffer&>(*transferable);
+
+            // 1. If transferable has an [[ArrayBufferMaxByteLength]] internal slot, then:
+            if (!array_buffer.is_fixed_length()) {
+                // 1. Set dataHolder.[[Type]] to "ResizableArrayBuffer".
+                append_to_transfer_data_holder(data_holder, TransferType::ResizableArrayBuffer);
+
+                // 2. Set dataHolder.[[ArrayBufferData]] to transferable.[[ArrayBufferData]].
+                // 3. Set dataHolder.[[ArrayBufferByteLength]] to transferable.[[ArrayBufferByteLength]].
+                TRY(transfer_array_buffer_data(vm, data_holder, array_buffer));
+
+                // 4. Set dataHolder.[[ArrayBufferMaxByteLength]] to transferable.[[ArrayBufferMaxByteLength]].
+                append_to_transfer_data_holder(data_holder, static_cast<u64>(array_buffer.max_byte_length()));
+            }
+
+            // 2. Otherwise:
+            else {
+                // 1. Set dataHolder.[[Type]] to "ArrayBuffer".
+                append_to_transfer_data_holder(data_holder, TransferType::ArrayBuffer);
+
+                // 2. Set dataHolder.[[ArrayBufferData]] to transferable.[[ArrayBufferData]].
+                // 3. Set dataHolder.[[ArrayBufferByteLength]] to transferable.[[ArrayBufferByteLength]].
+                TRY(transfer_array_buffer_data(vm, data_holder, array_buffer));
+            }
+
+            // 3. Perform ? DetachArrayBuffer(transferable).
+            // NOTE: Specifications can use the [[ArrayBufferDetachKey]] internal slot to prevent ArrayBuffers from being detached. This is used in WebAssembly JS API for example.
+            TRY(JS::detach_array_buffer(vm, array_buffer));
         }
 
         // 5. Otherwise:
@@ -1166,7 +1226,7 @@ WebIDL::ExceptionOr<SerializedTransferRecord> structured_serialize_with_transfer
             auto interface_name = transferable_object.primary_interface();
 
             // 3. Set dataHolder.[[Type]] to interfaceName.
-            data_holder.data.append(to_underlying(interface_name));
+            append_to_transfer_data_holder(data_holder, interface_name);
 
             // 4. Perform the appropriate transfer steps for the interface identified by interfaceName, given transferable and dataHolder.
             TRY(transferable_object.transfer_steps(data_holder));
@@ -1189,7 +1249,8 @@ static bool is_interface_exposed_on_target_realm(u8 name, JS::Realm& realm)
     switch (static_cast<TransferType>(name)) {
     case TransferType::MessagePort:
         return intrinsics.is_exposed("MessagePort"sv);
-        break;
+    case TransferType::ImageBitmap:
+        return intrinsics.is_exposed("ImageBitmap"sv);
     default:
         dbgln("Unknown interface type for transfer: {}", name);
         break;
@@ -1205,6 +1266,14 @@ static WebIDL::ExceptionOr<JS::NonnullGCPtr<Bindings::PlatformObject>> create_tr
         TRY(message_port->transfer_receiving_steps(transfer_data_holder));
         return message_port;
     }
+    case TransferType::ImageBitmap: {
+        auto image_bitmap = HTML::ImageBitmap::create(target_realm);
+        TRY(image_bitmap->transfer_receiving_steps(transfer_data_holder));
+        return image_bitmap;
+    }
+    case TransferType::ArrayBuffer:
+    case TransferType::ResizableArrayBuffer:
+        break;
     }
     VERIFY_NOT_REACHED();
 }
@@ -1225,36 +1294,42 @@ WebIDL::ExceptionOr<DeserializedTransferRecord> structured_deserialize_with_tran
         // 1. Let value be an uninitialized value.
         JS::Value value;
 
-        // FIXME: 2. If transferDataHolder.[[Type]] is "ArrayBuffer", then set value to a new ArrayBuffer object in targetRealm
+        auto type = take_from_transfer_data_holder<TransferType>(transfer_data_holder);
+
+        // 2. If transferDataHolder.[[Type]] is "ArrayBuffer", then set value to a new ArrayBuffer object in targetRealm
         //    whose [[ArrayBufferData]] internal slot value is transferDataHolder.[[ArrayBufferData]], and
         //    whose [[ArrayBufferByteLength]] internal slot value is transferDataHolder.[[ArrayBufferByteLength]].
         // NOTE: In cases where the original memory occupied by [[ArrayBufferData]] is accessible during the deserialization,
         //       this step is unlikely to throw an exception, as no new memory needs to be allocated: the memory occupied by
         //       [[ArrayBufferData]] is instead just getting transferred into the new ArrayBuffer. This could be true, for example,
         //       when both the source and target realms are in the same process.
-        if (false) {
+        if (type == TransferType::ArrayBuffer) {
+            value = JS::ArrayBuffer::create(target_realm, TRY(receive_array_buffer_data(target_realm, transfer_data_holder)));
         }
 
-        // FIXME: 3. Otherwise, if transferDataHolder.[[Type]] is "ResizableArrayBuffer", then set value to a new ArrayBuffer object
+        // 3. Otherwise, if transferDataHolder.[[Type]] is "ResizableArrayBuffer", then set value to a new ArrayBuffer object
         //     in targetRealm whose [[ArrayBufferData]] internal slot value is transferDataHolder.[[ArrayBufferData]], whose
         //     [[ArrayBufferByteLength]] internal slot value is transferDataHolder.[[ArrayBufferByteLength]], and whose
         //     [[ArrayBufferMaxByteLength]] internal slot value is transferDataHolder.[[ArrayBufferMaxByteLength]].
         // NOTE: For the same reason as the previous step, this step is also unlikely to throw an exception.
-        else if (false) {
+        else if (type == TransferType::ResizableArrayBuffer) {
+            auto array_buffer = JS::ArrayBuffer::create(target_realm, TRY(receive_array_buffer_data(target_realm, transfer_data_holder)));
+            array_buffer->set_max_byte_length(take_from_transfer_data_holder<u64>(transfer_data_holder));
+            value = array_buffer;
         }
 
         // 4. Otherwise:
         else {
             // 1. Let interfaceName be transferDataHolder.[[Type]].
-            u8 const interface_name = transfer_data_holder.data.take_first();
+            auto interface_name = type;
 
             // 2. If the interface identified by interfaceName is not exposed in targetRealm, then throw a "DataCloneError" DOMException.
-            if (!is_interface_exposed_on_target_realm(interface_name, target_realm))
+            if (!is_interface_exposed_on_target_realm(to_underlying(interface_name), target_realm))
                 return WebIDL::DataCloneError::create(target_realm, "Unknown type transferred"_fly_string);
 
             // 3. Set value to a new instance of the interface identified by interfaceName, created in targetRealm.
             // 4. Perform the appropriate transfer-receiving steps for the interface identified by interfaceName given transferDataHolder and value.
-            value = TRY(create_transferred_value(static_cast<TransferType>(interface_name), target_realm, transfer_data_holder));
+            value = TRY(create_transferred_value(interface_name, target_realm, transfer_data_holder));
         }
 
         // 5. Set memory[transferDataHolder] to value.
@@ -1293,7 +1368,15 @@ WebIDL::ExceptionOr<SerializationRecord> structured_serialize_internal(JS::VM& v
     // 1. If memory was not supplied, let memory be an empty map.
     // IMPLEMENTATION DEFINED: We move this requirement up to the callers to make recursion easier
 
-    Serializer serializer(vm, memory, for_storage);
+    SerializationRecord serialized;
+    TRY(structured_serialize_internal(vm, serialized, value, for_storage, memory));
+    return serialized;
+}
+
+// NOTE: This appends the serialization of value to serialized, which saves copying the record of every nested value.
+WebIDL::ExceptionOr<void> structured_serialize_internal(JS::VM& vm, SerializationRecord& serialized, JS::Value value, bool for_storage, SerializationMemory& memory)
+{
+    Serializer serializer(vm, serialized, memory, for_storage);
     return serializer.serialize(value);
 }
 
@@ -1329,10 +1412,30 @@ WebIDL::ExceptionOr<DeserializedRecord> structured_deserialize_internal(JS::VM&
 
 namespace IPC {
 
+// NOTE: Records can be large, so they are copied into and out of messages in bulk rather than one element at a time.
+template<typename T>
+static ErrorOr<void> encode_vector_in_bulk(Encoder& encoder, Vector<T> const& vector)
+{
+    TRY(encoder.encode_size(vector.size()));
+    TRY(encoder.append(reinterpret_cast<u8 const*>(vector.data()), vector.size() * sizeof(T)));
+    return {};
+}
+
+template<typename T>
+static ErrorOr<Vector<T>> decode_vector_in_bulk(Decoder& decoder)
+{
+    auto size = TRY(decoder.decode_size());
+
+    Vector<T> vector;
+    TRY(vector.try_resize(size));
+    TRY(decoder.decode_into({ reinterpret_cast<u8*>(vector.data()), size * sizeof(T) }));
+    return vector;
+}
+
 template<>
 ErrorOr<void> encode(Encoder& encoder, ::Web::HTML::TransferDataHolder const& data_holder)
 {
-    TRY(encoder.encode(data_holder.data));
+    TRY(encode_vector_in_bulk(encoder, data_holder.data));
     TRY(encoder.encode(data_holder.fds));
     return {};
 }
@@ -1340,7 +1443,7 @@ ErrorOr<void> encode(Encoder& encoder, ::Web::HTML::TransferDataHolder const& da
 template<>
 ErrorOr<void> encode(Encoder& encoder, ::Web::HTML::SerializedTransferRecord const& record)
 {
-    TRY(encoder.encode(record.serialized));
+    TRY(encode_vector_in_bulk(encoder, record.serialized));
     TRY(encoder.encode(record.transfer_data_holders));
     return {};
 }
@@ -1348,7 +1451,7 @@ ErrorOr<void> encode(Encoder& encoder, ::Web::HTML::SerializedTransferRecord con
 template<>
 ErrorOr<::Web::HTML::TransferDataHolder> decode(Decoder& decoder)
 {
-    auto data = TRY(decoder.decode<Vector<u8>>());
+    auto data = TRY(decode_vector_in_bulk<u8>(decoder));
     auto fds = TRY(decoder.decode<Vector<IPC::File>>());
     return ::Web::HTML::TransferDataHolder { move(data), move(fds) };
 }
@@ -1356,7 +1459,7 @@ ErrorOr<::Web::HTML::TransferDataHolder> decode(Decoder& decoder)
 template<>
 ErrorOr<::Web::HTML::SerializedTransferRecord> decode(Decoder& decoder)
 {
-    auto serialized = TRY(decoder.decode<Vector<u32>>());
+    auto serialized = TRY(decode_vector_in_bulk<u32>(decoder));
     auto transfer_data_holders = TRY(decoder.decode<Vector<::Web::HTML::TransferDataHolder>>());
     return ::Web::HTML::SerializedTransferRecord { move(serialized), move(transfer_data_holders) };
 }
@@ -48,11 +48,15 @@ struct DeserializedRecord {
 
 enum class TransferType : u8 {
     MessagePort,
+    ArrayBuffer,
+    ResizableArrayBuffer,
+    ImageBitmap,
 };
 
 WebIDL::ExceptionOr<SerializationRecord> structured_serialize(JS::VM& vm, JS::Value);
 WebIDL::ExceptionOr<SerializationRecord> structured_serialize_for_storage(JS::VM& vm, JS::Value);
 WebIDL::ExceptionOr<SerializationRecord> structured_serialize_internal(JS::VM& vm, JS::Value, bool for_storage, SerializationMemory&);
+WebIDL::ExceptionOr<void> structured_serialize_internal(JS::VM& vm, SerializationRecord& serialized, JS::Value, bool for_storage, SerializationMemory&);
 
 WebIDL::ExceptionOr<JS::Value> structured_deserialize(JS::VM& vm, SerializationRecord const& serialized, JS::Realm& target_realm, Optional<DeserializationMemory>);
 WebIDL::ExceptionOr<DeserializedRecord> structured_deserialize_internal(JS::VM& vm, ReadonlySpan<u32> const& serialized, JS::Realm& target_realm, DeserializationMemory& memory, Optional<size_t> position = {});
@@ -87,6 +91,24 @@ void serialize_enum(SerializationRecord& serialized, T value)
     serialize_primitive_type<UnderlyingType<T>>(serialized, to_underlying(value));
 }
 
+template<typename T>
+requires(IsIntegral<T> || IsEnum<T>)
+void append_to_transfer_data_holder(TransferDataHolder& data_holder, T value)
+{
+    data_holder.data.append(bit_cast<u8 const*>(&value), sizeof(T));
+}
+
+template<typename T>
+requires(IsIntegral<T> || IsEnum<T>)
+T take_from_transfer_data_holder(TransferDataHolder& data_holder)
+{
+    T value;
+    VERIFY(data_holder.data.size() >= sizeof(value));
+    memcpy(&value, data_holder.data.data(), sizeof(value));
+    data_holder.data.remove(0, sizeof(value));
+    return value;
+}
+
 WebIDL::ExceptionOr<void> serialize_bytes(JS::VM& vm, Vector<u32>& vector, ReadonlyBytes bytes);
 WebIDL::ExceptionOr<void> serialize_string(JS::VM& vm, Vector<u32>& vector, DeprecatedFlyString const& string);
 WebIDL::ExceptionOr<void> serialize_string(JS::VM& vm, Vector<u32>& vector, String const& string);
@@ -5,14 +5,26 @@
  */
 
 #include <LibCore/Timer.h>
+#include <LibJS/Heap/MarkedVector.h>
 #include <LibJS/Runtime/Object.h>
+#include <LibWeb/Bindings/PlatformObject.h>
 #include <LibWeb/HTML/Timer.h>
 #include <LibWeb/HTML/Window.h>
+#include <LibWeb/HTML/WindowOrWorkerGlobalScope.h>
 
 namespace Web::HTML {
 
 JS_DEFINE_ALLOCATOR(Timer);
 
+// Wakeups are aligned to multiples of this interval, so timers that become due close to each other share a wakeup instead of
+// waking us up again right after. As we never wake up before the earliest timer is due, this only ever delays timers.
+static constexpr i64 timer_alignment_ms = 4;
+
+// While throttled, wakeups are aligned to this interval, so every timer of a background page fires in at most one batch per interval.
+static constexpr i64 throttled_timer_alignment_ms = 1000;
+
+static u64 s_next_timer_sequence_number = 0;
+
 JS::NonnullGCPtr<Timer> Timer::create(JS::Object& window_or_worker_global_scope, i32 milliseconds, Function<void()> callback, i32 id)
 {
     auto heap_function_callback = JS::create_heap_function(window_or_worker_global_scope.heap(), move(callback));
@@ -23,10 +35,9 @@ Timer::Timer(JS::Object& window_or_worker_global_scope, i32 milliseconds, JS::No
     : m_window_or_worker_global_scope(window_or_worker_global_scope)
     , m_callback(move(callback))
     , m_id(id)
+    , m_fire_time(MonotonicTime::now() + Duration::from_milliseconds(max(milliseconds, 0)))
+    , m_sequence_number(s_next_timer_sequence_number++)
 {
-    m_timer = Core::Timer::create_single_shot(milliseconds, [this] {
-        m_callback->function()();
-    });
 }
 
 void Timer::visit_edges(Cell::Visitor& visitor)
@@ -38,17 +49,104 @@ void Timer::visit_edges(Cell::Visitor& visitor)
 
 Timer::~Timer()
 {
-    VERIFY(!m_timer->is_active());
+    VERIFY(!is_scheduled());
+}
+
+void Timer::fire(Badge<TimerHeap>)
+{
+    m_callback->function()();
+}
+
+TimerHeap::TimerHeap(WindowOrWorkerGlobalScopeMixin& global)
+    : m_global(global)
+{
+}
+
+TimerHeap::~TimerHeap()
+{
+    clear();
+}
+
+void TimerHeap::schedule(Timer& timer)
+{
+    VERIFY(!timer.is_scheduled());
+    m_heap.insert(&timer);
+
+    // The wakeup only needs to move if the new timer is now the first one due.
+    if (timer.index_in_heap({}) == 0)
+        update_wakeup();
+}
+
+void TimerHeap::unschedule(Timer& timer)
+{
+    if (!timer.is_scheduled())
+        return;
+    auto* removed_timer = m_heap.pop(timer.index_in_heap({}));
+    removed_timer->set_index_in_heap({}, Timer::INVALID_INDEX);
+
+    // NOTE: A wakeup for a timer that is no longer there is harmless, so we only stop the platform timer when we run out of timers.
+    if (m_heap.is_empty() && m_wakeup_timer)
+        m_wakeup_timer->stop();
 }
 
-void Timer::start()
+void TimerHeap::clear()
 {
-    m_timer->start();
+    for (auto* timer : m_heap.nodes_in_arbitrary_order())
+        timer->set_index_in_heap({}, Timer::INVALID_INDEX);
+    m_heap.clear();
+    if (m_wakeup_timer)
+        m_wakeup_timer->stop();
 }
 
-void Timer::stop()
+void TimerHeap::update_wakeup()
 {
-    m_timer->stop();
+    if (m_heap.is_empty() || m_global.should_freeze_timers()) {
+        if (m_wakeup_timer)
+            m_wakeup_timer->stop();
+        return;
+    }
+
+    auto now = MonotonicTime::now();
+    auto wakeup_time = m_heap.peek_min()->fire_time();
+
+    // NOTE: The wakeup is moved forward to the next aligned deadline, which every global shares. Timers that are due by
+    //       then fire together, and all of them are due by the time we wake up.
+    auto alignment_ms = m_global.should_throttle_timers() ? throttled_timer_alignment_ms : timer_alignment_ms;
+    auto nanoseconds = wakeup_time.nanoseconds();
+    auto alignment_ns = alignment_ms * 1'000'000;
+    auto aligned_nanoseconds = ceil_div(nanoseconds, alignment_ns) * alignment_ns;
+    wakeup_time += Duration::from_nanoseconds(aligned_nanoseconds - nanoseconds);
+
+    // NOTE: The delay is rounded up to whole milliseconds, so we never wake up before the earliest timer is due.
+    i64 delay_ms = 0;
+    if (wakeup_time > now)
+        delay_ms = ceil_div((wakeup_time - now).to_nanoseconds(), static_cast<i64>(1'000'000));
+
+    if (!m_wakeup_timer)
+        m_wakeup_timer = Core::Timer::create_single_shot(0, [this] { fire_due_timers(); });
+    m_wakeup_timer->restart(static_cast<int>(min(delay_ms, static_cast<i64>(NumericLimits<int>::max()))));
+}
+
+void TimerHeap::fire_due_timers()
+{
+    // NOTE: Timers must never fire before their timeout has elapsed, so only the ones that are due by now are fired.
+    //       Coalescing comes from update_wakeup() delaying the wakeup to an aligned deadline instead. Since everything in
+    //       this batch is already due, a timer scheduled by one of its callbacks can't be due before any of them.
+    auto now = MonotonicTime::now();
+
+    // NOTE: We take every due timer out of the heap before firing any of them, as the completion steps may schedule or
+    //       unschedule timers.
+    JS::MarkedVector<JS::NonnullGCPtr<Timer>> due_timers(m_global.this_impl().heap());
+    while (!m_heap.is_empty() && m_heap.peek_min()->fire_time() <= now) {
+        auto* timer = m_heap.pop_min();
+        timer->set_index_in_heap({}, Timer::INVALID_INDEX);
+        due_timers.append(*timer);
+    }
+
+    for (auto& timer : due_timers)
+        timer->fire({});
+
+    update_wakeup();
 }
 
 }
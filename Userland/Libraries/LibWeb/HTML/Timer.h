@@ -6,9 +6,12 @@
 
 #pragma once
 
+#include <AK/Badge.h>
+#include <AK/BinaryHeap.h>
 #include <AK/Forward.h>
 #include <AK/Function.h>
-#include <AK/WeakPtr.h>
+#include <AK/Noncopyable.h>
+#include <AK/Time.h>
 #include <LibCore/Forward.h>
 #include <LibJS/Heap/Cell.h>
 #include <LibJS/Heap/GCPtr.h>
@@ -17,6 +20,9 @@
 
 namespace Web::HTML {
 
+class TimerHeap;
+class WindowOrWorkerGlobalScopeMixin;
+
 class Timer final : public JS::Cell {
     JS_CELL(Timer, JS::Cell);
     JS_DECLARE_ALLOCATOR(Timer);
@@ -25,18 +31,68 @@ public:
     static JS::NonnullGCPtr<Timer> create(JS::Object&, i32 milliseconds, Function<void()> callback, i32 id);
     virtual ~Timer() override;
 
-    void start();
-    void stop();
+    MonotonicTime fire_time() const { return m_fire_time; }
+    u64 sequence_number() const { return m_sequence_number; }
+
+    static constexpr ssize_t INVALID_INDEX = -1;
+    bool is_scheduled() const { return m_index_in_heap != INVALID_INDEX; }
+    ssize_t index_in_heap(Badge<TimerHeap>) const { return m_index_in_heap; }
+    void set_index_in_heap(Badge<TimerHeap>, ssize_t index) { m_index_in_heap = index; }
+
+    void fire(Badge<TimerHeap>);
 
 private:
     Timer(JS::Object& window, i32 milliseconds, JS::NonnullGCPtr<JS::HeapFunction<void()>> callback, i32 id);
 
     virtual void visit_edges(Cell::Visitor&) override;
 
-    RefPtr<Core::Timer> m_timer;
     JS::NonnullGCPtr<JS::Object> m_window_or_worker_global_scope;
     JS::NonnullGCPtr<JS::HeapFunction<void()>> m_callback;
     i32 m_id { 0 };
+
+    MonotonicTime m_fire_time;
+
+    // Timers with the same fire time fire in the order they were created.
+    u64 m_sequence_number { 0 };
+
+    ssize_t m_index_in_heap { INVALID_INDEX };
+};
+
+// Keeps all of a global's pending timers in a min-heap ordered by fire time, and drives them with a single platform timer.
+class TimerHeap {
+    AK_MAKE_NONCOPYABLE(TimerHeap);
+    AK_MAKE_NONMOVABLE(TimerHeap);
+
+public:
+    explicit TimerHeap(WindowOrWorkerGlobalScopeMixin&);
+    ~TimerHeap();
+
+    void schedule(Timer&);
+    void unschedule(Timer&);
+    void clear();
+
+    // Must be called when the result of WindowOrWorkerGlobalScopeMixin::should_throttle_timers() or
+    // WindowOrWorkerGlobalScopeMixin::should_freeze_timers() may have changed.
+    void update_wakeup();
+
+private:
+    void fire_due_timers();
+
+    WindowOrWorkerGlobalScopeMixin& m_global;
+
+    IntrusiveBinaryHeap<
+        Timer*,
+        decltype([](Timer* a, Timer* b) {
+            if (a->fire_time() != b->fire_time())
+                return a->fire_time() < b->fire_time();
+            return a->sequence_number() < b->sequence_number();
+        }),
+        decltype([](Timer* timer, size_t index) {
+            timer->set_index_in_heap({}, static_cast<ssize_t>(index));
+        })>
+        m_heap;
+
+    RefPtr<Core::Timer> m_wakeup_timer;
 };
 
 }
@@ -4,7 +4,12 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
 #include <AK/QuickSort.h>
+#include <AK/ScopeGuard.h>
+#include <LibCore/ElapsedTimer.h>
+#include <LibCore/Timer.h>
+#include <LibCore/TraceEvent.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
 #include <LibWeb/CSS/SystemColor.h>
 #include <LibWeb/DOM/Document.h>
@@ -16,6 +21,7 @@
 #include <LibWeb/HTML/SessionHistoryEntry.h>
 #include <LibWeb/HTML/TraversableNavigable.h>
 #include <LibWeb/HTML/Window.h>
+#include <LibWeb/HighResolutionTime/TimeOrigin.h>
 #include <LibWeb/Page/Page.h>
 #include <LibWeb/Painting/DisplayListPlayerCPU.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
@@ -45,6 +51,7 @@ void TraversableNavigable::visit_edges(Cell::Visitor& visitor)
     Base::visit_edges(visitor);
     visitor.visit(m_session_history_entries);
     visitor.visit(m_session_history_traversal_queue);
+    visitor.visit(m_documents_in_back_forward_cache);
 }
 
 static OrderedHashTable<TraversableNavigable*>& user_agent_top_level_traversable_set()
@@ -885,6 +892,18 @@ Vector<JS::NonnullGCPtr<SessionHistoryEntry>> TraversableNavigable::get_session_
     return entries_for_navigation_api;
 }
 
+// How many unloaded documents a traversable keeps alive for instant back/forward traversal.
+static constexpr size_t max_documents_in_back_forward_cache = 4;
+
+static void evict_document_from_back_forward_cache(DOM::Document& document)
+{
+    // Traversing back to the document's entries will now fetch it again, just like for a document that was never cached.
+    // NOTE: The entry may have been given another document since, which must not be touched.
+    if (auto entry = document.latest_entry(); entry && entry->document_state()->document() == &document)
+        entry->document_state()->set_document(nullptr);
+    document.destroy();
+}
+
 // https://html.spec.whatwg.org/multipage/browsing-the-web.html#clear-the-forward-session-history
 void TraversableNavigable::clear_the_forward_session_history()
 {
@@ -914,6 +933,16 @@ void TraversableNavigable::clear_the_forward_session_history()
             }
         }
     }
+
+    // AD-HOC: Cached documents whose entries were all removed can never be traversed back to.
+    auto cached_documents = m_documents_in_back_forward_cache;
+    for (auto& document : cached_documents) {
+        auto has_entry = any_of(m_session_history_entries, [&](auto& entry) { return entry->document().ptr() == document.ptr(); });
+        if (!has_entry) {
+            remove_document_from_back_forward_cache(document);
+            evict_document_from_back_forward_cache(document);
+        }
+    }
 }
 
 bool TraversableNavigable::can_go_forward() const
@@ -1027,6 +1056,8 @@ void TraversableNavigable::close_top_level_traversable()
 
     // 3. Unload the active documents of each of toUnload.
     for (auto navigable : to_unload) {
+        // AD-HOC: The documents of a closing traversable can never be traversed back to, so don't keep them alive.
+        navigable->active_document()->set_salvageable(false);
         navigable->active_document()->unload();
     }
 
@@ -1042,6 +1073,9 @@ void TraversableNavigable::destroy_top_level_traversable()
     // 1. Let browsingContext be traversable's active browsing context.
     auto browsing_context = active_browsing_context();
 
+    // NOTE: The cached documents are destroyed along with the other history entries' documents below.
+    m_documents_in_back_forward_cache.clear();
+
     // 2. For each historyEntry in traversable's session history entries:
     for (auto& history_entry : m_session_history_entries) {
         // 1. Let document be historyEntry's document.
@@ -1121,6 +1155,13 @@ void finalize_a_same_document_navigation(JS::NonnullGCPtr<TraversableNavigable>
     traversable->apply_the_push_or_replace_history_step(*target_step, history_handling, TraversableNavigable::SynchronousNavigation::Yes);
 }
 
+// How long a traversable stays hidden before the timers of its documents are throttled.
+static constexpr int timer_throttling_grace_period_ms = 10'000;
+
+// How long a traversable stays hidden before it is frozen, and how often to try again while it can't be.
+static constexpr int freeze_delay_ms = 5 * 60'000;
+static constexpr int freeze_retry_interval_ms = 60'000;
+
 // https://html.spec.whatwg.org/multipage/interaction.html#system-visibility-state
 void TraversableNavigable::set_system_visibility_state(VisibilityState visibility_state)
 {
@@ -1128,6 +1169,19 @@ void TraversableNavigable::set_system_visibility_state(VisibilityState visibilit
         return;
     m_system_visibility_state = visibility_state;
 
+    // AD-HOC: Throttling only starts after a while, so that quickly switching between tabs doesn't throttle them.
+    //         Becoming visible lifts it right away, before the tasks below are queued.
+    if (visibility_state == VisibilityState::Hidden) {
+        if (!m_background_throttling_timer)
+            m_background_throttling_timer = Core::Timer::create_single_shot(0, [this] { advance_background_throttling(); });
+        m_background_throttling_timer->restart(timer_throttling_grace_period_ms);
+    } else {
+        if (m_background_throttling_timer)
+            m_background_throttling_timer->stop();
+        set_is_frozen(false);
+        set_is_throttling_timers(false);
+    }
+
     // When a user-agent determines that the system visibility state for
     // traversable navigable traversable has changed to newState, it must run the following steps:
 
@@ -1148,6 +1202,80 @@ void TraversableNavigable::set_system_visibility_state(VisibilityState visibilit
     }
 }
 
+void TraversableNavigable::advance_background_throttling()
+{
+    VERIFY(m_system_visibility_state == VisibilityState::Hidden);
+
+    if (!m_is_throttling_timers) {
+        set_is_throttling_timers(true);
+        m_background_throttling_timer->restart(freeze_delay_ms - timer_throttling_grace_period_ms);
+        return;
+    }
+
+    // A page that is playing media is still being listened to, so it keeps running.
+    if (page().has_playing_media_elements()) {
+        m_background_throttling_timer->restart(freeze_retry_interval_ms);
+        return;
+    }
+
+    set_is_frozen(true);
+}
+
+static void timer_throttling_may_have_changed(TraversableNavigable& traversable)
+{
+    auto document = traversable.active_document();
+    if (!document)
+        return;
+
+    for (auto& navigable : document->inclusive_descendant_navigables()) {
+        if (auto document = navigable->active_document(); document && document->window())
+            document->window()->timer_throttling_may_have_changed();
+    }
+}
+
+void TraversableNavigable::set_is_throttling_timers(bool is_throttling_timers)
+{
+    if (m_is_throttling_timers == is_throttling_timers)
+        return;
+    m_is_throttling_timers = is_throttling_timers;
+    timer_throttling_may_have_changed(*this);
+}
+
+void TraversableNavigable::set_is_frozen(bool is_frozen)
+{
+    if (m_is_frozen == is_frozen)
+        return;
+    m_is_frozen = is_frozen;
+    timer_throttling_may_have_changed(*this);
+
+    page().client().page_did_change_frozen_state(is_frozen);
+
+    // Tasks that were queued while we were frozen have become runnable, so make sure the event loop gets to them.
+    if (!is_frozen)
+        main_thread_event_loop().schedule();
+}
+
+void TraversableNavigable::store_document_in_back_forward_cache(DOM::Document& document)
+{
+    m_documents_in_back_forward_cache.remove_first_matching([&](auto& cached_document) { return cached_document.ptr() == &document; });
+    m_documents_in_back_forward_cache.append(document);
+
+    while (m_documents_in_back_forward_cache.size() > max_documents_in_back_forward_cache)
+        evict_document_from_back_forward_cache(m_documents_in_back_forward_cache.take_first());
+}
+
+void TraversableNavigable::remove_document_from_back_forward_cache(DOM::Document& document)
+{
+    m_documents_in_back_forward_cache.remove_first_matching([&](auto& cached_document) { return cached_document.ptr() == &document; });
+}
+
+void TraversableNavigable::clear_back_forward_cache()
+{
+    auto documents = move(m_documents_in_back_forward_cache);
+    for (auto& document : documents)
+        evict_document_from_back_forward_cache(document);
+}
+
 // https://html.spec.whatwg.org/multipage/interaction.html#currently-focused-area-of-a-top-level-traversable
 JS::GCPtr<DOM::Node> TraversableNavigable::currently_focused_area()
 {
@@ -1179,6 +1307,12 @@ JS::GCPtr<DOM::Node> TraversableNavigable::currently_focused_area()
 
 void TraversableNavigable::paint(DevicePixelRect const& content_rect, Painting::BackingStore& target, PaintOptions paint_options)
 {
+    // FIXME: Rasterize into fixed-size tiles cached across frames, so that scrolling only has to rasterize newly exposed
+    //        tiles. This needs a display list recorded for the whole document rather than just the viewport, reliable
+    //        damage rects to invalidate tiles with (see Navigable::set_needs_display()), and players that can target a
+    //        tile bitmap with an offset. Tiles could then be rasterized on worker threads.
+    TRACE_EVENT_SCOPE("paint"sv, "TraversableNavigable::paint"sv);
+
     Painting::DisplayList display_list;
     Painting::DisplayListRecorder display_list_recorder(display_list);
 
@@ -1189,7 +1323,24 @@ void TraversableNavigable::paint(DevicePixelRect const& content_rect, Painting::
     paint_config.paint_overlay = paint_options.paint_overlay == PaintOptions::PaintOverlay::Yes;
     paint_config.should_show_line_box_borders = paint_options.should_show_line_box_borders;
     paint_config.has_focus = paint_options.has_focus;
-    record_display_list(display_list_recorder, paint_config);
+
+    auto& frame_timings = page().current_frame_timings();
+    auto paint_recording_timer = Core::ElapsedTimer::start_new();
+    {
+        TRACE_EVENT_SCOPE("paint"sv, "Record display list"sv);
+        record_display_list(display_list_recorder, paint_config);
+    }
+    frame_timings.paint_recording += paint_recording_timer.elapsed_time();
+
+    if (auto document = active_document(); document && !document->first_paint_time().has_value())
+        document->set_first_paint_time(HighResolutionTime::current_high_resolution_time(relevant_global_object(*document)));
+
+    auto display_list_playback_timer = Core::ElapsedTimer::start_new();
+    ScopeGuard record_display_list_playback_time = [&] {
+        frame_timings.display_list_playback += display_list_playback_timer.elapsed_time();
+        page().did_finish_frame();
+    };
+    TRACE_EVENT_SCOPE("paint"sv, "Play display list"sv);
 
     auto display_list_player_type = page().client().display_list_player_type();
     if (display_list_player_type == DisplayListPlayerType::GPU) {
@@ -1214,7 +1365,8 @@ void TraversableNavigable::paint(DevicePixelRect const& content_rect, Painting::
             return;
         }
 #endif
-        Painting::DisplayListPlayerSkia player(target.bitmap());
+        // NOTE: The backing store is shown as an opaque image, so there's no point in converting its alpha.
+        Painting::DisplayListPlayerSkia player(target.bitmap(), Painting::DisplayListPlayerSkia::AlphaType::Premultiplied);
         display_list.execute(player);
     } else {
         Painting::DisplayListPlayerCPU player(target.bitmap());
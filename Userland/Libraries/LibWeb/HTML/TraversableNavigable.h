@@ -42,6 +42,17 @@ public:
     VisibilityState system_visibility_state() const { return m_system_visibility_state; }
     void set_system_visibility_state(VisibilityState);
 
+    // AD-HOC: A traversable that stays hidden is throttled in stages. First, the timers of its documents are batched
+    //         into infrequent wakeups. Later, it is frozen, and none of its tasks run until it becomes visible again.
+    bool is_throttling_timers() const { return m_is_throttling_timers; }
+    bool is_frozen() const { return m_is_frozen; }
+
+    // AD-HOC: Documents that are unloaded while eligible for the back/forward cache stay alive in their session history
+    //         entries. Only a few of them are kept around at once; the least recently stored ones are destroyed first.
+    void store_document_in_back_forward_cache(DOM::Document&);
+    void remove_document_from_back_forward_cache(DOM::Document&);
+    void clear_back_forward_cache();
+
     struct HistoryObjectLengthAndIndex {
         u64 script_history_length;
         u64 script_history_index;
@@ -126,6 +137,16 @@ private:
     // https://html.spec.whatwg.org/multipage/document-sequences.html#system-visibility-state
     VisibilityState m_system_visibility_state { VisibilityState::Visible };
 
+    void advance_background_throttling();
+    void set_is_throttling_timers(bool);
+    void set_is_frozen(bool);
+
+    RefPtr<Core::Timer> m_background_throttling_timer;
+    bool m_is_throttling_timers { false };
+    bool m_is_frozen { false };
+
+    Vector<JS::NonnullGCPtr<DOM::Document>> m_documents_in_back_forward_cache;
+
     JS::NonnullGCPtr<SessionHistoryTraversalQueue> m_session_history_traversal_queue;
 
     String m_window_handle;
@@ -124,6 +124,8 @@ void Window::visit_edges(JS::Cell::Visitor& visitor)
     visitor.visit(m_location);
     visitor.visit(m_crypto);
     visitor.visit(m_navigator);
+    visitor.visit(m_local_storage);
+    visitor.visit(m_session_storage);
     visitor.visit(m_navigation);
     visitor.visit(m_custom_element_registry);
     visitor.visit(m_pdf_viewer_plugin_objects);
@@ -419,22 +421,22 @@ void Window::fire_a_page_transition_event(FlyString const& event_name, bool pers
 WebIDL::ExceptionOr<JS::NonnullGCPtr<Storage>> Window::local_storage()
 {
     // FIXME: Implement according to spec.
-    static HashMap<Origin, JS::Handle<Storage>> local_storage_per_origin;
-    auto storage = local_storage_per_origin.ensure(associated_document().origin(), [this]() -> JS::Handle<Storage> {
-        return Storage::create(realm());
-    });
-    return JS::NonnullGCPtr { *storage };
+    if (!m_local_storage) {
+        auto storage_bottle = StorageBottle::obtain_local_storage_bottle(page(), associated_document().origin());
+        m_local_storage = Storage::create(realm(), move(storage_bottle));
+    }
+    return JS::NonnullGCPtr { *m_local_storage };
 }
 
 // https://html.spec.whatwg.org/multipage/webstorage.html#dom-sessionstorage
 WebIDL::ExceptionOr<JS::NonnullGCPtr<Storage>> Window::session_storage()
 {
     // FIXME: Implement according to spec.
-    static HashMap<Origin, JS::Handle<Storage>> session_storage_per_origin;
-    auto storage = session_storage_per_origin.ensure(associated_document().origin(), [this]() -> JS::Handle<Storage> {
-        return Storage::create(realm());
-    });
-    return JS::NonnullGCPtr { *storage };
+    if (!m_session_storage) {
+        auto storage_bottle = StorageBottle::obtain_session_storage_bottle(associated_document().origin());
+        m_session_storage = Storage::create(realm(), move(storage_bottle));
+    }
+    return JS::NonnullGCPtr { *m_session_storage };
 }
 
 // https://html.spec.whatwg.org/multipage/interaction.html#sticky-activation
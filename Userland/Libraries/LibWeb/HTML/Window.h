@@ -271,6 +271,8 @@ private:
     JS::GCPtr<Crypto::Crypto> m_crypto;
     JS::GCPtr<CSS::Screen> m_screen;
     JS::GCPtr<Navigator> m_navigator;
+    JS::GCPtr<Storage> m_local_storage;
+    JS::GCPtr<Storage> m_session_storage;
     JS::GCPtr<Location> m_location;
     JS::GCPtr<CloseWatcherManager> m_close_watcher_manager;
 
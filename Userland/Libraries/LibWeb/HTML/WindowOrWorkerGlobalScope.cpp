@@ -15,11 +15,16 @@
 #include <LibJS/Runtime/Array.h>
 #include <LibTextCodec/Decoder.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
+#include <LibWeb/CSS/StyleProperties.h>
+#include <LibWeb/DOM/Document.h>
 #include <LibWeb/Fetch/FetchMethod.h>
 #include <LibWeb/HTML/CanvasRenderingContext2D.h>
 #include <LibWeb/HTML/EventLoop/EventLoop.h>
 #include <LibWeb/HTML/EventSource.h>
 #include <LibWeb/HTML/ImageBitmap.h>
+#include <LibWeb/HTML/Navigable.h>
+#include <LibWeb/HTML/NavigableContainer.h>
+#include <LibWeb/HTML/Scheduler.h>
 #include <LibWeb/HTML/Scripting/ClassicScript.h>
 #include <LibWeb/HTML/Scripting/Environments.h>
 #include <LibWeb/HTML/Scripting/ExceptionReporter.h>
@@ -69,6 +74,7 @@ void WindowOrWorkerGlobalScopeMixin::visit_edges(JS::Cell::Visitor& visitor)
     visitor.visit(m_timers);
     visitor.visit(m_registered_performance_observer_objects);
     visitor.visit(m_indexed_db);
+    visitor.visit(m_scheduler);
     for (auto& entry : m_performance_entry_buffer_map)
         entry.value.visit_edges(visitor);
     visitor.visit(m_registered_event_sources);
@@ -289,7 +295,7 @@ i32 WindowOrWorkerGlobalScopeMixin::set_interval(TimerHandler handler, i32 timeo
 void WindowOrWorkerGlobalScopeMixin::clear_timeout(i32 id)
 {
     if (auto timer = m_timers.get(id); timer.has_value())
-        timer.value()->stop();
+        m_timer_heap.unschedule(*timer.value());
     m_timers.remove(id);
 }
 
@@ -297,14 +303,13 @@ void WindowOrWorkerGlobalScopeMixin::clear_timeout(i32 id)
 void WindowOrWorkerGlobalScopeMixin::clear_interval(i32 id)
 {
     if (auto timer = m_timers.get(id); timer.has_value())
-        timer.value()->stop();
+        m_timer_heap.unschedule(*timer.value());
     m_timers.remove(id);
 }
 
 void WindowOrWorkerGlobalScopeMixin::clear_map_of_active_timers()
 {
-    for (auto& it : m_timers)
-        it.value->stop();
+    m_timer_heap.clear();
     m_timers.clear();
 }
 
@@ -696,7 +701,44 @@ void WindowOrWorkerGlobalScopeMixin::run_steps_after_a_timeout_impl(i32 timeout,
     // FIXME:    4. Perform completionSteps.
     // FIXME:    5. If timerKey is a non-numeric value, remove global's map of active timers[timerKey].
 
-    timer->start();
+    m_timer_heap.schedule(timer);
+}
+
+// Timers of a page the user can't see are batched into infrequent wakeups, so background pages don't keep waking us up.
+bool WindowOrWorkerGlobalScopeMixin::should_throttle_timers()
+{
+    auto* window = dynamic_cast<Window*>(&this_impl());
+    if (!window)
+        return false;
+
+    auto& document = window->associated_document();
+    if (document.hidden()) {
+        // A document that was only just hidden is left alone for a while, see TraversableNavigable::is_throttling_timers().
+        auto navigable = document.navigable();
+        if (!navigable || navigable->traversable_navigable()->is_throttling_timers())
+            return true;
+    }
+
+    // A nested navigable whose container isn't rendered is hidden too, even though its document is visible.
+    if (auto navigable = document.navigable(); navigable && navigable->container()) {
+        auto const* computed_values = navigable->container()->computed_css_values();
+        if (computed_values && computed_values->display().is_none())
+            return true;
+    }
+
+    return false;
+}
+
+// The timers of a frozen page don't wake us up at all, they fire once the page is resumed.
+bool WindowOrWorkerGlobalScopeMixin::should_freeze_timers()
+{
+    auto* window = dynamic_cast<Window*>(&this_impl());
+    return window && window->associated_document().is_frozen();
+}
+
+void WindowOrWorkerGlobalScopeMixin::timer_throttling_may_have_changed()
+{
+    m_timer_heap.update_wakeup();
 }
 
 // https://w3c.github.io/hr-time/#dom-windoworworkerglobalscope-performance
@@ -718,6 +760,15 @@ JS::NonnullGCPtr<IndexedDB::IDBFactory> WindowOrWorkerGlobalScopeMixin::indexed_
     return *m_indexed_db;
 }
 
+// https://wicg.github.io/scheduling-apis/#dom-windoworworkerglobalscope-scheduler
+JS::NonnullGCPtr<Scheduler> WindowOrWorkerGlobalScopeMixin::scheduler()
+{
+    // The scheduler attribute's getter steps are to return this's scheduler.
+    if (!m_scheduler)
+        m_scheduler = Scheduler::create(this_impl().realm());
+    return *m_scheduler;
+}
+
 // https://w3c.github.io/performance-timeline/#dfn-frozen-array-of-supported-entry-types
 JS::NonnullGCPtr<JS::Object> WindowOrWorkerGlobalScopeMixin::supported_entry_types() const
 {
@@ -17,6 +17,7 @@
 #include <LibWeb/Forward.h>
 #include <LibWeb/HTML/ImageBitmap.h>
 #include <LibWeb/HTML/MessagePort.h>
+#include <LibWeb/HTML/Timer.h>
 #include <LibWeb/PerformanceTimeline/PerformanceEntry.h>
 #include <LibWeb/PerformanceTimeline/PerformanceEntryTuple.h>
 
@@ -67,15 +68,22 @@ public:
     void register_event_source(Badge<EventSource>, JS::NonnullGCPtr<EventSource>);
     void unregister_event_source(Badge<EventSource>, JS::NonnullGCPtr<EventSource>);
     void forcibly_close_all_event_sources();
+    bool has_registered_event_sources() const { return !m_registered_event_sources.is_empty(); }
 
     void run_steps_after_a_timeout(i32 timeout, Function<void()> completion_step);
 
+    bool should_throttle_timers();
+    bool should_freeze_timers();
+    void timer_throttling_may_have_changed();
+
     [[nodiscard]] JS::NonnullGCPtr<HighResolutionTime::Performance> performance();
 
     JS::NonnullGCPtr<JS::Object> supported_entry_types() const;
 
     JS::NonnullGCPtr<IndexedDB::IDBFactory> indexed_db();
 
+    JS::NonnullGCPtr<Scheduler> scheduler();
+
 protected:
     void initialize(JS::Realm&);
     void visit_edges(JS::Cell::Visitor&);
@@ -93,6 +101,7 @@ private:
 
     IDAllocator m_timer_id_allocator;
     HashMap<int, JS::NonnullGCPtr<Timer>> m_timers;
+    TimerHeap m_timer_heap { *this };
 
     // https://www.w3.org/TR/performance-timeline/#performance-timeline
     // Each global object has:
@@ -113,6 +122,8 @@ private:
 
     JS::GCPtr<IndexedDB::IDBFactory> m_indexed_db;
 
+    JS::GCPtr<Scheduler> m_scheduler;
+
     mutable JS::GCPtr<JS::Object> m_supported_entry_types_array;
 };
 
@@ -7,6 +7,7 @@
 #include <LibWeb/Bindings/IDBFactoryPrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/IndexedDB/IDBFactory.h>
+#include <LibWeb/IndexedDB/Internal/Key.h>
 
 namespace Web::IndexedDB {
 
@@ -25,4 +26,27 @@ void IDBFactory::initialize(JS::Realm& realm)
     WEB_SET_PROTOTYPE_FOR_INTERFACE(IDBFactory);
 }
 
+// https://w3c.github.io/IndexedDB/#dom-idbfactory-cmp
+WebIDL::ExceptionOr<WebIDL::Short> IDBFactory::cmp(JS::Value first, JS::Value second)
+{
+    auto& realm = this->realm();
+
+    // 1. Let a be the result of converting a value to a key with first. Rethrow any exceptions.
+    auto a = TRY(convert_a_value_to_a_key(realm, first));
+
+    // 2. If a is invalid, throw a "DataError" DOMException.
+    if (!a)
+        return WebIDL::DataError::create(realm, "Failed to convert a value to a key"_fly_string);
+
+    // 3. Let b be the result of converting a value to a key with second. Rethrow any exceptions.
+    auto b = TRY(convert_a_value_to_a_key(realm, second));
+
+    // 4. If b is invalid, throw a "DataError" DOMException.
+    if (!b)
+        return WebIDL::DataError::create(realm, "Failed to convert a value to a key"_fly_string);
+
+    // 5. Return the results of comparing two keys with a and b.
+    return Key::compare_two_keys(*a, *b);
+}
+
 }
@@ -7,6 +7,8 @@
 #pragma once
 
 #include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/WebIDL/ExceptionOr.h>
+#include <LibWeb/WebIDL/Types.h>
 
 namespace Web::IndexedDB {
 
@@ -18,6 +20,8 @@ class IDBFactory : public Bindings::PlatformObject {
 public:
     virtual ~IDBFactory() override;
 
+    WebIDL::ExceptionOr<WebIDL::Short> cmp(JS::Value first, JS::Value second);
+
 protected:
     explicit IDBFactory(JS::Realm&);
 
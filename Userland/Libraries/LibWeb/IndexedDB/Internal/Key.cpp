@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/ScopeGuard.h>
+#include <LibJS/Runtime/AbstractOperations.h>
+#include <LibJS/Runtime/Array.h>
+#include <LibJS/Runtime/ArrayBuffer.h>
+#include <LibJS/Runtime/DataView.h>
+#include <LibJS/Runtime/Date.h>
+#include <LibJS/Runtime/TypedArray.h>
+#include <LibWeb/IndexedDB/Internal/Key.h>
+#include <LibWeb/Infra/ByteSequences.h>
+#include <LibWeb/Infra/Strings.h>
+#include <LibWeb/WebIDL/AbstractOperations.h>
+
+namespace Web::IndexedDB {
+
+NonnullRefPtr<Key> Key::create_number(double value)
+{
+    return adopt_ref(*new Key(Type::Number, value));
+}
+
+NonnullRefPtr<Key> Key::create_date(double value)
+{
+    return adopt_ref(*new Key(Type::Date, value));
+}
+
+NonnullRefPtr<Key> Key::create_string(JS::Utf16String value)
+{
+    return adopt_ref(*new Key(Type::String, move(value)));
+}
+
+NonnullRefPtr<Key> Key::create_binary(ByteBuffer value)
+{
+    return adopt_ref(*new Key(Type::Binary, move(value)));
+}
+
+NonnullRefPtr<Key> Key::create_array(Subkeys value)
+{
+    return adopt_ref(*new Key(Type::Array, move(value)));
+}
+
+// https://w3c.github.io/IndexedDB/#compare-two-keys
+i8 Key::compare_two_keys(Key const& a, Key const& b)
+{
+    // 1. Let ta be the type of a.
+    auto ta = a.type();
+
+    // 2. Let tb be the type of b.
+    auto tb = b.type();
+
+    // 3. If ta does not equal tb, then run these steps:
+    //    NOTE: This orders array > binary > string > date > number, which is how the Type enum is ordered.
+    if (ta != tb)
+        return ta > tb ? 1 : -1;
+
+    // 4. Let va be the value of a.
+    auto const& va = a.value();
+
+    // 5. Let vb be the value of b.
+    auto const& vb = b.value();
+
+    // 6. Switch on ta:
+    switch (ta) {
+    // number, date
+    case Type::Number:
+    case Type::Date: {
+        auto number_a = va.get<double>();
+        auto number_b = vb.get<double>();
+
+        // 1. If va is greater than vb, then return 1.
+        if (number_a > number_b)
+            return 1;
+
+        // 2. If va is less than vb, then return -1.
+        if (number_a < number_b)
+            return -1;
+
+        // 3. Return 0.
+        return 0;
+    }
+    // string
+    case Type::String: {
+        auto string_a = va.get<JS::Utf16String>().view();
+        auto string_b = vb.get<JS::Utf16String>().view();
+
+        // 1. If va is code unit less than vb, then return -1.
+        if (Infra::is_code_unit_less_than(string_a, string_b))
+            return -1;
+
+        // 2. If vb is code unit less than va, then return 1.
+        if (Infra::is_code_unit_less_than(string_b, string_a))
+            return 1;
+
+        // 3. Return 0.
+        return 0;
+    }
+    // binary
+    case Type::Binary: {
+        auto const& bytes_a = va.get<ByteBuffer>();
+        auto const& bytes_b = vb.get<ByteBuffer>();
+
+        // 1. If va is byte less than vb, then return -1.
+        if (Infra::is_byte_less_than(bytes_a, bytes_b))
+            return -1;
+
+        // 2. If vb is byte less than va, then return 1.
+        if (Infra::is_byte_less_than(bytes_b, bytes_a))
+            return 1;
+
+        // 3. Return 0.
+        return 0;
+    }
+    // array
+    case Type::Array: {
+        auto const& subkeys_a = va.get<Subkeys>();
+        auto const& subkeys_b = vb.get<Subkeys>();
+
+        // 1. Let length be the lesser of va’s size and vb’s size.
+        auto length = min(subkeys_a.size(), subkeys_b.size());
+
+        // 2. Let i be 0.
+        // 3. While i is less than length, then:
+        for (size_t i = 0; i < length; ++i) {
+            // 1. Let c be the result of recursively comparing two keys with va[i] and vb[i].
+            auto c = compare_two_keys(subkeys_a[i], subkeys_b[i]);
+
+            // 2. If c is not 0, return c.
+            if (c != 0)
+                return c;
+
+            // 3. Increase i by 1.
+        }
+
+        // 4. If va’s size is greater than vb’s size, then return 1.
+        if (subkeys_a.size() > subkeys_b.size())
+            return 1;
+
+        // 5. If va’s size is less than vb’s size, then return -1.
+        if (subkeys_a.size() < subkeys_b.size())
+            return -1;
+
+        // 6. Return 0.
+        return 0;
+    }
+    }
+    VERIFY_NOT_REACHED();
+}
+
+// https://w3c.github.io/IndexedDB/#convert-a-value-to-a-key
+static JS::ThrowCompletionOr<RefPtr<Key>> convert_a_value_to_a_key(JS::Realm& realm, JS::Value input, Vector<JS::Value>& seen)
+{
+    auto& vm = realm.vm();
+
+    // 2. If seen contains input, then return invalid.
+    if (seen.contains_slow(input))
+        return nullptr;
+
+    // 3. Jump to the appropriate step below:
+
+    // If Type(input) is Number
+    if (input.is_number()) {
+        // 1. If input is NaN then return invalid.
+        if (input.is_nan())
+            return nullptr;
+
+        // 2. Otherwise, return a new key with type number and value input.
+        return Key::create_number(input.as_double());
+    }
+
+    // If Type(input) is String
+    if (input.is_string()) {
+        // 1. Return a new key with type string and value input.
+        return Key::create_string(input.as_string().utf16_string());
+    }
+
+    if (!input.is_object())
+        return nullptr;
+    auto& object = input.as_object();
+
+    // If input is a Date (has a [[DateValue]] internal slot)
+    if (is<JS::Date>(object)) {
+        // 1. Let ms be the value of input’s [[DateValue]] internal slot.
+        auto ms = static_cast<JS::Date&>(object).date_value();
+
+        // 2. If ms is NaN then return invalid.
+        if (isnan(ms))
+            return nullptr;
+
+        // 3. Otherwise, return a new key with type date and value ms.
+        return Key::create_date(ms);
+    }
+
+    // If input is a buffer source type
+    if (is<JS::ArrayBuffer>(object) || is<JS::TypedArrayBase>(object) || is<JS::DataView>(object)) {
+        // 1. If input is detached then return invalid.
+        JS::ArrayBuffer const* buffer = nullptr;
+        if (is<JS::ArrayBuffer>(object))
+            buffer = &static_cast<JS::ArrayBuffer&>(object);
+        else if (is<JS::TypedArrayBase>(object))
+            buffer = static_cast<JS::TypedArrayBase&>(object).viewed_array_buffer();
+        else
+            buffer = static_cast<JS::DataView&>(object).viewed_array_buffer();
+        if (buffer->is_detached())
+            return nullptr;
+
+        // 2. Let bytes be the result of getting a copy of the bytes held by the buffer source input.
+        auto bytes = TRY_OR_THROW_OOM(vm, WebIDL::get_buffer_source_copy(object));
+
+        // 3. Return a new key with type binary and value bytes.
+        return Key::create_binary(move(bytes));
+    }
+
+    // If input is an Array exotic object
+    if (is<JS::Array>(object)) {
+        // 1. Let len be ? ToLength( ? Get(input, "length")).
+        auto length = TRY(JS::length_of_array_like(vm, object));
+
+        // 2. Append input to seen.
+        // NOTE: seen only needs to hold the arrays we are currently inside of to detect cycles, so input is removed
+        //       again once its entries are converted.
+        seen.append(input);
+        ScopeGuard remove_input_from_seen = [&] { seen.take_last(); };
+
+        // 3. Let keys be a new empty list.
+        Key::Subkeys keys;
+        TRY_OR_THROW_OOM(vm, keys.try_ensure_capacity(length));
+
+        // 4. Let index be 0.
+        // 5. While index is less than len:
+        for (size_t index = 0; index < length; ++index) {
+            // 1. Let hop be ? HasOwnProperty(input, index).
+            auto hop = TRY(object.has_own_property(index));
+
+            // 2. If hop is false, return invalid.
+            if (!hop)
+                return nullptr;
+
+            // 3. Let entry be ? Get(input, index).
+            auto entry = TRY(object.get(index));
+
+            // 4. Let key be the result of converting a value to a key with arguments entry and seen.
+            // 5. ReturnIfAbrupt(key).
+            auto key = TRY(convert_a_value_to_a_key(realm, entry, seen));
+
+            // 6. If key is invalid abort these steps and return invalid.
+            if (!key)
+                return nullptr;
+
+            // 7. Append key to keys.
+            keys.unchecked_append(key.release_nonnull());
+
+            // 8. Increase index by 1.
+        }
+
+        // 6. Return a new array key with value keys.
+        return Key::create_array(move(keys));
+    }
+
+    // Otherwise
+    // 1. Return invalid.
+    return nullptr;
+}
+
+JS::ThrowCompletionOr<RefPtr<Key>> convert_a_value_to_a_key(JS::Realm& realm, JS::Value input)
+{
+    // 1. If seen was not given, then let seen be a new empty set.
+    Vector<JS::Value> seen;
+    return convert_a_value_to_a_key(realm, input, seen);
+}
+
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/RefCounted.h>
+#include <AK/Variant.h>
+#include <AK/Vector.h>
+#include <LibJS/Forward.h>
+#include <LibJS/Runtime/Completion.h>
+#include <LibJS/Runtime/Utf16String.h>
+
+namespace Web::IndexedDB {
+
+// https://w3c.github.io/IndexedDB/#key-construct
+// Keys are immutable once created, so array keys can share their subkeys.
+// NOTE: Only keys and their comparison exist so far. There are no object stores, transactions or cursors to use them.
+class Key : public RefCounted<Key> {
+public:
+    // The types are listed in increasing order, see https://w3c.github.io/IndexedDB/#compare-two-keys.
+    enum class Type : u8 {
+        Number,
+        Date,
+        String,
+        Binary,
+        Array,
+    };
+
+    using Subkeys = Vector<NonnullRefPtr<Key>>;
+    // Strings are kept as UTF-16, since that is what they are compared by and lone surrogates are valid in a key.
+    using Value = Variant<double, JS::Utf16String, ByteBuffer, Subkeys>;
+
+    static NonnullRefPtr<Key> create_number(double);
+    static NonnullRefPtr<Key> create_date(double);
+    static NonnullRefPtr<Key> create_string(JS::Utf16String);
+    static NonnullRefPtr<Key> create_binary(ByteBuffer);
+    static NonnullRefPtr<Key> create_array(Subkeys);
+
+    Type type() const { return m_type; }
+    Value const& value() const { return m_value; }
+
+    // https://w3c.github.io/IndexedDB/#compare-two-keys
+    static i8 compare_two_keys(Key const& a, Key const& b);
+
+private:
+    Key(Type type, Value value)
+        : m_type(type)
+        , m_value(move(value))
+    {
+    }
+
+    Type m_type;
+    Value m_value;
+};
+
+// Returns null if the value is not a valid key, which the spec calls "invalid".
+JS::ThrowCompletionOr<RefPtr<Key>> convert_a_value_to_a_key(JS::Realm&, JS::Value input);
+
+}
@@ -100,6 +100,25 @@ bool is_code_unit_prefix(StringView potential_prefix, StringView input)
     }
 }
 
+// https://infra.spec.whatwg.org/#code-unit-less-than
+bool is_code_unit_less_than(Utf16View const& a, Utf16View const& b)
+{
+    // 1. If b is a code unit prefix of a, then return false.
+    // 2. If a is a code unit prefix of b, then return true.
+    // 3. Let n be the smallest index such that the nth code unit of a is different from the nth code unit of b.
+    //    (There has to be such an index, since neither string is a prefix of the other.)
+    // 4. If the nth code unit of a is less than the nth code unit of b, then return true.
+    // 5. Return false.
+    auto common_length = min(a.length_in_code_units(), b.length_in_code_units());
+    for (size_t n = 0; n < common_length; ++n) {
+        auto a_code_unit = a.code_unit_at(n);
+        auto b_code_unit = b.code_unit_at(n);
+        if (a_code_unit != b_code_unit)
+            return a_code_unit < b_code_unit;
+    }
+    return a.length_in_code_units() < b.length_in_code_units();
+}
+
 // https://infra.spec.whatwg.org/#scalar-value-string
 ErrorOr<String> convert_to_scalar_value_string(StringView string)
 {
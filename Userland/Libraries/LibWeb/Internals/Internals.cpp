@@ -4,19 +4,27 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Runtime/JSONObject.h>
 #include <LibJS/Runtime/VM.h>
+#include <LibWeb/Bindings/ExceptionOrUtils.h>
 #include <LibWeb/Bindings/InternalsPrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/Event.h>
 #include <LibWeb/DOM/EventTarget.h>
+#include <LibWeb/HTML/AnimatedBitmapDecodedImageData.h>
 #include <LibWeb/HTML/BrowsingContext.h>
 #include <LibWeb/HTML/HTMLElement.h>
+#include <LibWeb/HTML/SharedImageRequest.h>
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/Internals/Internals.h>
 #include <LibWeb/Page/Page.h>
 #include <LibWeb/Painting/PaintableBox.h>
 #include <LibWeb/Painting/ViewportPaintable.h>
+#include <LibWeb/Streams/AbstractOperations.h>
+#include <LibWeb/Streams/ReadableStream.h>
+#include <LibWeb/WebIDL/Promise.h>
 
 namespace Web::Internals {
 
@@ -117,4 +125,61 @@ JS::NonnullGCPtr<InternalAnimationTimeline> Internals::create_internal_animation
     return realm.heap().allocate<InternalAnimationTimeline>(realm, realm);
 }
 
+JS::Object* Internals::last_frame_timings()
+{
+    auto const& timings = global_object().browsing_context()->page().last_frame_timings();
+    auto result = JS::Object::create(realm(), nullptr);
+    auto define_milliseconds = [&](char const* name, AK::Duration duration) {
+        result->define_direct_property(name, JS::Value(static_cast<double>(duration.to_nanoseconds()) / 1'000'000), JS::default_attributes);
+    };
+    define_milliseconds("style", timings.style);
+    define_milliseconds("layout", timings.layout);
+    define_milliseconds("gridLayout", timings.grid_layout);
+    define_milliseconds("paintRecording", timings.paint_recording);
+    define_milliseconds("displayListPlayback", timings.display_list_playback);
+    define_milliseconds("garbageCollection", timings.garbage_collection);
+    return result;
+}
+
+JS::Object* Internals::image_request_statistics()
+{
+    auto const& statistics = HTML::SharedImageRequest::statistics();
+    auto result = JS::Object::create(realm(), nullptr);
+    result->define_direct_property("reusedRequests", JS::Value(static_cast<double>(statistics.reused_request_count)), JS::default_attributes);
+    result->define_direct_property("createdRequests", JS::Value(static_cast<double>(statistics.created_request_count)), JS::default_attributes);
+    result->define_direct_property("decodedBytes", JS::Value(static_cast<double>(HTML::AnimatedBitmapDecodedImageData::total_decoded_bytes())), JS::default_attributes);
+    return result;
+}
+
+JS::Object* Internals::bytecode_statistics()
+{
+    auto statistics = vm().bytecode_interpreter().bytecode_statistics();
+    return &JS::JSONObject::parse_json_value(vm(), statistics).as_object();
+}
+
+// Creates a byte stream that is fed like the body of a network fetch: the first pull hands all of data over to
+// "pull from bytes" at once. The stream isn't closed afterwards.
+JS::NonnullGCPtr<Streams::ReadableStream> Internals::create_byte_stream_pulled_from_bytes(String const& data)
+{
+    auto& realm = this->realm();
+    auto stream = realm.heap().allocate<Streams::ReadableStream>(realm, realm);
+
+    auto pull_algorithm = JS::create_heap_function(realm.heap(), [&realm, stream, bytes = MUST(ByteBuffer::copy(data.bytes())), pulled = false]() mutable {
+        if (!pulled) {
+            pulled = true;
+            if (auto result = Streams::readable_stream_pull_from_bytes(stream, move(bytes)); result.is_error()) {
+                auto throw_completion = Bindings::dom_exception_to_throw_completion(realm.vm(), result.release_error());
+                return WebIDL::create_rejected_promise(realm, *throw_completion.value());
+            }
+        }
+        return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+    });
+    auto cancel_algorithm = JS::create_heap_function(realm.heap(), [&realm](JS::Value) {
+        return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+    });
+    Streams::set_up_readable_stream_controller_with_byte_reading_support(stream, pull_algorithm, cancel_algorithm);
+
+    return stream;
+}
+
 }
@@ -36,6 +36,12 @@ public:
 
     JS::NonnullGCPtr<InternalAnimationTimeline> create_internal_animation_timeline();
 
+    JS::Object* last_frame_timings();
+    JS::Object* image_request_statistics();
+    JS::Object* bytecode_statistics();
+
+    JS::NonnullGCPtr<Streams::ReadableStream> create_byte_stream_pulled_from_bytes(String const& data);
+
 private:
     explicit Internals(JS::Realm&);
     virtual void initialize(JS::Realm&) override;
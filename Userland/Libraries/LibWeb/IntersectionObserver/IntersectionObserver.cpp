@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/CharacterTypes.h>
 #include <AK/QuickSort.h>
 #include <LibWeb/Bindings/IntersectionObserverPrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
@@ -18,9 +19,86 @@ namespace Web::IntersectionObserver {
 
 JS_DEFINE_ALLOCATOR(IntersectionObserver);
 
+static Optional<CSS::LengthPercentage> parse_a_root_margin_value(StringView token)
+{
+    // If token is a <percentage> token, replace it with an equivalent percentage.
+    if (token.ends_with('%')) {
+        auto value = token.substring_view(0, token.length() - 1).to_number<double>(TrimWhitespace::No);
+        if (!value.has_value())
+            return {};
+        return CSS::LengthPercentage { CSS::Percentage { *value } };
+    }
+
+    // If token is an absolute length dimension token, replace it with an equivalent pixel length.
+    auto unit_start = token.length();
+    while (unit_start > 0 && is_ascii_alpha(token[unit_start - 1]))
+        --unit_start;
+
+    auto value = token.substring_view(0, unit_start).to_number<double>(TrimWhitespace::No);
+    auto unit = CSS::Length::unit_from_name(token.substring_view(unit_start));
+    if (!value.has_value() || !unit.has_value())
+        return {};
+
+    CSS::Length length { *value, *unit };
+    if (!length.is_absolute())
+        return {};
+    return CSS::LengthPercentage { CSS::Length::make_px(length.absolute_length_to_px()) };
+}
+
+// https://w3c.github.io/IntersectionObserver/#parse-a-root-margin
+static Optional<Vector<CSS::LengthPercentage>> parse_a_root_margin(StringView margin_string)
+{
+    // 1. Parse a list of component values marginString, storing the result as tokens.
+    // 2. Remove all whitespace tokens from tokens.
+    auto tokens = margin_string.split_view_if(is_ascii_space);
+
+    // 3. If the length of tokens is greater than 4, return failure.
+    if (tokens.size() > 4)
+        return {};
+
+    // 4. If there are zero elements in tokens, set tokens to ["0px"].
+    if (tokens.is_empty())
+        tokens.append("0px"sv);
+
+    // 5. Replace each token in tokens:
+    //    - If token is an absolute length dimension token, replace it with an equivalent pixel length.
+    //    - If token is a <percentage> token, replace it with an equivalent percentage.
+    //    - Otherwise, return failure.
+    Vector<CSS::LengthPercentage> margins;
+    for (auto token : tokens) {
+        auto margin = parse_a_root_margin_value(token);
+        if (!margin.has_value())
+            return {};
+        margins.append(margin.release_value());
+    }
+
+    // 6. If there is one element in tokens, append three duplicates of that element to tokens.
+    //    Otherwise, if there are two elements are tokens, append a duplicate of each element to tokens.
+    //    Otherwise, if there are three elements in tokens, append a duplicate of the second element to tokens.
+    if (margins.size() == 1) {
+        margins.append(margins[0]);
+        margins.append(margins[0]);
+        margins.append(margins[0]);
+    } else if (margins.size() == 2) {
+        margins.append(margins[0]);
+        margins.append(margins[1]);
+    } else if (margins.size() == 3) {
+        margins.append(margins[1]);
+    }
+
+    // 7. Return tokens.
+    return margins;
+}
+
 // https://w3c.github.io/IntersectionObserver/#dom-intersectionobserver-intersectionobserver
 WebIDL::ExceptionOr<JS::NonnullGCPtr<IntersectionObserver>> IntersectionObserver::construct_impl(JS::Realm& realm, JS::GCPtr<WebIDL::CallbackType> callback, IntersectionObserverInit const& options)
 {
+    // 3. Attempt to parse a root margin from options.rootMargin. If a list is returned, set this’s internal [[rootMargin]]
+    //    slot to that. Otherwise, throw a SyntaxError exception.
+    auto root_margin = parse_a_root_margin(options.root_margin);
+    if (!root_margin.has_value())
+        return WebIDL::SyntaxError::create(realm, "Invalid rootMargin"_fly_string);
+
     // 4. Let thresholds be a list equal to options.threshold.
     Vector<double> thresholds;
     if (options.threshold.has<double>()) {
@@ -45,12 +123,13 @@ WebIDL::ExceptionOr<JS::NonnullGCPtr<IntersectionObserver>> IntersectionObserver
     // 2. Set this’s internal [[callback]] slot to callback.
     // 8. The thresholds attribute getter will return this sorted thresholds list.
     // 9. Return this.
-    return realm.heap().allocate<IntersectionObserver>(realm, realm, callback, options.root, move(thresholds));
+    return realm.heap().allocate<IntersectionObserver>(realm, realm, callback, options.root, root_margin.release_value(), move(thresholds));
 }
 
-IntersectionObserver::IntersectionObserver(JS::Realm& realm, JS::GCPtr<WebIDL::CallbackType> callback, Optional<Variant<JS::Handle<DOM::Element>, JS::Handle<DOM::Document>>> const& root, Vector<double>&& thresholds)
+IntersectionObserver::IntersectionObserver(JS::Realm& realm, JS::GCPtr<WebIDL::CallbackType> callback, Optional<Variant<JS::Handle<DOM::Element>, JS::Handle<DOM::Document>>> const& root, Vector<CSS::LengthPercentage>&& root_margin, Vector<double>&& thresholds)
     : PlatformObject(realm)
     , m_callback(callback)
+    , m_root_margin(move(root_margin))
     , m_thresholds(move(thresholds))
 {
     m_root = root.has_value() ? root->visit([](auto& value) -> JS::GCPtr<DOM::Node> { return *value; }) : nullptr;
@@ -161,6 +240,20 @@ Variant<JS::Handle<DOM::Element>, JS::Handle<DOM::Document>, Empty> Intersection
     VERIFY_NOT_REACHED();
 }
 
+// https://w3c.github.io/IntersectionObserver/#dom-intersectionobserver-rootmargin
+String IntersectionObserver::root_margin() const
+{
+    // On getting, return the result of serializing the elements of [[rootMargin]] space-separated, where pixel lengths
+    // serialize as the numeric value followed by "px", and percentages serialize as the numeric value followed by "%".
+    StringBuilder builder;
+    for (auto const& margin : m_root_margin) {
+        if (!builder.is_empty())
+            builder.append(' ');
+        builder.append(margin.to_string());
+    }
+    return MUST(builder.to_string());
+}
+
 // https://www.w3.org/TR/intersection-observer/#intersectionobserver-intersection-root
 Variant<JS::Handle<DOM::Element>, JS::Handle<DOM::Document>> IntersectionObserver::intersection_root() const
 {
@@ -211,11 +304,19 @@ CSSPixelRect IntersectionObserver::root_intersection_rectangle() const
         rect = CSSPixelRect(bounding_client_rect->x(), bounding_client_rect->y(), bounding_client_rect->width(), bounding_client_rect->height());
     }
 
-    // FIXME: When calculating the root intersection rectangle for a same-origin-domain target, the rectangle is then
-    //        expanded according to the offsets in the IntersectionObserver’s [[rootMargin]] slot in a manner similar
-    //        to CSS’s margin property, with the four values indicating the amount the top, right, bottom, and left
-    //        edges, respectively, are offset by, with positive lengths indicating an outward offset. Percentages
-    //        are resolved relative to the width of the undilated rectangle.
+    // When calculating the root intersection rectangle for a same-origin-domain target, the rectangle is then
+    // expanded according to the offsets in the IntersectionObserver’s [[rootMargin]] slot in a manner similar
+    // to CSS’s margin property, with the four values indicating the amount the top, right, bottom, and left
+    // edges, respectively, are offset by, with positive lengths indicating an outward offset. Percentages
+    // are resolved relative to the width of the undilated rectangle.
+    // FIXME: Only do this for targets that are same-origin-domain with the intersection root.
+    auto resolve_margin = [&](CSS::LengthPercentage const& margin) {
+        if (margin.is_percentage())
+            return rect.width().scaled(margin.percentage().as_fraction());
+        return margin.length().absolute_length_to_px();
+    };
+    VERIFY(m_root_margin.size() == 4);
+    rect.inflate(resolve_margin(m_root_margin[0]), resolve_margin(m_root_margin[1]), resolve_margin(m_root_margin[2]), resolve_margin(m_root_margin[3]));
 
     return rect;
 }
@@ -8,6 +8,7 @@
 
 #include <LibJS/Heap/Handle.h>
 #include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/CSS/PercentageOr.h>
 #include <LibWeb/IntersectionObserver/IntersectionObserverEntry.h>
 #include <LibWeb/PixelUnits.h>
 
@@ -53,6 +54,7 @@ public:
     Vector<JS::NonnullGCPtr<DOM::Element>> const& observation_targets() const { return m_observation_targets; }
 
     Variant<JS::Handle<DOM::Element>, JS::Handle<DOM::Document>, Empty> root() const;
+    String root_margin() const;
     Vector<double> const& thresholds() const { return m_thresholds; }
 
     Variant<JS::Handle<DOM::Element>, JS::Handle<DOM::Document>> intersection_root() const;
@@ -63,7 +65,7 @@ public:
     WebIDL::CallbackType& callback() { return *m_callback; }
 
 private:
-    explicit IntersectionObserver(JS::Realm&, JS::GCPtr<WebIDL::CallbackType> callback, Optional<Variant<JS::Handle<DOM::Element>, JS::Handle<DOM::Document>>> const& root, Vector<double>&& thresholds);
+    explicit IntersectionObserver(JS::Realm&, JS::GCPtr<WebIDL::CallbackType> callback, Optional<Variant<JS::Handle<DOM::Element>, JS::Handle<DOM::Document>>> const& root, Vector<CSS::LengthPercentage>&& root_margin, Vector<double>&& thresholds);
 
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(JS::Cell::Visitor&) override;
@@ -75,6 +77,9 @@ private:
     // https://www.w3.org/TR/intersection-observer/#dom-intersectionobserver-root
     JS::GCPtr<DOM::Node> m_root;
 
+    // https://w3c.github.io/IntersectionObserver/#dom-intersectionobserver-rootmargin-slot
+    Vector<CSS::LengthPercentage> m_root_margin;
+
     // https://www.w3.org/TR/intersection-observer/#dom-intersectionobserver-thresholds
     Vector<double> m_thresholds;
 
@@ -28,6 +28,16 @@ Box::~Box()
 {
 }
 
+Box::IntrinsicSizes& Box::cached_intrinsic_sizes() const
+{
+    auto generation = document().intrinsic_sizes_generation();
+    if (!m_cached_intrinsic_sizes || m_cached_intrinsic_sizes_generation != generation) {
+        m_cached_intrinsic_sizes = make<IntrinsicSizes>();
+        m_cached_intrinsic_sizes_generation = generation;
+    }
+    return *m_cached_intrinsic_sizes;
+}
+
 // https://www.w3.org/TR/css-overflow-3/#overflow-control
 static bool overflow_value_makes_box_a_scroll_container(CSS::Overflow overflow)
 {
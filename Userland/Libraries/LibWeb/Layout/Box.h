@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
 #include <AK/OwnPtr.h>
 #include <LibGfx/Rect.h>
 #include <LibJS/Heap/Cell.h>
@@ -54,6 +55,17 @@ public:
 
     bool is_user_scrollable() const;
 
+    // We cache intrinsic sizes once determined, as they are expensive to compute and are needed repeatedly
+    // during flex and grid layout. The cache is kept across layout passes until the document's content changes.
+    struct IntrinsicSizes {
+        Optional<CSSPixels> min_content_width;
+        Optional<CSSPixels> max_content_width;
+
+        HashMap<CSSPixels, Optional<CSSPixels>> min_content_height;
+        HashMap<CSSPixels, Optional<CSSPixels>> max_content_height;
+    };
+    IntrinsicSizes& cached_intrinsic_sizes() const;
+
 protected:
     Box(DOM::Document&, DOM::Node*, NonnullRefPtr<CSS::StyleProperties>);
     Box(DOM::Document&, DOM::Node*, NonnullOwnPtr<CSS::ComputedValues>);
@@ -64,6 +76,9 @@ private:
     Optional<CSSPixels> m_natural_width;
     Optional<CSSPixels> m_natural_height;
     Optional<CSSPixelFraction> m_natural_aspect_ratio;
+
+    mutable OwnPtr<IntrinsicSizes> m_cached_intrinsic_sizes;
+    mutable u64 m_cached_intrinsic_sizes_generation { 0 };
 };
 
 template<>
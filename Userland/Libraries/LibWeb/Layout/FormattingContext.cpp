@@ -223,6 +223,12 @@ OwnPtr<FormattingContext> FormattingContext::layout_inside(Box const& child_box,
     if (!child_box.can_have_children())
         return {};
 
+    // FIXME: Independent formatting contexts whose size doesn't depend on their contents (fixed-size boxes,
+    //        grid items in definite tracks, size-contained boxes) could be laid out in parallel. That isn't
+    //        safe today: the layout tree and its computed values are GC-heap objects shared across the whole
+    //        document, font and shaping caches are not thread-safe, and every nested LayoutState writes
+    //        through get_mutable() into a shared parent chain. We'd need thread-confined sub-states that are
+    //        merged back with commit()-like semantics, and a way to run the GC heap off the main thread.
     auto independent_formatting_context = create_independent_formatting_context_if_needed(m_state, child_box);
     if (independent_formatting_context)
         independent_formatting_context->run(child_box, layout_mode, available_space);
@@ -1440,9 +1446,7 @@ CSSPixels FormattingContext::calculate_min_content_width(Layout::Box const& box)
     if (box.has_natural_width())
         return *box.natural_width();
 
-    auto& root_state = m_state.m_root;
-
-    auto& cache = *root_state.intrinsic_sizes.ensure(&box, [] { return adopt_own(*new LayoutState::IntrinsicSizes); });
+    auto& cache = box.cached_intrinsic_sizes();
     if (cache.min_content_width.has_value())
         return *cache.min_content_width;
 
@@ -1478,9 +1482,7 @@ CSSPixels FormattingContext::calculate_max_content_width(Layout::Box const& box)
     if (box.has_natural_width())
         return *box.natural_width();
 
-    auto& root_state = m_state.m_root;
-
-    auto& cache = *root_state.intrinsic_sizes.ensure(&box, [] { return adopt_own(*new LayoutState::IntrinsicSizes); });
+    auto& cache = box.cached_intrinsic_sizes();
     if (cache.max_content_width.has_value())
         return *cache.max_content_width;
 
@@ -1522,8 +1524,7 @@ CSSPixels FormattingContext::calculate_min_content_height(Layout::Box const& box
         return *box.natural_height();
 
     auto get_cache_slot = [&]() -> Optional<CSSPixels>* {
-        auto& root_state = m_state.m_root;
-        auto& cache = *root_state.intrinsic_sizes.ensure(&box, [] { return adopt_own(*new LayoutState::IntrinsicSizes); });
+        auto& cache = box.cached_intrinsic_sizes();
         return &cache.min_content_height.ensure(width);
     };
 
@@ -1566,8 +1567,7 @@ CSSPixels FormattingContext::calculate_max_content_height(Layout::Box const& box
         return *box.natural_height();
 
     auto get_cache_slot = [&]() -> Optional<CSSPixels>* {
-        auto& root_state = m_state.m_root;
-        auto& cache = *root_state.intrinsic_sizes.ensure(&box, [] { return adopt_own(*new LayoutState::IntrinsicSizes); });
+        auto& cache = box.cached_intrinsic_sizes();
         return &cache.max_content_height.ensure(width);
     };
 
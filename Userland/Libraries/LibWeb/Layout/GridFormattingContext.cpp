@@ -5,6 +5,8 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Debug.h>
+#include <LibCore/ElapsedTimer.h>
 #include <LibWeb/DOM/Node.h>
 #include <LibWeb/Layout/Box.h>
 #include <LibWeb/Layout/GridFormattingContext.h>
@@ -1719,6 +1721,19 @@ CSSPixelRect GridFormattingContext::get_grid_area_rect(GridItem const& grid_item
 }
 
 void GridFormattingContext::run(Box const&, LayoutMode, AvailableSpace const& available_space)
+{
+    if constexpr (LIBWEB_CSS_DEBUG) {
+        auto timer = Core::ElapsedTimer::start_new();
+        layout_grid(available_space);
+        auto& statistics = m_state.grid_layout_statistics();
+        ++statistics.layout_count;
+        statistics.elapsed_time += timer.elapsed_time();
+    } else {
+        layout_grid(available_space);
+    }
+}
+
+void GridFormattingContext::layout_grid(AvailableSpace const& available_space)
 {
     m_available_space = available_space;
 
@@ -113,6 +113,8 @@ public:
     Box const& grid_container() const { return context_box(); }
 
 private:
+    void layout_grid(AvailableSpace const&);
+
     CSS::JustifyItems justification_for_item(Box const& box) const;
     CSS::AlignItems alignment_for_item(Box const& box) const;
 
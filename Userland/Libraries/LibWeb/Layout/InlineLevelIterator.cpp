@@ -195,16 +195,11 @@ Optional<InlineLevelIterator::Item> InlineLevelIterator::next_without_lookahead(
             };
         }
 
-        Vector<Gfx::DrawGlyphOrEmoji> glyph_run;
-        float glyph_run_width = 0;
-        Gfx::for_each_glyph_position(
-            { 0, 0 }, chunk.view, chunk.font, [&](Gfx::DrawGlyphOrEmoji const& glyph_or_emoji) {
-                glyph_run.append(glyph_or_emoji);
-                return IterationDecision::Continue;
-            },
-            Gfx::IncludeLeftBearing::No, glyph_run_width);
-
-        CSSPixels chunk_width = CSSPixels::nearest_value_for(glyph_run_width);
+        // NOTE: The glyph run is copied out of the cache, as LineBox modifies it when merging fragments.
+        auto const& shaped_chunk = text_node.shaped_chunk(chunk);
+        auto glyph_run = shaped_chunk.glyphs;
+
+        CSSPixels chunk_width = CSSPixels::nearest_value_for(shaped_chunk.width);
 
         // NOTE: We never consider `content: ""` to be collapsible whitespace.
         bool is_generated_empty_string = text_node.is_generated() && chunk.length == 0;
@@ -21,7 +21,6 @@ namespace Web::Layout {
 
 LayoutState::LayoutState(LayoutState const* parent)
     : m_parent(parent)
-    , m_root(find_root())
 {
 }
 
@@ -29,46 +28,74 @@ LayoutState::~LayoutState()
 {
 }
 
+LayoutState::GridLayoutStatistics& LayoutState::grid_layout_statistics() const
+{
+    auto const* root = this;
+    while (root->m_parent)
+        root = root->m_parent;
+    return root->m_grid_layout_statistics;
+}
+
+LayoutState::UsedValues const* LayoutState::find_own_used_values(NodeWithStyle const& node) const
+{
+    if (m_parent)
+        return used_values_per_layout_node.get(node).value_or(nullptr);
+
+    auto index = node.layout_index();
+    if (index >= dense_used_values.size())
+        return nullptr;
+    auto const* used_values = dense_used_values[index].ptr();
+    VERIFY(!used_values || &used_values->node() == &node);
+    return used_values;
+}
+
+LayoutState::UsedValues& LayoutState::set_own_used_values(NodeWithStyle const& node, NonnullOwnPtr<UsedValues> used_values)
+{
+    auto* used_values_ptr = used_values.ptr();
+    if (m_parent) {
+        used_values_per_layout_node.set(node, move(used_values));
+        return *used_values_ptr;
+    }
+
+    auto index = node.layout_index();
+    if (index >= dense_used_values.size())
+        dense_used_values.resize(index + 1);
+    dense_used_values[index] = move(used_values);
+    return *used_values_ptr;
+}
+
 LayoutState::UsedValues& LayoutState::get_mutable(NodeWithStyle const& node)
 {
-    if (auto* used_values = used_values_per_layout_node.get(node).value_or(nullptr))
-        return *used_values;
+    if (auto const* used_values = find_own_used_values(node))
+        return const_cast<UsedValues&>(*used_values);
 
     for (auto const* ancestor = m_parent; ancestor; ancestor = ancestor->m_parent) {
-        if (auto* ancestor_used_values = ancestor->used_values_per_layout_node.get(node).value_or(nullptr)) {
-            auto cow_used_values = adopt_own(*new UsedValues(*ancestor_used_values));
-            auto* cow_used_values_ptr = cow_used_values.ptr();
-            used_values_per_layout_node.set(node, move(cow_used_values));
-            return *cow_used_values_ptr;
-        }
+        if (auto const* ancestor_used_values = ancestor->find_own_used_values(node))
+            return set_own_used_values(node, adopt_own(*new UsedValues(*ancestor_used_values)));
     }
 
     auto const* containing_block_used_values = node.is_viewport() ? nullptr : &get(*node.containing_block());
 
     auto new_used_values = adopt_own(*new UsedValues);
-    auto* new_used_values_ptr = new_used_values.ptr();
     new_used_values->set_node(const_cast<NodeWithStyle&>(node), containing_block_used_values);
-    used_values_per_layout_node.set(node, move(new_used_values));
-    return *new_used_values_ptr;
+    return set_own_used_values(node, move(new_used_values));
 }
 
 LayoutState::UsedValues const& LayoutState::get(NodeWithStyle const& node) const
 {
-    if (auto const* used_values = used_values_per_layout_node.get(node).value_or(nullptr))
+    if (auto const* used_values = find_own_used_values(node))
         return *used_values;
 
     for (auto const* ancestor = m_parent; ancestor; ancestor = ancestor->m_parent) {
-        if (auto const* ancestor_used_values = ancestor->used_values_per_layout_node.get(node).value_or(nullptr))
+        if (auto const* ancestor_used_values = ancestor->find_own_used_values(node))
             return *ancestor_used_values;
     }
 
     auto const* containing_block_used_values = node.is_viewport() ? nullptr : &get(*node.containing_block());
 
     auto new_used_values = adopt_own(*new UsedValues);
-    auto* new_used_values_ptr = new_used_values.ptr();
     new_used_values->set_node(const_cast<NodeWithStyle&>(node), containing_block_used_values);
-    const_cast<LayoutState*>(this)->used_values_per_layout_node.set(node, move(new_used_values));
-    return *new_used_values_ptr;
+    return const_cast<LayoutState*>(this)->set_own_used_values(node, move(new_used_values));
 }
 
 // https://www.w3.org/TR/css-overflow-3/#scrollable-overflow
@@ -149,8 +176,10 @@ void LayoutState::resolve_relative_positions()
 {
     // This function resolves relative position offsets of fragments that belong to inline paintables.
     // It runs *after* the paint tree has been constructed, so it modifies paintable node & fragment offsets directly.
-    for (auto& it : used_values_per_layout_node) {
-        auto& used_values = *it.value;
+    for (auto& entry : dense_used_values) {
+        if (!entry)
+            continue;
+        auto& used_values = *entry;
         auto& node = const_cast<NodeWithStyle&>(used_values.node());
 
         auto* paintable = node.paintable();
@@ -221,8 +250,10 @@ void LayoutState::commit(Box& root)
 
     Vector<Painting::PaintableWithLines&> paintables_with_lines;
 
-    for (auto& it : used_values_per_layout_node) {
-        auto& used_values = *it.value;
+    for (auto& entry : dense_used_values) {
+        if (!entry)
+            continue;
+        auto& used_values = *entry;
         auto& node = const_cast<NodeWithStyle&>(used_values.node());
 
         if (is<NodeWithStyleAndBoxModelMetrics>(node)) {
@@ -274,8 +305,10 @@ void LayoutState::commit(Box& root)
     // Resolve relative positions for regular boxes (not line box fragments):
     // NOTE: This needs to occur before fragments are transferred into the corresponding inline paintables, because
     //       after this transfer, the containing_line_box_fragment will no longer be valid.
-    for (auto& it : used_values_per_layout_node) {
-        auto& used_values = *it.value;
+    for (auto& entry : dense_used_values) {
+        if (!entry)
+            continue;
+        auto& used_values = *entry;
         auto& node = const_cast<NodeWithStyle&>(used_values.node());
 
         if (!node.is_box())
@@ -353,8 +386,10 @@ void LayoutState::commit(Box& root)
     resolve_relative_positions();
 
     // Measure overflow in scroll containers.
-    for (auto& it : used_values_per_layout_node) {
-        auto& used_values = *it.value;
+    for (auto& entry : dense_used_values) {
+        if (!entry)
+            continue;
+        auto& used_values = *entry;
         if (!used_values.node().is_box())
             continue;
         auto const& box = static_cast<Layout::Box const&>(used_values.node());
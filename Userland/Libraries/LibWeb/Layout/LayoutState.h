@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/HashMap.h>
+#include <AK/Time.h>
 #include <LibGfx/Point.h>
 #include <LibWeb/Layout/Box.h>
 #include <LibWeb/Layout/LineBox.h>
@@ -25,22 +26,11 @@ class AvailableSize;
 class AvailableSpace;
 
 struct LayoutState {
-    LayoutState()
-        : m_root(*this)
-    {
-    }
+    LayoutState() = default;
 
     explicit LayoutState(LayoutState const* parent);
     ~LayoutState();
 
-    LayoutState const& find_root() const
-    {
-        LayoutState const* root = this;
-        for (auto* state = m_parent; state; state = state->m_parent)
-            root = state;
-        return *root;
-    }
-
     struct UsedValues {
         NodeWithStyle const& node() const { return *m_node; }
         void set_node(NodeWithStyle&, UsedValues const* containing_block_used_values);
@@ -176,25 +166,28 @@ struct LayoutState {
     // NOTE: get() will not CoW the UsedValues.
     UsedValues const& get(NodeWithStyle const&) const;
 
+    // NOTE: The root state has used values for nearly every node, so it stores them densely, indexed by Node::layout_index().
+    //       Nested states are short-lived and only touch a few nodes, so they keep a sparse map on top of their parent's values.
+    Vector<OwnPtr<UsedValues>> dense_used_values;
     HashMap<JS::NonnullGCPtr<Layout::Node const>, NonnullOwnPtr<UsedValues>> used_values_per_layout_node;
 
-    // We cache intrinsic sizes once determined, as they will not change over the course of a full layout.
-    // This avoids computing them several times while performing flex layout.
-    struct IntrinsicSizes {
-        Optional<CSSPixels> min_content_width;
-        Optional<CSSPixels> max_content_width;
+    LayoutState const* m_parent { nullptr };
 
-        HashMap<CSSPixels, Optional<CSSPixels>> min_content_height;
-        HashMap<CSSPixels, Optional<CSSPixels>> max_content_height;
+    // NOTE: Nested states forward to the root state, so the totals include grid layouts done for intrinsic sizing.
+    //       These are only collected when LibWeb is built with LIBWEB_CSS_DEBUG.
+    struct GridLayoutStatistics {
+        size_t layout_count { 0 };
+        AK::Duration elapsed_time;
     };
-
-    HashMap<JS::GCPtr<NodeWithStyle const>, NonnullOwnPtr<IntrinsicSizes>> mutable intrinsic_sizes;
-
-    LayoutState const* m_parent { nullptr };
-    LayoutState const& m_root;
+    GridLayoutStatistics& grid_layout_statistics() const;
 
 private:
+    UsedValues const* find_own_used_values(NodeWithStyle const&) const;
+    UsedValues& set_own_used_values(NodeWithStyle const&, NonnullOwnPtr<UsedValues>);
+
     void resolve_relative_positions();
+
+    mutable GridLayoutStatistics m_grid_layout_statistics;
 };
 
 }
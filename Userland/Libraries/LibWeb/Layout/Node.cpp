@@ -41,6 +41,7 @@ Node::Node(DOM::Document& document, DOM::Node* node)
     : m_dom_node(node ? *node : document)
     , m_browsing_context(*document.browsing_context())
     , m_anonymous(node == nullptr)
+    , m_layout_index(document.allocate_layout_node_index({}))
 {
     if (node)
         node->set_layout_node({}, *this);
@@ -201,6 +202,14 @@ bool Node::establishes_stacking_context() const
     if (computed_values().mask().has_value() || computed_values().clip_path().has_value())
         return true;
 
+    // https://drafts.csswg.org/css-will-change/#will-change
+    // If any non-initial value of a property would create a stacking context on the element, specifying that property
+    // in will-change must create a stacking context on the element.
+    for (auto property_id : computed_values().will_change()) {
+        if (CSS::property_affects_stacking_context(property_id) || property_id == CSS::PropertyID::Position)
+            return true;
+    }
+
     return computed_values().opacity() < 1.0f;
 }
 
@@ -605,6 +614,9 @@ void NodeWithStyle::apply_style(const CSS::StyleProperties& computed_style)
     if (clear.has_value())
         computed_values.set_clear(clear.value());
 
+    if (auto content_visibility = computed_style.content_visibility(); content_visibility.has_value())
+        computed_values.set_content_visibility(content_visibility.value());
+
     auto overflow_x = computed_style.overflow_x();
     if (overflow_x.has_value())
         computed_values.set_overflow_x(overflow_x.value());
@@ -677,6 +689,7 @@ void NodeWithStyle::apply_style(const CSS::StyleProperties& computed_style)
     computed_values.set_box_shadow(computed_style.box_shadow(*this));
 
     computed_values.set_transformations(computed_style.transformations());
+    computed_values.set_will_change(computed_style.will_change());
     if (auto transform_box = computed_style.transform_box(); transform_box.has_value())
         computed_values.set_transform_box(transform_box.value());
     computed_values.set_transform_origin(computed_style.transform_origin());
@@ -164,6 +164,8 @@ public:
     u32 initial_quote_nesting_level() const { return m_initial_quote_nesting_level; }
     void set_initial_quote_nesting_level(u32 value) { m_initial_quote_nesting_level = value; }
 
+    size_t layout_index() const { return m_layout_index; }
+
 protected:
     Node(DOM::Document&, DOM::Node*);
 
@@ -189,6 +191,8 @@ private:
     GeneratedFor m_generated_for { GeneratedFor::NotGenerated };
 
     u32 m_initial_quote_nesting_level { 0 };
+
+    size_t m_layout_index { 0 };
 };
 
 class NodeWithStyle : public Node {
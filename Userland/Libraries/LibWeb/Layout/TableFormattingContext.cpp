@@ -103,6 +103,8 @@ void TableFormattingContext::compute_cell_measures()
 
     compute_constrainedness();
 
+    auto use_fixed_mode_layout = this->use_fixed_mode_layout();
+
     for (auto& cell : m_cells) {
         auto const& computed_values = cell.box->computed_values();
         CSSPixels padding_top = computed_values.padding().top().to_px(cell.box, containing_block.content_height());
@@ -118,14 +120,26 @@ void TableFormattingContext::compute_cell_measures()
         CSSPixels border_left = use_collapsing_borders_model ? round(cell_state.border_left / 2) : computed_values.border_left().width;
         CSSPixels border_right = use_collapsing_borders_model ? round(cell_state.border_right / 2) : computed_values.border_right().width;
 
+        auto min_height = computed_values.min_height().to_px(cell.box, containing_block.content_height());
+        auto cell_intrinsic_height_offsets = padding_top + padding_bottom + border_top + border_bottom;
+
+        // OPTIMIZATION: In fixed mode, only cells in the first row contribute to the column widths, and the height of each row
+        //               comes from laying out its cells at their used widths in compute_table_height(). Cells in later rows that
+        //               only span a single row therefore don't need to be measured, which avoids intrinsic sizing of almost every
+        //               cell in large fixed-layout tables. Their outer sizes are computed as if the content sizes were zero.
+        if (use_fixed_mode_layout && cell.row_index != 0 && cell.row_span == 1) {
+            auto height = computed_values.height().is_length() ? computed_values.height().to_px(cell.box, containing_block.content_height()) : 0;
+            cell.outer_min_height = min_height + cell_intrinsic_height_offsets;
+            cell.outer_max_height = max(min_height, height) + cell_intrinsic_height_offsets;
+            continue;
+        }
+
         auto min_content_width = calculate_min_content_width(cell.box);
         auto max_content_width = calculate_max_content_width(cell.box);
         auto min_content_height = calculate_min_content_height(cell.box, max_content_width);
         auto max_content_height = calculate_max_content_height(cell.box, min_content_width);
 
         // The outer min-content height of a table-cell is max(min-height, min-content height) adjusted by the cell intrinsic offsets.
-        auto min_height = computed_values.min_height().to_px(cell.box, containing_block.content_height());
-        auto cell_intrinsic_height_offsets = padding_top + padding_bottom + border_top + border_bottom;
         cell.outer_min_height = max(min_height, min_content_height) + cell_intrinsic_height_offsets;
         // The outer min-content width of a table-cell is max(min-width, min-content width) adjusted by the cell intrinsic offsets.
         auto min_width = computed_values.min_width().to_px(cell.box, containing_block.content_width());
@@ -134,7 +148,7 @@ void TableFormattingContext::compute_cell_measures()
         // The min-content and max-content width of cells is considered zero unless they are directly specified as a length-percentage,
         // in which case they are resolved based on the table width (if it is definite, otherwise use 0).
         auto width_is_specified_length_or_percentage = computed_values.width().is_length() || computed_values.width().is_percentage();
-        if (!use_fixed_mode_layout() || width_is_specified_length_or_percentage) {
+        if (!use_fixed_mode_layout || width_is_specified_length_or_percentage) {
             cell.outer_min_width = max(min_width, min_content_width) + cell_intrinsic_width_offsets;
         }
 
@@ -157,7 +171,7 @@ void TableFormattingContext::compute_cell_measures()
         // See the explanation for height and max_height above.
         auto width = computed_values.width().is_length() ? computed_values.width().to_px(cell.box, containing_block.content_width()) : 0;
         auto max_width = computed_values.max_width().is_length() ? computed_values.max_width().to_px(cell.box, containing_block.content_width()) : CSSPixels::max();
-        if (use_fixed_mode_layout() && !width_is_specified_length_or_percentage) {
+        if (use_fixed_mode_layout && !width_is_specified_length_or_percentage) {
             continue;
         }
         if (m_columns[cell.column_index].is_constrained) {
@@ -304,6 +304,26 @@ static ErrorOr<String> apply_text_transform(String const& string, CSS::TextTrans
 void TextNode::invalidate_text_for_rendering()
 {
     m_text_for_rendering = {};
+    m_shaped_chunks_by_start.clear();
+}
+
+TextNode::ShapedChunk const& TextNode::shaped_chunk(Chunk const& chunk) const
+{
+    if (auto it = m_shaped_chunks_by_start.find(chunk.start); it != m_shaped_chunks_by_start.end()) {
+        if (it->value.length == chunk.length && it->value.font.ptr() == chunk.font.ptr())
+            return it->value;
+    }
+
+    ShapedChunk shaped_chunk { chunk.font, chunk.length, {}, 0 };
+    Gfx::for_each_glyph_position(
+        { 0, 0 }, chunk.view, chunk.font, [&](Gfx::DrawGlyphOrEmoji const& glyph_or_emoji) {
+            shaped_chunk.glyphs.append(glyph_or_emoji);
+            return IterationDecision::Continue;
+        },
+        Gfx::IncludeLeftBearing::No, shaped_chunk.width);
+
+    m_shaped_chunks_by_start.set(chunk.start, move(shaped_chunk));
+    return m_shaped_chunks_by_start.find(chunk.start)->value;
 }
 
 String const& TextNode::text_for_rendering() const
@@ -316,6 +336,8 @@ String const& TextNode::text_for_rendering() const
 // NOTE: This collapses whitespace into a single ASCII space if the CSS white-space property tells us to.
 void TextNode::compute_text_for_rendering()
 {
+    m_shaped_chunks_by_start.clear();
+
     bool collapse = [](CSS::WhiteSpace white_space) {
         switch (white_space) {
         case CSS::WhiteSpace::Normal:
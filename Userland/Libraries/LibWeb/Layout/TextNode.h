@@ -6,7 +6,9 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
 #include <AK/Utf8View.h>
+#include <LibGfx/TextLayout.h>
 #include <LibWeb/DOM/Text.h>
 #include <LibWeb/Layout/Node.h>
 
@@ -53,12 +55,24 @@ public:
     void invalidate_text_for_rendering();
     void compute_text_for_rendering();
 
+    struct ShapedChunk {
+        NonnullRefPtr<Gfx::Font> font;
+        size_t length { 0 };
+        Vector<Gfx::DrawGlyphOrEmoji> glyphs;
+        float width { 0 };
+    };
+
+    // Returns the glyphs of a chunk positioned from (0, 0), along with their total advance.
+    // These are cached until the text for rendering changes, so relayouts don't have to shape the text again.
+    ShapedChunk const& shaped_chunk(Chunk const&) const;
+
     virtual JS::GCPtr<Painting::Paintable> create_paintable() const override;
 
 private:
     virtual bool is_text_node() const final { return true; }
 
     Optional<String> m_text_for_rendering;
+    mutable HashMap<size_t, ShapedChunk> m_shaped_chunks_by_start;
 };
 
 template<>
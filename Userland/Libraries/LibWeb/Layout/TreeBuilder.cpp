@@ -289,6 +289,17 @@ i32 TreeBuilder::calculate_list_item_index(DOM::Node& dom_node)
     return 1;
 }
 
+static void remove_stale_layout_nodes_in_inclusive_subtree(DOM::Node& dom_node)
+{
+    dom_node.for_each_in_inclusive_subtree([&](auto& node) {
+        node.detach_layout_node({});
+        node.set_paintable(nullptr);
+        if (is<DOM::Element>(node))
+            static_cast<DOM::Element&>(node).clear_pseudo_element_nodes({});
+        return TraversalDecision::Continue;
+    });
+}
+
 void TreeBuilder::create_layout_tree(DOM::Node& dom_node, TreeBuilder::Context& context)
 {
     if (dom_node.is_element()) {
@@ -310,15 +321,8 @@ void TreeBuilder::create_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
     ScopeGuard remove_stale_layout_node_guard = [&] {
         // If we didn't create a layout node for this DOM node,
         // go through the DOM tree and remove any old layout & paint nodes since they are now all stale.
-        if (!layout_node) {
-            dom_node.for_each_in_inclusive_subtree([&](auto& node) {
-                node.detach_layout_node({});
-                node.set_paintable(nullptr);
-                if (is<DOM::Element>(node))
-                    static_cast<DOM::Element&>(node).clear_pseudo_element_nodes({});
-                return TraversalDecision::Continue;
-            });
-        }
+        if (!layout_node)
+            remove_stale_layout_nodes_in_inclusive_subtree(dom_node);
     };
 
     if (dom_node.is_svg_container()) {
@@ -374,15 +378,34 @@ void TreeBuilder::create_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
 
     auto shadow_root = is<DOM::Element>(dom_node) ? verify_cast<DOM::Element>(dom_node).shadow_root() : nullptr;
 
+    // NOTE: The rendering update re-determines the proximity to the viewport of these elements, so keep track of them
+    //       here instead of walking the whole layout tree every frame.
+    if (is<DOM::Element>(dom_node) && is<Box>(*layout_node) && layout_node->computed_values().content_visibility() == CSS::ContentVisibility::Auto)
+        document.register_content_visibility_auto_element({}, static_cast<DOM::Element&>(dom_node));
+
+    // https://drafts.csswg.org/css-contain-2/#skips-its-contents
+    // NOTE: An element that skips its contents still generates its own box, but its descendants and ::before/::after
+    //       don't get any, so they are neither laid out nor painted. With no children the box is also sized as if
+    //       it had size containment, which is what content-visibility requires.
+    bool skips_its_contents = is<DOM::Element>(dom_node) && static_cast<DOM::Element const&>(dom_node).skips_its_contents();
+    if (skips_its_contents) {
+        if (shadow_root) {
+            for (auto* node = shadow_root->first_child(); node; node = node->next_sibling())
+                remove_stale_layout_nodes_in_inclusive_subtree(*node);
+        }
+        for (auto* node = verify_cast<DOM::ParentNode>(dom_node).first_child(); node; node = node->next_sibling())
+            remove_stale_layout_nodes_in_inclusive_subtree(*node);
+    }
+
     // Add node for the ::before pseudo-element.
-    if (is<DOM::Element>(dom_node) && layout_node->can_have_children()) {
+    if (is<DOM::Element>(dom_node) && layout_node->can_have_children() && !skips_its_contents) {
         auto& element = static_cast<DOM::Element&>(dom_node);
         push_parent(verify_cast<NodeWithStyle>(*layout_node));
         create_pseudo_element_if_needed(element, CSS::Selector::PseudoElement::Type::Before, AppendOrPrepend::Prepend);
         pop_parent();
     }
 
-    if ((dom_node.has_children() || shadow_root) && layout_node->can_have_children()) {
+    if ((dom_node.has_children() || shadow_root) && layout_node->can_have_children() && !skips_its_contents) {
         push_parent(verify_cast<NodeWithStyle>(*layout_node));
         if (shadow_root) {
             for (auto* node = shadow_root->first_child(); node; node = node->next_sibling()) {
@@ -413,7 +436,7 @@ void TreeBuilder::create_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
         layout_node->append_child(*list_item_marker);
     }
 
-    if (is<HTML::HTMLSlotElement>(dom_node)) {
+    if (is<HTML::HTMLSlotElement>(dom_node) && !skips_its_contents) {
         auto slottables = static_cast<HTML::HTMLSlotElement&>(dom_node).assigned_nodes_internal();
         push_parent(verify_cast<NodeWithStyle>(*layout_node));
 
@@ -502,7 +525,7 @@ void TreeBuilder::create_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
     }
 
     // Add nodes for the ::after pseudo-element.
-    if (is<DOM::Element>(dom_node) && layout_node->can_have_children()) {
+    if (is<DOM::Element>(dom_node) && layout_node->can_have_children() && !skips_its_contents) {
         auto& element = static_cast<DOM::Element&>(dom_node);
         push_parent(verify_cast<NodeWithStyle>(*layout_node));
         create_pseudo_element_if_needed(element, CSS::Selector::PseudoElement::Type::After, AppendOrPrepend::Append);
@@ -510,6 +533,13 @@ void TreeBuilder::create_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
     }
 }
 
+// FIXME: We always build the complete layout tree, with (at least) one GC-allocated node per rendered DOM node.
+//        Documents with millions of lines of text would benefit from a compact representation of long runs of
+//        simple text blocks that is only expanded into nodes near the viewport. That needs layout to size such a
+//        run without its nodes, painting and hit testing to work on it, and every DOM API that reaches for a
+//        layout node (client rects, selection, scrolling into view) to expand it on demand. Until then, authors
+//        can get most of the benefit with content-visibility: auto, which skips building the contents of
+//        offscreen elements.
 JS::GCPtr<Layout::Node> TreeBuilder::build(DOM::Node& dom_node)
 {
     VERIFY(dom_node.is_document());
@@ -12,6 +12,7 @@
 #include <LibCore/ElapsedTimer.h>
 #include <LibURL/URL.h>
 #include <LibWeb/Forward.h>
+#include <LibWeb/HTML/Origin.h>
 #include <LibWeb/Page/Page.h>
 
 namespace Web {
@@ -40,6 +41,19 @@ public:
     ByteBuffer const& body() const { return m_body; }
     void set_body(ByteBuffer body) { m_body = move(body); }
 
+    // The origin of the document on whose behalf the request is made, if any.
+    Optional<HTML::Origin> const& initiator_origin() const { return m_initiator_origin; }
+    void set_initiator_origin(HTML::Origin origin) { m_initiator_origin = move(origin); }
+
+    // Whether this request navigates a navigable, as opposed to loading a subresource or being made by fetch() or XHR.
+    bool is_navigation_request() const { return m_navigation_request; }
+    void set_navigation_request(bool b) { m_navigation_request = b; }
+
+    // Whether the response may come from a stored response, such as a prefetched one. This is false for requests whose
+    // cache mode is "no-store", "reload" or "no-cache".
+    bool may_use_stored_response() const { return m_may_use_stored_response; }
+    void set_may_use_stored_response(bool b) { m_may_use_stored_response = b; }
+
     void start_timer() { m_load_timer.start(); }
     Duration load_time() const { return m_load_timer.elapsed_time(); }
 
@@ -82,6 +96,9 @@ private:
     Core::ElapsedTimer m_load_timer;
     JS::Handle<Page> m_page;
     bool m_main_resource { false };
+    Optional<HTML::Origin> m_initiator_origin;
+    bool m_navigation_request { false };
+    bool m_may_use_stored_response { true };
 };
 
 }
@@ -9,6 +9,7 @@
 #include <LibCore/DateTime.h>
 #include <LibCore/Directory.h>
 #include <LibCore/ElapsedTimer.h>
+#include <LibCore/MappedFile.h>
 #include <LibCore/MimeData.h>
 #include <LibCore/Resource.h>
 #include <LibWeb/Cookie/Cookie.h>
@@ -89,6 +90,81 @@ void ResourceLoader::preconnect(URL::URL const& url)
     m_connector->preconnect(url);
 }
 
+void ResourceLoader::prefetch(LoadRequest const& request)
+{
+    auto const& url = request.url();
+    if (!url.scheme().is_one_of("http"sv, "https"sv) || request.method() != "GET"sv || !request.initiator_origin().has_value())
+        return;
+
+    if (ContentFilter::the().is_filtered(url)) {
+        dbgln("ResourceLoader: Refusing to prefetch '{}': \033[31;1mURL was filtered\033[0m", url);
+        return;
+    }
+
+    auto key = url.serialize(URL::ExcludeFragment::Yes);
+    if (m_prefetched_responses.contains(key))
+        return;
+    if (m_prefetch_in_flight_key == key)
+        return;
+    for (auto const& queued_prefetch : m_queued_prefetches) {
+        if (queued_prefetch.url().serialize(URL::ExcludeFragment::Yes) == key)
+            return;
+    }
+
+    m_queued_prefetches.append(request);
+    start_next_prefetch_if_idle();
+}
+
+void ResourceLoader::start_next_prefetch_if_idle()
+{
+    // NOTE: Prefetches run one at a time, and only while nothing else is loading, so that they don't compete with the
+    //       current page for bandwidth and connections. They also don't count as pending loads.
+    if (m_pending_loads > 0 || !m_prefetch_in_flight_key.is_empty() || m_queued_prefetches.is_empty())
+        return;
+
+    auto request = m_queued_prefetches.take_first();
+    auto protocol_request = start_connector_request(request);
+    if (!protocol_request) {
+        start_next_prefetch_if_idle();
+        return;
+    }
+
+    dbgln_if(CACHE_DEBUG, "ResourceLoader: Prefetching {}", request.url());
+    m_prefetch_in_flight_key = request.url().serialize(URL::ExcludeFragment::Yes);
+
+    auto on_prefetch_finished = [this, request, &protocol_request = *protocol_request](bool success, auto, auto& response_headers, auto status_code, ReadonlyBytes payload) {
+        handle_network_response_headers(request, response_headers);
+
+        auto key = exchange(m_prefetch_in_flight_key, {});
+        Platform::EventLoopPlugin::the().deferred_invoke([this, protocol_request = NonnullRefPtr<ResourceLoaderConnectorRequest> { protocol_request }] {
+            m_active_requests.remove(protocol_request);
+            start_next_prefetch_if_idle();
+        });
+
+        if (!success || status_code.value_or(200) < 200 || status_code.value_or(200) > 299)
+            return;
+        if (auto cache_control = response_headers.get("Cache-Control"sv); cache_control.has_value() && cache_control->contains("no-store"sv))
+            return;
+
+        auto body = ByteBuffer::copy(payload);
+        if (body.is_error())
+            return;
+
+        if (m_prefetched_responses.size() >= max_prefetched_response_count) {
+            auto oldest = m_prefetched_responses.begin();
+            for (auto it = m_prefetched_responses.begin(); it != m_prefetched_responses.end(); ++it) {
+                if (it->value.fetched_at < oldest->value.fetched_at)
+                    oldest = it;
+            }
+            m_prefetched_responses.remove(oldest);
+        }
+
+        m_prefetched_responses.set(move(key), PrefetchedResponse { body.release_value(), response_headers, status_code, *request.initiator_origin(), MonotonicTime::now() });
+    };
+
+    protocol_request->set_buffered_request_finished_callback(move(on_prefetch_finished));
+}
+
 static HashMap<LoadRequest, NonnullRefPtr<Resource>> s_resource_cache;
 
 RefPtr<Resource> ResourceLoader::load_resource(Resource::Type type, LoadRequest& request)
@@ -148,6 +224,9 @@ static void store_response_cookies(Page& page, URL::URL const& url, ByteString c
     page.client().page_did_set_cookie(url, cookie.value(), Cookie::Source::Http); // FIXME: Determine cookie source correctly
 }
 
+// Local files at least this large are mapped rather than read into a buffer.
+static constexpr size_t minimum_local_file_size_to_map = 512 * KiB;
+
 static HTTP::HeaderMap response_headers_for_file(StringView path, Optional<time_t> const& modified_time)
 {
     // For file:// and resource:// URLs, we have to guess the MIME type, since there's no HTTP header to tell us what
@@ -218,6 +297,39 @@ static bool should_block_request(LoadRequest const& request)
     return false;
 }
 
+bool ResourceLoader::respond_with_prefetched_response(LoadRequest const& request, SuccessCallback& success_callback)
+{
+    if (m_prefetched_responses.is_empty() || request.method() != "GET"sv || !request.body().is_empty())
+        return false;
+
+    // NOTE: Prefetched responses are only meant to speed up navigations, so they are not handed to fetch() or XHR,
+    //       which may have asked for different headers or credentials. They are also kept apart per origin, so that
+    //       a response prefetched by one site is never seen by a navigation started from another.
+    if (!request.is_navigation_request() || !request.initiator_origin().has_value())
+        return false;
+
+    auto key = request.url().serialize(URL::ExcludeFragment::Yes);
+    auto it = m_prefetched_responses.find(key);
+    if (it == m_prefetched_responses.end() || !it->value.initiator_origin.is_same_origin(*request.initiator_origin()))
+        return false;
+
+    // A prefetched response is used at most once. A reload, or any other request that bypasses stored responses, drops
+    // it as well, as it may be stale by now.
+    auto prefetched_response = m_prefetched_responses.take(key);
+    if (!request.may_use_stored_response())
+        return false;
+    if (MonotonicTime::now() - prefetched_response->fetched_at > prefetched_response_lifetime)
+        return false;
+
+    dbgln_if(CACHE_DEBUG, "ResourceLoader: Using prefetched response for {}", request.url());
+    log_success(request);
+
+    Platform::EventLoopPlugin::the().deferred_invoke([success_callback = move(success_callback), prefetched_response = prefetched_response.release_value()] {
+        success_callback(prefetched_response.body, prefetched_response.headers, prefetched_response.status_code);
+    });
+    return true;
+}
+
 void ResourceLoader::load(LoadRequest& request, SuccessCallback success_callback, ErrorCallback error_callback, Optional<u32> timeout, TimeoutCallback timeout_callback)
 {
     auto const& url = request.url();
@@ -332,6 +444,7 @@ void ResourceLoader::load(LoadRequest& request, SuccessCallback success_callback
             --m_pending_loads;
             if (on_load_counter_change)
                 on_load_counter_change();
+            start_next_prefetch_if_idle();
 
             if (file_or_error.is_error()) {
                 log_failure(request, file_or_error.error());
@@ -359,7 +472,28 @@ void ResourceLoader::load(LoadRequest& request, SuccessCallback success_callback
                 return;
             }
 
-            // Try to read file normally
+            auto response_headers = response_headers_for_file(request.url().serialize_path(), st_or_error.value().st_mtime);
+
+            // NOTE: Map large regular files instead of reading them into a buffer. They are then neither copied nor allocated
+            //       for up front, and only the pages that are actually used get read from disk. Smaller files are read, as
+            //       mapping them wouldn't save much.
+            //       If a mapped file is truncated while the success callback reads it, touching the pages past its new
+            //       end raises SIGBUS. Files that are rewritten in place while they are being loaded are not supported.
+            if (S_ISREG(st_or_error.value().st_mode) && st_or_error.value().st_size >= static_cast<off_t>(minimum_local_file_size_to_map)) {
+                auto maybe_mapped_file = Core::MappedFile::map_from_fd_and_close(fd, request.url().serialize_path());
+                if (maybe_mapped_file.is_error()) {
+                    log_failure(request, maybe_mapped_file.error());
+                    if (error_callback)
+                        error_callback(ByteString::formatted("{}", maybe_mapped_file.error()), 500u, {}, {});
+                    return;
+                }
+
+                log_success(request);
+                success_callback(maybe_mapped_file.value()->bytes(), response_headers, {});
+                return;
+            }
+
+            // Anything else, like a small file or a pipe, is read normally.
             auto maybe_file = Core::File::adopt_fd(fd, Core::File::OpenMode::Read);
             if (maybe_file.is_error()) {
                 log_failure(request, maybe_file.error());
@@ -378,7 +512,6 @@ void ResourceLoader::load(LoadRequest& request, SuccessCallback success_callback
             }
 
             auto data = maybe_data.release_value();
-            auto response_headers = response_headers_for_file(request.url().serialize_path(), st_or_error.value().st_mtime);
 
             log_success(request);
             success_callback(data, response_headers, {});
@@ -394,6 +527,9 @@ void ResourceLoader::load(LoadRequest& request, SuccessCallback success_callback
     }
 
     if (url.scheme() == "http" || url.scheme() == "https") {
+        if (respond_with_prefetched_response(request, success_callback))
+            return;
+
         auto protocol_request = start_network_request(request);
         if (!protocol_request) {
             if (error_callback)
@@ -490,6 +626,19 @@ void ResourceLoader::load_unbuffered(LoadRequest& request, OnHeadersReceived on_
 }
 
 RefPtr<ResourceLoaderConnectorRequest> ResourceLoader::start_network_request(LoadRequest const& request)
+{
+    auto protocol_request = start_connector_request(request);
+    if (!protocol_request)
+        return nullptr;
+
+    ++m_pending_loads;
+    if (on_load_counter_change)
+        on_load_counter_change();
+
+    return protocol_request;
+}
+
+RefPtr<ResourceLoaderConnectorRequest> ResourceLoader::start_connector_request(LoadRequest const& request)
 {
     auto proxy = ProxyMappings::the().proxy_for_url(request.url());
 
@@ -515,10 +664,6 @@ RefPtr<ResourceLoaderConnectorRequest> ResourceLoader::start_network_request(Loa
         return {};
     };
 
-    ++m_pending_loads;
-    if (on_load_counter_change)
-        on_load_counter_change();
-
     m_active_requests.set(*protocol_request);
     return protocol_request;
 }
@@ -548,13 +693,24 @@ void ResourceLoader::finish_network_request(NonnullRefPtr<ResourceLoaderConnecto
 
     Platform::EventLoopPlugin::the().deferred_invoke([this, protocol_request] {
         m_active_requests.remove(protocol_request);
+        start_next_prefetch_if_idle();
     });
 }
 
+ResourceLoader::CacheStatistics ResourceLoader::cache_statistics() const
+{
+    CacheStatistics statistics;
+    statistics.resource_count = s_resource_cache.size();
+    for (auto const& it : s_resource_cache)
+        statistics.encoded_bytes += it.value->encoded_data().size();
+    return statistics;
+}
+
 void ResourceLoader::clear_cache()
 {
     dbgln_if(CACHE_DEBUG, "Clearing {} items from ResourceLoader cache", s_resource_cache.size());
     s_resource_cache.clear();
+    m_prefetched_responses.clear();
 }
 
 void ResourceLoader::evict_from_cache(LoadRequest const& request)
@@ -10,11 +10,13 @@
 #include <AK/ByteString.h>
 #include <AK/Function.h>
 #include <AK/HashMap.h>
+#include <AK/Time.h>
 #include <LibCore/EventReceiver.h>
 #include <LibCore/Proxy.h>
 #include <LibJS/SafeFunction.h>
 #include <LibProtocol/Request.h>
 #include <LibURL/URL.h>
+#include <LibWeb/HTML/Origin.h>
 #include <LibWeb/Loader/Resource.h>
 #include <LibWeb/Page/Page.h>
 
@@ -89,6 +91,10 @@ public:
     void prefetch_dns(URL::URL const&);
     void preconnect(URL::URL const&);
 
+    // Fetches the URL once nothing else is loading, and keeps the response around for a little while, so that a
+    // navigation to it from the request's initiator origin can be answered without going to the network.
+    void prefetch(LoadRequest const&);
+
     Function<void()> on_load_counter_change;
 
     int pending_loads() const { return m_pending_loads; }
@@ -99,6 +105,12 @@ public:
     String const& platform() const { return m_platform; }
     void set_platform(String platform) { m_platform = move(platform); }
 
+    struct CacheStatistics {
+        size_t resource_count { 0 };
+        size_t encoded_bytes { 0 };
+    };
+    CacheStatistics cache_statistics() const;
+
     void clear_cache();
     void evict_from_cache(LoadRequest const&);
 
@@ -107,11 +119,28 @@ private:
     static ErrorOr<NonnullRefPtr<ResourceLoader>> try_create(NonnullRefPtr<ResourceLoaderConnector>);
 
     RefPtr<ResourceLoaderConnectorRequest> start_network_request(LoadRequest const&);
+    RefPtr<ResourceLoaderConnectorRequest> start_connector_request(LoadRequest const&);
     void handle_network_response_headers(LoadRequest const&, HTTP::HeaderMap const&);
     void finish_network_request(NonnullRefPtr<ResourceLoaderConnectorRequest> const&);
 
+    void start_next_prefetch_if_idle();
+    bool respond_with_prefetched_response(LoadRequest const&, SuccessCallback&);
+
     int m_pending_loads { 0 };
 
+    struct PrefetchedResponse {
+        ByteBuffer body;
+        HTTP::HeaderMap headers;
+        Optional<u32> status_code;
+        HTML::Origin initiator_origin;
+        MonotonicTime fetched_at;
+    };
+    static constexpr size_t max_prefetched_response_count = 16;
+    static constexpr auto prefetched_response_lifetime = AK::Duration::from_seconds(300);
+    Vector<LoadRequest> m_queued_prefetches;
+    ByteString m_prefetch_in_flight_key;
+    HashMap<ByteString, PrefetchedResponse> m_prefetched_responses;
+
     HashTable<NonnullRefPtr<ResourceLoaderConnectorRequest>> m_active_requests;
     NonnullRefPtr<ResourceLoaderConnector> m_connector;
     String m_user_agent;
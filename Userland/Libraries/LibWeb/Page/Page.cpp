@@ -6,6 +6,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
 #include <AK/ScopeGuard.h>
 #include <AK/SourceLocation.h>
 #include <LibIPC/Decoder.h>
@@ -439,6 +440,14 @@ void Page::unregister_media_element(Badge<HTML::HTMLMediaElement>, int media_id)
     });
 }
 
+bool Page::has_playing_media_elements() const
+{
+    return any_of(m_media_elements, [](auto media_id) {
+        auto* node = DOM::Node::from_unique_id(media_id);
+        return node && !verify_cast<HTML::HTMLMediaElement>(*node).paused();
+    });
+}
+
 void Page::did_request_media_context_menu(i32 media_id, CSSPixelPoint position, ByteString const& target, unsigned modifiers, MediaContextMenu menu)
 {
     m_media_context_menu_element_id = media_id;
@@ -542,6 +551,24 @@ void Page::set_user_style(String source)
     }
 }
 
+void Page::did_finish_frame()
+{
+    // NOTE: Garbage collection can happen at any allocation, so we attribute all of it since the previous frame to this one.
+    auto garbage_collection_time = heap().total_time_spent_collecting_garbage();
+    m_current_frame_timings.garbage_collection = garbage_collection_time - m_garbage_collection_time_at_start_of_frame;
+    m_garbage_collection_time_at_start_of_frame = garbage_collection_time;
+
+    m_total_frame_timings.style += m_current_frame_timings.style;
+    m_total_frame_timings.layout += m_current_frame_timings.layout;
+    m_total_frame_timings.grid_layout += m_current_frame_timings.grid_layout;
+    m_total_frame_timings.paint_recording += m_current_frame_timings.paint_recording;
+    m_total_frame_timings.display_list_playback += m_current_frame_timings.display_list_playback;
+    m_total_frame_timings.garbage_collection += m_current_frame_timings.garbage_collection;
+
+    m_last_frame_timings = m_current_frame_timings;
+    m_current_frame_timings = {};
+}
+
 Vector<JS::Handle<DOM::Document>> Page::documents_in_active_window() const
 {
     if (!top_level_traversable_is_initialized())
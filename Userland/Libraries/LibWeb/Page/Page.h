@@ -9,9 +9,11 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
 #include <AK/Noncopyable.h>
 #include <AK/OwnPtr.h>
 #include <AK/RefPtr.h>
+#include <AK/Time.h>
 #include <AK/WeakPtr.h>
 #include <AK/Weakable.h>
 #include <LibGfx/Forward.h>
@@ -165,6 +167,7 @@ public:
 
     void register_media_element(Badge<HTML::HTMLMediaElement>, int media_id);
     void unregister_media_element(Badge<HTML::HTMLMediaElement>, int media_id);
+    bool has_playing_media_elements() const;
 
     struct MediaContextMenu {
         URL::URL media_url;
@@ -208,6 +211,23 @@ public:
     FindInPageResult find_in_page_previous_match();
     Optional<FindInPageQuery> last_find_in_page_query() const { return m_last_find_in_page_query; }
 
+    // Time spent in each phase of producing a frame. Work done between two paints (including style and layout
+    // forced by scripts) is accumulated into the current frame, which becomes the last frame once it's painted.
+    struct FrameTimings {
+        AK::Duration style;
+        AK::Duration layout;
+        // Only measured when LibWeb is built with LIBWEB_CSS_DEBUG.
+        AK::Duration grid_layout;
+        AK::Duration paint_recording;
+        AK::Duration display_list_playback;
+        AK::Duration garbage_collection;
+    };
+    FrameTimings& current_frame_timings() { return m_current_frame_timings; }
+    FrameTimings const& last_frame_timings() const { return m_last_frame_timings; }
+    // The sum of the timings of every frame painted since the page was created.
+    FrameTimings const& total_frame_timings() const { return m_total_frame_timings; }
+    void did_finish_frame();
+
 private:
     explicit Page(JS::NonnullGCPtr<PageClient>);
     virtual void visit_edges(Visitor&) override;
@@ -267,6 +287,11 @@ private:
     size_t m_find_in_page_match_index { 0 };
     Optional<FindInPageQuery> m_last_find_in_page_query;
     URL::URL m_last_find_in_page_url;
+
+    FrameTimings m_current_frame_timings;
+    FrameTimings m_last_frame_timings;
+    FrameTimings m_total_frame_timings;
+    AK::Duration m_garbage_collection_time_at_start_of_frame;
 };
 
 struct PaintOptions {
@@ -344,6 +369,11 @@ public:
     virtual String page_did_request_cookie(URL::URL const&, Cookie::Source) { return {}; }
     virtual void page_did_set_cookie(URL::URL const&, Cookie::ParsedCookie const&, Cookie::Source) { }
     virtual void page_did_update_cookie(Web::Cookie::Cookie) { }
+    virtual OrderedHashMap<String, String> page_did_request_local_storage_items(String const&) { return {}; }
+    virtual void page_did_request_local_storage_preload(String const&) { }
+    virtual void page_did_set_local_storage_item(String const&, String const&, String const&) { }
+    virtual void page_did_remove_local_storage_item(String const&, String const&) { }
+    virtual void page_did_clear_local_storage(String const&) { }
     virtual void page_did_update_resource_count(i32) { }
     struct NewWebViewResult {
         JS::GCPtr<Page> page;
@@ -369,6 +399,7 @@ public:
     virtual void page_did_insert_clipboard_entry([[maybe_unused]] String data, [[maybe_unused]] String presentation_style, [[maybe_unused]] String mime_type) { }
 
     virtual void page_did_change_audio_play_state(HTML::AudioPlayState) { }
+    virtual void page_did_change_frozen_state(bool) { }
 
     virtual IPC::File request_worker_agent() { return IPC::File {}; }
 
@@ -74,6 +74,65 @@ void DisplayList::mark_unnecessary_commands()
         }
     }
     VERIFY(sample_blit_ranges.is_empty());
+
+    // The pair of save and restore commands is not needed if there are no painting commands in between them that
+    // produce visible output. This also drops clip rects that end up not clipping anything.
+    struct SaveRestoreRange {
+        u32 save_command_index;
+        bool has_painting_commands_in_between { false };
+    };
+    // Stack of save commands that have not been matched with a restore command yet.
+    Vector<SaveRestoreRange> save_restore_ranges;
+    for (u32 command_index = 0; command_index < m_commands.size(); ++command_index) {
+        if (m_commands[command_index].skip)
+            continue;
+        auto const& command = m_commands[command_index].command;
+        if (command.has<Save>()) {
+            save_restore_ranges.append({
+                .save_command_index = command_index,
+                .has_painting_commands_in_between = false,
+            });
+        } else if (command.has<Restore>()) {
+            if (save_restore_ranges.is_empty())
+                continue;
+            auto range = save_restore_ranges.take_last();
+            if (!range.has_painting_commands_in_between) {
+                for (u32 index = range.save_command_index; index <= command_index; ++index)
+                    m_commands[index].skip = true;
+            }
+        } else if (!command.has<AddClipRect>()) {
+            for (auto& save_restore_range : save_restore_ranges)
+                save_restore_range.has_painting_commands_in_between = true;
+        }
+    }
+
+    // Consecutive fill_rect commands with the same color can be merged if their rects are adjacent and together
+    // form a rectangle. Since the rects don't overlap, this produces the same output even for translucent colors.
+    auto can_merge_fill_rects = [](FillRect const& a, FillRect const& b) {
+        if (a.color != b.color || !a.clip_paths.is_empty() || !b.clip_paths.is_empty())
+            return false;
+        if (a.rect.x() == b.rect.x() && a.rect.width() == b.rect.width())
+            return a.rect.bottom() == b.rect.top() || b.rect.bottom() == a.rect.top();
+        if (a.rect.y() == b.rect.y() && a.rect.height() == b.rect.height())
+            return a.rect.right() == b.rect.left() || b.rect.right() == a.rect.left();
+        return false;
+    };
+    Optional<u32> previous_command_index;
+    for (u32 command_index = 0; command_index < m_commands.size(); ++command_index) {
+        auto& command_list_item = m_commands[command_index];
+        if (command_list_item.skip)
+            continue;
+        if (previous_command_index.has_value() && command_list_item.command.has<FillRect>()) {
+            auto& previous_command = m_commands[*previous_command_index].command;
+            if (previous_command.has<FillRect>() && can_merge_fill_rects(previous_command.get<FillRect>(), command_list_item.command.get<FillRect>())) {
+                auto& previous_fill_rect = previous_command.get<FillRect>();
+                previous_fill_rect.rect = previous_fill_rect.rect.united(command_list_item.command.get<FillRect>().rect);
+                command_list_item.skip = true;
+                continue;
+            }
+        }
+        previous_command_index = command_index;
+    }
 }
 
 void DisplayList::execute(DisplayListPlayer& executor)
@@ -13,7 +13,9 @@
 #include <core/SkMaskFilter.h>
 #include <core/SkPath.h>
 #include <core/SkPathBuilder.h>
+#include <core/SkPixmap.h>
 #include <core/SkRRect.h>
+#include <core/SkRSXform.h>
 #include <core/SkSurface.h>
 #include <effects/SkGradientShader.h>
 #include <effects/SkImageFilters.h>
@@ -47,6 +49,8 @@ public:
     {
     }
 
+    SkSurface& sk_surface() const { return *m_surface; }
+
 private:
     sk_sp<SkSurface> m_surface;
 };
@@ -107,19 +111,34 @@ DisplayListPlayerSkia::DisplayListPlayerSkia(SkiaBackendContext& context, Core::
 }
 #endif
 
-DisplayListPlayerSkia::DisplayListPlayerSkia(Gfx::Bitmap& bitmap)
+DisplayListPlayerSkia::DisplayListPlayerSkia(Gfx::Bitmap& bitmap, AlphaType alpha_type)
 {
     VERIFY(bitmap.format() == Gfx::BitmapFormat::BGRA8888);
     auto image_info = SkImageInfo::Make(bitmap.width(), bitmap.height(), kBGRA_8888_SkColorType, kPremul_SkAlphaType);
-    auto surface = SkSurfaces::WrapPixels(image_info, bitmap.begin(), bitmap.pitch());
+
+    if (alpha_type == AlphaType::Premultiplied) {
+        auto surface = SkSurfaces::WrapPixels(image_info, bitmap.begin(), bitmap.pitch());
+        VERIFY(surface);
+        m_surface = make<SkiaSurface>(surface);
+        return;
+    }
+
+    auto surface = SkSurfaces::Raster(image_info);
     VERIFY(surface);
+    SkPixmap bitmap_pixmap(image_info.makeAlphaType(kUnpremul_SkAlphaType), bitmap.begin(), bitmap.pitch());
+    surface->writePixels(bitmap_pixmap, 0, 0);
     m_surface = make<SkiaSurface>(surface);
+    m_write_back_to_bitmap = [this, bitmap_pixmap] {
+        surface().sk_surface().readPixels(bitmap_pixmap, 0, 0);
+    };
 }
 
 DisplayListPlayerSkia::~DisplayListPlayerSkia()
 {
     if (m_flush_context)
         m_flush_context();
+    if (m_write_back_to_bitmap)
+        m_write_back_to_bitmap();
 }
 
 static SkRect to_skia_rect(auto const& rect)
@@ -291,6 +310,25 @@ CommandResult DisplayListPlayerSkia::draw_glyph_run(DrawGlyphRun const& command)
     auto const& glyphs = command.glyph_run->glyphs();
     auto const& font = command.glyph_run->font();
     auto scaled_font = font.with_size(font.point_size() * static_cast<float>(command.scale));
+
+    // OPTIMIZATION: Instead of creating an image and issuing a draw for every glyph, we pack the glyph bitmaps of the
+    //               run into a single atlas and draw all of them with one drawAtlas() call.
+    struct GlyphInAtlas {
+        NonnullRefPtr<Gfx::Bitmap> bitmap;
+        Gfx::IntPoint blit_position;
+        Gfx::IntPoint position_in_atlas;
+    };
+    Vector<GlyphInAtlas> glyphs_in_atlas;
+    glyphs_in_atlas.ensure_capacity(glyphs.size());
+
+    // NOTE: Glyphs are placed left to right in rows that are at most this wide, so long runs don't end up with an
+    //       atlas wider than the maximum texture size of the GPU backend.
+    static constexpr int max_atlas_row_width = 1024;
+    int atlas_width = 0;
+    int atlas_height = 0;
+    Gfx::IntPoint next_position_in_atlas;
+    int current_row_height = 0;
+
     for (auto const& glyph_or_emoji : glyphs) {
         auto transformed_glyph = glyph_or_emoji;
         transformed_glyph.visit([&](auto& glyph) {
@@ -308,13 +346,45 @@ CommandResult DisplayListPlayerSkia::draw_glyph_run(DrawGlyphRun const& command)
             if (maybe_font_glyph->is_color_bitmap()) {
                 TODO();
             } else {
-                auto sk_bitmap = to_skia_bitmap(*maybe_font_glyph->bitmap());
-                auto sk_image = SkImages::RasterFromBitmap(sk_bitmap);
-                auto const& blit_position = glyph_position.blit_position;
-                canvas.drawImage(sk_image, blit_position.x(), blit_position.y(), SkSamplingOptions(), &paint);
+                auto glyph_bitmap = maybe_font_glyph->bitmap();
+                if (glyph_bitmap->width() == 0 || glyph_bitmap->height() == 0)
+                    continue;
+                if (next_position_in_atlas.x() > 0 && next_position_in_atlas.x() + glyph_bitmap->width() > max_atlas_row_width) {
+                    next_position_in_atlas = { 0, next_position_in_atlas.y() + current_row_height };
+                    current_row_height = 0;
+                }
+                glyphs_in_atlas.append({ move(glyph_bitmap), glyph_position.blit_position, next_position_in_atlas });
+                auto const& bitmap = *glyphs_in_atlas.last().bitmap;
+                atlas_width = max(atlas_width, next_position_in_atlas.x() + bitmap.width());
+                atlas_height = max(atlas_height, next_position_in_atlas.y() + bitmap.height());
+                current_row_height = max(current_row_height, bitmap.height());
+                next_position_in_atlas.translate_by(bitmap.width(), 0);
             }
         }
     }
+
+    if (glyphs_in_atlas.is_empty())
+        return CommandResult::Continue;
+
+    SkBitmap atlas_bitmap;
+    if (!atlas_bitmap.tryAllocPixels(SkImageInfo::Make(atlas_width, atlas_height, kBGRA_8888_SkColorType, kUnpremul_SkAlphaType)))
+        return CommandResult::Continue;
+    atlas_bitmap.eraseColor(SK_ColorTRANSPARENT);
+
+    Vector<SkRSXform> transforms;
+    Vector<SkRect> texture_rects;
+    transforms.ensure_capacity(glyphs_in_atlas.size());
+    texture_rects.ensure_capacity(glyphs_in_atlas.size());
+    for (auto const& glyph : glyphs_in_atlas) {
+        auto const& position_in_atlas = glyph.position_in_atlas;
+        atlas_bitmap.writePixels(to_skia_bitmap(*glyph.bitmap).pixmap(), position_in_atlas.x(), position_in_atlas.y());
+        transforms.unchecked_append(SkRSXform::Make(1, 0, glyph.blit_position.x(), glyph.blit_position.y()));
+        texture_rects.unchecked_append(SkRect::MakeXYWH(position_in_atlas.x(), position_in_atlas.y(), glyph.bitmap->width(), glyph.bitmap->height()));
+    }
+    atlas_bitmap.setImmutable();
+
+    auto atlas_image = SkImages::RasterFromBitmap(atlas_bitmap);
+    canvas.drawAtlas(atlas_image.get(), transforms.data(), texture_rects.data(), nullptr, static_cast<int>(transforms.size()), SkBlendMode::kSrcOver, SkSamplingOptions(), nullptr, &paint);
     return CommandResult::Continue;
 }
 
@@ -349,6 +419,9 @@ CommandResult DisplayListPlayerSkia::draw_scaled_immutable_bitmap(DrawScaledImmu
     auto src_rect = to_skia_rect(command.src_rect);
     auto dst_rect = to_skia_rect(command.dst_rect);
     auto bitmap = to_skia_bitmap(command.bitmap->bitmap());
+    // OPTIMIZATION: The pixels of an ImmutableBitmap never change, so let Skia share them instead of copying them into the image.
+    //               For decoded images this is memory shared with ImageDecoder, which we then draw from without any copies.
+    bitmap.setImmutable();
     auto image = SkImages::RasterFromBitmap(bitmap);
     auto& canvas = surface().canvas();
     SkPaint paint;
@@ -68,7 +68,13 @@ public:
     bool needs_update_immutable_bitmap_texture_cache() const override { return false; }
     void update_immutable_bitmap_texture_cache(HashMap<u32, Gfx::ImmutableBitmap const*>&) override {};
 
-    DisplayListPlayerSkia(Gfx::Bitmap&);
+    // NOTE: Gfx::Bitmap doesn't know whether its pixels are premultiplied, so the caller has to say so.
+    //       Skia can only draw into premultiplied pixels, so unpremultiplied bitmaps are converted before and after drawing.
+    enum class AlphaType {
+        Premultiplied,
+        Unpremultiplied,
+    };
+    DisplayListPlayerSkia(Gfx::Bitmap&, AlphaType);
 
 #ifdef AK_OS_MACOS
     static OwnPtr<SkiaBackendContext> create_metal_context(Core::MetalContext const&);
@@ -83,6 +89,7 @@ private:
 
     OwnPtr<SkiaSurface> m_surface;
     Function<void()> m_flush_context;
+    Function<void()> m_write_back_to_bitmap;
 };
 
 }
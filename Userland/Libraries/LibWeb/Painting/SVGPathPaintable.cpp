@@ -38,6 +38,27 @@ TraversalDecision SVGPathPaintable::hit_test(CSSPixelPoint position, HitTestType
     return SVGGraphicsPaintable::hit_test(position, type, callback);
 }
 
+SVGPathPaintable::DevicePaths const& SVGPathPaintable::device_paths(Gfx::AffineTransform const& paint_transform) const
+{
+    if (m_cached_device_paths.has_value() && m_cached_device_paths->transform == paint_transform)
+        return *m_cached_device_paths;
+
+    auto path = computed_path()->copy_transformed(paint_transform);
+
+    // Fills are computed as though all subpaths are closed (https://svgwg.org/svg2-draft/painting.html#FillProperties)
+    // We need to fill the path before applying the stroke, however the filled
+    // path must be closed, whereas the stroke path may not necessary be closed.
+    // Copy the path and close it for filling, but use the previous path for stroke
+    auto closed_path = path;
+    closed_path.close_all_subpaths();
+
+    (void)path.split_lines();
+    (void)closed_path.split_lines();
+
+    m_cached_device_paths = DevicePaths { paint_transform, move(path), move(closed_path) };
+    return *m_cached_device_paths;
+}
+
 static Gfx::WindingRule to_gfx_winding_rule(SVG::FillRule fill_rule)
 {
     switch (fill_rule) {
@@ -72,17 +93,9 @@ void SVGPathPaintable::paint(PaintContext& context, PaintPhase phase) const
     auto maybe_view_box = svg_node->dom_node().view_box();
 
     auto paint_transform = computed_transforms().svg_to_device_pixels_transform(context);
-    Gfx::Path path = computed_path()->copy_transformed(paint_transform);
-
-    // Fills are computed as though all subpaths are closed (https://svgwg.org/svg2-draft/painting.html#FillProperties)
-    auto closed_path = [&] {
-        // We need to fill the path before applying the stroke, however the filled
-        // path must be closed, whereas the stroke path may not necessary be closed.
-        // Copy the path and close it for filling, but use the previous path for stroke
-        auto copy = path;
-        copy.close_all_subpaths();
-        return copy;
-    };
+    auto const& device_paths = this->device_paths(paint_transform);
+    auto const& path = device_paths.path;
+    auto const& closed_path = device_paths.closed_path;
 
     // Note: This is assuming .x_scale() == .y_scale() (which it does currently).
     auto viewbox_scale = paint_transform.x_scale();
@@ -99,7 +112,7 @@ void SVGPathPaintable::paint(PaintContext& context, PaintPhase phase) const
         // within a clipPath conceptually defines a 1-bit mask (with the possible exception of anti-aliasing along
         // the edge of the geometry) which represents the silhouette of the graphics associated with that element.
         context.display_list_recorder().fill_path({
-            .path = closed_path(),
+            .path = closed_path,
             .color = Color::Black,
             .winding_rule = to_gfx_winding_rule(graphics_element.clip_rule().value_or(SVG::ClipRule::Nonzero)),
             .translation = offset,
@@ -117,7 +130,7 @@ void SVGPathPaintable::paint(PaintContext& context, PaintPhase phase) const
     auto winding_rule = to_gfx_winding_rule(graphics_element.fill_rule().value_or(SVG::FillRule::Nonzero));
     if (auto paint_style = graphics_element.fill_paint_style(paint_context); paint_style.has_value()) {
         context.display_list_recorder().fill_path({
-            .path = closed_path(),
+            .path = closed_path,
             .paint_style = *paint_style,
             .winding_rule = winding_rule,
             .opacity = fill_opacity,
@@ -125,7 +138,7 @@ void SVGPathPaintable::paint(PaintContext& context, PaintPhase phase) const
         });
     } else if (auto fill_color = graphics_element.fill_color(); fill_color.has_value()) {
         context.display_list_recorder().fill_path({
-            .path = closed_path(),
+            .path = closed_path,
             .color = fill_color->with_opacity(fill_opacity),
             .winding_rule = winding_rule,
             .translation = offset,
@@ -27,6 +27,7 @@ public:
     void set_computed_path(Gfx::Path path)
     {
         m_computed_path = move(path);
+        m_cached_device_paths.clear();
     }
 
     Optional<Gfx::Path> const& computed_path() const { return m_computed_path; }
@@ -35,6 +36,18 @@ protected:
     SVGPathPaintable(Layout::SVGGraphicsBox const&);
 
     Optional<Gfx::Path> m_computed_path = {};
+
+private:
+    struct DevicePaths {
+        Gfx::AffineTransform transform;
+        Gfx::Path path;
+        Gfx::Path closed_path;
+    };
+    DevicePaths const& device_paths(Gfx::AffineTransform const&) const;
+
+    // The computed path in device pixels, and a closed copy of it for filling, as of the last paint. Both are kept with
+    // their lines split, so that a path that doesn't move or scale isn't transformed and flattened again every frame.
+    mutable Optional<DevicePaths> m_cached_device_paths;
 };
 
 }
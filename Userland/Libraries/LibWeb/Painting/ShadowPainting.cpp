@@ -6,6 +6,8 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
+#include <AK/HashMap.h>
 #include <AK/NumericLimits.h>
 #include <LibGfx/DisjointRectSet.h>
 #include <LibGfx/Filters/StackBlurFilter.h>
@@ -20,6 +22,28 @@
 #include <LibWeb/Painting/PaintableBox.h>
 #include <LibWeb/Painting/ShadowPainting.h>
 
+struct OuterBoxShadowBitmapKey {
+    Gfx::IntSize size;
+    Gfx::Color color;
+    int blur_radius;
+    Array<int, 8> corner_radii;
+
+    bool operator==(OuterBoxShadowBitmapKey const&) const = default;
+};
+
+namespace AK {
+template<>
+struct Traits<OuterBoxShadowBitmapKey> : public DefaultTraits<OuterBoxShadowBitmapKey> {
+    static unsigned hash(OuterBoxShadowBitmapKey const& key)
+    {
+        auto hash = pair_int_hash(pair_int_hash(key.size.width(), key.size.height()), pair_int_hash(key.color.value(), key.blur_radius));
+        for (auto radius : key.corner_radii)
+            hash = pair_int_hash(hash, radius);
+        return hash;
+    }
+};
+}
+
 namespace Web::Painting {
 
 void paint_inner_box_shadow(Gfx::Painter& painter, PaintBoxShadowParams params)
@@ -421,20 +445,45 @@ void paint_outer_box_shadow(Gfx::Painter& painter, PaintBoxShadowParams params)
         painter.fill_rect(inner, params.color);
     };
 
-    auto shadows_bitmap = Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, shadow_bitmap_rect.size());
-    if (shadows_bitmap.is_error()) {
-        dbgln("Unable to allocate temporary bitmap {} for box-shadow rendering: {}", shadow_bitmap_rect, shadows_bitmap.error());
-        return;
-    }
-    auto shadow_bitmap = shadows_bitmap.release_value();
-    Gfx::Painter corner_painter { *shadow_bitmap };
-    Gfx::AntiAliasingPainter aa_corner_painter { corner_painter };
+    // OPTIMIZATION: The blurred shadow bitmap only depends on the corners, not on the size of the box, so boxes that
+    //               share a shadow (think a list of cards) can reuse it instead of blurring again on every paint.
+    static HashMap<OuterBoxShadowBitmapKey, NonnullRefPtr<Gfx::Bitmap>> s_shadow_bitmap_cache;
+    static constexpr size_t max_cached_shadow_bitmaps = 64;
 
-    aa_corner_painter.fill_rect_with_rounded_corners(
-        shadow_bitmap_rect.shrunken(double_radius, double_radius, double_radius, double_radius),
-        params.color, top_left_shadow_corner, top_right_shadow_corner, bottom_right_shadow_corner, bottom_left_shadow_corner);
-    Gfx::StackBlurFilter filter(*shadow_bitmap);
-    filter.process_rgba(blur_radius, params.color);
+    OuterBoxShadowBitmapKey shadow_bitmap_key {
+        .size = shadow_bitmap_rect.size(),
+        .color = params.color,
+        .blur_radius = blur_radius,
+        .corner_radii = {
+            top_left_shadow_corner.horizontal_radius, top_left_shadow_corner.vertical_radius,
+            top_right_shadow_corner.horizontal_radius, top_right_shadow_corner.vertical_radius,
+            bottom_right_shadow_corner.horizontal_radius, bottom_right_shadow_corner.vertical_radius,
+            bottom_left_shadow_corner.horizontal_radius, bottom_left_shadow_corner.vertical_radius },
+    };
+
+    RefPtr<Gfx::Bitmap> cached_shadow_bitmap = s_shadow_bitmap_cache.get(shadow_bitmap_key).value_or(nullptr);
+    if (!cached_shadow_bitmap) {
+        auto shadows_bitmap = Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, shadow_bitmap_rect.size());
+        if (shadows_bitmap.is_error()) {
+            dbgln("Unable to allocate temporary bitmap {} for box-shadow rendering: {}", shadow_bitmap_rect, shadows_bitmap.error());
+            return;
+        }
+        auto shadow_bitmap = shadows_bitmap.release_value();
+        Gfx::Painter corner_painter { *shadow_bitmap };
+        Gfx::AntiAliasingPainter aa_corner_painter { corner_painter };
+
+        aa_corner_painter.fill_rect_with_rounded_corners(
+            shadow_bitmap_rect.shrunken(double_radius, double_radius, double_radius, double_radius),
+            params.color, top_left_shadow_corner, top_right_shadow_corner, bottom_right_shadow_corner, bottom_left_shadow_corner);
+        Gfx::StackBlurFilter filter(*shadow_bitmap);
+        filter.process_rgba(blur_radius, params.color);
+
+        if (s_shadow_bitmap_cache.size() >= max_cached_shadow_bitmaps)
+            s_shadow_bitmap_cache.clear();
+        s_shadow_bitmap_cache.set(shadow_bitmap_key, shadow_bitmap);
+        cached_shadow_bitmap = move(shadow_bitmap);
+    }
+    NonnullRefPtr<Gfx::Bitmap> shadow_bitmap = *cached_shadow_bitmap;
 
     auto paint_shadow = [&](Gfx::IntRect clip_rect) {
         Gfx::PainterStateSaver save { painter };
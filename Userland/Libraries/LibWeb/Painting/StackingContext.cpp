@@ -276,6 +276,10 @@ void StackingContext::paint(PaintContext& context) const
     if (opacity == 0.0f)
         return;
 
+    // FIXME: Retain the commands recorded for this stacking context and reuse them across frames if nothing in its
+    //        subtree was invalidated. To do that, the recorder must stop baking its translation into commands (so a
+    //        retained list can be replayed at a new offset), apply_scroll_offsets() must stop mutating commands in
+    //        place, and set_needs_display() must mark the enclosing stacking context dirty instead of the whole navigable.
     DisplayListRecorderStateSaver saver(context.display_list_recorder());
 
     auto to_device_pixels_scale = float(context.device_pixels_per_css_pixel());
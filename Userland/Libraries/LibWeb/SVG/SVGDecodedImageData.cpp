@@ -107,7 +107,7 @@ RefPtr<Gfx::Bitmap> SVGDecodedImageData::render(Gfx::IntSize size) const
         break;
     }
     case DisplayListPlayerType::Skia: {
-        Painting::DisplayListPlayerSkia executor { *bitmap };
+        Painting::DisplayListPlayerSkia executor { *bitmap, Painting::DisplayListPlayerSkia::AlphaType::Unpremultiplied };
         display_list.execute(executor);
         break;
     }
@@ -100,8 +100,12 @@ void SVGPathElement::attribute_changed(FlyString const& name, Optional<String> c
 {
     SVGGeometryElement::attribute_changed(name, value);
 
-    if (name == "d")
+    if (name == "d") {
         m_instructions = AttributeParser::parse_path_data(value.value_or(String {}));
+        m_path.clear();
+        // The path isn't part of the computed style, so changing it doesn't cause a relayout on its own.
+        document().set_needs_layout();
+    }
 }
 
 Gfx::Path path_from_path_instructions(ReadonlySpan<PathInstruction> instructions)
@@ -274,7 +278,12 @@ Gfx::Path path_from_path_instructions(ReadonlySpan<PathInstruction> instructions
 
 Gfx::Path SVGPathElement::get_path(CSSPixelSize)
 {
-    return path_from_path_instructions(m_instructions);
+    if (!m_path.has_value()) {
+        m_path = path_from_path_instructions(m_instructions);
+        // Split the path into lines up front, so that every copy of it shares the result.
+        (void)m_path->split_lines();
+    }
+    return *m_path;
 }
 
 }
@@ -30,6 +30,9 @@ private:
     virtual void initialize(JS::Realm&) override;
 
     Vector<PathInstruction> m_instructions;
+
+    // The path built from the instructions, flattened already, so that layout and painting don't rebuild it every time.
+    Optional<Gfx::Path> m_path;
 };
 
 Gfx::Path path_from_path_instructions(ReadonlySpan<PathInstruction>);
@@ -3375,28 +3375,43 @@ WebIDL::ExceptionOr<void> readable_stream_pull_from_bytes(ReadableStream& stream
     // 3. Let desiredSize be available.
     auto desired_size = available;
 
-    // FIXME: 4. If stream’s current BYOB request view is non-null, then set desiredSize to stream’s current BYOB request
-    //           view's byte length.
+    // 4. If stream’s current BYOB request view is non-null, then set desiredSize to stream’s current BYOB request
+    //    view's byte length.
+    auto byob_request_view = readable_stream_current_byob_request_view(stream);
+    if (byob_request_view)
+        desired_size = byob_request_view->byte_length();
 
     // 5. Let pullSize be the smaller value of available and desiredSize.
     auto pull_size = min(available, desired_size);
 
     // 6. Let pulled be the first pullSize bytes of bytes.
-    auto pulled = pull_size == available ? move(bytes) : MUST(bytes.slice(0, pull_size));
-
     // 7. Remove the first pullSize bytes from bytes.
-    if (pull_size != available)
-        bytes = MUST(bytes.slice(pull_size, available - pull_size));
+    // NOTE: We write or enqueue pulled before removing it from bytes, which saves us a copy of it.
+
+    // 8. If stream’s current BYOB request view is non-null, then:
+    if (byob_request_view) {
+        // 1. Write pulled into stream’s current BYOB request view.
+        byob_request_view->write(bytes.bytes().trim(pull_size));
+
+        // 2. Perform ? ReadableByteStreamControllerRespond(stream.[[controller]], pullSize).
+        TRY(readable_byte_stream_controller_respond(controller, pull_size));
+
+        if (pull_size == available)
+            return {};
+
+        // AD-HOC: Our callers don't hold on to bytes between pulls, so enqueue what didn't fit into the view instead of
+        //         leaving it in bytes. The next read will be fulfilled from the queue.
+        bytes = TRY_OR_THROW_OOM(stream.vm(), bytes.slice(pull_size, available - pull_size));
+    }
 
-    // FIXME: 8. If stream’s current BYOB request view is non-null, then:
-    //           1. Write pulled into stream’s current BYOB request view.
-    //           2. Perform ? ReadableByteStreamControllerRespond(stream.[[controller]], pullSize).
     // 9. Otherwise,
+    // NOTE: This is also reached for the bytes that didn't fit into the BYOB request view, see above.
     {
         auto& realm = HTML::relevant_realm(stream);
 
         // 1. Set view to the result of creating a Uint8Array from pulled in stream’s relevant Realm.
-        auto array_buffer = JS::ArrayBuffer::create(realm, move(pulled));
+        // NOTE: The ArrayBuffer takes ownership of the bytes, so they aren't copied.
+        auto array_buffer = JS::ArrayBuffer::create(realm, move(bytes));
         auto view = JS::Uint8Array::create(realm, array_buffer->byte_length(), *array_buffer);
 
         // 2. Perform ? ReadableByteStreamControllerEnqueue(stream.[[controller]], view).
@@ -3406,6 +3421,23 @@ WebIDL::ExceptionOr<void> readable_stream_pull_from_bytes(ReadableStream& stream
     return {};
 }
 
+// https://streams.spec.whatwg.org/#readable-stream-current-byob-request-view
+JS::GCPtr<WebIDL::ArrayBufferView> readable_stream_current_byob_request_view(ReadableStream& stream)
+{
+    // 1. Assert: stream.[[controller]] implements ReadableByteStreamController.
+    auto controller = stream.controller()->get<JS::NonnullGCPtr<ReadableByteStreamController>>();
+
+    // 2. Let byobRequest be ! ReadableByteStreamControllerGetBYOBRequest(stream.[[controller]]).
+    auto byob_request = readable_byte_stream_controller_get_byob_request(controller);
+
+    // 3. If byobRequest is null, then return null.
+    if (!byob_request)
+        return {};
+
+    // 4. Return byobRequest.[[view]].
+    return byob_request->view();
+}
+
 // https://streams.spec.whatwg.org/#transfer-array-buffer
 WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::ArrayBuffer>> transfer_array_buffer(JS::Realm& realm, JS::ArrayBuffer& buffer)
 {
@@ -3416,10 +3448,14 @@ WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::ArrayBuffer>> transfer_array_buffer(JS:
 
     // 2. Let arrayBufferData be O.[[ArrayBufferData]].
     // 3. Let arrayBufferByteLength be O.[[ArrayBufferByteLength]].
-    auto array_buffer = buffer.buffer();
+    // NOTE: O is detached right after this, so we take its data instead of copying it.
+    auto array_buffer = move(buffer.buffer());
 
     // 4. Perform ? DetachArrayBuffer(O).
-    TRY(JS::detach_array_buffer(vm, buffer));
+    if (auto result = JS::detach_array_buffer(vm, buffer); result.is_error()) {
+        buffer.buffer() = move(array_buffer);
+        return result.release_error();
+    }
 
     // 5. Return a new ArrayBuffer object, created in the current Realm, whose [[ArrayBufferData]] internal slot value is arrayBufferData and whose [[ArrayBufferByteLength]] internal slot value is arrayBufferByteLength.
     return JS::ArrayBuffer::create(realm, move(array_buffer));
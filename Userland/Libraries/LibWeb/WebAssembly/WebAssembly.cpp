@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/HashMap.h>
 #include <AK/MemoryStream.h>
 #include <AK/ScopeGuard.h>
 #include <AK/StringBuilder.h>
@@ -37,6 +38,43 @@ WebAssemblyCache& get_cache(JS::Realm& realm)
     return s_caches.ensure(realm.global_object());
 }
 
+// NOTE: Parsed and validated modules are never modified afterwards, so every realm in this process can share the
+//       compiled module for a given sequence of bytes. This lets pages that compile the same module again (e.g. after
+//       a reload) skip parsing and validation entirely. The cache is bounded both in the number of modules and in
+//       the total size of their source bytes, and the least recently added modules are evicted first.
+static constexpr size_t compiled_module_cache_max_entries = 16;
+static constexpr size_t compiled_module_cache_max_source_size = 32 * MiB;
+static OrderedHashMap<ByteBuffer, NonnullRefPtr<CompiledWebAssemblyModule>> s_compiled_module_cache;
+static size_t s_compiled_module_cache_source_size { 0 };
+
+static RefPtr<CompiledWebAssemblyModule> find_cached_compiled_module(ReadonlyBytes data)
+{
+    auto it = s_compiled_module_cache.find(Traits<ReadonlyBytes>::hash(data), [&](auto& entry) { return entry.key.bytes() == data; });
+    if (it == s_compiled_module_cache.end())
+        return nullptr;
+    return it->value;
+}
+
+static void cache_compiled_module(ReadonlyBytes data, NonnullRefPtr<CompiledWebAssemblyModule> compiled_module)
+{
+    if (data.size() > compiled_module_cache_max_source_size)
+        return;
+
+    auto source = ByteBuffer::copy(data);
+    if (source.is_error())
+        return;
+
+    while (s_compiled_module_cache.size() >= compiled_module_cache_max_entries
+        || s_compiled_module_cache_source_size + data.size() > compiled_module_cache_max_source_size) {
+        auto oldest = s_compiled_module_cache.begin();
+        s_compiled_module_cache_source_size -= oldest->key.size();
+        s_compiled_module_cache.remove(oldest);
+    }
+
+    s_compiled_module_cache_source_size += data.size();
+    s_compiled_module_cache.set(source.release_value(), move(compiled_module));
+}
+
 }
 
 void visit_edges(JS::Object& object, JS::Cell::Visitor& visitor)
@@ -325,6 +363,13 @@ JS::ThrowCompletionOr<NonnullRefPtr<CompiledWebAssemblyModule>> parse_module(JS:
     } else {
         return vm.throw_completion<JS::TypeError>("Not a BufferSource"sv);
     }
+
+    auto& cache = get_cache(*vm.current_realm());
+    if (auto compiled_module = find_cached_compiled_module(data)) {
+        cache.add_compiled_module(*compiled_module);
+        return compiled_module.release_nonnull();
+    }
+
     FixedMemoryStream stream { data };
     auto module_result = Wasm::Module::parse(stream);
     if (module_result.is_error()) {
@@ -332,33 +377,42 @@ JS::ThrowCompletionOr<NonnullRefPtr<CompiledWebAssemblyModule>> parse_module(JS:
         return vm.throw_completion<JS::TypeError>(Wasm::parse_error_to_byte_string(module_result.error()));
     }
 
-    auto& cache = get_cache(*vm.current_realm());
     if (auto validation_result = cache.abstract_machine().validate(module_result.value()); validation_result.is_error()) {
         // FIXME: Throw CompileError instead.
         return vm.throw_completion<JS::TypeError>(validation_result.error().error_string);
     }
     auto compiled_module = make_ref_counted<CompiledWebAssemblyModule>(module_result.release_value());
     cache.add_compiled_module(compiled_module);
+    cache_compiled_module(data, compiled_module);
     return compiled_module;
 }
 
 JS::NativeFunction* create_native_function(JS::VM& vm, Wasm::FunctionAddress address, ByteString const& name, Instance* instance)
 {
     auto& realm = *vm.current_realm();
-    Optional<Wasm::FunctionType> type;
     auto& cache = get_cache(realm);
-    cache.abstract_machine().store().get(address)->visit([&](auto const& value) { type = value.type(); });
     if (auto entry = cache.get_function_instance(address); entry.has_value())
         return *entry;
 
+    Optional<Wasm::FunctionType> type;
+    size_t local_count = 0;
+    cache.abstract_machine().store().get(address)->visit(
+        [&](Wasm::WasmFunction const& value) {
+            type = value.type();
+            local_count = value.code().locals().size();
+        },
+        [&](Wasm::HostFunction const& value) { type = value.type(); });
+
     auto function = JS::NativeFunction::create(
         realm,
         name,
-        [address, type = type.release_value(), instance](JS::VM& vm) -> JS::ThrowCompletionOr<JS::Value> {
+        [address, type = type.release_value(), local_count, instance](JS::VM& vm) -> JS::ThrowCompletionOr<JS::Value> {
             (void)instance;
             auto& realm = *vm.current_realm();
+            // NOTE: Configuration::call() turns the arguments into the callee's locals, so make room for those as well
+            //       to only allocate once per call.
             Vector<Wasm::Value> values;
-            values.ensure_capacity(type.parameters().size());
+            values.ensure_capacity(type.parameters().size() + local_count);
 
             // Grab as many values as needed and convert them.
             size_t index = 0;
@@ -65,7 +65,9 @@ AudioContext::AudioContext(JS::Realm& realm, AudioContextOptions const& context_
     // FIXME: 5: If the context is allowed to start, send a control message to start processing.
     // FIXME: Implement control message queue to run following steps on the rendering thread
     if (m_allowed_to_start) {
-        // FIXME: 5.1: Attempt to acquire system resources. In case of failure, abort the following steps.
+        // 5.1: Attempt to acquire system resources. In case of failure, abort the following steps.
+        if (!start_rendering_audio_graph())
+            return;
 
         // 5.2: Set the [[rendering thread state]] to "running" on the AudioContext.
         BaseAudioContext::set_rendering_state(Bindings::AudioContextState::Running);
@@ -138,12 +140,12 @@ WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::Promise>> AudioContext::resume()
     // 7. Queue a control message to resume the AudioContext.
     // FIXME: Implement control message queue to run following steps on the rendering thread
 
-    // FIXME: 7.1: Attempt to acquire system resources.
-
+    // 7.1: Attempt to acquire system resources.
     // 7.2: Set the [[rendering thread state]] on the AudioContext to running.
     set_rendering_state(Bindings::AudioContextState::Running);
 
     // 7.3: Start rendering the audio graph.
+    // NOTE: Acquiring the output device and starting to render are the same operation for us.
     if (!start_rendering_audio_graph()) {
         // 7.4: In case of failure, queue a media element task to execute the following steps:
         queue_a_media_element_task([&realm, this]() {
@@ -220,7 +222,8 @@ WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::Promise>> AudioContext::suspend()
     // 7. Queue a control message to suspend the AudioContext.
     // FIXME: Implement control message queue to run following steps on the rendering thread
 
-    // FIXME: 7.1: Attempt to release system resources.
+    // 7.1: Attempt to release system resources.
+    renderer().suspend_rendering();
 
     // 7.2: Set the [[rendering thread state]] on the AudioContext to suspended.
     set_rendering_state(Bindings::AudioContextState::Suspended);
@@ -271,7 +274,9 @@ WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::Promise>> AudioContext::close()
     // 5. Queue a control message to close the AudioContext.
     // FIXME: Implement control message queue to run following steps on the rendering thread
 
-    // FIXME: 5.1: Attempt to release system resources.
+    // 5.1: Attempt to release system resources.
+    // FIXME: Release the output device instead of only suspending it.
+    renderer().suspend_rendering();
 
     // 5.2: Set the [[rendering thread state]] to "suspended".
     set_rendering_state(Bindings::AudioContextState::Suspended);
@@ -304,11 +309,14 @@ void AudioContext::queue_a_media_element_task(Function<void()> steps)
     HTML::main_thread_event_loop().task_queue().add(move(task));
 }
 
-// FIXME: Actually implement the rendering thread
 bool AudioContext::start_rendering_audio_graph()
 {
-    bool render_result = true;
-    return render_result;
+    auto result = renderer().start_rendering(sample_rate());
+    if (result.is_error()) {
+        dbgln("Failed to start rendering the audio graph: {}", result.error());
+        return false;
+    }
+    return true;
 }
 
 }
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/Bindings/AudioDestinationNodePrototype.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/WebAudio/AudioDestinationNode.h>
+#include <LibWeb/WebAudio/BaseAudioContext.h>
+
+namespace Web::WebAudio {
+
+JS_DEFINE_ALLOCATOR(AudioDestinationNode);
+
+AudioDestinationNode::AudioDestinationNode(JS::Realm& realm, JS::NonnullGCPtr<BaseAudioContext> context, NonnullRefPtr<RenderNode> render_node)
+    : AudioNode(realm, context, move(render_node))
+{
+}
+
+AudioDestinationNode::~AudioDestinationNode() = default;
+
+JS::NonnullGCPtr<AudioDestinationNode> AudioDestinationNode::create(JS::Realm& realm, JS::NonnullGCPtr<BaseAudioContext> context, NonnullRefPtr<RenderNode> render_node)
+{
+    return realm.heap().allocate<AudioDestinationNode>(realm, realm, context, move(render_node));
+}
+
+// https://webaudio.github.io/web-audio-api/#dom-audiodestinationnode-maxchannelcount
+WebIDL::UnsignedLong AudioDestinationNode::max_channel_count() const
+{
+    // The maximum number of channels that the channelCount attribute can be set to.
+    // FIXME: Query the output device, the renderer always plays stereo for now.
+    return 2;
+}
+
+void AudioDestinationNode::initialize(JS::Realm& realm)
+{
+    Base::initialize(realm);
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(AudioDestinationNode);
+}
+
+}
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibWeb/WebAudio/AudioNode.h>
+
+namespace Web::WebAudio {
+
+// https://webaudio.github.io/web-audio-api/#AudioDestinationNode
+class AudioDestinationNode : public AudioNode {
+    WEB_PLATFORM_OBJECT(AudioDestinationNode, AudioNode);
+    JS_DECLARE_ALLOCATOR(AudioDestinationNode);
+
+public:
+    virtual ~AudioDestinationNode() override;
+
+    static JS::NonnullGCPtr<AudioDestinationNode> create(JS::Realm&, JS::NonnullGCPtr<BaseAudioContext>, NonnullRefPtr<RenderNode>);
+
+    WebIDL::UnsignedLong max_channel_count() const;
+
+    virtual WebIDL::UnsignedLong number_of_outputs() const override { return 0; }
+
+protected:
+    AudioDestinationNode(JS::Realm&, JS::NonnullGCPtr<BaseAudioContext>, NonnullRefPtr<RenderNode>);
+
+    virtual void initialize(JS::Realm&) override;
+};
+
+}
@@ -6,16 +6,17 @@
 
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/WebAudio/AudioNode.h>
+#include <LibWeb/WebAudio/AudioRenderer.h>
 #include <LibWeb/WebAudio/BaseAudioContext.h>
 
 namespace Web::WebAudio {
 
 JS_DEFINE_ALLOCATOR(AudioNode);
 
-AudioNode::AudioNode(JS::Realm& realm, JS::NonnullGCPtr<BaseAudioContext> context)
+AudioNode::AudioNode(JS::Realm& realm, JS::NonnullGCPtr<BaseAudioContext> context, NonnullRefPtr<RenderNode> render_node)
     : DOM::EventTarget(realm)
     , m_context(context)
-
+    , m_render_node(move(render_node))
 {
 }
 
@@ -24,10 +25,30 @@ AudioNode::~AudioNode() = default;
 // https://webaudio.github.io/web-audio-api/#dom-audionode-connect
 WebIDL::ExceptionOr<JS::NonnullGCPtr<AudioNode>> AudioNode::connect(JS::NonnullGCPtr<AudioNode> destination_node, WebIDL::UnsignedLong output, WebIDL::UnsignedLong input)
 {
-    (void)destination_node;
-    (void)output;
-    (void)input;
-    return WebIDL::NotSupportedError::create(realm(), "FIXME: Implement AudioNode::connect (AudioNode)"_fly_string);
+    // If the destination parameter is an AudioNode that has been created using another AudioContext, an InvalidAccessError MUST be thrown.
+    if (destination_node->m_context != m_context)
+        return WebIDL::InvalidAccessError::create(realm(), "Cannot connect to an AudioNode in a different AudioContext"_fly_string);
+
+    // The output parameter is an index describing which output of the AudioNode from which to connect.
+    // If this parameter is out-of-bounds, an IndexSizeError exception MUST be thrown.
+    if (output >= number_of_outputs())
+        return WebIDL::IndexSizeError::create(realm(), MUST(String::formatted("Output index {} exceeds number of outputs", output)));
+
+    // The input parameter is an index describing which input of the destination AudioNode to connect to.
+    // If this parameter is out-of-bounds, an IndexSizeError exception MUST be thrown.
+    if (input >= destination_node->number_of_inputs())
+        return WebIDL::IndexSizeError::create(realm(), MUST(String::formatted("Input index {} exceeds number of inputs", input)));
+
+    // It is possible to connect an AudioNode output to more than one input with multiple calls to connect().
+    // Thus, "fan-out" is supported.
+    // FIXME: Keep track of the output and input indices once there are nodes with more than one of either.
+    if (!m_output_connections.contains_slow(destination_node)) {
+        m_output_connections.append(destination_node);
+        m_context->renderer().connect(m_render_node, destination_node->m_render_node);
+    }
+
+    // This method returns destination AudioNode object.
+    return destination_node;
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audionode-connect-destinationparam-output
@@ -41,7 +62,10 @@ WebIDL::ExceptionOr<JS::NonnullGCPtr<AudioNode>> AudioNode::connect(JS::NonnullG
 // https://webaudio.github.io/web-audio-api/#dom-audionode-disconnect
 void AudioNode::disconnect()
 {
-    dbgln("FIXME: Implement AudioNode::disconnect()");
+    // Disconnects all outgoing connections from the AudioNode.
+    for (auto& destination_node : m_output_connections)
+        m_context->renderer().disconnect(m_render_node, destination_node->m_render_node);
+    m_output_connections.clear();
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audionode-disconnect-output
@@ -52,10 +76,17 @@ void AudioNode::disconnect(WebIDL::UnsignedLong output)
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audionode-disconnect-destinationnode
-void AudioNode::disconnect(JS::NonnullGCPtr<AudioNode> destination_node)
+WebIDL::ExceptionOr<void> AudioNode::disconnect(JS::NonnullGCPtr<AudioNode> destination_node)
 {
-    (void)destination_node;
-    dbgln("FIXME: Implement AudioNode::disconnect(destination_node)");
+    // Disconnects all outputs of the AudioNode that go to a specific destination AudioNode.
+    // If there is no connection to the destinationNode, an InvalidAccessError exception MUST be thrown.
+    auto index = m_output_connections.find_first_index(destination_node);
+    if (!index.has_value())
+        return WebIDL::InvalidAccessError::create(realm(), "The AudioNode is not connected to the given destination"_fly_string);
+
+    m_output_connections.remove(index.value());
+    m_context->renderer().disconnect(m_render_node, destination_node->m_render_node);
+    return {};
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audionode-disconnect-destinationnode-output
@@ -100,6 +131,7 @@ void AudioNode::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(m_context);
+    visitor.visit(m_output_connections);
 }
 
 }
@@ -11,6 +11,7 @@
 #include <LibWeb/Bindings/AudioNodePrototype.h>
 #include <LibWeb/Bindings/PlatformObject.h>
 #include <LibWeb/DOM/EventTarget.h>
+#include <LibWeb/WebAudio/RenderNode.h>
 #include <LibWeb/WebIDL/Types.h>
 
 namespace Web::WebAudio {
@@ -35,7 +36,7 @@ public:
 
     void disconnect();
     void disconnect(WebIDL::UnsignedLong output);
-    void disconnect(JS::NonnullGCPtr<AudioNode> destination_node);
+    WebIDL::ExceptionOr<void> disconnect(JS::NonnullGCPtr<AudioNode> destination_node);
     void disconnect(JS::NonnullGCPtr<AudioNode> destination_node, WebIDL::UnsignedLong output);
     void disconnect(JS::NonnullGCPtr<AudioNode> destination_node, WebIDL::UnsignedLong output, WebIDL::UnsignedLong input);
     void disconnect(JS::NonnullGCPtr<AudioParam> destination_param);
@@ -48,14 +49,26 @@ public:
         return m_context;
     }
 
+    // https://webaudio.github.io/web-audio-api/#dom-audionode-numberofinputs
+    virtual WebIDL::UnsignedLong number_of_inputs() const { return 1; }
+
+    // https://webaudio.github.io/web-audio-api/#dom-audionode-numberofoutputs
+    virtual WebIDL::UnsignedLong number_of_outputs() const { return 1; }
+
+    NonnullRefPtr<RenderNode> render_node() const { return m_render_node; }
+
 protected:
-    AudioNode(JS::Realm&, JS::NonnullGCPtr<BaseAudioContext>);
+    AudioNode(JS::Realm&, JS::NonnullGCPtr<BaseAudioContext>, NonnullRefPtr<RenderNode> = RenderNode::create());
 
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
 
 private:
     JS::NonnullGCPtr<BaseAudioContext> m_context;
+    NonnullRefPtr<RenderNode> m_render_node;
+
+    // The nodes that the output of this node is connected to.
+    Vector<JS::NonnullGCPtr<AudioNode>> m_output_connections;
 };
 
 }
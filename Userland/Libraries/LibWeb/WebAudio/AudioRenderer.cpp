@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/ThreadedPromise.h>
+#include <LibWeb/WebAudio/AudioRenderer.h>
+
+namespace Web::WebAudio {
+
+// The latency requested from the audio server. Render quanta are small enough that this is what determines how much
+// time the control thread has to react to changes before they are heard.
+static constexpr u32 target_latency_ms = 40;
+
+// How long to wait before retrying to send graph changes that didn't fit into the queue.
+static constexpr int pending_graph_messages_retry_interval_ms = 10;
+
+NonnullRefPtr<AudioRenderer> AudioRenderer::create(NonnullRefPtr<RenderNode> destination)
+{
+    return adopt_ref(*new AudioRenderer(move(destination)));
+}
+
+AudioRenderer::AudioRenderer(NonnullRefPtr<RenderNode> destination)
+    : m_destination(move(destination))
+{
+}
+
+AudioRenderer::~AudioRenderer()
+{
+    // The stream has to stop calling into us before the rest of our members are destroyed.
+    m_output = nullptr;
+}
+
+void AudioRenderer::connect(NonnullRefPtr<RenderNode> source, NonnullRefPtr<RenderNode> destination)
+{
+    send_graph_message({ RenderGraphMessage::Type::Connect, move(source), move(destination) });
+}
+
+void AudioRenderer::disconnect(NonnullRefPtr<RenderNode> source, NonnullRefPtr<RenderNode> destination)
+{
+    send_graph_message({ RenderGraphMessage::Type::Disconnect, move(source), move(destination) });
+}
+
+void AudioRenderer::send_graph_message(RenderGraphMessage&& message)
+{
+    // Until the rendering thread exists, nothing else can be looking at the graph.
+    if (!m_graph_messages.has_value()) {
+        apply_graph_message(move(message));
+        return;
+    }
+
+    // Messages must arrive in order, so anything still waiting goes first.
+    flush_pending_graph_messages();
+    if (m_pending_graph_messages.is_empty() && m_graph_messages->can_enqueue()) {
+        MUST(m_graph_messages->enqueue(move(message)));
+        return;
+    }
+
+    m_pending_graph_messages.append(move(message));
+    if (!m_pending_graph_messages_timer) {
+        m_pending_graph_messages_timer = Platform::Timer::create_single_shot(pending_graph_messages_retry_interval_ms, [this] {
+            flush_pending_graph_messages();
+        });
+    }
+    if (!m_pending_graph_messages_timer->is_active())
+        m_pending_graph_messages_timer->start();
+}
+
+void AudioRenderer::flush_pending_graph_messages()
+{
+    size_t sent_messages = 0;
+    for (auto& message : m_pending_graph_messages) {
+        if (!m_graph_messages->can_enqueue())
+            break;
+        MUST(m_graph_messages->enqueue(move(message)));
+        ++sent_messages;
+    }
+    m_pending_graph_messages.remove(0, sent_messages);
+
+    if (!m_pending_graph_messages.is_empty())
+        m_pending_graph_messages_timer->start();
+}
+
+void AudioRenderer::apply_graph_message(RenderGraphMessage&& message)
+{
+    switch (message.type) {
+    case RenderGraphMessage::Type::Connect:
+        message.destination->add_input(message.source.release_nonnull());
+        break;
+    case RenderGraphMessage::Type::Disconnect:
+        message.destination->remove_input(*message.source);
+        break;
+    }
+}
+
+ErrorOr<void> AudioRenderer::start_rendering(float sample_rate)
+{
+    if (m_output) {
+        m_output->resume()->when_rejected([](Error&&) {
+            // FIXME: Propagate errors.
+        });
+        return {};
+    }
+
+    // The rendering thread may start pulling audio as soon as the stream is created, so everything it reads has to
+    // be set up beforehand.
+    m_sample_rate = sample_rate;
+    m_graph_messages = TRY(GraphMessageQueue::create());
+
+    auto output = Audio::PlaybackStream::create(
+        Audio::OutputState::Playing, static_cast<u32>(sample_rate), channel_count, target_latency_ms,
+        [this](Bytes buffer, Audio::PcmSampleFormat format, size_t sample_count) -> ReadonlyBytes {
+            return render(buffer, format, sample_count);
+        });
+    if (output.is_error()) {
+        m_graph_messages.clear();
+        return output.release_error();
+    }
+    m_output = output.release_value();
+    return {};
+}
+
+void AudioRenderer::suspend_rendering()
+{
+    if (!m_output)
+        return;
+    m_output->drain_buffer_and_suspend()->when_rejected([](Error&&) {
+        // FIXME: Propagate errors.
+    });
+}
+
+double AudioRenderer::current_time() const
+{
+    if (m_sample_rate == 0)
+        return 0;
+    return static_cast<double>(m_rendered_frames.load(AK::MemoryOrder::memory_order_relaxed)) / m_sample_rate;
+}
+
+ReadonlyBytes AudioRenderer::render(Bytes buffer, Audio::PcmSampleFormat format, size_t sample_count)
+{
+    VERIFY(format == Audio::PcmSampleFormat::Float32);
+    VERIFY(buffer.size() >= sample_count * channel_count * sizeof(float));
+
+    auto* samples = reinterpret_cast<float*>(buffer.data());
+    for (size_t frame = 0; frame < sample_count; ++frame) {
+        if (m_quantum_position == render_quantum_size)
+            render_quantum();
+
+        // FIXME: Honor the channel count of the destination instead of playing the mono mix on every channel.
+        auto sample = m_quantum[m_quantum_position++];
+        for (size_t channel = 0; channel < channel_count; ++channel)
+            samples[frame * channel_count + channel] = sample;
+    }
+
+    return buffer.trim(sample_count * channel_count * sizeof(float));
+}
+
+// https://webaudio.github.io/web-audio-api/#rendering-loop
+void AudioRenderer::render_quantum()
+{
+    // Process the control message queue.
+    while (true) {
+        auto message = m_graph_messages->dequeue();
+        if (message.is_error())
+            break;
+        apply_graph_message(message.release_value());
+    }
+
+    // FIXME: Run the remaining steps of the rendering loop that concern AudioWorklets, cycles and tail-time.
+
+    // Process the graph by pulling the quantum through the AudioDestinationNode.
+    RenderContext context { m_sample_rate, m_next_quantum_frame };
+    m_quantum = m_destination->pull(context);
+    m_quantum_position = 0;
+
+    // Advance the current frame by the render quantum size.
+    m_next_quantum_frame += render_quantum_size;
+    m_rendered_frames.store(m_next_quantum_frame, AK::MemoryOrder::memory_order_relaxed);
+}
+
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/AtomicRefCounted.h>
+#include <AK/RefPtr.h>
+#include <AK/Vector.h>
+#include <LibAudio/PlaybackStream.h>
+#include <LibCore/SharedCircularQueue.h>
+#include <LibWeb/Platform/Timer.h>
+#include <LibWeb/WebAudio/RenderNode.h>
+
+namespace Web::WebAudio {
+
+// A change to the rendering graph, sent from the control thread to the rendering thread.
+struct RenderGraphMessage {
+    enum class Type : u8 {
+        Connect,
+        Disconnect,
+    };
+
+    Type type { Type::Connect };
+    RefPtr<RenderNode> source;
+    RefPtr<RenderNode> destination;
+};
+
+// https://webaudio.github.io/web-audio-api/#rendering-thread
+// Renders the graph of a BaseAudioContext in render quanta, from the rendering thread of an Audio::PlaybackStream.
+// The control thread never shares a lock with the rendering thread: graph changes are handed over through a
+// lock-free single-producer queue, and parameters through atomics on each node.
+class AudioRenderer final : public AtomicRefCounted<AudioRenderer> {
+public:
+    static NonnullRefPtr<AudioRenderer> create(NonnullRefPtr<RenderNode> destination);
+
+    ~AudioRenderer();
+
+    NonnullRefPtr<RenderNode> destination() const { return m_destination; }
+
+    // These must only be called from the control thread.
+    void connect(NonnullRefPtr<RenderNode> source, NonnullRefPtr<RenderNode> destination);
+    void disconnect(NonnullRefPtr<RenderNode> source, NonnullRefPtr<RenderNode> destination);
+    ErrorOr<void> start_rendering(float sample_rate);
+    void suspend_rendering();
+
+    // https://webaudio.github.io/web-audio-api/#dom-baseaudiocontext-currenttime
+    double current_time() const;
+
+private:
+    explicit AudioRenderer(NonnullRefPtr<RenderNode> destination);
+
+    static constexpr u8 channel_count = 2;
+    static constexpr size_t graph_message_queue_size = 256;
+    using GraphMessageQueue = Core::SharedSingleProducerCircularQueue<RenderGraphMessage, graph_message_queue_size>;
+
+    void send_graph_message(RenderGraphMessage&&);
+    void flush_pending_graph_messages();
+    static void apply_graph_message(RenderGraphMessage&&);
+
+    // These are only called on the rendering thread.
+    ReadonlyBytes render(Bytes buffer, Audio::PcmSampleFormat, size_t sample_count);
+    void render_quantum();
+
+    NonnullRefPtr<RenderNode> m_destination;
+
+    // Owned by the control thread.
+    RefPtr<Audio::PlaybackStream> m_output;
+    Optional<GraphMessageQueue> m_graph_messages;
+    Vector<RenderGraphMessage> m_pending_graph_messages;
+    RefPtr<Platform::Timer> m_pending_graph_messages_timer;
+    float m_sample_rate { 0 };
+
+    // Owned by the rendering thread.
+    RenderQuantum m_quantum {};
+    size_t m_quantum_position { render_quantum_size };
+    u64 m_next_quantum_frame { 0 };
+
+    // The number of sample-frames that have been rendered, which is the base of the context's currentTime.
+    Atomic<u64> m_rendered_frames { 0 };
+};
+
+}
@@ -24,11 +24,19 @@ public:
     WebIDL::ExceptionOr<void> start(double when = 0);
     WebIDL::ExceptionOr<void> stop(double when = 0);
 
+    virtual WebIDL::UnsignedLong number_of_inputs() const override { return 0; }
+
 protected:
-    AudioScheduledSourceNode(JS::Realm&, JS::NonnullGCPtr<BaseAudioContext>);
+    AudioScheduledSourceNode(JS::Realm&, JS::NonnullGCPtr<BaseAudioContext>, NonnullRefPtr<ScheduledRenderNode>);
 
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
+
+    ScheduledRenderNode& scheduled_render_node() { return static_cast<ScheduledRenderNode&>(*render_node()); }
+
+private:
+    // https://webaudio.github.io/web-audio-api/#dom-audioscheduledsourcenode-source-started-slot
+    bool m_source_started { false }; // [[source started]]
 };
 
 }
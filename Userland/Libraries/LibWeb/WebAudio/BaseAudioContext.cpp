@@ -9,6 +9,7 @@
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/HTML/EventNames.h>
 #include <LibWeb/WebAudio/AudioBuffer.h>
+#include <LibWeb/WebAudio/AudioDestinationNode.h>
 #include <LibWeb/WebAudio/BaseAudioContext.h>
 #include <LibWeb/WebAudio/DynamicsCompressorNode.h>
 #include <LibWeb/WebAudio/GainNode.h>
@@ -19,6 +20,7 @@ namespace Web::WebAudio {
 BaseAudioContext::BaseAudioContext(JS::Realm& realm, float sample_rate)
     : DOM::EventTarget(realm)
     , m_sample_rate(sample_rate)
+    , m_renderer(AudioRenderer::create(RenderNode::create()))
 {
 }
 
@@ -28,6 +30,16 @@ void BaseAudioContext::initialize(JS::Realm& realm)
 {
     Base::initialize(realm);
     WEB_SET_PROTOTYPE_FOR_INTERFACE(BaseAudioContext);
+
+    // https://webaudio.github.io/web-audio-api/#dom-baseaudiocontext-destination
+    // An AudioDestinationNode with a single input representing the final destination for all audio.
+    m_destination = AudioDestinationNode::create(realm, *this, m_renderer->destination());
+}
+
+void BaseAudioContext::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_destination);
 }
 
 void BaseAudioContext::set_onstatechange(WebIDL::CallbackType* event_handler)
@@ -13,6 +13,27 @@ namespace Web::WebAudio {
 
 JS_DEFINE_ALLOCATOR(GainNode);
 
+// https://webaudio.github.io/web-audio-api/#gainnode
+class GainRenderNode final : public RenderNode {
+public:
+    static NonnullRefPtr<GainRenderNode> create() { return adopt_ref(*new GainRenderNode); }
+
+    void set_gain(NonnullRefPtr<RenderParam> gain) { m_gain = move(gain); }
+
+private:
+    GainRenderNode() = default;
+
+    virtual void process(RenderContext const&, RenderQuantum const& input, RenderQuantum& output) override
+    {
+        // FIXME: The gain is an a-rate parameter and should be computed for every sample-frame.
+        auto gain = m_gain->value();
+        for (size_t i = 0; i < render_quantum_size; ++i)
+            output[i] = input[i] * gain;
+    }
+
+    RefPtr<RenderParam> m_gain;
+};
+
 GainNode::~GainNode() = default;
 
 JS::NonnullGCPtr<GainNode> GainNode::create(JS::Realm& realm, JS::NonnullGCPtr<BaseAudioContext> context, GainOptions const& options)
@@ -28,9 +49,10 @@ JS::NonnullGCPtr<GainNode> GainNode::construct_impl(JS::Realm& realm, JS::Nonnul
 }
 
 GainNode::GainNode(JS::Realm& realm, JS::NonnullGCPtr<BaseAudioContext> context, GainOptions const& options)
-    : AudioNode(realm, context)
+    : AudioNode(realm, context, GainRenderNode::create())
     , m_gain(AudioParam::create(realm, options.gain, NumericLimits<float>::lowest(), NumericLimits<float>::max(), Bindings::AutomationRate::ARate))
 {
+    static_cast<GainRenderNode&>(*render_node()).set_gain(m_gain->render_param());
 }
 
 void GainNode::initialize(JS::Realm& realm)
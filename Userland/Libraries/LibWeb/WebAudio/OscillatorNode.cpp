@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Math.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Bindings/OscillatorNodePrototype.h>
 #include <LibWeb/WebAudio/AudioParam.h>
@@ -14,6 +15,61 @@ namespace Web::WebAudio {
 
 JS_DEFINE_ALLOCATOR(OscillatorNode);
 
+// https://webaudio.github.io/web-audio-api/#oscillatornode
+class OscillatorRenderNode final : public ScheduledRenderNode {
+public:
+    static NonnullRefPtr<OscillatorRenderNode> create(Bindings::OscillatorType type) { return adopt_ref(*new OscillatorRenderNode(type)); }
+
+    void set_type(Bindings::OscillatorType type) { m_type.store(type, AK::MemoryOrder::memory_order_relaxed); }
+    void set_frequency(NonnullRefPtr<RenderParam> frequency) { m_frequency = move(frequency); }
+
+private:
+    explicit OscillatorRenderNode(Bindings::OscillatorType type)
+        : m_type(type)
+    {
+    }
+
+    // https://webaudio.github.io/web-audio-api/#oscillator-coefficients
+    // FIXME: The waveforms should be band-limited to avoid aliasing.
+    static float sample_waveform(Bindings::OscillatorType type, float phase)
+    {
+        switch (type) {
+        case Bindings::OscillatorType::Sine:
+            return AK::sin(2 * AK::Pi<float> * phase);
+        case Bindings::OscillatorType::Square:
+            return phase < 0.5f ? 1 : -1;
+        case Bindings::OscillatorType::Sawtooth:
+            return 2 * (phase - AK::floor(phase + 0.5f));
+        case Bindings::OscillatorType::Triangle:
+            if (phase < 0.25f)
+                return 4 * phase;
+            if (phase < 0.75f)
+                return 2 - 4 * phase;
+            return 4 * phase - 4;
+        case Bindings::OscillatorType::Custom:
+            // FIXME: Render the PeriodicWave.
+            return 0;
+        }
+        VERIFY_NOT_REACHED();
+    }
+
+    virtual void render_playing_frames(RenderContext const& context, Span<float> output) override
+    {
+        // FIXME: The frequency is an a-rate parameter and should be computed for every sample-frame, and combined with the detune.
+        auto phase_increment = m_frequency->value() / context.sample_rate;
+        auto type = m_type.load(AK::MemoryOrder::memory_order_relaxed);
+        for (auto& sample : output) {
+            sample = sample_waveform(type, m_phase);
+            m_phase += phase_increment;
+            m_phase -= AK::floor(m_phase);
+        }
+    }
+
+    Atomic<Bindings::OscillatorType> m_type;
+    RefPtr<RenderParam> m_frequency;
+    float m_phase { 0 };
+};
+
 OscillatorNode::~OscillatorNode() = default;
 
 WebIDL::ExceptionOr<JS::NonnullGCPtr<OscillatorNode>> OscillatorNode::create(JS::Realm& realm, JS::NonnullGCPtr<BaseAudioContext> context, OscillatorOptions const& options)
@@ -31,9 +87,16 @@ WebIDL::ExceptionOr<JS::NonnullGCPtr<OscillatorNode>> OscillatorNode::construct_
 }
 
 OscillatorNode::OscillatorNode(JS::Realm& realm, JS::NonnullGCPtr<BaseAudioContext> context, OscillatorOptions const& options)
-    : AudioScheduledSourceNode(realm, context)
+    : AudioScheduledSourceNode(realm, context, OscillatorRenderNode::create(options.type))
+    , m_type(options.type)
     , m_frequency(AudioParam::create(realm, options.frequency, -context->nyquist_frequency(), context->nyquist_frequency(), Bindings::AutomationRate::ARate))
 {
+    oscillator_render_node().set_frequency(m_frequency->render_param());
+}
+
+OscillatorRenderNode& OscillatorNode::oscillator_render_node()
+{
+    return static_cast<OscillatorRenderNode&>(scheduled_render_node());
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-oscillatornode-type
@@ -60,6 +123,7 @@ WebIDL::ExceptionOr<void> OscillatorNode::set_type(Bindings::OscillatorType type
 {
     TRY(verify_valid_type(realm(), type));
     m_type = type;
+    oscillator_render_node().set_type(type);
     return {};
 }
 
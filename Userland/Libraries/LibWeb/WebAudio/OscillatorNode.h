@@ -11,6 +11,8 @@
 
 namespace Web::WebAudio {
 
+class OscillatorRenderNode;
+
 // https://webaudio.github.io/web-audio-api/#OscillatorOptions
 struct OscillatorOptions : AudioNodeOptions {
     Bindings::OscillatorType type { Bindings::OscillatorType::Sine };
@@ -44,6 +46,8 @@ protected:
 private:
     static WebIDL::ExceptionOr<void> verify_valid_type(JS::Realm&, Bindings::OscillatorType);
 
+    OscillatorRenderNode& oscillator_render_node();
+
     // https://webaudio.github.io/web-audio-api/#dom-oscillatornode-type
     Bindings::OscillatorType m_type { Bindings::OscillatorType::Sine };
 
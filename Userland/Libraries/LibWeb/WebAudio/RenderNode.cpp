@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Math.h>
+#include <LibWeb/WebAudio/RenderNode.h>
+
+namespace Web::WebAudio {
+
+RenderQuantum const& RenderNode::pull(RenderContext const& context)
+{
+    if (m_rendered_frame == context.current_frame)
+        return m_output;
+
+    // https://webaudio.github.io/web-audio-api/#cycle
+    // FIXME: Cycles are only allowed when they contain a DelayNode, the rest of the cycle should be muted. For now,
+    //        we stop at the node where we detect the cycle by rendering silence for it.
+    static RenderQuantum const silence {};
+    if (m_is_rendering)
+        return silence;
+    m_is_rendering = true;
+
+    RenderQuantum input {};
+    for (auto& input_node : m_inputs) {
+        auto const& input_quantum = input_node->pull(context);
+        for (size_t i = 0; i < render_quantum_size; ++i)
+            input[i] += input_quantum[i];
+    }
+
+    process(context, input, m_output);
+    m_rendered_frame = context.current_frame;
+    m_is_rendering = false;
+    return m_output;
+}
+
+void RenderNode::add_input(NonnullRefPtr<RenderNode> input)
+{
+    // Connecting the same output to the same input more than once is ignored.
+    if (m_inputs.contains_slow(input))
+        return;
+    m_inputs.append(move(input));
+}
+
+void RenderNode::remove_input(RenderNode const& input)
+{
+    m_inputs.remove_first_matching([&](auto const& node) { return node.ptr() == &input; });
+}
+
+void RenderNode::process(RenderContext const&, RenderQuantum const& input, RenderQuantum& output)
+{
+    output = input;
+}
+
+void ScheduledRenderNode::process(RenderContext const& context, RenderQuantum const&, RenderQuantum& output)
+{
+    output.fill(0);
+
+    // Convert the scheduled times to the sample-frames of this quantum during which the node is playing.
+    auto frame_for_time = [&](double time) -> u64 {
+        auto frame = AK::ceil(time * context.sample_rate);
+        if (frame <= static_cast<double>(context.current_frame))
+            return context.current_frame;
+        if (frame >= static_cast<double>(context.current_frame + render_quantum_size))
+            return context.current_frame + render_quantum_size;
+        return static_cast<u64>(frame);
+    };
+    auto start_frame = frame_for_time(m_start_time.load());
+    auto stop_frame = frame_for_time(m_stop_time.load());
+    if (start_frame >= stop_frame)
+        return;
+
+    render_playing_frames(context, output.span().slice(start_frame - context.current_frame, stop_frame - start_frame));
+}
+
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/Atomic.h>
+#include <AK/AtomicRefCounted.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/NumericLimits.h>
+#include <AK/Optional.h>
+#include <AK/Span.h>
+#include <AK/Vector.h>
+
+namespace Web::WebAudio {
+
+// https://webaudio.github.io/web-audio-api/#render-quantum-size
+static constexpr size_t render_quantum_size = 128;
+
+// FIXME: Connections only carry a single channel, mix channels according to each node's channel count and interpretation.
+using RenderQuantum = Array<float, render_quantum_size>;
+
+// State of the rendering thread that is shared by every node while one render quantum is being rendered.
+struct RenderContext {
+    float sample_rate { 0 };
+    // The index of the first sample-frame of the render quantum, counted from the start of rendering.
+    u64 current_frame { 0 };
+};
+
+// The rendering thread's side of an AudioParam. The control thread hands its value over through an atomic, so
+// reading it never blocks the rendering thread.
+class RenderParam final : public AtomicRefCounted<RenderParam> {
+public:
+    static NonnullRefPtr<RenderParam> create(float value) { return adopt_ref(*new RenderParam(value)); }
+
+    // FIXME: Support automation events and a-rate parameters, which need a value for every sample-frame.
+    float value() const { return m_value.load(AK::MemoryOrder::memory_order_relaxed); }
+    void set_value(float value) { m_value.store(value, AK::MemoryOrder::memory_order_relaxed); }
+
+private:
+    explicit RenderParam(float value)
+        : m_value(value)
+    {
+    }
+
+    Atomic<float> m_value;
+};
+
+// The rendering thread's side of an AudioNode, which renders one render quantum at a time by pulling the quanta of
+// the nodes connected to its input. Once rendering has started, connections must only be changed on the rendering
+// thread, see AudioRenderer.
+class RenderNode : public AtomicRefCounted<RenderNode> {
+public:
+    static NonnullRefPtr<RenderNode> create() { return adopt_ref(*new RenderNode); }
+
+    virtual ~RenderNode() = default;
+
+    // Returns the output of this node for the render quantum starting at context.current_frame, rendering it first
+    // if that hasn't happened yet during this quantum.
+    RenderQuantum const& pull(RenderContext const&);
+
+    void add_input(NonnullRefPtr<RenderNode>);
+    void remove_input(RenderNode const&);
+
+protected:
+    RenderNode() = default;
+
+    // Renders the output of this node from the sum of its inputs. By default, the input is passed through unchanged.
+    virtual void process(RenderContext const&, RenderQuantum const& input, RenderQuantum& output);
+
+private:
+    Vector<NonnullRefPtr<RenderNode>> m_inputs;
+    RenderQuantum m_output {};
+    Optional<u64> m_rendered_frame;
+    bool m_is_rendering { false };
+};
+
+// The rendering thread's side of an AudioScheduledSourceNode, which only produces sound between its scheduled start
+// and stop times.
+class ScheduledRenderNode : public RenderNode {
+public:
+    void set_start_time(double when) { m_start_time.store(when); }
+    void set_stop_time(double when) { m_stop_time.store(when); }
+
+protected:
+    ScheduledRenderNode() = default;
+
+    // Renders the sample-frames of the quantum during which the node is playing.
+    virtual void render_playing_frames(RenderContext const&, Span<float> output) = 0;
+
+private:
+    virtual void process(RenderContext const&, RenderQuantum const& input, RenderQuantum& output) override final;
+
+    Atomic<double> m_start_time { NumericLimits<double>::max() };
+    Atomic<double> m_stop_time { NumericLimits<double>::max() };
+};
+
+}
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/WebGL/BufferedOpenGLContext.h>
+
+namespace Web::WebGL {
+
+// Replaying keeps the buffer from growing without bound when a script never does anything that needs the results.
+static constexpr size_t max_buffered_commands = 1024;
+
+BufferedOpenGLContext::BufferedOpenGLContext(NonnullOwnPtr<OpenGLContext> context)
+    : m_context(move(context))
+{
+}
+
+BufferedOpenGLContext::~BufferedOpenGLContext() = default;
+
+void BufferedOpenGLContext::append(GLCommand command)
+{
+    m_commands.append(move(command));
+    if (m_commands.size() >= max_buffered_commands)
+        flush_commands();
+}
+
+void BufferedOpenGLContext::flush_commands()
+{
+    auto commands = move(m_commands);
+    for (auto const& command : commands) {
+        command.visit(
+            [&](GLCommands::Clear const& command) { m_context->gl_clear(command.mask); },
+            [&](GLCommands::ClearColor const& command) { m_context->gl_clear_color(command.red, command.green, command.blue, command.alpha); },
+            [&](GLCommands::ClearDepth const& command) { m_context->gl_clear_depth(command.depth); },
+            [&](GLCommands::ClearStencil const& command) { m_context->gl_clear_stencil(command.s); },
+            [&](GLCommands::ActiveTexture const& command) { m_context->gl_active_texture(command.texture); },
+            [&](GLCommands::Viewport const& command) { m_context->gl_viewport(command.x, command.y, command.width, command.height); },
+            [&](GLCommands::LineWidth const& command) { m_context->gl_line_width(command.width); },
+            [&](GLCommands::PolygonOffset const& command) { m_context->gl_polygon_offset(command.factor, command.units); },
+            [&](GLCommands::Scissor const& command) { m_context->gl_scissor(command.x, command.y, command.width, command.height); },
+            [&](GLCommands::DepthMask const& command) { m_context->gl_depth_mask(command.mask); },
+            [&](GLCommands::DepthFunc const& command) { m_context->gl_depth_func(command.func); },
+            [&](GLCommands::DepthRange const& command) { m_context->gl_depth_range(command.z_near, command.z_far); },
+            [&](GLCommands::CullFace const& command) { m_context->gl_cull_face(command.mode); },
+            [&](GLCommands::ColorMask const& command) { m_context->gl_color_mask(command.red, command.green, command.blue, command.alpha); },
+            [&](GLCommands::FrontFace const& command) { m_context->gl_front_face(command.mode); },
+            [&](GLCommands::StencilOpSeparate const& command) { m_context->gl_stencil_op_separate(command.face, command.fail, command.zfail, command.zpass); });
+    }
+}
+
+void BufferedOpenGLContext::present(Gfx::Bitmap& bitmap)
+{
+    flush_commands();
+    m_context->present(bitmap);
+}
+
+GLenum BufferedOpenGLContext::gl_get_error()
+{
+    flush_commands();
+
+    // NOTE: A buffered state change may have been rejected by the driver, in which case our idea of the state is wrong.
+    //       Forgetting it here makes sure an identical call after the script has looked at the error is made again.
+    m_state = {};
+
+    return m_context->gl_get_error();
+}
+
+void BufferedOpenGLContext::gl_get_doublev(GLenum pname, GLdouble* params)
+{
+    flush_commands();
+    m_context->gl_get_doublev(pname, params);
+}
+
+void BufferedOpenGLContext::gl_get_integerv(GLenum pname, GLint* params)
+{
+    flush_commands();
+    m_context->gl_get_integerv(pname, params);
+}
+
+void BufferedOpenGLContext::gl_clear(GLbitfield mask)
+{
+    append(GLCommands::Clear { mask });
+}
+
+void BufferedOpenGLContext::gl_clear_color(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    set_state(m_state.clear_color, GLCommands::ClearColor { red, green, blue, alpha });
+}
+
+void BufferedOpenGLContext::gl_clear_depth(GLdouble depth)
+{
+    set_state(m_state.clear_depth, GLCommands::ClearDepth { depth });
+}
+
+void BufferedOpenGLContext::gl_clear_stencil(GLint s)
+{
+    set_state(m_state.clear_stencil, GLCommands::ClearStencil { s });
+}
+
+void BufferedOpenGLContext::gl_active_texture(GLenum texture)
+{
+    set_state(m_state.active_texture, GLCommands::ActiveTexture { texture });
+}
+
+void BufferedOpenGLContext::gl_viewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    set_state(m_state.viewport, GLCommands::Viewport { x, y, width, height });
+}
+
+void BufferedOpenGLContext::gl_line_width(GLfloat width)
+{
+    set_state(m_state.line_width, GLCommands::LineWidth { width });
+}
+
+void BufferedOpenGLContext::gl_polygon_offset(GLfloat factor, GLfloat units)
+{
+    set_state(m_state.polygon_offset, GLCommands::PolygonOffset { factor, units });
+}
+
+void BufferedOpenGLContext::gl_scissor(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    set_state(m_state.scissor, GLCommands::Scissor { x, y, width, height });
+}
+
+void BufferedOpenGLContext::gl_depth_mask(GLboolean mask)
+{
+    set_state(m_state.depth_mask, GLCommands::DepthMask { mask });
+}
+
+void BufferedOpenGLContext::gl_depth_func(GLenum func)
+{
+    set_state(m_state.depth_func, GLCommands::DepthFunc { func });
+}
+
+void BufferedOpenGLContext::gl_depth_range(GLdouble z_near, GLdouble z_far)
+{
+    set_state(m_state.depth_range, GLCommands::DepthRange { z_near, z_far });
+}
+
+void BufferedOpenGLContext::gl_cull_face(GLenum mode)
+{
+    set_state(m_state.cull_face, GLCommands::CullFace { mode });
+}
+
+void BufferedOpenGLContext::gl_color_mask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
+{
+    set_state(m_state.color_mask, GLCommands::ColorMask { red, green, blue, alpha });
+}
+
+void BufferedOpenGLContext::gl_front_face(GLenum mode)
+{
+    set_state(m_state.front_face, GLCommands::FrontFace { mode });
+}
+
+void BufferedOpenGLContext::gl_finish()
+{
+    flush_commands();
+    m_context->gl_finish();
+}
+
+void BufferedOpenGLContext::gl_flush()
+{
+    flush_commands();
+    m_context->gl_flush();
+}
+
+void BufferedOpenGLContext::gl_stencil_op_separate(GLenum face, GLenum fail, GLenum zfail, GLenum zpass)
+{
+    append(GLCommands::StencilOpSeparate { face, fail, zfail, zpass });
+}
+
+}
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Optional.h>
+#include <AK/Variant.h>
+#include <AK/Vector.h>
+#include <LibWeb/WebGL/OpenGLContext.h>
+
+namespace Web::WebGL {
+
+namespace GLCommands {
+
+struct Clear {
+    GLbitfield mask;
+};
+
+struct ClearColor {
+    GLfloat red;
+    GLfloat green;
+    GLfloat blue;
+    GLfloat alpha;
+
+    bool operator==(ClearColor const&) const = default;
+};
+
+struct ClearDepth {
+    GLdouble depth;
+
+    bool operator==(ClearDepth const&) const = default;
+};
+
+struct ClearStencil {
+    GLint s;
+
+    bool operator==(ClearStencil const&) const = default;
+};
+
+struct ActiveTexture {
+    GLenum texture;
+
+    bool operator==(ActiveTexture const&) const = default;
+};
+
+struct Viewport {
+    GLint x;
+    GLint y;
+    GLsizei width;
+    GLsizei height;
+
+    bool operator==(Viewport const&) const = default;
+};
+
+struct LineWidth {
+    GLfloat width;
+
+    bool operator==(LineWidth const&) const = default;
+};
+
+struct PolygonOffset {
+    GLfloat factor;
+    GLfloat units;
+
+    bool operator==(PolygonOffset const&) const = default;
+};
+
+struct Scissor {
+    GLint x;
+    GLint y;
+    GLsizei width;
+    GLsizei height;
+
+    bool operator==(Scissor const&) const = default;
+};
+
+struct DepthMask {
+    GLboolean mask;
+
+    bool operator==(DepthMask const&) const = default;
+};
+
+struct DepthFunc {
+    GLenum func;
+
+    bool operator==(DepthFunc const&) const = default;
+};
+
+struct DepthRange {
+    GLdouble z_near;
+    GLdouble z_far;
+
+    bool operator==(DepthRange const&) const = default;
+};
+
+struct CullFace {
+    GLenum mode;
+
+    bool operator==(CullFace const&) const = default;
+};
+
+struct ColorMask {
+    GLboolean red;
+    GLboolean green;
+    GLboolean blue;
+    GLboolean alpha;
+
+    bool operator==(ColorMask const&) const = default;
+};
+
+struct FrontFace {
+    GLenum mode;
+
+    bool operator==(FrontFace const&) const = default;
+};
+
+struct StencilOpSeparate {
+    GLenum face;
+    GLenum fail;
+    GLenum zfail;
+    GLenum zpass;
+};
+
+}
+
+using GLCommand = Variant<
+    GLCommands::Clear,
+    GLCommands::ClearColor,
+    GLCommands::ClearDepth,
+    GLCommands::ClearStencil,
+    GLCommands::ActiveTexture,
+    GLCommands::Viewport,
+    GLCommands::LineWidth,
+    GLCommands::PolygonOffset,
+    GLCommands::Scissor,
+    GLCommands::DepthMask,
+    GLCommands::DepthFunc,
+    GLCommands::DepthRange,
+    GLCommands::CullFace,
+    GLCommands::ColorMask,
+    GLCommands::FrontFace,
+    GLCommands::StencilOpSeparate>;
+
+// Records GL calls into a command buffer instead of making them right away, and replays the buffer on the wrapped
+// context when something needs the results: presenting, finish()/flush(), or any call that reads state or errors back.
+// State changes that set what the context already has once the buffer is replayed are dropped.
+class BufferedOpenGLContext final : public OpenGLContext {
+public:
+    explicit BufferedOpenGLContext(NonnullOwnPtr<OpenGLContext>);
+    virtual ~BufferedOpenGLContext() override;
+
+    void flush_commands();
+
+    virtual void present(Gfx::Bitmap&) override;
+
+    virtual GLenum gl_get_error() override;
+    virtual void gl_get_doublev(GLenum, GLdouble*) override;
+    virtual void gl_get_integerv(GLenum, GLint*) override;
+    virtual void gl_clear(GLbitfield) override;
+    virtual void gl_clear_color(GLfloat, GLfloat, GLfloat, GLfloat) override;
+    virtual void gl_clear_depth(GLdouble) override;
+    virtual void gl_clear_stencil(GLint) override;
+    virtual void gl_active_texture(GLenum) override;
+    virtual void gl_viewport(GLint, GLint, GLsizei, GLsizei) override;
+    virtual void gl_line_width(GLfloat) override;
+    virtual void gl_polygon_offset(GLfloat, GLfloat) override;
+    virtual void gl_scissor(GLint, GLint, GLsizei, GLsizei) override;
+    virtual void gl_depth_mask(GLboolean) override;
+    virtual void gl_depth_func(GLenum) override;
+    virtual void gl_depth_range(GLdouble, GLdouble) override;
+    virtual void gl_cull_face(GLenum) override;
+    virtual void gl_color_mask(GLboolean, GLboolean, GLboolean, GLboolean) override;
+    virtual void gl_front_face(GLenum) override;
+    virtual void gl_finish() override;
+    virtual void gl_flush() override;
+    virtual void gl_stencil_op_separate(GLenum, GLenum, GLenum, GLenum) override;
+
+private:
+    void append(GLCommand);
+
+    template<typename T>
+    void set_state(Optional<T>& recorded_state, T state)
+    {
+        if (recorded_state.has_value() && *recorded_state == state)
+            return;
+        recorded_state = state;
+        append(move(state));
+    }
+
+    NonnullOwnPtr<OpenGLContext> m_context;
+    Vector<GLCommand> m_commands;
+
+    // The state the wrapped context will be in once every buffered command has run. Empty until we set it ourselves,
+    // since we never know what the driver starts out with.
+    struct State {
+        Optional<GLCommands::ClearColor> clear_color;
+        Optional<GLCommands::ClearDepth> clear_depth;
+        Optional<GLCommands::ClearStencil> clear_stencil;
+        Optional<GLCommands::ActiveTexture> active_texture;
+        Optional<GLCommands::Viewport> viewport;
+        Optional<GLCommands::LineWidth> line_width;
+        Optional<GLCommands::PolygonOffset> polygon_offset;
+        Optional<GLCommands::Scissor> scissor;
+        Optional<GLCommands::DepthMask> depth_mask;
+        Optional<GLCommands::DepthFunc> depth_func;
+        Optional<GLCommands::DepthRange> depth_range;
+        Optional<GLCommands::CullFace> cull_face;
+        Optional<GLCommands::ColorMask> color_mask;
+        Optional<GLCommands::FrontFace> front_face;
+    };
+    State m_state;
+};
+
+}
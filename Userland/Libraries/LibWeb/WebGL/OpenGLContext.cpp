@@ -6,6 +6,7 @@
 
 #include <AK/OwnPtr.h>
 #include <LibGfx/Bitmap.h>
+#include <LibWeb/WebGL/BufferedOpenGLContext.h>
 #include <LibWeb/WebGL/OpenGLContext.h>
 
 #ifdef HAS_ACCELERATED_GRAPHICS
@@ -189,7 +190,10 @@ static OwnPtr<AccelGfxContext> make_accelgfx_context(Gfx::Bitmap& bitmap)
 OwnPtr<OpenGLContext> OpenGLContext::create(Gfx::Bitmap& bitmap)
 {
 #ifdef HAS_ACCELERATED_GRAPHICS
-    return make_accelgfx_context(bitmap);
+    auto context = make_accelgfx_context(bitmap);
+    if (!context)
+        return {};
+    return make<BufferedOpenGLContext>(context.release_nonnull());
 #endif
 
     (void)bitmap;
@@ -126,6 +126,10 @@ ErrorOr<void> WebSocket::establish_web_socket_connection(URL::URL& url_record, V
     auto& window = verify_cast<HTML::Window>(client.global_object());
     auto origin_string = window.associated_document().origin().serialize();
 
+    // AD-HOC: The unloading document cleanup steps can't make WebSockets disappear yet, which would make the document
+    //         unsalvageable. Do so up front, so that a document with WebSockets is never kept in the back/forward cache.
+    window.associated_document().set_salvageable(false);
+
     Vector<ByteString> protcol_byte_strings;
     for (auto const& protocol : protocols)
         TRY(protcol_byte_strings.try_append(protocol.to_byte_string()));
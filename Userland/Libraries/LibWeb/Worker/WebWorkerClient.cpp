@@ -12,6 +12,8 @@ namespace Web::HTML {
 void WebWorkerClient::die()
 {
     // FIXME: Notify WorkerAgent that the worker is ded
+    if (on_death)
+        on_death();
 }
 
 WebWorkerClient::WebWorkerClient(NonnullOwnPtr<Core::LocalSocket> socket)
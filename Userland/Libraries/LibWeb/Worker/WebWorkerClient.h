@@ -23,6 +23,8 @@ public:
 
     IPC::File dup_socket();
 
+    Function<void()> on_death;
+
 private:
     virtual void die() override;
 };
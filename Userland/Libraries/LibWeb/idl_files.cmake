@@ -199,12 +199,15 @@ libweb_js_bindings(HTML/NavigationDestination)
 libweb_js_bindings(HTML/NavigationHistoryEntry)
 libweb_js_bindings(HTML/NavigationTransition)
 libweb_js_bindings(HTML/Navigator)
+libweb_js_bindings(HTML/OffscreenCanvas)
+libweb_js_bindings(HTML/OffscreenCanvasRenderingContext2D)
 libweb_js_bindings(HTML/PageTransitionEvent)
 libweb_js_bindings(HTML/Path2D)
 libweb_js_bindings(HTML/Plugin)
 libweb_js_bindings(HTML/PluginArray)
 libweb_js_bindings(HTML/PopStateEvent)
 libweb_js_bindings(HTML/PromiseRejectionEvent)
+libweb_js_bindings(HTML/Scheduler)
 libweb_js_bindings(HTML/Storage)
 libweb_js_bindings(HTML/SubmitEvent)
 libweb_js_bindings(HTML/TextMetrics)
@@ -306,6 +309,7 @@ libweb_js_bindings(WebAssembly/Table)
 libweb_js_bindings(WebAssembly/WebAssembly NAMESPACE)
 libweb_js_bindings(WebAudio/AudioBuffer)
 libweb_js_bindings(WebAudio/AudioContext)
+libweb_js_bindings(WebAudio/AudioDestinationNode)
 libweb_js_bindings(WebAudio/AudioNode)
 libweb_js_bindings(WebAudio/AudioParam)
 libweb_js_bindings(WebAudio/AudioScheduledSourceNode)
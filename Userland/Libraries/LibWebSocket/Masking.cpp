@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Assertions.h>
+#include <LibWebSocket/Masking.h>
+#include <string.h>
+
+namespace WebSocket {
+
+// The masking key repeats every 4 bytes, so it is applied to 8 bytes at a time.
+void apply_masking_key(Bytes destination, ReadonlyBytes source, u8 const (&masking_key)[4])
+{
+    VERIFY(destination.size() == source.size());
+
+    u8 wide_masking_key_bytes[8] = { masking_key[0], masking_key[1], masking_key[2], masking_key[3], masking_key[0], masking_key[1], masking_key[2], masking_key[3] };
+    u64 wide_masking_key;
+    memcpy(&wide_masking_key, wide_masking_key_bytes, sizeof(wide_masking_key));
+
+    size_t i = 0;
+    for (; i + sizeof(u64) <= source.size(); i += sizeof(u64)) {
+        u64 chunk;
+        memcpy(&chunk, source.offset(i), sizeof(chunk));
+        chunk ^= wide_masking_key;
+        memcpy(destination.offset(i), &chunk, sizeof(chunk));
+    }
+    for (; i < source.size(); ++i)
+        destination[i] = source[i] ^ masking_key[i % 4];
+}
+
+}
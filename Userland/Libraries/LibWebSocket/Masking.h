@@ -0,0 +1,17 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Span.h>
+
+namespace WebSocket {
+
+// Section 5.3 of RFC 6455: Client-to-Server Masking
+// Writes source, masked with masking_key, to destination. Unmasking is the same operation.
+void apply_masking_key(Bytes destination, ReadonlyBytes source, u8 const (&masking_key)[4]);
+
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCompress/Deflate.h>
+#include <LibWebSocket/PerMessageDeflate.h>
+
+namespace WebSocket {
+
+Optional<PerMessageDeflateParameters> parse_per_message_deflate_response(ReadonlySpan<StringView> parameters)
+{
+    PerMessageDeflateParameters result;
+    bool has_server_max_window_bits = false;
+    bool has_client_no_context_takeover = false;
+
+    for (auto parameter : parameters) {
+        auto name = parameter.trim_whitespace();
+        Optional<StringView> value;
+        if (auto equals = name.find('='); equals.has_value()) {
+            value = name.substring_view(*equals + 1).trim_whitespace().trim("\""sv);
+            name = name.substring_view(0, *equals).trim_whitespace();
+        }
+
+        // Section 7.1: A response with the same parameter more than once is to be declined.
+        if (name.equals_ignoring_ascii_case("server_no_context_takeover"sv)) {
+            if (result.server_no_context_takeover || value.has_value())
+                return {};
+            result.server_no_context_takeover = true;
+            continue;
+        }
+
+        // We never keep a compression context around, so we can always agree to this.
+        if (name.equals_ignoring_ascii_case("client_no_context_takeover"sv)) {
+            if (has_client_no_context_takeover || value.has_value())
+                return {};
+            has_client_no_context_takeover = true;
+            continue;
+        }
+
+        // Section 7.1.2.1: This only limits how far back the server refers, and we always keep the largest window.
+        if (name.equals_ignoring_ascii_case("server_max_window_bits"sv)) {
+            if (has_server_max_window_bits || !value.has_value())
+                return {};
+            auto bits = value->to_number<u8>();
+            if (!bits.has_value() || *bits < 8 || *bits > 15)
+                return {};
+            has_server_max_window_bits = true;
+            continue;
+        }
+
+        // This includes client_max_window_bits, which the server may only send if we had offered it.
+        return {};
+    }
+
+    return result;
+}
+
+ErrorOr<ByteBuffer> compress_message_payload(ReadonlyBytes payload)
+{
+    auto compressed = TRY(Compress::DeflateCompressor::compress_all(payload));
+
+    // LibCompress always ends the data with a final block rather than flushing it, which Section 7.2.3.4 allows. An empty
+    // non-compressed block still has to follow it, minus the 4 octets the receiver adds back, which leaves its header.
+    TRY(compressed.try_append(0x00));
+    return compressed;
+}
+
+ErrorOr<ByteBuffer> decompress_message_payload(ReadonlyBytes payload, ReadonlyBytes window)
+{
+    VERIFY(window.size() <= per_message_deflate_max_window_size);
+
+    // LibCompress' inflater can't be given a preset dictionary. Instead, the window is put in front of the payload as a
+    // non-final non-compressed block, which leaves the payload's back references pointing into it. Both that block and
+    // the payload start on a byte boundary.
+    ByteBuffer data;
+    if (!window.is_empty()) {
+        auto length = static_cast<u16>(window.size());
+        u8 const header[] = { 0x00, static_cast<u8>(length), static_cast<u8>(length >> 8), static_cast<u8>(~length), static_cast<u8>(~length >> 8) };
+        TRY(data.try_append(header, sizeof(header)));
+        TRY(data.try_append(window));
+    }
+    TRY(data.try_append(payload));
+
+    // Add back the 4 octets of the empty non-compressed block the sender removed. That block is not final, so an empty
+    // final block is appended after it, otherwise the inflater would expect more data once it runs out of input.
+    static constexpr u8 trailer[] = { 0x00, 0x00, 0xff, 0xff, 0x03, 0x00 };
+    TRY(data.try_append(trailer, sizeof(trailer)));
+
+    auto decompressed = TRY(Compress::DeflateDecompressor::decompress_all(data));
+    if (window.is_empty())
+        return decompressed;
+    return decompressed.slice(window.size(), decompressed.size() - window.size());
+}
+
+}
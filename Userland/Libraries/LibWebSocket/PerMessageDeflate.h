@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/Error.h>
+#include <AK/Optional.h>
+#include <AK/Span.h>
+#include <AK/StringView.h>
+
+// RFC 7692: Compression Extensions for WebSocket, https://datatracker.ietf.org/doc/html/rfc7692
+namespace WebSocket {
+
+static constexpr auto per_message_deflate_extension_name = "permessage-deflate"sv;
+
+// We never refer back to earlier messages when compressing, and ask the server not to either, which saves keeping its
+// sliding window around. The server is free to decline the latter.
+static constexpr auto per_message_deflate_offer = "permessage-deflate; client_no_context_takeover; server_no_context_takeover"sv;
+
+// The largest LZ77 sliding window a DEFLATE stream may refer back into.
+static constexpr size_t per_message_deflate_max_window_size = 32 * KiB;
+
+struct PerMessageDeflateParameters {
+    // Whether every message from the server can be decompressed on its own.
+    bool server_no_context_takeover { false };
+};
+
+// Section 7.1 of RFC 7692: Extension Negotiation
+// Takes the parameters of the server's permessage-deflate response, without the extension name. Returns nothing if the
+// response is not valid for any offer we make, in which case the connection has to be failed.
+Optional<PerMessageDeflateParameters> parse_per_message_deflate_response(ReadonlySpan<StringView> parameters);
+
+// Section 7.2.1 of RFC 7692: Compressing
+ErrorOr<ByteBuffer> compress_message_payload(ReadonlyBytes payload);
+
+// Section 7.2.2 of RFC 7692: Decompressing
+// The window holds the end of the previous messages' decompressed data, which the payload may refer back into when the
+// server uses context takeover.
+ErrorOr<ByteBuffer> decompress_message_payload(ReadonlyBytes payload, ReadonlyBytes window = {});
+
+}
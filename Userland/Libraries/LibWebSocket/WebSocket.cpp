@@ -9,13 +9,15 @@
 #include <AK/Random.h>
 #include <LibCrypto/Hash/HashManager.h>
 #include <LibWebSocket/Impl/WebSocketImplSerenity.h>
+#include <LibWebSocket/Masking.h>
+#include <LibWebSocket/PerMessageDeflate.h>
 #include <LibWebSocket/WebSocket.h>
 #include <unistd.h>
 
 namespace WebSocket {
 
 // Note : The websocket protocol is defined by RFC 6455, found at https://tools.ietf.org/html/rfc6455
-// In this file, section numbers will refer to the RFC 6455
+// In this file, section numbers will refer to the RFC 6455, unless they mention RFC 7692 (Compression Extensions for WebSocket)
 
 NonnullRefPtr<WebSocket> WebSocket::create(ConnectionInfo connection, RefPtr<WebSocketImpl> impl)
 {
@@ -84,10 +86,18 @@ void WebSocket::send(Message const& message)
     // Calling send on a socket that is not opened is not allowed
     VERIFY(m_state == WebSocket::InternalState::Open);
     VERIFY(m_impl);
-    if (message.is_text())
-        send_frame(WebSocket::OpCode::Text, message.data(), true);
-    else
-        send_frame(WebSocket::OpCode::Binary, message.data(), true);
+    auto op_code = message.is_text() ? WebSocket::OpCode::Text : WebSocket::OpCode::Binary;
+
+    if (m_uses_per_message_deflate && !message.data().is_empty()) {
+        // Section 6 of RFC 7692: messages may still be sent uncompressed, which is done when compressing didn't pay off.
+        auto compressed_payload = compress_message_payload(message.data());
+        if (!compressed_payload.is_error() && compressed_payload.value().size() < message.data().size()) {
+            send_frame(op_code, compressed_payload.value(), true, true);
+            return;
+        }
+    }
+
+    send_frame(op_code, message.data(), true);
 }
 
 void WebSocket::close(u16 code, ByteString const& message)
@@ -145,8 +155,15 @@ void WebSocket::drain_read()
             return;
         }
         auto bytes = result.release_value();
+        if (bytes.is_empty() && m_buffered_data.is_empty()) {
+            // The connection got closed.
+            m_state = WebSocket::InternalState::Closed;
+            notify_close(m_last_close_code, m_last_close_message, true);
+            discard_connection();
+            return;
+        }
         m_buffered_data.append(bytes.data(), bytes.size());
-        read_frame();
+        read_frames();
     } break;
     case InternalState::Closed:
     case InternalState::Errored: {
@@ -205,11 +222,20 @@ void WebSocket::send_client_handshake()
     }
 
     // 11. Websocket extensions (optional field)
-    if (!m_connection.extensions().is_empty()) {
-        builder.append("Sec-WebSocket-Extensions: "sv);
-        builder.join(',', m_connection.extensions());
-        builder.append("\r\n"sv);
+    //     We offer permessage-deflate ourselves, unless it was already asked for.
+    Vector<StringView> extensions;
+    bool offers_per_message_deflate = false;
+    for (auto const& extension : m_connection.extensions()) {
+        if (extension.view().find_first_split_view(';').trim_whitespace().equals_ignoring_ascii_case(per_message_deflate_extension_name))
+            offers_per_message_deflate = true;
+        extensions.append(extension);
     }
+    if (!offers_per_message_deflate)
+        extensions.append(per_message_deflate_offer);
+
+    builder.append("Sec-WebSocket-Extensions: "sv);
+    builder.join(',', extensions);
+    builder.append("\r\n"sv);
 
     // 12. Additional headers
     for (auto& header : m_connection.headers().headers()) {
@@ -345,6 +371,20 @@ void WebSocket::read_server_handshake()
             auto server_extensions = parts[1].split(',');
             for (auto const& extension : server_extensions) {
                 auto trimmed_extension = extension.trim_whitespace();
+
+                auto parameters = trimmed_extension.split_view(';');
+                if (!parameters.is_empty() && parameters.first().trim_whitespace().equals_ignoring_ascii_case(per_message_deflate_extension_name)) {
+                    auto per_message_deflate_parameters = parse_per_message_deflate_response(parameters.span().slice(1));
+                    if (!per_message_deflate_parameters.has_value()) {
+                        dbgln("WebSocket: Server HTTP Handshake Header |Sec-WebSocket-Extensions| contains '{}', which does not match our offer. Failing connection.", trimmed_extension);
+                        fatal_error(WebSocket::Error::ConnectionUpgradeFailed);
+                        return;
+                    }
+                    m_uses_per_message_deflate = true;
+                    m_server_uses_context_takeover = !per_message_deflate_parameters->server_no_context_takeover;
+                    continue;
+                }
+
                 bool found_extension = false;
                 for (auto const& supported_extension : m_connection.extensions()) {
                     if (trimmed_extension.equals_ignoring_ascii_case(supported_extension)) {
@@ -383,31 +423,43 @@ void WebSocket::read_server_handshake()
     // If needed, we will keep reading the header on the next drain_read call
 }
 
-void WebSocket::read_frame()
+void WebSocket::read_frames()
+{
+    // Handle every frame that has been received in full, and keep the rest around until more data arrives.
+    size_t cursor = 0;
+    while (m_state == WebSocket::InternalState::Open || m_state == WebSocket::InternalState::Closing) {
+        auto frame_size = read_frame(m_buffered_data.span().slice(cursor));
+        if (!frame_size.has_value())
+            break;
+        cursor += *frame_size;
+    }
+
+    m_buffered_data.remove(0, cursor);
+}
+
+// Returns how many bytes the frame at the start of the data took up, if the data contains the whole frame.
+Optional<size_t> WebSocket::read_frame(ReadonlyBytes data)
 {
     VERIFY(m_impl);
     VERIFY(m_state == WebSocket::InternalState::Open || m_state == WebSocket::InternalState::Closing);
 
     size_t cursor = 0;
     auto get_buffered_bytes = [&](size_t count) -> ReadonlyBytes {
-        if (cursor + count > m_buffered_data.size())
+        if (cursor + count > data.size())
             return {};
-        auto bytes = m_buffered_data.span().slice(cursor, count);
+        auto bytes = data.slice(cursor, count);
         cursor += count;
         return bytes;
     };
 
     auto head_bytes = get_buffered_bytes(2);
-    if (head_bytes.is_null() || head_bytes.is_empty()) {
-        // The connection got closed.
-        m_state = WebSocket::InternalState::Closed;
-        notify_close(m_last_close_code, m_last_close_message, true);
-        discard_connection();
-        return;
-    }
+    if (head_bytes.is_null())
+        return {};
 
     auto op_code = (WebSocket::OpCode)(head_bytes[0] & 0x0f);
     bool is_final_frame = head_bytes[0] & 0x80;
+    // Section 6 of RFC 7692: the RSV1 bit is set on the first frame of a compressed message.
+    bool is_compressed = head_bytes[0] & 0x40;
     bool is_masked = head_bytes[1] & 0x80;
 
     // Parse the payload length.
@@ -417,7 +469,7 @@ void WebSocket::read_frame()
         // A code of 127 means that the next 8 bytes contains the payload length
         auto actual_bytes = get_buffered_bytes(8);
         if (actual_bytes.is_null())
-            return;
+            return {};
         u64 full_payload_length = (u64)((u64)(actual_bytes[0] & 0xff) << 56)
             | (u64)((u64)(actual_bytes[1] & 0xff) << 48)
             | (u64)((u64)(actual_bytes[2] & 0xff) << 40)
@@ -432,7 +484,7 @@ void WebSocket::read_frame()
         // A code of 126 means that the next 2 bytes contains the payload length
         auto actual_bytes = get_buffered_bytes(2);
         if (actual_bytes.is_null())
-            return;
+            return {};
         payload_length = (size_t)((size_t)(actual_bytes[0] & 0xff) << 8)
             | (size_t)((size_t)(actual_bytes[1] & 0xff) << 0);
     } else {
@@ -449,38 +501,24 @@ void WebSocket::read_frame()
     if (is_masked) {
         auto masking_key_data = get_buffered_bytes(4);
         if (masking_key_data.is_null())
-            return;
+            return {};
         masking_key[0] = masking_key_data[0];
         masking_key[1] = masking_key_data[1];
         masking_key[2] = masking_key_data[2];
         masking_key[3] = masking_key_data[3];
     }
 
-    auto payload = ByteBuffer::create_uninitialized(payload_length).release_value_but_fixme_should_propagate_errors(); // FIXME: Handle possible OOM situation.
-    u64 read_length = 0;
-    while (read_length < payload_length) {
-        auto payload_part = get_buffered_bytes(payload_length - read_length);
-        if (payload_part.is_null())
-            return;
-        // We read at most "actual_length - read" bytes, so this is safe to do.
-        payload.overwrite(read_length, payload_part.data(), payload_part.size());
-        read_length += payload_part.size();
-    }
-
-    if (cursor == m_buffered_data.size()) {
-        m_buffered_data.clear();
-    } else {
-        Vector<u8> new_buffered_data;
-        new_buffered_data.append(m_buffered_data.data() + cursor, m_buffered_data.size() - cursor);
-        m_buffered_data = move(new_buffered_data);
-    }
+    auto payload_data = get_buffered_bytes(payload_length);
+    if (payload_data.is_null())
+        return {};
+    auto frame_size = cursor;
 
-    if (is_masked) {
-        // Unmask the payload
-        for (size_t i = 0; i < payload.size(); ++i) {
-            payload[i] = payload[i] ^ (masking_key[i % 4]);
-        }
-    }
+    // The payload is unmasked while it is copied out of the buffered data.
+    auto payload = ByteBuffer::create_uninitialized(payload_length).release_value_but_fixme_should_propagate_errors(); // FIXME: Handle possible OOM situation.
+    if (is_masked)
+        apply_masking_key(payload.bytes(), payload_data, masking_key);
+    else
+        payload.overwrite(0, payload_data.data(), payload_data.size());
 
     if (op_code == WebSocket::OpCode::ConnectionClose) {
         if (payload.size() > 1) {
@@ -488,122 +526,150 @@ void WebSocket::read_frame()
             m_last_close_message = ByteString(ReadonlyBytes(payload.offset_pointer(2), payload.size() - 2));
         }
         m_state = WebSocket::InternalState::Closing;
-        return;
+        return frame_size;
     }
     if (op_code == WebSocket::OpCode::Ping) {
         // Immediately send a pong frame as a reply, with the given payload.
         send_frame(WebSocket::OpCode::Pong, payload, true);
-        return;
+        return frame_size;
     }
     if (op_code == WebSocket::OpCode::Pong) {
         // We can safely ignore the pong
-        return;
+        return frame_size;
     }
     if (!is_final_frame) {
         if (op_code != WebSocket::OpCode::Continuation) {
             // First fragmented message
             m_initial_fragment_opcode = op_code;
+            m_initial_fragment_is_compressed = is_compressed;
         }
         // First and next fragmented message
         m_fragmented_data_buffer.append(payload.data(), payload_length);
-        return;
+        return frame_size;
     }
     if (is_final_frame && op_code == WebSocket::OpCode::Continuation) {
         // Last fragmented message
         m_fragmented_data_buffer.append(payload.data(), payload_length);
         op_code = m_initial_fragment_opcode;
-        payload.clear();
-        payload.append(m_fragmented_data_buffer.data(), m_fragmented_data_buffer.size());
+        is_compressed = m_initial_fragment_is_compressed;
+        payload = move(m_fragmented_data_buffer);
         m_fragmented_data_buffer.clear();
     }
-    if (op_code == WebSocket::OpCode::Text) {
-        notify_message(Message(payload, true));
+
+    handle_message(op_code, move(payload), is_compressed);
+    return frame_size;
+}
+
+void WebSocket::handle_message(WebSocket::OpCode op_code, ByteBuffer payload, bool is_compressed)
+{
+    if (op_code != WebSocket::OpCode::Text && op_code != WebSocket::OpCode::Binary) {
+        dbgln("Websocket: Found unknown opcode {}", (u8)op_code);
         return;
     }
-    if (op_code == WebSocket::OpCode::Binary) {
-        notify_message(Message(payload, false));
-        return;
+
+    if (is_compressed) {
+        if (!m_uses_per_message_deflate) {
+            dbgln("WebSocket: Received a compressed message without having negotiated compression. Failing connection.");
+            fail_connection(1002, "Unexpected compressed message"sv);
+            return;
+        }
+
+        auto decompressed_payload = decompress_message_payload(payload, m_decompression_window);
+        if (decompressed_payload.is_error()) {
+            dbgln("WebSocket: Failed to decompress message: {}. Failing connection.", decompressed_payload.error());
+            fail_connection(1007, "Invalid compressed message"sv);
+            return;
+        }
+        payload = decompressed_payload.release_value();
+
+        // Section 7.2.2 of RFC 7692: Without server_no_context_takeover, the server may refer back to earlier messages.
+        if (m_server_uses_context_takeover) {
+            m_decompression_window.append(payload);
+            if (m_decompression_window.size() > per_message_deflate_max_window_size) {
+                auto excess = m_decompression_window.size() - per_message_deflate_max_window_size;
+                m_decompression_window = MUST(m_decompression_window.slice(excess, per_message_deflate_max_window_size));
+            }
+        }
     }
-    dbgln("Websocket: Found unknown opcode {}", (u8)op_code);
+
+    notify_message(Message(move(payload), op_code == WebSocket::OpCode::Text));
 }
 
-void WebSocket::send_frame(WebSocket::OpCode op_code, ReadonlyBytes payload, bool is_final)
+void WebSocket::send_frame(WebSocket::OpCode op_code, ReadonlyBytes payload, bool is_final, bool is_compressed)
 {
     VERIFY(m_impl);
     VERIFY(m_state == WebSocket::InternalState::Open);
-    u8 frame_head[1] = { (u8)((is_final ? 0x80 : 0x00) | ((u8)(op_code) & 0xf)) };
-    m_impl->send(ReadonlyBytes(frame_head, 1));
     // Section 5.1 : a client MUST mask all frames that it sends to the server
     bool has_mask = true;
+
+    // The whole frame is put together in one buffer, so that it is written to the socket at once instead of piece by piece.
+    size_t frame_size = 2 + payload.size();
+    if (payload.size() > NumericLimits<u16>::max())
+        frame_size += 8;
+    else if (payload.size() >= 126)
+        frame_size += 2;
+    if (has_mask)
+        frame_size += 4;
+
+    auto frame_result = ByteBuffer::create_uninitialized(frame_size);
+    if (frame_result.is_error())
+        return;
+    auto& frame = frame_result.value();
+    size_t offset = 0;
+
+    frame[offset++] = (u8)((is_final ? 0x80 : 0x00) | (is_compressed ? 0x40 : 0x00) | ((u8)(op_code) & 0xf));
+
     // FIXME: If the payload has a size > size_t max on a 32-bit platform, we could
     //     technically stream it via non-final packets. However, the size was already
     //     truncated earlier in the call stack when stuffing into a ReadonlyBytes
     if (payload.size() > NumericLimits<u16>::max()) {
         // Send (the 'mask' flag + 127) + the 8-byte payload length
-        if constexpr (sizeof(size_t) >= 8) {
-            u8 payload_length[9] = {
-                (u8)((has_mask ? 0x80 : 0x00) | 127),
-                (u8)((payload.size() >> 56) & 0xff),
-                (u8)((payload.size() >> 48) & 0xff),
-                (u8)((payload.size() >> 40) & 0xff),
-                (u8)((payload.size() >> 32) & 0xff),
-                (u8)((payload.size() >> 24) & 0xff),
-                (u8)((payload.size() >> 16) & 0xff),
-                (u8)((payload.size() >> 8) & 0xff),
-                (u8)((payload.size() >> 0) & 0xff),
-            };
-            m_impl->send(ReadonlyBytes(payload_length, 9));
-        } else {
-            u8 payload_length[9] = {
-                (u8)((has_mask ? 0x80 : 0x00) | 127),
-                0,
-                0,
-                0,
-                0,
-                (u8)((payload.size() >> 24) & 0xff),
-                (u8)((payload.size() >> 16) & 0xff),
-                (u8)((payload.size() >> 8) & 0xff),
-                (u8)((payload.size() >> 0) & 0xff),
-            };
-            m_impl->send(ReadonlyBytes(payload_length, 9));
-        }
+        frame[offset++] = (u8)((has_mask ? 0x80 : 0x00) | 127);
+        u64 payload_length = payload.size();
+        for (int shift = 56; shift >= 0; shift -= 8)
+            frame[offset++] = (u8)((payload_length >> shift) & 0xff);
     } else if (payload.size() >= 126) {
         // Send (the 'mask' flag + 126) + the 2-byte payload length
-        u8 payload_length[3] = {
-            (u8)((has_mask ? 0x80 : 0x00) | 126),
-            (u8)((payload.size() >> 8) & 0xff),
-            (u8)((payload.size() >> 0) & 0xff),
-        };
-        m_impl->send(ReadonlyBytes(payload_length, 3));
+        frame[offset++] = (u8)((has_mask ? 0x80 : 0x00) | 126);
+        frame[offset++] = (u8)((payload.size() >> 8) & 0xff);
+        frame[offset++] = (u8)((payload.size() >> 0) & 0xff);
     } else {
         // Send the mask flag + the payload in a single byte
-        u8 payload_length[1] = {
-            (u8)((has_mask ? 0x80 : 0x00) | (u8)(payload.size() & 0x7f)),
-        };
-        m_impl->send(ReadonlyBytes(payload_length, 1));
+        frame[offset++] = (u8)((has_mask ? 0x80 : 0x00) | (u8)(payload.size() & 0x7f));
     }
+
     if (has_mask) {
         // Section 10.3 :
         // > Clients MUST choose a new masking key for each frame, using an algorithm
         // > that cannot be predicted by end applications that provide data
         u8 masking_key[4];
         fill_with_random(masking_key);
-        m_impl->send(ReadonlyBytes(masking_key, 4));
-        // don't try to send empty payload
-        if (payload.size() == 0)
-            return;
-        // Mask the payload
-        auto buffer_result = ByteBuffer::create_uninitialized(payload.size());
-        if (!buffer_result.is_error()) {
-            auto& masked_payload = buffer_result.value();
-            for (size_t i = 0; i < payload.size(); ++i) {
-                masked_payload[i] = payload[i] ^ (masking_key[i % 4]);
-            }
-            m_impl->send(masked_payload);
-        }
+        frame.overwrite(offset, masking_key, 4);
+        offset += 4;
+
+        // The payload is masked while it is copied into the frame.
+        apply_masking_key(frame.bytes().slice(offset), payload, masking_key);
     } else if (payload.size() > 0) {
-        m_impl->send(payload);
+        frame.overwrite(offset, payload.data(), payload.size());
+    }
+
+    m_impl->send(frame);
+}
+
+// Section 7.1.7: Fail the WebSocket Connection
+void WebSocket::fail_connection(u16 code, StringView reason)
+{
+    if (m_state == WebSocket::InternalState::Open) {
+        auto close_payload = ByteBuffer::create_uninitialized(reason.length() + 2).release_value_but_fixme_should_propagate_errors(); // FIXME: Handle possible OOM situation.
+        close_payload[0] = (u8)(code >> 8);
+        close_payload[1] = (u8)(code & 0xff);
+        close_payload.overwrite(2, reason.characters_without_null_termination(), reason.length());
+        send_frame(WebSocket::OpCode::ConnectionClose, close_payload, true);
     }
+
+    m_state = WebSocket::InternalState::Closed;
+    notify_close(code, reason, false);
+    discard_connection();
 }
 
 void WebSocket::fatal_error(WebSocket::Error error)
@@ -73,14 +73,18 @@ private:
     void send_client_handshake();
     void read_server_handshake();
 
-    void read_frame();
-    void send_frame(OpCode, ReadonlyBytes, bool is_final);
+    void read_frames();
+    Optional<size_t> read_frame(ReadonlyBytes);
+    void send_frame(OpCode, ReadonlyBytes, bool is_final, bool is_compressed = false);
+
+    void handle_message(OpCode, ByteBuffer payload, bool is_compressed);
 
     void notify_open();
     void notify_close(u16 code, ByteString reason, bool was_clean);
     void notify_error(Error);
     void notify_message(Message);
 
+    void fail_connection(u16 code, StringView reason);
     void fatal_error(Error);
     void discard_connection();
 
@@ -105,6 +109,11 @@ private:
     bool m_has_read_server_handshake_connection { false };
     bool m_has_read_server_handshake_accept { false };
 
+    // Whether the server accepted our permessage-deflate offer (RFC 7692).
+    bool m_uses_per_message_deflate { false };
+    bool m_server_uses_context_takeover { false };
+    ByteBuffer m_decompression_window;
+
     u16 m_last_close_code { 1005 };
     ByteString m_last_close_message;
 
@@ -114,6 +123,7 @@ private:
     Vector<u8> m_buffered_data;
     ByteBuffer m_fragmented_data_buffer;
     WebSocket::OpCode m_initial_fragment_opcode;
+    bool m_initial_fragment_is_compressed { false };
 };
 
 }
@@ -5,6 +5,9 @@
  */
 
 #include <AK/Debug.h>
+#include <LibCore/DateTime.h>
+#include <LibCore/File.h>
+#include <LibCore/StandardPaths.h>
 #include <LibImageDecoderClient/Client.h>
 #include <LibWebView/Application.h>
 #include <LibWebView/WebContentClient.h>
@@ -14,6 +17,7 @@ namespace WebView {
 Application* Application::s_the = nullptr;
 
 Application::Application(int, char**)
+    : m_storage_jar(StorageJar::create())
 {
     VERIFY(!s_the);
     s_the = this;
@@ -52,9 +56,9 @@ Optional<Process&> Application::find_process(pid_t pid)
     return m_process_manager.find_process(pid);
 }
 
-void Application::update_process_statistics()
+void Application::update_process_statistics(RequestMemoryStatistics request_memory_statistics)
 {
-    m_process_manager.update_all_process_statistics();
+    m_process_manager.update_all_process_statistics(request_memory_statistics);
 }
 
 String Application::generate_process_statistics_html()
@@ -62,6 +66,29 @@ String Application::generate_process_statistics_html()
     return m_process_manager.generate_html();
 }
 
+void Application::for_each_process_statistics(Function<void(Process const&, Core::Platform::ProcessInfo const&)> const& callback)
+{
+    m_process_manager.for_each_process_statistics(callback);
+}
+
+void Application::start_tracing()
+{
+    m_process_manager.start_tracing();
+}
+
+ErrorOr<LexicalPath> Application::stop_tracing()
+{
+    auto trace = m_process_manager.stop_tracing();
+
+    LexicalPath path { Core::StandardPaths::tempfile_directory() };
+    path = path.append(TRY(Core::DateTime::now().to_string("trace-%Y-%m-%d-%H-%M-%S.json"sv)));
+
+    auto trace_file = TRY(Core::File::open(path.string(), Core::File::OpenMode::Write));
+    TRY(trace_file->write_until_depleted(trace.bytes()));
+
+    return path;
+}
+
 void Application::process_did_exit(Process&& process)
 {
     if (m_in_shutdown)
@@ -6,9 +6,11 @@
 
 #pragma once
 
+#include <AK/LexicalPath.h>
 #include <LibCore/EventLoop.h>
 #include <LibWebView/Process.h>
 #include <LibWebView/ProcessManager.h>
+#include <LibWebView/StorageJar.h>
 
 namespace WebView {
 
@@ -34,8 +36,17 @@ public:
     Optional<Process&> find_process(pid_t);
 
     // FIXME: Should we just expose the ProcessManager via a getter?
-    void update_process_statistics();
+    void update_process_statistics(RequestMemoryStatistics = RequestMemoryStatistics::Yes);
     String generate_process_statistics_html();
+    void for_each_process_statistics(Function<void(Process const&, Core::Platform::ProcessInfo const&)> const&);
+
+    // Records a trace of all processes, which is saved as a file that can be loaded into Perfetto or chrome://tracing.
+    void start_tracing();
+    ErrorOr<LexicalPath> stop_tracing();
+
+    // Until the UI hands us a jar backed by its database, localStorage lives for as long as the application does.
+    StorageJar& storage_jar() { return *m_storage_jar; }
+    void set_storage_jar(NonnullOwnPtr<StorageJar> storage_jar) { m_storage_jar = move(storage_jar); }
 
 protected:
     virtual void process_did_exit(Process&&);
@@ -45,6 +56,7 @@ private:
 
     Core::EventLoop m_event_loop;
     ProcessManager m_process_manager;
+    NonnullOwnPtr<StorageJar> m_storage_jar;
     bool m_in_shutdown { false };
 };
 
@@ -46,6 +46,8 @@ ErrorOr<NonnullOwnPtr<CookieJar>> CookieJar::create(Database& database)
     statements.insert_cookie = TRY(database.prepare_statement("INSERT OR REPLACE INTO Cookies VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?);"sv));
     statements.expire_cookie = TRY(database.prepare_statement("DELETE FROM Cookies WHERE (expiry_time < ?);"sv));
     statements.select_all_cookies = TRY(database.prepare_statement("SELECT * FROM Cookies;"sv));
+    statements.begin_transaction = TRY(database.prepare_statement("BEGIN TRANSACTION;"sv));
+    statements.commit_transaction = TRY(database.prepare_statement("COMMIT;"sv));
 
     return adopt_own(*new CookieJar { PersistedStorage { database, statements } });
 }
@@ -68,11 +70,20 @@ CookieJar::CookieJar(Optional<PersistedStorage> persisted_storage)
     m_persisted_storage->synchronization_timer = Core::Timer::create_repeating(
         static_cast<int>(DATABASE_SYNCHRONIZATION_TIMER.to_milliseconds()),
         [this]() {
+            auto& database = m_persisted_storage->database;
+            auto const& statements = m_persisted_storage->statements;
+
+            // Outside of a transaction, SQLite commits (and syncs to disk) every statement on its own. A page that sets
+            // hundreds of cookies would make us do that hundreds of times, so all changes are written at once instead.
+            database.execute_statement(statements.begin_transaction, {});
+
             auto now = m_transient_storage.purge_expired_cookies();
-            m_persisted_storage->database.execute_statement(m_persisted_storage->statements.expire_cookie, {}, now);
+            database.execute_statement(statements.expire_cookie, {}, now);
 
             for (auto const& it : m_transient_storage.take_dirty_cookies())
                 m_persisted_storage->insert_cookie(it.value);
+
+            database.execute_statement(statements.commit_transaction, {});
         });
     m_persisted_storage->synchronization_timer->start();
 }
@@ -393,7 +404,7 @@ Vector<Web::Cookie::Cookie> CookieJar::get_matching_cookies(const URL::URL& url,
     // 1. Let cookie-list be the set of cookies from the cookie store that meets all of the following requirements:
     Vector<Web::Cookie::Cookie> cookie_list;
 
-    m_transient_storage.for_each_cookie([&](auto& cookie) {
+    m_transient_storage.for_each_cookie_that_may_match_domain(canonicalized_domain, [&](auto& cookie) {
         // Either: The cookie's host-only-flag is true and the canonicalized request-host is identical to the cookie's domain.
         // Or: The cookie's host-only-flag is false and the canonicalized request-host domain-matches the cookie's domain.
         bool is_host_only_and_has_identical_domain = cookie.host_only && (canonicalized_domain == cookie.domain);
@@ -449,27 +460,58 @@ Vector<Web::Cookie::Cookie> CookieJar::get_matching_cookies(const URL::URL& url,
 
 void CookieJar::TransientStorage::set_cookies(Cookies cookies)
 {
-    m_cookies = move(cookies);
+    m_cookies_by_domain.clear();
+    m_cookie_count = 0;
+    m_next_expiry_time = UnixDateTime::latest();
+
+    for (auto& it : cookies)
+        add_cookie(it.key, move(it.value));
+
     purge_expired_cookies();
 }
 
 void CookieJar::TransientStorage::set_cookie(CookieStorageKey key, Web::Cookie::Cookie cookie)
 {
-    m_cookies.set(key, cookie);
+    add_cookie(key, cookie);
     m_dirty_cookies.set(move(key), move(cookie));
 }
 
+void CookieJar::TransientStorage::add_cookie(CookieStorageKey key, Web::Cookie::Cookie cookie)
+{
+    m_next_expiry_time = min(m_next_expiry_time, cookie.expiry_time);
+
+    auto& cookies = m_cookies_by_domain.ensure(key.domain);
+    if (cookies.set(move(key), move(cookie)) == HashSetResult::InsertedNewEntry)
+        ++m_cookie_count;
+}
+
 Optional<Web::Cookie::Cookie> CookieJar::TransientStorage::get_cookie(CookieStorageKey const& key)
 {
-    return m_cookies.get(key);
+    auto cookies = m_cookies_by_domain.find(key.domain);
+    if (cookies == m_cookies_by_domain.end())
+        return {};
+    return cookies->value.get(key);
 }
 
 UnixDateTime CookieJar::TransientStorage::purge_expired_cookies()
 {
     auto now = UnixDateTime::now();
+    if (now <= m_next_expiry_time)
+        return now;
+
     auto is_expired = [&](auto const&, auto const& cookie) { return cookie.expiry_time < now; };
+    m_next_expiry_time = UnixDateTime::latest();
 
-    m_cookies.remove_all_matching(is_expired);
+    m_cookies_by_domain.remove_all_matching([&](auto const&, auto& cookies) {
+        auto count_before_purge = cookies.size();
+        cookies.remove_all_matching(is_expired);
+        m_cookie_count -= count_before_purge - cookies.size();
+
+        for (auto const& it : cookies)
+            m_next_expiry_time = min(m_next_expiry_time, it.value.expiry_time);
+
+        return cookies.is_empty();
+    });
     m_dirty_cookies.remove_all_matching(is_expired);
 
     return now;
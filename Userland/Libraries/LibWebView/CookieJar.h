@@ -35,6 +35,8 @@ class CookieJar {
         Database::StatementID insert_cookie { 0 };
         Database::StatementID expire_cookie { 0 };
         Database::StatementID select_all_cookies { 0 };
+        Database::StatementID begin_transaction { 0 };
+        Database::StatementID commit_transaction { 0 };
     };
 
     class TransientStorage {
@@ -45,7 +47,7 @@ class CookieJar {
         void set_cookie(CookieStorageKey, Web::Cookie::Cookie);
         Optional<Web::Cookie::Cookie> get_cookie(CookieStorageKey const&);
 
-        size_t size() const { return m_cookies.size(); }
+        size_t size() const { return m_cookie_count; }
 
         UnixDateTime purge_expired_cookies();
 
@@ -54,13 +56,41 @@ class CookieJar {
         template<typename Callback>
         void for_each_cookie(Callback callback)
         {
-            for (auto& it : m_cookies)
-                callback(it.value);
+            for (auto& domain : m_cookies_by_domain) {
+                for (auto& it : domain.value)
+                    callback(it.value);
+            }
+        }
+
+        // Only cookies whose domain is the request-host itself, or a domain it domain-matches, can be sent to it. Those
+        // are the request-host and its parent domains, so that is all we need to look at.
+        template<typename Callback>
+        void for_each_cookie_that_may_match_domain(StringView request_host, Callback callback)
+        {
+            auto domain = request_host;
+
+            while (true) {
+                if (auto cookies = m_cookies_by_domain.find(domain); cookies != m_cookies_by_domain.end()) {
+                    for (auto& it : cookies->value)
+                        callback(it.value);
+                }
+
+                auto dot = domain.find('.');
+                if (!dot.has_value())
+                    break;
+                domain = domain.substring_view(*dot + 1);
+            }
         }
 
     private:
-        Cookies m_cookies;
+        void add_cookie(CookieStorageKey, Web::Cookie::Cookie);
+
+        HashMap<String, Cookies> m_cookies_by_domain;
+        size_t m_cookie_count { 0 };
         Cookies m_dirty_cookies;
+
+        // Nothing has to be purged before the earliest expiry time of our cookies.
+        UnixDateTime m_next_expiry_time { UnixDateTime::latest() };
     };
 
     struct PersistedStorage {
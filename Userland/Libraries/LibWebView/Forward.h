@@ -15,11 +15,15 @@ class Database;
 class InspectorClient;
 class OutOfProcessWebView;
 class ProcessManager;
+class StorageJar;
 class ViewImplementation;
 class WebContentClient;
 
 struct Attribute;
 struct CookieStorageKey;
+struct LocalStorageChange;
+struct LocalStorageKey;
+struct MemoryStatistics;
 struct ProcessHandle;
 struct SearchEngine;
 
@@ -30,4 +34,7 @@ namespace AK {
 template<>
 struct Traits<WebView::CookieStorageKey>;
 
+template<>
+struct Traits<WebView::LocalStorageKey>;
+
 }
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibIPC/Decoder.h>
+#include <LibIPC/Encoder.h>
+#include <LibWebView/MemoryStatistics.h>
+
+template<>
+ErrorOr<void> IPC::encode(Encoder& encoder, WebView::JSHeapCellStatistics const& statistics)
+{
+    TRY(encoder.encode(statistics.class_name));
+    TRY(encoder.encode(statistics.cell_count));
+    TRY(encoder.encode(statistics.allocated_bytes));
+    return {};
+}
+
+template<>
+ErrorOr<WebView::JSHeapCellStatistics> IPC::decode(Decoder& decoder)
+{
+    auto class_name = TRY(decoder.decode<String>());
+    auto cell_count = TRY(decoder.decode<u64>());
+    auto allocated_bytes = TRY(decoder.decode<u64>());
+
+    return WebView::JSHeapCellStatistics { move(class_name), cell_count, allocated_bytes };
+}
+
+template<>
+ErrorOr<void> IPC::encode(Encoder& encoder, WebView::MemoryStatistics const& statistics)
+{
+    TRY(encoder.encode(statistics.js_heap_cells));
+    TRY(encoder.encode(statistics.js_heap_allocated_bytes));
+    TRY(encoder.encode(statistics.dom_node_count));
+    TRY(encoder.encode(statistics.layout_node_count));
+    TRY(encoder.encode(statistics.paintable_count));
+    TRY(encoder.encode(statistics.decoded_image_bytes));
+    TRY(encoder.encode(statistics.resource_cache_entry_count));
+    TRY(encoder.encode(statistics.resource_cache_bytes));
+    return {};
+}
+
+template<>
+ErrorOr<WebView::MemoryStatistics> IPC::decode(Decoder& decoder)
+{
+    WebView::MemoryStatistics statistics;
+    statistics.js_heap_cells = TRY(decoder.decode<Vector<WebView::JSHeapCellStatistics>>());
+    statistics.js_heap_allocated_bytes = TRY(decoder.decode<u64>());
+    statistics.dom_node_count = TRY(decoder.decode<u64>());
+    statistics.layout_node_count = TRY(decoder.decode<u64>());
+    statistics.paintable_count = TRY(decoder.decode<u64>());
+    statistics.decoded_image_bytes = TRY(decoder.decode<u64>());
+    statistics.resource_cache_entry_count = TRY(decoder.decode<u64>());
+    statistics.resource_cache_bytes = TRY(decoder.decode<u64>());
+    return statistics;
+}
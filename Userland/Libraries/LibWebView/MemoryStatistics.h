@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/String.h>
+#include <AK/Vector.h>
+#include <LibIPC/Forward.h>
+
+namespace WebView {
+
+struct JSHeapCellStatistics {
+    String class_name;
+    u64 cell_count { 0 };
+    u64 allocated_bytes { 0 };
+};
+
+// A breakdown of what a WebContent process is spending its memory on, as reported by the process itself.
+struct MemoryStatistics {
+    // The live cells of the JavaScript heap, grouped by class and sorted by descending size.
+    Vector<JSHeapCellStatistics> js_heap_cells;
+    u64 js_heap_allocated_bytes { 0 };
+
+    u64 dom_node_count { 0 };
+    u64 layout_node_count { 0 };
+    u64 paintable_count { 0 };
+
+    u64 decoded_image_bytes { 0 };
+
+    u64 resource_cache_entry_count { 0 };
+    u64 resource_cache_bytes { 0 };
+};
+
+}
+
+namespace IPC {
+
+template<>
+ErrorOr<void> encode(Encoder&, WebView::JSHeapCellStatistics const&);
+
+template<>
+ErrorOr<WebView::JSHeapCellStatistics> decode(Decoder&);
+
+template<>
+ErrorOr<void> encode(Encoder&, WebView::MemoryStatistics const&);
+
+template<>
+ErrorOr<WebView::MemoryStatistics> decode(Decoder&);
+
+}
@@ -10,6 +10,7 @@
 #include <AK/WeakPtr.h>
 #include <LibCore/Process.h>
 #include <LibIPC/Connection.h>
+#include <LibWebView/MemoryStatistics.h>
 #include <LibWebView/ProcessType.h>
 
 namespace WebView {
@@ -26,6 +27,10 @@ public:
     Optional<String> const& title() const { return m_title; }
     void set_title(Optional<String> title) { m_title = move(title); }
 
+    // The last breakdown of its memory usage that a WebContent process reported.
+    Optional<MemoryStatistics> const& memory_statistics() const { return m_memory_statistics; }
+    void set_memory_statistics(MemoryStatistics statistics) { m_memory_statistics = move(statistics); }
+
     template<typename ConnectionFromClient>
     Optional<ConnectionFromClient&> client()
     {
@@ -40,6 +45,7 @@ private:
     Core::Process m_process;
     ProcessType m_type;
     Optional<String> m_title;
+    Optional<MemoryStatistics> m_memory_statistics;
     WeakPtr<IPC::ConnectionBase> m_connection;
 };
 
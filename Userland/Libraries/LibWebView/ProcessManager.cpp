@@ -4,11 +4,19 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
 #include <AK/NumberFormat.h>
 #include <AK/String.h>
 #include <LibCore/EventLoop.h>
 #include <LibCore/System.h>
+#include <LibCore/TraceEvent.h>
+#include <LibImageDecoderClient/Client.h>
+#include <LibProtocol/RequestClient.h>
+#include <LibWeb/Worker/WebWorkerClient.h>
 #include <LibWebView/ProcessManager.h>
+#include <LibWebView/WebContentClient.h>
 
 namespace WebView {
 
@@ -113,10 +121,155 @@ Optional<Process> ProcessManager::remove_process(pid_t pid)
     return m_processes.take(pid);
 }
 
-void ProcessManager::update_all_process_statistics()
+void ProcessManager::update_all_process_statistics(RequestMemoryStatistics request_memory_statistics)
 {
     Threading::MutexLocker locker { m_lock };
     (void)update_process_statistics(m_statistics);
+
+    if (request_memory_statistics == RequestMemoryStatistics::No)
+        return;
+
+    // WebContent processes report their breakdown asynchronously, so it shows up on the next update.
+    for (auto& it : m_processes) {
+        if (it.value.type() != ProcessType::WebContent)
+            continue;
+        if (auto client = it.value.client<WebContentClient>(); client.has_value())
+            client->async_request_memory_statistics();
+    }
+}
+
+void ProcessManager::for_each_process_statistics(Function<void(Process const&, Core::Platform::ProcessInfo const&)> const& callback)
+{
+    Threading::MutexLocker locker { m_lock };
+    for (auto const& info : m_statistics.processes) {
+        if (auto process = m_processes.get(info->pid); process.has_value())
+            callback(*process, *info);
+    }
+}
+
+void ProcessManager::start_tracing()
+{
+    Threading::MutexLocker locker { m_lock };
+    Core::TraceEvent::start();
+
+    for (auto& it : m_processes) {
+        auto& process = it.value;
+
+        switch (process.type()) {
+        case ProcessType::WebContent:
+            if (auto client = process.client<WebContentClient>(); client.has_value())
+                client->async_start_tracing();
+            break;
+        case ProcessType::WebWorker:
+            if (auto client = process.client<Web::HTML::WebWorkerClient>(); client.has_value())
+                client->async_start_tracing();
+            break;
+        case ProcessType::RequestServer:
+            if (auto client = process.client<Protocol::RequestClient>(); client.has_value())
+                client->async_start_tracing();
+            break;
+        case ProcessType::ImageDecoder:
+            if (auto client = process.client<ImageDecoderClient::Client>(); client.has_value())
+                client->async_start_tracing();
+            break;
+        case ProcessType::Chrome:
+            break;
+        }
+    }
+}
+
+using StopTracingRequest = Function<Optional<ByteString>()>;
+
+template<typename Message, typename Client>
+static void append_stop_tracing_request(Process& process, Vector<StopTracingRequest>& requests)
+{
+    auto client = process.client<Client>();
+    if (!client.has_value())
+        return;
+
+    requests.append([client = NonnullRefPtr<Client> { *client }]() -> Optional<ByteString> {
+        // A process that has crashed in the meantime simply does not contribute to the trace.
+        auto response = client->template send_sync_but_allow_failure<Message>();
+        if (!response)
+            return {};
+        return response->take_events();
+    });
+}
+
+ByteString ProcessManager::stop_tracing()
+{
+    Vector<ByteString> events_of_processes;
+    Vector<StopTracingRequest> requests;
+
+    {
+        Threading::MutexLocker locker { m_lock };
+        events_of_processes.append(Core::TraceEvent::stop());
+
+        for (auto& it : m_processes) {
+            auto& process = it.value;
+
+            switch (process.type()) {
+            case ProcessType::WebContent:
+                append_stop_tracing_request<Messages::WebContentServer::StopTracing, WebContentClient>(process, requests);
+                break;
+            case ProcessType::WebWorker:
+                append_stop_tracing_request<Messages::WebWorkerServer::StopTracing, Web::HTML::WebWorkerClient>(process, requests);
+                break;
+            case ProcessType::RequestServer:
+                append_stop_tracing_request<Messages::RequestServer::StopTracing, Protocol::RequestClient>(process, requests);
+                break;
+            case ProcessType::ImageDecoder:
+                append_stop_tracing_request<Messages::ImageDecoderServer::StopTracing, ImageDecoderClient::Client>(process, requests);
+                break;
+            case ProcessType::Chrome:
+                break;
+            }
+        }
+    }
+
+    // The lock must not be held while waiting for the processes to respond, as any other thread that needs the list
+    // of processes would be blocked until the slowest of them has responded.
+    for (auto& request : requests) {
+        if (auto events = request(); events.has_value())
+            events_of_processes.append(events.release_value());
+    }
+
+    // Every process stamps its events with its own pid, and they all share the same monotonic clock, so merging the
+    // traces is only a matter of concatenating their events.
+    JsonArray trace_events;
+    for (auto const& events : events_of_processes) {
+        auto json = JsonValue::from_string(events);
+        if (json.is_error()) {
+            dbgln("Unable to parse the trace events of a process: {}", json.error());
+            continue;
+        }
+        if (!json.value().is_array())
+            continue;
+        json.value().as_array().for_each([&](auto const& event) {
+            trace_events.must_append(event);
+        });
+    }
+
+    JsonObject trace;
+    trace.set("traceEvents"sv, move(trace_events));
+    trace.set("displayTimeUnit"sv, "ms"sv);
+    return trace.to_byte_string();
+}
+
+static void append_memory_statistics(StringBuilder& builder, MemoryStatistics const& statistics)
+{
+    static constexpr size_t max_listed_cell_classes = 5;
+
+    builder.appendff("JS heap: {}", human_readable_size(statistics.js_heap_allocated_bytes));
+    for (size_t i = 0; i < min(statistics.js_heap_cells.size(), max_listed_cell_classes); ++i) {
+        auto const& cells = statistics.js_heap_cells[i];
+        builder.appendff("{} {}: {} ({})", i == 0 ? " - "sv : ", "sv, cells.class_name, human_readable_size(cells.allocated_bytes), cells.cell_count);
+    }
+    builder.append("<br>"sv);
+
+    builder.appendff("DOM nodes: {}, layout nodes: {}, paintables: {}<br>", statistics.dom_node_count, statistics.layout_node_count, statistics.paintable_count);
+    builder.appendff("Decoded images: {}<br>", human_readable_size(statistics.decoded_image_bytes));
+    builder.appendff("Resource cache: {} ({} entries)", human_readable_size(statistics.resource_cache_bytes), statistics.resource_cache_entry_count);
 }
 
 String ProcessManager::generate_html()
@@ -169,6 +322,7 @@ String ProcessManager::generate_html()
                         <th>PID</th>
                         <th>Memory Usage</th>
                         <th>CPU %</th>
+                        <th>Memory Breakdown</th>
                 </tr>
                 </thead>
                 <tbody>
@@ -191,6 +345,10 @@ String ProcessManager::generate_html()
         builder.append("<td>"sv);
         builder.append(MUST(String::formatted("{:.1f}", process.cpu_percent)));
         builder.append("</td>"sv);
+        builder.append("<td>"sv);
+        if (process_handle.memory_statistics().has_value())
+            append_memory_statistics(builder, *process_handle.memory_statistics());
+        builder.append("</td>"sv);
         builder.append("</tr>"sv);
     });
 
@@ -20,6 +20,12 @@ namespace WebView {
 ProcessType process_type_from_name(StringView);
 StringView process_name_from_type(ProcessType type);
 
+// Whether WebContent processes should also be asked for a breakdown of their memory usage, which walks their JS heap.
+enum class RequestMemoryStatistics {
+    No,
+    Yes,
+};
+
 class ProcessManager {
     AK_MAKE_NONCOPYABLE(ProcessManager);
 
@@ -35,9 +41,17 @@ public:
     void set_process_mach_port(pid_t, Core::MachPort&&);
 #endif
 
-    void update_all_process_statistics();
+    void update_all_process_statistics(RequestMemoryStatistics);
     String generate_html();
 
+    // Calls the callback with every process and the statistics of its last update.
+    void for_each_process_statistics(Function<void(Process const&, Core::Platform::ProcessInfo const&)> const&);
+
+    // Records trace events in this process and all of its child processes, until tracing is stopped. Stopping
+    // returns the events of every process merged into a single trace, in the Chrome trace event format.
+    void start_tracing();
+    ByteString stop_tracing();
+
     Function<void(Process&&)> on_process_exited;
 
 private:
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Time.h>
+#include <LibWeb/HTML/StorageBottle.h>
+#include <LibWebView/StorageJar.h>
+
+namespace WebView {
+
+// Pages tend to write to localStorage in bursts, this is how long we wait for one to end before writing it to disk.
+static constexpr auto DATABASE_SYNCHRONIZATION_DELAY = Duration::from_seconds(1);
+
+ErrorOr<NonnullOwnPtr<StorageJar>> StorageJar::create(Database& database)
+{
+    Statements statements {};
+
+    auto create_table = TRY(database.prepare_statement(R"#(
+        CREATE TABLE IF NOT EXISTS LocalStorage (
+            origin TEXT,
+            key TEXT,
+            value TEXT,
+            PRIMARY KEY(origin, key)
+        );)#"sv));
+    database.execute_statement(create_table, {});
+
+    statements.select_items = TRY(database.prepare_statement("SELECT key, value FROM LocalStorage WHERE (origin = ?);"sv));
+    statements.insert_item = TRY(database.prepare_statement("INSERT OR REPLACE INTO LocalStorage VALUES (?, ?, ?);"sv));
+    statements.delete_item = TRY(database.prepare_statement("DELETE FROM LocalStorage WHERE (origin = ? AND key = ?);"sv));
+    statements.delete_items = TRY(database.prepare_statement("DELETE FROM LocalStorage WHERE (origin = ?);"sv));
+    statements.begin_transaction = TRY(database.prepare_statement("BEGIN TRANSACTION;"sv));
+    statements.commit_transaction = TRY(database.prepare_statement("COMMIT;"sv));
+
+    return adopt_own(*new StorageJar { PersistedStorage { database, statements } });
+}
+
+NonnullOwnPtr<StorageJar> StorageJar::create()
+{
+    return adopt_own(*new StorageJar { OptionalNone {} });
+}
+
+StorageJar::StorageJar(Optional<PersistedStorage> persisted_storage)
+    : m_persisted_storage(move(persisted_storage))
+{
+    if (!m_persisted_storage.has_value())
+        return;
+
+    m_persisted_storage->synchronization_timer = Core::Timer::create_single_shot(
+        static_cast<int>(DATABASE_SYNCHRONIZATION_DELAY.to_milliseconds()),
+        [this]() {
+            synchronize();
+        });
+}
+
+StorageJar::~StorageJar()
+{
+    if (!m_persisted_storage.has_value())
+        return;
+
+    m_persisted_storage->synchronization_timer->stop();
+    synchronize();
+}
+
+StorageJar::Items const& StorageJar::local_storage_items(String const& origin)
+{
+    return ensure_local_storage(origin).items;
+}
+
+LocalStorageChange StorageJar::set_local_storage_item(String const& origin, String const& key, String const& value)
+{
+    auto& storage = ensure_local_storage(origin);
+    auto existing_item = storage.items.find(key);
+
+    auto size_in_bytes = storage.size_in_bytes + Web::HTML::StorageBottle::size_of_item(key, value);
+    if (existing_item != storage.items.end())
+        size_in_bytes -= Web::HTML::StorageBottle::size_of_item(key, existing_item->value);
+
+    if (size_in_bytes > Web::HTML::StorageBottle::quota) {
+        if (existing_item == storage.items.end())
+            return { origin, key, {} };
+        return { origin, key, existing_item->value };
+    }
+
+    storage.items.set(key, value);
+    storage.size_in_bytes = size_in_bytes;
+
+    m_dirty_items.set({ origin, key }, value);
+    schedule_synchronization();
+
+    return { origin, key, value };
+}
+
+LocalStorageChange StorageJar::remove_local_storage_item(String const& origin, String const& key)
+{
+    auto& storage = ensure_local_storage(origin);
+
+    if (auto value = storage.items.take(key); value.has_value()) {
+        storage.size_in_bytes -= Web::HTML::StorageBottle::size_of_item(key, *value);
+
+        m_dirty_items.set({ origin, key }, OptionalNone {});
+        schedule_synchronization();
+    }
+
+    return { origin, key, {} };
+}
+
+LocalStorageChange StorageJar::clear_local_storage(String const& origin)
+{
+    auto& storage = ensure_local_storage(origin);
+    storage.items.clear();
+    storage.size_in_bytes = 0;
+
+    // Clearing the origin in the database takes care of every change to it that is still pending.
+    m_dirty_items.remove_all_matching([&](auto const& key, auto const&) { return key.origin == origin; });
+    m_origins_to_clear.set(origin);
+    schedule_synchronization();
+
+    return { origin, {}, {} };
+}
+
+StorageJar::OriginStorage& StorageJar::ensure_local_storage(String const& origin)
+{
+    return m_local_storage.ensure(origin, [&]() {
+        OriginStorage storage;
+        if (!m_persisted_storage.has_value())
+            return storage;
+
+        auto& database = *m_persisted_storage->database;
+        database.execute_statement(
+            m_persisted_storage->statements.select_items,
+            [&](auto statement_id) {
+                auto key = database.result_column<String>(statement_id, 0);
+                auto value = database.result_column<String>(statement_id, 1);
+                storage.size_in_bytes += Web::HTML::StorageBottle::size_of_item(key, value);
+                storage.items.set(move(key), move(value));
+            },
+            origin);
+
+        return storage;
+    });
+}
+
+void StorageJar::schedule_synchronization()
+{
+    if (!m_persisted_storage.has_value()) {
+        m_dirty_items.clear();
+        m_origins_to_clear.clear();
+        return;
+    }
+
+    if (!m_persisted_storage->synchronization_timer->is_active())
+        m_persisted_storage->synchronization_timer->start();
+}
+
+void StorageJar::synchronize()
+{
+    if (m_dirty_items.is_empty() && m_origins_to_clear.is_empty())
+        return;
+
+    auto& database = *m_persisted_storage->database;
+    auto const& statements = m_persisted_storage->statements;
+
+    // Outside of a transaction, SQLite commits (and syncs to disk) every statement on its own, so all changes are
+    // written at once instead.
+    database.execute_statement(statements.begin_transaction, {});
+
+    // Items are only dirty if they were changed after their origin was cleared, so the clears have to come first.
+    for (auto const& origin : m_origins_to_clear)
+        database.execute_statement(statements.delete_items, {}, origin);
+
+    for (auto const& it : m_dirty_items) {
+        if (it.value.has_value())
+            database.execute_statement(statements.insert_item, {}, it.key.origin, it.key.key, *it.value);
+        else
+            database.execute_statement(statements.delete_item, {}, it.key.origin, it.key.key);
+    }
+
+    database.execute_statement(statements.commit_transaction, {});
+
+    m_origins_to_clear.clear();
+    m_dirty_items.clear();
+}
+
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/HashTable.h>
+#include <AK/Optional.h>
+#include <AK/String.h>
+#include <AK/Traits.h>
+#include <LibCore/Timer.h>
+#include <LibWebView/Database.h>
+#include <LibWebView/Forward.h>
+
+namespace WebView {
+
+struct LocalStorageKey {
+    bool operator==(LocalStorageKey const&) const = default;
+
+    String origin;
+    String key;
+};
+
+// A change to the localStorage of an origin. A key with no value was removed, and no key means that it was cleared.
+struct LocalStorageChange {
+    String origin;
+    Optional<String> key;
+    Optional<String> value;
+};
+
+// The browser-wide localStorage of every origin, which WebContent processes load an origin's items from when a page
+// first uses its localStorage, and send their changes back to. Changes are kept in memory and written to the database
+// in batches, so pages writing to localStorage never wait for the disk.
+//
+// The jar is the authority on the items. Each change it is asked to make returns the change that it actually made,
+// which has to be sent to every WebContent process that loaded the origin, including the one that asked for it. As the
+// processes apply the changes in the order the jar made them, their copies all end up the same as the jar's.
+class StorageJar {
+    struct Statements {
+        Database::StatementID select_items { 0 };
+        Database::StatementID insert_item { 0 };
+        Database::StatementID delete_item { 0 };
+        Database::StatementID delete_items { 0 };
+        Database::StatementID begin_transaction { 0 };
+        Database::StatementID commit_transaction { 0 };
+    };
+
+    struct PersistedStorage {
+        // The jar belongs to the Application, which outlives the database reference the UI holds on to.
+        NonnullRefPtr<Database> database;
+        Statements statements;
+        RefPtr<Core::Timer> synchronization_timer {};
+    };
+
+public:
+    using Items = OrderedHashMap<String, String>;
+
+    static ErrorOr<NonnullOwnPtr<StorageJar>> create(Database&);
+    static NonnullOwnPtr<StorageJar> create();
+
+    ~StorageJar();
+
+    Items const& local_storage_items(String const& origin);
+
+    // Setting an item that would exceed the origin's quota is refused. The item is left as it is instead, which the
+    // returned change restores in the copy of the process that set it.
+    LocalStorageChange set_local_storage_item(String const& origin, String const& key, String const& value);
+    LocalStorageChange remove_local_storage_item(String const& origin, String const& key);
+    LocalStorageChange clear_local_storage(String const& origin);
+
+private:
+    explicit StorageJar(Optional<PersistedStorage>);
+
+    AK_MAKE_NONCOPYABLE(StorageJar);
+    AK_MAKE_NONMOVABLE(StorageJar);
+
+    struct OriginStorage {
+        Items items;
+        size_t size_in_bytes { 0 };
+    };
+
+    OriginStorage& ensure_local_storage(String const& origin);
+
+    void schedule_synchronization();
+    void synchronize();
+
+    Optional<PersistedStorage> m_persisted_storage;
+    HashMap<String, OriginStorage> m_local_storage;
+
+    // The changes that have yet to be written to the database. A removed item has no value.
+    HashTable<String> m_origins_to_clear;
+    HashMap<LocalStorageKey, Optional<String>> m_dirty_items;
+};
+
+}
+
+template<>
+struct AK::Traits<WebView::LocalStorageKey> : public AK::DefaultTraits<WebView::LocalStorageKey> {
+    static unsigned hash(WebView::LocalStorageKey const& key)
+    {
+        return pair_int_hash(key.origin.hash(), key.key.hash());
+    }
+};
@@ -28,6 +28,13 @@ ViewImplementation::ViewImplementation()
         this->m_crash_count = 0;
     });
 
+    // Once a view has stayed hidden for a while, its page is asked to give back the memory it can recreate on demand.
+    // A background tab is unlikely to need it again soon.
+    m_hidden_memory_pressure_timer = Core::Timer::create_single_shot(30'000, [this] {
+        if (m_client_state.client)
+            client().async_handle_memory_pressure(page_id());
+    });
+
     on_request_file = [this](auto const& path, auto request_id) {
         auto file = Core::File::open(path, Core::File::OpenMode::Read);
 
@@ -154,6 +161,11 @@ void ViewImplementation::did_finish_handling_input_event(Badge<WebContentClient>
     }
 }
 
+void ViewImplementation::set_display_refresh_rate(double refresh_rate)
+{
+    client().async_set_display_refresh_rate(page_id(), static_cast<float>(refresh_rate));
+}
+
 void ViewImplementation::set_preferred_color_scheme(Web::CSS::PreferredColorScheme color_scheme)
 {
     client().async_set_preferred_color_scheme(page_id(), color_scheme);
@@ -169,6 +181,16 @@ void ViewImplementation::set_preferred_motion(Web::CSS::PreferredMotion motion)
     client().async_set_preferred_motion(page_id(), motion);
 }
 
+void ViewImplementation::set_system_visibility_state(bool is_visible)
+{
+    client().async_set_system_visibility_state(page_id(), is_visible);
+
+    if (is_visible)
+        m_hidden_memory_pressure_timer->stop();
+    else
+        m_hidden_memory_pressure_timer->restart();
+}
+
 ByteString ViewImplementation::selected_text()
 {
     return client().get_selected_text(page_id());
@@ -561,6 +583,43 @@ ErrorOr<LexicalPath> ViewImplementation::dump_gc_graph()
     return path;
 }
 
+static ErrorOr<LexicalPath> save_js_profile(String const& profile)
+{
+    // Several profiles may finish within the same second, so make sure each of them gets its own file.
+    static u64 s_profile_count = 0;
+    auto now = UnixDateTime::now();
+
+    LexicalPath path { Core::StandardPaths::tempfile_directory() };
+    path = path.append(ByteString::formatted("js-profile-{}-{:03}-{}.cpuprofile",
+        TRY(Core::DateTime::from_timestamp(now.seconds_since_epoch()).to_string("%Y-%m-%d-%H-%M-%S"sv)),
+        now.milliseconds_since_epoch() % 1000,
+        ++s_profile_count));
+
+    auto profile_file = TRY(Core::File::open(path.string(), Core::File::OpenMode::Write));
+    TRY(profile_file->write_until_depleted(profile.bytes()));
+
+    return path;
+}
+
+void ViewImplementation::start_js_profile()
+{
+    client().async_start_js_profile(page_id());
+}
+
+ErrorOr<LexicalPath> ViewImplementation::stop_js_profile()
+{
+    auto profile = client().stop_js_profile(page_id());
+    return save_js_profile(profile);
+}
+
+void ViewImplementation::did_finish_js_profile(Badge<WebContentClient>, String const& label, String const& profile)
+{
+    if (auto path = save_js_profile(profile); path.is_error())
+        dbgln("Unable to save JS profile '{}': {}", label, path.error());
+    else
+        dbgln("Saved JS profile '{}' to {}", label, path.value());
+}
+
 void ViewImplementation::set_user_style_sheet(String source)
 {
     client().async_set_user_style(page_id(), move(source));
@@ -63,9 +63,12 @@ public:
     void did_finish_handling_input_event(Badge<WebContentClient>, bool event_was_accepted);
 
     void set_preferred_color_scheme(Web::CSS::PreferredColorScheme);
+    void set_display_refresh_rate(double);
     void set_preferred_contrast(Web::CSS::PreferredContrast);
     void set_preferred_motion(Web::CSS::PreferredMotion);
 
+    void set_system_visibility_state(bool is_visible);
+
     ByteString selected_text();
     Optional<String> selected_text_with_whitespace_collapsed();
     void select_all();
@@ -133,6 +136,11 @@ public:
 
     ErrorOr<LexicalPath> dump_gc_graph();
 
+    // Profiles are saved in the .cpuprofile format, which can be opened in the Chrome DevTools or speedscope.
+    void start_js_profile();
+    ErrorOr<LexicalPath> stop_js_profile();
+    void did_finish_js_profile(Badge<WebContentClient>, String const& label, String const& profile);
+
     void set_user_style_sheet(String source);
     // Load Native.css as the User style sheet, which attempts to make WebView content look as close to
     // native GUI widgets as possible.
@@ -268,6 +276,8 @@ protected:
     size_t m_crash_count = 0;
     RefPtr<Core::Timer> m_repeated_crash_timer;
 
+    RefPtr<Core::Timer> m_hidden_memory_pressure_timer;
+
     RefPtr<Core::Promise<LexicalPath>> m_pending_screenshot;
 
     Web::HTML::AudioPlayState m_audio_play_state { Web::HTML::AudioPlayState::Paused };
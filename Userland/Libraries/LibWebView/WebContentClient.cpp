@@ -29,6 +29,12 @@ WebContentClient::WebContentClient(NonnullOwnPtr<Core::LocalSocket> socket, View
     m_views.set(0, &view);
 }
 
+WebContentClient::WebContentClient(NonnullOwnPtr<Core::LocalSocket> socket)
+    : IPC::ConnectionToServer<WebContentClientEndpoint, WebContentServerEndpoint>(*this, move(socket))
+{
+    s_clients.set(this);
+}
+
 WebContentClient::~WebContentClient()
 {
     s_clients.remove(this);
@@ -39,6 +45,12 @@ void WebContentClient::die()
     // Intentionally empty. Restart is handled at another level.
 }
 
+void WebContentClient::assign_initial_view(ViewImplementation& view)
+{
+    VERIFY(m_views.is_empty());
+    m_views.set(0, &view);
+}
+
 void WebContentClient::register_view(u64 page_id, ViewImplementation& view)
 {
     VERIFY(page_id > 0);
@@ -99,6 +111,12 @@ void WebContentClient::did_find_in_page(u64 page_id, size_t current_match_index,
     }
 }
 
+void WebContentClient::did_update_memory_statistics(WebView::MemoryStatistics const& statistics)
+{
+    if (auto process = WebView::Application::the().find_process(m_process_handle.pid); process.has_value())
+        process->set_memory_statistics(statistics);
+}
+
 void WebContentClient::did_request_navigate_back(u64 page_id)
 {
     if (auto view = view_for_page_id(page_id); view.has_value()) {
@@ -341,6 +359,12 @@ void WebContentClient::did_get_js_console_messages(u64 page_id, i32 start_index,
     }
 }
 
+void WebContentClient::did_finish_js_profile(u64 page_id, String const& label, String const& profile)
+{
+    if (auto view = view_for_page_id(page_id); view.has_value())
+        view->did_finish_js_profile({}, label, profile);
+}
+
 void WebContentClient::did_request_alert(u64 page_id, String const& message)
 {
     if (auto view = view_for_page_id(page_id); view.has_value()) {
@@ -448,6 +472,42 @@ void WebContentClient::did_update_cookie(u64 page_id, Web::Cookie::Cookie const&
     }
 }
 
+Messages::WebContentClient::DidRequestLocalStorageItemsResponse WebContentClient::did_request_local_storage_items(String const& origin)
+{
+    return Application::the().storage_jar().local_storage_items(origin);
+}
+
+void WebContentClient::did_request_local_storage_preload(String const& origin)
+{
+    async_local_storage_did_load(origin, Application::the().storage_jar().local_storage_items(origin));
+}
+
+void WebContentClient::did_set_local_storage_item(String const& origin, String const& key, String const& value)
+{
+    notify_clients_of_local_storage_change(Application::the().storage_jar().set_local_storage_item(origin, key, value));
+}
+
+void WebContentClient::did_remove_local_storage_item(String const& origin, String const& key)
+{
+    notify_clients_of_local_storage_change(Application::the().storage_jar().remove_local_storage_item(origin, key));
+}
+
+void WebContentClient::did_clear_local_storage(String const& origin)
+{
+    notify_clients_of_local_storage_change(Application::the().storage_jar().clear_local_storage(origin));
+}
+
+// Every WebContent process keeps its own copy of the localStorage it has loaded, and applies its own changes to it right
+// away. Other processes may have changed the same items in the meantime, and the jar may have refused the change, so
+// the process that made it is told the outcome as well. Everyone then applies the jar's changes in the same order.
+void WebContentClient::notify_clients_of_local_storage_change(LocalStorageChange const& change)
+{
+    for_each_client([&](WebContentClient& client) {
+        client.async_local_storage_did_change(change.origin, change.key, change.value, &client == this);
+        return IterationDecision::Continue;
+    });
+}
+
 Messages::WebContentClient::DidRequestNewWebViewResponse WebContentClient::did_request_new_web_view(u64 page_id, Web::HTML::ActivateTab const& activate_tab, Web::HTML::WebViewHints const& hints, Optional<u64> const& page_index)
 {
     if (auto view = view_for_page_id(page_id); view.has_value()) {
@@ -19,6 +19,7 @@
 namespace WebView {
 
 class ViewImplementation;
+struct LocalStorageChange;
 
 class WebContentClient final
     : public IPC::ConnectionToServer<WebContentClientEndpoint, WebContentServerEndpoint>
@@ -34,8 +35,12 @@ public:
     static size_t client_count() { return s_clients.size(); }
 
     WebContentClient(NonnullOwnPtr<Core::LocalSocket>, ViewImplementation&);
+    explicit WebContentClient(NonnullOwnPtr<Core::LocalSocket>);
     ~WebContentClient();
 
+    // Hands a process that was launched without a view over to the view that will own its initial page.
+    void assign_initial_view(ViewImplementation&);
+
     void register_view(u64 page_id, ViewImplementation&);
     void unregister_view(u64 page_id);
 
@@ -76,6 +81,7 @@ private:
     virtual void did_take_screenshot(u64 page_id, Gfx::ShareableBitmap const& screenshot) override;
     virtual void did_output_js_console_message(u64 page_id, i32 message_index) override;
     virtual void did_get_js_console_messages(u64 page_id, i32 start_index, Vector<ByteString> const& message_types, Vector<ByteString> const& messages) override;
+    virtual void did_finish_js_profile(u64 page_id, String const& label, String const& profile) override;
     virtual void did_change_favicon(u64 page_id, Gfx::ShareableBitmap const&) override;
     virtual void did_request_alert(u64 page_id, String const&) override;
     virtual void did_request_confirm(u64 page_id, String const&) override;
@@ -88,6 +94,11 @@ private:
     virtual Messages::WebContentClient::DidRequestCookieResponse did_request_cookie(u64 page_id, URL::URL const&, Web::Cookie::Source) override;
     virtual void did_set_cookie(u64 page_id, URL::URL const&, Web::Cookie::ParsedCookie const&, Web::Cookie::Source) override;
     virtual void did_update_cookie(u64 page_id, Web::Cookie::Cookie const&) override;
+    virtual Messages::WebContentClient::DidRequestLocalStorageItemsResponse did_request_local_storage_items(String const& origin) override;
+    virtual void did_request_local_storage_preload(String const& origin) override;
+    virtual void did_set_local_storage_item(String const& origin, String const& key, String const& value) override;
+    virtual void did_remove_local_storage_item(String const& origin, String const& key) override;
+    virtual void did_clear_local_storage(String const& origin) override;
     virtual Messages::WebContentClient::DidRequestNewWebViewResponse did_request_new_web_view(u64 page_id, Web::HTML::ActivateTab const&, Web::HTML::WebViewHints const&, Optional<u64> const& page_index) override;
     virtual void did_request_activate_tab(u64 page_id) override;
     virtual void did_close_browsing_context(u64 page_id) override;
@@ -105,6 +116,7 @@ private:
     virtual void did_finish_handling_input_event(u64 page_id, bool event_was_accepted) override;
     virtual void did_finish_text_test(u64 page_id) override;
     virtual void did_find_in_page(u64 page_id, size_t current_match_index, Optional<size_t> const& total_match_count) override;
+    virtual void did_update_memory_statistics(WebView::MemoryStatistics const&) override;
     virtual void did_change_theme_color(u64 page_id, Gfx::Color color) override;
     virtual void did_insert_clipboard_entry(u64 page_id, String const& data, String const& presentation_style, String const& mime_type) override;
     virtual void did_change_audio_play_state(u64 page_id, Web::HTML::AudioPlayState) override;
@@ -121,6 +133,7 @@ private:
     virtual Messages::WebContentClient::RequestWorkerAgentResponse request_worker_agent(u64 page_id) override;
 
     Optional<ViewImplementation&> view_for_page_id(u64, SourceLocation = SourceLocation::current());
+    void notify_clients_of_local_storage_change(LocalStorageChange const&);
 
     // FIXME: Does a HashMap holding references make sense?
     HashMap<u64, ViewImplementation*> m_views;
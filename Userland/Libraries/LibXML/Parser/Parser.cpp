@@ -155,6 +155,11 @@ void Parser::leave_node()
     }
 
     m_entered_node = m_entered_node->parent;
+
+    // NOTE: A listener has already been told everything about the element we just left, and the tree is thrown away
+    //       once parsing is done, so drop the element right away to keep memory bounded by the nesting depth.
+    if (m_listener && m_entered_node)
+        m_entered_node->content.get<Node::Element>().children.take_last();
 }
 
 ErrorOr<Document, ParseError> Parser::parse()
@@ -730,7 +735,9 @@ ErrorOr<ByteString, ParseError> Parser::parse_attribute_value_inner(StringView d
             else
                 builder.append(TRY(resolve_reference(reference.get<EntityReference>(), ReferencePlacement::AttributeValue)));
         } else {
-            builder.append(m_lexer.consume());
+            builder.append(m_lexer.consume_until([&](char ch) {
+                return ch == '<' || ch == '&' || disallow.contains(ch);
+            }));
         }
     }
     return builder.to_byte_string();
@@ -896,33 +903,11 @@ ErrorOr<StringView, ParseError> Parser::parse_char_data()
     auto rule = enter_rule();
 
     // CharData ::= [^<&]* - ([^<&]* ']]>' [^<&]*)
-    auto cend_state = 0; // 1: ], 2: ], 3: >
-    auto text = m_lexer.consume_while([&](auto ch) {
-        if (ch == '<' || ch == '&' || cend_state == 3)
-            return false;
-        switch (cend_state) {
-        case 0:
-        case 1:
-            if (ch == ']')
-                cend_state++;
-            else
-                cend_state = 0;
-            return true;
-        case 2:
-            if (ch == '>') {
-                cend_state++;
-                return true;
-            }
-            cend_state = 0;
-            return true;
-        default:
-            VERIFY_NOT_REACHED();
-        }
-    });
-    if (cend_state == 3) {
-        m_lexer.retreat(3);
-        text = text.substring_view(0, text.length() - 3);
-    }
+    auto remaining = m_lexer.remaining();
+    auto text = remaining.substring_view(0, remaining.find_any_of("<&"sv).value_or(remaining.length()));
+    if (auto cdata_end = text.find("]]>"sv); cdata_end.has_value())
+        text = text.substring_view(0, *cdata_end);
+    m_lexer.ignore(text.length());
 
     rollback.disarm();
     return text;
@@ -8,6 +8,7 @@
 #include <AK/IDAllocator.h>
 #include <ImageDecoder/ConnectionFromClient.h>
 #include <ImageDecoder/ImageDecoderClientEndpoint.h>
+#include <LibCore/TraceEvent.h>
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/ImageFormats/ImageDecoder.h>
 #include <LibGfx/ImageFormats/TIFFMetadata.h>
@@ -75,6 +76,11 @@ Messages::ImageDecoderServer::ConnectNewClientsResponse ConnectionFromClient::co
     return files;
 }
 
+// NOTE: Frames are decoded in order on the job's thread, so animated decoders that composite onto a single
+//       frame buffer (like GIF and WebP) only ever advance by one frame per call.
+// FIXME: Every frame of an animation is decoded up front and shipped to the client. Holding only a bounded window of
+//        frames would need the client to request frames on demand, and decoding ahead on several threads would need
+//        per-thread decoder state seeded from the nearest keyframe, since the decoder plugins are not thread-safe.
 static void decode_image_to_bitmaps_and_durations_with_decoder(Gfx::ImageDecoder const& decoder, Optional<Gfx::IntSize> ideal_size, Vector<Gfx::ShareableBitmap>& bitmaps, Vector<u32>& durations)
 {
     for (size_t i = 0; i < decoder.frame_count(); ++i) {
@@ -128,6 +134,7 @@ NonnullRefPtr<ConnectionFromClient::Job> ConnectionFromClient::make_decode_image
 {
     return Job::construct(
         [encoded_buffer = move(encoded_buffer), ideal_size = move(ideal_size), mime_type = move(mime_type)](auto&) -> ErrorOr<DecodeResult> {
+            TRACE_EVENT_SCOPE("image"sv, "ImageDecoder::decode_image"sv);
             return TRY(decode_image_to_details(encoded_buffer, ideal_size, mime_type));
         },
         [strong_this = NonnullRefPtr(*this), image_id](DecodeResult result) -> ErrorOr<void> {
@@ -142,6 +149,10 @@ NonnullRefPtr<ConnectionFromClient::Job> ConnectionFromClient::make_decode_image
         });
 }
 
+// FIXME: Support decoding images incrementally, as their data arrives, and sending partial frames back to the client.
+//        Every Gfx::ImageDecoderPlugin is created from the complete encoded data and decodes whole frames, and
+//        ResourceLoader only hands image data to LibWeb once the whole response body has been received, so both of
+//        those need a streaming interface first.
 Messages::ImageDecoderServer::DecodeImageResponse ConnectionFromClient::decode_image(Core::AnonymousBuffer const& encoded_buffer, Optional<Gfx::IntSize> const& ideal_size, Optional<ByteString> const& mime_type)
 {
     auto image_id = m_next_image_id++;
@@ -164,4 +175,14 @@ void ConnectionFromClient::cancel_decoding(i64 image_id)
     }
 }
 
+void ConnectionFromClient::start_tracing()
+{
+    Core::TraceEvent::start();
+}
+
+Messages::ImageDecoderServer::StopTracingResponse ConnectionFromClient::stop_tracing()
+{
+    return Core::TraceEvent::stop();
+}
+
 }
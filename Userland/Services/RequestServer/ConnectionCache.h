@@ -136,6 +136,9 @@ struct Connection {
     using StorageType = SocketStorageType;
 
     OwnPtr<Core::BufferedSocket<SocketStorageType>> socket;
+    // FIXME: Jobs are served strictly in arrival order. Once clients pass a fetch priority along with StartRequest,
+    //        take the most important job here (and when picking a connection), so render-blocking resources don't
+    //        wait behind speculative or below-the-fold loads.
     Threading::RWLockProtected<QueueType> request_queue;
     NonnullRefPtr<Core::Timer> removal_timer;
     Atomic<bool> is_being_started { false };
@@ -178,7 +181,9 @@ extern Threading::RWLockProtected<HashMap<ByteString, InferredServerProperties>>
 void request_did_finish(URL::URL const&, Core::Socket const*);
 void dump_jobs();
 
-constexpr static size_t MaxConcurrentConnectionsPerURL = 4;
+// NOTE: Six connections per origin matches what other browsers allow for HTTP/1.1.
+// FIXME: Speak HTTP/2 (negotiated via ALPN) so that a single multiplexed connection can serve all requests to an origin.
+constexpr static size_t MaxConcurrentConnectionsPerURL = 6;
 constexpr static size_t ConnectionKeepAliveTimeMilliseconds = 20'000;
 constexpr static size_t ConnectionCacheQueueHighWatermark = 4;
 
@@ -11,6 +11,7 @@
 #include <AK/Weakable.h>
 #include <LibCore/Proxy.h>
 #include <LibCore/Socket.h>
+#include <LibCore/TraceEvent.h>
 #include <LibWebSocket/ConnectionInfo.h>
 #include <LibWebSocket/Message.h>
 #include <RequestServer/ConnectionFromClient.h>
@@ -24,6 +25,12 @@ namespace RequestServer {
 static HashMap<int, RefPtr<ConnectionFromClient>> s_connections;
 static IDAllocator s_client_ids;
 
+// Request ids are only unique per client, so the id of the client is folded into the id of the traced request.
+static u64 request_trace_id(int client_id, i32 request_id)
+{
+    return (static_cast<u64>(client_id) << 32) | static_cast<u32>(request_id);
+}
+
 ConnectionFromClient::ConnectionFromClient(NonnullOwnPtr<Core::LocalSocket> socket)
     : IPC::ConnectionFromClient<RequestClientEndpoint, RequestServerEndpoint>(*this, move(socket), s_client_ids.allocate())
     , m_thread_pool([this](Work work) { worker_do_work(move(work)); })
@@ -105,6 +112,7 @@ void ConnectionFromClient::worker_do_work(Work work)
             auto* protocol = Protocol::find_by_name(start_request.url.scheme().to_byte_string());
             if (!protocol) {
                 dbgln("StartRequest: No protocol handler for URL: '{}'", start_request.url);
+                Core::TraceEvent::async_end("network"sv, "Request"sv, request_trace_id(client_id(), start_request.request_id));
                 auto lock = Threading::MutexLocker(m_ipc_mutex);
                 (void)post_message(Messages::RequestClient::RequestFinished(start_request.request_id, false, 0));
                 return;
@@ -112,6 +120,7 @@ void ConnectionFromClient::worker_do_work(Work work)
             auto request = protocol->start_request(start_request.request_id, *this, start_request.method, start_request.url, start_request.request_headers, start_request.request_body, start_request.proxy_data);
             if (!request) {
                 dbgln("StartRequest: Protocol handler failed to start request: '{}'", start_request.url);
+                Core::TraceEvent::async_end("network"sv, "Request"sv, request_trace_id(client_id(), start_request.request_id));
                 auto lock = Threading::MutexLocker(m_ipc_mutex);
                 (void)post_message(Messages::RequestClient::RequestFinished(start_request.request_id, false, 0));
                 return;
@@ -205,6 +214,12 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString const& metho
         return;
     }
 
+    if (Core::TraceEvent::is_enabled()) [[unlikely]]
+        Core::TraceEvent::record(Core::TraceEvent::Phase::AsyncBegin, "network"sv, "Request"sv, request_trace_id(client_id(), request_id), url.to_byte_string());
+
+    // FIXME: Consult a shared on-disk HTTP cache (RFC 9111) before hitting the network, so that every WebContent process
+    //        and every browser session can reuse fresh responses and revalidate stale ones via ETag/Last-Modified.
+    //        The only cache today is ResourceLoader's per-process, in-memory s_resource_cache.
     enqueue(StartRequest {
         .request_id = request_id,
         .method = method,
@@ -223,6 +238,7 @@ Messages::RequestServer::StopRequestResponse ConnectionFromClient::stop_request(
         if (request) {
             request->stop();
             map.remove(request_id);
+            Core::TraceEvent::async_end("network"sv, "Request"sv, request_trace_id(client_id(), request_id));
             success = true;
         }
         return success;
@@ -237,6 +253,8 @@ void ConnectionFromClient::did_receive_headers(Badge<Request>, Request& request)
 
 void ConnectionFromClient::did_finish_request(Badge<Request>, Request& request, bool success)
 {
+    Core::TraceEvent::async_end("network"sv, "Request"sv, request_trace_id(client_id(), request.id()));
+
     if (request.total_size().has_value()) {
         auto lock = Threading::MutexLocker(m_ipc_mutex);
         async_request_finished(request.id(), success, request.total_size().value());
@@ -283,6 +301,16 @@ void ConnectionFromClient::ensure_connection(URL::URL const& url, ::RequestServe
     });
 }
 
+void ConnectionFromClient::start_tracing()
+{
+    Core::TraceEvent::start();
+}
+
+Messages::RequestServer::StopTracingResponse ConnectionFromClient::stop_tracing()
+{
+    return Core::TraceEvent::stop();
+}
+
 static i32 s_next_websocket_id = 1;
 Messages::RequestServer::WebsocketConnectResponse ConnectionFromClient::websocket_connect(URL::URL const& url, ByteString const& origin, Vector<ByteString> const& protocols, Vector<ByteString> const& extensions, HTTP::HeaderMap const& additional_request_headers)
 {
@@ -42,6 +42,9 @@ private:
     virtual Messages::RequestServer::SetCertificateResponse set_certificate(i32, ByteString const&, ByteString const&) override;
     virtual void ensure_connection(URL::URL const& url, ::RequestServer::CacheLevel const& cache_level) override;
 
+    virtual void start_tracing() override;
+    virtual Messages::RequestServer::StopTracingResponse stop_tracing() override;
+
     virtual Messages::RequestServer::WebsocketConnectResponse websocket_connect(URL::URL const&, ByteString const&, Vector<ByteString> const&, Vector<ByteString> const&, HTTP::HeaderMap const&) override;
     virtual Messages::RequestServer::WebsocketReadyStateResponse websocket_ready_state(i32) override;
     virtual Messages::RequestServer::WebsocketSubprotocolInUseResponse websocket_subprotocol_in_use(i32) override;
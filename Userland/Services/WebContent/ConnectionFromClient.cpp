@@ -11,11 +11,13 @@
 
 #include <AK/JsonObject.h>
 #include <AK/QuickSort.h>
+#include <LibCore/TraceEvent.h>
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/Font/FontDatabase.h>
 #include <LibGfx/SystemTheme.h>
 #include <LibJS/Heap/Heap.h>
 #include <LibJS/Runtime/ConsoleObject.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
 #include <LibWeb/ARIA/RoleType.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
 #include <LibWeb/CSS/StyleComputer.h>
@@ -26,23 +28,29 @@
 #include <LibWeb/DOM/ElementFactory.h>
 #include <LibWeb/DOM/Text.h>
 #include <LibWeb/Dump.h>
+#include <LibWeb/HTML/AnimatedBitmapDecodedImageData.h>
 #include <LibWeb/HTML/BrowsingContext.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
 #include <LibWeb/HTML/HTMLInputElement.h>
 #include <LibWeb/HTML/SelectedFile.h>
 #include <LibWeb/HTML/Storage.h>
+#include <LibWeb/HTML/StorageBottle.h>
 #include <LibWeb/HTML/TraversableNavigable.h>
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/Infra/Strings.h>
+#include <LibWeb/Layout/Node.h>
 #include <LibWeb/Layout/Viewport.h>
 #include <LibWeb/Loader/ContentFilter.h>
 #include <LibWeb/Loader/ProxyMappings.h>
 #include <LibWeb/Loader/ResourceLoader.h>
 #include <LibWeb/Namespace.h>
+#include <LibWeb/Painting/Paintable.h>
 #include <LibWeb/Painting/StackingContext.h>
 #include <LibWeb/Painting/ViewportPaintable.h>
 #include <LibWeb/PermissionsPolicy/AutoplayAllowlist.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
 #include <LibWebView/Attribute.h>
+#include <LibWebView/MemoryStatistics.h>
 #include <WebContent/ConnectionFromClient.h>
 #include <WebContent/PageClient.h>
 #include <WebContent/PageHost.h>
@@ -776,6 +784,106 @@ Messages::WebContentServer::DumpGcGraphResponse ConnectionFromClient::dump_gc_gr
     return MUST(String::from_byte_string(gc_graph_json.to_byte_string()));
 }
 
+void ConnectionFromClient::start_js_profile(u64)
+{
+    Web::Bindings::main_thread_vm().ensure_sampling_profiler().start();
+}
+
+Messages::WebContentServer::StopJsProfileResponse ConnectionFromClient::stop_js_profile(u64)
+{
+    // NOTE: This also stops a profile that was started with console.profile().
+    auto& profiler = Web::Bindings::main_thread_vm().ensure_sampling_profiler();
+    profiler.stop();
+    return MUST(String::from_byte_string(profiler.to_cpuprofile().to_byte_string()));
+}
+
+void ConnectionFromClient::start_tracing()
+{
+    Core::TraceEvent::start();
+}
+
+Messages::WebContentServer::StopTracingResponse ConnectionFromClient::stop_tracing()
+{
+    return Core::TraceEvent::stop();
+}
+
+void ConnectionFromClient::request_memory_statistics()
+{
+    WebView::MemoryStatistics statistics;
+    HashMap<StringView, WebView::JSHeapCellStatistics> cells_by_class_name;
+
+    Web::Bindings::main_thread_vm().heap().for_each_live_cell([&](JS::Cell& cell, size_t cell_size) {
+        auto& cell_statistics = cells_by_class_name.ensure(cell.class_name());
+        ++cell_statistics.cell_count;
+        cell_statistics.allocated_bytes += cell_size;
+        statistics.js_heap_allocated_bytes += cell_size;
+
+        if (is<Web::DOM::Node>(cell))
+            ++statistics.dom_node_count;
+        else if (is<Web::Layout::Node>(cell))
+            ++statistics.layout_node_count;
+        else if (is<Web::Painting::Paintable>(cell))
+            ++statistics.paintable_count;
+    });
+
+    statistics.js_heap_cells.ensure_capacity(cells_by_class_name.size());
+    for (auto& [class_name, cell_statistics] : cells_by_class_name) {
+        cell_statistics.class_name = MUST(String::from_utf8(class_name));
+        statistics.js_heap_cells.unchecked_append(move(cell_statistics));
+    }
+    quick_sort(statistics.js_heap_cells, [](auto const& a, auto const& b) {
+        return a.allocated_bytes > b.allocated_bytes;
+    });
+
+    statistics.decoded_image_bytes = Web::HTML::AnimatedBitmapDecodedImageData::total_decoded_bytes();
+
+    auto resource_cache_statistics = Web::ResourceLoader::the().cache_statistics();
+    statistics.resource_cache_entry_count = resource_cache_statistics.resource_count;
+    statistics.resource_cache_bytes = resource_cache_statistics.encoded_bytes;
+
+    async_did_update_memory_statistics(move(statistics));
+}
+
+void ConnectionFromClient::handle_memory_pressure(u64 page_id)
+{
+    auto page = this->page(page_id);
+    if (!page.has_value() || !page->page().top_level_traversable_is_initialized())
+        return;
+
+    auto& vm = Web::Bindings::main_thread_vm();
+    auto traversable = page->page().top_level_traversable();
+
+    // Let go of everything this page can recreate on demand, then collect whatever that left unreachable.
+    for (auto* navigable : Web::HTML::all_navigables()) {
+        if (navigable->traversable_navigable() != traversable)
+            continue;
+        if (auto document = navigable->active_document())
+            document->release_unused_image_data();
+    }
+
+    // Documents kept for back/forward traversal can be loaded again when they are traversed to.
+    traversable->clear_back_forward_cache();
+
+    // The resource and script parse caches are shared by every page of this process. Only drop them once none of
+    // those pages is visible, so a hidden tab doesn't slow down the ones that are still in use.
+    if (m_page_host->all_pages_are_hidden()) {
+        Web::ResourceLoader::the().clear_cache();
+        vm.script_parse_cache().clear();
+    }
+
+    vm.heap().collect_garbage();
+}
+
+void ConnectionFromClient::local_storage_did_load(String const& origin, OrderedHashMap<String, String> const& items)
+{
+    Web::HTML::StorageBottle::local_storage_did_load(origin, items);
+}
+
+void ConnectionFromClient::local_storage_did_change(String const& origin, Optional<String> const& key, Optional<String> const& value, bool is_own_change)
+{
+    Web::HTML::StorageBottle::local_storage_did_change(origin, key, value, is_own_change);
+}
+
 Messages::WebContentServer::GetSelectedTextResponse ConnectionFromClient::get_selected_text(u64 page_id)
 {
     if (auto page = this->page(page_id); page.has_value())
@@ -877,6 +985,63 @@ Messages::WebContentServer::DumpTextResponse ConnectionFromClient::dump_text(u64
     return document->body()->inner_text();
 }
 
+Messages::WebContentServer::DumpFrameTimingsResponse ConnectionFromClient::dump_frame_timings(u64 page_id)
+{
+    auto page = this->page(page_id);
+    if (!page.has_value())
+        return ByteString { "(no page)" };
+
+    auto const& timings = page->page().last_frame_timings();
+    StringBuilder builder;
+    auto append_timing = [&](StringView name, AK::Duration duration) {
+        builder.appendff("{}: {}us\n", name, duration.to_microseconds());
+    };
+    append_timing("style"sv, timings.style);
+    append_timing("layout"sv, timings.layout);
+    append_timing("grid layout"sv, timings.grid_layout);
+    append_timing("paint recording"sv, timings.paint_recording);
+    append_timing("display list playback"sv, timings.display_list_playback);
+    append_timing("garbage collection"sv, timings.garbage_collection);
+    return builder.to_byte_string();
+}
+
+Messages::WebContentServer::DumpPageLoadMetricsResponse ConnectionFromClient::dump_page_load_metrics(u64 page_id)
+{
+    JsonObject metrics;
+
+    auto page = this->page(page_id);
+    if (!page.has_value())
+        return metrics.to_byte_string();
+
+    // The milestones of the active document are in milliseconds, relative to the time origin of its window.
+    if (auto* document = page->page().top_level_browsing_context().active_document()) {
+        auto const& load_timing_info = document->load_timing_info();
+        auto append_milestone = [&](StringView name, double time) {
+            if (time > 0)
+                metrics.set(name, time);
+            else
+                metrics.set(name, JsonValue {});
+        };
+
+        append_milestone("first_paint"sv, document->first_paint_time().value_or(0));
+        append_milestone("dom_content_loaded"sv, load_timing_info.dom_content_loaded_event_start_time);
+        append_milestone("load"sv, load_timing_info.load_event_start_time);
+    }
+
+    // The time spent in each phase is in microseconds, summed over every frame painted since the page was created.
+    auto const& timings = page->page().total_frame_timings();
+    JsonObject phases;
+    phases.set("style"sv, timings.style.to_microseconds());
+    phases.set("layout"sv, timings.layout.to_microseconds());
+    phases.set("grid_layout"sv, timings.grid_layout.to_microseconds());
+    phases.set("paint_recording"sv, timings.paint_recording.to_microseconds());
+    phases.set("display_list_playback"sv, timings.display_list_playback.to_microseconds());
+    phases.set("garbage_collection"sv, timings.garbage_collection.to_microseconds());
+    metrics.set("phases"sv, move(phases));
+
+    return metrics.to_byte_string();
+}
+
 void ConnectionFromClient::set_content_filters(u64, Vector<String> const& filters)
 {
     Web::ContentFilter::the().set_patterns(filters).release_value_but_fixme_should_propagate_errors();
@@ -946,6 +1111,12 @@ void ConnectionFromClient::set_device_pixels_per_css_pixel(u64 page_id, float de
         page->set_device_pixels_per_css_pixel(device_pixels_per_css_pixel);
 }
 
+void ConnectionFromClient::set_display_refresh_rate(u64, float refresh_rate)
+{
+    // NOTE: All pages in this process share one event loop, and with it one rendering frame clock.
+    Web::HTML::main_thread_event_loop().set_display_refresh_rate(refresh_rate);
+}
+
 void ConnectionFromClient::set_window_position(u64 page_id, Web::DevicePixelPoint position)
 {
     if (auto page = this->page(page_id); page.has_value())
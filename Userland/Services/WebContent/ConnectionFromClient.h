@@ -88,6 +88,8 @@ private:
     virtual Messages::WebContentServer::DumpLayoutTreeResponse dump_layout_tree(u64 page_id) override;
     virtual Messages::WebContentServer::DumpPaintTreeResponse dump_paint_tree(u64 page_id) override;
     virtual Messages::WebContentServer::DumpTextResponse dump_text(u64 page_id) override;
+    virtual Messages::WebContentServer::DumpFrameTimingsResponse dump_frame_timings(u64 page_id) override;
+    virtual Messages::WebContentServer::DumpPageLoadMetricsResponse dump_page_load_metrics(u64 page_id) override;
     virtual void set_content_filters(u64 page_id, Vector<String> const&) override;
     virtual void set_autoplay_allowed_on_all_websites(u64 page_id) override;
     virtual void set_autoplay_allowlist(u64 page_id, Vector<String> const& allowlist) override;
@@ -98,6 +100,7 @@ private:
     virtual void set_has_focus(u64 page_id, bool) override;
     virtual void set_is_scripting_enabled(u64 page_id, bool) override;
     virtual void set_device_pixels_per_css_pixel(u64 page_id, float) override;
+    virtual void set_display_refresh_rate(u64 page_id, float) override;
     virtual void set_window_position(u64 page_id, Web::DevicePixelPoint) override;
     virtual void set_window_size(u64 page_id, Web::DevicePixelSize) override;
     virtual void handle_file_return(u64 page_id, i32 error, Optional<IPC::File> const& file, i32 request_id) override;
@@ -129,6 +132,15 @@ private:
     virtual void take_dom_node_screenshot(u64 page_id, i32 node_id) override;
 
     virtual Messages::WebContentServer::DumpGcGraphResponse dump_gc_graph(u64 page_id) override;
+    virtual void start_js_profile(u64 page_id) override;
+    virtual Messages::WebContentServer::StopJsProfileResponse stop_js_profile(u64 page_id) override;
+    virtual void start_tracing() override;
+    virtual Messages::WebContentServer::StopTracingResponse stop_tracing() override;
+
+    virtual void request_memory_statistics() override;
+    virtual void handle_memory_pressure(u64 page_id) override;
+    virtual void local_storage_did_load(String const& origin, OrderedHashMap<String, String> const& items) override;
+    virtual void local_storage_did_change(String const& origin, Optional<String> const& key, Optional<String> const& value, bool is_own_change) override;
 
     virtual Messages::WebContentServer::GetLocalStorageEntriesResponse get_local_storage_entries(u64 page_id) override;
     virtual Messages::WebContentServer::GetSessionStorageEntriesResponse get_session_storage_entries(u64 page_id) override;
@@ -216,6 +216,11 @@ void PageClient::paint_next_frame()
         return;
 
     auto viewport_rect = page().css_to_device_rect(page().top_level_traversable()->viewport_rect());
+    // FIXME: Play back the display list on a dedicated rendering thread, so the event loop can run while the previous
+    //        frame is being rasterized. The display list holds RefPtrs to bitmaps, fonts and glyph runs, and those
+    //        aren't thread-safe to ref/unref, so the commands first need to own everything they reference (or the main
+    //        thread must not touch those objects until playback finishes). Canvas bitmaps that JS mutates would also have
+    //        to be snapshotted at record time.
     paint(viewport_rect, *back_store);
 
     m_backing_store_manager.swap_back_and_front();
@@ -510,6 +515,36 @@ void PageClient::page_did_update_cookie(Web::Cookie::Cookie cookie)
     client().async_did_update_cookie(m_id, move(cookie));
 }
 
+OrderedHashMap<String, String> PageClient::page_did_request_local_storage_items(String const& origin)
+{
+    auto response = client().send_sync_but_allow_failure<Messages::WebContentClient::DidRequestLocalStorageItems>(origin);
+    if (!response) {
+        dbgln("WebContent client disconnected during DidRequestLocalStorageItems. Exiting peacefully.");
+        exit(0);
+    }
+    return response->take_items();
+}
+
+void PageClient::page_did_request_local_storage_preload(String const& origin)
+{
+    client().async_did_request_local_storage_preload(origin);
+}
+
+void PageClient::page_did_set_local_storage_item(String const& origin, String const& key, String const& value)
+{
+    client().async_did_set_local_storage_item(origin, key, value);
+}
+
+void PageClient::page_did_remove_local_storage_item(String const& origin, String const& key)
+{
+    client().async_did_remove_local_storage_item(origin, key);
+}
+
+void PageClient::page_did_clear_local_storage(String const& origin)
+{
+    client().async_did_clear_local_storage(origin);
+}
+
 void PageClient::page_did_update_resource_count(i32 count_waiting)
 {
     client().async_did_update_resource_count(m_id, count_waiting);
@@ -591,6 +626,11 @@ void PageClient::page_did_change_audio_play_state(Web::HTML::AudioPlayState play
     client().async_did_change_audio_play_state(m_id, play_state);
 }
 
+void PageClient::page_did_change_frozen_state(bool)
+{
+    m_owner.page_did_change_frozen_state({});
+}
+
 void PageClient::page_did_allocate_backing_stores(i32 front_bitmap_id, Gfx::ShareableBitmap front_bitmap, i32 back_bitmap_id, Gfx::ShareableBitmap back_bitmap)
 {
     client().async_did_allocate_backing_stores(m_id, front_bitmap_id, front_bitmap, back_bitmap_id, back_bitmap);
@@ -739,6 +779,11 @@ void PageClient::did_get_js_console_messages(i32 start_index, Vector<ByteString>
     client().async_did_get_js_console_messages(m_id, start_index, move(message_types), move(messages));
 }
 
+void PageClient::did_finish_js_profile(String label, String profile)
+{
+    client().async_did_finish_js_profile(m_id, move(label), move(profile));
+}
+
 Web::DisplayListPlayerType PageClient::display_list_player_type() const
 {
     if (s_use_gpu_painter)
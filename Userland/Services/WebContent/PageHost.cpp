@@ -6,6 +6,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AllOf.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
 #include <LibWeb/HTML/TraversableNavigable.h>
 #include <WebContent/ConnectionFromClient.h>
@@ -13,6 +14,10 @@
 #include <WebContent/PageHost.h>
 #include <WebContent/WebDriverConnection.h>
 
+#if defined(AK_OS_MACOS)
+#    include <sys/resource.h>
+#endif
+
 namespace WebContent {
 
 PageHost::PageHost(ConnectionFromClient& client)
@@ -34,6 +39,34 @@ void PageHost::remove_page(Badge<PageClient>, u64 index)
     m_pages.remove(index);
 }
 
+void PageHost::page_did_change_frozen_state(Badge<PageClient>)
+{
+    // Once every page of this process is frozen, nothing we do is urgent until one of them is resumed.
+    auto all_pages_are_frozen = all_of(m_pages, [](auto const& it) {
+        auto& page = it.value->page();
+        return page.top_level_traversable_is_initialized() && page.top_level_traversable()->is_frozen();
+    });
+    if (m_runs_in_background == all_pages_are_frozen)
+        return;
+    m_runs_in_background = all_pages_are_frozen;
+
+#if defined(AK_OS_MACOS)
+    if (setpriority(PRIO_DARWIN_PROCESS, 0, m_runs_in_background ? PRIO_DARWIN_BG : 0) < 0)
+        dbgln("Unable to change the background priority of WebContent: {}", Error::from_errno(errno));
+#else
+    // FIXME: Lower our priority on other platforms, too. Without CAP_SYS_NICE, a niceness that was raised can't be
+    //        lowered again, so we wouldn't be able to go back to normal once a page is resumed.
+#endif
+}
+
+bool PageHost::all_pages_are_hidden() const
+{
+    return all_of(m_pages, [](auto const& it) {
+        auto& page = it.value->page();
+        return !page.top_level_traversable_is_initialized() || page.top_level_traversable()->system_visibility_state() == Web::HTML::VisibilityState::Hidden;
+    });
+}
+
 Optional<PageClient&> PageHost::page(u64 index)
 {
     return m_pages.get(index).map([](auto& value) -> PageClient& {
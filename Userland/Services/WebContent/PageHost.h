@@ -27,6 +27,9 @@ public:
     Optional<PageClient&> page(u64 index);
     PageClient& create_page();
     void remove_page(Badge<PageClient>, u64 index);
+    void page_did_change_frozen_state(Badge<PageClient>);
+
+    bool all_pages_are_hidden() const;
 
     ConnectionFromClient& client() const { return m_client; }
 
@@ -36,6 +39,7 @@ private:
     ConnectionFromClient& m_client;
     HashMap<u64, JS::Handle<PageClient>> m_pages;
     u64 m_next_id { 0 };
+    bool m_runs_in_background { false };
 };
 
 }
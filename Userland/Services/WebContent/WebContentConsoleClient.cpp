@@ -13,6 +13,7 @@
 #include <LibJS/Runtime/GlobalEnvironment.h>
 #include <LibJS/Runtime/ObjectEnvironment.h>
 #include <LibJS/Runtime/Realm.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibWeb/HTML/PolicyContainers.h>
 #include <LibWeb/HTML/Scripting/ClassicScript.h>
@@ -26,6 +27,13 @@ namespace WebContent {
 
 JS_DEFINE_ALLOCATOR(WebContentConsoleClient);
 
+static bool s_save_profiles = false;
+
+void WebContentConsoleClient::set_save_profiles()
+{
+    s_save_profiles = true;
+}
+
 WebContentConsoleClient::WebContentConsoleClient(JS::Console& console, JS::Realm& realm, PageClient& client)
     : ConsoleClient(console)
     , m_client(client)
@@ -67,6 +75,19 @@ void WebContentConsoleClient::report_exception(JS::Error const& exception, bool
     print_html(JS::MarkupGenerator::html_from_error(exception, in_promise).release_value_but_fixme_should_propagate_errors().to_byte_string());
 }
 
+void WebContentConsoleClient::report_profile(String const& label, JS::SamplingProfiler const& profiler)
+{
+    print_html(ByteString::formatted("Profile '{}' finished with {} samples.", escape_html_entities(label), profiler.sample_count()));
+
+    // Any page can call console.profile(), so only hand the profile to the chrome process to be written to disk
+    // when that was explicitly asked for.
+    if (!s_save_profiles)
+        return;
+
+    auto profile = MUST(String::from_byte_string(profiler.to_cpuprofile().to_byte_string()));
+    m_client->did_finish_js_profile(label, move(profile));
+}
+
 void WebContentConsoleClient::print_html(ByteString const& line)
 {
     m_message_log.append({ .type = ConsoleOutput::Type::HTML, .data = line });
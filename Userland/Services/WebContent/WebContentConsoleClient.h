@@ -23,11 +23,14 @@ class WebContentConsoleClient final : public JS::ConsoleClient {
     JS_DECLARE_ALLOCATOR(WebContentConsoleClient);
 
 public:
+    static void set_save_profiles();
+
     virtual ~WebContentConsoleClient() override;
 
     void handle_input(ByteString const& js_source);
     void send_messages(i32 start_index);
     void report_exception(JS::Error const&, bool) override;
+    void report_profile(String const& label, JS::SamplingProfiler const&) override;
 
 private:
     WebContentConsoleClient(JS::Console&, JS::Realm&, PageClient&);
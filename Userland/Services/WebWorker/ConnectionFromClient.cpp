@@ -4,15 +4,25 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/IDAllocator.h>
 #include <LibCore/EventLoop.h>
+#include <LibCore/System.h>
+#include <LibCore/TraceEvent.h>
 #include <WebWorker/ConnectionFromClient.h>
 #include <WebWorker/DedicatedWorkerHost.h>
 #include <WebWorker/PageHost.h>
 
 namespace WebWorker {
 
+static HashMap<int, RefPtr<ConnectionFromClient>> s_connections;
+static IDAllocator s_client_ids;
+
 void ConnectionFromClient::die()
 {
+    auto client_id = this->client_id();
+    s_connections.remove(client_id);
+    s_client_ids.deallocate(client_id);
+
     // FIXME: When handling multiple workers in the same process,
     //     this logic needs to be smarter (only when all workers are dead, etc).
     Core::EventLoop::current().quit(0);
@@ -36,9 +46,10 @@ void ConnectionFromClient::request_file(Web::FileRequest request)
 }
 
 ConnectionFromClient::ConnectionFromClient(NonnullOwnPtr<Core::LocalSocket> socket)
-    : IPC::ConnectionFromClient<WebWorkerClientEndpoint, WebWorkerServerEndpoint>(*this, move(socket), 1)
+    : IPC::ConnectionFromClient<WebWorkerClientEndpoint, WebWorkerServerEndpoint>(*this, move(socket), s_client_ids.allocate())
     , m_page_host(PageHost::create(Web::Bindings::main_thread_vm(), *this))
 {
+    s_connections.set(client_id(), *this);
 }
 
 ConnectionFromClient::~ConnectionFromClient() = default;
@@ -53,6 +64,28 @@ Web::Page const& ConnectionFromClient::page() const
     return m_page_host->page();
 }
 
+Messages::WebWorkerServer::ConnectNewClientResponse ConnectionFromClient::connect_new_client()
+{
+    int socket_fds[2] {};
+    if (auto err = Core::System::socketpair(AF_LOCAL, SOCK_STREAM, 0, socket_fds); err.is_error()) {
+        dbgln("Failed to create client socketpair: {}", err.error());
+        return IPC::File {};
+    }
+
+    auto client_socket_or_error = Core::LocalSocket::adopt_fd(socket_fds[0]);
+    if (client_socket_or_error.is_error()) {
+        close(socket_fds[0]);
+        close(socket_fds[1]);
+        dbgln("Failed to adopt client socket: {}", client_socket_or_error.error());
+        return IPC::File {};
+    }
+    auto client_socket = client_socket_or_error.release_value();
+    // Note: A ref is stored in the static s_connections map
+    auto client = adopt_ref(*new ConnectionFromClient(move(client_socket)));
+
+    return IPC::File::adopt_fd(socket_fds[1]);
+}
+
 void ConnectionFromClient::start_dedicated_worker(URL::URL const& url, String const& type, String const&, String const&, Web::HTML::TransferDataHolder const& implicit_port, Web::HTML::SerializedEnvironmentSettingsObject const& outside_settings)
 {
     m_worker_host = make_ref_counted<DedicatedWorkerHost>(url, type);
@@ -71,4 +104,14 @@ void ConnectionFromClient::handle_file_return(i32 error, Optional<IPC::File> con
     file_request.value().on_file_request_finish(error != 0 ? Error::from_errno(error) : ErrorOr<i32> { file->take_fd() });
 }
 
+void ConnectionFromClient::start_tracing()
+{
+    Core::TraceEvent::start();
+}
+
+Messages::WebWorkerServer::StopTracingResponse ConnectionFromClient::stop_tracing()
+{
+    return Core::TraceEvent::stop();
+}
+
 }
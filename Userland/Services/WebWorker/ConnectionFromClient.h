@@ -39,8 +39,11 @@ private:
     Web::Page& page();
     Web::Page const& page() const;
 
+    virtual Messages::WebWorkerServer::ConnectNewClientResponse connect_new_client() override;
     virtual void start_dedicated_worker(URL::URL const& url, String const&, String const&, String const&, Web::HTML::TransferDataHolder const&, Web::HTML::SerializedEnvironmentSettingsObject const&) override;
     virtual void handle_file_return(i32 error, Optional<IPC::File> const& file, i32 request_id) override;
+    virtual void start_tracing() override;
+    virtual Messages::WebWorkerServer::StopTracingResponse stop_tracing() override;
 
     JS::Handle<PageHost> m_page_host;
 
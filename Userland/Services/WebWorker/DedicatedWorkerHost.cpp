@@ -33,6 +33,10 @@ void DedicatedWorkerHost::run(JS::NonnullGCPtr<Web::Page> page, Web::HTML::Trans
 {
     bool const is_shared = false;
 
+    // 6. Let agent be the result of obtaining a dedicated/shared worker agent given outside settings and is shared.
+    // NOTE: A dedicated or shared worker agent's [[CanBlock]] is true, https://html.spec.whatwg.org/multipage/webappapis.html#obtain-a-dedicated/shared-worker-agent
+    Web::Bindings::main_thread_vm().set_agent_can_block(true);
+
     // 7. Let realm execution context be the result of creating a new JavaScript realm given agent and the following customizations:
     auto realm_execution_context = Web::Bindings::create_a_new_javascript_realm(
         Web::Bindings::main_thread_vm(),
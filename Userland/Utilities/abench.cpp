@@ -4,7 +4,9 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/HashMap.h>
 #include <AK/NumericLimits.h>
+#include <AK/QuickSort.h>
 #include <AK/Types.h>
 #include <LibAudio/Loader.h>
 #include <LibCore/ArgsParser.h>
@@ -17,55 +19,90 @@
 // The Kernel has problems with large anonymous buffers, so let's limit sample reads ourselves.
 static constexpr size_t MAX_CHUNK_SIZE = 1 * MiB / 2;
 
-ErrorOr<int> serenity_main(Main::Arguments args)
-{
-    StringView path {};
-    int sample_count = -1;
-
-    Core::ArgsParser args_parser;
-    args_parser.set_general_help("Benchmark audio loading");
-    args_parser.add_positional_argument(path, "Path to audio file", "path");
-    args_parser.add_option(sample_count, "How many samples to load at maximum", "sample-count", 's', "samples");
-    args_parser.parse(args);
-
-    TRY(Core::System::unveil(TRY(FileSystem::absolute_path(path)), "r"sv));
-    TRY(Core::System::unveil(nullptr, nullptr));
-    TRY(Core::System::pledge("stdio recvfd rpath"));
+struct CodecTotals {
+    Duration loader_time;
+    double audio_seconds { 0 };
+};
 
+static ErrorOr<int> benchmark_file(StringView path, int sample_count, HashMap<ByteString, CodecTotals>& codec_totals)
+{
     auto maybe_loader = Audio::Loader::create(path);
     if (maybe_loader.is_error()) {
-        warnln("Failed to load audio file: {}", maybe_loader.error().description);
+        warnln("Failed to load audio file {}: {}", path, maybe_loader.error().description);
         return 1;
     }
     auto loader = maybe_loader.release_value();
 
     Core::ElapsedTimer sample_timer { Core::TimerType::Precise };
-    i64 total_loader_time = 0;
+    Duration total_loader_time;
     int remaining_samples = sample_count > 0 ? sample_count : NumericLimits<int>::max();
     unsigned total_loaded_samples = 0;
 
     for (;;) {
         if (remaining_samples > 0) {
-            sample_timer = sample_timer.start_new();
+            sample_timer.start();
             auto samples = loader->get_more_samples(min(MAX_CHUNK_SIZE, remaining_samples));
-            total_loader_time += sample_timer.elapsed_milliseconds();
+            total_loader_time += sample_timer.elapsed_time();
             if (!samples.is_error()) {
                 remaining_samples -= samples.value().size();
                 total_loaded_samples += samples.value().size();
                 if (samples.value().size() == 0)
                     break;
             } else {
-                warnln("Error while loading audio: {}", samples.error().description);
+                warnln("Error while loading audio from {}: {}", path, samples.error().description);
                 return 1;
             }
         } else
             break;
     }
 
-    auto time_per_sample = static_cast<double>(total_loader_time) / static_cast<double>(total_loaded_samples) * 1000.;
+    auto loader_seconds = static_cast<double>(total_loader_time.to_microseconds()) / 1000'000.;
+    auto audio_seconds = static_cast<double>(total_loaded_samples) / static_cast<double>(loader->sample_rate());
+    auto time_per_sample = loader_seconds / static_cast<double>(total_loaded_samples) * 1000'000.;
     auto playback_time_per_sample = (1. / static_cast<double>(loader->sample_rate())) * 1000'000.;
 
-    outln("Loaded {:10d} samples in {:06.3f} s, {:9.3f} µs/sample, {:6.1f}% speed (realtime {:9.3f} µs/sample)", total_loaded_samples, static_cast<double>(total_loader_time) / 1000., time_per_sample, playback_time_per_sample / time_per_sample * 100., playback_time_per_sample);
+    outln("{}: Loaded {:10d} {} samples in {:06.3f} s, {:9.3f} µs/sample, {:6.1f}% speed (realtime {:9.3f} µs/sample)", path, total_loaded_samples, loader->format_name(), loader_seconds, time_per_sample, playback_time_per_sample / time_per_sample * 100., playback_time_per_sample);
 
+    auto& totals = codec_totals.ensure(loader->format_name());
+    totals.loader_time += total_loader_time;
+    totals.audio_seconds += audio_seconds;
     return 0;
 }
+
+ErrorOr<int> serenity_main(Main::Arguments args)
+{
+    Vector<StringView> paths;
+    int sample_count = -1;
+    bool report_per_codec = false;
+
+    Core::ArgsParser args_parser;
+    args_parser.set_general_help("Benchmark audio loading");
+    args_parser.add_positional_argument(paths, "Paths to audio files", "paths");
+    args_parser.add_option(sample_count, "How many samples to load at maximum from each file", "sample-count", 's', "samples");
+    args_parser.add_option(report_per_codec, "Report the decode realtime factor of each codec across all files", "per-codec", 'c');
+    args_parser.parse(args);
+
+    for (auto path : paths)
+        TRY(Core::System::unveil(TRY(FileSystem::absolute_path(path)), "r"sv));
+    TRY(Core::System::unveil(nullptr, nullptr));
+    TRY(Core::System::pledge("stdio recvfd rpath"));
+
+    HashMap<ByteString, CodecTotals> codec_totals;
+    int result = 0;
+    for (auto path : paths) {
+        if (TRY(benchmark_file(path, sample_count, codec_totals)) != 0)
+            result = 1;
+    }
+
+    if (report_per_codec) {
+        auto codecs = codec_totals.keys();
+        quick_sort(codecs);
+        for (auto const& codec : codecs) {
+            auto const& totals = codec_totals.get(codec).value();
+            auto loader_seconds = static_cast<double>(totals.loader_time.to_microseconds()) / 1000'000.;
+            outln("{}: Decoded {:9.3f} s of audio in {:06.3f} s, {:8.2f}x realtime", codec, totals.audio_seconds, loader_seconds, totals.audio_seconds / loader_seconds);
+        }
+    }
+
+    return result;
+}
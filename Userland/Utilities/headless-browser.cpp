@@ -11,11 +11,13 @@
 #include <AK/ByteBuffer.h>
 #include <AK/ByteString.h>
 #include <AK/Function.h>
+#include <AK/JsonArray.h>
 #include <AK/JsonObject.h>
 #include <AK/JsonParser.h>
 #include <AK/LexicalPath.h>
 #include <AK/NonnullOwnPtr.h>
 #include <AK/Platform.h>
+#include <AK/QuickSort.h>
 #include <AK/String.h>
 #include <AK/Vector.h>
 #include <Ladybird/HelperProcess.h>
@@ -25,6 +27,7 @@
 #include <LibCore/ConfigFile.h>
 #include <LibCore/DirIterator.h>
 #include <LibCore/Directory.h>
+#include <LibCore/ElapsedTimer.h>
 #include <LibCore/EventLoop.h>
 #include <LibCore/File.h>
 #include <LibCore/Promise.h>
@@ -59,12 +62,18 @@
 #include <LibWebView/WebContentClient.h>
 
 constexpr int DEFAULT_TIMEOUT_MS = 30000; // 30sec
+constexpr int SCREENSHOT_TIMEOUT_MS = 10000; // 10sec
 
-static StringView s_current_test_path;
+enum class TestResult {
+    Pass,
+    Fail,
+    Skipped,
+    Timeout,
+};
 
 class HeadlessWebContentView final : public WebView::ViewImplementation {
 public:
-    static ErrorOr<NonnullOwnPtr<HeadlessWebContentView>> create(Core::AnonymousBuffer theme, Gfx::IntSize const& window_size, String const& command_line, StringView web_driver_ipc_path, Ladybird::IsLayoutTestMode is_layout_test_mode = Ladybird::IsLayoutTestMode::No, Vector<ByteString> const& certificates = {}, StringView resources_folder = {})
+    static ErrorOr<NonnullOwnPtr<HeadlessWebContentView>> create(Core::AnonymousBuffer theme, Gfx::IntSize const& window_size, String const& command_line, StringView web_driver_ipc_path, Ladybird::IsLayoutTestMode is_layout_test_mode = Ladybird::IsLayoutTestMode::No, Vector<ByteString> const& certificates = {}, StringView resources_folder = {}, size_t gc_allocation_sample_interval = 0)
     {
         RefPtr<Protocol::RequestClient> request_client;
         RefPtr<ImageDecoderClient::Client> image_decoder_client;
@@ -78,57 +87,109 @@ public:
         auto database = TRY(WebView::Database::create());
         auto cookie_jar = TRY(WebView::CookieJar::create(*database));
 
-        auto view = TRY(adopt_nonnull_own_or_enomem(new (nothrow) HeadlessWebContentView(move(database), move(cookie_jar), image_decoder_client, request_client)));
-
         Ladybird::WebContentOptions web_content_options {
             .command_line = command_line,
             .executable_path = MUST(String::from_byte_string(MUST(Core::System::current_executable_path()))),
             .is_layout_test_mode = is_layout_test_mode,
+            .gc_allocation_sample_interval = gc_allocation_sample_interval,
         };
 
-        auto request_server_socket = TRY(connect_new_request_server_client(*request_client));
-        auto image_decoder_socket = TRY(connect_new_image_decoder_client(*image_decoder_client));
-
-        auto candidate_web_content_paths = TRY(get_paths_for_helper_process("WebContent"sv));
-        view->m_client_state.client = TRY(launch_web_content_process(*view, candidate_web_content_paths, web_content_options, move(image_decoder_socket), move(request_server_socket)));
-
-        view->client().async_update_system_theme(0, move(theme));
-
-        view->m_viewport_size = window_size;
-        view->client().async_set_viewport_size(0, view->m_viewport_size.to_type<Web::DevicePixels>());
-        view->client().async_set_window_size(0, window_size.to_type<Web::DevicePixels>());
+        auto view = TRY(adopt_nonnull_own_or_enomem(new (nothrow) HeadlessWebContentView(move(database), move(cookie_jar), image_decoder_client, request_client, move(theme), window_size, move(web_content_options))));
+        TRY(view->launch_web_content_client());
 
         if (!web_driver_ipc_path.is_empty())
             view->client().async_connect_to_webdriver(0, web_driver_ipc_path);
 
-        view->m_client_state.client->on_web_content_process_crash = [] {
-            warnln("\033[31;1mWebContent Crashed!!\033[0m");
-            if (!s_current_test_path.is_empty()) {
-                warnln("    Last started test: {}", s_current_test_path);
-            }
-            VERIFY_NOT_REACHED();
-        };
+        return view;
+    }
+
+    // Creates a view with a WebContent process of its own, which shares every other helper process with this view.
+    ErrorOr<NonnullOwnPtr<HeadlessWebContentView>> create_sibling()
+    {
+        auto cookie_jar = TRY(WebView::CookieJar::create(*m_database));
+
+        auto view = TRY(adopt_nonnull_own_or_enomem(new (nothrow) HeadlessWebContentView(m_database, move(cookie_jar), m_image_decoder_client, m_request_client, m_theme, m_viewport_size, m_web_content_options)));
+        TRY(view->launch_web_content_client());
 
         return view;
     }
 
-    RefPtr<Gfx::Bitmap> take_screenshot()
+    NonnullRefPtr<Core::Promise<RefPtr<Gfx::Bitmap>>> take_screenshot()
     {
         VERIFY(!m_pending_screenshot);
 
         m_pending_screenshot = Core::Promise<RefPtr<Gfx::Bitmap>>::construct();
         client().async_take_document_screenshot(0);
 
-        auto screenshot = MUST(m_pending_screenshot->await());
-        m_pending_screenshot = nullptr;
+        // A WebContent process that is stuck never sends the screenshot, so the test waiting for it times out on its
+        // own instead of waiting until the timeout of the whole test.
+        m_screenshot_timeout_timer = Core::Timer::create_single_shot(SCREENSHOT_TIMEOUT_MS, [this] {
+            auto pending_screenshot = abandon_pending_screenshot();
+            pending_screenshot->reject(Error::from_string_literal("Timed out waiting for a screenshot"));
+            finish_test(TestResult::Timeout);
+        });
+        m_screenshot_timeout_timer->start();
 
-        return screenshot;
+        return *m_pending_screenshot;
     }
 
     virtual void did_receive_screenshot(Badge<WebView::WebContentClient>, Gfx::ShareableBitmap const& screenshot) override
     {
+        if (m_abandoned_screenshot_count > 0) {
+            --m_abandoned_screenshot_count;
+            return;
+        }
+
         VERIFY(m_pending_screenshot);
-        m_pending_screenshot->resolve(screenshot.bitmap());
+        m_screenshot_timeout_timer->stop();
+
+        // NOTE: Whoever waits for the screenshot may take another one right away.
+        auto pending_screenshot = m_pending_screenshot.release_nonnull();
+        pending_screenshot->resolve(screenshot.bitmap());
+    }
+
+    using TestCompletionHandler = Function<void(ErrorOr<TestResult>)>;
+
+    // Runs a test that calls finish_test() once it has a result. The test times out if that doesn't happen in time.
+    void start_test(StringView input_path, int timeout_in_milliseconds, TestCompletionHandler on_test_complete)
+    {
+        VERIFY(!m_test_completion_handler);
+
+        m_current_test_path = input_path;
+        m_test_completion_handler = move(on_test_complete);
+
+        m_test_timeout_timer = Core::Timer::create_single_shot(timeout_in_milliseconds, [this] {
+            finish_test(TestResult::Timeout);
+        });
+        m_test_timeout_timer->start();
+    }
+
+    void finish_test(ErrorOr<TestResult> result)
+    {
+        // A test that has timed out may still try to finish later on.
+        if (!m_test_completion_handler)
+            return;
+
+        m_test_timeout_timer->stop();
+        on_load_finish = nullptr;
+        on_text_test_finish = nullptr;
+
+        if (m_pending_screenshot)
+            (void)abandon_pending_screenshot();
+
+        // NOTE: We are usually called from one of the callbacks that are cleared above, so the completion handler,
+        //       which may start the next test on this view, has to wait until that callback has returned.
+        Core::deferred_invoke([on_test_complete = move(m_test_completion_handler), result = move(result)]() mutable {
+            on_test_complete(move(result));
+        });
+    }
+
+    // The screenshot that is no longer waited for must not be mistaken for one that is taken later.
+    NonnullRefPtr<Core::Promise<RefPtr<Gfx::Bitmap>>> abandon_pending_screenshot()
+    {
+        m_screenshot_timeout_timer->stop();
+        ++m_abandoned_screenshot_count;
+        return m_pending_screenshot.release_nonnull();
     }
 
     ErrorOr<String> dump_layout_tree()
@@ -146,14 +207,30 @@ public:
         return String::from_byte_string(client().dump_text(0));
     }
 
+    ErrorOr<String> dump_frame_timings()
+    {
+        return String::from_byte_string(client().dump_frame_timings(0));
+    }
+
+    ErrorOr<JsonObject> dump_page_load_metrics()
+    {
+        auto metrics = TRY(JsonValue::from_string(client().dump_page_load_metrics(0)));
+        if (!metrics.is_object())
+            return Error::from_string_literal("Page load metrics are not a JSON object");
+        return metrics.as_object();
+    }
+
     void clear_content_filters()
     {
         client().async_set_content_filters(0, {});
     }
 
 private:
-    HeadlessWebContentView(NonnullRefPtr<WebView::Database> database, NonnullOwnPtr<WebView::CookieJar> cookie_jar, RefPtr<ImageDecoderClient::Client> image_decoder_client, RefPtr<Protocol::RequestClient> request_client)
-        : m_database(move(database))
+    HeadlessWebContentView(NonnullRefPtr<WebView::Database> database, NonnullOwnPtr<WebView::CookieJar> cookie_jar, RefPtr<ImageDecoderClient::Client> image_decoder_client, RefPtr<Protocol::RequestClient> request_client, Core::AnonymousBuffer theme, Gfx::IntSize window_size, Ladybird::WebContentOptions web_content_options)
+        : m_viewport_size(window_size)
+        , m_theme(move(theme))
+        , m_web_content_options(move(web_content_options))
+        , m_database(move(database))
         , m_cookie_jar(move(cookie_jar))
         , m_request_client(move(request_client))
         , m_image_decoder_client(move(image_decoder_client))
@@ -168,10 +245,33 @@ private:
 
         on_request_worker_agent = [this]() {
             auto worker_client = MUST(launch_web_worker_process(MUST(get_paths_for_helper_process("WebWorker"sv)), *m_request_client));
-            return worker_client->dup_socket();
+            return MUST(connect_new_web_worker_client(move(worker_client)));
         };
     }
 
+    ErrorOr<void> launch_web_content_client()
+    {
+        auto request_server_socket = TRY(connect_new_request_server_client(*m_request_client));
+        auto image_decoder_socket = TRY(connect_new_image_decoder_client(*m_image_decoder_client));
+
+        auto candidate_web_content_paths = TRY(get_paths_for_helper_process("WebContent"sv));
+        m_client_state.client = TRY(launch_web_content_process(*this, candidate_web_content_paths, m_web_content_options, move(image_decoder_socket), move(request_server_socket)));
+
+        client().async_update_system_theme(0, m_theme);
+        client().async_set_viewport_size(0, m_viewport_size.to_type<Web::DevicePixels>());
+        client().async_set_window_size(0, m_viewport_size.to_type<Web::DevicePixels>());
+
+        m_client_state.client->on_web_content_process_crash = [this] {
+            warnln("\033[31;1mWebContent Crashed!!\033[0m");
+            if (!m_current_test_path.is_empty()) {
+                warnln("    Last started test: {}", m_current_test_path);
+            }
+            VERIFY_NOT_REACHED();
+        };
+
+        return {};
+    }
+
     void update_zoom() override { }
     void initialize_client(CreateNewClient) override { }
 
@@ -181,7 +281,15 @@ private:
 
 private:
     Gfx::IntSize m_viewport_size;
+    Core::AnonymousBuffer m_theme;
+    Ladybird::WebContentOptions m_web_content_options;
     RefPtr<Core::Promise<RefPtr<Gfx::Bitmap>>> m_pending_screenshot;
+    RefPtr<Core::Timer> m_screenshot_timeout_timer;
+    size_t m_abandoned_screenshot_count { 0 };
+
+    StringView m_current_test_path;
+    TestCompletionHandler m_test_completion_handler;
+    RefPtr<Core::Timer> m_test_timeout_timer;
 
     NonnullRefPtr<WebView::Database> m_database;
     NonnullOwnPtr<WebView::CookieJar> m_cookie_jar;
@@ -189,7 +297,7 @@ private:
     RefPtr<ImageDecoderClient::Client> m_image_decoder_client;
 };
 
-static ErrorOr<NonnullRefPtr<Core::Timer>> load_page_for_screenshot_and_exit(Core::EventLoop& event_loop, HeadlessWebContentView& view, URL::URL url, int screenshot_timeout)
+static ErrorOr<NonnullRefPtr<Core::Timer>> load_page_for_screenshot_and_exit(Core::EventLoop& event_loop, HeadlessWebContentView& view, URL::URL url, int screenshot_timeout, bool dump_frame_timings)
 {
     // FIXME: Allow passing the output path as an argument.
     static constexpr auto output_file_path = "output.png"sv;
@@ -201,17 +309,25 @@ static ErrorOr<NonnullRefPtr<Core::Timer>> load_page_for_screenshot_and_exit(Cor
 
     auto timer = Core::Timer::create_single_shot(
         screenshot_timeout * 1000,
-        [&]() {
-            if (auto screenshot = view.take_screenshot()) {
+        [&, dump_frame_timings]() {
+            auto screenshot = view.take_screenshot()->await();
+
+            if (screenshot.is_error()) {
+                warnln("Unable to take a screenshot: {}", screenshot.error());
+            } else if (screenshot.value()) {
                 outln("Saving screenshot to {}", output_file_path);
 
                 auto output_file = MUST(Core::File::open(output_file_path, Core::File::OpenMode::Write));
-                auto image_buffer = MUST(Gfx::PNGWriter::encode(*screenshot));
+                auto image_buffer = MUST(Gfx::PNGWriter::encode(*screenshot.value()));
                 MUST(output_file->write_until_depleted(image_buffer.bytes()));
             } else {
                 warnln("No screenshot available");
             }
 
+            // NOTE: Taking the screenshot painted a frame, so these are the timings for producing it.
+            if (dump_frame_timings)
+                out("{}", MUST(view.dump_frame_timings()));
+
             event_loop.quit(0);
         });
 
@@ -220,35 +336,32 @@ static ErrorOr<NonnullRefPtr<Core::Timer>> load_page_for_screenshot_and_exit(Cor
     return timer;
 }
 
-enum class TestMode {
-    Layout,
-    Text,
-    Ref,
-};
-
-enum class TestResult {
-    Pass,
-    Fail,
-    Skipped,
-    Timeout,
-};
+// How often the memory usage of each process is sampled while a page is loading.
+static constexpr int BENCHMARK_MEMORY_SAMPLE_INTERVAL_MS = 10;
 
-static StringView test_result_to_string(TestResult result)
+static ErrorOr<Vector<URL::URL>> load_benchmark_urls(StringView url_list_path)
 {
-    switch (result) {
-    case TestResult::Pass:
-        return "Pass"sv;
-    case TestResult::Fail:
-        return "Fail"sv;
-    case TestResult::Skipped:
-        return "Skipped"sv;
-    case TestResult::Timeout:
-        return "Timeout"sv;
+    auto file = TRY(Core::File::open(url_list_path, Core::File::OpenMode::Read));
+    auto contents = TRY(file->read_until_eof());
+
+    Vector<URL::URL> urls;
+    for (auto line : StringView { contents.bytes() }.lines()) {
+        line = line.trim_whitespace();
+        if (line.is_empty() || line.starts_with('#'))
+            continue;
+
+        auto url = WebView::sanitize_url(line);
+        if (!url.has_value()) {
+            warnln("Invalid URL: \"{}\"", line);
+            return Error::from_string_literal("Invalid URL");
+        }
+        urls.append(url.release_value());
     }
-    VERIFY_NOT_REACHED();
+
+    return urls;
 }
 
-static ErrorOr<TestResult> run_dump_test(HeadlessWebContentView& view, StringView input_path, StringView expectation_path, TestMode mode, int timeout_in_milliseconds = DEFAULT_TIMEOUT_MS)
+static ErrorOr<JsonObject> run_benchmark_iteration(HeadlessWebContentView& view, URL::URL const& url, int timeout_in_milliseconds)
 {
     Core::EventLoop loop;
     bool did_timeout = false;
@@ -258,58 +371,131 @@ static ErrorOr<TestResult> run_dump_test(HeadlessWebContentView& view, StringVie
         loop.quit(0);
     });
 
-    auto url = URL::create_with_file_scheme(TRY(FileSystem::real_path(input_path)));
+    // The phase timings are totals for the lifetime of the page, so this iteration's share is the difference.
+    auto metrics_before = TRY(view.dump_page_load_metrics());
+
+    HashMap<ByteString, u64> peak_memory_usage;
+    auto sample_memory_usage = [&] {
+        auto& application = WebView::Application::the();
+        // Only the resident memory of each process is reported, so don't make WebContent walk its JS heap every time.
+        application.update_process_statistics(WebView::RequestMemoryStatistics::No);
+        application.for_each_process_statistics([&](auto const& process, auto const& statistics) {
+            auto& peak = peak_memory_usage.ensure(WebView::process_name_from_type(process.type()), [] { return 0; });
+            peak = max(peak, statistics.memory_usage_bytes);
+        });
+    };
+    auto memory_sample_timer = Core::Timer::create_repeating(BENCHMARK_MEMORY_SAMPLE_INTERVAL_MS, sample_memory_usage);
 
-    String result;
-    auto did_finish_test = false;
-    auto did_finish_loading = false;
+    view.on_load_finish = [&](auto const& loaded_url) {
+        // NOTE: We don't want subframe loads to finish the iteration.
+        if (url.equals(loaded_url, URL::ExcludeFragment::Yes))
+            loop.quit(0);
+    };
 
-    if (mode == TestMode::Layout) {
-        view.on_load_finish = [&](auto const& loaded_url) {
-            // This callback will be called for 'about:blank' first, then for the URL we actually want to dump
-            VERIFY(url.equals(loaded_url, URL::ExcludeFragment::Yes) || loaded_url.equals(URL::URL("about:blank")));
+    auto load_timer = Core::ElapsedTimer::start_new();
+    view.load(url);
 
-            if (url.equals(loaded_url, URL::ExcludeFragment::Yes)) {
-                // NOTE: We take a screenshot here to force the lazy layout of SVG-as-image documents to happen.
-                //       It also causes a lot more code to run, which is good for finding bugs. :^)
-                (void)view.take_screenshot();
+    timeout_timer->start();
+    memory_sample_timer->start();
+    loop.exec();
 
-                StringBuilder builder;
-                builder.append(view.dump_layout_tree().release_value_but_fixme_should_propagate_errors());
-                builder.append("\n"sv);
-                builder.append(view.dump_paint_tree().release_value_but_fixme_should_propagate_errors());
-                result = builder.to_string().release_value_but_fixme_should_propagate_errors();
+    auto load_time = load_timer.elapsed_time();
+    memory_sample_timer->stop();
+    sample_memory_usage();
+    view.on_load_finish = {};
 
-                loop.quit(0);
+    if (did_timeout)
+        return Error::from_string_literal("Timed out waiting for the page to load");
+
+    auto metrics = TRY(view.dump_page_load_metrics());
+    JsonObject result;
+
+    // This is measured by the UI process, from the start of the navigation until the load event has been handled.
+    result.set("load_finished"sv, static_cast<double>(load_time.to_microseconds()) / 1000.0);
+    for (auto milestone : { "first_paint"sv, "dom_content_loaded"sv, "load"sv }) {
+        if (auto value = metrics.get(milestone); value.has_value())
+            result.set(milestone, *value);
+        else
+            result.set(milestone, JsonValue {});
+    }
+
+    JsonObject phases;
+    if (auto phases_after = metrics.get_object("phases"sv); phases_after.has_value()) {
+        auto phases_before = metrics_before.get_object("phases"sv);
+        phases_after->for_each_member([&](auto const& name, auto const& value) {
+            auto before = phases_before.has_value() ? phases_before->get_i64(name).value_or(0) : 0;
+            phases.set(name, value.get_i64().value_or(0) - before);
+        });
+    }
+    result.set("phases"sv, move(phases));
+
+    JsonObject peak_rss;
+    for (auto const& it : peak_memory_usage)
+        peak_rss.set(it.key, it.value);
+    result.set("peak_rss"sv, move(peak_rss));
+
+    return result;
+}
+
+static ErrorOr<int> run_benchmark(HeadlessWebContentView& view, StringView url_list_path, size_t iteration_count, int timeout_in_milliseconds = DEFAULT_TIMEOUT_MS)
+{
+    auto urls = TRY(load_benchmark_urls(url_list_path));
+
+    JsonArray pages;
+    bool did_fail = false;
+
+    for (auto const& url : urls) {
+        JsonArray runs;
+
+        for (size_t i = 0; i < iteration_count; ++i) {
+            warnln("{}/{}: {}", i + 1, iteration_count, url);
+
+            auto run = run_benchmark_iteration(view, url, timeout_in_milliseconds);
+            if (run.is_error()) {
+                warnln("Failed to benchmark {}: {}", url, run.error());
+                did_fail = true;
+                break;
             }
-        };
-        view.on_text_test_finish = {};
-    } else if (mode == TestMode::Text) {
+            runs.must_append(run.release_value());
+        }
 
-        view.on_load_finish = [&](auto const& loaded_url) {
-            // NOTE: We don't want subframe loads to trigger the test finish.
-            if (!url.equals(loaded_url, URL::ExcludeFragment::Yes))
-                return;
-            did_finish_loading = true;
-            if (did_finish_test)
-                loop.quit(0);
-        };
-        view.on_text_test_finish = [&]() {
-            result = view.dump_text().release_value_but_fixme_should_propagate_errors();
-            did_finish_test = true;
-            if (did_finish_loading)
-                loop.quit(0);
-        };
+        JsonObject page;
+        page.set("url"sv, url.serialize());
+        page.set("runs"sv, move(runs));
+        pages.must_append(move(page));
     }
 
-    view.load(url);
+    JsonObject report;
+    report.set("iterations"sv, iteration_count);
+    report.set("pages"sv, move(pages));
+    outln("{}", report.to_byte_string());
 
-    timeout_timer->start();
-    loop.exec();
+    return did_fail ? 1 : 0;
+}
 
-    if (did_timeout)
-        return TestResult::Timeout;
+enum class TestMode {
+    Layout,
+    Text,
+    Ref,
+};
+
+static StringView test_result_to_string(TestResult result)
+{
+    switch (result) {
+    case TestResult::Pass:
+        return "Pass"sv;
+    case TestResult::Fail:
+        return "Fail"sv;
+    case TestResult::Skipped:
+        return "Skipped"sv;
+    case TestResult::Timeout:
+        return "Timeout"sv;
+    }
+    VERIFY_NOT_REACHED();
+}
 
+static ErrorOr<TestResult> check_dump_test_result(StringView input_path, String const& result, StringView expectation_path)
+{
     if (expectation_path.is_empty()) {
         out("{}", result);
         return TestResult::Skipped;
@@ -349,42 +535,65 @@ static ErrorOr<TestResult> run_dump_test(HeadlessWebContentView& view, StringVie
     return TestResult::Fail;
 }
 
-static ErrorOr<TestResult> run_ref_test(HeadlessWebContentView& view, StringView input_path, bool dump_failed_ref_tests, int timeout_in_milliseconds = DEFAULT_TIMEOUT_MS)
+static void run_dump_test(HeadlessWebContentView& view, StringView input_path, StringView expectation_path, TestMode mode, HeadlessWebContentView::TestCompletionHandler on_test_complete, int timeout_in_milliseconds = DEFAULT_TIMEOUT_MS)
 {
-    Core::EventLoop loop;
-    bool did_timeout = false;
+    view.start_test(input_path, timeout_in_milliseconds, move(on_test_complete));
 
-    auto timeout_timer = Core::Timer::create_single_shot(timeout_in_milliseconds, [&] {
-        did_timeout = true;
-        loop.quit(0);
-    });
-
-    RefPtr<Gfx::Bitmap> actual_screenshot, expectation_screenshot;
-    view.on_load_finish = [&](auto const&) {
-        if (actual_screenshot) {
-            expectation_screenshot = view.take_screenshot();
-            loop.quit(0);
-        } else {
-            actual_screenshot = view.take_screenshot();
-            view.debug_request("load-reference-page");
-        }
-    };
-    view.on_text_test_finish = [&] {
-        dbgln("Unexpected text test finished during ref test for {}", input_path);
-    };
+    auto real_path = FileSystem::real_path(input_path);
+    if (real_path.is_error()) {
+        view.finish_test(real_path.release_error());
+        return;
+    }
+    auto url = URL::create_with_file_scheme(real_path.release_value());
 
-    view.load(URL::create_with_file_scheme(TRY(FileSystem::real_path(input_path))));
+    if (mode == TestMode::Layout) {
+        view.on_load_finish = [&view, url, input_path, expectation_path](auto const& loaded_url) {
+            // This callback will be called for 'about:blank' first, then for the URL we actually want to dump
+            VERIFY(url.equals(loaded_url, URL::ExcludeFragment::Yes) || loaded_url.equals(URL::URL("about:blank")));
 
-    timeout_timer->start();
-    loop.exec();
+            if (url.equals(loaded_url, URL::ExcludeFragment::Yes)) {
+                // NOTE: We take a screenshot here to force the lazy layout of SVG-as-image documents to happen.
+                //       It also causes a lot more code to run, which is good for finding bugs. :^)
+                view.take_screenshot()->when_resolved([&view, input_path, expectation_path](RefPtr<Gfx::Bitmap>&) {
+                    StringBuilder builder;
+                    builder.append(view.dump_layout_tree().release_value_but_fixme_should_propagate_errors());
+                    builder.append("\n"sv);
+                    builder.append(view.dump_paint_tree().release_value_but_fixme_should_propagate_errors());
+                    auto result = builder.to_string().release_value_but_fixme_should_propagate_errors();
+
+                    view.finish_test(check_dump_test_result(input_path, result, expectation_path));
+                });
+            }
+        };
+        view.on_text_test_finish = {};
+    } else if (mode == TestMode::Text) {
+        struct TextTestState : public RefCounted<TextTestState> {
+            Optional<String> result;
+            bool did_finish_loading { false };
+        };
+        auto state = make_ref_counted<TextTestState>();
 
-    if (did_timeout)
-        return TestResult::Timeout;
+        view.on_load_finish = [&view, state, url, input_path, expectation_path](auto const& loaded_url) {
+            // NOTE: We don't want subframe loads to trigger the test finish.
+            if (!url.equals(loaded_url, URL::ExcludeFragment::Yes))
+                return;
+            state->did_finish_loading = true;
+            if (state->result.has_value())
+                view.finish_test(check_dump_test_result(input_path, *state->result, expectation_path));
+        };
+        view.on_text_test_finish = [&view, state, input_path, expectation_path]() {
+            state->result = view.dump_text().release_value_but_fixme_should_propagate_errors();
+            if (state->did_finish_loading)
+                view.finish_test(check_dump_test_result(input_path, *state->result, expectation_path));
+        };
+    }
 
-    VERIFY(actual_screenshot);
-    VERIFY(expectation_screenshot);
+    view.load(url);
+}
 
-    if (actual_screenshot->visually_equals(*expectation_screenshot))
+static ErrorOr<TestResult> check_ref_test_result(StringView input_path, Gfx::Bitmap& actual_screenshot, Gfx::Bitmap& expectation_screenshot, bool dump_failed_ref_tests)
+{
+    if (actual_screenshot.visually_equals(expectation_screenshot))
         return TestResult::Pass;
 
     if (dump_failed_ref_tests) {
@@ -401,24 +610,72 @@ static ErrorOr<TestResult> run_ref_test(HeadlessWebContentView& view, StringView
         auto mkdir_result = Core::System::mkdir("test-dumps"sv, 0755);
         if (mkdir_result.is_error() && mkdir_result.error().code() != EEXIST)
             return mkdir_result.release_error();
-        TRY(dump_screenshot(*actual_screenshot, TRY(String::formatted("test-dumps/{}.png", title))));
-        TRY(dump_screenshot(*expectation_screenshot, TRY(String::formatted("test-dumps/{}-ref.png", title))));
+        TRY(dump_screenshot(actual_screenshot, TRY(String::formatted("test-dumps/{}.png", title))));
+        TRY(dump_screenshot(expectation_screenshot, TRY(String::formatted("test-dumps/{}-ref.png", title))));
     }
 
     return TestResult::Fail;
 }
 
-static ErrorOr<TestResult> run_test(HeadlessWebContentView& view, StringView input_path, StringView expectation_path, TestMode mode, bool dump_failed_ref_tests)
+static void run_ref_test(HeadlessWebContentView& view, StringView input_path, bool dump_failed_ref_tests, HeadlessWebContentView::TestCompletionHandler on_test_complete, int timeout_in_milliseconds = DEFAULT_TIMEOUT_MS)
+{
+    view.start_test(input_path, timeout_in_milliseconds, move(on_test_complete));
+
+    auto real_path = FileSystem::real_path(input_path);
+    if (real_path.is_error()) {
+        view.finish_test(real_path.release_error());
+        return;
+    }
+
+    struct RefTestState : public RefCounted<RefTestState> {
+        RefPtr<Gfx::Bitmap> actual_screenshot;
+    };
+    auto state = make_ref_counted<RefTestState>();
+
+    view.on_load_finish = [&view, state, input_path, dump_failed_ref_tests](auto const&) {
+        view.take_screenshot()->when_resolved([&view, state, input_path, dump_failed_ref_tests](RefPtr<Gfx::Bitmap>& screenshot) {
+            VERIFY(screenshot);
+
+            if (!state->actual_screenshot) {
+                state->actual_screenshot = move(screenshot);
+                view.debug_request("load-reference-page");
+                return;
+            }
+
+            view.finish_test(check_ref_test_result(input_path, *state->actual_screenshot, *screenshot, dump_failed_ref_tests));
+        });
+    };
+    view.on_text_test_finish = [input_path] {
+        dbgln("Unexpected text test finished during ref test for {}", input_path);
+    };
+
+    view.load(URL::create_with_file_scheme(real_path.release_value()));
+}
+
+static void run_test(HeadlessWebContentView& view, StringView input_path, StringView expectation_path, TestMode mode, bool dump_failed_ref_tests, HeadlessWebContentView::TestCompletionHandler on_test_complete)
 {
     // Clear the current document.
     // FIXME: Implement a debug-request to do this more thoroughly.
-    auto promise = Core::Promise<Empty>::construct();
-    view.on_load_finish = [&](auto) {
-        promise->resolve({});
+    view.on_load_finish = [&view, input_path, expectation_path, mode, dump_failed_ref_tests, on_test_complete = move(on_test_complete)](auto) mutable {
+        view.on_load_finish = nullptr;
+
+        // NOTE: The test replaces this callback, which it can't do while we're still running.
+        Core::deferred_invoke([&view, input_path, expectation_path, mode, dump_failed_ref_tests, on_test_complete = move(on_test_complete)]() mutable {
+            switch (mode) {
+            case TestMode::Text:
+            case TestMode::Layout:
+                run_dump_test(view, input_path, expectation_path, mode, move(on_test_complete));
+                return;
+            case TestMode::Ref:
+                run_ref_test(view, input_path, dump_failed_ref_tests, move(on_test_complete));
+                return;
+            }
+            VERIFY_NOT_REACHED();
+        });
     };
     view.on_text_test_finish = {};
 
-    view.on_request_file_picker = [&](auto const& accepted_file_types, auto allow_multiple_files) {
+    view.on_request_file_picker = [&view](auto const& accepted_file_types, auto allow_multiple_files) {
         // Create some dummy files for tests.
         Vector<Web::HTML::SelectedFile> selected_files;
 
@@ -460,18 +717,6 @@ static ErrorOr<TestResult> run_test(HeadlessWebContentView& view, StringView inp
     };
 
     view.load(URL::URL("about:blank"sv));
-    MUST(promise->await());
-
-    s_current_test_path = input_path;
-    switch (mode) {
-    case TestMode::Text:
-    case TestMode::Layout:
-        return run_dump_test(view, input_path, expectation_path, mode);
-    case TestMode::Ref:
-        return run_ref_test(view, input_path, dump_failed_ref_tests);
-    default:
-        VERIFY_NOT_REACHED();
-    }
 }
 
 struct Test {
@@ -479,6 +724,7 @@ struct Test {
     String expectation_path;
     TestMode mode;
     Optional<TestResult> result;
+    AK::Duration duration;
 };
 
 static Vector<ByteString> s_skipped_tests;
@@ -543,10 +789,8 @@ static ErrorOr<void> collect_ref_tests(Vector<Test>& tests, StringView path)
     return {};
 }
 
-static ErrorOr<int> run_tests(HeadlessWebContentView& view, StringView test_root_path, StringView test_glob, bool dump_failed_ref_tests, bool dump_gc_graph)
+static ErrorOr<int> run_tests(HeadlessWebContentView& view, StringView test_root_path, StringView test_glob, size_t concurrency, bool dump_failed_ref_tests, bool dump_gc_graph)
 {
-    view.clear_content_filters();
-
     TRY(load_test_config(test_root_path));
 
     Vector<Test> tests;
@@ -558,6 +802,35 @@ static ErrorOr<int> run_tests(HeadlessWebContentView& view, StringView test_root
         return !test.input_path.bytes_as_string_view().matches(test_glob, CaseSensitivity::CaseSensitive);
     });
 
+    // Every view takes the next test as soon as it is done with its previous one. Starting with the kinds of tests
+    // that take the longest keeps a slow test from being the only one left running at the end.
+    auto relative_test_duration = [](TestMode mode) {
+        switch (mode) {
+        case TestMode::Ref:
+            return 2;
+        case TestMode::Layout:
+            return 1;
+        case TestMode::Text:
+            return 0;
+        }
+        VERIFY_NOT_REACHED();
+    };
+    quick_sort(tests, [&](auto const& a, auto const& b) {
+        return relative_test_duration(a.mode) > relative_test_duration(b.mode);
+    });
+
+    // Each view runs its tests in a WebContent process of its own, and reuses it from one test to the next.
+    Vector<NonnullOwnPtr<HeadlessWebContentView>> sibling_views;
+    Vector<HeadlessWebContentView&> views;
+    views.append(view);
+    for (size_t i = 1; i < min(concurrency, tests.size()); ++i) {
+        sibling_views.append(TRY(view.create_sibling()));
+        views.append(*sibling_views.last());
+    }
+
+    for (auto& test_view : views)
+        test_view.clear_content_filters();
+
     size_t pass_count = 0;
     size_t fail_count = 0;
     size_t timeout_count = 0;
@@ -565,44 +838,82 @@ static ErrorOr<int> run_tests(HeadlessWebContentView& view, StringView test_root
 
     bool is_tty = isatty(STDOUT_FILENO);
 
-    outln("Running {} tests...", tests.size());
-    for (size_t i = 0; i < tests.size(); ++i) {
-        auto& test = tests[i];
+    size_t finished_count = 0;
+    auto report_finished_test = [&](Test const& test) {
+        ++finished_count;
 
         if (is_tty) {
             // Keep clearing and reusing the same line if stdout is a TTY.
             out("\33[2K\r");
         }
 
-        out("{}/{}: {}", i + 1, tests.size(), LexicalPath::relative_path(test.input_path, test_root_path));
+        out("{}/{}: {} ({}ms)", finished_count, tests.size(), LexicalPath::relative_path(test.input_path, test_root_path), test.duration.to_milliseconds());
 
         if (is_tty)
             fflush(stdout);
         else
             outln("");
+    };
 
-        if (s_skipped_tests.contains_slow(test.input_path.bytes_as_string_view())) {
-            test.result = TestResult::Skipped;
-            ++skipped_count;
-            continue;
-        }
+    Core::EventLoop loop;
+    Optional<Error> error;
+    size_t next_test_index = 0;
+    size_t running_view_count = views.size();
+
+    Function<void(HeadlessWebContentView&)> run_next_test = [&](HeadlessWebContentView& test_view) {
+        while (!error.has_value() && next_test_index < tests.size()) {
+            auto& test = tests[next_test_index++];
+
+            if (s_skipped_tests.contains_slow(test.input_path.bytes_as_string_view())) {
+                test.result = TestResult::Skipped;
+                ++skipped_count;
+                report_finished_test(test);
+                continue;
+            }
 
-        test.result = TRY(run_test(view, test.input_path, test.expectation_path, test.mode, dump_failed_ref_tests));
-        switch (*test.result) {
-        case TestResult::Pass:
-            ++pass_count;
-            break;
-        case TestResult::Fail:
-            ++fail_count;
-            break;
-        case TestResult::Timeout:
-            ++timeout_count;
-            break;
-        case TestResult::Skipped:
-            VERIFY_NOT_REACHED();
-            break;
+            auto timer = Core::ElapsedTimer::start_new();
+            run_test(test_view, test.input_path, test.expectation_path, test.mode, dump_failed_ref_tests, [&, current_view = &test_view, current_test = &test, timer](ErrorOr<TestResult> result) {
+                auto& finished_test = *current_test;
+                finished_test.duration = timer.elapsed_time();
+
+                if (result.is_error()) {
+                    if (!error.has_value())
+                        error = result.release_error();
+                } else {
+                    finished_test.result = result.release_value();
+                    switch (*finished_test.result) {
+                    case TestResult::Pass:
+                        ++pass_count;
+                        break;
+                    case TestResult::Fail:
+                        ++fail_count;
+                        break;
+                    case TestResult::Timeout:
+                        ++timeout_count;
+                        break;
+                    case TestResult::Skipped:
+                        VERIFY_NOT_REACHED();
+                        break;
+                    }
+                    report_finished_test(finished_test);
+                }
+
+                run_next_test(*current_view);
+            });
+            return;
         }
-    }
+
+        if (--running_view_count == 0)
+            loop.quit(0);
+    };
+
+    outln("Running {} tests on {} WebContent processes...", tests.size(), views.size());
+    for (auto& test_view : views)
+        run_next_test(test_view);
+    loop.exec();
+
+    if (error.has_value())
+        return error.release_value();
 
     if (is_tty)
         outln("\33[2K\rDone!");
@@ -616,6 +927,17 @@ static ErrorOr<int> run_tests(HeadlessWebContentView& view, StringView test_root
         outln("{}: {}", test_result_to_string(*test.result), test.input_path);
     }
 
+    static constexpr size_t slowest_test_count = 10;
+    quick_sort(tests, [](auto const& a, auto const& b) {
+        return a.duration > b.duration;
+    });
+    outln("Slowest tests:");
+    for (size_t i = 0; i < min(slowest_test_count, tests.size()); ++i) {
+        if (tests[i].result == TestResult::Skipped)
+            break;
+        outln("{}ms: {}", tests[i].duration.to_milliseconds(), tests[i].input_path);
+    }
+
     if (dump_gc_graph) {
         auto path = view.dump_gc_graph();
         if (path.is_error()) {
@@ -642,9 +964,14 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     bool dump_layout_tree = false;
     bool dump_text = false;
     bool dump_gc_graph = false;
+    size_t gc_allocation_sample_interval = 0;
+    bool dump_frame_timings = false;
     bool is_layout_test_mode = false;
     StringView test_root_path;
     ByteString test_glob;
+    size_t test_concurrency = Core::System::hardware_concurrency();
+    StringView benchmark_url_list_path;
+    size_t benchmark_iterations = 5;
     Vector<ByteString> certificates;
 
     platform_init();
@@ -657,8 +984,13 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     args_parser.add_option(dump_text, "Dump text and exit", "dump-text", 'T');
     args_parser.add_option(test_root_path, "Run tests in path", "run-tests", 'R', "test-root-path");
     args_parser.add_option(test_glob, "Only run tests matching the given glob", "filter", 'f', "glob");
+    args_parser.add_option(test_concurrency, "Number of WebContent processes to run tests on (defaults to the number of cores)", "test-concurrency", 'j', "n");
     args_parser.add_option(dump_failed_ref_tests, "Dump screenshots of failing ref tests", "dump-failed-ref-tests", 'D');
     args_parser.add_option(dump_gc_graph, "Dump GC graph", "dump-gc-graph", 'G');
+    args_parser.add_option(gc_allocation_sample_interval, "Record the allocation site of every Nth GC allocation, to be included in the dumped GC graph", "gc-allocation-sample-interval", 0, "n");
+    args_parser.add_option(dump_frame_timings, "Dump the timings of the frame painted for the screenshot", "dump-frame-timings");
+    args_parser.add_option(benchmark_url_list_path, "Load each URL listed in the given file and report page load metrics as JSON", "benchmark", 0, "url-list-path");
+    args_parser.add_option(benchmark_iterations, "Number of times to load each page in benchmark mode (default: 5)", "benchmark-iterations", 0, "n");
     args_parser.add_option(resources_folder, "Path of the base resources folder (defaults to /res)", "resources", 'r', "resources-root-path");
     args_parser.add_option(web_driver_ipc_path, "Path to the WebDriver IPC socket", "webdriver-ipc-path", 0, "path");
     args_parser.add_option(is_layout_test_mode, "Enable layout test mode", "layout-test-mode");
@@ -681,31 +1013,36 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
 
     StringBuilder command_line_builder;
     command_line_builder.join(' ', arguments.strings);
-    auto view = TRY(HeadlessWebContentView::create(move(theme), window_size, MUST(command_line_builder.to_string()), web_driver_ipc_path, is_layout_test_mode ? Ladybird::IsLayoutTestMode::Yes : Ladybird::IsLayoutTestMode::No, certificates, resources_folder));
+    auto view = TRY(HeadlessWebContentView::create(move(theme), window_size, MUST(command_line_builder.to_string()), web_driver_ipc_path, is_layout_test_mode ? Ladybird::IsLayoutTestMode::Yes : Ladybird::IsLayoutTestMode::No, certificates, resources_folder, gc_allocation_sample_interval));
 
     if (!test_root_path.is_empty()) {
         test_glob = ByteString::formatted("*{}*", test_glob);
-        return run_tests(*view, test_root_path, test_glob, dump_failed_ref_tests, dump_gc_graph);
+        return run_tests(*view, test_root_path, test_glob, max<size_t>(test_concurrency, 1), dump_failed_ref_tests, dump_gc_graph);
     }
 
+    if (!benchmark_url_list_path.is_empty())
+        return run_benchmark(*view, benchmark_url_list_path, benchmark_iterations);
+
     auto url = WebView::sanitize_url(raw_url);
     if (!url.has_value()) {
         warnln("Invalid URL: \"{}\"", raw_url);
         return Error::from_string_literal("Invalid URL");
     }
 
-    if (dump_layout_tree) {
-        TRY(run_dump_test(*view, raw_url, ""sv, TestMode::Layout));
-        return 0;
-    }
-
-    if (dump_text) {
-        TRY(run_dump_test(*view, raw_url, ""sv, TestMode::Text));
+    if (dump_layout_tree || dump_text) {
+        auto promise = Core::Promise<TestResult>::construct();
+        run_dump_test(*view, raw_url, ""sv, dump_layout_tree ? TestMode::Layout : TestMode::Text, [&](ErrorOr<TestResult> result) {
+            if (result.is_error())
+                promise->reject(result.release_error());
+            else
+                promise->resolve(result.release_value());
+        });
+        TRY(promise->await());
         return 0;
     }
 
     if (web_driver_ipc_path.is_empty()) {
-        auto timer = TRY(load_page_for_screenshot_and_exit(Core::EventLoop::current(), *view, url.value(), screenshot_timeout));
+        auto timer = TRY(load_page_for_screenshot_and_exit(Core::EventLoop::current(), *view, url.value(), screenshot_timeout, dump_frame_timings));
         return app.exec();
     }
 
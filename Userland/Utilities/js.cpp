@@ -7,6 +7,7 @@
  */
 
 #include <AK/JsonValue.h>
+#include <AK/ScopeGuard.h>
 #include <AK/StringBuilder.h>
 #include <LibCore/ArgsParser.h>
 #include <LibCore/ConfigFile.h>
@@ -78,6 +79,7 @@ static bool s_as_module = false;
 static bool s_print_last_result = false;
 static bool s_strip_ansi = false;
 static bool s_disable_source_location_hints = false;
+static bool s_dump_opcode_stats = false;
 static RefPtr<Line::Editor> s_editor;
 static String s_history_path = String {};
 static int s_repl_line_level = 0;
@@ -527,9 +529,11 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     TRY(Core::System::pledge("stdio rpath wpath cpath tty sigaction map_fixed"));
 
     bool gc_on_every_allocation = false;
+    size_t gc_marking_threads = 0;
     bool disable_syntax_highlight = false;
     bool disable_debug_printing = false;
     bool use_test262_global = false;
+    bool disable_bytecode_optimizations = false;
     StringView evaluate_script;
     Vector<StringView> script_paths;
 
@@ -537,11 +541,14 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     args_parser.set_general_help("This is a JavaScript interpreter.");
     args_parser.add_option(s_dump_ast, "Dump the AST", "dump-ast", 'A');
     args_parser.add_option(JS::Bytecode::g_dump_bytecode, "Dump the bytecode", "dump-bytecode", 'd');
+    args_parser.add_option(disable_bytecode_optimizations, "Disable bytecode optimizations", "disable-bytecode-optimizations", {});
+    args_parser.add_option(s_dump_opcode_stats, "Dump opcode and inline cache statistics on exit", "dump-opcode-stats", {});
     args_parser.add_option(s_as_module, "Treat as module", "as-module", 'm');
     args_parser.add_option(s_print_last_result, "Print last result", "print-last-result", 'l');
     args_parser.add_option(s_strip_ansi, "Disable ANSI colors", "disable-ansi-colors", 'i');
     args_parser.add_option(s_disable_source_location_hints, "Disable source location hints", "disable-source-location-hints", 'h');
     args_parser.add_option(gc_on_every_allocation, "GC on every allocation", "gc-on-every-allocation", 'g');
+    args_parser.add_option(gc_marking_threads, "Number of helper threads that mark large heaps", "gc-marking-threads", {}, "count");
     args_parser.add_option(disable_syntax_highlight, "Disable live syntax highlighting", "no-syntax-highlight", 's');
     args_parser.add_option(disable_debug_printing, "Disable debug output", "disable-debug-output", {});
     args_parser.add_option(evaluate_script, "Evaluate argument as a script", "evaluate", 'c', "script");
@@ -550,6 +557,7 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     args_parser.parse(arguments);
 
     bool syntax_highlight = !disable_syntax_highlight;
+    JS::Bytecode::g_optimize_bytecode = !disable_bytecode_optimizations;
 
     AK::set_debug_enabled(!disable_debug_printing);
     s_history_path = TRY(String::formatted("{}/.js-history", Core::StandardPaths::home_directory()));
@@ -557,6 +565,15 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     g_vm = TRY(JS::VM::create());
     g_vm->set_dynamic_imports_allowed(true);
 
+    ScopeGuard dump_opcode_stats = [] {
+        if (!s_dump_opcode_stats)
+            return;
+        auto statistics = g_vm->bytecode_interpreter().bytecode_statistics();
+        if (!statistics.get_bool("instruction_counts_enabled"sv).value_or(false))
+            warnln("NOTE: Opcode and inline cache counts are only collected when LibJS is built with JS_BYTECODE_STATS_DEBUG.");
+        outln("{}", statistics.to_byte_string());
+    };
+
     if (!disable_debug_printing) {
         // NOTE: These will print out both warnings when using something like Promise.reject().catch(...) -
         // which is, as far as I can tell, correct - a promise is created, rejected without handler, and a
@@ -588,6 +605,7 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
         ReplConsoleClient console_client(console_object.console());
         console_object.console().set_client(console_client);
         g_vm->heap().set_should_collect_on_every_allocation(gc_on_every_allocation);
+        g_vm->heap().set_marking_thread_count(gc_marking_threads);
 
         auto& global_environment = realm.global_environment();
 
@@ -805,6 +823,7 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
         ReplConsoleClient console_client(console_object.console());
         console_object.console().set_client(console_client);
         g_vm->heap().set_should_collect_on_every_allocation(gc_on_every_allocation);
+        g_vm->heap().set_marking_thread_count(gc_marking_threads);
 
         StringBuilder builder;
         StringView source_name;
@@ -10,6 +10,7 @@
 #include <AK/MemoryStream.h>
 #include <AK/StackInfo.h>
 #include <LibCore/ArgsParser.h>
+#include <LibCore/ElapsedTimer.h>
 #include <LibCore/File.h>
 #include <LibCore/MappedFile.h>
 #include <LibFileSystem/FileSystem.h>
@@ -17,6 +18,7 @@
 #include <LibMain/Main.h>
 #include <LibWasm/AbstractMachine/AbstractMachine.h>
 #include <LibWasm/AbstractMachine/BytecodeInterpreter.h>
+#include <LibWasm/AbstractMachine/Validator.h>
 #include <LibWasm/Printer/Printer.h>
 #include <LibWasm/Types.h>
 #include <LibWasm/Wasi.h>
@@ -491,6 +493,7 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     bool export_all_imports = false;
     bool shell_mode = false;
     bool wasi = false;
+    bool benchmark_validate = false;
     ByteString exported_function_to_execute;
     Vector<Wasm::Value> values_to_push;
     Vector<ByteString> modules_to_link_in;
@@ -506,6 +509,7 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     parser.add_option(export_all_imports, "Export noop functions corresponding to imports", "export-noop");
     parser.add_option(shell_mode, "Launch a REPL in the module's context (implies -i)", "shell", 's');
     parser.add_option(wasi, "Enable WASI", "wasi", 'w');
+    parser.add_option(benchmark_validate, "Report how long parsing and validating the module takes, then exit", "benchmark-validate");
     parser.add_option(Core::ArgsParser::Option {
         .argument_mode = Core::ArgsParser::OptionArgumentMode::Required,
         .help_string = "Directory mappings to expose via WASI",
@@ -570,9 +574,24 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     if (!exported_function_to_execute.is_empty())
         attempt_instantiate = true;
 
+    auto parse_timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
     auto parse_result = parse(filename);
     if (!parse_result.has_value())
         return 1;
+    auto parse_time = parse_timer.elapsed_time();
+
+    if (benchmark_validate) {
+        Wasm::AbstractMachine machine;
+        auto validate_timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+        auto validation_result = machine.validate(parse_result.value());
+        auto validate_time = validate_timer.elapsed_time();
+        if (validation_result.is_error()) {
+            warnln("Module failed to validate: {}", validation_result.error().error_string);
+            return 1;
+        }
+        outln("Parsed in {}us, validated in {}us", parse_time.to_microseconds(), validate_time.to_microseconds());
+        return 0;
+    }
 
     g_stdout = TRY(Core::File::standard_output());
     g_printer = TRY(try_make<Wasm::Printer>(*g_stdout));